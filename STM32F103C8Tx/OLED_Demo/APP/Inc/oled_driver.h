@@ -149,7 +149,8 @@ typedef struct OLED_HandleTypeDef {
     
     /* 状态标志 */
     bool is_initialized;              /* 是否已初始化 */
-    bool dma_busy;                    /* DMA是否忙碌 */
+    volatile bool dma_busy;           /* DMA是否忙碌（完成/错误回调中清除） */
+    volatile uint32_t dma_error;      /* 最近一次DMA传输的错误原因（HAL_I2C_ERROR_xxx） */
 } OLED_HandleTypeDef;
 
 /* Exported constants --------------------------------------------------------*/
@@ -418,6 +419,12 @@ bool OLED_IsDMAReady(OLED_HandleTypeDef *holed);
   */
 void OLED_DMATxCpltCallback(OLED_HandleTypeDef *holed);
 
+/**
+  * @brief  I2C DMA传输错误回调（需要在HAL_I2C_ErrorCallback中调用）
+  * @param  holed: OLED句柄指针
+  */
+void OLED_DMAErrorCallback(OLED_HandleTypeDef *holed);
+
 #ifdef __cplusplus
 }
 #endif
@@ -34,7 +34,7 @@ static void OLED_ResetDirtyRegion(OLED_HandleTypeDef *holed);
 static void OLED_ExpandDirtyRegion(OLED_HandleTypeDef *holed, uint8_t x, uint8_t y);
 static HAL_StatusTypeDef OLED_Init_SSD1306(OLED_HandleTypeDef *holed);
 static HAL_StatusTypeDef OLED_Init_SH1106(OLED_HandleTypeDef *holed);
-static void OLED_WaitDMAComplete(OLED_HandleTypeDef *holed, uint32_t timeout);
+static HAL_StatusTypeDef OLED_WaitDMAComplete(OLED_HandleTypeDef *holed, uint32_t timeout);
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -95,6 +95,7 @@ static HAL_StatusTypeDef OLED_SendData_DMA(OLED_HandleTypeDef *holed, uint8_t *d
     oled_data_buffer[0] = OLED_DATA_MODE;
     memcpy(&oled_data_buffer[1], data, len);
     
+    holed->dma_error = HAL_I2C_ERROR_NONE;
     holed->dma_busy = true;
     status = HAL_I2C_Master_Transmit_DMA(holed->hi2c, holed->i2c_addr, oled_data_buffer, len + 1);
     
@@ -118,29 +119,24 @@ static void OLED_DelayMs(uint32_t delay)
 
 /**
   * @brief  等待DMA传输完成
+  * @note   dma_busy 由I2C完成/错误回调清除；等待期间 __WFI 睡眠，
+  *         由I2C中断（或SysTick）唤醒后立即检查，不再空转或按1ms轮询
   * @param  holed: OLED句柄指针
   * @param  timeout: 超时时间（毫秒）
+  * @retval HAL_OK=完成，HAL_ERROR=传输出错（原因见 holed->dma_error），HAL_TIMEOUT=超时
   */
-static void OLED_WaitDMAComplete(OLED_HandleTypeDef *holed, uint32_t timeout)
+static HAL_StatusTypeDef OLED_WaitDMAComplete(OLED_HandleTypeDef *holed, uint32_t timeout)
 {
     uint32_t start_tick = HAL_GetTick();
     
     if (holed == NULL || holed->hi2c == NULL)
     {
-        return;
-    }
-    
-    /* 如果I2C状态已经是READY，直接清除busy标志 */
-    if (holed->hi2c->State == HAL_I2C_STATE_READY)
-    {
-        holed->dma_busy = false;
-        return;
+        return HAL_ERROR;
     }
     
-    /* 等待DMA传输完成或超时 */
     while (holed->dma_busy)
     {
-        /* 检查I2C状态 */
+        /* 完成回调未接入时，I2C状态回到READY也视为完成 */
         if (holed->hi2c->State == HAL_I2C_STATE_READY)
         {
             holed->dma_busy = false;
@@ -150,10 +146,21 @@ static void OLED_WaitDMAComplete(OLED_HandleTypeDef *holed, uint32_t timeout)
         if (HAL_GetTick() - start_tick >= timeout)
         {
             /* 超时，强制清除busy标志 */
+            holed->dma_error = HAL_I2C_ERROR_TIMEOUT;
             holed->dma_busy = false;
-            break;
+            return HAL_TIMEOUT;
         }
+        
+        /* 关中断后再检查一次才睡眠，检查与睡眠之间到来的中断会挂起并立即唤醒WFI */
+        __disable_irq();
+        if (holed->dma_busy)
+        {
+            __WFI();
+        }
+        __enable_irq();
     }
+    
+    return (holed->dma_error == HAL_I2C_ERROR_NONE) ? HAL_OK : HAL_ERROR;
 }
 
 /**
@@ -377,6 +384,7 @@ HAL_StatusTypeDef OLED_Init(OLED_HandleTypeDef *holed,
     holed->framebuffer_size = config->width * holed->pages;
     holed->is_initialized = false;
     holed->dma_busy = false;
+    holed->dma_error = HAL_I2C_ERROR_NONE;
     holed->full_refresh = true;
     
     /* 重置脏矩形区域 */
@@ -545,23 +553,7 @@ HAL_StatusTypeDef OLED_Refresh(OLED_HandleTypeDef *holed)
     }
     
     /* 等待DMA完成 */
-    uint32_t start_tick = HAL_GetTick();
-    while (holed->dma_busy)
-    {
-        if (!OLED_IsDMAReady(holed))
-        {
-            if (HAL_GetTick() - start_tick > 100) /* 100ms超时 */
-            {
-                holed->dma_busy = false;
-                break;
-            }
-            HAL_Delay(1);
-        }
-        else
-        {
-            break;
-        }
-    }
+    OLED_WaitDMAComplete(holed, 100);
     
     col_offset = holed->config.col_offset;
     col_start = col_offset;
@@ -599,22 +591,9 @@ HAL_StatusTypeDef OLED_Refresh(OLED_HandleTypeDef *holed)
         status = holed->hw.send_data(holed, &holed->framebuffer[page * holed->width], holed->width);
         
         /* 等待DMA完成 */
-        start_tick = HAL_GetTick();
-        while (holed->dma_busy)
+        if (status == HAL_OK)
         {
-            if (!OLED_IsDMAReady(holed))
-            {
-                if (HAL_GetTick() - start_tick > 50) /* 50ms超时 */
-                {
-                    holed->dma_busy = false;
-                    break;
-                }
-                HAL_Delay(1);
-            }
-            else
-            {
-                break;
-            }
+            status = OLED_WaitDMAComplete(holed, 50);
         }
     }
     
@@ -657,17 +636,7 @@ HAL_StatusTypeDef OLED_RefreshDirty(OLED_HandleTypeDef *holed)
     }
     
     /* 等待DMA完成 */
-    while (holed->dma_busy)
-    {
-        if (!OLED_IsDMAReady(holed))
-        {
-            HAL_Delay(1);
-        }
-        else
-        {
-            break;
-        }
-    }
+    OLED_WaitDMAComplete(holed, 100);
     
     col_offset = holed->config.col_offset;
     
@@ -715,16 +684,9 @@ HAL_StatusTypeDef OLED_RefreshDirty(OLED_HandleTypeDef *holed)
         status = holed->hw.send_data(holed, page_data, data_len);
         
         /* 等待DMA完成 */
-        while (holed->dma_busy)
+        if (status == HAL_OK)
         {
-            if (!OLED_IsDMAReady(holed))
-            {
-                HAL_Delay(1);
-            }
-            else
-            {
-                break;
-            }
+            status = OLED_WaitDMAComplete(holed, 100);
         }
     }
     
@@ -1169,5 +1131,18 @@ void OLED_DMATxCpltCallback(OLED_HandleTypeDef *holed)
     }
 }
 
+/**
+  * @brief  I2C DMA传输错误回调（需要在HAL_I2C_ErrorCallback中调用）
+  * @param  holed: OLED句柄指针
+  */
+void OLED_DMAErrorCallback(OLED_HandleTypeDef *holed)
+{
+    if (holed != NULL && holed->hi2c != NULL)
+    {
+        holed->dma_error = (holed->hi2c->ErrorCode != HAL_I2C_ERROR_NONE) ? holed->hi2c->ErrorCode : HAL_I2C_ERROR_DMA;
+        holed->dma_busy = false;
+    }
+}
+
 /* USER CODE END 1 */
 
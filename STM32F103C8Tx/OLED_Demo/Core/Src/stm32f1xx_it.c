@@ -246,4 +246,17 @@ void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
     }
 }
 
+/**
+  * @brief  I2C错误回调（NACK、仲裁丢失、DMA错误等）
+  * @param  hi2c: I2C句柄指针
+  */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C1)
+    {
+        /* 记录错误原因并结束等待 */
+        OLED_DMAErrorCallback(&holed);
+    }
+}
+
 /* USER CODE END 1 */
@@ -0,0 +1,144 @@
+/**
+ ******************************************************************************
+ * @file    lcd_blend.c
+ * @brief   RGB565 alpha混合
+ ******************************************************************************
+ * @note
+ *   - 4bpp时一个字节正好是两个像素，目标地址4字节对齐时按32位字一次写两个像素
+ *     （Cortex-M7 的 STR 支持非对齐访问，但跨越缓存行/总线边界时会拆分，这里仍按对齐处理）
+ ******************************************************************************
+ */
+
+#include "lcd_blend.h"
+#include "mem_region.h"
+
+/* 各bpp的字模值换算为 0~32 的alpha，每个像素都要查表，放在DTCM */
+MEM_DTCM_DATA static const uint8_t alpha_4bpp[16] = { 0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32 };
+MEM_DTCM_DATA static const uint8_t alpha_2bpp[4]  = { 0, 11, 21, 32 };
+MEM_DTCM_DATA static const uint8_t alpha_1bpp[2]  = { 0, 32 };
+
+/* ==================== 内部函数 ==================== */
+
+static const uint8_t *Blend_AlphaTable(uint8_t bpp)
+{
+    return (bpp == 4) ? alpha_4bpp : (bpp == 2) ? alpha_2bpp : alpha_1bpp;
+}
+
+/* 以展开后的前景色混合一个像素，alpha 为 1~31 */
+static inline uint16_t Blend_Spread(uint32_t f, uint16_t bg, uint32_t alpha)
+{
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & LCD_BLEND_MASK;
+    uint32_t r = ((f * alpha + b * (LCD_BLEND_ALPHA_MAX - alpha)) >> 5) & LCD_BLEND_MASK;
+
+    return (uint16_t)(r | (r >> 16));
+}
+
+/* ==================== 接口函数 ==================== */
+
+/**
+ * @brief 生成纯色背景下各级透明度对应的颜色
+ */
+void LCD_Blend_Palette(uint16_t *palette, uint8_t bpp, uint16_t fg, uint16_t bg)
+{
+    const uint8_t *alpha = Blend_AlphaTable(bpp);
+    uint16_t levels = 1U << bpp;
+
+    for (uint16_t i = 0; i < levels; i++) {
+        palette[i] = LCD_Blend565(fg, bg, alpha[i]);
+    }
+}
+
+/**
+ * @brief 按调色板展开一行字模
+ */
+MEM_ITCM_CODE void LCD_Blend_ExpandRow(uint16_t *dst, const uint8_t *src, uint16_t width, uint8_t bpp,
+                                       const uint16_t *palette)
+{
+    if (bpp == 4) {
+        uint16_t pairs = width / 2;
+
+        if (((uintptr_t)dst & 3U) == 0) {
+            uint32_t *dst32 = (uint32_t *)dst;
+            for (uint16_t i = 0; i < pairs; i++) {
+                uint8_t b = *src++;
+                *dst32++ = palette[b & 0x0F] | ((uint32_t)palette[b >> 4] << 16);
+            }
+            dst = (uint16_t *)dst32;
+        } else {
+            for (uint16_t i = 0; i < pairs; i++) {
+                uint8_t b = *src++;
+                *dst++ = palette[b & 0x0F];
+                *dst++ = palette[b >> 4];
+            }
+        }
+        if (width & 1U) {
+            *dst = palette[*src & 0x0F];
+        }
+        return;
+    }
+
+    /* 1/2bpp：逐字节取出像素 */
+    uint8_t mask = (1U << bpp) - 1U;
+    uint8_t per_byte = 8 / bpp;
+
+    while (width > 0) {
+        uint8_t b = *src++;
+        uint16_t n = (width > per_byte) ? per_byte : width;
+
+        width -= n;
+        while (n--) {
+            *dst++ = palette[b & mask];
+            b >>= bpp;
+        }
+    }
+}
+
+/**
+ * @brief 将一行字模以前景色混合到已有像素上
+ */
+MEM_ITCM_CODE void LCD_Blend_AlphaRow(uint16_t *dst, const uint8_t *src, uint16_t width, uint8_t bpp, uint16_t fg)
+{
+    const uint8_t *alpha = Blend_AlphaTable(bpp);
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & LCD_BLEND_MASK;
+    uint8_t mask = (1U << bpp) - 1U;
+    uint8_t per_byte = 8 / bpp;
+
+    if (bpp == 4 && ((uintptr_t)dst & 3U) == 0) {
+        /* 一次处理两个像素：两个都透明时不读写显存，否则一次读写一个32位字 */
+        uint32_t *dst32 = (uint32_t *)dst;
+        uint16_t pairs = width / 2;
+
+        for (uint16_t i = 0; i < pairs; i++, dst32++) {
+            uint8_t b = *src++;
+            uint32_t a0, a1, d;
+            uint16_t p0, p1;
+
+            if (b == 0) {
+                continue;
+            }
+            a0 = alpha_4bpp[b & 0x0F];
+            a1 = alpha_4bpp[b >> 4];
+            d = *dst32;
+            p0 = (a0 == LCD_BLEND_ALPHA_MAX) ? fg : (a0 == 0) ? (uint16_t)d : Blend_Spread(f, (uint16_t)d, a0);
+            p1 = (a1 == LCD_BLEND_ALPHA_MAX) ? fg : (a1 == 0) ? (uint16_t)(d >> 16) : Blend_Spread(f, (uint16_t)(d >> 16), a1);
+            *dst32 = p0 | ((uint32_t)p1 << 16);
+        }
+        dst = (uint16_t *)dst32;
+        if ((width & 1U) == 0) {
+            return;
+        }
+        width = 1;
+    }
+
+    while (width > 0) {
+        uint8_t b = *src++;
+        uint16_t n = (width > per_byte) ? per_byte : width;
+
+        width -= n;
+        for (; n > 0; n--, dst++, b >>= bpp) {
+            uint32_t a = alpha[b & mask];
+            if (a == 0) continue;
+            *dst = (a == LCD_BLEND_ALPHA_MAX) ? fg : Blend_Spread(f, *dst, a);
+        }
+    }
+}
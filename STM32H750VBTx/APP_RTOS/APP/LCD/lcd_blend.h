@@ -0,0 +1,54 @@
+/**
+ ******************************************************************************
+ * @file    lcd_blend.h
+ * @brief   RGB565 alpha混合 - 抗锯齿字模（2/4bpp）和抗锯齿线条共用
+ ******************************************************************************
+ * @note
+ *   - 背景为纯色时，先算出各级透明度对应的颜色（调色板），每个像素只查表，不做乘法
+ *   - 背景为已有像素（帧缓冲）时逐像素混合：RGB565展开为 0x07E0F81F 的间隔格式，
+ *     三个通道在一个32位字中同时相乘，每像素两次乘法；全透明/全不透明像素不做运算
+ *   - alpha统一换算为 0~32（LCD_BLEND_ALPHA_MAX）
+ ******************************************************************************
+ */
+
+#ifndef __LCD_BLEND_H
+#define __LCD_BLEND_H
+
+#include <stdint.h>
+
+#define LCD_BLEND_ALPHA_MAX     32
+#define LCD_BLEND_MASK          0x07E0F81FU     // G在高半字，R、B在低半字，各通道之间留有乘法余量
+
+/**
+ * @brief 混合一个像素
+ * @param alpha 0~32，0为背景色，32为前景色
+ */
+static inline uint16_t LCD_Blend565(uint16_t fg, uint16_t bg, uint32_t alpha)
+{
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & LCD_BLEND_MASK;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & LCD_BLEND_MASK;
+    uint32_t r = ((f * alpha + b * (LCD_BLEND_ALPHA_MAX - alpha)) >> 5) & LCD_BLEND_MASK;
+
+    return (uint16_t)(r | (r >> 16));
+}
+
+/**
+ * @brief 生成纯色背景下各级透明度对应的颜色
+ * @param palette 输出 (1<<bpp) 个颜色，palette[0]为背景色，最后一个为前景色
+ * @param bpp     1、2或4
+ */
+void LCD_Blend_Palette(uint16_t *palette, uint8_t bpp, uint16_t fg, uint16_t bg);
+
+/**
+ * @brief 按调色板展开一行字模（背景为纯色）
+ * @param src 字模行数据，每像素bpp位，字节内低位在前
+ */
+void LCD_Blend_ExpandRow(uint16_t *dst, const uint8_t *src, uint16_t width, uint8_t bpp,
+                         const uint16_t *palette);
+
+/**
+ * @brief 将一行字模以前景色混合到已有像素上（背景透明）
+ */
+void LCD_Blend_AlphaRow(uint16_t *dst, const uint8_t *src, uint16_t width, uint8_t bpp, uint16_t fg);
+
+#endif /* __LCD_BLEND_H */
@@ -0,0 +1,463 @@
+/**
+ ******************************************************************************
+ * @file    lcd_blit.c
+ * @brief   RGB565 位块传输 - DMA2D后端与软件实现
+ ******************************************************************************
+ */
+
+#include "lcd_blit.h"
+#include "dma_sync.h"
+#include "isr_event.h"
+#include "mem_region.h"
+#include "lcd_prof.h"
+#include <string.h>
+
+#if defined(DMA2D)
+#define LCD_BLIT_HAS_DMA2D   1
+#else
+#define LCD_BLIT_HAS_DMA2D   0
+#endif
+
+static LCD_Blit_Backend_t blit_backend = LCD_BLIT_BACKEND_SW;
+static LCD_Blit_Stats_t blit_stats;
+
+/* ==================== 软件实现 ==================== */
+
+/* floor(x / 255)，x <= 255*255 */
+static inline uint32_t Blit_Div255(uint32_t x)
+{
+    return (x + 1U + (x >> 8)) >> 8;
+}
+
+/* 读一个源像素，展开为8位 R、G、B 和 alpha */
+static inline void Blit_ReadPixel(const uint8_t *row, uint16_t i, LCD_Blit_Format_t fmt,
+                                  uint32_t *r, uint32_t *g, uint32_t *b, uint32_t *a)
+{
+    switch (fmt) {
+    case LCD_BLIT_RGB888: {
+        const uint8_t *p = &row[i * 3U];
+        *b = p[0];
+        *g = p[1];
+        *r = p[2];
+        *a = 255U;
+        break;
+    }
+    case LCD_BLIT_ARGB8888: {
+        uint32_t c = ((const uint32_t *)row)[i];
+        *a = c >> 24;
+        *r = (c >> 16) & 0xFFU;
+        *g = (c >> 8) & 0xFFU;
+        *b = c & 0xFFU;
+        break;
+    }
+    default: {
+        uint16_t c = ((const uint16_t *)row)[i];
+        uint32_t r5 = c >> 11, g6 = (c >> 5) & 0x3FU, b5 = c & 0x1FU;
+        *r = (r5 << 3) | (r5 >> 2);
+        *g = (g6 << 2) | (g6 >> 4);
+        *b = (b5 << 3) | (b5 >> 2);
+        *a = 255U;
+        break;
+    }
+    }
+}
+
+static inline uint16_t Blit_Pack565(uint32_t r, uint32_t g, uint32_t b)
+{
+    return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+static uint8_t Blit_BytesPerPixel(LCD_Blit_Format_t fmt)
+{
+    return (fmt == LCD_BLIT_ARGB8888) ? 4U : (fmt == LCD_BLIT_RGB888) ? 3U : 2U;
+}
+
+/* 软件填充/混合是逐像素循环，APP_ITCM_HOT 时在ITCM中执行 */
+MEM_ITCM_CODE static void Blit_SW_Fill(uint16_t *dst, uint16_t dst_stride, uint16_t w, uint16_t h, uint16_t color)
+{
+    uint32_t pair = color | ((uint32_t)color << 16);
+
+    for (uint16_t row = 0; row < h; row++) {
+        uint16_t *p = &dst[(uint32_t)row * dst_stride];
+        uint16_t n = w;
+
+        /* 对齐到4字节后两像素一写 */
+        if (((uint32_t)(uintptr_t)p & 2U) != 0U && n > 0U) {
+            *p++ = color;
+            n--;
+        }
+        uint32_t *p32 = (uint32_t *)p;
+        for (uint16_t i = 0; i < n / 2U; i++) {
+            p32[i] = pair;
+        }
+        if ((n & 1U) != 0U) {
+            p[n - 1U] = color;
+        }
+    }
+}
+
+static void Blit_SW_Convert(uint16_t *dst, uint16_t dst_stride, const void *src, uint16_t src_stride,
+                            LCD_Blit_Format_t fmt, uint16_t w, uint16_t h)
+{
+    uint32_t src_pitch = (uint32_t)src_stride * Blit_BytesPerPixel(fmt);
+    uint32_t r, g, b, a;
+
+    for (uint16_t row = 0; row < h; row++) {
+        const uint8_t *s = (const uint8_t *)src + row * src_pitch;
+        uint16_t *d = &dst[(uint32_t)row * dst_stride];
+
+        if (fmt == LCD_BLIT_RGB565) {
+            memcpy(d, s, (uint32_t)w * sizeof(uint16_t));
+            continue;
+        }
+        for (uint16_t i = 0; i < w; i++) {
+            Blit_ReadPixel(s, i, fmt, &r, &g, &b, &a);
+            d[i] = Blit_Pack565(r, g, b);
+        }
+    }
+}
+
+MEM_ITCM_CODE static void Blit_SW_Blend(uint16_t *dst, uint16_t dst_stride, const void *fg, uint16_t fg_stride,
+                                        LCD_Blit_Format_t fmt, uint8_t alpha, uint16_t w, uint16_t h)
+{
+    uint32_t fg_pitch = (uint32_t)fg_stride * Blit_BytesPerPixel(fmt);
+    uint32_t fr, fgc, fb, fa, br, bg, bb, ba;
+
+    for (uint16_t row = 0; row < h; row++) {
+        const uint8_t *s = (const uint8_t *)fg + row * fg_pitch;
+        uint16_t *d = &dst[(uint32_t)row * dst_stride];
+
+        for (uint16_t i = 0; i < w; i++) {
+            Blit_ReadPixel(s, i, fmt, &fr, &fgc, &fb, &fa);
+            uint32_t a = Blit_Div255(fa * alpha);
+
+            Blit_ReadPixel((const uint8_t *)d, i, LCD_BLIT_RGB565, &br, &bg, &bb, &ba);
+            uint32_t na = 255U - a;
+            d[i] = Blit_Pack565(Blit_Div255(fr * a + br * na),
+                                Blit_Div255(fgc * a + bg * na),
+                                Blit_Div255(fb * a + bb * na));
+        }
+    }
+}
+
+/* ==================== DMA2D后端 ==================== */
+
+#if LCD_BLIT_HAS_DMA2D
+
+#define BLIT_ITCM_SIZE   0x00010000U    // 64KB
+#define BLIT_DTCM_SIZE   0x00020000U    // 128KB
+
+static DMA2D_HandleTypeDef hdma2d;
+static DMA_Sync_t blit_sync;
+static bool blit_ready;
+static uint16_t *blit_dst;              // 正在进行的操作的目标区域，完成后无效化D-Cache
+static uint32_t blit_dst_bytes;
+
+static void Blit_XferCplt(DMA2D_HandleTypeDef *h)
+{
+    (void)h;
+    DMA_Sync_Complete(&blit_sync);
+    ISR_Event_Post(ISR_EVT_DMA_DONE, ISR_SRC_DMA2D, 0);
+}
+
+static void Blit_XferError(DMA2D_HandleTypeDef *h)
+{
+    ISR_Event_Post(ISR_EVT_DMA_ERROR, ISR_SRC_DMA2D, h->ErrorCode);
+    DMA_Sync_Fail(&blit_sync, h->ErrorCode);
+}
+
+void LCD_Blit_IRQHandler(void)
+{
+    HAL_DMA2D_IRQHandler(&hdma2d);
+}
+
+static bool Blit_InTCM(const void *p)
+{
+    uint32_t a = (uint32_t)p;
+    return (a - D1_ITCMRAM_BASE < BLIT_ITCM_SIZE) || (a - D1_DTCMRAM_BASE < BLIT_DTCM_SIZE);
+}
+
+static uint32_t Blit_RegionBytes(uint16_t stride, uint16_t w, uint16_t h, uint8_t bpp)
+{
+    return ((uint32_t)(h - 1U) * stride + w) * bpp;
+}
+
+/**
+ * @brief 等待上一次操作、配置输出并登记本次操作
+ * @note  上一次操作的错误在这里返回，本次操作不启动（与 LCD_SPI_DMA_WriteBuffer_Async 相同）
+ */
+static HAL_StatusTypeDef Blit_HW_Begin(uint32_t mode, uint16_t *dst, uint16_t dst_stride, uint16_t w, uint16_t h)
+{
+    HAL_StatusTypeDef status = LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    hdma2d.Init.Mode = mode;
+    hdma2d.Init.ColorMode = DMA2D_OUTPUT_RGB565;
+    hdma2d.Init.OutputOffset = dst_stride - w;
+    status = HAL_DMA2D_Init(&hdma2d);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    /* 目标区域中CPU写过的缓存行先写回并丢弃，避免之后被逐出时覆盖DMA2D的结果 */
+    blit_dst = dst;
+    blit_dst_bytes = Blit_RegionBytes(dst_stride, w, h, 2U);
+    Mem_Cache_CleanInvalidate(dst, blit_dst_bytes);
+    DMA_Sync_Arm(&blit_sync);
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef Blit_HW_ConfigLayer(uint32_t layer, LCD_Blit_Format_t fmt, uint16_t stride, uint16_t w,
+                                             uint32_t alpha_mode, uint8_t alpha)
+{
+    static const uint32_t input_mode[] = { DMA2D_INPUT_RGB565, DMA2D_INPUT_RGB888, DMA2D_INPUT_ARGB8888 };
+    DMA2D_LayerCfgTypeDef *cfg = &hdma2d.LayerCfg[layer];
+
+    cfg->InputOffset = stride - w;
+    cfg->InputColorMode = input_mode[fmt];
+    cfg->AlphaMode = alpha_mode;
+    cfg->InputAlpha = alpha;
+    cfg->AlphaInverted = DMA2D_REGULAR_ALPHA;
+    cfg->RedBlueSwap = DMA2D_RB_REGULAR;
+    cfg->ChromaSubSampling = DMA2D_NO_CSS;
+    return HAL_DMA2D_ConfigLayer(&hdma2d, layer);
+}
+
+static void Blit_HW_CleanSource(const void *src, uint16_t stride, uint16_t w, uint16_t h, LCD_Blit_Format_t fmt)
+{
+    Mem_Cache_Clean(src, Blit_RegionBytes(stride, w, h, Blit_BytesPerPixel(fmt)));
+}
+
+/* 启动失败时撤销登记 */
+static HAL_StatusTypeDef Blit_HW_Started(HAL_StatusTypeDef status)
+{
+    if (status != HAL_OK) {
+        DMA_Sync_Cancel(&blit_sync);
+        return status;
+    }
+    blit_stats.hw_ops++;
+    return HAL_OK;
+}
+
+static bool Blit_UseHW(const void *a, const void *b)
+{
+    if (blit_backend != LCD_BLIT_BACKEND_DMA2D) {
+        return false;
+    }
+    if (Blit_InTCM(a) || (b != NULL && Blit_InTCM(b))) {
+        blit_stats.tcm_fallbacks++;
+        return false;
+    }
+    return true;
+}
+
+#else
+
+void LCD_Blit_IRQHandler(void)
+{
+}
+
+#endif /* LCD_BLIT_HAS_DMA2D */
+
+/* ==================== 接口函数 ==================== */
+
+HAL_StatusTypeDef LCD_Blit_Init(void)
+{
+#if LCD_BLIT_HAS_DMA2D
+    if (!blit_ready) {
+        __HAL_RCC_DMA2D_CLK_ENABLE();
+
+        hdma2d.Instance = DMA2D;
+        hdma2d.Init.Mode = DMA2D_R2M;
+        hdma2d.Init.ColorMode = DMA2D_OUTPUT_RGB565;
+        hdma2d.Init.OutputOffset = 0;
+        hdma2d.Init.AlphaInverted = DMA2D_REGULAR_ALPHA;
+        hdma2d.Init.RedBlueSwap = DMA2D_RB_REGULAR;
+        hdma2d.Init.BytesSwap = DMA2D_BYTES_REGULAR;
+        hdma2d.Init.LineOffsetMode = DMA2D_LOM_PIXELS;
+        if (HAL_DMA2D_Init(&hdma2d) != HAL_OK) {
+            return HAL_ERROR;
+        }
+        hdma2d.XferCpltCallback = Blit_XferCplt;
+        hdma2d.XferErrorCallback = Blit_XferError;
+        DMA_Sync_Init(&blit_sync);
+
+        /* 与SPI4/DMA1同一优先级，满足 isr_event 单生产者的前提 */
+        HAL_NVIC_SetPriority(DMA2D_IRQn, 6, 0);
+        HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+        blit_ready = true;
+    }
+    blit_backend = LCD_BLIT_BACKEND_DMA2D;
+#endif
+    return HAL_OK;
+}
+
+void LCD_Blit_SetBackend(LCD_Blit_Backend_t backend)
+{
+#if LCD_BLIT_HAS_DMA2D
+    if (backend == LCD_BLIT_BACKEND_DMA2D && !blit_ready) {
+        return;
+    }
+    LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+    blit_backend = backend;
+#else
+    (void)backend;
+#endif
+}
+
+LCD_Blit_Backend_t LCD_Blit_GetBackend(void)
+{
+    return blit_backend;
+}
+
+HAL_StatusTypeDef LCD_Blit_Fill(uint16_t *dst, uint16_t dst_stride, uint16_t w, uint16_t h, uint16_t color)
+{
+    if (w == 0U || h == 0U) {
+        return HAL_OK;
+    }
+    blit_stats.pixels += (uint32_t)w * h;
+
+#if LCD_BLIT_HAS_DMA2D
+    if (Blit_UseHW(dst, NULL)) {
+        HAL_StatusTypeDef status = Blit_HW_Begin(DMA2D_R2M, dst, dst_stride, w, h);
+        if (status != HAL_OK) {
+            return status;
+        }
+        /* R2M的颜色参数是ARGB8888，HAL按输出格式截取；按高位复制展开，截取后还原为原值 */
+        uint32_t r5 = color >> 11, g6 = (color >> 5) & 0x3FU, b5 = color & 0x1FU;
+        uint32_t argb = 0xFF000000U | (((r5 << 3) | (r5 >> 2)) << 16) |
+                        (((g6 << 2) | (g6 >> 4)) << 8) | ((b5 << 3) | (b5 >> 2));
+        return Blit_HW_Started(HAL_DMA2D_Start_IT(&hdma2d, argb, (uint32_t)dst, w, h));
+    }
+#endif
+
+    LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+    LCD_PROF_BEGIN(t0);
+    Blit_SW_Fill(dst, dst_stride, w, h, color);
+    LCD_PROF_END(LCD_PROF_PIXEL, t0);
+    blit_stats.sw_ops++;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef LCD_Blit_Copy(uint16_t *dst, uint16_t dst_stride,
+                                const uint16_t *src, uint16_t src_stride, uint16_t w, uint16_t h)
+{
+    return LCD_Blit_Convert(dst, dst_stride, src, src_stride, LCD_BLIT_RGB565, w, h);
+}
+
+HAL_StatusTypeDef LCD_Blit_Convert(uint16_t *dst, uint16_t dst_stride,
+                                   const void *src, uint16_t src_stride, LCD_Blit_Format_t src_fmt,
+                                   uint16_t w, uint16_t h)
+{
+    if (w == 0U || h == 0U) {
+        return HAL_OK;
+    }
+    blit_stats.pixels += (uint32_t)w * h;
+
+#if LCD_BLIT_HAS_DMA2D
+    if (Blit_UseHW(dst, src)) {
+        uint32_t mode = (src_fmt == LCD_BLIT_RGB565) ? DMA2D_M2M : DMA2D_M2M_PFC;
+        HAL_StatusTypeDef status = Blit_HW_Begin(mode, dst, dst_stride, w, h);
+        if (status == HAL_OK) {
+            status = Blit_HW_ConfigLayer(1, src_fmt, src_stride, w, DMA2D_NO_MODIF_ALPHA, 0xFF);
+        }
+        if (status != HAL_OK) {
+            DMA_Sync_Cancel(&blit_sync);
+            return status;
+        }
+        Blit_HW_CleanSource(src, src_stride, w, h, src_fmt);
+        return Blit_HW_Started(HAL_DMA2D_Start_IT(&hdma2d, (uint32_t)src, (uint32_t)dst, w, h));
+    }
+#endif
+
+    LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+    LCD_PROF_BEGIN(t0);
+    Blit_SW_Convert(dst, dst_stride, src, src_stride, src_fmt, w, h);
+    LCD_PROF_END(LCD_PROF_COPY, t0);
+    blit_stats.sw_ops++;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef LCD_Blit_Blend(uint16_t *dst, uint16_t dst_stride,
+                                 const void *fg, uint16_t fg_stride, LCD_Blit_Format_t fg_fmt,
+                                 uint8_t alpha, uint16_t w, uint16_t h)
+{
+    if (w == 0U || h == 0U) {
+        return HAL_OK;
+    }
+    blit_stats.pixels += (uint32_t)w * h;
+
+#if LCD_BLIT_HAS_DMA2D
+    if (Blit_UseHW(dst, fg)) {
+        HAL_StatusTypeDef status = Blit_HW_Begin(DMA2D_M2M_BLEND, dst, dst_stride, w, h);
+        if (status == HAL_OK) {
+            status = Blit_HW_ConfigLayer(1, fg_fmt, fg_stride, w, DMA2D_COMBINE_ALPHA, alpha);
+        }
+        if (status == HAL_OK) {
+            status = Blit_HW_ConfigLayer(0, LCD_BLIT_RGB565, dst_stride, w, DMA2D_NO_MODIF_ALPHA, 0xFF);
+        }
+        if (status != HAL_OK) {
+            DMA_Sync_Cancel(&blit_sync);
+            return status;
+        }
+        Blit_HW_CleanSource(fg, fg_stride, w, h, fg_fmt);
+        return Blit_HW_Started(HAL_DMA2D_BlendingStart_IT(&hdma2d, (uint32_t)fg, (uint32_t)dst,
+                                                          (uint32_t)dst, w, h));
+    }
+#endif
+
+    LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+    LCD_PROF_BEGIN(t0);
+    Blit_SW_Blend(dst, dst_stride, fg, fg_stride, fg_fmt, alpha, w, h);
+    LCD_PROF_END(LCD_PROF_PIXEL, t0);
+    blit_stats.sw_ops++;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef LCD_Blit_Wait(uint32_t timeout_ms)
+{
+#if LCD_BLIT_HAS_DMA2D
+    if (!blit_ready) {
+        return HAL_OK;
+    }
+    LCD_PROF_BEGIN(t0);
+    HAL_StatusTypeDef status = DMA_Sync_Wait(&blit_sync, timeout_ms);
+    LCD_PROF_END(LCD_PROF_WAIT, t0);
+
+    if (status == HAL_TIMEOUT) {
+        HAL_DMA2D_Abort(&hdma2d);
+        blit_stats.timeouts++;
+    } else if (status == HAL_ERROR) {
+        blit_stats.errors++;
+    }
+    if (blit_dst != NULL) {
+        Mem_Cache_Invalidate(blit_dst, blit_dst_bytes);
+        blit_dst = NULL;
+    }
+    return status;
+#else
+    (void)timeout_ms;
+    return HAL_OK;
+#endif
+}
+
+bool LCD_Blit_IsBusy(void)
+{
+#if LCD_BLIT_HAS_DMA2D
+    return blit_ready && DMA_Sync_IsBusy(&blit_sync);
+#else
+    return false;
+#endif
+}
+
+void LCD_Blit_GetStats(LCD_Blit_Stats_t *stats)
+{
+    *stats = blit_stats;
+}
+
+void LCD_Blit_ResetStats(void)
+{
+    memset(&blit_stats, 0, sizeof(blit_stats));
+}
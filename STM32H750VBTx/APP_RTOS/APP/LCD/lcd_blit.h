@@ -0,0 +1,98 @@
+/**
+ ******************************************************************************
+ * @file    lcd_blit.h
+ * @brief   RGB565 位块传输 - DMA2D（Chrom-ART）后端与结果相同的软件实现
+ ******************************************************************************
+ * @note
+ *   - 目标总是 RGB565（帧缓冲、DMA发送缓冲），stride 以像素为单位
+ *   - 四种操作对应 DMA2D 的四种模式：填充 R2M、拷贝 M2M、格式转换 M2M_PFC、混合 M2M_BLEND
+ *   - DMA2D后端异步执行：函数启动传输后立即返回，下一次操作或 LCD_Blit_Wait 等待完成，
+ *     期间CPU和SPI DMA可以继续工作；同一时刻只有一个任务使用本模块
+ *   - DMA2D 不能访问 ITCM/DTCM（.data/.bss/栈都在DTCM），源或目标在TCM时自动改用软件实现
+ *   - 软件实现按参考手册的计算方式：
+ *       RGB565 输入按高位复制扩展到8位；输出到 RGB565 截掉低位；
+ *       混合时背景 alpha 为255，C = (Cfg*a + Cbg*(255-a)) / 255（向下取整），
+ *       a = 像素alpha * 常数alpha / 255
+ *     开发板上用 LCD_V2_Blit_Test() 逐像素比较两种后端的结果
+ *   - 主机构建没有 DMA2D，只有软件实现
+ ******************************************************************************
+ */
+
+#ifndef __LCD_BLIT_H
+#define __LCD_BLIT_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LCD_BLIT_TIMEOUT_MS     100     // 单次操作的等待超时（整屏填充约0.1ms）
+
+/* 源像素格式 */
+typedef enum {
+    LCD_BLIT_RGB565 = 0,
+    LCD_BLIT_RGB888,                    // 每像素3字节，内存顺序 B,G,R
+    LCD_BLIT_ARGB8888,                  // 每像素一个32位字 0xAARRGGBB
+} LCD_Blit_Format_t;
+
+typedef enum {
+    LCD_BLIT_BACKEND_SW = 0,
+    LCD_BLIT_BACKEND_DMA2D,
+} LCD_Blit_Backend_t;
+
+typedef struct {
+    uint32_t hw_ops;                    // 由DMA2D执行的操作数
+    uint32_t sw_ops;                    // 由软件执行的操作数
+    uint32_t tcm_fallbacks;             // 因地址在TCM而改用软件的次数（计入 sw_ops）
+    uint32_t errors;                    // DMA2D 错误回调次数
+    uint32_t timeouts;
+    uint64_t pixels;
+} LCD_Blit_Stats_t;
+
+/**
+ * @brief 初始化DMA2D并切换到DMA2D后端（没有DMA2D时保持软件后端）
+ */
+HAL_StatusTypeDef LCD_Blit_Init(void);
+
+void LCD_Blit_SetBackend(LCD_Blit_Backend_t backend);   // 没有DMA2D时忽略
+LCD_Blit_Backend_t LCD_Blit_GetBackend(void);
+
+/**
+ * @brief 纯色填充 w x h 的矩形
+ */
+HAL_StatusTypeDef LCD_Blit_Fill(uint16_t *dst, uint16_t dst_stride, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * @brief 拷贝 w x h 的 RGB565 矩形
+ */
+HAL_StatusTypeDef LCD_Blit_Copy(uint16_t *dst, uint16_t dst_stride,
+                                const uint16_t *src, uint16_t src_stride, uint16_t w, uint16_t h);
+
+/**
+ * @brief 将 RGB888/ARGB8888（或RGB565）矩形转换为 RGB565，alpha 被忽略
+ */
+HAL_StatusTypeDef LCD_Blit_Convert(uint16_t *dst, uint16_t dst_stride,
+                                   const void *src, uint16_t src_stride, LCD_Blit_Format_t src_fmt,
+                                   uint16_t w, uint16_t h);
+
+/**
+ * @brief 将前景矩形按 alpha 混合到目标上（目标同时作为背景）
+ * @param alpha 常数alpha，0~255；与 ARGB8888 的像素alpha相乘
+ */
+HAL_StatusTypeDef LCD_Blit_Blend(uint16_t *dst, uint16_t dst_stride,
+                                 const void *fg, uint16_t fg_stride, LCD_Blit_Format_t fg_fmt,
+                                 uint8_t alpha, uint16_t w, uint16_t h);
+
+/**
+ * @brief 等待当前操作完成
+ * @retval HAL_OK 完成或空闲；HAL_ERROR DMA2D错误；HAL_TIMEOUT 超时（已中止DMA2D）
+ */
+HAL_StatusTypeDef LCD_Blit_Wait(uint32_t timeout_ms);
+bool LCD_Blit_IsBusy(void);
+
+void LCD_Blit_GetStats(LCD_Blit_Stats_t *stats);
+void LCD_Blit_ResetStats(void);
+
+/* DMA2D中断入口（stm32h7xx_it.c 中的 DMA2D_IRQHandler 调用） */
+void LCD_Blit_IRQHandler(void);
+
+#endif /* __LCD_BLIT_H */
@@ -0,0 +1,2166 @@
+/* 由 host_clipc 生成，请勿手动修改
+ * 片段: 内置开机动画，240x240，30 帧，每帧 33333 us，RLE，34500 字节 */
+
+#include <stdint.h>
+
+const uint32_t Clip_Boot_240x240_size = 34500;
+
+__attribute__((aligned(4))) const uint8_t Clip_Boot_240x240[34500] = {
+    0x43,0x4C,0x49,0x50,0x01,0x00,0x01,0x00,0xF0,0x00,0xF0,0x00,0x35,0x82,0x00,0x00,
+    0x1E,0x00,0x00,0x00,0xFC,0x05,0x00,0x01,0x95,0xAB,0x84,0x08,0x07,0x80,0x79,0x3C,
+    0xE7,0x80,0x84,0x08,0x0B,0x80,0x79,0x3C,0xE5,0x80,0x84,0x08,0x0B,0x80,0x79,0x3C,
+    0xE4,0x80,0x84,0x08,0x0D,0x80,0x79,0x3C,0xE2,0x80,0x84,0x08,0x0F,0x80,0x79,0x3C,
+    0xE1,0x80,0x84,0x08,0x0F,0x80,0x79,0x3C,0xCE,0x80,0x84,0x08,0x05,0x80,0x16,0x34,
+    0x0E,0x80,0x84,0x08,0x0F,0x80,0x79,0x3C,0x0E,0x80,0x84,0x08,0x05,0x80,0xDB,0x44,
+    0xB9,0x80,0x84,0x08,0x09,0x80,0x16,0x34,0x0C,0x80,0x84,0x08,0x0F,0x80,0x79,0x3C,
+    0x0C,0x80,0x84,0x08,0x09,0x80,0xDB,0x44,0xB6,0x80,0x84,0x08,0x0B,0x80,0x16,0x34,
+    0x0B,0x80,0x84,0x08,0x0F,0x80,0x79,0x3C,0x0B,0x80,0x84,0x08,0x0B,0x80,0xDB,0x44,
+    0xB4,0x80,0x84,0x08,0x0D,0x80,0x16,0x34,0x0A,0x80,0x84,0x08,0x0F,0x80,0x79,0x3C,
+    0x0A,0x80,0x84,0x08,0x0D,0x80,0xDB,0x44,0xB3,0x80,0x84,0x08,0x0D,0x80,0x16,0x34,
+    0x0B,0x80,0x84,0x08,0x0D,0x80,0x79,0x3C,0x0B,0x80,0x84,0x08,0x0D,0x80,0xDB,0x44,
+    0xB2,0x80,0x84,0x08,0x0F,0x80,0x16,0x34,0x0A,0x80,0x84,0x08,0x0D,0x80,0x79,0x3C,
+    0x0A,0x80,0x84,0x08,0x0F,0x80,0xDB,0x44,0xB1,0x80,0x84,0x08,0x0F,0x80,0x16,0x34,
+    0x0B,0x80,0x84,0x08,0x0B,0x80,0x79,0x3C,0x0B,0x80,0x84,0x08,0x0F,0x80,0xDB,0x44,
+    0xB1,0x80,0x84,0x08,0x0F,0x80,0x16,0x34,0x0C,0x80,0x84,0x08,0x09,0x80,0x79,0x3C,
+    0x0C,0x80,0x84,0x08,0x0F,0x80,0xDB,0x44,0xB1,0x80,0x84,0x08,0x0F,0x80,0x16,0x34,
+    0x0E,0x80,0x84,0x08,0x05,0x80,0x79,0x3C,0x0E,0x80,0x84,0x08,0x0F,0x80,0xDB,0x44,
+    0xB1,0x80,0x84,0x08,0x0F,0x80,0x16,0x34,0x21,0x80,0x84,0x08,0x0F,0x80,0xDB,0x44,
+    0xB1,0x80,0x84,0x08,0x0F,0x80,0x16,0x34,0x21,0x80,0x84,0x08,0x0F,0x80,0xDB,0x44,
+    0xB2,0x80,0x84,0x08,0x0D,0x80,0x16,0x34,0x23,0x80,0x84,0x08,0x0D,0x80,0xDB,0x44,
+    0xB3,0x80,0x84,0x08,0x0D,0x80,0x16,0x34,0x23,0x80,0x84,0x08,0x0D,0x80,0xDB,0x44,
+    0xB4,0x80,0x84,0x08,0x0B,0x80,0x16,0x34,0x25,0x80,0x84,0x08,0x0B,0x80,0xDB,0x44,
+    0xB7,0x80,0x84,0x08,0x07,0x80,0x16,0x34,0x29,0x80,0x84,0x08,0x07,0x80,0xDB,0x44,
+    0x77,0x83,0x84,0x08,0x08,0x80,0x94,0x33,0x4B,0x80,0x84,0x08,0x08,0x80,0x3D,0x45,
+    0x94,0x80,0x84,0x08,0x0A,0x80,0x94,0x33,0x49,0x80,0x84,0x08,0x0A,0x80,0x3D,0x45,
+    0x92,0x80,0x84,0x08,0x0C,0x80,0x94,0x33,0x47,0x80,0x84,0x08,0x0C,0x80,0x3D,0x45,
+    0x90,0x80,0x84,0x08,0x0E,0x80,0x94,0x33,0x45,0x80,0x84,0x08,0x0E,0x80,0x3D,0x45,
+    0x8F,0x80,0x84,0x08,0x0E,0x80,0x94,0x33,0x45,0x80,0x84,0x08,0x0E,0x80,0x3D,0x45,
+    0x8E,0x80,0x84,0x08,0x0F,0x80,0x94,0x33,0x45,0x80,0x84,0x08,0x0F,0x80,0x3D,0x45,
+    0x8D,0x80,0x84,0x08,0x10,0x80,0x94,0x33,0x43,0x80,0x84,0x08,0x10,0x80,0x3D,0x45,
+    0x8D,0x80,0x84,0x08,0x10,0x80,0x94,0x33,0x43,0x80,0x84,0x08,0x10,0x80,0x3D,0x45,
+    0x8D,0x80,0x84,0x08,0x10,0x80,0x94,0x33,0x43,0x80,0x84,0x08,0x10,0x80,0x3D,0x45,
+    0x8E,0x80,0x84,0x08,0x0E,0x80,0x94,0x33,0x45,0x80,0x84,0x08,0x0E,0x80,0x3D,0x45,
+    0x8F,0x80,0x84,0x08,0x0E,0x80,0x94,0x33,0x45,0x80,0x84,0x08,0x0E,0x80,0x3D,0x45,
+    0x90,0x80,0x84,0x08,0x0C,0x80,0x94,0x33,0x47,0x80,0x84,0x08,0x0C,0x80,0x3D,0x45,
+    0x91,0x80,0x84,0x08,0x0C,0x80,0x94,0x33,0x47,0x80,0x84,0x08,0x0C,0x80,0x3D,0x45,
+    0x92,0x80,0x84,0x08,0x09,0x80,0x94,0x33,0x4B,0x80,0x84,0x08,0x09,0x80,0x3D,0x45,
+    0x95,0x80,0x84,0x08,0x06,0x80,0x94,0x33,0x4D,0x80,0x84,0x08,0x06,0x80,0x3D,0x45,
+    0x00,0x89,0x84,0x08,0x07,0x80,0x32,0x2B,0x59,0x80,0x84,0x08,0x07,0x80,0x9F,0x4D,
+    0x87,0x80,0x84,0x08,0x0B,0x80,0x32,0x2B,0x55,0x80,0x84,0x08,0x0B,0x80,0x9F,0x4D,
+    0x85,0x80,0x84,0x08,0x0B,0x80,0x32,0x2B,0x55,0x80,0x84,0x08,0x0B,0x80,0x9F,0x4D,
+    0x84,0x80,0x84,0x08,0x0D,0x80,0x32,0x2B,0x53,0x80,0x84,0x08,0x0D,0x80,0x9F,0x4D,
+    0x82,0x80,0x84,0x08,0x0F,0x80,0x32,0x2B,0x51,0x80,0x84,0x08,0x0F,0x80,0x9F,0x4D,
+    0x81,0x80,0x84,0x08,0x0F,0x80,0x32,0x2B,0x51,0x80,0x84,0x08,0x0F,0x80,0x9F,0x4D,
+    0x81,0x80,0x84,0x08,0x0F,0x80,0x32,0x2B,0x51,0x80,0x84,0x08,0x0F,0x80,0x9F,0x4D,
+    0x81,0x80,0x84,0x08,0x0F,0x80,0x32,0x2B,0x51,0x80,0x84,0x08,0x0F,0x80,0x9F,0x4D,
+    0x81,0x80,0x84,0x08,0x0F,0x80,0x32,0x2B,0x51,0x80,0x84,0x08,0x0F,0x80,0x9F,0x4D,
+    0x81,0x80,0x84,0x08,0x0F,0x80,0x32,0x2B,0x51,0x80,0x84,0x08,0x0F,0x80,0x9F,0x4D,
+    0x82,0x80,0x84,0x08,0x0D,0x80,0x32,0x2B,0x53,0x80,0x84,0x08,0x0D,0x80,0x9F,0x4D,
+    0x83,0x80,0x84,0x08,0x0D,0x80,0x32,0x2B,0x53,0x80,0x84,0x08,0x0D,0x80,0x9F,0x4D,
+    0x84,0x80,0x84,0x08,0x0B,0x80,0x32,0x2B,0x55,0x80,0x84,0x08,0x0B,0x80,0x9F,0x4D,
+    0x86,0x80,0x84,0x08,0x09,0x80,0x32,0x2B,0x57,0x80,0x84,0x08,0x09,0x80,0x9F,0x4D,
+    0x89,0x80,0x84,0x08,0x05,0x80,0x32,0x2B,0x5B,0x80,0x84,0x08,0x05,0x80,0x9F,0x4D,
+    0x00,0x89,0x84,0x08,0x08,0x80,0xD0,0x22,0x4B,0x80,0x84,0x08,0x08,0x80,0x27,0x11,
+    0x94,0x80,0x84,0x08,0x0A,0x80,0xD0,0x22,0x49,0x80,0x84,0x08,0x0A,0x80,0x27,0x11,
+    0x92,0x80,0x84,0x08,0x0C,0x80,0xD0,0x22,0x47,0x80,0x84,0x08,0x0C,0x80,0x27,0x11,
+    0x90,0x80,0x84,0x08,0x0E,0x80,0xD0,0x22,0x45,0x80,0x84,0x08,0x0E,0x80,0x27,0x11,
+    0x8F,0x80,0x84,0x08,0x0E,0x80,0xD0,0x22,0x45,0x80,0x84,0x08,0x0E,0x80,0x27,0x11,
+    0x8E,0x80,0x84,0x08,0x0F,0x80,0xD0,0x22,0x45,0x80,0x84,0x08,0x0F,0x80,0x27,0x11,
+    0x8D,0x80,0x84,0x08,0x10,0x80,0xD0,0x22,0x43,0x80,0x84,0x08,0x10,0x80,0x27,0x11,
+    0x8D,0x80,0x84,0x08,0x10,0x80,0xD0,0x22,0x43,0x80,0x84,0x08,0x10,0x80,0x27,0x11,
+    0x8D,0x80,0x84,0x08,0x10,0x80,0xD0,0x22,0x43,0x80,0x84,0x08,0x10,0x80,0x27,0x11,
+    0x8E,0x80,0x84,0x08,0x0E,0x80,0xD0,0x22,0x45,0x80,0x84,0x08,0x0E,0x80,0x27,0x11,
+    0x8F,0x80,0x84,0x08,0x0E,0x80,0xD0,0x22,0x45,0x80,0x84,0x08,0x0E,0x80,0x27,0x11,
+    0x90,0x80,0x84,0x08,0x0C,0x80,0xD0,0x22,0x47,0x80,0x84,0x08,0x0C,0x80,0x27,0x11,
+    0x91,0x80,0x84,0x08,0x0C,0x80,0xD0,0x22,0x47,0x80,0x84,0x08,0x0C,0x80,0x27,0x11,
+    0x92,0x80,0x84,0x08,0x09,0x80,0xD0,0x22,0x4B,0x80,0x84,0x08,0x09,0x80,0x27,0x11,
+    0x95,0x80,0x84,0x08,0x06,0x80,0xD0,0x22,0x4D,0x80,0x84,0x08,0x06,0x80,0x27,0x11,
+    0x89,0x82,0x84,0x08,0x05,0x80,0x6D,0x22,0x2B,0x80,0x84,0x08,0x05,0x80,0xA9,0x11,
+    0xB9,0x80,0x84,0x08,0x09,0x80,0x6D,0x22,0x27,0x80,0x84,0x08,0x09,0x80,0xA9,0x11,
+    0xB6,0x80,0x84,0x08,0x0B,0x80,0x6D,0x22,0x25,0x80,0x84,0x08,0x0B,0x80,0xA9,0x11,
+    0xB4,0x80,0x84,0x08,0x0D,0x80,0x6D,0x22,0x23,0x80,0x84,0x08,0x0D,0x80,0xA9,0x11,
+    0xB3,0x80,0x84,0x08,0x0D,0x80,0x6D,0x22,0x23,0x80,0x84,0x08,0x0D,0x80,0xA9,0x11,
+    0xB2,0x80,0x84,0x08,0x0F,0x80,0x6D,0x22,0x21,0x80,0x84,0x08,0x0F,0x80,0xA9,0x11,
+    0xB1,0x80,0x84,0x08,0x0F,0x80,0x6D,0x22,0x21,0x80,0x84,0x08,0x0F,0x80,0xA9,0x11,
+    0xB1,0x80,0x84,0x08,0x0F,0x80,0x6D,0x22,0x0D,0x80,0x84,0x08,0x07,0x80,0x0B,0x1A,
+    0x0D,0x80,0x84,0x08,0x0F,0x80,0xA9,0x11,0xB1,0x80,0x84,0x08,0x0F,0x80,0x6D,0x22,
+    0x0B,0x80,0x84,0x08,0x0B,0x80,0x0B,0x1A,0x0B,0x80,0x84,0x08,0x0F,0x80,0xA9,0x11,
+    0xB1,0x80,0x84,0x08,0x0F,0x80,0x6D,0x22,0x0B,0x80,0x84,0x08,0x0B,0x80,0x0B,0x1A,
+    0x0B,0x80,0x84,0x08,0x0F,0x80,0xA9,0x11,0xB1,0x80,0x84,0x08,0x0F,0x80,0x6D,0x22,
+    0x0A,0x80,0x84,0x08,0x0D,0x80,0x0B,0x1A,0x0A,0x80,0x84,0x08,0x0F,0x80,0xA9,0x11,
+    0xB2,0x80,0x84,0x08,0x0D,0x80,0x6D,0x22,0x0A,0x80,0x84,0x08,0x0F,0x80,0x0B,0x1A,
+    0x0A,0x80,0x84,0x08,0x0D,0x80,0xA9,0x11,0xB3,0x80,0x84,0x08,0x0D,0x80,0x6D,0x22,
+    0x0A,0x80,0x84,0x08,0x0F,0x80,0x0B,0x1A,0x0A,0x80,0x84,0x08,0x0D,0x80,0xA9,0x11,
+    0xB4,0x80,0x84,0x08,0x0B,0x80,0x6D,0x22,0x0B,0x80,0x84,0x08,0x0F,0x80,0x0B,0x1A,
+    0x0B,0x80,0x84,0x08,0x0B,0x80,0xA9,0x11,0xB7,0x80,0x84,0x08,0x07,0x80,0x6D,0x22,
+    0x0D,0x80,0x84,0x08,0x0F,0x80,0x0B,0x1A,0x0D,0x80,0x84,0x08,0x07,0x80,0xA9,0x11,
+    0xBC,0x80,0x84,0x08,0x01,0x40,0x6D,0x22,0x10,0x80,0x84,0x08,0x0F,0x80,0x0B,0x1A,
+    0x10,0x80,0x84,0x08,0x01,0x40,0xA9,0x11,0xD0,0x80,0x84,0x08,0x0F,0x80,0x0B,0x1A,
+    0xE2,0x80,0x84,0x08,0x0D,0x80,0x0B,0x1A,0xE3,0x80,0x84,0x08,0x0D,0x80,0x0B,0x1A,
+    0xE4,0x80,0x84,0x08,0x0B,0x80,0x0B,0x1A,0xE6,0x80,0x84,0x08,0x09,0x80,0x0B,0x1A,
+    0xE9,0x80,0x84,0x08,0x05,0x80,0x0B,0x1A,0x69,0xA1,0x84,0x08,0x05,0x80,0x5F,0x55,
+    0xA3,0x80,0x88,0x29,0x48,0x80,0x84,0x08,0x05,0x80,0x5F,0x55,0xA3,0x80,0x88,0x29,
+    0x48,0x80,0x84,0x08,0x05,0x80,0x5F,0x55,0xA3,0x80,0x88,0x29,0x48,0x80,0x84,0x08,
+    0x05,0x80,0x5F,0x55,0xA3,0x80,0x88,0x29,0x48,0x80,0x84,0x08,0x05,0x80,0x5F,0x55,
+    0xA3,0x80,0x88,0x29,0x48,0x80,0x84,0x08,0x05,0x80,0x5F,0x55,0xA3,0x80,0x88,0x29,
+    0x84,0xA7,0x84,0x08,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x16,0x34,0xE7,0x00,
+    0x0B,0x80,0x16,0x34,0xE5,0x00,0x0B,0x80,0x16,0x34,0xE4,0x00,0x0D,0x80,0x16,0x34,
+    0xE2,0x00,0x0F,0x80,0x16,0x34,0xE1,0x00,0x0F,0x80,0x16,0x34,0xCE,0x00,0x05,0x80,
+    0x94,0x33,0x0E,0x00,0x0F,0x80,0x16,0x34,0x0E,0x00,0x05,0x80,0x79,0x3C,0xB9,0x00,
+    0x09,0x80,0x94,0x33,0x0C,0x00,0x0F,0x80,0x16,0x34,0x0C,0x00,0x09,0x80,0x79,0x3C,
+    0xB6,0x00,0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x16,0x34,0x0B,0x00,0x0B,0x80,
+    0x79,0x3C,0xB4,0x00,0x0D,0x80,0x94,0x33,0x0A,0x00,0x0F,0x80,0x16,0x34,0x0A,0x00,
+    0x0D,0x80,0x79,0x3C,0xB3,0x00,0x0D,0x80,0x94,0x33,0x0B,0x00,0x0D,0x80,0x16,0x34,
+    0x0B,0x00,0x0D,0x80,0x79,0x3C,0xB2,0x00,0x0F,0x80,0x94,0x33,0x0A,0x00,0x0D,0x80,
+    0x16,0x34,0x0A,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x94,0x33,0x0B,0x00,
+    0x0B,0x80,0x16,0x34,0x0B,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x94,0x33,
+    0x0C,0x00,0x09,0x80,0x16,0x34,0x0C,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,
+    0x94,0x33,0x0E,0x00,0x05,0x80,0x16,0x34,0x0E,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,
+    0x0F,0x80,0x94,0x33,0x21,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x94,0x33,
+    0x21,0x00,0x0F,0x80,0x79,0x3C,0xB2,0x00,0x0D,0x80,0x94,0x33,0x23,0x00,0x0D,0x80,
+    0x79,0x3C,0xB3,0x00,0x0D,0x80,0x94,0x33,0x23,0x00,0x0D,0x80,0x79,0x3C,0xB4,0x00,
+    0x0B,0x80,0x94,0x33,0x25,0x00,0x0B,0x80,0x79,0x3C,0xB7,0x00,0x07,0x80,0x94,0x33,
+    0x29,0x00,0x07,0x80,0x79,0x3C,0x77,0x03,0x08,0x80,0x32,0x2B,0x4B,0x00,0x08,0x80,
+    0xDB,0x44,0x94,0x00,0x0A,0x80,0x32,0x2B,0x49,0x00,0x0A,0x80,0xDB,0x44,0x92,0x00,
+    0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,0xDB,0x44,0x90,0x00,0x0E,0x80,0x32,0x2B,
+    0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,
+    0xDB,0x44,0x8E,0x00,0x0F,0x80,0x32,0x2B,0x45,0x00,0x0F,0x80,0xDB,0x44,0x8D,0x00,
+    0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,0xDB,0x44,0x8D,0x00,0x10,0x80,0x32,0x2B,
+    0x43,0x00,0x10,0x80,0xDB,0x44,0x8D,0x00,0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,
+    0xDB,0x44,0x8E,0x00,0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,
+    0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,0xDB,0x44,0x90,0x00,0x0C,0x80,0x32,0x2B,
+    0x47,0x00,0x0C,0x80,0xDB,0x44,0x91,0x00,0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,
+    0xDB,0x44,0x92,0x00,0x09,0x80,0x32,0x2B,0x4B,0x00,0x09,0x80,0xDB,0x44,0x95,0x00,
+    0x06,0x80,0x32,0x2B,0x4D,0x00,0x06,0x80,0xDB,0x44,0x00,0x09,0x07,0x80,0xD0,0x22,
+    0x59,0x00,0x07,0x80,0x3D,0x45,0x87,0x00,0x0B,0x80,0xD0,0x22,0x55,0x00,0x0B,0x80,
+    0x3D,0x45,0x85,0x00,0x0B,0x80,0xD0,0x22,0x55,0x00,0x0B,0x80,0x3D,0x45,0x84,0x00,
+    0x0D,0x80,0xD0,0x22,0x53,0x00,0x0D,0x80,0x3D,0x45,0x82,0x00,0x0F,0x80,0xD0,0x22,
+    0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,
+    0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,
+    0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,
+    0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,
+    0x3D,0x45,0x82,0x00,0x0D,0x80,0xD0,0x22,0x53,0x00,0x0D,0x80,0x3D,0x45,0x83,0x00,
+    0x0D,0x80,0xD0,0x22,0x53,0x00,0x0D,0x80,0x3D,0x45,0x84,0x00,0x0B,0x80,0xD0,0x22,
+    0x55,0x00,0x0B,0x80,0x3D,0x45,0x86,0x00,0x09,0x80,0xD0,0x22,0x57,0x00,0x09,0x80,
+    0x3D,0x45,0x89,0x00,0x05,0x80,0xD0,0x22,0x5B,0x00,0x05,0x80,0x3D,0x45,0x00,0x09,
+    0x08,0x80,0x6D,0x22,0x4B,0x00,0x08,0x80,0x9F,0x4D,0x94,0x00,0x0A,0x80,0x6D,0x22,
+    0x49,0x00,0x0A,0x80,0x9F,0x4D,0x92,0x00,0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,
+    0x9F,0x4D,0x90,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8F,0x00,
+    0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8E,0x00,0x0F,0x80,0x6D,0x22,
+    0x45,0x00,0x0F,0x80,0x9F,0x4D,0x8D,0x00,0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,
+    0x9F,0x4D,0x8D,0x00,0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,0x9F,0x4D,0x8D,0x00,
+    0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,0x9F,0x4D,0x8E,0x00,0x0E,0x80,0x6D,0x22,
+    0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8F,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,
+    0x9F,0x4D,0x90,0x00,0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,0x9F,0x4D,0x91,0x00,
+    0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,0x9F,0x4D,0x92,0x00,0x09,0x80,0x6D,0x22,
+    0x4B,0x00,0x09,0x80,0x9F,0x4D,0x95,0x00,0x06,0x80,0x6D,0x22,0x4D,0x00,0x06,0x80,
+    0x9F,0x4D,0x89,0x02,0x05,0x80,0x0B,0x1A,0x2B,0x00,0x05,0x80,0x27,0x11,0xB9,0x00,
+    0x09,0x80,0x0B,0x1A,0x27,0x00,0x09,0x80,0x27,0x11,0xB6,0x00,0x0B,0x80,0x0B,0x1A,
+    0x25,0x00,0x0B,0x80,0x27,0x11,0xB4,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,
+    0x27,0x11,0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,0x27,0x11,0xB2,0x00,
+    0x0F,0x80,0x0B,0x1A,0x21,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x21,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,0x0D,0x00,0x07,0x80,
+    0xA9,0x11,0x0D,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,0x0B,0x00,
+    0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x0B,0x00,0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,
+    0x0B,0x1A,0x0A,0x00,0x0D,0x80,0xA9,0x11,0x0A,0x00,0x0F,0x80,0x27,0x11,0xB2,0x00,
+    0x0D,0x80,0x0B,0x1A,0x0A,0x00,0x0F,0x80,0xA9,0x11,0x0A,0x00,0x0D,0x80,0x27,0x11,
+    0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x0A,0x00,0x0F,0x80,0xA9,0x11,0x0A,0x00,0x0D,0x80,
+    0x27,0x11,0xB4,0x00,0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0xA9,0x11,0x0B,0x00,
+    0x0B,0x80,0x27,0x11,0xB7,0x00,0x07,0x80,0x0B,0x1A,0x0D,0x00,0x0F,0x80,0xA9,0x11,
+    0x0D,0x00,0x07,0x80,0x27,0x11,0xBC,0x00,0x01,0x40,0x0B,0x1A,0x10,0x00,0x0F,0x80,
+    0xA9,0x11,0x10,0x00,0x01,0x40,0x27,0x11,0xD0,0x00,0x0F,0x80,0xA9,0x11,0xE2,0x00,
+    0x0D,0x80,0xA9,0x11,0xE3,0x00,0x0D,0x80,0xA9,0x11,0xE4,0x00,0x0B,0x80,0xA9,0x11,
+    0xE6,0x00,0x09,0x80,0xA9,0x11,0xE9,0x00,0x05,0x80,0xA9,0x11,0x6E,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0x21,0x28,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x94,0x33,0xE7,0x00,
+    0x0B,0x80,0x94,0x33,0xE5,0x00,0x0B,0x80,0x94,0x33,0xE4,0x00,0x0D,0x80,0x94,0x33,
+    0xE2,0x00,0x0F,0x80,0x94,0x33,0xE1,0x00,0x0F,0x80,0x94,0x33,0xCE,0x00,0x05,0x80,
+    0x32,0x2B,0x0E,0x00,0x0F,0x80,0x94,0x33,0x0E,0x00,0x05,0x80,0x16,0x34,0xB9,0x00,
+    0x09,0x80,0x32,0x2B,0x0C,0x00,0x0F,0x80,0x94,0x33,0x0C,0x00,0x09,0x80,0x16,0x34,
+    0xB6,0x00,0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0x94,0x33,0x0B,0x00,0x0B,0x80,
+    0x16,0x34,0xB4,0x00,0x0D,0x80,0x32,0x2B,0x0A,0x00,0x0F,0x80,0x94,0x33,0x0A,0x00,
+    0x0D,0x80,0x16,0x34,0xB3,0x00,0x0D,0x80,0x32,0x2B,0x0B,0x00,0x0D,0x80,0x94,0x33,
+    0x0B,0x00,0x0D,0x80,0x16,0x34,0xB2,0x00,0x0F,0x80,0x32,0x2B,0x0A,0x00,0x0D,0x80,
+    0x94,0x33,0x0A,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0x32,0x2B,0x0B,0x00,
+    0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0x32,0x2B,
+    0x0C,0x00,0x09,0x80,0x94,0x33,0x0C,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,
+    0x32,0x2B,0x0E,0x00,0x05,0x80,0x94,0x33,0x0E,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,
+    0x0F,0x80,0x32,0x2B,0x21,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0x32,0x2B,
+    0x21,0x00,0x0F,0x80,0x16,0x34,0xB2,0x00,0x0D,0x80,0x32,0x2B,0x23,0x00,0x0D,0x80,
+    0x16,0x34,0xB3,0x00,0x0D,0x80,0x32,0x2B,0x23,0x00,0x0D,0x80,0x16,0x34,0xB4,0x00,
+    0x0B,0x80,0x32,0x2B,0x25,0x00,0x0B,0x80,0x16,0x34,0xB7,0x00,0x07,0x80,0x32,0x2B,
+    0x29,0x00,0x07,0x80,0x16,0x34,0x77,0x03,0x08,0x80,0xD0,0x22,0x4B,0x00,0x08,0x80,
+    0x79,0x3C,0x94,0x00,0x0A,0x80,0xD0,0x22,0x49,0x00,0x0A,0x80,0x79,0x3C,0x92,0x00,
+    0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,0x79,0x3C,0x90,0x00,0x0E,0x80,0xD0,0x22,
+    0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,
+    0x79,0x3C,0x8E,0x00,0x0F,0x80,0xD0,0x22,0x45,0x00,0x0F,0x80,0x79,0x3C,0x8D,0x00,
+    0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,0x79,0x3C,0x8D,0x00,0x10,0x80,0xD0,0x22,
+    0x43,0x00,0x10,0x80,0x79,0x3C,0x8D,0x00,0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,
+    0x79,0x3C,0x8E,0x00,0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,
+    0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,0x79,0x3C,0x90,0x00,0x0C,0x80,0xD0,0x22,
+    0x47,0x00,0x0C,0x80,0x79,0x3C,0x91,0x00,0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,
+    0x79,0x3C,0x92,0x00,0x09,0x80,0xD0,0x22,0x4B,0x00,0x09,0x80,0x79,0x3C,0x95,0x00,
+    0x06,0x80,0xD0,0x22,0x4D,0x00,0x06,0x80,0x79,0x3C,0x00,0x09,0x07,0x80,0x6D,0x22,
+    0x59,0x00,0x07,0x80,0xDB,0x44,0x87,0x00,0x0B,0x80,0x6D,0x22,0x55,0x00,0x0B,0x80,
+    0xDB,0x44,0x85,0x00,0x0B,0x80,0x6D,0x22,0x55,0x00,0x0B,0x80,0xDB,0x44,0x84,0x00,
+    0x0D,0x80,0x6D,0x22,0x53,0x00,0x0D,0x80,0xDB,0x44,0x82,0x00,0x0F,0x80,0x6D,0x22,
+    0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,
+    0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,
+    0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,
+    0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,
+    0xDB,0x44,0x82,0x00,0x0D,0x80,0x6D,0x22,0x53,0x00,0x0D,0x80,0xDB,0x44,0x83,0x00,
+    0x0D,0x80,0x6D,0x22,0x53,0x00,0x0D,0x80,0xDB,0x44,0x84,0x00,0x0B,0x80,0x6D,0x22,
+    0x55,0x00,0x0B,0x80,0xDB,0x44,0x86,0x00,0x09,0x80,0x6D,0x22,0x57,0x00,0x09,0x80,
+    0xDB,0x44,0x89,0x00,0x05,0x80,0x6D,0x22,0x5B,0x00,0x05,0x80,0xDB,0x44,0x00,0x09,
+    0x08,0x80,0x0B,0x1A,0x4B,0x00,0x08,0x80,0x3D,0x45,0x94,0x00,0x0A,0x80,0x0B,0x1A,
+    0x49,0x00,0x0A,0x80,0x3D,0x45,0x92,0x00,0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,
+    0x3D,0x45,0x90,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x3D,0x45,0x8F,0x00,
+    0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x3D,0x45,0x8E,0x00,0x0F,0x80,0x0B,0x1A,
+    0x45,0x00,0x0F,0x80,0x3D,0x45,0x8D,0x00,0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,
+    0x3D,0x45,0x8D,0x00,0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,0x3D,0x45,0x8D,0x00,
+    0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,0x3D,0x45,0x8E,0x00,0x0E,0x80,0x0B,0x1A,
+    0x45,0x00,0x0E,0x80,0x3D,0x45,0x8F,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,
+    0x3D,0x45,0x90,0x00,0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,0x3D,0x45,0x91,0x00,
+    0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,0x3D,0x45,0x92,0x00,0x09,0x80,0x0B,0x1A,
+    0x4B,0x00,0x09,0x80,0x3D,0x45,0x95,0x00,0x06,0x80,0x0B,0x1A,0x4D,0x00,0x06,0x80,
+    0x3D,0x45,0x89,0x02,0x05,0x80,0xA9,0x11,0x2B,0x00,0x05,0x80,0x9F,0x4D,0xB9,0x00,
+    0x09,0x80,0xA9,0x11,0x27,0x00,0x09,0x80,0x9F,0x4D,0xB6,0x00,0x0B,0x80,0xA9,0x11,
+    0x25,0x00,0x0B,0x80,0x9F,0x4D,0xB4,0x00,0x0D,0x80,0xA9,0x11,0x23,0x00,0x0D,0x80,
+    0x9F,0x4D,0xB3,0x00,0x0D,0x80,0xA9,0x11,0x23,0x00,0x0D,0x80,0x9F,0x4D,0xB2,0x00,
+    0x0F,0x80,0xA9,0x11,0x21,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,
+    0x21,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,0x0D,0x00,0x07,0x80,
+    0x27,0x11,0x0D,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,0x0B,0x00,
+    0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,
+    0x0B,0x00,0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,
+    0xA9,0x11,0x0A,0x00,0x0D,0x80,0x27,0x11,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0xB2,0x00,
+    0x0D,0x80,0xA9,0x11,0x0A,0x00,0x0F,0x80,0x27,0x11,0x0A,0x00,0x0D,0x80,0x9F,0x4D,
+    0xB3,0x00,0x0D,0x80,0xA9,0x11,0x0A,0x00,0x0F,0x80,0x27,0x11,0x0A,0x00,0x0D,0x80,
+    0x9F,0x4D,0xB4,0x00,0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x27,0x11,0x0B,0x00,
+    0x0B,0x80,0x9F,0x4D,0xB7,0x00,0x07,0x80,0xA9,0x11,0x0D,0x00,0x0F,0x80,0x27,0x11,
+    0x0D,0x00,0x07,0x80,0x9F,0x4D,0xBC,0x00,0x01,0x40,0xA9,0x11,0x10,0x00,0x0F,0x80,
+    0x27,0x11,0x10,0x00,0x01,0x40,0x9F,0x4D,0xD0,0x00,0x0F,0x80,0x27,0x11,0xE2,0x00,
+    0x0D,0x80,0x27,0x11,0xE3,0x00,0x0D,0x80,0x27,0x11,0xE4,0x00,0x0B,0x80,0x27,0x11,
+    0xE6,0x00,0x09,0x80,0x27,0x11,0xE9,0x00,0x05,0x80,0x27,0x11,0x74,0x21,0x05,0x80,
+    0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,
+    0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,
+    0x1C,0x28,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x32,0x2B,0xE7,0x00,
+    0x0B,0x80,0x32,0x2B,0xE5,0x00,0x0B,0x80,0x32,0x2B,0xE4,0x00,0x0D,0x80,0x32,0x2B,
+    0xE2,0x00,0x0F,0x80,0x32,0x2B,0xE1,0x00,0x0F,0x80,0x32,0x2B,0xCE,0x00,0x05,0x80,
+    0xD0,0x22,0x0E,0x00,0x0F,0x80,0x32,0x2B,0x0E,0x00,0x05,0x80,0x94,0x33,0xB9,0x00,
+    0x09,0x80,0xD0,0x22,0x0C,0x00,0x0F,0x80,0x32,0x2B,0x0C,0x00,0x09,0x80,0x94,0x33,
+    0xB6,0x00,0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x32,0x2B,0x0B,0x00,0x0B,0x80,
+    0x94,0x33,0xB4,0x00,0x0D,0x80,0xD0,0x22,0x0A,0x00,0x0F,0x80,0x32,0x2B,0x0A,0x00,
+    0x0D,0x80,0x94,0x33,0xB3,0x00,0x0D,0x80,0xD0,0x22,0x0B,0x00,0x0D,0x80,0x32,0x2B,
+    0x0B,0x00,0x0D,0x80,0x94,0x33,0xB2,0x00,0x0F,0x80,0xD0,0x22,0x0A,0x00,0x0D,0x80,
+    0x32,0x2B,0x0A,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0xD0,0x22,0x0B,0x00,
+    0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0xD0,0x22,
+    0x0C,0x00,0x09,0x80,0x32,0x2B,0x0C,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,
+    0xD0,0x22,0x0E,0x00,0x05,0x80,0x32,0x2B,0x0E,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,
+    0x0F,0x80,0xD0,0x22,0x21,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0xD0,0x22,
+    0x21,0x00,0x0F,0x80,0x94,0x33,0xB2,0x00,0x0D,0x80,0xD0,0x22,0x23,0x00,0x0D,0x80,
+    0x94,0x33,0xB3,0x00,0x0D,0x80,0xD0,0x22,0x23,0x00,0x0D,0x80,0x94,0x33,0xB4,0x00,
+    0x0B,0x80,0xD0,0x22,0x25,0x00,0x0B,0x80,0x94,0x33,0xB7,0x00,0x07,0x80,0xD0,0x22,
+    0x29,0x00,0x07,0x80,0x94,0x33,0x77,0x03,0x08,0x80,0x6D,0x22,0x4B,0x00,0x08,0x80,
+    0x16,0x34,0x94,0x00,0x0A,0x80,0x6D,0x22,0x49,0x00,0x0A,0x80,0x16,0x34,0x92,0x00,
+    0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,0x16,0x34,0x90,0x00,0x0E,0x80,0x6D,0x22,
+    0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,
+    0x16,0x34,0x8E,0x00,0x0F,0x80,0x6D,0x22,0x45,0x00,0x0F,0x80,0x16,0x34,0x8D,0x00,
+    0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,0x16,0x34,0x8D,0x00,0x10,0x80,0x6D,0x22,
+    0x43,0x00,0x10,0x80,0x16,0x34,0x8D,0x00,0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,
+    0x16,0x34,0x8E,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,
+    0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x16,0x34,0x90,0x00,0x0C,0x80,0x6D,0x22,
+    0x47,0x00,0x0C,0x80,0x16,0x34,0x91,0x00,0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,
+    0x16,0x34,0x92,0x00,0x09,0x80,0x6D,0x22,0x4B,0x00,0x09,0x80,0x16,0x34,0x95,0x00,
+    0x06,0x80,0x6D,0x22,0x4D,0x00,0x06,0x80,0x16,0x34,0x00,0x09,0x07,0x80,0x0B,0x1A,
+    0x59,0x00,0x07,0x80,0x79,0x3C,0x87,0x00,0x0B,0x80,0x0B,0x1A,0x55,0x00,0x0B,0x80,
+    0x79,0x3C,0x85,0x00,0x0B,0x80,0x0B,0x1A,0x55,0x00,0x0B,0x80,0x79,0x3C,0x84,0x00,
+    0x0D,0x80,0x0B,0x1A,0x53,0x00,0x0D,0x80,0x79,0x3C,0x82,0x00,0x0F,0x80,0x0B,0x1A,
+    0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,
+    0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,
+    0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,
+    0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,
+    0x79,0x3C,0x82,0x00,0x0D,0x80,0x0B,0x1A,0x53,0x00,0x0D,0x80,0x79,0x3C,0x83,0x00,
+    0x0D,0x80,0x0B,0x1A,0x53,0x00,0x0D,0x80,0x79,0x3C,0x84,0x00,0x0B,0x80,0x0B,0x1A,
+    0x55,0x00,0x0B,0x80,0x79,0x3C,0x86,0x00,0x09,0x80,0x0B,0x1A,0x57,0x00,0x09,0x80,
+    0x79,0x3C,0x89,0x00,0x05,0x80,0x0B,0x1A,0x5B,0x00,0x05,0x80,0x79,0x3C,0x00,0x09,
+    0x08,0x80,0xA9,0x11,0x4B,0x00,0x08,0x80,0xDB,0x44,0x94,0x00,0x0A,0x80,0xA9,0x11,
+    0x49,0x00,0x0A,0x80,0xDB,0x44,0x92,0x00,0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,
+    0xDB,0x44,0x90,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,
+    0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0xDB,0x44,0x8E,0x00,0x0F,0x80,0xA9,0x11,
+    0x45,0x00,0x0F,0x80,0xDB,0x44,0x8D,0x00,0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,
+    0xDB,0x44,0x8D,0x00,0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,0xDB,0x44,0x8D,0x00,
+    0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,0xDB,0x44,0x8E,0x00,0x0E,0x80,0xA9,0x11,
+    0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,
+    0xDB,0x44,0x90,0x00,0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,0xDB,0x44,0x91,0x00,
+    0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,0xDB,0x44,0x92,0x00,0x09,0x80,0xA9,0x11,
+    0x4B,0x00,0x09,0x80,0xDB,0x44,0x95,0x00,0x06,0x80,0xA9,0x11,0x4D,0x00,0x06,0x80,
+    0xDB,0x44,0x89,0x02,0x05,0x80,0x27,0x11,0x2B,0x00,0x05,0x80,0x3D,0x45,0xB9,0x00,
+    0x09,0x80,0x27,0x11,0x27,0x00,0x09,0x80,0x3D,0x45,0xB6,0x00,0x0B,0x80,0x27,0x11,
+    0x25,0x00,0x0B,0x80,0x3D,0x45,0xB4,0x00,0x0D,0x80,0x27,0x11,0x23,0x00,0x0D,0x80,
+    0x3D,0x45,0xB3,0x00,0x0D,0x80,0x27,0x11,0x23,0x00,0x0D,0x80,0x3D,0x45,0xB2,0x00,
+    0x0F,0x80,0x27,0x11,0x21,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,
+    0x21,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,0x0D,0x00,0x07,0x80,
+    0x9F,0x4D,0x0D,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,0x0B,0x00,
+    0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,
+    0x0B,0x00,0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,
+    0x27,0x11,0x0A,0x00,0x0D,0x80,0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x3D,0x45,0xB2,0x00,
+    0x0D,0x80,0x27,0x11,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0x0A,0x00,0x0D,0x80,0x3D,0x45,
+    0xB3,0x00,0x0D,0x80,0x27,0x11,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0x0A,0x00,0x0D,0x80,
+    0x3D,0x45,0xB4,0x00,0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0x0B,0x00,
+    0x0B,0x80,0x3D,0x45,0xB7,0x00,0x07,0x80,0x27,0x11,0x0D,0x00,0x0F,0x80,0x9F,0x4D,
+    0x0D,0x00,0x07,0x80,0x3D,0x45,0xBC,0x00,0x01,0x40,0x27,0x11,0x10,0x00,0x0F,0x80,
+    0x9F,0x4D,0x10,0x00,0x01,0x40,0x3D,0x45,0xD0,0x00,0x0F,0x80,0x9F,0x4D,0xE2,0x00,
+    0x0D,0x80,0x9F,0x4D,0xE3,0x00,0x0D,0x80,0x9F,0x4D,0xE4,0x00,0x0B,0x80,0x9F,0x4D,
+    0xE6,0x00,0x09,0x80,0x9F,0x4D,0xE9,0x00,0x05,0x80,0x9F,0x4D,0x79,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0x16,0x28,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0xD0,0x22,0xE7,0x00,
+    0x0B,0x80,0xD0,0x22,0xE5,0x00,0x0B,0x80,0xD0,0x22,0xE4,0x00,0x0D,0x80,0xD0,0x22,
+    0xE2,0x00,0x0F,0x80,0xD0,0x22,0xE1,0x00,0x0F,0x80,0xD0,0x22,0xCE,0x00,0x05,0x80,
+    0x6D,0x22,0x0E,0x00,0x0F,0x80,0xD0,0x22,0x0E,0x00,0x05,0x80,0x32,0x2B,0xB9,0x00,
+    0x09,0x80,0x6D,0x22,0x0C,0x00,0x0F,0x80,0xD0,0x22,0x0C,0x00,0x09,0x80,0x32,0x2B,
+    0xB6,0x00,0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0xD0,0x22,0x0B,0x00,0x0B,0x80,
+    0x32,0x2B,0xB4,0x00,0x0D,0x80,0x6D,0x22,0x0A,0x00,0x0F,0x80,0xD0,0x22,0x0A,0x00,
+    0x0D,0x80,0x32,0x2B,0xB3,0x00,0x0D,0x80,0x6D,0x22,0x0B,0x00,0x0D,0x80,0xD0,0x22,
+    0x0B,0x00,0x0D,0x80,0x32,0x2B,0xB2,0x00,0x0F,0x80,0x6D,0x22,0x0A,0x00,0x0D,0x80,
+    0xD0,0x22,0x0A,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x6D,0x22,0x0B,0x00,
+    0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x6D,0x22,
+    0x0C,0x00,0x09,0x80,0xD0,0x22,0x0C,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,
+    0x6D,0x22,0x0E,0x00,0x05,0x80,0xD0,0x22,0x0E,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,
+    0x0F,0x80,0x6D,0x22,0x21,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x6D,0x22,
+    0x21,0x00,0x0F,0x80,0x32,0x2B,0xB2,0x00,0x0D,0x80,0x6D,0x22,0x23,0x00,0x0D,0x80,
+    0x32,0x2B,0xB3,0x00,0x0D,0x80,0x6D,0x22,0x23,0x00,0x0D,0x80,0x32,0x2B,0xB4,0x00,
+    0x0B,0x80,0x6D,0x22,0x25,0x00,0x0B,0x80,0x32,0x2B,0xB7,0x00,0x07,0x80,0x6D,0x22,
+    0x29,0x00,0x07,0x80,0x32,0x2B,0x77,0x03,0x08,0x80,0x0B,0x1A,0x4B,0x00,0x08,0x80,
+    0x94,0x33,0x94,0x00,0x0A,0x80,0x0B,0x1A,0x49,0x00,0x0A,0x80,0x94,0x33,0x92,0x00,
+    0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,0x94,0x33,0x90,0x00,0x0E,0x80,0x0B,0x1A,
+    0x45,0x00,0x0E,0x80,0x94,0x33,0x8F,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,
+    0x94,0x33,0x8E,0x00,0x0F,0x80,0x0B,0x1A,0x45,0x00,0x0F,0x80,0x94,0x33,0x8D,0x00,
+    0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,0x94,0x33,0x8D,0x00,0x10,0x80,0x0B,0x1A,
+    0x43,0x00,0x10,0x80,0x94,0x33,0x8D,0x00,0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,
+    0x94,0x33,0x8E,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x94,0x33,0x8F,0x00,
+    0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x94,0x33,0x90,0x00,0x0C,0x80,0x0B,0x1A,
+    0x47,0x00,0x0C,0x80,0x94,0x33,0x91,0x00,0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,
+    0x94,0x33,0x92,0x00,0x09,0x80,0x0B,0x1A,0x4B,0x00,0x09,0x80,0x94,0x33,0x95,0x00,
+    0x06,0x80,0x0B,0x1A,0x4D,0x00,0x06,0x80,0x94,0x33,0x00,0x09,0x07,0x80,0xA9,0x11,
+    0x59,0x00,0x07,0x80,0x16,0x34,0x87,0x00,0x0B,0x80,0xA9,0x11,0x55,0x00,0x0B,0x80,
+    0x16,0x34,0x85,0x00,0x0B,0x80,0xA9,0x11,0x55,0x00,0x0B,0x80,0x16,0x34,0x84,0x00,
+    0x0D,0x80,0xA9,0x11,0x53,0x00,0x0D,0x80,0x16,0x34,0x82,0x00,0x0F,0x80,0xA9,0x11,
+    0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,
+    0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,
+    0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,
+    0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,
+    0x16,0x34,0x82,0x00,0x0D,0x80,0xA9,0x11,0x53,0x00,0x0D,0x80,0x16,0x34,0x83,0x00,
+    0x0D,0x80,0xA9,0x11,0x53,0x00,0x0D,0x80,0x16,0x34,0x84,0x00,0x0B,0x80,0xA9,0x11,
+    0x55,0x00,0x0B,0x80,0x16,0x34,0x86,0x00,0x09,0x80,0xA9,0x11,0x57,0x00,0x09,0x80,
+    0x16,0x34,0x89,0x00,0x05,0x80,0xA9,0x11,0x5B,0x00,0x05,0x80,0x16,0x34,0x00,0x09,
+    0x08,0x80,0x27,0x11,0x4B,0x00,0x08,0x80,0x79,0x3C,0x94,0x00,0x0A,0x80,0x27,0x11,
+    0x49,0x00,0x0A,0x80,0x79,0x3C,0x92,0x00,0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,
+    0x79,0x3C,0x90,0x00,0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,
+    0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,0x79,0x3C,0x8E,0x00,0x0F,0x80,0x27,0x11,
+    0x45,0x00,0x0F,0x80,0x79,0x3C,0x8D,0x00,0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,
+    0x79,0x3C,0x8D,0x00,0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,0x79,0x3C,0x8D,0x00,
+    0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,0x79,0x3C,0x8E,0x00,0x0E,0x80,0x27,0x11,
+    0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,
+    0x79,0x3C,0x90,0x00,0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,0x79,0x3C,0x91,0x00,
+    0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,0x79,0x3C,0x92,0x00,0x09,0x80,0x27,0x11,
+    0x4B,0x00,0x09,0x80,0x79,0x3C,0x95,0x00,0x06,0x80,0x27,0x11,0x4D,0x00,0x06,0x80,
+    0x79,0x3C,0x89,0x02,0x05,0x80,0x9F,0x4D,0x2B,0x00,0x05,0x80,0xDB,0x44,0xB9,0x00,
+    0x09,0x80,0x9F,0x4D,0x27,0x00,0x09,0x80,0xDB,0x44,0xB6,0x00,0x0B,0x80,0x9F,0x4D,
+    0x25,0x00,0x0B,0x80,0xDB,0x44,0xB4,0x00,0x0D,0x80,0x9F,0x4D,0x23,0x00,0x0D,0x80,
+    0xDB,0x44,0xB3,0x00,0x0D,0x80,0x9F,0x4D,0x23,0x00,0x0D,0x80,0xDB,0x44,0xB2,0x00,
+    0x0F,0x80,0x9F,0x4D,0x21,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,
+    0x21,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,0x0D,0x00,0x07,0x80,
+    0x3D,0x45,0x0D,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,0x0B,0x00,
+    0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,
+    0x0B,0x00,0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,
+    0x9F,0x4D,0x0A,0x00,0x0D,0x80,0x3D,0x45,0x0A,0x00,0x0F,0x80,0xDB,0x44,0xB2,0x00,
+    0x0D,0x80,0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x3D,0x45,0x0A,0x00,0x0D,0x80,0xDB,0x44,
+    0xB3,0x00,0x0D,0x80,0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x3D,0x45,0x0A,0x00,0x0D,0x80,
+    0xDB,0x44,0xB4,0x00,0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x3D,0x45,0x0B,0x00,
+    0x0B,0x80,0xDB,0x44,0xB7,0x00,0x07,0x80,0x9F,0x4D,0x0D,0x00,0x0F,0x80,0x3D,0x45,
+    0x0D,0x00,0x07,0x80,0xDB,0x44,0xBC,0x00,0x01,0x40,0x9F,0x4D,0x10,0x00,0x0F,0x80,
+    0x3D,0x45,0x10,0x00,0x01,0x40,0xDB,0x44,0xD0,0x00,0x0F,0x80,0x3D,0x45,0xE2,0x00,
+    0x0D,0x80,0x3D,0x45,0xE3,0x00,0x0D,0x80,0x3D,0x45,0xE4,0x00,0x0B,0x80,0x3D,0x45,
+    0xE6,0x00,0x09,0x80,0x3D,0x45,0xE9,0x00,0x05,0x80,0x3D,0x45,0x7F,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0x10,0x28,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x6D,0x22,0xE7,0x00,
+    0x0B,0x80,0x6D,0x22,0xE5,0x00,0x0B,0x80,0x6D,0x22,0xE4,0x00,0x0D,0x80,0x6D,0x22,
+    0xE2,0x00,0x0F,0x80,0x6D,0x22,0xE1,0x00,0x0F,0x80,0x6D,0x22,0xCE,0x00,0x05,0x80,
+    0x0B,0x1A,0x0E,0x00,0x0F,0x80,0x6D,0x22,0x0E,0x00,0x05,0x80,0xD0,0x22,0xB9,0x00,
+    0x09,0x80,0x0B,0x1A,0x0C,0x00,0x0F,0x80,0x6D,0x22,0x0C,0x00,0x09,0x80,0xD0,0x22,
+    0xB6,0x00,0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0x6D,0x22,0x0B,0x00,0x0B,0x80,
+    0xD0,0x22,0xB4,0x00,0x0D,0x80,0x0B,0x1A,0x0A,0x00,0x0F,0x80,0x6D,0x22,0x0A,0x00,
+    0x0D,0x80,0xD0,0x22,0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x0B,0x00,0x0D,0x80,0x6D,0x22,
+    0x0B,0x00,0x0D,0x80,0xD0,0x22,0xB2,0x00,0x0F,0x80,0x0B,0x1A,0x0A,0x00,0x0D,0x80,
+    0x6D,0x22,0x0A,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x0B,0x1A,0x0B,0x00,
+    0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x0C,0x00,0x09,0x80,0x6D,0x22,0x0C,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,
+    0x0B,0x1A,0x0E,0x00,0x05,0x80,0x6D,0x22,0x0E,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,
+    0x0F,0x80,0x0B,0x1A,0x21,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x21,0x00,0x0F,0x80,0xD0,0x22,0xB2,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,
+    0xD0,0x22,0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,0xD0,0x22,0xB4,0x00,
+    0x0B,0x80,0x0B,0x1A,0x25,0x00,0x0B,0x80,0xD0,0x22,0xB7,0x00,0x07,0x80,0x0B,0x1A,
+    0x29,0x00,0x07,0x80,0xD0,0x22,0x77,0x03,0x08,0x80,0xA9,0x11,0x4B,0x00,0x08,0x80,
+    0x32,0x2B,0x94,0x00,0x0A,0x80,0xA9,0x11,0x49,0x00,0x0A,0x80,0x32,0x2B,0x92,0x00,
+    0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,0x32,0x2B,0x90,0x00,0x0E,0x80,0xA9,0x11,
+    0x45,0x00,0x0E,0x80,0x32,0x2B,0x8F,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,
+    0x32,0x2B,0x8E,0x00,0x0F,0x80,0xA9,0x11,0x45,0x00,0x0F,0x80,0x32,0x2B,0x8D,0x00,
+    0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,0x32,0x2B,0x8D,0x00,0x10,0x80,0xA9,0x11,
+    0x43,0x00,0x10,0x80,0x32,0x2B,0x8D,0x00,0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,
+    0x32,0x2B,0x8E,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0x32,0x2B,0x8F,0x00,
+    0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0x32,0x2B,0x90,0x00,0x0C,0x80,0xA9,0x11,
+    0x47,0x00,0x0C,0x80,0x32,0x2B,0x91,0x00,0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,
+    0x32,0x2B,0x92,0x00,0x09,0x80,0xA9,0x11,0x4B,0x00,0x09,0x80,0x32,0x2B,0x95,0x00,
+    0x06,0x80,0xA9,0x11,0x4D,0x00,0x06,0x80,0x32,0x2B,0x00,0x09,0x07,0x80,0x27,0x11,
+    0x59,0x00,0x07,0x80,0x94,0x33,0x87,0x00,0x0B,0x80,0x27,0x11,0x55,0x00,0x0B,0x80,
+    0x94,0x33,0x85,0x00,0x0B,0x80,0x27,0x11,0x55,0x00,0x0B,0x80,0x94,0x33,0x84,0x00,
+    0x0D,0x80,0x27,0x11,0x53,0x00,0x0D,0x80,0x94,0x33,0x82,0x00,0x0F,0x80,0x27,0x11,
+    0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,
+    0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,
+    0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,
+    0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,
+    0x94,0x33,0x82,0x00,0x0D,0x80,0x27,0x11,0x53,0x00,0x0D,0x80,0x94,0x33,0x83,0x00,
+    0x0D,0x80,0x27,0x11,0x53,0x00,0x0D,0x80,0x94,0x33,0x84,0x00,0x0B,0x80,0x27,0x11,
+    0x55,0x00,0x0B,0x80,0x94,0x33,0x86,0x00,0x09,0x80,0x27,0x11,0x57,0x00,0x09,0x80,
+    0x94,0x33,0x89,0x00,0x05,0x80,0x27,0x11,0x5B,0x00,0x05,0x80,0x94,0x33,0x00,0x09,
+    0x08,0x80,0x9F,0x4D,0x4B,0x00,0x08,0x80,0x16,0x34,0x94,0x00,0x0A,0x80,0x9F,0x4D,
+    0x49,0x00,0x0A,0x80,0x16,0x34,0x92,0x00,0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,
+    0x16,0x34,0x90,0x00,0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,
+    0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,0x16,0x34,0x8E,0x00,0x0F,0x80,0x9F,0x4D,
+    0x45,0x00,0x0F,0x80,0x16,0x34,0x8D,0x00,0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,
+    0x16,0x34,0x8D,0x00,0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,0x16,0x34,0x8D,0x00,
+    0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,0x16,0x34,0x8E,0x00,0x0E,0x80,0x9F,0x4D,
+    0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,
+    0x16,0x34,0x90,0x00,0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,0x16,0x34,0x91,0x00,
+    0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,0x16,0x34,0x92,0x00,0x09,0x80,0x9F,0x4D,
+    0x4B,0x00,0x09,0x80,0x16,0x34,0x95,0x00,0x06,0x80,0x9F,0x4D,0x4D,0x00,0x06,0x80,
+    0x16,0x34,0x89,0x02,0x05,0x80,0x3D,0x45,0x2B,0x00,0x05,0x80,0x79,0x3C,0xB9,0x00,
+    0x09,0x80,0x3D,0x45,0x27,0x00,0x09,0x80,0x79,0x3C,0xB6,0x00,0x0B,0x80,0x3D,0x45,
+    0x25,0x00,0x0B,0x80,0x79,0x3C,0xB4,0x00,0x0D,0x80,0x3D,0x45,0x23,0x00,0x0D,0x80,
+    0x79,0x3C,0xB3,0x00,0x0D,0x80,0x3D,0x45,0x23,0x00,0x0D,0x80,0x79,0x3C,0xB2,0x00,
+    0x0F,0x80,0x3D,0x45,0x21,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,
+    0x21,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,0x0D,0x00,0x07,0x80,
+    0xDB,0x44,0x0D,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,0x0B,0x00,
+    0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,
+    0x0B,0x00,0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,
+    0x3D,0x45,0x0A,0x00,0x0D,0x80,0xDB,0x44,0x0A,0x00,0x0F,0x80,0x79,0x3C,0xB2,0x00,
+    0x0D,0x80,0x3D,0x45,0x0A,0x00,0x0F,0x80,0xDB,0x44,0x0A,0x00,0x0D,0x80,0x79,0x3C,
+    0xB3,0x00,0x0D,0x80,0x3D,0x45,0x0A,0x00,0x0F,0x80,0xDB,0x44,0x0A,0x00,0x0D,0x80,
+    0x79,0x3C,0xB4,0x00,0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0xDB,0x44,0x0B,0x00,
+    0x0B,0x80,0x79,0x3C,0xB7,0x00,0x07,0x80,0x3D,0x45,0x0D,0x00,0x0F,0x80,0xDB,0x44,
+    0x0D,0x00,0x07,0x80,0x79,0x3C,0xBC,0x00,0x01,0x40,0x3D,0x45,0x10,0x00,0x0F,0x80,
+    0xDB,0x44,0x10,0x00,0x01,0x40,0x79,0x3C,0xD0,0x00,0x0F,0x80,0xDB,0x44,0xE2,0x00,
+    0x0D,0x80,0xDB,0x44,0xE3,0x00,0x0D,0x80,0xDB,0x44,0xE4,0x00,0x0B,0x80,0xDB,0x44,
+    0xE6,0x00,0x09,0x80,0xDB,0x44,0xE9,0x00,0x05,0x80,0xDB,0x44,0x85,0x21,0x05,0x80,
+    0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,
+    0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,
+    0x0B,0x28,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x0B,0x1A,0xE7,0x00,
+    0x0B,0x80,0x0B,0x1A,0xE5,0x00,0x0B,0x80,0x0B,0x1A,0xE4,0x00,0x0D,0x80,0x0B,0x1A,
+    0xE2,0x00,0x0F,0x80,0x0B,0x1A,0xE1,0x00,0x0F,0x80,0x0B,0x1A,0xCE,0x00,0x05,0x80,
+    0xA9,0x11,0x0E,0x00,0x0F,0x80,0x0B,0x1A,0x0E,0x00,0x05,0x80,0x6D,0x22,0xB9,0x00,
+    0x09,0x80,0xA9,0x11,0x0C,0x00,0x0F,0x80,0x0B,0x1A,0x0C,0x00,0x09,0x80,0x6D,0x22,
+    0xB6,0x00,0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x0B,0x1A,0x0B,0x00,0x0B,0x80,
+    0x6D,0x22,0xB4,0x00,0x0D,0x80,0xA9,0x11,0x0A,0x00,0x0F,0x80,0x0B,0x1A,0x0A,0x00,
+    0x0D,0x80,0x6D,0x22,0xB3,0x00,0x0D,0x80,0xA9,0x11,0x0B,0x00,0x0D,0x80,0x0B,0x1A,
+    0x0B,0x00,0x0D,0x80,0x6D,0x22,0xB2,0x00,0x0F,0x80,0xA9,0x11,0x0A,0x00,0x0D,0x80,
+    0x0B,0x1A,0x0A,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0xA9,0x11,0x0B,0x00,
+    0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0xA9,0x11,
+    0x0C,0x00,0x09,0x80,0x0B,0x1A,0x0C,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,
+    0xA9,0x11,0x0E,0x00,0x05,0x80,0x0B,0x1A,0x0E,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,
+    0x0F,0x80,0xA9,0x11,0x21,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0xA9,0x11,
+    0x21,0x00,0x0F,0x80,0x6D,0x22,0xB2,0x00,0x0D,0x80,0xA9,0x11,0x23,0x00,0x0D,0x80,
+    0x6D,0x22,0xB3,0x00,0x0D,0x80,0xA9,0x11,0x23,0x00,0x0D,0x80,0x6D,0x22,0xB4,0x00,
+    0x0B,0x80,0xA9,0x11,0x25,0x00,0x0B,0x80,0x6D,0x22,0xB7,0x00,0x07,0x80,0xA9,0x11,
+    0x29,0x00,0x07,0x80,0x6D,0x22,0x77,0x03,0x08,0x80,0x27,0x11,0x4B,0x00,0x08,0x80,
+    0xD0,0x22,0x94,0x00,0x0A,0x80,0x27,0x11,0x49,0x00,0x0A,0x80,0xD0,0x22,0x92,0x00,
+    0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,0xD0,0x22,0x90,0x00,0x0E,0x80,0x27,0x11,
+    0x45,0x00,0x0E,0x80,0xD0,0x22,0x8F,0x00,0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,
+    0xD0,0x22,0x8E,0x00,0x0F,0x80,0x27,0x11,0x45,0x00,0x0F,0x80,0xD0,0x22,0x8D,0x00,
+    0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,0xD0,0x22,0x8D,0x00,0x10,0x80,0x27,0x11,
+    0x43,0x00,0x10,0x80,0xD0,0x22,0x8D,0x00,0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,
+    0xD0,0x22,0x8E,0x00,0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,0xD0,0x22,0x8F,0x00,
+    0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,0xD0,0x22,0x90,0x00,0x0C,0x80,0x27,0x11,
+    0x47,0x00,0x0C,0x80,0xD0,0x22,0x91,0x00,0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,
+    0xD0,0x22,0x92,0x00,0x09,0x80,0x27,0x11,0x4B,0x00,0x09,0x80,0xD0,0x22,0x95,0x00,
+    0x06,0x80,0x27,0x11,0x4D,0x00,0x06,0x80,0xD0,0x22,0x00,0x09,0x07,0x80,0x9F,0x4D,
+    0x59,0x00,0x07,0x80,0x32,0x2B,0x87,0x00,0x0B,0x80,0x9F,0x4D,0x55,0x00,0x0B,0x80,
+    0x32,0x2B,0x85,0x00,0x0B,0x80,0x9F,0x4D,0x55,0x00,0x0B,0x80,0x32,0x2B,0x84,0x00,
+    0x0D,0x80,0x9F,0x4D,0x53,0x00,0x0D,0x80,0x32,0x2B,0x82,0x00,0x0F,0x80,0x9F,0x4D,
+    0x51,0x00,0x0F,0x80,0x32,0x2B,0x81,0x00,0x0F,0x80,0x9F,0x4D,0x51,0x00,0x0F,0x80,
+    0x32,0x2B,0x81,0x00,0x0F,0x80,0x9F,0x4D,0x51,0x00,0x0F,0x80,0x32,0x2B,0x81,0x00,
+    0x0F,0x80,0x9F,0x4D,0x51,0x00,0x0F,0x80,0x32,0x2B,0x81,0x00,0x0F,0x80,0x9F,0x4D,
+    0x51,0x00,0x0F,0x80,0x32,0x2B,0x81,0x00,0x0F,0x80,0x9F,0x4D,0x51,0x00,0x0F,0x80,
+    0x32,0x2B,0x82,0x00,0x0D,0x80,0x9F,0x4D,0x53,0x00,0x0D,0x80,0x32,0x2B,0x83,0x00,
+    0x0D,0x80,0x9F,0x4D,0x53,0x00,0x0D,0x80,0x32,0x2B,0x84,0x00,0x0B,0x80,0x9F,0x4D,
+    0x55,0x00,0x0B,0x80,0x32,0x2B,0x86,0x00,0x09,0x80,0x9F,0x4D,0x57,0x00,0x09,0x80,
+    0x32,0x2B,0x89,0x00,0x05,0x80,0x9F,0x4D,0x5B,0x00,0x05,0x80,0x32,0x2B,0x00,0x09,
+    0x08,0x80,0x3D,0x45,0x4B,0x00,0x08,0x80,0x94,0x33,0x94,0x00,0x0A,0x80,0x3D,0x45,
+    0x49,0x00,0x0A,0x80,0x94,0x33,0x92,0x00,0x0C,0x80,0x3D,0x45,0x47,0x00,0x0C,0x80,
+    0x94,0x33,0x90,0x00,0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,0x94,0x33,0x8F,0x00,
+    0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,0x94,0x33,0x8E,0x00,0x0F,0x80,0x3D,0x45,
+    0x45,0x00,0x0F,0x80,0x94,0x33,0x8D,0x00,0x10,0x80,0x3D,0x45,0x43,0x00,0x10,0x80,
+    0x94,0x33,0x8D,0x00,0x10,0x80,0x3D,0x45,0x43,0x00,0x10,0x80,0x94,0x33,0x8D,0x00,
+    0x10,0x80,0x3D,0x45,0x43,0x00,0x10,0x80,0x94,0x33,0x8E,0x00,0x0E,0x80,0x3D,0x45,
+    0x45,0x00,0x0E,0x80,0x94,0x33,0x8F,0x00,0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,
+    0x94,0x33,0x90,0x00,0x0C,0x80,0x3D,0x45,0x47,0x00,0x0C,0x80,0x94,0x33,0x91,0x00,
+    0x0C,0x80,0x3D,0x45,0x47,0x00,0x0C,0x80,0x94,0x33,0x92,0x00,0x09,0x80,0x3D,0x45,
+    0x4B,0x00,0x09,0x80,0x94,0x33,0x95,0x00,0x06,0x80,0x3D,0x45,0x4D,0x00,0x06,0x80,
+    0x94,0x33,0x89,0x02,0x05,0x80,0xDB,0x44,0x2B,0x00,0x05,0x80,0x16,0x34,0xB9,0x00,
+    0x09,0x80,0xDB,0x44,0x27,0x00,0x09,0x80,0x16,0x34,0xB6,0x00,0x0B,0x80,0xDB,0x44,
+    0x25,0x00,0x0B,0x80,0x16,0x34,0xB4,0x00,0x0D,0x80,0xDB,0x44,0x23,0x00,0x0D,0x80,
+    0x16,0x34,0xB3,0x00,0x0D,0x80,0xDB,0x44,0x23,0x00,0x0D,0x80,0x16,0x34,0xB2,0x00,
+    0x0F,0x80,0xDB,0x44,0x21,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0xDB,0x44,
+    0x21,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0xDB,0x44,0x0D,0x00,0x07,0x80,
+    0x79,0x3C,0x0D,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0xDB,0x44,0x0B,0x00,
+    0x0B,0x80,0x79,0x3C,0x0B,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0xDB,0x44,
+    0x0B,0x00,0x0B,0x80,0x79,0x3C,0x0B,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,
+    0xDB,0x44,0x0A,0x00,0x0D,0x80,0x79,0x3C,0x0A,0x00,0x0F,0x80,0x16,0x34,0xB2,0x00,
+    0x0D,0x80,0xDB,0x44,0x0A,0x00,0x0F,0x80,0x79,0x3C,0x0A,0x00,0x0D,0x80,0x16,0x34,
+    0xB3,0x00,0x0D,0x80,0xDB,0x44,0x0A,0x00,0x0F,0x80,0x79,0x3C,0x0A,0x00,0x0D,0x80,
+    0x16,0x34,0xB4,0x00,0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x79,0x3C,0x0B,0x00,
+    0x0B,0x80,0x16,0x34,0xB7,0x00,0x07,0x80,0xDB,0x44,0x0D,0x00,0x0F,0x80,0x79,0x3C,
+    0x0D,0x00,0x07,0x80,0x16,0x34,0xBC,0x00,0x01,0x40,0xDB,0x44,0x10,0x00,0x0F,0x80,
+    0x79,0x3C,0x10,0x00,0x01,0x40,0x16,0x34,0xD0,0x00,0x0F,0x80,0x79,0x3C,0xE2,0x00,
+    0x0D,0x80,0x79,0x3C,0xE3,0x00,0x0D,0x80,0x79,0x3C,0xE4,0x00,0x0B,0x80,0x79,0x3C,
+    0xE6,0x00,0x09,0x80,0x79,0x3C,0xE9,0x00,0x05,0x80,0x79,0x3C,0x8A,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0x05,0x28,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0xA9,0x11,0xE7,0x00,
+    0x0B,0x80,0xA9,0x11,0xE5,0x00,0x0B,0x80,0xA9,0x11,0xE4,0x00,0x0D,0x80,0xA9,0x11,
+    0xE2,0x00,0x0F,0x80,0xA9,0x11,0xE1,0x00,0x0F,0x80,0xA9,0x11,0xCE,0x00,0x05,0x80,
+    0x27,0x11,0x0E,0x00,0x0F,0x80,0xA9,0x11,0x0E,0x00,0x05,0x80,0x0B,0x1A,0xB9,0x00,
+    0x09,0x80,0x27,0x11,0x0C,0x00,0x0F,0x80,0xA9,0x11,0x0C,0x00,0x09,0x80,0x0B,0x1A,
+    0xB6,0x00,0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0xA9,0x11,0x0B,0x00,0x0B,0x80,
+    0x0B,0x1A,0xB4,0x00,0x0D,0x80,0x27,0x11,0x0A,0x00,0x0F,0x80,0xA9,0x11,0x0A,0x00,
+    0x0D,0x80,0x0B,0x1A,0xB3,0x00,0x0D,0x80,0x27,0x11,0x0B,0x00,0x0D,0x80,0xA9,0x11,
+    0x0B,0x00,0x0D,0x80,0x0B,0x1A,0xB2,0x00,0x0F,0x80,0x27,0x11,0x0A,0x00,0x0D,0x80,
+    0xA9,0x11,0x0A,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0x27,0x11,0x0B,0x00,
+    0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0x27,0x11,
+    0x0C,0x00,0x09,0x80,0xA9,0x11,0x0C,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,
+    0x27,0x11,0x0E,0x00,0x05,0x80,0xA9,0x11,0x0E,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,
+    0x0F,0x80,0x27,0x11,0x21,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0x27,0x11,
+    0x21,0x00,0x0F,0x80,0x0B,0x1A,0xB2,0x00,0x0D,0x80,0x27,0x11,0x23,0x00,0x0D,0x80,
+    0x0B,0x1A,0xB3,0x00,0x0D,0x80,0x27,0x11,0x23,0x00,0x0D,0x80,0x0B,0x1A,0xB4,0x00,
+    0x0B,0x80,0x27,0x11,0x25,0x00,0x0B,0x80,0x0B,0x1A,0xB7,0x00,0x07,0x80,0x27,0x11,
+    0x29,0x00,0x07,0x80,0x0B,0x1A,0x77,0x03,0x08,0x80,0x9F,0x4D,0x4B,0x00,0x08,0x80,
+    0x6D,0x22,0x94,0x00,0x0A,0x80,0x9F,0x4D,0x49,0x00,0x0A,0x80,0x6D,0x22,0x92,0x00,
+    0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,0x6D,0x22,0x90,0x00,0x0E,0x80,0x9F,0x4D,
+    0x45,0x00,0x0E,0x80,0x6D,0x22,0x8F,0x00,0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,
+    0x6D,0x22,0x8E,0x00,0x0F,0x80,0x9F,0x4D,0x45,0x00,0x0F,0x80,0x6D,0x22,0x8D,0x00,
+    0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,0x6D,0x22,0x8D,0x00,0x10,0x80,0x9F,0x4D,
+    0x43,0x00,0x10,0x80,0x6D,0x22,0x8D,0x00,0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,
+    0x6D,0x22,0x8E,0x00,0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,0x6D,0x22,0x8F,0x00,
+    0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,0x6D,0x22,0x90,0x00,0x0C,0x80,0x9F,0x4D,
+    0x47,0x00,0x0C,0x80,0x6D,0x22,0x91,0x00,0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,
+    0x6D,0x22,0x92,0x00,0x09,0x80,0x9F,0x4D,0x4B,0x00,0x09,0x80,0x6D,0x22,0x95,0x00,
+    0x06,0x80,0x9F,0x4D,0x4D,0x00,0x06,0x80,0x6D,0x22,0x00,0x09,0x07,0x80,0x3D,0x45,
+    0x59,0x00,0x07,0x80,0xD0,0x22,0x87,0x00,0x0B,0x80,0x3D,0x45,0x55,0x00,0x0B,0x80,
+    0xD0,0x22,0x85,0x00,0x0B,0x80,0x3D,0x45,0x55,0x00,0x0B,0x80,0xD0,0x22,0x84,0x00,
+    0x0D,0x80,0x3D,0x45,0x53,0x00,0x0D,0x80,0xD0,0x22,0x82,0x00,0x0F,0x80,0x3D,0x45,
+    0x51,0x00,0x0F,0x80,0xD0,0x22,0x81,0x00,0x0F,0x80,0x3D,0x45,0x51,0x00,0x0F,0x80,
+    0xD0,0x22,0x81,0x00,0x0F,0x80,0x3D,0x45,0x51,0x00,0x0F,0x80,0xD0,0x22,0x81,0x00,
+    0x0F,0x80,0x3D,0x45,0x51,0x00,0x0F,0x80,0xD0,0x22,0x81,0x00,0x0F,0x80,0x3D,0x45,
+    0x51,0x00,0x0F,0x80,0xD0,0x22,0x81,0x00,0x0F,0x80,0x3D,0x45,0x51,0x00,0x0F,0x80,
+    0xD0,0x22,0x82,0x00,0x0D,0x80,0x3D,0x45,0x53,0x00,0x0D,0x80,0xD0,0x22,0x83,0x00,
+    0x0D,0x80,0x3D,0x45,0x53,0x00,0x0D,0x80,0xD0,0x22,0x84,0x00,0x0B,0x80,0x3D,0x45,
+    0x55,0x00,0x0B,0x80,0xD0,0x22,0x86,0x00,0x09,0x80,0x3D,0x45,0x57,0x00,0x09,0x80,
+    0xD0,0x22,0x89,0x00,0x05,0x80,0x3D,0x45,0x5B,0x00,0x05,0x80,0xD0,0x22,0x00,0x09,
+    0x08,0x80,0xDB,0x44,0x4B,0x00,0x08,0x80,0x32,0x2B,0x94,0x00,0x0A,0x80,0xDB,0x44,
+    0x49,0x00,0x0A,0x80,0x32,0x2B,0x92,0x00,0x0C,0x80,0xDB,0x44,0x47,0x00,0x0C,0x80,
+    0x32,0x2B,0x90,0x00,0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,0x32,0x2B,0x8F,0x00,
+    0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,0x32,0x2B,0x8E,0x00,0x0F,0x80,0xDB,0x44,
+    0x45,0x00,0x0F,0x80,0x32,0x2B,0x8D,0x00,0x10,0x80,0xDB,0x44,0x43,0x00,0x10,0x80,
+    0x32,0x2B,0x8D,0x00,0x10,0x80,0xDB,0x44,0x43,0x00,0x10,0x80,0x32,0x2B,0x8D,0x00,
+    0x10,0x80,0xDB,0x44,0x43,0x00,0x10,0x80,0x32,0x2B,0x8E,0x00,0x0E,0x80,0xDB,0x44,
+    0x45,0x00,0x0E,0x80,0x32,0x2B,0x8F,0x00,0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,
+    0x32,0x2B,0x90,0x00,0x0C,0x80,0xDB,0x44,0x47,0x00,0x0C,0x80,0x32,0x2B,0x91,0x00,
+    0x0C,0x80,0xDB,0x44,0x47,0x00,0x0C,0x80,0x32,0x2B,0x92,0x00,0x09,0x80,0xDB,0x44,
+    0x4B,0x00,0x09,0x80,0x32,0x2B,0x95,0x00,0x06,0x80,0xDB,0x44,0x4D,0x00,0x06,0x80,
+    0x32,0x2B,0x89,0x02,0x05,0x80,0x79,0x3C,0x2B,0x00,0x05,0x80,0x94,0x33,0xB9,0x00,
+    0x09,0x80,0x79,0x3C,0x27,0x00,0x09,0x80,0x94,0x33,0xB6,0x00,0x0B,0x80,0x79,0x3C,
+    0x25,0x00,0x0B,0x80,0x94,0x33,0xB4,0x00,0x0D,0x80,0x79,0x3C,0x23,0x00,0x0D,0x80,
+    0x94,0x33,0xB3,0x00,0x0D,0x80,0x79,0x3C,0x23,0x00,0x0D,0x80,0x94,0x33,0xB2,0x00,
+    0x0F,0x80,0x79,0x3C,0x21,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0x79,0x3C,
+    0x21,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0x79,0x3C,0x0D,0x00,0x07,0x80,
+    0x16,0x34,0x0D,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0x79,0x3C,0x0B,0x00,
+    0x0B,0x80,0x16,0x34,0x0B,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0x79,0x3C,
+    0x0B,0x00,0x0B,0x80,0x16,0x34,0x0B,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,
+    0x79,0x3C,0x0A,0x00,0x0D,0x80,0x16,0x34,0x0A,0x00,0x0F,0x80,0x94,0x33,0xB2,0x00,
+    0x0D,0x80,0x79,0x3C,0x0A,0x00,0x0F,0x80,0x16,0x34,0x0A,0x00,0x0D,0x80,0x94,0x33,
+    0xB3,0x00,0x0D,0x80,0x79,0x3C,0x0A,0x00,0x0F,0x80,0x16,0x34,0x0A,0x00,0x0D,0x80,
+    0x94,0x33,0xB4,0x00,0x0B,0x80,0x79,0x3C,0x0B,0x00,0x0F,0x80,0x16,0x34,0x0B,0x00,
+    0x0B,0x80,0x94,0x33,0xB7,0x00,0x07,0x80,0x79,0x3C,0x0D,0x00,0x0F,0x80,0x16,0x34,
+    0x0D,0x00,0x07,0x80,0x94,0x33,0xBC,0x00,0x01,0x40,0x79,0x3C,0x10,0x00,0x0F,0x80,
+    0x16,0x34,0x10,0x00,0x01,0x40,0x94,0x33,0xD0,0x00,0x0F,0x80,0x16,0x34,0xE2,0x00,
+    0x0D,0x80,0x16,0x34,0xE3,0x00,0x0D,0x80,0x16,0x34,0xE4,0x00,0x0B,0x80,0x16,0x34,
+    0xE6,0x00,0x09,0x80,0x16,0x34,0xE9,0x00,0x05,0x80,0x16,0x34,0x90,0x21,0x05,0x80,
+    0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,
+    0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,
+    0x00,0x28,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x27,0x11,0xE7,0x00,
+    0x0B,0x80,0x27,0x11,0xE5,0x00,0x0B,0x80,0x27,0x11,0xE4,0x00,0x0D,0x80,0x27,0x11,
+    0xE2,0x00,0x0F,0x80,0x27,0x11,0xE1,0x00,0x0F,0x80,0x27,0x11,0xCE,0x00,0x05,0x80,
+    0x9F,0x4D,0x0E,0x00,0x0F,0x80,0x27,0x11,0x0E,0x00,0x05,0x80,0xA9,0x11,0xB9,0x00,
+    0x09,0x80,0x9F,0x4D,0x0C,0x00,0x0F,0x80,0x27,0x11,0x0C,0x00,0x09,0x80,0xA9,0x11,
+    0xB6,0x00,0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x27,0x11,0x0B,0x00,0x0B,0x80,
+    0xA9,0x11,0xB4,0x00,0x0D,0x80,0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x27,0x11,0x0A,0x00,
+    0x0D,0x80,0xA9,0x11,0xB3,0x00,0x0D,0x80,0x9F,0x4D,0x0B,0x00,0x0D,0x80,0x27,0x11,
+    0x0B,0x00,0x0D,0x80,0xA9,0x11,0xB2,0x00,0x0F,0x80,0x9F,0x4D,0x0A,0x00,0x0D,0x80,
+    0x27,0x11,0x0A,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x9F,0x4D,0x0B,0x00,
+    0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x9F,0x4D,
+    0x0C,0x00,0x09,0x80,0x27,0x11,0x0C,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,
+    0x9F,0x4D,0x0E,0x00,0x05,0x80,0x27,0x11,0x0E,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,
+    0x0F,0x80,0x9F,0x4D,0x21,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x9F,0x4D,
+    0x21,0x00,0x0F,0x80,0xA9,0x11,0xB2,0x00,0x0D,0x80,0x9F,0x4D,0x23,0x00,0x0D,0x80,
+    0xA9,0x11,0xB3,0x00,0x0D,0x80,0x9F,0x4D,0x23,0x00,0x0D,0x80,0xA9,0x11,0xB4,0x00,
+    0x0B,0x80,0x9F,0x4D,0x25,0x00,0x0B,0x80,0xA9,0x11,0xB7,0x00,0x07,0x80,0x9F,0x4D,
+    0x29,0x00,0x07,0x80,0xA9,0x11,0x77,0x03,0x08,0x80,0x3D,0x45,0x4B,0x00,0x08,0x80,
+    0x0B,0x1A,0x94,0x00,0x0A,0x80,0x3D,0x45,0x49,0x00,0x0A,0x80,0x0B,0x1A,0x92,0x00,
+    0x0C,0x80,0x3D,0x45,0x47,0x00,0x0C,0x80,0x0B,0x1A,0x90,0x00,0x0E,0x80,0x3D,0x45,
+    0x45,0x00,0x0E,0x80,0x0B,0x1A,0x8F,0x00,0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,
+    0x0B,0x1A,0x8E,0x00,0x0F,0x80,0x3D,0x45,0x45,0x00,0x0F,0x80,0x0B,0x1A,0x8D,0x00,
+    0x10,0x80,0x3D,0x45,0x43,0x00,0x10,0x80,0x0B,0x1A,0x8D,0x00,0x10,0x80,0x3D,0x45,
+    0x43,0x00,0x10,0x80,0x0B,0x1A,0x8D,0x00,0x10,0x80,0x3D,0x45,0x43,0x00,0x10,0x80,
+    0x0B,0x1A,0x8E,0x00,0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,0x0B,0x1A,0x8F,0x00,
+    0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,0x0B,0x1A,0x90,0x00,0x0C,0x80,0x3D,0x45,
+    0x47,0x00,0x0C,0x80,0x0B,0x1A,0x91,0x00,0x0C,0x80,0x3D,0x45,0x47,0x00,0x0C,0x80,
+    0x0B,0x1A,0x92,0x00,0x09,0x80,0x3D,0x45,0x4B,0x00,0x09,0x80,0x0B,0x1A,0x95,0x00,
+    0x06,0x80,0x3D,0x45,0x4D,0x00,0x06,0x80,0x0B,0x1A,0x00,0x09,0x07,0x80,0xDB,0x44,
+    0x59,0x00,0x07,0x80,0x6D,0x22,0x87,0x00,0x0B,0x80,0xDB,0x44,0x55,0x00,0x0B,0x80,
+    0x6D,0x22,0x85,0x00,0x0B,0x80,0xDB,0x44,0x55,0x00,0x0B,0x80,0x6D,0x22,0x84,0x00,
+    0x0D,0x80,0xDB,0x44,0x53,0x00,0x0D,0x80,0x6D,0x22,0x82,0x00,0x0F,0x80,0xDB,0x44,
+    0x51,0x00,0x0F,0x80,0x6D,0x22,0x81,0x00,0x0F,0x80,0xDB,0x44,0x51,0x00,0x0F,0x80,
+    0x6D,0x22,0x81,0x00,0x0F,0x80,0xDB,0x44,0x51,0x00,0x0F,0x80,0x6D,0x22,0x81,0x00,
+    0x0F,0x80,0xDB,0x44,0x51,0x00,0x0F,0x80,0x6D,0x22,0x81,0x00,0x0F,0x80,0xDB,0x44,
+    0x51,0x00,0x0F,0x80,0x6D,0x22,0x81,0x00,0x0F,0x80,0xDB,0x44,0x51,0x00,0x0F,0x80,
+    0x6D,0x22,0x82,0x00,0x0D,0x80,0xDB,0x44,0x53,0x00,0x0D,0x80,0x6D,0x22,0x83,0x00,
+    0x0D,0x80,0xDB,0x44,0x53,0x00,0x0D,0x80,0x6D,0x22,0x84,0x00,0x0B,0x80,0xDB,0x44,
+    0x55,0x00,0x0B,0x80,0x6D,0x22,0x86,0x00,0x09,0x80,0xDB,0x44,0x57,0x00,0x09,0x80,
+    0x6D,0x22,0x89,0x00,0x05,0x80,0xDB,0x44,0x5B,0x00,0x05,0x80,0x6D,0x22,0x00,0x09,
+    0x08,0x80,0x79,0x3C,0x4B,0x00,0x08,0x80,0xD0,0x22,0x94,0x00,0x0A,0x80,0x79,0x3C,
+    0x49,0x00,0x0A,0x80,0xD0,0x22,0x92,0x00,0x0C,0x80,0x79,0x3C,0x47,0x00,0x0C,0x80,
+    0xD0,0x22,0x90,0x00,0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,0xD0,0x22,0x8F,0x00,
+    0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,0xD0,0x22,0x8E,0x00,0x0F,0x80,0x79,0x3C,
+    0x45,0x00,0x0F,0x80,0xD0,0x22,0x8D,0x00,0x10,0x80,0x79,0x3C,0x43,0x00,0x10,0x80,
+    0xD0,0x22,0x8D,0x00,0x10,0x80,0x79,0x3C,0x43,0x00,0x10,0x80,0xD0,0x22,0x8D,0x00,
+    0x10,0x80,0x79,0x3C,0x43,0x00,0x10,0x80,0xD0,0x22,0x8E,0x00,0x0E,0x80,0x79,0x3C,
+    0x45,0x00,0x0E,0x80,0xD0,0x22,0x8F,0x00,0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,
+    0xD0,0x22,0x90,0x00,0x0C,0x80,0x79,0x3C,0x47,0x00,0x0C,0x80,0xD0,0x22,0x91,0x00,
+    0x0C,0x80,0x79,0x3C,0x47,0x00,0x0C,0x80,0xD0,0x22,0x92,0x00,0x09,0x80,0x79,0x3C,
+    0x4B,0x00,0x09,0x80,0xD0,0x22,0x95,0x00,0x06,0x80,0x79,0x3C,0x4D,0x00,0x06,0x80,
+    0xD0,0x22,0x89,0x02,0x05,0x80,0x16,0x34,0x2B,0x00,0x05,0x80,0x32,0x2B,0xB9,0x00,
+    0x09,0x80,0x16,0x34,0x27,0x00,0x09,0x80,0x32,0x2B,0xB6,0x00,0x0B,0x80,0x16,0x34,
+    0x25,0x00,0x0B,0x80,0x32,0x2B,0xB4,0x00,0x0D,0x80,0x16,0x34,0x23,0x00,0x0D,0x80,
+    0x32,0x2B,0xB3,0x00,0x0D,0x80,0x16,0x34,0x23,0x00,0x0D,0x80,0x32,0x2B,0xB2,0x00,
+    0x0F,0x80,0x16,0x34,0x21,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x16,0x34,
+    0x21,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x16,0x34,0x0D,0x00,0x07,0x80,
+    0x94,0x33,0x0D,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x16,0x34,0x0B,0x00,
+    0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x16,0x34,
+    0x0B,0x00,0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,
+    0x16,0x34,0x0A,0x00,0x0D,0x80,0x94,0x33,0x0A,0x00,0x0F,0x80,0x32,0x2B,0xB2,0x00,
+    0x0D,0x80,0x16,0x34,0x0A,0x00,0x0F,0x80,0x94,0x33,0x0A,0x00,0x0D,0x80,0x32,0x2B,
+    0xB3,0x00,0x0D,0x80,0x16,0x34,0x0A,0x00,0x0F,0x80,0x94,0x33,0x0A,0x00,0x0D,0x80,
+    0x32,0x2B,0xB4,0x00,0x0B,0x80,0x16,0x34,0x0B,0x00,0x0F,0x80,0x94,0x33,0x0B,0x00,
+    0x0B,0x80,0x32,0x2B,0xB7,0x00,0x07,0x80,0x16,0x34,0x0D,0x00,0x0F,0x80,0x94,0x33,
+    0x0D,0x00,0x07,0x80,0x32,0x2B,0xBC,0x00,0x01,0x40,0x16,0x34,0x10,0x00,0x0F,0x80,
+    0x94,0x33,0x10,0x00,0x01,0x40,0x32,0x2B,0xD0,0x00,0x0F,0x80,0x94,0x33,0xE2,0x00,
+    0x0D,0x80,0x94,0x33,0xE3,0x00,0x0D,0x80,0x94,0x33,0xE4,0x00,0x0B,0x80,0x94,0x33,
+    0xE6,0x00,0x09,0x80,0x94,0x33,0xE9,0x00,0x05,0x80,0x94,0x33,0x95,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0xFA,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x9F,0x4D,0xE7,0x00,
+    0x0B,0x80,0x9F,0x4D,0xE5,0x00,0x0B,0x80,0x9F,0x4D,0xE4,0x00,0x0D,0x80,0x9F,0x4D,
+    0xE2,0x00,0x0F,0x80,0x9F,0x4D,0xE1,0x00,0x0F,0x80,0x9F,0x4D,0xCE,0x00,0x05,0x80,
+    0x3D,0x45,0x0E,0x00,0x0F,0x80,0x9F,0x4D,0x0E,0x00,0x05,0x80,0x27,0x11,0xB9,0x00,
+    0x09,0x80,0x3D,0x45,0x0C,0x00,0x0F,0x80,0x9F,0x4D,0x0C,0x00,0x09,0x80,0x27,0x11,
+    0xB6,0x00,0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0x0B,0x00,0x0B,0x80,
+    0x27,0x11,0xB4,0x00,0x0D,0x80,0x3D,0x45,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0x0A,0x00,
+    0x0D,0x80,0x27,0x11,0xB3,0x00,0x0D,0x80,0x3D,0x45,0x0B,0x00,0x0D,0x80,0x9F,0x4D,
+    0x0B,0x00,0x0D,0x80,0x27,0x11,0xB2,0x00,0x0F,0x80,0x3D,0x45,0x0A,0x00,0x0D,0x80,
+    0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x3D,0x45,0x0B,0x00,
+    0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x3D,0x45,
+    0x0C,0x00,0x09,0x80,0x9F,0x4D,0x0C,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,
+    0x3D,0x45,0x0E,0x00,0x05,0x80,0x9F,0x4D,0x0E,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,
+    0x0F,0x80,0x3D,0x45,0x21,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x3D,0x45,
+    0x21,0x00,0x0F,0x80,0x27,0x11,0xB2,0x00,0x0D,0x80,0x3D,0x45,0x23,0x00,0x0D,0x80,
+    0x27,0x11,0xB3,0x00,0x0D,0x80,0x3D,0x45,0x23,0x00,0x0D,0x80,0x27,0x11,0xB4,0x00,
+    0x0B,0x80,0x3D,0x45,0x25,0x00,0x0B,0x80,0x27,0x11,0xB7,0x00,0x07,0x80,0x3D,0x45,
+    0x29,0x00,0x07,0x80,0x27,0x11,0x77,0x03,0x08,0x80,0xDB,0x44,0x4B,0x00,0x08,0x80,
+    0xA9,0x11,0x94,0x00,0x0A,0x80,0xDB,0x44,0x49,0x00,0x0A,0x80,0xA9,0x11,0x92,0x00,
+    0x0C,0x80,0xDB,0x44,0x47,0x00,0x0C,0x80,0xA9,0x11,0x90,0x00,0x0E,0x80,0xDB,0x44,
+    0x45,0x00,0x0E,0x80,0xA9,0x11,0x8F,0x00,0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,
+    0xA9,0x11,0x8E,0x00,0x0F,0x80,0xDB,0x44,0x45,0x00,0x0F,0x80,0xA9,0x11,0x8D,0x00,
+    0x10,0x80,0xDB,0x44,0x43,0x00,0x10,0x80,0xA9,0x11,0x8D,0x00,0x10,0x80,0xDB,0x44,
+    0x43,0x00,0x10,0x80,0xA9,0x11,0x8D,0x00,0x10,0x80,0xDB,0x44,0x43,0x00,0x10,0x80,
+    0xA9,0x11,0x8E,0x00,0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,0xA9,0x11,0x8F,0x00,
+    0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,0xA9,0x11,0x90,0x00,0x0C,0x80,0xDB,0x44,
+    0x47,0x00,0x0C,0x80,0xA9,0x11,0x91,0x00,0x0C,0x80,0xDB,0x44,0x47,0x00,0x0C,0x80,
+    0xA9,0x11,0x92,0x00,0x09,0x80,0xDB,0x44,0x4B,0x00,0x09,0x80,0xA9,0x11,0x95,0x00,
+    0x06,0x80,0xDB,0x44,0x4D,0x00,0x06,0x80,0xA9,0x11,0x00,0x09,0x07,0x80,0x79,0x3C,
+    0x59,0x00,0x07,0x80,0x0B,0x1A,0x87,0x00,0x0B,0x80,0x79,0x3C,0x55,0x00,0x0B,0x80,
+    0x0B,0x1A,0x85,0x00,0x0B,0x80,0x79,0x3C,0x55,0x00,0x0B,0x80,0x0B,0x1A,0x84,0x00,
+    0x0D,0x80,0x79,0x3C,0x53,0x00,0x0D,0x80,0x0B,0x1A,0x82,0x00,0x0F,0x80,0x79,0x3C,
+    0x51,0x00,0x0F,0x80,0x0B,0x1A,0x81,0x00,0x0F,0x80,0x79,0x3C,0x51,0x00,0x0F,0x80,
+    0x0B,0x1A,0x81,0x00,0x0F,0x80,0x79,0x3C,0x51,0x00,0x0F,0x80,0x0B,0x1A,0x81,0x00,
+    0x0F,0x80,0x79,0x3C,0x51,0x00,0x0F,0x80,0x0B,0x1A,0x81,0x00,0x0F,0x80,0x79,0x3C,
+    0x51,0x00,0x0F,0x80,0x0B,0x1A,0x81,0x00,0x0F,0x80,0x79,0x3C,0x51,0x00,0x0F,0x80,
+    0x0B,0x1A,0x82,0x00,0x0D,0x80,0x79,0x3C,0x53,0x00,0x0D,0x80,0x0B,0x1A,0x83,0x00,
+    0x0D,0x80,0x79,0x3C,0x53,0x00,0x0D,0x80,0x0B,0x1A,0x84,0x00,0x0B,0x80,0x79,0x3C,
+    0x55,0x00,0x0B,0x80,0x0B,0x1A,0x86,0x00,0x09,0x80,0x79,0x3C,0x57,0x00,0x09,0x80,
+    0x0B,0x1A,0x89,0x00,0x05,0x80,0x79,0x3C,0x5B,0x00,0x05,0x80,0x0B,0x1A,0x00,0x09,
+    0x08,0x80,0x16,0x34,0x4B,0x00,0x08,0x80,0x6D,0x22,0x94,0x00,0x0A,0x80,0x16,0x34,
+    0x49,0x00,0x0A,0x80,0x6D,0x22,0x92,0x00,0x0C,0x80,0x16,0x34,0x47,0x00,0x0C,0x80,
+    0x6D,0x22,0x90,0x00,0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,0x6D,0x22,0x8F,0x00,
+    0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,0x6D,0x22,0x8E,0x00,0x0F,0x80,0x16,0x34,
+    0x45,0x00,0x0F,0x80,0x6D,0x22,0x8D,0x00,0x10,0x80,0x16,0x34,0x43,0x00,0x10,0x80,
+    0x6D,0x22,0x8D,0x00,0x10,0x80,0x16,0x34,0x43,0x00,0x10,0x80,0x6D,0x22,0x8D,0x00,
+    0x10,0x80,0x16,0x34,0x43,0x00,0x10,0x80,0x6D,0x22,0x8E,0x00,0x0E,0x80,0x16,0x34,
+    0x45,0x00,0x0E,0x80,0x6D,0x22,0x8F,0x00,0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,
+    0x6D,0x22,0x90,0x00,0x0C,0x80,0x16,0x34,0x47,0x00,0x0C,0x80,0x6D,0x22,0x91,0x00,
+    0x0C,0x80,0x16,0x34,0x47,0x00,0x0C,0x80,0x6D,0x22,0x92,0x00,0x09,0x80,0x16,0x34,
+    0x4B,0x00,0x09,0x80,0x6D,0x22,0x95,0x00,0x06,0x80,0x16,0x34,0x4D,0x00,0x06,0x80,
+    0x6D,0x22,0x89,0x02,0x05,0x80,0x94,0x33,0x2B,0x00,0x05,0x80,0xD0,0x22,0xB9,0x00,
+    0x09,0x80,0x94,0x33,0x27,0x00,0x09,0x80,0xD0,0x22,0xB6,0x00,0x0B,0x80,0x94,0x33,
+    0x25,0x00,0x0B,0x80,0xD0,0x22,0xB4,0x00,0x0D,0x80,0x94,0x33,0x23,0x00,0x0D,0x80,
+    0xD0,0x22,0xB3,0x00,0x0D,0x80,0x94,0x33,0x23,0x00,0x0D,0x80,0xD0,0x22,0xB2,0x00,
+    0x0F,0x80,0x94,0x33,0x21,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x94,0x33,
+    0x21,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x94,0x33,0x0D,0x00,0x07,0x80,
+    0x32,0x2B,0x0D,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x94,0x33,0x0B,0x00,
+    0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x94,0x33,
+    0x0B,0x00,0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,
+    0x94,0x33,0x0A,0x00,0x0D,0x80,0x32,0x2B,0x0A,0x00,0x0F,0x80,0xD0,0x22,0xB2,0x00,
+    0x0D,0x80,0x94,0x33,0x0A,0x00,0x0F,0x80,0x32,0x2B,0x0A,0x00,0x0D,0x80,0xD0,0x22,
+    0xB3,0x00,0x0D,0x80,0x94,0x33,0x0A,0x00,0x0F,0x80,0x32,0x2B,0x0A,0x00,0x0D,0x80,
+    0xD0,0x22,0xB4,0x00,0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x32,0x2B,0x0B,0x00,
+    0x0B,0x80,0xD0,0x22,0xB7,0x00,0x07,0x80,0x94,0x33,0x0D,0x00,0x0F,0x80,0x32,0x2B,
+    0x0D,0x00,0x07,0x80,0xD0,0x22,0xBC,0x00,0x01,0x40,0x94,0x33,0x10,0x00,0x0F,0x80,
+    0x32,0x2B,0x10,0x00,0x01,0x40,0xD0,0x22,0xD0,0x00,0x0F,0x80,0x32,0x2B,0xE2,0x00,
+    0x0D,0x80,0x32,0x2B,0xE3,0x00,0x0D,0x80,0x32,0x2B,0xE4,0x00,0x0B,0x80,0x32,0x2B,
+    0xE6,0x00,0x09,0x80,0x32,0x2B,0xE9,0x00,0x05,0x80,0x32,0x2B,0x9B,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0xF4,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x3D,0x45,0xE7,0x00,
+    0x0B,0x80,0x3D,0x45,0xE5,0x00,0x0B,0x80,0x3D,0x45,0xE4,0x00,0x0D,0x80,0x3D,0x45,
+    0xE2,0x00,0x0F,0x80,0x3D,0x45,0xE1,0x00,0x0F,0x80,0x3D,0x45,0xCE,0x00,0x05,0x80,
+    0xDB,0x44,0x0E,0x00,0x0F,0x80,0x3D,0x45,0x0E,0x00,0x05,0x80,0x9F,0x4D,0xB9,0x00,
+    0x09,0x80,0xDB,0x44,0x0C,0x00,0x0F,0x80,0x3D,0x45,0x0C,0x00,0x09,0x80,0x9F,0x4D,
+    0xB6,0x00,0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x3D,0x45,0x0B,0x00,0x0B,0x80,
+    0x9F,0x4D,0xB4,0x00,0x0D,0x80,0xDB,0x44,0x0A,0x00,0x0F,0x80,0x3D,0x45,0x0A,0x00,
+    0x0D,0x80,0x9F,0x4D,0xB3,0x00,0x0D,0x80,0xDB,0x44,0x0B,0x00,0x0D,0x80,0x3D,0x45,
+    0x0B,0x00,0x0D,0x80,0x9F,0x4D,0xB2,0x00,0x0F,0x80,0xDB,0x44,0x0A,0x00,0x0D,0x80,
+    0x3D,0x45,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xDB,0x44,0x0B,0x00,
+    0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xDB,0x44,
+    0x0C,0x00,0x09,0x80,0x3D,0x45,0x0C,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,
+    0xDB,0x44,0x0E,0x00,0x05,0x80,0x3D,0x45,0x0E,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,
+    0x0F,0x80,0xDB,0x44,0x21,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xDB,0x44,
+    0x21,0x00,0x0F,0x80,0x9F,0x4D,0xB2,0x00,0x0D,0x80,0xDB,0x44,0x23,0x00,0x0D,0x80,
+    0x9F,0x4D,0xB3,0x00,0x0D,0x80,0xDB,0x44,0x23,0x00,0x0D,0x80,0x9F,0x4D,0xB4,0x00,
+    0x0B,0x80,0xDB,0x44,0x25,0x00,0x0B,0x80,0x9F,0x4D,0xB7,0x00,0x07,0x80,0xDB,0x44,
+    0x29,0x00,0x07,0x80,0x9F,0x4D,0x77,0x03,0x08,0x80,0x79,0x3C,0x4B,0x00,0x08,0x80,
+    0x27,0x11,0x94,0x00,0x0A,0x80,0x79,0x3C,0x49,0x00,0x0A,0x80,0x27,0x11,0x92,0x00,
+    0x0C,0x80,0x79,0x3C,0x47,0x00,0x0C,0x80,0x27,0x11,0x90,0x00,0x0E,0x80,0x79,0x3C,
+    0x45,0x00,0x0E,0x80,0x27,0x11,0x8F,0x00,0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,
+    0x27,0x11,0x8E,0x00,0x0F,0x80,0x79,0x3C,0x45,0x00,0x0F,0x80,0x27,0x11,0x8D,0x00,
+    0x10,0x80,0x79,0x3C,0x43,0x00,0x10,0x80,0x27,0x11,0x8D,0x00,0x10,0x80,0x79,0x3C,
+    0x43,0x00,0x10,0x80,0x27,0x11,0x8D,0x00,0x10,0x80,0x79,0x3C,0x43,0x00,0x10,0x80,
+    0x27,0x11,0x8E,0x00,0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,0x27,0x11,0x8F,0x00,
+    0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,0x27,0x11,0x90,0x00,0x0C,0x80,0x79,0x3C,
+    0x47,0x00,0x0C,0x80,0x27,0x11,0x91,0x00,0x0C,0x80,0x79,0x3C,0x47,0x00,0x0C,0x80,
+    0x27,0x11,0x92,0x00,0x09,0x80,0x79,0x3C,0x4B,0x00,0x09,0x80,0x27,0x11,0x95,0x00,
+    0x06,0x80,0x79,0x3C,0x4D,0x00,0x06,0x80,0x27,0x11,0x00,0x09,0x07,0x80,0x16,0x34,
+    0x59,0x00,0x07,0x80,0xA9,0x11,0x87,0x00,0x0B,0x80,0x16,0x34,0x55,0x00,0x0B,0x80,
+    0xA9,0x11,0x85,0x00,0x0B,0x80,0x16,0x34,0x55,0x00,0x0B,0x80,0xA9,0x11,0x84,0x00,
+    0x0D,0x80,0x16,0x34,0x53,0x00,0x0D,0x80,0xA9,0x11,0x82,0x00,0x0F,0x80,0x16,0x34,
+    0x51,0x00,0x0F,0x80,0xA9,0x11,0x81,0x00,0x0F,0x80,0x16,0x34,0x51,0x00,0x0F,0x80,
+    0xA9,0x11,0x81,0x00,0x0F,0x80,0x16,0x34,0x51,0x00,0x0F,0x80,0xA9,0x11,0x81,0x00,
+    0x0F,0x80,0x16,0x34,0x51,0x00,0x0F,0x80,0xA9,0x11,0x81,0x00,0x0F,0x80,0x16,0x34,
+    0x51,0x00,0x0F,0x80,0xA9,0x11,0x81,0x00,0x0F,0x80,0x16,0x34,0x51,0x00,0x0F,0x80,
+    0xA9,0x11,0x82,0x00,0x0D,0x80,0x16,0x34,0x53,0x00,0x0D,0x80,0xA9,0x11,0x83,0x00,
+    0x0D,0x80,0x16,0x34,0x53,0x00,0x0D,0x80,0xA9,0x11,0x84,0x00,0x0B,0x80,0x16,0x34,
+    0x55,0x00,0x0B,0x80,0xA9,0x11,0x86,0x00,0x09,0x80,0x16,0x34,0x57,0x00,0x09,0x80,
+    0xA9,0x11,0x89,0x00,0x05,0x80,0x16,0x34,0x5B,0x00,0x05,0x80,0xA9,0x11,0x00,0x09,
+    0x08,0x80,0x94,0x33,0x4B,0x00,0x08,0x80,0x0B,0x1A,0x94,0x00,0x0A,0x80,0x94,0x33,
+    0x49,0x00,0x0A,0x80,0x0B,0x1A,0x92,0x00,0x0C,0x80,0x94,0x33,0x47,0x00,0x0C,0x80,
+    0x0B,0x1A,0x90,0x00,0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,0x0B,0x1A,0x8F,0x00,
+    0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,0x0B,0x1A,0x8E,0x00,0x0F,0x80,0x94,0x33,
+    0x45,0x00,0x0F,0x80,0x0B,0x1A,0x8D,0x00,0x10,0x80,0x94,0x33,0x43,0x00,0x10,0x80,
+    0x0B,0x1A,0x8D,0x00,0x10,0x80,0x94,0x33,0x43,0x00,0x10,0x80,0x0B,0x1A,0x8D,0x00,
+    0x10,0x80,0x94,0x33,0x43,0x00,0x10,0x80,0x0B,0x1A,0x8E,0x00,0x0E,0x80,0x94,0x33,
+    0x45,0x00,0x0E,0x80,0x0B,0x1A,0x8F,0x00,0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,
+    0x0B,0x1A,0x90,0x00,0x0C,0x80,0x94,0x33,0x47,0x00,0x0C,0x80,0x0B,0x1A,0x91,0x00,
+    0x0C,0x80,0x94,0x33,0x47,0x00,0x0C,0x80,0x0B,0x1A,0x92,0x00,0x09,0x80,0x94,0x33,
+    0x4B,0x00,0x09,0x80,0x0B,0x1A,0x95,0x00,0x06,0x80,0x94,0x33,0x4D,0x00,0x06,0x80,
+    0x0B,0x1A,0x89,0x02,0x05,0x80,0x32,0x2B,0x2B,0x00,0x05,0x80,0x6D,0x22,0xB9,0x00,
+    0x09,0x80,0x32,0x2B,0x27,0x00,0x09,0x80,0x6D,0x22,0xB6,0x00,0x0B,0x80,0x32,0x2B,
+    0x25,0x00,0x0B,0x80,0x6D,0x22,0xB4,0x00,0x0D,0x80,0x32,0x2B,0x23,0x00,0x0D,0x80,
+    0x6D,0x22,0xB3,0x00,0x0D,0x80,0x32,0x2B,0x23,0x00,0x0D,0x80,0x6D,0x22,0xB2,0x00,
+    0x0F,0x80,0x32,0x2B,0x21,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0x32,0x2B,
+    0x21,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0x32,0x2B,0x0D,0x00,0x07,0x80,
+    0xD0,0x22,0x0D,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0x32,0x2B,0x0B,0x00,
+    0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0x32,0x2B,
+    0x0B,0x00,0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,
+    0x32,0x2B,0x0A,0x00,0x0D,0x80,0xD0,0x22,0x0A,0x00,0x0F,0x80,0x6D,0x22,0xB2,0x00,
+    0x0D,0x80,0x32,0x2B,0x0A,0x00,0x0F,0x80,0xD0,0x22,0x0A,0x00,0x0D,0x80,0x6D,0x22,
+    0xB3,0x00,0x0D,0x80,0x32,0x2B,0x0A,0x00,0x0F,0x80,0xD0,0x22,0x0A,0x00,0x0D,0x80,
+    0x6D,0x22,0xB4,0x00,0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0xD0,0x22,0x0B,0x00,
+    0x0B,0x80,0x6D,0x22,0xB7,0x00,0x07,0x80,0x32,0x2B,0x0D,0x00,0x0F,0x80,0xD0,0x22,
+    0x0D,0x00,0x07,0x80,0x6D,0x22,0xBC,0x00,0x01,0x40,0x32,0x2B,0x10,0x00,0x0F,0x80,
+    0xD0,0x22,0x10,0x00,0x01,0x40,0x6D,0x22,0xD0,0x00,0x0F,0x80,0xD0,0x22,0xE2,0x00,
+    0x0D,0x80,0xD0,0x22,0xE3,0x00,0x0D,0x80,0xD0,0x22,0xE4,0x00,0x0B,0x80,0xD0,0x22,
+    0xE6,0x00,0x09,0x80,0xD0,0x22,0xE9,0x00,0x05,0x80,0xD0,0x22,0xA1,0x21,0x05,0x80,
+    0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,
+    0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,
+    0xEF,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0xDB,0x44,0xE7,0x00,
+    0x0B,0x80,0xDB,0x44,0xE5,0x00,0x0B,0x80,0xDB,0x44,0xE4,0x00,0x0D,0x80,0xDB,0x44,
+    0xE2,0x00,0x0F,0x80,0xDB,0x44,0xE1,0x00,0x0F,0x80,0xDB,0x44,0xCE,0x00,0x05,0x80,
+    0x79,0x3C,0x0E,0x00,0x0F,0x80,0xDB,0x44,0x0E,0x00,0x05,0x80,0x3D,0x45,0xB9,0x00,
+    0x09,0x80,0x79,0x3C,0x0C,0x00,0x0F,0x80,0xDB,0x44,0x0C,0x00,0x09,0x80,0x3D,0x45,
+    0xB6,0x00,0x0B,0x80,0x79,0x3C,0x0B,0x00,0x0F,0x80,0xDB,0x44,0x0B,0x00,0x0B,0x80,
+    0x3D,0x45,0xB4,0x00,0x0D,0x80,0x79,0x3C,0x0A,0x00,0x0F,0x80,0xDB,0x44,0x0A,0x00,
+    0x0D,0x80,0x3D,0x45,0xB3,0x00,0x0D,0x80,0x79,0x3C,0x0B,0x00,0x0D,0x80,0xDB,0x44,
+    0x0B,0x00,0x0D,0x80,0x3D,0x45,0xB2,0x00,0x0F,0x80,0x79,0x3C,0x0A,0x00,0x0D,0x80,
+    0xDB,0x44,0x0A,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x79,0x3C,0x0B,0x00,
+    0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x79,0x3C,
+    0x0C,0x00,0x09,0x80,0xDB,0x44,0x0C,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,
+    0x79,0x3C,0x0E,0x00,0x05,0x80,0xDB,0x44,0x0E,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,
+    0x0F,0x80,0x79,0x3C,0x21,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x79,0x3C,
+    0x21,0x00,0x0F,0x80,0x3D,0x45,0xB2,0x00,0x0D,0x80,0x79,0x3C,0x23,0x00,0x0D,0x80,
+    0x3D,0x45,0xB3,0x00,0x0D,0x80,0x79,0x3C,0x23,0x00,0x0D,0x80,0x3D,0x45,0xB4,0x00,
+    0x0B,0x80,0x79,0x3C,0x25,0x00,0x0B,0x80,0x3D,0x45,0xB7,0x00,0x07,0x80,0x79,0x3C,
+    0x29,0x00,0x07,0x80,0x3D,0x45,0x77,0x03,0x08,0x80,0x16,0x34,0x4B,0x00,0x08,0x80,
+    0x9F,0x4D,0x94,0x00,0x0A,0x80,0x16,0x34,0x49,0x00,0x0A,0x80,0x9F,0x4D,0x92,0x00,
+    0x0C,0x80,0x16,0x34,0x47,0x00,0x0C,0x80,0x9F,0x4D,0x90,0x00,0x0E,0x80,0x16,0x34,
+    0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8F,0x00,0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,
+    0x9F,0x4D,0x8E,0x00,0x0F,0x80,0x16,0x34,0x45,0x00,0x0F,0x80,0x9F,0x4D,0x8D,0x00,
+    0x10,0x80,0x16,0x34,0x43,0x00,0x10,0x80,0x9F,0x4D,0x8D,0x00,0x10,0x80,0x16,0x34,
+    0x43,0x00,0x10,0x80,0x9F,0x4D,0x8D,0x00,0x10,0x80,0x16,0x34,0x43,0x00,0x10,0x80,
+    0x9F,0x4D,0x8E,0x00,0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8F,0x00,
+    0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,0x9F,0x4D,0x90,0x00,0x0C,0x80,0x16,0x34,
+    0x47,0x00,0x0C,0x80,0x9F,0x4D,0x91,0x00,0x0C,0x80,0x16,0x34,0x47,0x00,0x0C,0x80,
+    0x9F,0x4D,0x92,0x00,0x09,0x80,0x16,0x34,0x4B,0x00,0x09,0x80,0x9F,0x4D,0x95,0x00,
+    0x06,0x80,0x16,0x34,0x4D,0x00,0x06,0x80,0x9F,0x4D,0x00,0x09,0x07,0x80,0x94,0x33,
+    0x59,0x00,0x07,0x80,0x27,0x11,0x87,0x00,0x0B,0x80,0x94,0x33,0x55,0x00,0x0B,0x80,
+    0x27,0x11,0x85,0x00,0x0B,0x80,0x94,0x33,0x55,0x00,0x0B,0x80,0x27,0x11,0x84,0x00,
+    0x0D,0x80,0x94,0x33,0x53,0x00,0x0D,0x80,0x27,0x11,0x82,0x00,0x0F,0x80,0x94,0x33,
+    0x51,0x00,0x0F,0x80,0x27,0x11,0x81,0x00,0x0F,0x80,0x94,0x33,0x51,0x00,0x0F,0x80,
+    0x27,0x11,0x81,0x00,0x0F,0x80,0x94,0x33,0x51,0x00,0x0F,0x80,0x27,0x11,0x81,0x00,
+    0x0F,0x80,0x94,0x33,0x51,0x00,0x0F,0x80,0x27,0x11,0x81,0x00,0x0F,0x80,0x94,0x33,
+    0x51,0x00,0x0F,0x80,0x27,0x11,0x81,0x00,0x0F,0x80,0x94,0x33,0x51,0x00,0x0F,0x80,
+    0x27,0x11,0x82,0x00,0x0D,0x80,0x94,0x33,0x53,0x00,0x0D,0x80,0x27,0x11,0x83,0x00,
+    0x0D,0x80,0x94,0x33,0x53,0x00,0x0D,0x80,0x27,0x11,0x84,0x00,0x0B,0x80,0x94,0x33,
+    0x55,0x00,0x0B,0x80,0x27,0x11,0x86,0x00,0x09,0x80,0x94,0x33,0x57,0x00,0x09,0x80,
+    0x27,0x11,0x89,0x00,0x05,0x80,0x94,0x33,0x5B,0x00,0x05,0x80,0x27,0x11,0x00,0x09,
+    0x08,0x80,0x32,0x2B,0x4B,0x00,0x08,0x80,0xA9,0x11,0x94,0x00,0x0A,0x80,0x32,0x2B,
+    0x49,0x00,0x0A,0x80,0xA9,0x11,0x92,0x00,0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,
+    0xA9,0x11,0x90,0x00,0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,0xA9,0x11,0x8F,0x00,
+    0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,0xA9,0x11,0x8E,0x00,0x0F,0x80,0x32,0x2B,
+    0x45,0x00,0x0F,0x80,0xA9,0x11,0x8D,0x00,0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,
+    0xA9,0x11,0x8D,0x00,0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,0xA9,0x11,0x8D,0x00,
+    0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,0xA9,0x11,0x8E,0x00,0x0E,0x80,0x32,0x2B,
+    0x45,0x00,0x0E,0x80,0xA9,0x11,0x8F,0x00,0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,
+    0xA9,0x11,0x90,0x00,0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,0xA9,0x11,0x91,0x00,
+    0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,0xA9,0x11,0x92,0x00,0x09,0x80,0x32,0x2B,
+    0x4B,0x00,0x09,0x80,0xA9,0x11,0x95,0x00,0x06,0x80,0x32,0x2B,0x4D,0x00,0x06,0x80,
+    0xA9,0x11,0x89,0x02,0x05,0x80,0xD0,0x22,0x2B,0x00,0x05,0x80,0x0B,0x1A,0xB9,0x00,
+    0x09,0x80,0xD0,0x22,0x27,0x00,0x09,0x80,0x0B,0x1A,0xB6,0x00,0x0B,0x80,0xD0,0x22,
+    0x25,0x00,0x0B,0x80,0x0B,0x1A,0xB4,0x00,0x0D,0x80,0xD0,0x22,0x23,0x00,0x0D,0x80,
+    0x0B,0x1A,0xB3,0x00,0x0D,0x80,0xD0,0x22,0x23,0x00,0x0D,0x80,0x0B,0x1A,0xB2,0x00,
+    0x0F,0x80,0xD0,0x22,0x21,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0xD0,0x22,
+    0x21,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0xD0,0x22,0x0D,0x00,0x07,0x80,
+    0x6D,0x22,0x0D,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0xD0,0x22,0x0B,0x00,
+    0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0xD0,0x22,
+    0x0B,0x00,0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,
+    0xD0,0x22,0x0A,0x00,0x0D,0x80,0x6D,0x22,0x0A,0x00,0x0F,0x80,0x0B,0x1A,0xB2,0x00,
+    0x0D,0x80,0xD0,0x22,0x0A,0x00,0x0F,0x80,0x6D,0x22,0x0A,0x00,0x0D,0x80,0x0B,0x1A,
+    0xB3,0x00,0x0D,0x80,0xD0,0x22,0x0A,0x00,0x0F,0x80,0x6D,0x22,0x0A,0x00,0x0D,0x80,
+    0x0B,0x1A,0xB4,0x00,0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x6D,0x22,0x0B,0x00,
+    0x0B,0x80,0x0B,0x1A,0xB7,0x00,0x07,0x80,0xD0,0x22,0x0D,0x00,0x0F,0x80,0x6D,0x22,
+    0x0D,0x00,0x07,0x80,0x0B,0x1A,0xBC,0x00,0x01,0x40,0xD0,0x22,0x10,0x00,0x0F,0x80,
+    0x6D,0x22,0x10,0x00,0x01,0x40,0x0B,0x1A,0xD0,0x00,0x0F,0x80,0x6D,0x22,0xE2,0x00,
+    0x0D,0x80,0x6D,0x22,0xE3,0x00,0x0D,0x80,0x6D,0x22,0xE4,0x00,0x0B,0x80,0x6D,0x22,
+    0xE6,0x00,0x09,0x80,0x6D,0x22,0xE9,0x00,0x05,0x80,0x6D,0x22,0xA6,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0xE9,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x79,0x3C,0xE7,0x00,
+    0x0B,0x80,0x79,0x3C,0xE5,0x00,0x0B,0x80,0x79,0x3C,0xE4,0x00,0x0D,0x80,0x79,0x3C,
+    0xE2,0x00,0x0F,0x80,0x79,0x3C,0xE1,0x00,0x0F,0x80,0x79,0x3C,0xCE,0x00,0x05,0x80,
+    0x16,0x34,0x0E,0x00,0x0F,0x80,0x79,0x3C,0x0E,0x00,0x05,0x80,0xDB,0x44,0xB9,0x00,
+    0x09,0x80,0x16,0x34,0x0C,0x00,0x0F,0x80,0x79,0x3C,0x0C,0x00,0x09,0x80,0xDB,0x44,
+    0xB6,0x00,0x0B,0x80,0x16,0x34,0x0B,0x00,0x0F,0x80,0x79,0x3C,0x0B,0x00,0x0B,0x80,
+    0xDB,0x44,0xB4,0x00,0x0D,0x80,0x16,0x34,0x0A,0x00,0x0F,0x80,0x79,0x3C,0x0A,0x00,
+    0x0D,0x80,0xDB,0x44,0xB3,0x00,0x0D,0x80,0x16,0x34,0x0B,0x00,0x0D,0x80,0x79,0x3C,
+    0x0B,0x00,0x0D,0x80,0xDB,0x44,0xB2,0x00,0x0F,0x80,0x16,0x34,0x0A,0x00,0x0D,0x80,
+    0x79,0x3C,0x0A,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x16,0x34,0x0B,0x00,
+    0x0B,0x80,0x79,0x3C,0x0B,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x16,0x34,
+    0x0C,0x00,0x09,0x80,0x79,0x3C,0x0C,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,
+    0x16,0x34,0x0E,0x00,0x05,0x80,0x79,0x3C,0x0E,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,
+    0x0F,0x80,0x16,0x34,0x21,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x16,0x34,
+    0x21,0x00,0x0F,0x80,0xDB,0x44,0xB2,0x00,0x0D,0x80,0x16,0x34,0x23,0x00,0x0D,0x80,
+    0xDB,0x44,0xB3,0x00,0x0D,0x80,0x16,0x34,0x23,0x00,0x0D,0x80,0xDB,0x44,0xB4,0x00,
+    0x0B,0x80,0x16,0x34,0x25,0x00,0x0B,0x80,0xDB,0x44,0xB7,0x00,0x07,0x80,0x16,0x34,
+    0x29,0x00,0x07,0x80,0xDB,0x44,0x77,0x03,0x08,0x80,0x94,0x33,0x4B,0x00,0x08,0x80,
+    0x3D,0x45,0x94,0x00,0x0A,0x80,0x94,0x33,0x49,0x00,0x0A,0x80,0x3D,0x45,0x92,0x00,
+    0x0C,0x80,0x94,0x33,0x47,0x00,0x0C,0x80,0x3D,0x45,0x90,0x00,0x0E,0x80,0x94,0x33,
+    0x45,0x00,0x0E,0x80,0x3D,0x45,0x8F,0x00,0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,
+    0x3D,0x45,0x8E,0x00,0x0F,0x80,0x94,0x33,0x45,0x00,0x0F,0x80,0x3D,0x45,0x8D,0x00,
+    0x10,0x80,0x94,0x33,0x43,0x00,0x10,0x80,0x3D,0x45,0x8D,0x00,0x10,0x80,0x94,0x33,
+    0x43,0x00,0x10,0x80,0x3D,0x45,0x8D,0x00,0x10,0x80,0x94,0x33,0x43,0x00,0x10,0x80,
+    0x3D,0x45,0x8E,0x00,0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,0x3D,0x45,0x8F,0x00,
+    0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,0x3D,0x45,0x90,0x00,0x0C,0x80,0x94,0x33,
+    0x47,0x00,0x0C,0x80,0x3D,0x45,0x91,0x00,0x0C,0x80,0x94,0x33,0x47,0x00,0x0C,0x80,
+    0x3D,0x45,0x92,0x00,0x09,0x80,0x94,0x33,0x4B,0x00,0x09,0x80,0x3D,0x45,0x95,0x00,
+    0x06,0x80,0x94,0x33,0x4D,0x00,0x06,0x80,0x3D,0x45,0x00,0x09,0x07,0x80,0x32,0x2B,
+    0x59,0x00,0x07,0x80,0x9F,0x4D,0x87,0x00,0x0B,0x80,0x32,0x2B,0x55,0x00,0x0B,0x80,
+    0x9F,0x4D,0x85,0x00,0x0B,0x80,0x32,0x2B,0x55,0x00,0x0B,0x80,0x9F,0x4D,0x84,0x00,
+    0x0D,0x80,0x32,0x2B,0x53,0x00,0x0D,0x80,0x9F,0x4D,0x82,0x00,0x0F,0x80,0x32,0x2B,
+    0x51,0x00,0x0F,0x80,0x9F,0x4D,0x81,0x00,0x0F,0x80,0x32,0x2B,0x51,0x00,0x0F,0x80,
+    0x9F,0x4D,0x81,0x00,0x0F,0x80,0x32,0x2B,0x51,0x00,0x0F,0x80,0x9F,0x4D,0x81,0x00,
+    0x0F,0x80,0x32,0x2B,0x51,0x00,0x0F,0x80,0x9F,0x4D,0x81,0x00,0x0F,0x80,0x32,0x2B,
+    0x51,0x00,0x0F,0x80,0x9F,0x4D,0x81,0x00,0x0F,0x80,0x32,0x2B,0x51,0x00,0x0F,0x80,
+    0x9F,0x4D,0x82,0x00,0x0D,0x80,0x32,0x2B,0x53,0x00,0x0D,0x80,0x9F,0x4D,0x83,0x00,
+    0x0D,0x80,0x32,0x2B,0x53,0x00,0x0D,0x80,0x9F,0x4D,0x84,0x00,0x0B,0x80,0x32,0x2B,
+    0x55,0x00,0x0B,0x80,0x9F,0x4D,0x86,0x00,0x09,0x80,0x32,0x2B,0x57,0x00,0x09,0x80,
+    0x9F,0x4D,0x89,0x00,0x05,0x80,0x32,0x2B,0x5B,0x00,0x05,0x80,0x9F,0x4D,0x00,0x09,
+    0x08,0x80,0xD0,0x22,0x4B,0x00,0x08,0x80,0x27,0x11,0x94,0x00,0x0A,0x80,0xD0,0x22,
+    0x49,0x00,0x0A,0x80,0x27,0x11,0x92,0x00,0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,
+    0x27,0x11,0x90,0x00,0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,0x27,0x11,0x8F,0x00,
+    0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,0x27,0x11,0x8E,0x00,0x0F,0x80,0xD0,0x22,
+    0x45,0x00,0x0F,0x80,0x27,0x11,0x8D,0x00,0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,
+    0x27,0x11,0x8D,0x00,0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,0x27,0x11,0x8D,0x00,
+    0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,0x27,0x11,0x8E,0x00,0x0E,0x80,0xD0,0x22,
+    0x45,0x00,0x0E,0x80,0x27,0x11,0x8F,0x00,0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,
+    0x27,0x11,0x90,0x00,0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,0x27,0x11,0x91,0x00,
+    0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,0x27,0x11,0x92,0x00,0x09,0x80,0xD0,0x22,
+    0x4B,0x00,0x09,0x80,0x27,0x11,0x95,0x00,0x06,0x80,0xD0,0x22,0x4D,0x00,0x06,0x80,
+    0x27,0x11,0x89,0x02,0x05,0x80,0x6D,0x22,0x2B,0x00,0x05,0x80,0xA9,0x11,0xB9,0x00,
+    0x09,0x80,0x6D,0x22,0x27,0x00,0x09,0x80,0xA9,0x11,0xB6,0x00,0x0B,0x80,0x6D,0x22,
+    0x25,0x00,0x0B,0x80,0xA9,0x11,0xB4,0x00,0x0D,0x80,0x6D,0x22,0x23,0x00,0x0D,0x80,
+    0xA9,0x11,0xB3,0x00,0x0D,0x80,0x6D,0x22,0x23,0x00,0x0D,0x80,0xA9,0x11,0xB2,0x00,
+    0x0F,0x80,0x6D,0x22,0x21,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x6D,0x22,
+    0x21,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x6D,0x22,0x0D,0x00,0x07,0x80,
+    0x0B,0x1A,0x0D,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x6D,0x22,0x0B,0x00,
+    0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x6D,0x22,
+    0x0B,0x00,0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,
+    0x6D,0x22,0x0A,0x00,0x0D,0x80,0x0B,0x1A,0x0A,0x00,0x0F,0x80,0xA9,0x11,0xB2,0x00,
+    0x0D,0x80,0x6D,0x22,0x0A,0x00,0x0F,0x80,0x0B,0x1A,0x0A,0x00,0x0D,0x80,0xA9,0x11,
+    0xB3,0x00,0x0D,0x80,0x6D,0x22,0x0A,0x00,0x0F,0x80,0x0B,0x1A,0x0A,0x00,0x0D,0x80,
+    0xA9,0x11,0xB4,0x00,0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0x0B,0x1A,0x0B,0x00,
+    0x0B,0x80,0xA9,0x11,0xB7,0x00,0x07,0x80,0x6D,0x22,0x0D,0x00,0x0F,0x80,0x0B,0x1A,
+    0x0D,0x00,0x07,0x80,0xA9,0x11,0xBC,0x00,0x01,0x40,0x6D,0x22,0x10,0x00,0x0F,0x80,
+    0x0B,0x1A,0x10,0x00,0x01,0x40,0xA9,0x11,0xD0,0x00,0x0F,0x80,0x0B,0x1A,0xE2,0x00,
+    0x0D,0x80,0x0B,0x1A,0xE3,0x00,0x0D,0x80,0x0B,0x1A,0xE4,0x00,0x0B,0x80,0x0B,0x1A,
+    0xE6,0x00,0x09,0x80,0x0B,0x1A,0xE9,0x00,0x05,0x80,0x0B,0x1A,0xAC,0x21,0x05,0x80,
+    0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,
+    0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,
+    0xE4,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x16,0x34,0xE7,0x00,
+    0x0B,0x80,0x16,0x34,0xE5,0x00,0x0B,0x80,0x16,0x34,0xE4,0x00,0x0D,0x80,0x16,0x34,
+    0xE2,0x00,0x0F,0x80,0x16,0x34,0xE1,0x00,0x0F,0x80,0x16,0x34,0xCE,0x00,0x05,0x80,
+    0x94,0x33,0x0E,0x00,0x0F,0x80,0x16,0x34,0x0E,0x00,0x05,0x80,0x79,0x3C,0xB9,0x00,
+    0x09,0x80,0x94,0x33,0x0C,0x00,0x0F,0x80,0x16,0x34,0x0C,0x00,0x09,0x80,0x79,0x3C,
+    0xB6,0x00,0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x16,0x34,0x0B,0x00,0x0B,0x80,
+    0x79,0x3C,0xB4,0x00,0x0D,0x80,0x94,0x33,0x0A,0x00,0x0F,0x80,0x16,0x34,0x0A,0x00,
+    0x0D,0x80,0x79,0x3C,0xB3,0x00,0x0D,0x80,0x94,0x33,0x0B,0x00,0x0D,0x80,0x16,0x34,
+    0x0B,0x00,0x0D,0x80,0x79,0x3C,0xB2,0x00,0x0F,0x80,0x94,0x33,0x0A,0x00,0x0D,0x80,
+    0x16,0x34,0x0A,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x94,0x33,0x0B,0x00,
+    0x0B,0x80,0x16,0x34,0x0B,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x94,0x33,
+    0x0C,0x00,0x09,0x80,0x16,0x34,0x0C,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,
+    0x94,0x33,0x0E,0x00,0x05,0x80,0x16,0x34,0x0E,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,
+    0x0F,0x80,0x94,0x33,0x21,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x94,0x33,
+    0x21,0x00,0x0F,0x80,0x79,0x3C,0xB2,0x00,0x0D,0x80,0x94,0x33,0x23,0x00,0x0D,0x80,
+    0x79,0x3C,0xB3,0x00,0x0D,0x80,0x94,0x33,0x23,0x00,0x0D,0x80,0x79,0x3C,0xB4,0x00,
+    0x0B,0x80,0x94,0x33,0x25,0x00,0x0B,0x80,0x79,0x3C,0xB7,0x00,0x07,0x80,0x94,0x33,
+    0x29,0x00,0x07,0x80,0x79,0x3C,0x77,0x03,0x08,0x80,0x32,0x2B,0x4B,0x00,0x08,0x80,
+    0xDB,0x44,0x94,0x00,0x0A,0x80,0x32,0x2B,0x49,0x00,0x0A,0x80,0xDB,0x44,0x92,0x00,
+    0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,0xDB,0x44,0x90,0x00,0x0E,0x80,0x32,0x2B,
+    0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,
+    0xDB,0x44,0x8E,0x00,0x0F,0x80,0x32,0x2B,0x45,0x00,0x0F,0x80,0xDB,0x44,0x8D,0x00,
+    0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,0xDB,0x44,0x8D,0x00,0x10,0x80,0x32,0x2B,
+    0x43,0x00,0x10,0x80,0xDB,0x44,0x8D,0x00,0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,
+    0xDB,0x44,0x8E,0x00,0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,
+    0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,0xDB,0x44,0x90,0x00,0x0C,0x80,0x32,0x2B,
+    0x47,0x00,0x0C,0x80,0xDB,0x44,0x91,0x00,0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,
+    0xDB,0x44,0x92,0x00,0x09,0x80,0x32,0x2B,0x4B,0x00,0x09,0x80,0xDB,0x44,0x95,0x00,
+    0x06,0x80,0x32,0x2B,0x4D,0x00,0x06,0x80,0xDB,0x44,0x00,0x09,0x07,0x80,0xD0,0x22,
+    0x59,0x00,0x07,0x80,0x3D,0x45,0x87,0x00,0x0B,0x80,0xD0,0x22,0x55,0x00,0x0B,0x80,
+    0x3D,0x45,0x85,0x00,0x0B,0x80,0xD0,0x22,0x55,0x00,0x0B,0x80,0x3D,0x45,0x84,0x00,
+    0x0D,0x80,0xD0,0x22,0x53,0x00,0x0D,0x80,0x3D,0x45,0x82,0x00,0x0F,0x80,0xD0,0x22,
+    0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,
+    0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,
+    0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,
+    0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,
+    0x3D,0x45,0x82,0x00,0x0D,0x80,0xD0,0x22,0x53,0x00,0x0D,0x80,0x3D,0x45,0x83,0x00,
+    0x0D,0x80,0xD0,0x22,0x53,0x00,0x0D,0x80,0x3D,0x45,0x84,0x00,0x0B,0x80,0xD0,0x22,
+    0x55,0x00,0x0B,0x80,0x3D,0x45,0x86,0x00,0x09,0x80,0xD0,0x22,0x57,0x00,0x09,0x80,
+    0x3D,0x45,0x89,0x00,0x05,0x80,0xD0,0x22,0x5B,0x00,0x05,0x80,0x3D,0x45,0x00,0x09,
+    0x08,0x80,0x6D,0x22,0x4B,0x00,0x08,0x80,0x9F,0x4D,0x94,0x00,0x0A,0x80,0x6D,0x22,
+    0x49,0x00,0x0A,0x80,0x9F,0x4D,0x92,0x00,0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,
+    0x9F,0x4D,0x90,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8F,0x00,
+    0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8E,0x00,0x0F,0x80,0x6D,0x22,
+    0x45,0x00,0x0F,0x80,0x9F,0x4D,0x8D,0x00,0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,
+    0x9F,0x4D,0x8D,0x00,0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,0x9F,0x4D,0x8D,0x00,
+    0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,0x9F,0x4D,0x8E,0x00,0x0E,0x80,0x6D,0x22,
+    0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8F,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,
+    0x9F,0x4D,0x90,0x00,0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,0x9F,0x4D,0x91,0x00,
+    0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,0x9F,0x4D,0x92,0x00,0x09,0x80,0x6D,0x22,
+    0x4B,0x00,0x09,0x80,0x9F,0x4D,0x95,0x00,0x06,0x80,0x6D,0x22,0x4D,0x00,0x06,0x80,
+    0x9F,0x4D,0x89,0x02,0x05,0x80,0x0B,0x1A,0x2B,0x00,0x05,0x80,0x27,0x11,0xB9,0x00,
+    0x09,0x80,0x0B,0x1A,0x27,0x00,0x09,0x80,0x27,0x11,0xB6,0x00,0x0B,0x80,0x0B,0x1A,
+    0x25,0x00,0x0B,0x80,0x27,0x11,0xB4,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,
+    0x27,0x11,0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,0x27,0x11,0xB2,0x00,
+    0x0F,0x80,0x0B,0x1A,0x21,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x21,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,0x0D,0x00,0x07,0x80,
+    0xA9,0x11,0x0D,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,0x0B,0x00,
+    0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x0B,0x00,0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,
+    0x0B,0x1A,0x0A,0x00,0x0D,0x80,0xA9,0x11,0x0A,0x00,0x0F,0x80,0x27,0x11,0xB2,0x00,
+    0x0D,0x80,0x0B,0x1A,0x0A,0x00,0x0F,0x80,0xA9,0x11,0x0A,0x00,0x0D,0x80,0x27,0x11,
+    0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x0A,0x00,0x0F,0x80,0xA9,0x11,0x0A,0x00,0x0D,0x80,
+    0x27,0x11,0xB4,0x00,0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0xA9,0x11,0x0B,0x00,
+    0x0B,0x80,0x27,0x11,0xB7,0x00,0x07,0x80,0x0B,0x1A,0x0D,0x00,0x0F,0x80,0xA9,0x11,
+    0x0D,0x00,0x07,0x80,0x27,0x11,0xBC,0x00,0x01,0x40,0x0B,0x1A,0x10,0x00,0x0F,0x80,
+    0xA9,0x11,0x10,0x00,0x01,0x40,0x27,0x11,0xD0,0x00,0x0F,0x80,0xA9,0x11,0xE2,0x00,
+    0x0D,0x80,0xA9,0x11,0xE3,0x00,0x0D,0x80,0xA9,0x11,0xE4,0x00,0x0B,0x80,0xA9,0x11,
+    0xE6,0x00,0x09,0x80,0xA9,0x11,0xE9,0x00,0x05,0x80,0xA9,0x11,0xB1,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0xDE,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x94,0x33,0xE7,0x00,
+    0x0B,0x80,0x94,0x33,0xE5,0x00,0x0B,0x80,0x94,0x33,0xE4,0x00,0x0D,0x80,0x94,0x33,
+    0xE2,0x00,0x0F,0x80,0x94,0x33,0xE1,0x00,0x0F,0x80,0x94,0x33,0xCE,0x00,0x05,0x80,
+    0x32,0x2B,0x0E,0x00,0x0F,0x80,0x94,0x33,0x0E,0x00,0x05,0x80,0x16,0x34,0xB9,0x00,
+    0x09,0x80,0x32,0x2B,0x0C,0x00,0x0F,0x80,0x94,0x33,0x0C,0x00,0x09,0x80,0x16,0x34,
+    0xB6,0x00,0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0x94,0x33,0x0B,0x00,0x0B,0x80,
+    0x16,0x34,0xB4,0x00,0x0D,0x80,0x32,0x2B,0x0A,0x00,0x0F,0x80,0x94,0x33,0x0A,0x00,
+    0x0D,0x80,0x16,0x34,0xB3,0x00,0x0D,0x80,0x32,0x2B,0x0B,0x00,0x0D,0x80,0x94,0x33,
+    0x0B,0x00,0x0D,0x80,0x16,0x34,0xB2,0x00,0x0F,0x80,0x32,0x2B,0x0A,0x00,0x0D,0x80,
+    0x94,0x33,0x0A,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0x32,0x2B,0x0B,0x00,
+    0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0x32,0x2B,
+    0x0C,0x00,0x09,0x80,0x94,0x33,0x0C,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,
+    0x32,0x2B,0x0E,0x00,0x05,0x80,0x94,0x33,0x0E,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,
+    0x0F,0x80,0x32,0x2B,0x21,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0x32,0x2B,
+    0x21,0x00,0x0F,0x80,0x16,0x34,0xB2,0x00,0x0D,0x80,0x32,0x2B,0x23,0x00,0x0D,0x80,
+    0x16,0x34,0xB3,0x00,0x0D,0x80,0x32,0x2B,0x23,0x00,0x0D,0x80,0x16,0x34,0xB4,0x00,
+    0x0B,0x80,0x32,0x2B,0x25,0x00,0x0B,0x80,0x16,0x34,0xB7,0x00,0x07,0x80,0x32,0x2B,
+    0x29,0x00,0x07,0x80,0x16,0x34,0x77,0x03,0x08,0x80,0xD0,0x22,0x4B,0x00,0x08,0x80,
+    0x79,0x3C,0x94,0x00,0x0A,0x80,0xD0,0x22,0x49,0x00,0x0A,0x80,0x79,0x3C,0x92,0x00,
+    0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,0x79,0x3C,0x90,0x00,0x0E,0x80,0xD0,0x22,
+    0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,
+    0x79,0x3C,0x8E,0x00,0x0F,0x80,0xD0,0x22,0x45,0x00,0x0F,0x80,0x79,0x3C,0x8D,0x00,
+    0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,0x79,0x3C,0x8D,0x00,0x10,0x80,0xD0,0x22,
+    0x43,0x00,0x10,0x80,0x79,0x3C,0x8D,0x00,0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,
+    0x79,0x3C,0x8E,0x00,0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,
+    0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,0x79,0x3C,0x90,0x00,0x0C,0x80,0xD0,0x22,
+    0x47,0x00,0x0C,0x80,0x79,0x3C,0x91,0x00,0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,
+    0x79,0x3C,0x92,0x00,0x09,0x80,0xD0,0x22,0x4B,0x00,0x09,0x80,0x79,0x3C,0x95,0x00,
+    0x06,0x80,0xD0,0x22,0x4D,0x00,0x06,0x80,0x79,0x3C,0x00,0x09,0x07,0x80,0x6D,0x22,
+    0x59,0x00,0x07,0x80,0xDB,0x44,0x87,0x00,0x0B,0x80,0x6D,0x22,0x55,0x00,0x0B,0x80,
+    0xDB,0x44,0x85,0x00,0x0B,0x80,0x6D,0x22,0x55,0x00,0x0B,0x80,0xDB,0x44,0x84,0x00,
+    0x0D,0x80,0x6D,0x22,0x53,0x00,0x0D,0x80,0xDB,0x44,0x82,0x00,0x0F,0x80,0x6D,0x22,
+    0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,
+    0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,
+    0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,
+    0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,
+    0xDB,0x44,0x82,0x00,0x0D,0x80,0x6D,0x22,0x53,0x00,0x0D,0x80,0xDB,0x44,0x83,0x00,
+    0x0D,0x80,0x6D,0x22,0x53,0x00,0x0D,0x80,0xDB,0x44,0x84,0x00,0x0B,0x80,0x6D,0x22,
+    0x55,0x00,0x0B,0x80,0xDB,0x44,0x86,0x00,0x09,0x80,0x6D,0x22,0x57,0x00,0x09,0x80,
+    0xDB,0x44,0x89,0x00,0x05,0x80,0x6D,0x22,0x5B,0x00,0x05,0x80,0xDB,0x44,0x00,0x09,
+    0x08,0x80,0x0B,0x1A,0x4B,0x00,0x08,0x80,0x3D,0x45,0x94,0x00,0x0A,0x80,0x0B,0x1A,
+    0x49,0x00,0x0A,0x80,0x3D,0x45,0x92,0x00,0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,
+    0x3D,0x45,0x90,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x3D,0x45,0x8F,0x00,
+    0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x3D,0x45,0x8E,0x00,0x0F,0x80,0x0B,0x1A,
+    0x45,0x00,0x0F,0x80,0x3D,0x45,0x8D,0x00,0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,
+    0x3D,0x45,0x8D,0x00,0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,0x3D,0x45,0x8D,0x00,
+    0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,0x3D,0x45,0x8E,0x00,0x0E,0x80,0x0B,0x1A,
+    0x45,0x00,0x0E,0x80,0x3D,0x45,0x8F,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,
+    0x3D,0x45,0x90,0x00,0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,0x3D,0x45,0x91,0x00,
+    0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,0x3D,0x45,0x92,0x00,0x09,0x80,0x0B,0x1A,
+    0x4B,0x00,0x09,0x80,0x3D,0x45,0x95,0x00,0x06,0x80,0x0B,0x1A,0x4D,0x00,0x06,0x80,
+    0x3D,0x45,0x89,0x02,0x05,0x80,0xA9,0x11,0x2B,0x00,0x05,0x80,0x9F,0x4D,0xB9,0x00,
+    0x09,0x80,0xA9,0x11,0x27,0x00,0x09,0x80,0x9F,0x4D,0xB6,0x00,0x0B,0x80,0xA9,0x11,
+    0x25,0x00,0x0B,0x80,0x9F,0x4D,0xB4,0x00,0x0D,0x80,0xA9,0x11,0x23,0x00,0x0D,0x80,
+    0x9F,0x4D,0xB3,0x00,0x0D,0x80,0xA9,0x11,0x23,0x00,0x0D,0x80,0x9F,0x4D,0xB2,0x00,
+    0x0F,0x80,0xA9,0x11,0x21,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,
+    0x21,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,0x0D,0x00,0x07,0x80,
+    0x27,0x11,0x0D,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,0x0B,0x00,
+    0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,
+    0x0B,0x00,0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,
+    0xA9,0x11,0x0A,0x00,0x0D,0x80,0x27,0x11,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0xB2,0x00,
+    0x0D,0x80,0xA9,0x11,0x0A,0x00,0x0F,0x80,0x27,0x11,0x0A,0x00,0x0D,0x80,0x9F,0x4D,
+    0xB3,0x00,0x0D,0x80,0xA9,0x11,0x0A,0x00,0x0F,0x80,0x27,0x11,0x0A,0x00,0x0D,0x80,
+    0x9F,0x4D,0xB4,0x00,0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x27,0x11,0x0B,0x00,
+    0x0B,0x80,0x9F,0x4D,0xB7,0x00,0x07,0x80,0xA9,0x11,0x0D,0x00,0x0F,0x80,0x27,0x11,
+    0x0D,0x00,0x07,0x80,0x9F,0x4D,0xBC,0x00,0x01,0x40,0xA9,0x11,0x10,0x00,0x0F,0x80,
+    0x27,0x11,0x10,0x00,0x01,0x40,0x9F,0x4D,0xD0,0x00,0x0F,0x80,0x27,0x11,0xE2,0x00,
+    0x0D,0x80,0x27,0x11,0xE3,0x00,0x0D,0x80,0x27,0x11,0xE4,0x00,0x0B,0x80,0x27,0x11,
+    0xE6,0x00,0x09,0x80,0x27,0x11,0xE9,0x00,0x05,0x80,0x27,0x11,0xB7,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0xD8,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x32,0x2B,0xE7,0x00,
+    0x0B,0x80,0x32,0x2B,0xE5,0x00,0x0B,0x80,0x32,0x2B,0xE4,0x00,0x0D,0x80,0x32,0x2B,
+    0xE2,0x00,0x0F,0x80,0x32,0x2B,0xE1,0x00,0x0F,0x80,0x32,0x2B,0xCE,0x00,0x05,0x80,
+    0xD0,0x22,0x0E,0x00,0x0F,0x80,0x32,0x2B,0x0E,0x00,0x05,0x80,0x94,0x33,0xB9,0x00,
+    0x09,0x80,0xD0,0x22,0x0C,0x00,0x0F,0x80,0x32,0x2B,0x0C,0x00,0x09,0x80,0x94,0x33,
+    0xB6,0x00,0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x32,0x2B,0x0B,0x00,0x0B,0x80,
+    0x94,0x33,0xB4,0x00,0x0D,0x80,0xD0,0x22,0x0A,0x00,0x0F,0x80,0x32,0x2B,0x0A,0x00,
+    0x0D,0x80,0x94,0x33,0xB3,0x00,0x0D,0x80,0xD0,0x22,0x0B,0x00,0x0D,0x80,0x32,0x2B,
+    0x0B,0x00,0x0D,0x80,0x94,0x33,0xB2,0x00,0x0F,0x80,0xD0,0x22,0x0A,0x00,0x0D,0x80,
+    0x32,0x2B,0x0A,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0xD0,0x22,0x0B,0x00,
+    0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0xD0,0x22,
+    0x0C,0x00,0x09,0x80,0x32,0x2B,0x0C,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,
+    0xD0,0x22,0x0E,0x00,0x05,0x80,0x32,0x2B,0x0E,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,
+    0x0F,0x80,0xD0,0x22,0x21,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0xD0,0x22,
+    0x21,0x00,0x0F,0x80,0x94,0x33,0xB2,0x00,0x0D,0x80,0xD0,0x22,0x23,0x00,0x0D,0x80,
+    0x94,0x33,0xB3,0x00,0x0D,0x80,0xD0,0x22,0x23,0x00,0x0D,0x80,0x94,0x33,0xB4,0x00,
+    0x0B,0x80,0xD0,0x22,0x25,0x00,0x0B,0x80,0x94,0x33,0xB7,0x00,0x07,0x80,0xD0,0x22,
+    0x29,0x00,0x07,0x80,0x94,0x33,0x77,0x03,0x08,0x80,0x6D,0x22,0x4B,0x00,0x08,0x80,
+    0x16,0x34,0x94,0x00,0x0A,0x80,0x6D,0x22,0x49,0x00,0x0A,0x80,0x16,0x34,0x92,0x00,
+    0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,0x16,0x34,0x90,0x00,0x0E,0x80,0x6D,0x22,
+    0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,
+    0x16,0x34,0x8E,0x00,0x0F,0x80,0x6D,0x22,0x45,0x00,0x0F,0x80,0x16,0x34,0x8D,0x00,
+    0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,0x16,0x34,0x8D,0x00,0x10,0x80,0x6D,0x22,
+    0x43,0x00,0x10,0x80,0x16,0x34,0x8D,0x00,0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,
+    0x16,0x34,0x8E,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,
+    0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x16,0x34,0x90,0x00,0x0C,0x80,0x6D,0x22,
+    0x47,0x00,0x0C,0x80,0x16,0x34,0x91,0x00,0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,
+    0x16,0x34,0x92,0x00,0x09,0x80,0x6D,0x22,0x4B,0x00,0x09,0x80,0x16,0x34,0x95,0x00,
+    0x06,0x80,0x6D,0x22,0x4D,0x00,0x06,0x80,0x16,0x34,0x00,0x09,0x07,0x80,0x0B,0x1A,
+    0x59,0x00,0x07,0x80,0x79,0x3C,0x87,0x00,0x0B,0x80,0x0B,0x1A,0x55,0x00,0x0B,0x80,
+    0x79,0x3C,0x85,0x00,0x0B,0x80,0x0B,0x1A,0x55,0x00,0x0B,0x80,0x79,0x3C,0x84,0x00,
+    0x0D,0x80,0x0B,0x1A,0x53,0x00,0x0D,0x80,0x79,0x3C,0x82,0x00,0x0F,0x80,0x0B,0x1A,
+    0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,
+    0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,
+    0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,
+    0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,
+    0x79,0x3C,0x82,0x00,0x0D,0x80,0x0B,0x1A,0x53,0x00,0x0D,0x80,0x79,0x3C,0x83,0x00,
+    0x0D,0x80,0x0B,0x1A,0x53,0x00,0x0D,0x80,0x79,0x3C,0x84,0x00,0x0B,0x80,0x0B,0x1A,
+    0x55,0x00,0x0B,0x80,0x79,0x3C,0x86,0x00,0x09,0x80,0x0B,0x1A,0x57,0x00,0x09,0x80,
+    0x79,0x3C,0x89,0x00,0x05,0x80,0x0B,0x1A,0x5B,0x00,0x05,0x80,0x79,0x3C,0x00,0x09,
+    0x08,0x80,0xA9,0x11,0x4B,0x00,0x08,0x80,0xDB,0x44,0x94,0x00,0x0A,0x80,0xA9,0x11,
+    0x49,0x00,0x0A,0x80,0xDB,0x44,0x92,0x00,0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,
+    0xDB,0x44,0x90,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,
+    0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0xDB,0x44,0x8E,0x00,0x0F,0x80,0xA9,0x11,
+    0x45,0x00,0x0F,0x80,0xDB,0x44,0x8D,0x00,0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,
+    0xDB,0x44,0x8D,0x00,0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,0xDB,0x44,0x8D,0x00,
+    0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,0xDB,0x44,0x8E,0x00,0x0E,0x80,0xA9,0x11,
+    0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,
+    0xDB,0x44,0x90,0x00,0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,0xDB,0x44,0x91,0x00,
+    0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,0xDB,0x44,0x92,0x00,0x09,0x80,0xA9,0x11,
+    0x4B,0x00,0x09,0x80,0xDB,0x44,0x95,0x00,0x06,0x80,0xA9,0x11,0x4D,0x00,0x06,0x80,
+    0xDB,0x44,0x89,0x02,0x05,0x80,0x27,0x11,0x2B,0x00,0x05,0x80,0x3D,0x45,0xB9,0x00,
+    0x09,0x80,0x27,0x11,0x27,0x00,0x09,0x80,0x3D,0x45,0xB6,0x00,0x0B,0x80,0x27,0x11,
+    0x25,0x00,0x0B,0x80,0x3D,0x45,0xB4,0x00,0x0D,0x80,0x27,0x11,0x23,0x00,0x0D,0x80,
+    0x3D,0x45,0xB3,0x00,0x0D,0x80,0x27,0x11,0x23,0x00,0x0D,0x80,0x3D,0x45,0xB2,0x00,
+    0x0F,0x80,0x27,0x11,0x21,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,
+    0x21,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,0x0D,0x00,0x07,0x80,
+    0x9F,0x4D,0x0D,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,0x0B,0x00,
+    0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,
+    0x0B,0x00,0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,
+    0x27,0x11,0x0A,0x00,0x0D,0x80,0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x3D,0x45,0xB2,0x00,
+    0x0D,0x80,0x27,0x11,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0x0A,0x00,0x0D,0x80,0x3D,0x45,
+    0xB3,0x00,0x0D,0x80,0x27,0x11,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0x0A,0x00,0x0D,0x80,
+    0x3D,0x45,0xB4,0x00,0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0x0B,0x00,
+    0x0B,0x80,0x3D,0x45,0xB7,0x00,0x07,0x80,0x27,0x11,0x0D,0x00,0x0F,0x80,0x9F,0x4D,
+    0x0D,0x00,0x07,0x80,0x3D,0x45,0xBC,0x00,0x01,0x40,0x27,0x11,0x10,0x00,0x0F,0x80,
+    0x9F,0x4D,0x10,0x00,0x01,0x40,0x3D,0x45,0xD0,0x00,0x0F,0x80,0x9F,0x4D,0xE2,0x00,
+    0x0D,0x80,0x9F,0x4D,0xE3,0x00,0x0D,0x80,0x9F,0x4D,0xE4,0x00,0x0B,0x80,0x9F,0x4D,
+    0xE6,0x00,0x09,0x80,0x9F,0x4D,0xE9,0x00,0x05,0x80,0x9F,0x4D,0xBD,0x21,0x05,0x80,
+    0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,
+    0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,
+    0xD3,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0xD0,0x22,0xE7,0x00,
+    0x0B,0x80,0xD0,0x22,0xE5,0x00,0x0B,0x80,0xD0,0x22,0xE4,0x00,0x0D,0x80,0xD0,0x22,
+    0xE2,0x00,0x0F,0x80,0xD0,0x22,0xE1,0x00,0x0F,0x80,0xD0,0x22,0xCE,0x00,0x05,0x80,
+    0x6D,0x22,0x0E,0x00,0x0F,0x80,0xD0,0x22,0x0E,0x00,0x05,0x80,0x32,0x2B,0xB9,0x00,
+    0x09,0x80,0x6D,0x22,0x0C,0x00,0x0F,0x80,0xD0,0x22,0x0C,0x00,0x09,0x80,0x32,0x2B,
+    0xB6,0x00,0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0xD0,0x22,0x0B,0x00,0x0B,0x80,
+    0x32,0x2B,0xB4,0x00,0x0D,0x80,0x6D,0x22,0x0A,0x00,0x0F,0x80,0xD0,0x22,0x0A,0x00,
+    0x0D,0x80,0x32,0x2B,0xB3,0x00,0x0D,0x80,0x6D,0x22,0x0B,0x00,0x0D,0x80,0xD0,0x22,
+    0x0B,0x00,0x0D,0x80,0x32,0x2B,0xB2,0x00,0x0F,0x80,0x6D,0x22,0x0A,0x00,0x0D,0x80,
+    0xD0,0x22,0x0A,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x6D,0x22,0x0B,0x00,
+    0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x6D,0x22,
+    0x0C,0x00,0x09,0x80,0xD0,0x22,0x0C,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,
+    0x6D,0x22,0x0E,0x00,0x05,0x80,0xD0,0x22,0x0E,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,
+    0x0F,0x80,0x6D,0x22,0x21,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x6D,0x22,
+    0x21,0x00,0x0F,0x80,0x32,0x2B,0xB2,0x00,0x0D,0x80,0x6D,0x22,0x23,0x00,0x0D,0x80,
+    0x32,0x2B,0xB3,0x00,0x0D,0x80,0x6D,0x22,0x23,0x00,0x0D,0x80,0x32,0x2B,0xB4,0x00,
+    0x0B,0x80,0x6D,0x22,0x25,0x00,0x0B,0x80,0x32,0x2B,0xB7,0x00,0x07,0x80,0x6D,0x22,
+    0x29,0x00,0x07,0x80,0x32,0x2B,0x77,0x03,0x08,0x80,0x0B,0x1A,0x4B,0x00,0x08,0x80,
+    0x94,0x33,0x94,0x00,0x0A,0x80,0x0B,0x1A,0x49,0x00,0x0A,0x80,0x94,0x33,0x92,0x00,
+    0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,0x94,0x33,0x90,0x00,0x0E,0x80,0x0B,0x1A,
+    0x45,0x00,0x0E,0x80,0x94,0x33,0x8F,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,
+    0x94,0x33,0x8E,0x00,0x0F,0x80,0x0B,0x1A,0x45,0x00,0x0F,0x80,0x94,0x33,0x8D,0x00,
+    0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,0x94,0x33,0x8D,0x00,0x10,0x80,0x0B,0x1A,
+    0x43,0x00,0x10,0x80,0x94,0x33,0x8D,0x00,0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,
+    0x94,0x33,0x8E,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x94,0x33,0x8F,0x00,
+    0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x94,0x33,0x90,0x00,0x0C,0x80,0x0B,0x1A,
+    0x47,0x00,0x0C,0x80,0x94,0x33,0x91,0x00,0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,
+    0x94,0x33,0x92,0x00,0x09,0x80,0x0B,0x1A,0x4B,0x00,0x09,0x80,0x94,0x33,0x95,0x00,
+    0x06,0x80,0x0B,0x1A,0x4D,0x00,0x06,0x80,0x94,0x33,0x00,0x09,0x07,0x80,0xA9,0x11,
+    0x59,0x00,0x07,0x80,0x16,0x34,0x87,0x00,0x0B,0x80,0xA9,0x11,0x55,0x00,0x0B,0x80,
+    0x16,0x34,0x85,0x00,0x0B,0x80,0xA9,0x11,0x55,0x00,0x0B,0x80,0x16,0x34,0x84,0x00,
+    0x0D,0x80,0xA9,0x11,0x53,0x00,0x0D,0x80,0x16,0x34,0x82,0x00,0x0F,0x80,0xA9,0x11,
+    0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,
+    0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,
+    0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,
+    0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,
+    0x16,0x34,0x82,0x00,0x0D,0x80,0xA9,0x11,0x53,0x00,0x0D,0x80,0x16,0x34,0x83,0x00,
+    0x0D,0x80,0xA9,0x11,0x53,0x00,0x0D,0x80,0x16,0x34,0x84,0x00,0x0B,0x80,0xA9,0x11,
+    0x55,0x00,0x0B,0x80,0x16,0x34,0x86,0x00,0x09,0x80,0xA9,0x11,0x57,0x00,0x09,0x80,
+    0x16,0x34,0x89,0x00,0x05,0x80,0xA9,0x11,0x5B,0x00,0x05,0x80,0x16,0x34,0x00,0x09,
+    0x08,0x80,0x27,0x11,0x4B,0x00,0x08,0x80,0x79,0x3C,0x94,0x00,0x0A,0x80,0x27,0x11,
+    0x49,0x00,0x0A,0x80,0x79,0x3C,0x92,0x00,0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,
+    0x79,0x3C,0x90,0x00,0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,
+    0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,0x79,0x3C,0x8E,0x00,0x0F,0x80,0x27,0x11,
+    0x45,0x00,0x0F,0x80,0x79,0x3C,0x8D,0x00,0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,
+    0x79,0x3C,0x8D,0x00,0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,0x79,0x3C,0x8D,0x00,
+    0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,0x79,0x3C,0x8E,0x00,0x0E,0x80,0x27,0x11,
+    0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,
+    0x79,0x3C,0x90,0x00,0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,0x79,0x3C,0x91,0x00,
+    0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,0x79,0x3C,0x92,0x00,0x09,0x80,0x27,0x11,
+    0x4B,0x00,0x09,0x80,0x79,0x3C,0x95,0x00,0x06,0x80,0x27,0x11,0x4D,0x00,0x06,0x80,
+    0x79,0x3C,0x89,0x02,0x05,0x80,0x9F,0x4D,0x2B,0x00,0x05,0x80,0xDB,0x44,0xB9,0x00,
+    0x09,0x80,0x9F,0x4D,0x27,0x00,0x09,0x80,0xDB,0x44,0xB6,0x00,0x0B,0x80,0x9F,0x4D,
+    0x25,0x00,0x0B,0x80,0xDB,0x44,0xB4,0x00,0x0D,0x80,0x9F,0x4D,0x23,0x00,0x0D,0x80,
+    0xDB,0x44,0xB3,0x00,0x0D,0x80,0x9F,0x4D,0x23,0x00,0x0D,0x80,0xDB,0x44,0xB2,0x00,
+    0x0F,0x80,0x9F,0x4D,0x21,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,
+    0x21,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,0x0D,0x00,0x07,0x80,
+    0x3D,0x45,0x0D,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,0x0B,0x00,
+    0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,
+    0x0B,0x00,0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,
+    0x9F,0x4D,0x0A,0x00,0x0D,0x80,0x3D,0x45,0x0A,0x00,0x0F,0x80,0xDB,0x44,0xB2,0x00,
+    0x0D,0x80,0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x3D,0x45,0x0A,0x00,0x0D,0x80,0xDB,0x44,
+    0xB3,0x00,0x0D,0x80,0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x3D,0x45,0x0A,0x00,0x0D,0x80,
+    0xDB,0x44,0xB4,0x00,0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x3D,0x45,0x0B,0x00,
+    0x0B,0x80,0xDB,0x44,0xB7,0x00,0x07,0x80,0x9F,0x4D,0x0D,0x00,0x0F,0x80,0x3D,0x45,
+    0x0D,0x00,0x07,0x80,0xDB,0x44,0xBC,0x00,0x01,0x40,0x9F,0x4D,0x10,0x00,0x0F,0x80,
+    0x3D,0x45,0x10,0x00,0x01,0x40,0xDB,0x44,0xD0,0x00,0x0F,0x80,0x3D,0x45,0xE2,0x00,
+    0x0D,0x80,0x3D,0x45,0xE3,0x00,0x0D,0x80,0x3D,0x45,0xE4,0x00,0x0B,0x80,0x3D,0x45,
+    0xE6,0x00,0x09,0x80,0x3D,0x45,0xE9,0x00,0x05,0x80,0x3D,0x45,0xC2,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0xCD,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x6D,0x22,0xE7,0x00,
+    0x0B,0x80,0x6D,0x22,0xE5,0x00,0x0B,0x80,0x6D,0x22,0xE4,0x00,0x0D,0x80,0x6D,0x22,
+    0xE2,0x00,0x0F,0x80,0x6D,0x22,0xE1,0x00,0x0F,0x80,0x6D,0x22,0xCE,0x00,0x05,0x80,
+    0x0B,0x1A,0x0E,0x00,0x0F,0x80,0x6D,0x22,0x0E,0x00,0x05,0x80,0xD0,0x22,0xB9,0x00,
+    0x09,0x80,0x0B,0x1A,0x0C,0x00,0x0F,0x80,0x6D,0x22,0x0C,0x00,0x09,0x80,0xD0,0x22,
+    0xB6,0x00,0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0x6D,0x22,0x0B,0x00,0x0B,0x80,
+    0xD0,0x22,0xB4,0x00,0x0D,0x80,0x0B,0x1A,0x0A,0x00,0x0F,0x80,0x6D,0x22,0x0A,0x00,
+    0x0D,0x80,0xD0,0x22,0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x0B,0x00,0x0D,0x80,0x6D,0x22,
+    0x0B,0x00,0x0D,0x80,0xD0,0x22,0xB2,0x00,0x0F,0x80,0x0B,0x1A,0x0A,0x00,0x0D,0x80,
+    0x6D,0x22,0x0A,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x0B,0x1A,0x0B,0x00,
+    0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x0C,0x00,0x09,0x80,0x6D,0x22,0x0C,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,
+    0x0B,0x1A,0x0E,0x00,0x05,0x80,0x6D,0x22,0x0E,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,
+    0x0F,0x80,0x0B,0x1A,0x21,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x21,0x00,0x0F,0x80,0xD0,0x22,0xB2,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,
+    0xD0,0x22,0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,0xD0,0x22,0xB4,0x00,
+    0x0B,0x80,0x0B,0x1A,0x25,0x00,0x0B,0x80,0xD0,0x22,0xB7,0x00,0x07,0x80,0x0B,0x1A,
+    0x29,0x00,0x07,0x80,0xD0,0x22,0x77,0x03,0x08,0x80,0xA9,0x11,0x4B,0x00,0x08,0x80,
+    0x32,0x2B,0x94,0x00,0x0A,0x80,0xA9,0x11,0x49,0x00,0x0A,0x80,0x32,0x2B,0x92,0x00,
+    0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,0x32,0x2B,0x90,0x00,0x0E,0x80,0xA9,0x11,
+    0x45,0x00,0x0E,0x80,0x32,0x2B,0x8F,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,
+    0x32,0x2B,0x8E,0x00,0x0F,0x80,0xA9,0x11,0x45,0x00,0x0F,0x80,0x32,0x2B,0x8D,0x00,
+    0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,0x32,0x2B,0x8D,0x00,0x10,0x80,0xA9,0x11,
+    0x43,0x00,0x10,0x80,0x32,0x2B,0x8D,0x00,0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,
+    0x32,0x2B,0x8E,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0x32,0x2B,0x8F,0x00,
+    0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0x32,0x2B,0x90,0x00,0x0C,0x80,0xA9,0x11,
+    0x47,0x00,0x0C,0x80,0x32,0x2B,0x91,0x00,0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,
+    0x32,0x2B,0x92,0x00,0x09,0x80,0xA9,0x11,0x4B,0x00,0x09,0x80,0x32,0x2B,0x95,0x00,
+    0x06,0x80,0xA9,0x11,0x4D,0x00,0x06,0x80,0x32,0x2B,0x00,0x09,0x07,0x80,0x27,0x11,
+    0x59,0x00,0x07,0x80,0x94,0x33,0x87,0x00,0x0B,0x80,0x27,0x11,0x55,0x00,0x0B,0x80,
+    0x94,0x33,0x85,0x00,0x0B,0x80,0x27,0x11,0x55,0x00,0x0B,0x80,0x94,0x33,0x84,0x00,
+    0x0D,0x80,0x27,0x11,0x53,0x00,0x0D,0x80,0x94,0x33,0x82,0x00,0x0F,0x80,0x27,0x11,
+    0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,
+    0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,
+    0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,
+    0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,
+    0x94,0x33,0x82,0x00,0x0D,0x80,0x27,0x11,0x53,0x00,0x0D,0x80,0x94,0x33,0x83,0x00,
+    0x0D,0x80,0x27,0x11,0x53,0x00,0x0D,0x80,0x94,0x33,0x84,0x00,0x0B,0x80,0x27,0x11,
+    0x55,0x00,0x0B,0x80,0x94,0x33,0x86,0x00,0x09,0x80,0x27,0x11,0x57,0x00,0x09,0x80,
+    0x94,0x33,0x89,0x00,0x05,0x80,0x27,0x11,0x5B,0x00,0x05,0x80,0x94,0x33,0x00,0x09,
+    0x08,0x80,0x9F,0x4D,0x4B,0x00,0x08,0x80,0x16,0x34,0x94,0x00,0x0A,0x80,0x9F,0x4D,
+    0x49,0x00,0x0A,0x80,0x16,0x34,0x92,0x00,0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,
+    0x16,0x34,0x90,0x00,0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,
+    0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,0x16,0x34,0x8E,0x00,0x0F,0x80,0x9F,0x4D,
+    0x45,0x00,0x0F,0x80,0x16,0x34,0x8D,0x00,0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,
+    0x16,0x34,0x8D,0x00,0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,0x16,0x34,0x8D,0x00,
+    0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,0x16,0x34,0x8E,0x00,0x0E,0x80,0x9F,0x4D,
+    0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,
+    0x16,0x34,0x90,0x00,0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,0x16,0x34,0x91,0x00,
+    0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,0x16,0x34,0x92,0x00,0x09,0x80,0x9F,0x4D,
+    0x4B,0x00,0x09,0x80,0x16,0x34,0x95,0x00,0x06,0x80,0x9F,0x4D,0x4D,0x00,0x06,0x80,
+    0x16,0x34,0x89,0x02,0x05,0x80,0x3D,0x45,0x2B,0x00,0x05,0x80,0x79,0x3C,0xB9,0x00,
+    0x09,0x80,0x3D,0x45,0x27,0x00,0x09,0x80,0x79,0x3C,0xB6,0x00,0x0B,0x80,0x3D,0x45,
+    0x25,0x00,0x0B,0x80,0x79,0x3C,0xB4,0x00,0x0D,0x80,0x3D,0x45,0x23,0x00,0x0D,0x80,
+    0x79,0x3C,0xB3,0x00,0x0D,0x80,0x3D,0x45,0x23,0x00,0x0D,0x80,0x79,0x3C,0xB2,0x00,
+    0x0F,0x80,0x3D,0x45,0x21,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,
+    0x21,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,0x0D,0x00,0x07,0x80,
+    0xDB,0x44,0x0D,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,0x0B,0x00,
+    0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,
+    0x0B,0x00,0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,
+    0x3D,0x45,0x0A,0x00,0x0D,0x80,0xDB,0x44,0x0A,0x00,0x0F,0x80,0x79,0x3C,0xB2,0x00,
+    0x0D,0x80,0x3D,0x45,0x0A,0x00,0x0F,0x80,0xDB,0x44,0x0A,0x00,0x0D,0x80,0x79,0x3C,
+    0xB3,0x00,0x0D,0x80,0x3D,0x45,0x0A,0x00,0x0F,0x80,0xDB,0x44,0x0A,0x00,0x0D,0x80,
+    0x79,0x3C,0xB4,0x00,0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0xDB,0x44,0x0B,0x00,
+    0x0B,0x80,0x79,0x3C,0xB7,0x00,0x07,0x80,0x3D,0x45,0x0D,0x00,0x0F,0x80,0xDB,0x44,
+    0x0D,0x00,0x07,0x80,0x79,0x3C,0xBC,0x00,0x01,0x40,0x3D,0x45,0x10,0x00,0x0F,0x80,
+    0xDB,0x44,0x10,0x00,0x01,0x40,0x79,0x3C,0xD0,0x00,0x0F,0x80,0xDB,0x44,0xE2,0x00,
+    0x0D,0x80,0xDB,0x44,0xE3,0x00,0x0D,0x80,0xDB,0x44,0xE4,0x00,0x0B,0x80,0xDB,0x44,
+    0xE6,0x00,0x09,0x80,0xDB,0x44,0xE9,0x00,0x05,0x80,0xDB,0x44,0xC8,0x21,0x05,0x80,
+    0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,
+    0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,
+    0xC8,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x0B,0x1A,0xE7,0x00,
+    0x0B,0x80,0x0B,0x1A,0xE5,0x00,0x0B,0x80,0x0B,0x1A,0xE4,0x00,0x0D,0x80,0x0B,0x1A,
+    0xE2,0x00,0x0F,0x80,0x0B,0x1A,0xE1,0x00,0x0F,0x80,0x0B,0x1A,0xCE,0x00,0x05,0x80,
+    0xA9,0x11,0x0E,0x00,0x0F,0x80,0x0B,0x1A,0x0E,0x00,0x05,0x80,0x6D,0x22,0xB9,0x00,
+    0x09,0x80,0xA9,0x11,0x0C,0x00,0x0F,0x80,0x0B,0x1A,0x0C,0x00,0x09,0x80,0x6D,0x22,
+    0xB6,0x00,0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x0B,0x1A,0x0B,0x00,0x0B,0x80,
+    0x6D,0x22,0xB4,0x00,0x0D,0x80,0xA9,0x11,0x0A,0x00,0x0F,0x80,0x0B,0x1A,0x0A,0x00,
+    0x0D,0x80,0x6D,0x22,0xB3,0x00,0x0D,0x80,0xA9,0x11,0x0B,0x00,0x0D,0x80,0x0B,0x1A,
+    0x0B,0x00,0x0D,0x80,0x6D,0x22,0xB2,0x00,0x0F,0x80,0xA9,0x11,0x0A,0x00,0x0D,0x80,
+    0x0B,0x1A,0x0A,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0xA9,0x11,0x0B,0x00,
+    0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0xA9,0x11,
+    0x0C,0x00,0x09,0x80,0x0B,0x1A,0x0C,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,
+    0xA9,0x11,0x0E,0x00,0x05,0x80,0x0B,0x1A,0x0E,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,
+    0x0F,0x80,0xA9,0x11,0x21,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0xA9,0x11,
+    0x21,0x00,0x0F,0x80,0x6D,0x22,0xB2,0x00,0x0D,0x80,0xA9,0x11,0x23,0x00,0x0D,0x80,
+    0x6D,0x22,0xB3,0x00,0x0D,0x80,0xA9,0x11,0x23,0x00,0x0D,0x80,0x6D,0x22,0xB4,0x00,
+    0x0B,0x80,0xA9,0x11,0x25,0x00,0x0B,0x80,0x6D,0x22,0xB7,0x00,0x07,0x80,0xA9,0x11,
+    0x29,0x00,0x07,0x80,0x6D,0x22,0x77,0x03,0x08,0x80,0x27,0x11,0x4B,0x00,0x08,0x80,
+    0xD0,0x22,0x94,0x00,0x0A,0x80,0x27,0x11,0x49,0x00,0x0A,0x80,0xD0,0x22,0x92,0x00,
+    0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,0xD0,0x22,0x90,0x00,0x0E,0x80,0x27,0x11,
+    0x45,0x00,0x0E,0x80,0xD0,0x22,0x8F,0x00,0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,
+    0xD0,0x22,0x8E,0x00,0x0F,0x80,0x27,0x11,0x45,0x00,0x0F,0x80,0xD0,0x22,0x8D,0x00,
+    0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,0xD0,0x22,0x8D,0x00,0x10,0x80,0x27,0x11,
+    0x43,0x00,0x10,0x80,0xD0,0x22,0x8D,0x00,0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,
+    0xD0,0x22,0x8E,0x00,0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,0xD0,0x22,0x8F,0x00,
+    0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,0xD0,0x22,0x90,0x00,0x0C,0x80,0x27,0x11,
+    0x47,0x00,0x0C,0x80,0xD0,0x22,0x91,0x00,0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,
+    0xD0,0x22,0x92,0x00,0x09,0x80,0x27,0x11,0x4B,0x00,0x09,0x80,0xD0,0x22,0x95,0x00,
+    0x06,0x80,0x27,0x11,0x4D,0x00,0x06,0x80,0xD0,0x22,0x00,0x09,0x07,0x80,0x9F,0x4D,
+    0x59,0x00,0x07,0x80,0x32,0x2B,0x87,0x00,0x0B,0x80,0x9F,0x4D,0x55,0x00,0x0B,0x80,
+    0x32,0x2B,0x85,0x00,0x0B,0x80,0x9F,0x4D,0x55,0x00,0x0B,0x80,0x32,0x2B,0x84,0x00,
+    0x0D,0x80,0x9F,0x4D,0x53,0x00,0x0D,0x80,0x32,0x2B,0x82,0x00,0x0F,0x80,0x9F,0x4D,
+    0x51,0x00,0x0F,0x80,0x32,0x2B,0x81,0x00,0x0F,0x80,0x9F,0x4D,0x51,0x00,0x0F,0x80,
+    0x32,0x2B,0x81,0x00,0x0F,0x80,0x9F,0x4D,0x51,0x00,0x0F,0x80,0x32,0x2B,0x81,0x00,
+    0x0F,0x80,0x9F,0x4D,0x51,0x00,0x0F,0x80,0x32,0x2B,0x81,0x00,0x0F,0x80,0x9F,0x4D,
+    0x51,0x00,0x0F,0x80,0x32,0x2B,0x81,0x00,0x0F,0x80,0x9F,0x4D,0x51,0x00,0x0F,0x80,
+    0x32,0x2B,0x82,0x00,0x0D,0x80,0x9F,0x4D,0x53,0x00,0x0D,0x80,0x32,0x2B,0x83,0x00,
+    0x0D,0x80,0x9F,0x4D,0x53,0x00,0x0D,0x80,0x32,0x2B,0x84,0x00,0x0B,0x80,0x9F,0x4D,
+    0x55,0x00,0x0B,0x80,0x32,0x2B,0x86,0x00,0x09,0x80,0x9F,0x4D,0x57,0x00,0x09,0x80,
+    0x32,0x2B,0x89,0x00,0x05,0x80,0x9F,0x4D,0x5B,0x00,0x05,0x80,0x32,0x2B,0x00,0x09,
+    0x08,0x80,0x3D,0x45,0x4B,0x00,0x08,0x80,0x94,0x33,0x94,0x00,0x0A,0x80,0x3D,0x45,
+    0x49,0x00,0x0A,0x80,0x94,0x33,0x92,0x00,0x0C,0x80,0x3D,0x45,0x47,0x00,0x0C,0x80,
+    0x94,0x33,0x90,0x00,0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,0x94,0x33,0x8F,0x00,
+    0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,0x94,0x33,0x8E,0x00,0x0F,0x80,0x3D,0x45,
+    0x45,0x00,0x0F,0x80,0x94,0x33,0x8D,0x00,0x10,0x80,0x3D,0x45,0x43,0x00,0x10,0x80,
+    0x94,0x33,0x8D,0x00,0x10,0x80,0x3D,0x45,0x43,0x00,0x10,0x80,0x94,0x33,0x8D,0x00,
+    0x10,0x80,0x3D,0x45,0x43,0x00,0x10,0x80,0x94,0x33,0x8E,0x00,0x0E,0x80,0x3D,0x45,
+    0x45,0x00,0x0E,0x80,0x94,0x33,0x8F,0x00,0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,
+    0x94,0x33,0x90,0x00,0x0C,0x80,0x3D,0x45,0x47,0x00,0x0C,0x80,0x94,0x33,0x91,0x00,
+    0x0C,0x80,0x3D,0x45,0x47,0x00,0x0C,0x80,0x94,0x33,0x92,0x00,0x09,0x80,0x3D,0x45,
+    0x4B,0x00,0x09,0x80,0x94,0x33,0x95,0x00,0x06,0x80,0x3D,0x45,0x4D,0x00,0x06,0x80,
+    0x94,0x33,0x89,0x02,0x05,0x80,0xDB,0x44,0x2B,0x00,0x05,0x80,0x16,0x34,0xB9,0x00,
+    0x09,0x80,0xDB,0x44,0x27,0x00,0x09,0x80,0x16,0x34,0xB6,0x00,0x0B,0x80,0xDB,0x44,
+    0x25,0x00,0x0B,0x80,0x16,0x34,0xB4,0x00,0x0D,0x80,0xDB,0x44,0x23,0x00,0x0D,0x80,
+    0x16,0x34,0xB3,0x00,0x0D,0x80,0xDB,0x44,0x23,0x00,0x0D,0x80,0x16,0x34,0xB2,0x00,
+    0x0F,0x80,0xDB,0x44,0x21,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0xDB,0x44,
+    0x21,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0xDB,0x44,0x0D,0x00,0x07,0x80,
+    0x79,0x3C,0x0D,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0xDB,0x44,0x0B,0x00,
+    0x0B,0x80,0x79,0x3C,0x0B,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0xDB,0x44,
+    0x0B,0x00,0x0B,0x80,0x79,0x3C,0x0B,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,
+    0xDB,0x44,0x0A,0x00,0x0D,0x80,0x79,0x3C,0x0A,0x00,0x0F,0x80,0x16,0x34,0xB2,0x00,
+    0x0D,0x80,0xDB,0x44,0x0A,0x00,0x0F,0x80,0x79,0x3C,0x0A,0x00,0x0D,0x80,0x16,0x34,
+    0xB3,0x00,0x0D,0x80,0xDB,0x44,0x0A,0x00,0x0F,0x80,0x79,0x3C,0x0A,0x00,0x0D,0x80,
+    0x16,0x34,0xB4,0x00,0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x79,0x3C,0x0B,0x00,
+    0x0B,0x80,0x16,0x34,0xB7,0x00,0x07,0x80,0xDB,0x44,0x0D,0x00,0x0F,0x80,0x79,0x3C,
+    0x0D,0x00,0x07,0x80,0x16,0x34,0xBC,0x00,0x01,0x40,0xDB,0x44,0x10,0x00,0x0F,0x80,
+    0x79,0x3C,0x10,0x00,0x01,0x40,0x16,0x34,0xD0,0x00,0x0F,0x80,0x79,0x3C,0xE2,0x00,
+    0x0D,0x80,0x79,0x3C,0xE3,0x00,0x0D,0x80,0x79,0x3C,0xE4,0x00,0x0B,0x80,0x79,0x3C,
+    0xE6,0x00,0x09,0x80,0x79,0x3C,0xE9,0x00,0x05,0x80,0x79,0x3C,0xCD,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0xC2,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0xA9,0x11,0xE7,0x00,
+    0x0B,0x80,0xA9,0x11,0xE5,0x00,0x0B,0x80,0xA9,0x11,0xE4,0x00,0x0D,0x80,0xA9,0x11,
+    0xE2,0x00,0x0F,0x80,0xA9,0x11,0xE1,0x00,0x0F,0x80,0xA9,0x11,0xCE,0x00,0x05,0x80,
+    0x27,0x11,0x0E,0x00,0x0F,0x80,0xA9,0x11,0x0E,0x00,0x05,0x80,0x0B,0x1A,0xB9,0x00,
+    0x09,0x80,0x27,0x11,0x0C,0x00,0x0F,0x80,0xA9,0x11,0x0C,0x00,0x09,0x80,0x0B,0x1A,
+    0xB6,0x00,0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0xA9,0x11,0x0B,0x00,0x0B,0x80,
+    0x0B,0x1A,0xB4,0x00,0x0D,0x80,0x27,0x11,0x0A,0x00,0x0F,0x80,0xA9,0x11,0x0A,0x00,
+    0x0D,0x80,0x0B,0x1A,0xB3,0x00,0x0D,0x80,0x27,0x11,0x0B,0x00,0x0D,0x80,0xA9,0x11,
+    0x0B,0x00,0x0D,0x80,0x0B,0x1A,0xB2,0x00,0x0F,0x80,0x27,0x11,0x0A,0x00,0x0D,0x80,
+    0xA9,0x11,0x0A,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0x27,0x11,0x0B,0x00,
+    0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0x27,0x11,
+    0x0C,0x00,0x09,0x80,0xA9,0x11,0x0C,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,
+    0x27,0x11,0x0E,0x00,0x05,0x80,0xA9,0x11,0x0E,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,
+    0x0F,0x80,0x27,0x11,0x21,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0x27,0x11,
+    0x21,0x00,0x0F,0x80,0x0B,0x1A,0xB2,0x00,0x0D,0x80,0x27,0x11,0x23,0x00,0x0D,0x80,
+    0x0B,0x1A,0xB3,0x00,0x0D,0x80,0x27,0x11,0x23,0x00,0x0D,0x80,0x0B,0x1A,0xB4,0x00,
+    0x0B,0x80,0x27,0x11,0x25,0x00,0x0B,0x80,0x0B,0x1A,0xB7,0x00,0x07,0x80,0x27,0x11,
+    0x29,0x00,0x07,0x80,0x0B,0x1A,0x77,0x03,0x08,0x80,0x9F,0x4D,0x4B,0x00,0x08,0x80,
+    0x6D,0x22,0x94,0x00,0x0A,0x80,0x9F,0x4D,0x49,0x00,0x0A,0x80,0x6D,0x22,0x92,0x00,
+    0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,0x6D,0x22,0x90,0x00,0x0E,0x80,0x9F,0x4D,
+    0x45,0x00,0x0E,0x80,0x6D,0x22,0x8F,0x00,0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,
+    0x6D,0x22,0x8E,0x00,0x0F,0x80,0x9F,0x4D,0x45,0x00,0x0F,0x80,0x6D,0x22,0x8D,0x00,
+    0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,0x6D,0x22,0x8D,0x00,0x10,0x80,0x9F,0x4D,
+    0x43,0x00,0x10,0x80,0x6D,0x22,0x8D,0x00,0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,
+    0x6D,0x22,0x8E,0x00,0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,0x6D,0x22,0x8F,0x00,
+    0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,0x6D,0x22,0x90,0x00,0x0C,0x80,0x9F,0x4D,
+    0x47,0x00,0x0C,0x80,0x6D,0x22,0x91,0x00,0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,
+    0x6D,0x22,0x92,0x00,0x09,0x80,0x9F,0x4D,0x4B,0x00,0x09,0x80,0x6D,0x22,0x95,0x00,
+    0x06,0x80,0x9F,0x4D,0x4D,0x00,0x06,0x80,0x6D,0x22,0x00,0x09,0x07,0x80,0x3D,0x45,
+    0x59,0x00,0x07,0x80,0xD0,0x22,0x87,0x00,0x0B,0x80,0x3D,0x45,0x55,0x00,0x0B,0x80,
+    0xD0,0x22,0x85,0x00,0x0B,0x80,0x3D,0x45,0x55,0x00,0x0B,0x80,0xD0,0x22,0x84,0x00,
+    0x0D,0x80,0x3D,0x45,0x53,0x00,0x0D,0x80,0xD0,0x22,0x82,0x00,0x0F,0x80,0x3D,0x45,
+    0x51,0x00,0x0F,0x80,0xD0,0x22,0x81,0x00,0x0F,0x80,0x3D,0x45,0x51,0x00,0x0F,0x80,
+    0xD0,0x22,0x81,0x00,0x0F,0x80,0x3D,0x45,0x51,0x00,0x0F,0x80,0xD0,0x22,0x81,0x00,
+    0x0F,0x80,0x3D,0x45,0x51,0x00,0x0F,0x80,0xD0,0x22,0x81,0x00,0x0F,0x80,0x3D,0x45,
+    0x51,0x00,0x0F,0x80,0xD0,0x22,0x81,0x00,0x0F,0x80,0x3D,0x45,0x51,0x00,0x0F,0x80,
+    0xD0,0x22,0x82,0x00,0x0D,0x80,0x3D,0x45,0x53,0x00,0x0D,0x80,0xD0,0x22,0x83,0x00,
+    0x0D,0x80,0x3D,0x45,0x53,0x00,0x0D,0x80,0xD0,0x22,0x84,0x00,0x0B,0x80,0x3D,0x45,
+    0x55,0x00,0x0B,0x80,0xD0,0x22,0x86,0x00,0x09,0x80,0x3D,0x45,0x57,0x00,0x09,0x80,
+    0xD0,0x22,0x89,0x00,0x05,0x80,0x3D,0x45,0x5B,0x00,0x05,0x80,0xD0,0x22,0x00,0x09,
+    0x08,0x80,0xDB,0x44,0x4B,0x00,0x08,0x80,0x32,0x2B,0x94,0x00,0x0A,0x80,0xDB,0x44,
+    0x49,0x00,0x0A,0x80,0x32,0x2B,0x92,0x00,0x0C,0x80,0xDB,0x44,0x47,0x00,0x0C,0x80,
+    0x32,0x2B,0x90,0x00,0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,0x32,0x2B,0x8F,0x00,
+    0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,0x32,0x2B,0x8E,0x00,0x0F,0x80,0xDB,0x44,
+    0x45,0x00,0x0F,0x80,0x32,0x2B,0x8D,0x00,0x10,0x80,0xDB,0x44,0x43,0x00,0x10,0x80,
+    0x32,0x2B,0x8D,0x00,0x10,0x80,0xDB,0x44,0x43,0x00,0x10,0x80,0x32,0x2B,0x8D,0x00,
+    0x10,0x80,0xDB,0x44,0x43,0x00,0x10,0x80,0x32,0x2B,0x8E,0x00,0x0E,0x80,0xDB,0x44,
+    0x45,0x00,0x0E,0x80,0x32,0x2B,0x8F,0x00,0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,
+    0x32,0x2B,0x90,0x00,0x0C,0x80,0xDB,0x44,0x47,0x00,0x0C,0x80,0x32,0x2B,0x91,0x00,
+    0x0C,0x80,0xDB,0x44,0x47,0x00,0x0C,0x80,0x32,0x2B,0x92,0x00,0x09,0x80,0xDB,0x44,
+    0x4B,0x00,0x09,0x80,0x32,0x2B,0x95,0x00,0x06,0x80,0xDB,0x44,0x4D,0x00,0x06,0x80,
+    0x32,0x2B,0x89,0x02,0x05,0x80,0x79,0x3C,0x2B,0x00,0x05,0x80,0x94,0x33,0xB9,0x00,
+    0x09,0x80,0x79,0x3C,0x27,0x00,0x09,0x80,0x94,0x33,0xB6,0x00,0x0B,0x80,0x79,0x3C,
+    0x25,0x00,0x0B,0x80,0x94,0x33,0xB4,0x00,0x0D,0x80,0x79,0x3C,0x23,0x00,0x0D,0x80,
+    0x94,0x33,0xB3,0x00,0x0D,0x80,0x79,0x3C,0x23,0x00,0x0D,0x80,0x94,0x33,0xB2,0x00,
+    0x0F,0x80,0x79,0x3C,0x21,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0x79,0x3C,
+    0x21,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0x79,0x3C,0x0D,0x00,0x07,0x80,
+    0x16,0x34,0x0D,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0x79,0x3C,0x0B,0x00,
+    0x0B,0x80,0x16,0x34,0x0B,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0x79,0x3C,
+    0x0B,0x00,0x0B,0x80,0x16,0x34,0x0B,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,
+    0x79,0x3C,0x0A,0x00,0x0D,0x80,0x16,0x34,0x0A,0x00,0x0F,0x80,0x94,0x33,0xB2,0x00,
+    0x0D,0x80,0x79,0x3C,0x0A,0x00,0x0F,0x80,0x16,0x34,0x0A,0x00,0x0D,0x80,0x94,0x33,
+    0xB3,0x00,0x0D,0x80,0x79,0x3C,0x0A,0x00,0x0F,0x80,0x16,0x34,0x0A,0x00,0x0D,0x80,
+    0x94,0x33,0xB4,0x00,0x0B,0x80,0x79,0x3C,0x0B,0x00,0x0F,0x80,0x16,0x34,0x0B,0x00,
+    0x0B,0x80,0x94,0x33,0xB7,0x00,0x07,0x80,0x79,0x3C,0x0D,0x00,0x0F,0x80,0x16,0x34,
+    0x0D,0x00,0x07,0x80,0x94,0x33,0xBC,0x00,0x01,0x40,0x79,0x3C,0x10,0x00,0x0F,0x80,
+    0x16,0x34,0x10,0x00,0x01,0x40,0x94,0x33,0xD0,0x00,0x0F,0x80,0x16,0x34,0xE2,0x00,
+    0x0D,0x80,0x16,0x34,0xE3,0x00,0x0D,0x80,0x16,0x34,0xE4,0x00,0x0B,0x80,0x16,0x34,
+    0xE6,0x00,0x09,0x80,0x16,0x34,0xE9,0x00,0x05,0x80,0x16,0x34,0xD3,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0xBC,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x27,0x11,0xE7,0x00,
+    0x0B,0x80,0x27,0x11,0xE5,0x00,0x0B,0x80,0x27,0x11,0xE4,0x00,0x0D,0x80,0x27,0x11,
+    0xE2,0x00,0x0F,0x80,0x27,0x11,0xE1,0x00,0x0F,0x80,0x27,0x11,0xCE,0x00,0x05,0x80,
+    0x9F,0x4D,0x0E,0x00,0x0F,0x80,0x27,0x11,0x0E,0x00,0x05,0x80,0xA9,0x11,0xB9,0x00,
+    0x09,0x80,0x9F,0x4D,0x0C,0x00,0x0F,0x80,0x27,0x11,0x0C,0x00,0x09,0x80,0xA9,0x11,
+    0xB6,0x00,0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x27,0x11,0x0B,0x00,0x0B,0x80,
+    0xA9,0x11,0xB4,0x00,0x0D,0x80,0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x27,0x11,0x0A,0x00,
+    0x0D,0x80,0xA9,0x11,0xB3,0x00,0x0D,0x80,0x9F,0x4D,0x0B,0x00,0x0D,0x80,0x27,0x11,
+    0x0B,0x00,0x0D,0x80,0xA9,0x11,0xB2,0x00,0x0F,0x80,0x9F,0x4D,0x0A,0x00,0x0D,0x80,
+    0x27,0x11,0x0A,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x9F,0x4D,0x0B,0x00,
+    0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x9F,0x4D,
+    0x0C,0x00,0x09,0x80,0x27,0x11,0x0C,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,
+    0x9F,0x4D,0x0E,0x00,0x05,0x80,0x27,0x11,0x0E,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,
+    0x0F,0x80,0x9F,0x4D,0x21,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x9F,0x4D,
+    0x21,0x00,0x0F,0x80,0xA9,0x11,0xB2,0x00,0x0D,0x80,0x9F,0x4D,0x23,0x00,0x0D,0x80,
+    0xA9,0x11,0xB3,0x00,0x0D,0x80,0x9F,0x4D,0x23,0x00,0x0D,0x80,0xA9,0x11,0xB4,0x00,
+    0x0B,0x80,0x9F,0x4D,0x25,0x00,0x0B,0x80,0xA9,0x11,0xB7,0x00,0x07,0x80,0x9F,0x4D,
+    0x29,0x00,0x07,0x80,0xA9,0x11,0x77,0x03,0x08,0x80,0x3D,0x45,0x4B,0x00,0x08,0x80,
+    0x0B,0x1A,0x94,0x00,0x0A,0x80,0x3D,0x45,0x49,0x00,0x0A,0x80,0x0B,0x1A,0x92,0x00,
+    0x0C,0x80,0x3D,0x45,0x47,0x00,0x0C,0x80,0x0B,0x1A,0x90,0x00,0x0E,0x80,0x3D,0x45,
+    0x45,0x00,0x0E,0x80,0x0B,0x1A,0x8F,0x00,0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,
+    0x0B,0x1A,0x8E,0x00,0x0F,0x80,0x3D,0x45,0x45,0x00,0x0F,0x80,0x0B,0x1A,0x8D,0x00,
+    0x10,0x80,0x3D,0x45,0x43,0x00,0x10,0x80,0x0B,0x1A,0x8D,0x00,0x10,0x80,0x3D,0x45,
+    0x43,0x00,0x10,0x80,0x0B,0x1A,0x8D,0x00,0x10,0x80,0x3D,0x45,0x43,0x00,0x10,0x80,
+    0x0B,0x1A,0x8E,0x00,0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,0x0B,0x1A,0x8F,0x00,
+    0x0E,0x80,0x3D,0x45,0x45,0x00,0x0E,0x80,0x0B,0x1A,0x90,0x00,0x0C,0x80,0x3D,0x45,
+    0x47,0x00,0x0C,0x80,0x0B,0x1A,0x91,0x00,0x0C,0x80,0x3D,0x45,0x47,0x00,0x0C,0x80,
+    0x0B,0x1A,0x92,0x00,0x09,0x80,0x3D,0x45,0x4B,0x00,0x09,0x80,0x0B,0x1A,0x95,0x00,
+    0x06,0x80,0x3D,0x45,0x4D,0x00,0x06,0x80,0x0B,0x1A,0x00,0x09,0x07,0x80,0xDB,0x44,
+    0x59,0x00,0x07,0x80,0x6D,0x22,0x87,0x00,0x0B,0x80,0xDB,0x44,0x55,0x00,0x0B,0x80,
+    0x6D,0x22,0x85,0x00,0x0B,0x80,0xDB,0x44,0x55,0x00,0x0B,0x80,0x6D,0x22,0x84,0x00,
+    0x0D,0x80,0xDB,0x44,0x53,0x00,0x0D,0x80,0x6D,0x22,0x82,0x00,0x0F,0x80,0xDB,0x44,
+    0x51,0x00,0x0F,0x80,0x6D,0x22,0x81,0x00,0x0F,0x80,0xDB,0x44,0x51,0x00,0x0F,0x80,
+    0x6D,0x22,0x81,0x00,0x0F,0x80,0xDB,0x44,0x51,0x00,0x0F,0x80,0x6D,0x22,0x81,0x00,
+    0x0F,0x80,0xDB,0x44,0x51,0x00,0x0F,0x80,0x6D,0x22,0x81,0x00,0x0F,0x80,0xDB,0x44,
+    0x51,0x00,0x0F,0x80,0x6D,0x22,0x81,0x00,0x0F,0x80,0xDB,0x44,0x51,0x00,0x0F,0x80,
+    0x6D,0x22,0x82,0x00,0x0D,0x80,0xDB,0x44,0x53,0x00,0x0D,0x80,0x6D,0x22,0x83,0x00,
+    0x0D,0x80,0xDB,0x44,0x53,0x00,0x0D,0x80,0x6D,0x22,0x84,0x00,0x0B,0x80,0xDB,0x44,
+    0x55,0x00,0x0B,0x80,0x6D,0x22,0x86,0x00,0x09,0x80,0xDB,0x44,0x57,0x00,0x09,0x80,
+    0x6D,0x22,0x89,0x00,0x05,0x80,0xDB,0x44,0x5B,0x00,0x05,0x80,0x6D,0x22,0x00,0x09,
+    0x08,0x80,0x79,0x3C,0x4B,0x00,0x08,0x80,0xD0,0x22,0x94,0x00,0x0A,0x80,0x79,0x3C,
+    0x49,0x00,0x0A,0x80,0xD0,0x22,0x92,0x00,0x0C,0x80,0x79,0x3C,0x47,0x00,0x0C,0x80,
+    0xD0,0x22,0x90,0x00,0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,0xD0,0x22,0x8F,0x00,
+    0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,0xD0,0x22,0x8E,0x00,0x0F,0x80,0x79,0x3C,
+    0x45,0x00,0x0F,0x80,0xD0,0x22,0x8D,0x00,0x10,0x80,0x79,0x3C,0x43,0x00,0x10,0x80,
+    0xD0,0x22,0x8D,0x00,0x10,0x80,0x79,0x3C,0x43,0x00,0x10,0x80,0xD0,0x22,0x8D,0x00,
+    0x10,0x80,0x79,0x3C,0x43,0x00,0x10,0x80,0xD0,0x22,0x8E,0x00,0x0E,0x80,0x79,0x3C,
+    0x45,0x00,0x0E,0x80,0xD0,0x22,0x8F,0x00,0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,
+    0xD0,0x22,0x90,0x00,0x0C,0x80,0x79,0x3C,0x47,0x00,0x0C,0x80,0xD0,0x22,0x91,0x00,
+    0x0C,0x80,0x79,0x3C,0x47,0x00,0x0C,0x80,0xD0,0x22,0x92,0x00,0x09,0x80,0x79,0x3C,
+    0x4B,0x00,0x09,0x80,0xD0,0x22,0x95,0x00,0x06,0x80,0x79,0x3C,0x4D,0x00,0x06,0x80,
+    0xD0,0x22,0x89,0x02,0x05,0x80,0x16,0x34,0x2B,0x00,0x05,0x80,0x32,0x2B,0xB9,0x00,
+    0x09,0x80,0x16,0x34,0x27,0x00,0x09,0x80,0x32,0x2B,0xB6,0x00,0x0B,0x80,0x16,0x34,
+    0x25,0x00,0x0B,0x80,0x32,0x2B,0xB4,0x00,0x0D,0x80,0x16,0x34,0x23,0x00,0x0D,0x80,
+    0x32,0x2B,0xB3,0x00,0x0D,0x80,0x16,0x34,0x23,0x00,0x0D,0x80,0x32,0x2B,0xB2,0x00,
+    0x0F,0x80,0x16,0x34,0x21,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x16,0x34,
+    0x21,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x16,0x34,0x0D,0x00,0x07,0x80,
+    0x94,0x33,0x0D,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x16,0x34,0x0B,0x00,
+    0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x16,0x34,
+    0x0B,0x00,0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,
+    0x16,0x34,0x0A,0x00,0x0D,0x80,0x94,0x33,0x0A,0x00,0x0F,0x80,0x32,0x2B,0xB2,0x00,
+    0x0D,0x80,0x16,0x34,0x0A,0x00,0x0F,0x80,0x94,0x33,0x0A,0x00,0x0D,0x80,0x32,0x2B,
+    0xB3,0x00,0x0D,0x80,0x16,0x34,0x0A,0x00,0x0F,0x80,0x94,0x33,0x0A,0x00,0x0D,0x80,
+    0x32,0x2B,0xB4,0x00,0x0B,0x80,0x16,0x34,0x0B,0x00,0x0F,0x80,0x94,0x33,0x0B,0x00,
+    0x0B,0x80,0x32,0x2B,0xB7,0x00,0x07,0x80,0x16,0x34,0x0D,0x00,0x0F,0x80,0x94,0x33,
+    0x0D,0x00,0x07,0x80,0x32,0x2B,0xBC,0x00,0x01,0x40,0x16,0x34,0x10,0x00,0x0F,0x80,
+    0x94,0x33,0x10,0x00,0x01,0x40,0x32,0x2B,0xD0,0x00,0x0F,0x80,0x94,0x33,0xE2,0x00,
+    0x0D,0x80,0x94,0x33,0xE3,0x00,0x0D,0x80,0x94,0x33,0xE4,0x00,0x0B,0x80,0x94,0x33,
+    0xE6,0x00,0x09,0x80,0x94,0x33,0xE9,0x00,0x05,0x80,0x94,0x33,0xD9,0x21,0x05,0x80,
+    0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,
+    0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,
+    0xB7,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x9F,0x4D,0xE7,0x00,
+    0x0B,0x80,0x9F,0x4D,0xE5,0x00,0x0B,0x80,0x9F,0x4D,0xE4,0x00,0x0D,0x80,0x9F,0x4D,
+    0xE2,0x00,0x0F,0x80,0x9F,0x4D,0xE1,0x00,0x0F,0x80,0x9F,0x4D,0xCE,0x00,0x05,0x80,
+    0x3D,0x45,0x0E,0x00,0x0F,0x80,0x9F,0x4D,0x0E,0x00,0x05,0x80,0x27,0x11,0xB9,0x00,
+    0x09,0x80,0x3D,0x45,0x0C,0x00,0x0F,0x80,0x9F,0x4D,0x0C,0x00,0x09,0x80,0x27,0x11,
+    0xB6,0x00,0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0x0B,0x00,0x0B,0x80,
+    0x27,0x11,0xB4,0x00,0x0D,0x80,0x3D,0x45,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0x0A,0x00,
+    0x0D,0x80,0x27,0x11,0xB3,0x00,0x0D,0x80,0x3D,0x45,0x0B,0x00,0x0D,0x80,0x9F,0x4D,
+    0x0B,0x00,0x0D,0x80,0x27,0x11,0xB2,0x00,0x0F,0x80,0x3D,0x45,0x0A,0x00,0x0D,0x80,
+    0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x3D,0x45,0x0B,0x00,
+    0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x3D,0x45,
+    0x0C,0x00,0x09,0x80,0x9F,0x4D,0x0C,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,
+    0x3D,0x45,0x0E,0x00,0x05,0x80,0x9F,0x4D,0x0E,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,
+    0x0F,0x80,0x3D,0x45,0x21,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x3D,0x45,
+    0x21,0x00,0x0F,0x80,0x27,0x11,0xB2,0x00,0x0D,0x80,0x3D,0x45,0x23,0x00,0x0D,0x80,
+    0x27,0x11,0xB3,0x00,0x0D,0x80,0x3D,0x45,0x23,0x00,0x0D,0x80,0x27,0x11,0xB4,0x00,
+    0x0B,0x80,0x3D,0x45,0x25,0x00,0x0B,0x80,0x27,0x11,0xB7,0x00,0x07,0x80,0x3D,0x45,
+    0x29,0x00,0x07,0x80,0x27,0x11,0x77,0x03,0x08,0x80,0xDB,0x44,0x4B,0x00,0x08,0x80,
+    0xA9,0x11,0x94,0x00,0x0A,0x80,0xDB,0x44,0x49,0x00,0x0A,0x80,0xA9,0x11,0x92,0x00,
+    0x0C,0x80,0xDB,0x44,0x47,0x00,0x0C,0x80,0xA9,0x11,0x90,0x00,0x0E,0x80,0xDB,0x44,
+    0x45,0x00,0x0E,0x80,0xA9,0x11,0x8F,0x00,0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,
+    0xA9,0x11,0x8E,0x00,0x0F,0x80,0xDB,0x44,0x45,0x00,0x0F,0x80,0xA9,0x11,0x8D,0x00,
+    0x10,0x80,0xDB,0x44,0x43,0x00,0x10,0x80,0xA9,0x11,0x8D,0x00,0x10,0x80,0xDB,0x44,
+    0x43,0x00,0x10,0x80,0xA9,0x11,0x8D,0x00,0x10,0x80,0xDB,0x44,0x43,0x00,0x10,0x80,
+    0xA9,0x11,0x8E,0x00,0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,0xA9,0x11,0x8F,0x00,
+    0x0E,0x80,0xDB,0x44,0x45,0x00,0x0E,0x80,0xA9,0x11,0x90,0x00,0x0C,0x80,0xDB,0x44,
+    0x47,0x00,0x0C,0x80,0xA9,0x11,0x91,0x00,0x0C,0x80,0xDB,0x44,0x47,0x00,0x0C,0x80,
+    0xA9,0x11,0x92,0x00,0x09,0x80,0xDB,0x44,0x4B,0x00,0x09,0x80,0xA9,0x11,0x95,0x00,
+    0x06,0x80,0xDB,0x44,0x4D,0x00,0x06,0x80,0xA9,0x11,0x00,0x09,0x07,0x80,0x79,0x3C,
+    0x59,0x00,0x07,0x80,0x0B,0x1A,0x87,0x00,0x0B,0x80,0x79,0x3C,0x55,0x00,0x0B,0x80,
+    0x0B,0x1A,0x85,0x00,0x0B,0x80,0x79,0x3C,0x55,0x00,0x0B,0x80,0x0B,0x1A,0x84,0x00,
+    0x0D,0x80,0x79,0x3C,0x53,0x00,0x0D,0x80,0x0B,0x1A,0x82,0x00,0x0F,0x80,0x79,0x3C,
+    0x51,0x00,0x0F,0x80,0x0B,0x1A,0x81,0x00,0x0F,0x80,0x79,0x3C,0x51,0x00,0x0F,0x80,
+    0x0B,0x1A,0x81,0x00,0x0F,0x80,0x79,0x3C,0x51,0x00,0x0F,0x80,0x0B,0x1A,0x81,0x00,
+    0x0F,0x80,0x79,0x3C,0x51,0x00,0x0F,0x80,0x0B,0x1A,0x81,0x00,0x0F,0x80,0x79,0x3C,
+    0x51,0x00,0x0F,0x80,0x0B,0x1A,0x81,0x00,0x0F,0x80,0x79,0x3C,0x51,0x00,0x0F,0x80,
+    0x0B,0x1A,0x82,0x00,0x0D,0x80,0x79,0x3C,0x53,0x00,0x0D,0x80,0x0B,0x1A,0x83,0x00,
+    0x0D,0x80,0x79,0x3C,0x53,0x00,0x0D,0x80,0x0B,0x1A,0x84,0x00,0x0B,0x80,0x79,0x3C,
+    0x55,0x00,0x0B,0x80,0x0B,0x1A,0x86,0x00,0x09,0x80,0x79,0x3C,0x57,0x00,0x09,0x80,
+    0x0B,0x1A,0x89,0x00,0x05,0x80,0x79,0x3C,0x5B,0x00,0x05,0x80,0x0B,0x1A,0x00,0x09,
+    0x08,0x80,0x16,0x34,0x4B,0x00,0x08,0x80,0x6D,0x22,0x94,0x00,0x0A,0x80,0x16,0x34,
+    0x49,0x00,0x0A,0x80,0x6D,0x22,0x92,0x00,0x0C,0x80,0x16,0x34,0x47,0x00,0x0C,0x80,
+    0x6D,0x22,0x90,0x00,0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,0x6D,0x22,0x8F,0x00,
+    0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,0x6D,0x22,0x8E,0x00,0x0F,0x80,0x16,0x34,
+    0x45,0x00,0x0F,0x80,0x6D,0x22,0x8D,0x00,0x10,0x80,0x16,0x34,0x43,0x00,0x10,0x80,
+    0x6D,0x22,0x8D,0x00,0x10,0x80,0x16,0x34,0x43,0x00,0x10,0x80,0x6D,0x22,0x8D,0x00,
+    0x10,0x80,0x16,0x34,0x43,0x00,0x10,0x80,0x6D,0x22,0x8E,0x00,0x0E,0x80,0x16,0x34,
+    0x45,0x00,0x0E,0x80,0x6D,0x22,0x8F,0x00,0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,
+    0x6D,0x22,0x90,0x00,0x0C,0x80,0x16,0x34,0x47,0x00,0x0C,0x80,0x6D,0x22,0x91,0x00,
+    0x0C,0x80,0x16,0x34,0x47,0x00,0x0C,0x80,0x6D,0x22,0x92,0x00,0x09,0x80,0x16,0x34,
+    0x4B,0x00,0x09,0x80,0x6D,0x22,0x95,0x00,0x06,0x80,0x16,0x34,0x4D,0x00,0x06,0x80,
+    0x6D,0x22,0x89,0x02,0x05,0x80,0x94,0x33,0x2B,0x00,0x05,0x80,0xD0,0x22,0xB9,0x00,
+    0x09,0x80,0x94,0x33,0x27,0x00,0x09,0x80,0xD0,0x22,0xB6,0x00,0x0B,0x80,0x94,0x33,
+    0x25,0x00,0x0B,0x80,0xD0,0x22,0xB4,0x00,0x0D,0x80,0x94,0x33,0x23,0x00,0x0D,0x80,
+    0xD0,0x22,0xB3,0x00,0x0D,0x80,0x94,0x33,0x23,0x00,0x0D,0x80,0xD0,0x22,0xB2,0x00,
+    0x0F,0x80,0x94,0x33,0x21,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x94,0x33,
+    0x21,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x94,0x33,0x0D,0x00,0x07,0x80,
+    0x32,0x2B,0x0D,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x94,0x33,0x0B,0x00,
+    0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x94,0x33,
+    0x0B,0x00,0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,
+    0x94,0x33,0x0A,0x00,0x0D,0x80,0x32,0x2B,0x0A,0x00,0x0F,0x80,0xD0,0x22,0xB2,0x00,
+    0x0D,0x80,0x94,0x33,0x0A,0x00,0x0F,0x80,0x32,0x2B,0x0A,0x00,0x0D,0x80,0xD0,0x22,
+    0xB3,0x00,0x0D,0x80,0x94,0x33,0x0A,0x00,0x0F,0x80,0x32,0x2B,0x0A,0x00,0x0D,0x80,
+    0xD0,0x22,0xB4,0x00,0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x32,0x2B,0x0B,0x00,
+    0x0B,0x80,0xD0,0x22,0xB7,0x00,0x07,0x80,0x94,0x33,0x0D,0x00,0x0F,0x80,0x32,0x2B,
+    0x0D,0x00,0x07,0x80,0xD0,0x22,0xBC,0x00,0x01,0x40,0x94,0x33,0x10,0x00,0x0F,0x80,
+    0x32,0x2B,0x10,0x00,0x01,0x40,0xD0,0x22,0xD0,0x00,0x0F,0x80,0x32,0x2B,0xE2,0x00,
+    0x0D,0x80,0x32,0x2B,0xE3,0x00,0x0D,0x80,0x32,0x2B,0xE4,0x00,0x0B,0x80,0x32,0x2B,
+    0xE6,0x00,0x09,0x80,0x32,0x2B,0xE9,0x00,0x05,0x80,0x32,0x2B,0xDE,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0xB1,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x3D,0x45,0xE7,0x00,
+    0x0B,0x80,0x3D,0x45,0xE5,0x00,0x0B,0x80,0x3D,0x45,0xE4,0x00,0x0D,0x80,0x3D,0x45,
+    0xE2,0x00,0x0F,0x80,0x3D,0x45,0xE1,0x00,0x0F,0x80,0x3D,0x45,0xCE,0x00,0x05,0x80,
+    0xDB,0x44,0x0E,0x00,0x0F,0x80,0x3D,0x45,0x0E,0x00,0x05,0x80,0x9F,0x4D,0xB9,0x00,
+    0x09,0x80,0xDB,0x44,0x0C,0x00,0x0F,0x80,0x3D,0x45,0x0C,0x00,0x09,0x80,0x9F,0x4D,
+    0xB6,0x00,0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x3D,0x45,0x0B,0x00,0x0B,0x80,
+    0x9F,0x4D,0xB4,0x00,0x0D,0x80,0xDB,0x44,0x0A,0x00,0x0F,0x80,0x3D,0x45,0x0A,0x00,
+    0x0D,0x80,0x9F,0x4D,0xB3,0x00,0x0D,0x80,0xDB,0x44,0x0B,0x00,0x0D,0x80,0x3D,0x45,
+    0x0B,0x00,0x0D,0x80,0x9F,0x4D,0xB2,0x00,0x0F,0x80,0xDB,0x44,0x0A,0x00,0x0D,0x80,
+    0x3D,0x45,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xDB,0x44,0x0B,0x00,
+    0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xDB,0x44,
+    0x0C,0x00,0x09,0x80,0x3D,0x45,0x0C,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,
+    0xDB,0x44,0x0E,0x00,0x05,0x80,0x3D,0x45,0x0E,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,
+    0x0F,0x80,0xDB,0x44,0x21,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xDB,0x44,
+    0x21,0x00,0x0F,0x80,0x9F,0x4D,0xB2,0x00,0x0D,0x80,0xDB,0x44,0x23,0x00,0x0D,0x80,
+    0x9F,0x4D,0xB3,0x00,0x0D,0x80,0xDB,0x44,0x23,0x00,0x0D,0x80,0x9F,0x4D,0xB4,0x00,
+    0x0B,0x80,0xDB,0x44,0x25,0x00,0x0B,0x80,0x9F,0x4D,0xB7,0x00,0x07,0x80,0xDB,0x44,
+    0x29,0x00,0x07,0x80,0x9F,0x4D,0x77,0x03,0x08,0x80,0x79,0x3C,0x4B,0x00,0x08,0x80,
+    0x27,0x11,0x94,0x00,0x0A,0x80,0x79,0x3C,0x49,0x00,0x0A,0x80,0x27,0x11,0x92,0x00,
+    0x0C,0x80,0x79,0x3C,0x47,0x00,0x0C,0x80,0x27,0x11,0x90,0x00,0x0E,0x80,0x79,0x3C,
+    0x45,0x00,0x0E,0x80,0x27,0x11,0x8F,0x00,0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,
+    0x27,0x11,0x8E,0x00,0x0F,0x80,0x79,0x3C,0x45,0x00,0x0F,0x80,0x27,0x11,0x8D,0x00,
+    0x10,0x80,0x79,0x3C,0x43,0x00,0x10,0x80,0x27,0x11,0x8D,0x00,0x10,0x80,0x79,0x3C,
+    0x43,0x00,0x10,0x80,0x27,0x11,0x8D,0x00,0x10,0x80,0x79,0x3C,0x43,0x00,0x10,0x80,
+    0x27,0x11,0x8E,0x00,0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,0x27,0x11,0x8F,0x00,
+    0x0E,0x80,0x79,0x3C,0x45,0x00,0x0E,0x80,0x27,0x11,0x90,0x00,0x0C,0x80,0x79,0x3C,
+    0x47,0x00,0x0C,0x80,0x27,0x11,0x91,0x00,0x0C,0x80,0x79,0x3C,0x47,0x00,0x0C,0x80,
+    0x27,0x11,0x92,0x00,0x09,0x80,0x79,0x3C,0x4B,0x00,0x09,0x80,0x27,0x11,0x95,0x00,
+    0x06,0x80,0x79,0x3C,0x4D,0x00,0x06,0x80,0x27,0x11,0x00,0x09,0x07,0x80,0x16,0x34,
+    0x59,0x00,0x07,0x80,0xA9,0x11,0x87,0x00,0x0B,0x80,0x16,0x34,0x55,0x00,0x0B,0x80,
+    0xA9,0x11,0x85,0x00,0x0B,0x80,0x16,0x34,0x55,0x00,0x0B,0x80,0xA9,0x11,0x84,0x00,
+    0x0D,0x80,0x16,0x34,0x53,0x00,0x0D,0x80,0xA9,0x11,0x82,0x00,0x0F,0x80,0x16,0x34,
+    0x51,0x00,0x0F,0x80,0xA9,0x11,0x81,0x00,0x0F,0x80,0x16,0x34,0x51,0x00,0x0F,0x80,
+    0xA9,0x11,0x81,0x00,0x0F,0x80,0x16,0x34,0x51,0x00,0x0F,0x80,0xA9,0x11,0x81,0x00,
+    0x0F,0x80,0x16,0x34,0x51,0x00,0x0F,0x80,0xA9,0x11,0x81,0x00,0x0F,0x80,0x16,0x34,
+    0x51,0x00,0x0F,0x80,0xA9,0x11,0x81,0x00,0x0F,0x80,0x16,0x34,0x51,0x00,0x0F,0x80,
+    0xA9,0x11,0x82,0x00,0x0D,0x80,0x16,0x34,0x53,0x00,0x0D,0x80,0xA9,0x11,0x83,0x00,
+    0x0D,0x80,0x16,0x34,0x53,0x00,0x0D,0x80,0xA9,0x11,0x84,0x00,0x0B,0x80,0x16,0x34,
+    0x55,0x00,0x0B,0x80,0xA9,0x11,0x86,0x00,0x09,0x80,0x16,0x34,0x57,0x00,0x09,0x80,
+    0xA9,0x11,0x89,0x00,0x05,0x80,0x16,0x34,0x5B,0x00,0x05,0x80,0xA9,0x11,0x00,0x09,
+    0x08,0x80,0x94,0x33,0x4B,0x00,0x08,0x80,0x0B,0x1A,0x94,0x00,0x0A,0x80,0x94,0x33,
+    0x49,0x00,0x0A,0x80,0x0B,0x1A,0x92,0x00,0x0C,0x80,0x94,0x33,0x47,0x00,0x0C,0x80,
+    0x0B,0x1A,0x90,0x00,0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,0x0B,0x1A,0x8F,0x00,
+    0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,0x0B,0x1A,0x8E,0x00,0x0F,0x80,0x94,0x33,
+    0x45,0x00,0x0F,0x80,0x0B,0x1A,0x8D,0x00,0x10,0x80,0x94,0x33,0x43,0x00,0x10,0x80,
+    0x0B,0x1A,0x8D,0x00,0x10,0x80,0x94,0x33,0x43,0x00,0x10,0x80,0x0B,0x1A,0x8D,0x00,
+    0x10,0x80,0x94,0x33,0x43,0x00,0x10,0x80,0x0B,0x1A,0x8E,0x00,0x0E,0x80,0x94,0x33,
+    0x45,0x00,0x0E,0x80,0x0B,0x1A,0x8F,0x00,0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,
+    0x0B,0x1A,0x90,0x00,0x0C,0x80,0x94,0x33,0x47,0x00,0x0C,0x80,0x0B,0x1A,0x91,0x00,
+    0x0C,0x80,0x94,0x33,0x47,0x00,0x0C,0x80,0x0B,0x1A,0x92,0x00,0x09,0x80,0x94,0x33,
+    0x4B,0x00,0x09,0x80,0x0B,0x1A,0x95,0x00,0x06,0x80,0x94,0x33,0x4D,0x00,0x06,0x80,
+    0x0B,0x1A,0x89,0x02,0x05,0x80,0x32,0x2B,0x2B,0x00,0x05,0x80,0x6D,0x22,0xB9,0x00,
+    0x09,0x80,0x32,0x2B,0x27,0x00,0x09,0x80,0x6D,0x22,0xB6,0x00,0x0B,0x80,0x32,0x2B,
+    0x25,0x00,0x0B,0x80,0x6D,0x22,0xB4,0x00,0x0D,0x80,0x32,0x2B,0x23,0x00,0x0D,0x80,
+    0x6D,0x22,0xB3,0x00,0x0D,0x80,0x32,0x2B,0x23,0x00,0x0D,0x80,0x6D,0x22,0xB2,0x00,
+    0x0F,0x80,0x32,0x2B,0x21,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0x32,0x2B,
+    0x21,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0x32,0x2B,0x0D,0x00,0x07,0x80,
+    0xD0,0x22,0x0D,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0x32,0x2B,0x0B,0x00,
+    0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,0x32,0x2B,
+    0x0B,0x00,0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x6D,0x22,0xB1,0x00,0x0F,0x80,
+    0x32,0x2B,0x0A,0x00,0x0D,0x80,0xD0,0x22,0x0A,0x00,0x0F,0x80,0x6D,0x22,0xB2,0x00,
+    0x0D,0x80,0x32,0x2B,0x0A,0x00,0x0F,0x80,0xD0,0x22,0x0A,0x00,0x0D,0x80,0x6D,0x22,
+    0xB3,0x00,0x0D,0x80,0x32,0x2B,0x0A,0x00,0x0F,0x80,0xD0,0x22,0x0A,0x00,0x0D,0x80,
+    0x6D,0x22,0xB4,0x00,0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0xD0,0x22,0x0B,0x00,
+    0x0B,0x80,0x6D,0x22,0xB7,0x00,0x07,0x80,0x32,0x2B,0x0D,0x00,0x0F,0x80,0xD0,0x22,
+    0x0D,0x00,0x07,0x80,0x6D,0x22,0xBC,0x00,0x01,0x40,0x32,0x2B,0x10,0x00,0x0F,0x80,
+    0xD0,0x22,0x10,0x00,0x01,0x40,0x6D,0x22,0xD0,0x00,0x0F,0x80,0xD0,0x22,0xE2,0x00,
+    0x0D,0x80,0xD0,0x22,0xE3,0x00,0x0D,0x80,0xD0,0x22,0xE4,0x00,0x0B,0x80,0xD0,0x22,
+    0xE6,0x00,0x09,0x80,0xD0,0x22,0xE9,0x00,0x05,0x80,0xD0,0x22,0xE4,0x21,0x05,0x80,
+    0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,
+    0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,
+    0xAC,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0xDB,0x44,0xE7,0x00,
+    0x0B,0x80,0xDB,0x44,0xE5,0x00,0x0B,0x80,0xDB,0x44,0xE4,0x00,0x0D,0x80,0xDB,0x44,
+    0xE2,0x00,0x0F,0x80,0xDB,0x44,0xE1,0x00,0x0F,0x80,0xDB,0x44,0xCE,0x00,0x05,0x80,
+    0x79,0x3C,0x0E,0x00,0x0F,0x80,0xDB,0x44,0x0E,0x00,0x05,0x80,0x3D,0x45,0xB9,0x00,
+    0x09,0x80,0x79,0x3C,0x0C,0x00,0x0F,0x80,0xDB,0x44,0x0C,0x00,0x09,0x80,0x3D,0x45,
+    0xB6,0x00,0x0B,0x80,0x79,0x3C,0x0B,0x00,0x0F,0x80,0xDB,0x44,0x0B,0x00,0x0B,0x80,
+    0x3D,0x45,0xB4,0x00,0x0D,0x80,0x79,0x3C,0x0A,0x00,0x0F,0x80,0xDB,0x44,0x0A,0x00,
+    0x0D,0x80,0x3D,0x45,0xB3,0x00,0x0D,0x80,0x79,0x3C,0x0B,0x00,0x0D,0x80,0xDB,0x44,
+    0x0B,0x00,0x0D,0x80,0x3D,0x45,0xB2,0x00,0x0F,0x80,0x79,0x3C,0x0A,0x00,0x0D,0x80,
+    0xDB,0x44,0x0A,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x79,0x3C,0x0B,0x00,
+    0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x79,0x3C,
+    0x0C,0x00,0x09,0x80,0xDB,0x44,0x0C,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,
+    0x79,0x3C,0x0E,0x00,0x05,0x80,0xDB,0x44,0x0E,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,
+    0x0F,0x80,0x79,0x3C,0x21,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x79,0x3C,
+    0x21,0x00,0x0F,0x80,0x3D,0x45,0xB2,0x00,0x0D,0x80,0x79,0x3C,0x23,0x00,0x0D,0x80,
+    0x3D,0x45,0xB3,0x00,0x0D,0x80,0x79,0x3C,0x23,0x00,0x0D,0x80,0x3D,0x45,0xB4,0x00,
+    0x0B,0x80,0x79,0x3C,0x25,0x00,0x0B,0x80,0x3D,0x45,0xB7,0x00,0x07,0x80,0x79,0x3C,
+    0x29,0x00,0x07,0x80,0x3D,0x45,0x77,0x03,0x08,0x80,0x16,0x34,0x4B,0x00,0x08,0x80,
+    0x9F,0x4D,0x94,0x00,0x0A,0x80,0x16,0x34,0x49,0x00,0x0A,0x80,0x9F,0x4D,0x92,0x00,
+    0x0C,0x80,0x16,0x34,0x47,0x00,0x0C,0x80,0x9F,0x4D,0x90,0x00,0x0E,0x80,0x16,0x34,
+    0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8F,0x00,0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,
+    0x9F,0x4D,0x8E,0x00,0x0F,0x80,0x16,0x34,0x45,0x00,0x0F,0x80,0x9F,0x4D,0x8D,0x00,
+    0x10,0x80,0x16,0x34,0x43,0x00,0x10,0x80,0x9F,0x4D,0x8D,0x00,0x10,0x80,0x16,0x34,
+    0x43,0x00,0x10,0x80,0x9F,0x4D,0x8D,0x00,0x10,0x80,0x16,0x34,0x43,0x00,0x10,0x80,
+    0x9F,0x4D,0x8E,0x00,0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8F,0x00,
+    0x0E,0x80,0x16,0x34,0x45,0x00,0x0E,0x80,0x9F,0x4D,0x90,0x00,0x0C,0x80,0x16,0x34,
+    0x47,0x00,0x0C,0x80,0x9F,0x4D,0x91,0x00,0x0C,0x80,0x16,0x34,0x47,0x00,0x0C,0x80,
+    0x9F,0x4D,0x92,0x00,0x09,0x80,0x16,0x34,0x4B,0x00,0x09,0x80,0x9F,0x4D,0x95,0x00,
+    0x06,0x80,0x16,0x34,0x4D,0x00,0x06,0x80,0x9F,0x4D,0x00,0x09,0x07,0x80,0x94,0x33,
+    0x59,0x00,0x07,0x80,0x27,0x11,0x87,0x00,0x0B,0x80,0x94,0x33,0x55,0x00,0x0B,0x80,
+    0x27,0x11,0x85,0x00,0x0B,0x80,0x94,0x33,0x55,0x00,0x0B,0x80,0x27,0x11,0x84,0x00,
+    0x0D,0x80,0x94,0x33,0x53,0x00,0x0D,0x80,0x27,0x11,0x82,0x00,0x0F,0x80,0x94,0x33,
+    0x51,0x00,0x0F,0x80,0x27,0x11,0x81,0x00,0x0F,0x80,0x94,0x33,0x51,0x00,0x0F,0x80,
+    0x27,0x11,0x81,0x00,0x0F,0x80,0x94,0x33,0x51,0x00,0x0F,0x80,0x27,0x11,0x81,0x00,
+    0x0F,0x80,0x94,0x33,0x51,0x00,0x0F,0x80,0x27,0x11,0x81,0x00,0x0F,0x80,0x94,0x33,
+    0x51,0x00,0x0F,0x80,0x27,0x11,0x81,0x00,0x0F,0x80,0x94,0x33,0x51,0x00,0x0F,0x80,
+    0x27,0x11,0x82,0x00,0x0D,0x80,0x94,0x33,0x53,0x00,0x0D,0x80,0x27,0x11,0x83,0x00,
+    0x0D,0x80,0x94,0x33,0x53,0x00,0x0D,0x80,0x27,0x11,0x84,0x00,0x0B,0x80,0x94,0x33,
+    0x55,0x00,0x0B,0x80,0x27,0x11,0x86,0x00,0x09,0x80,0x94,0x33,0x57,0x00,0x09,0x80,
+    0x27,0x11,0x89,0x00,0x05,0x80,0x94,0x33,0x5B,0x00,0x05,0x80,0x27,0x11,0x00,0x09,
+    0x08,0x80,0x32,0x2B,0x4B,0x00,0x08,0x80,0xA9,0x11,0x94,0x00,0x0A,0x80,0x32,0x2B,
+    0x49,0x00,0x0A,0x80,0xA9,0x11,0x92,0x00,0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,
+    0xA9,0x11,0x90,0x00,0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,0xA9,0x11,0x8F,0x00,
+    0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,0xA9,0x11,0x8E,0x00,0x0F,0x80,0x32,0x2B,
+    0x45,0x00,0x0F,0x80,0xA9,0x11,0x8D,0x00,0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,
+    0xA9,0x11,0x8D,0x00,0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,0xA9,0x11,0x8D,0x00,
+    0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,0xA9,0x11,0x8E,0x00,0x0E,0x80,0x32,0x2B,
+    0x45,0x00,0x0E,0x80,0xA9,0x11,0x8F,0x00,0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,
+    0xA9,0x11,0x90,0x00,0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,0xA9,0x11,0x91,0x00,
+    0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,0xA9,0x11,0x92,0x00,0x09,0x80,0x32,0x2B,
+    0x4B,0x00,0x09,0x80,0xA9,0x11,0x95,0x00,0x06,0x80,0x32,0x2B,0x4D,0x00,0x06,0x80,
+    0xA9,0x11,0x89,0x02,0x05,0x80,0xD0,0x22,0x2B,0x00,0x05,0x80,0x0B,0x1A,0xB9,0x00,
+    0x09,0x80,0xD0,0x22,0x27,0x00,0x09,0x80,0x0B,0x1A,0xB6,0x00,0x0B,0x80,0xD0,0x22,
+    0x25,0x00,0x0B,0x80,0x0B,0x1A,0xB4,0x00,0x0D,0x80,0xD0,0x22,0x23,0x00,0x0D,0x80,
+    0x0B,0x1A,0xB3,0x00,0x0D,0x80,0xD0,0x22,0x23,0x00,0x0D,0x80,0x0B,0x1A,0xB2,0x00,
+    0x0F,0x80,0xD0,0x22,0x21,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0xD0,0x22,
+    0x21,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0xD0,0x22,0x0D,0x00,0x07,0x80,
+    0x6D,0x22,0x0D,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0xD0,0x22,0x0B,0x00,
+    0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,0xD0,0x22,
+    0x0B,0x00,0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0x0B,0x1A,0xB1,0x00,0x0F,0x80,
+    0xD0,0x22,0x0A,0x00,0x0D,0x80,0x6D,0x22,0x0A,0x00,0x0F,0x80,0x0B,0x1A,0xB2,0x00,
+    0x0D,0x80,0xD0,0x22,0x0A,0x00,0x0F,0x80,0x6D,0x22,0x0A,0x00,0x0D,0x80,0x0B,0x1A,
+    0xB3,0x00,0x0D,0x80,0xD0,0x22,0x0A,0x00,0x0F,0x80,0x6D,0x22,0x0A,0x00,0x0D,0x80,
+    0x0B,0x1A,0xB4,0x00,0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x6D,0x22,0x0B,0x00,
+    0x0B,0x80,0x0B,0x1A,0xB7,0x00,0x07,0x80,0xD0,0x22,0x0D,0x00,0x0F,0x80,0x6D,0x22,
+    0x0D,0x00,0x07,0x80,0x0B,0x1A,0xBC,0x00,0x01,0x40,0xD0,0x22,0x10,0x00,0x0F,0x80,
+    0x6D,0x22,0x10,0x00,0x01,0x40,0x0B,0x1A,0xD0,0x00,0x0F,0x80,0x6D,0x22,0xE2,0x00,
+    0x0D,0x80,0x6D,0x22,0xE3,0x00,0x0D,0x80,0x6D,0x22,0xE4,0x00,0x0B,0x80,0x6D,0x22,
+    0xE6,0x00,0x09,0x80,0x6D,0x22,0xE9,0x00,0x05,0x80,0x6D,0x22,0xE9,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0xA6,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x79,0x3C,0xE7,0x00,
+    0x0B,0x80,0x79,0x3C,0xE5,0x00,0x0B,0x80,0x79,0x3C,0xE4,0x00,0x0D,0x80,0x79,0x3C,
+    0xE2,0x00,0x0F,0x80,0x79,0x3C,0xE1,0x00,0x0F,0x80,0x79,0x3C,0xCE,0x00,0x05,0x80,
+    0x16,0x34,0x0E,0x00,0x0F,0x80,0x79,0x3C,0x0E,0x00,0x05,0x80,0xDB,0x44,0xB9,0x00,
+    0x09,0x80,0x16,0x34,0x0C,0x00,0x0F,0x80,0x79,0x3C,0x0C,0x00,0x09,0x80,0xDB,0x44,
+    0xB6,0x00,0x0B,0x80,0x16,0x34,0x0B,0x00,0x0F,0x80,0x79,0x3C,0x0B,0x00,0x0B,0x80,
+    0xDB,0x44,0xB4,0x00,0x0D,0x80,0x16,0x34,0x0A,0x00,0x0F,0x80,0x79,0x3C,0x0A,0x00,
+    0x0D,0x80,0xDB,0x44,0xB3,0x00,0x0D,0x80,0x16,0x34,0x0B,0x00,0x0D,0x80,0x79,0x3C,
+    0x0B,0x00,0x0D,0x80,0xDB,0x44,0xB2,0x00,0x0F,0x80,0x16,0x34,0x0A,0x00,0x0D,0x80,
+    0x79,0x3C,0x0A,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x16,0x34,0x0B,0x00,
+    0x0B,0x80,0x79,0x3C,0x0B,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x16,0x34,
+    0x0C,0x00,0x09,0x80,0x79,0x3C,0x0C,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,
+    0x16,0x34,0x0E,0x00,0x05,0x80,0x79,0x3C,0x0E,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,
+    0x0F,0x80,0x16,0x34,0x21,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x16,0x34,
+    0x21,0x00,0x0F,0x80,0xDB,0x44,0xB2,0x00,0x0D,0x80,0x16,0x34,0x23,0x00,0x0D,0x80,
+    0xDB,0x44,0xB3,0x00,0x0D,0x80,0x16,0x34,0x23,0x00,0x0D,0x80,0xDB,0x44,0xB4,0x00,
+    0x0B,0x80,0x16,0x34,0x25,0x00,0x0B,0x80,0xDB,0x44,0xB7,0x00,0x07,0x80,0x16,0x34,
+    0x29,0x00,0x07,0x80,0xDB,0x44,0x77,0x03,0x08,0x80,0x94,0x33,0x4B,0x00,0x08,0x80,
+    0x3D,0x45,0x94,0x00,0x0A,0x80,0x94,0x33,0x49,0x00,0x0A,0x80,0x3D,0x45,0x92,0x00,
+    0x0C,0x80,0x94,0x33,0x47,0x00,0x0C,0x80,0x3D,0x45,0x90,0x00,0x0E,0x80,0x94,0x33,
+    0x45,0x00,0x0E,0x80,0x3D,0x45,0x8F,0x00,0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,
+    0x3D,0x45,0x8E,0x00,0x0F,0x80,0x94,0x33,0x45,0x00,0x0F,0x80,0x3D,0x45,0x8D,0x00,
+    0x10,0x80,0x94,0x33,0x43,0x00,0x10,0x80,0x3D,0x45,0x8D,0x00,0x10,0x80,0x94,0x33,
+    0x43,0x00,0x10,0x80,0x3D,0x45,0x8D,0x00,0x10,0x80,0x94,0x33,0x43,0x00,0x10,0x80,
+    0x3D,0x45,0x8E,0x00,0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,0x3D,0x45,0x8F,0x00,
+    0x0E,0x80,0x94,0x33,0x45,0x00,0x0E,0x80,0x3D,0x45,0x90,0x00,0x0C,0x80,0x94,0x33,
+    0x47,0x00,0x0C,0x80,0x3D,0x45,0x91,0x00,0x0C,0x80,0x94,0x33,0x47,0x00,0x0C,0x80,
+    0x3D,0x45,0x92,0x00,0x09,0x80,0x94,0x33,0x4B,0x00,0x09,0x80,0x3D,0x45,0x95,0x00,
+    0x06,0x80,0x94,0x33,0x4D,0x00,0x06,0x80,0x3D,0x45,0x00,0x09,0x07,0x80,0x32,0x2B,
+    0x59,0x00,0x07,0x80,0x9F,0x4D,0x87,0x00,0x0B,0x80,0x32,0x2B,0x55,0x00,0x0B,0x80,
+    0x9F,0x4D,0x85,0x00,0x0B,0x80,0x32,0x2B,0x55,0x00,0x0B,0x80,0x9F,0x4D,0x84,0x00,
+    0x0D,0x80,0x32,0x2B,0x53,0x00,0x0D,0x80,0x9F,0x4D,0x82,0x00,0x0F,0x80,0x32,0x2B,
+    0x51,0x00,0x0F,0x80,0x9F,0x4D,0x81,0x00,0x0F,0x80,0x32,0x2B,0x51,0x00,0x0F,0x80,
+    0x9F,0x4D,0x81,0x00,0x0F,0x80,0x32,0x2B,0x51,0x00,0x0F,0x80,0x9F,0x4D,0x81,0x00,
+    0x0F,0x80,0x32,0x2B,0x51,0x00,0x0F,0x80,0x9F,0x4D,0x81,0x00,0x0F,0x80,0x32,0x2B,
+    0x51,0x00,0x0F,0x80,0x9F,0x4D,0x81,0x00,0x0F,0x80,0x32,0x2B,0x51,0x00,0x0F,0x80,
+    0x9F,0x4D,0x82,0x00,0x0D,0x80,0x32,0x2B,0x53,0x00,0x0D,0x80,0x9F,0x4D,0x83,0x00,
+    0x0D,0x80,0x32,0x2B,0x53,0x00,0x0D,0x80,0x9F,0x4D,0x84,0x00,0x0B,0x80,0x32,0x2B,
+    0x55,0x00,0x0B,0x80,0x9F,0x4D,0x86,0x00,0x09,0x80,0x32,0x2B,0x57,0x00,0x09,0x80,
+    0x9F,0x4D,0x89,0x00,0x05,0x80,0x32,0x2B,0x5B,0x00,0x05,0x80,0x9F,0x4D,0x00,0x09,
+    0x08,0x80,0xD0,0x22,0x4B,0x00,0x08,0x80,0x27,0x11,0x94,0x00,0x0A,0x80,0xD0,0x22,
+    0x49,0x00,0x0A,0x80,0x27,0x11,0x92,0x00,0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,
+    0x27,0x11,0x90,0x00,0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,0x27,0x11,0x8F,0x00,
+    0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,0x27,0x11,0x8E,0x00,0x0F,0x80,0xD0,0x22,
+    0x45,0x00,0x0F,0x80,0x27,0x11,0x8D,0x00,0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,
+    0x27,0x11,0x8D,0x00,0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,0x27,0x11,0x8D,0x00,
+    0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,0x27,0x11,0x8E,0x00,0x0E,0x80,0xD0,0x22,
+    0x45,0x00,0x0E,0x80,0x27,0x11,0x8F,0x00,0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,
+    0x27,0x11,0x90,0x00,0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,0x27,0x11,0x91,0x00,
+    0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,0x27,0x11,0x92,0x00,0x09,0x80,0xD0,0x22,
+    0x4B,0x00,0x09,0x80,0x27,0x11,0x95,0x00,0x06,0x80,0xD0,0x22,0x4D,0x00,0x06,0x80,
+    0x27,0x11,0x89,0x02,0x05,0x80,0x6D,0x22,0x2B,0x00,0x05,0x80,0xA9,0x11,0xB9,0x00,
+    0x09,0x80,0x6D,0x22,0x27,0x00,0x09,0x80,0xA9,0x11,0xB6,0x00,0x0B,0x80,0x6D,0x22,
+    0x25,0x00,0x0B,0x80,0xA9,0x11,0xB4,0x00,0x0D,0x80,0x6D,0x22,0x23,0x00,0x0D,0x80,
+    0xA9,0x11,0xB3,0x00,0x0D,0x80,0x6D,0x22,0x23,0x00,0x0D,0x80,0xA9,0x11,0xB2,0x00,
+    0x0F,0x80,0x6D,0x22,0x21,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x6D,0x22,
+    0x21,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x6D,0x22,0x0D,0x00,0x07,0x80,
+    0x0B,0x1A,0x0D,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x6D,0x22,0x0B,0x00,
+    0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,0x6D,0x22,
+    0x0B,0x00,0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0xA9,0x11,0xB1,0x00,0x0F,0x80,
+    0x6D,0x22,0x0A,0x00,0x0D,0x80,0x0B,0x1A,0x0A,0x00,0x0F,0x80,0xA9,0x11,0xB2,0x00,
+    0x0D,0x80,0x6D,0x22,0x0A,0x00,0x0F,0x80,0x0B,0x1A,0x0A,0x00,0x0D,0x80,0xA9,0x11,
+    0xB3,0x00,0x0D,0x80,0x6D,0x22,0x0A,0x00,0x0F,0x80,0x0B,0x1A,0x0A,0x00,0x0D,0x80,
+    0xA9,0x11,0xB4,0x00,0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0x0B,0x1A,0x0B,0x00,
+    0x0B,0x80,0xA9,0x11,0xB7,0x00,0x07,0x80,0x6D,0x22,0x0D,0x00,0x0F,0x80,0x0B,0x1A,
+    0x0D,0x00,0x07,0x80,0xA9,0x11,0xBC,0x00,0x01,0x40,0x6D,0x22,0x10,0x00,0x0F,0x80,
+    0x0B,0x1A,0x10,0x00,0x01,0x40,0xA9,0x11,0xD0,0x00,0x0F,0x80,0x0B,0x1A,0xE2,0x00,
+    0x0D,0x80,0x0B,0x1A,0xE3,0x00,0x0D,0x80,0x0B,0x1A,0xE4,0x00,0x0B,0x80,0x0B,0x1A,
+    0xE6,0x00,0x09,0x80,0x0B,0x1A,0xE9,0x00,0x05,0x80,0x0B,0x1A,0xEF,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0xA0,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x16,0x34,0xE7,0x00,
+    0x0B,0x80,0x16,0x34,0xE5,0x00,0x0B,0x80,0x16,0x34,0xE4,0x00,0x0D,0x80,0x16,0x34,
+    0xE2,0x00,0x0F,0x80,0x16,0x34,0xE1,0x00,0x0F,0x80,0x16,0x34,0xCE,0x00,0x05,0x80,
+    0x94,0x33,0x0E,0x00,0x0F,0x80,0x16,0x34,0x0E,0x00,0x05,0x80,0x79,0x3C,0xB9,0x00,
+    0x09,0x80,0x94,0x33,0x0C,0x00,0x0F,0x80,0x16,0x34,0x0C,0x00,0x09,0x80,0x79,0x3C,
+    0xB6,0x00,0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x16,0x34,0x0B,0x00,0x0B,0x80,
+    0x79,0x3C,0xB4,0x00,0x0D,0x80,0x94,0x33,0x0A,0x00,0x0F,0x80,0x16,0x34,0x0A,0x00,
+    0x0D,0x80,0x79,0x3C,0xB3,0x00,0x0D,0x80,0x94,0x33,0x0B,0x00,0x0D,0x80,0x16,0x34,
+    0x0B,0x00,0x0D,0x80,0x79,0x3C,0xB2,0x00,0x0F,0x80,0x94,0x33,0x0A,0x00,0x0D,0x80,
+    0x16,0x34,0x0A,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x94,0x33,0x0B,0x00,
+    0x0B,0x80,0x16,0x34,0x0B,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x94,0x33,
+    0x0C,0x00,0x09,0x80,0x16,0x34,0x0C,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,
+    0x94,0x33,0x0E,0x00,0x05,0x80,0x16,0x34,0x0E,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,
+    0x0F,0x80,0x94,0x33,0x21,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x94,0x33,
+    0x21,0x00,0x0F,0x80,0x79,0x3C,0xB2,0x00,0x0D,0x80,0x94,0x33,0x23,0x00,0x0D,0x80,
+    0x79,0x3C,0xB3,0x00,0x0D,0x80,0x94,0x33,0x23,0x00,0x0D,0x80,0x79,0x3C,0xB4,0x00,
+    0x0B,0x80,0x94,0x33,0x25,0x00,0x0B,0x80,0x79,0x3C,0xB7,0x00,0x07,0x80,0x94,0x33,
+    0x29,0x00,0x07,0x80,0x79,0x3C,0x77,0x03,0x08,0x80,0x32,0x2B,0x4B,0x00,0x08,0x80,
+    0xDB,0x44,0x94,0x00,0x0A,0x80,0x32,0x2B,0x49,0x00,0x0A,0x80,0xDB,0x44,0x92,0x00,
+    0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,0xDB,0x44,0x90,0x00,0x0E,0x80,0x32,0x2B,
+    0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,
+    0xDB,0x44,0x8E,0x00,0x0F,0x80,0x32,0x2B,0x45,0x00,0x0F,0x80,0xDB,0x44,0x8D,0x00,
+    0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,0xDB,0x44,0x8D,0x00,0x10,0x80,0x32,0x2B,
+    0x43,0x00,0x10,0x80,0xDB,0x44,0x8D,0x00,0x10,0x80,0x32,0x2B,0x43,0x00,0x10,0x80,
+    0xDB,0x44,0x8E,0x00,0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,
+    0x0E,0x80,0x32,0x2B,0x45,0x00,0x0E,0x80,0xDB,0x44,0x90,0x00,0x0C,0x80,0x32,0x2B,
+    0x47,0x00,0x0C,0x80,0xDB,0x44,0x91,0x00,0x0C,0x80,0x32,0x2B,0x47,0x00,0x0C,0x80,
+    0xDB,0x44,0x92,0x00,0x09,0x80,0x32,0x2B,0x4B,0x00,0x09,0x80,0xDB,0x44,0x95,0x00,
+    0x06,0x80,0x32,0x2B,0x4D,0x00,0x06,0x80,0xDB,0x44,0x00,0x09,0x07,0x80,0xD0,0x22,
+    0x59,0x00,0x07,0x80,0x3D,0x45,0x87,0x00,0x0B,0x80,0xD0,0x22,0x55,0x00,0x0B,0x80,
+    0x3D,0x45,0x85,0x00,0x0B,0x80,0xD0,0x22,0x55,0x00,0x0B,0x80,0x3D,0x45,0x84,0x00,
+    0x0D,0x80,0xD0,0x22,0x53,0x00,0x0D,0x80,0x3D,0x45,0x82,0x00,0x0F,0x80,0xD0,0x22,
+    0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,
+    0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,
+    0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,
+    0x51,0x00,0x0F,0x80,0x3D,0x45,0x81,0x00,0x0F,0x80,0xD0,0x22,0x51,0x00,0x0F,0x80,
+    0x3D,0x45,0x82,0x00,0x0D,0x80,0xD0,0x22,0x53,0x00,0x0D,0x80,0x3D,0x45,0x83,0x00,
+    0x0D,0x80,0xD0,0x22,0x53,0x00,0x0D,0x80,0x3D,0x45,0x84,0x00,0x0B,0x80,0xD0,0x22,
+    0x55,0x00,0x0B,0x80,0x3D,0x45,0x86,0x00,0x09,0x80,0xD0,0x22,0x57,0x00,0x09,0x80,
+    0x3D,0x45,0x89,0x00,0x05,0x80,0xD0,0x22,0x5B,0x00,0x05,0x80,0x3D,0x45,0x00,0x09,
+    0x08,0x80,0x6D,0x22,0x4B,0x00,0x08,0x80,0x9F,0x4D,0x94,0x00,0x0A,0x80,0x6D,0x22,
+    0x49,0x00,0x0A,0x80,0x9F,0x4D,0x92,0x00,0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,
+    0x9F,0x4D,0x90,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8F,0x00,
+    0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8E,0x00,0x0F,0x80,0x6D,0x22,
+    0x45,0x00,0x0F,0x80,0x9F,0x4D,0x8D,0x00,0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,
+    0x9F,0x4D,0x8D,0x00,0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,0x9F,0x4D,0x8D,0x00,
+    0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,0x9F,0x4D,0x8E,0x00,0x0E,0x80,0x6D,0x22,
+    0x45,0x00,0x0E,0x80,0x9F,0x4D,0x8F,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,
+    0x9F,0x4D,0x90,0x00,0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,0x9F,0x4D,0x91,0x00,
+    0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,0x9F,0x4D,0x92,0x00,0x09,0x80,0x6D,0x22,
+    0x4B,0x00,0x09,0x80,0x9F,0x4D,0x95,0x00,0x06,0x80,0x6D,0x22,0x4D,0x00,0x06,0x80,
+    0x9F,0x4D,0x89,0x02,0x05,0x80,0x0B,0x1A,0x2B,0x00,0x05,0x80,0x27,0x11,0xB9,0x00,
+    0x09,0x80,0x0B,0x1A,0x27,0x00,0x09,0x80,0x27,0x11,0xB6,0x00,0x0B,0x80,0x0B,0x1A,
+    0x25,0x00,0x0B,0x80,0x27,0x11,0xB4,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,
+    0x27,0x11,0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,0x27,0x11,0xB2,0x00,
+    0x0F,0x80,0x0B,0x1A,0x21,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x21,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,0x0D,0x00,0x07,0x80,
+    0xA9,0x11,0x0D,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,0x0B,0x00,
+    0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x0B,0x00,0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x27,0x11,0xB1,0x00,0x0F,0x80,
+    0x0B,0x1A,0x0A,0x00,0x0D,0x80,0xA9,0x11,0x0A,0x00,0x0F,0x80,0x27,0x11,0xB2,0x00,
+    0x0D,0x80,0x0B,0x1A,0x0A,0x00,0x0F,0x80,0xA9,0x11,0x0A,0x00,0x0D,0x80,0x27,0x11,
+    0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x0A,0x00,0x0F,0x80,0xA9,0x11,0x0A,0x00,0x0D,0x80,
+    0x27,0x11,0xB4,0x00,0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0xA9,0x11,0x0B,0x00,
+    0x0B,0x80,0x27,0x11,0xB7,0x00,0x07,0x80,0x0B,0x1A,0x0D,0x00,0x0F,0x80,0xA9,0x11,
+    0x0D,0x00,0x07,0x80,0x27,0x11,0xBC,0x00,0x01,0x40,0x0B,0x1A,0x10,0x00,0x0F,0x80,
+    0xA9,0x11,0x10,0x00,0x01,0x40,0x27,0x11,0xD0,0x00,0x0F,0x80,0xA9,0x11,0xE2,0x00,
+    0x0D,0x80,0xA9,0x11,0xE3,0x00,0x0D,0x80,0xA9,0x11,0xE4,0x00,0x0B,0x80,0xA9,0x11,
+    0xE6,0x00,0x09,0x80,0xA9,0x11,0xE9,0x00,0x05,0x80,0xA9,0x11,0xF5,0x21,0x05,0x80,
+    0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,
+    0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,
+    0x9B,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x94,0x33,0xE7,0x00,
+    0x0B,0x80,0x94,0x33,0xE5,0x00,0x0B,0x80,0x94,0x33,0xE4,0x00,0x0D,0x80,0x94,0x33,
+    0xE2,0x00,0x0F,0x80,0x94,0x33,0xE1,0x00,0x0F,0x80,0x94,0x33,0xCE,0x00,0x05,0x80,
+    0x32,0x2B,0x0E,0x00,0x0F,0x80,0x94,0x33,0x0E,0x00,0x05,0x80,0x16,0x34,0xB9,0x00,
+    0x09,0x80,0x32,0x2B,0x0C,0x00,0x0F,0x80,0x94,0x33,0x0C,0x00,0x09,0x80,0x16,0x34,
+    0xB6,0x00,0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0x94,0x33,0x0B,0x00,0x0B,0x80,
+    0x16,0x34,0xB4,0x00,0x0D,0x80,0x32,0x2B,0x0A,0x00,0x0F,0x80,0x94,0x33,0x0A,0x00,
+    0x0D,0x80,0x16,0x34,0xB3,0x00,0x0D,0x80,0x32,0x2B,0x0B,0x00,0x0D,0x80,0x94,0x33,
+    0x0B,0x00,0x0D,0x80,0x16,0x34,0xB2,0x00,0x0F,0x80,0x32,0x2B,0x0A,0x00,0x0D,0x80,
+    0x94,0x33,0x0A,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0x32,0x2B,0x0B,0x00,
+    0x0B,0x80,0x94,0x33,0x0B,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0x32,0x2B,
+    0x0C,0x00,0x09,0x80,0x94,0x33,0x0C,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,
+    0x32,0x2B,0x0E,0x00,0x05,0x80,0x94,0x33,0x0E,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,
+    0x0F,0x80,0x32,0x2B,0x21,0x00,0x0F,0x80,0x16,0x34,0xB1,0x00,0x0F,0x80,0x32,0x2B,
+    0x21,0x00,0x0F,0x80,0x16,0x34,0xB2,0x00,0x0D,0x80,0x32,0x2B,0x23,0x00,0x0D,0x80,
+    0x16,0x34,0xB3,0x00,0x0D,0x80,0x32,0x2B,0x23,0x00,0x0D,0x80,0x16,0x34,0xB4,0x00,
+    0x0B,0x80,0x32,0x2B,0x25,0x00,0x0B,0x80,0x16,0x34,0xB7,0x00,0x07,0x80,0x32,0x2B,
+    0x29,0x00,0x07,0x80,0x16,0x34,0x77,0x03,0x08,0x80,0xD0,0x22,0x4B,0x00,0x08,0x80,
+    0x79,0x3C,0x94,0x00,0x0A,0x80,0xD0,0x22,0x49,0x00,0x0A,0x80,0x79,0x3C,0x92,0x00,
+    0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,0x79,0x3C,0x90,0x00,0x0E,0x80,0xD0,0x22,
+    0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,
+    0x79,0x3C,0x8E,0x00,0x0F,0x80,0xD0,0x22,0x45,0x00,0x0F,0x80,0x79,0x3C,0x8D,0x00,
+    0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,0x79,0x3C,0x8D,0x00,0x10,0x80,0xD0,0x22,
+    0x43,0x00,0x10,0x80,0x79,0x3C,0x8D,0x00,0x10,0x80,0xD0,0x22,0x43,0x00,0x10,0x80,
+    0x79,0x3C,0x8E,0x00,0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,
+    0x0E,0x80,0xD0,0x22,0x45,0x00,0x0E,0x80,0x79,0x3C,0x90,0x00,0x0C,0x80,0xD0,0x22,
+    0x47,0x00,0x0C,0x80,0x79,0x3C,0x91,0x00,0x0C,0x80,0xD0,0x22,0x47,0x00,0x0C,0x80,
+    0x79,0x3C,0x92,0x00,0x09,0x80,0xD0,0x22,0x4B,0x00,0x09,0x80,0x79,0x3C,0x95,0x00,
+    0x06,0x80,0xD0,0x22,0x4D,0x00,0x06,0x80,0x79,0x3C,0x00,0x09,0x07,0x80,0x6D,0x22,
+    0x59,0x00,0x07,0x80,0xDB,0x44,0x87,0x00,0x0B,0x80,0x6D,0x22,0x55,0x00,0x0B,0x80,
+    0xDB,0x44,0x85,0x00,0x0B,0x80,0x6D,0x22,0x55,0x00,0x0B,0x80,0xDB,0x44,0x84,0x00,
+    0x0D,0x80,0x6D,0x22,0x53,0x00,0x0D,0x80,0xDB,0x44,0x82,0x00,0x0F,0x80,0x6D,0x22,
+    0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,
+    0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,
+    0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,
+    0x51,0x00,0x0F,0x80,0xDB,0x44,0x81,0x00,0x0F,0x80,0x6D,0x22,0x51,0x00,0x0F,0x80,
+    0xDB,0x44,0x82,0x00,0x0D,0x80,0x6D,0x22,0x53,0x00,0x0D,0x80,0xDB,0x44,0x83,0x00,
+    0x0D,0x80,0x6D,0x22,0x53,0x00,0x0D,0x80,0xDB,0x44,0x84,0x00,0x0B,0x80,0x6D,0x22,
+    0x55,0x00,0x0B,0x80,0xDB,0x44,0x86,0x00,0x09,0x80,0x6D,0x22,0x57,0x00,0x09,0x80,
+    0xDB,0x44,0x89,0x00,0x05,0x80,0x6D,0x22,0x5B,0x00,0x05,0x80,0xDB,0x44,0x00,0x09,
+    0x08,0x80,0x0B,0x1A,0x4B,0x00,0x08,0x80,0x3D,0x45,0x94,0x00,0x0A,0x80,0x0B,0x1A,
+    0x49,0x00,0x0A,0x80,0x3D,0x45,0x92,0x00,0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,
+    0x3D,0x45,0x90,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x3D,0x45,0x8F,0x00,
+    0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x3D,0x45,0x8E,0x00,0x0F,0x80,0x0B,0x1A,
+    0x45,0x00,0x0F,0x80,0x3D,0x45,0x8D,0x00,0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,
+    0x3D,0x45,0x8D,0x00,0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,0x3D,0x45,0x8D,0x00,
+    0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,0x3D,0x45,0x8E,0x00,0x0E,0x80,0x0B,0x1A,
+    0x45,0x00,0x0E,0x80,0x3D,0x45,0x8F,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,
+    0x3D,0x45,0x90,0x00,0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,0x3D,0x45,0x91,0x00,
+    0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,0x3D,0x45,0x92,0x00,0x09,0x80,0x0B,0x1A,
+    0x4B,0x00,0x09,0x80,0x3D,0x45,0x95,0x00,0x06,0x80,0x0B,0x1A,0x4D,0x00,0x06,0x80,
+    0x3D,0x45,0x89,0x02,0x05,0x80,0xA9,0x11,0x2B,0x00,0x05,0x80,0x9F,0x4D,0xB9,0x00,
+    0x09,0x80,0xA9,0x11,0x27,0x00,0x09,0x80,0x9F,0x4D,0xB6,0x00,0x0B,0x80,0xA9,0x11,
+    0x25,0x00,0x0B,0x80,0x9F,0x4D,0xB4,0x00,0x0D,0x80,0xA9,0x11,0x23,0x00,0x0D,0x80,
+    0x9F,0x4D,0xB3,0x00,0x0D,0x80,0xA9,0x11,0x23,0x00,0x0D,0x80,0x9F,0x4D,0xB2,0x00,
+    0x0F,0x80,0xA9,0x11,0x21,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,
+    0x21,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,0x0D,0x00,0x07,0x80,
+    0x27,0x11,0x0D,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,0x0B,0x00,
+    0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,0xA9,0x11,
+    0x0B,0x00,0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0xB1,0x00,0x0F,0x80,
+    0xA9,0x11,0x0A,0x00,0x0D,0x80,0x27,0x11,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0xB2,0x00,
+    0x0D,0x80,0xA9,0x11,0x0A,0x00,0x0F,0x80,0x27,0x11,0x0A,0x00,0x0D,0x80,0x9F,0x4D,
+    0xB3,0x00,0x0D,0x80,0xA9,0x11,0x0A,0x00,0x0F,0x80,0x27,0x11,0x0A,0x00,0x0D,0x80,
+    0x9F,0x4D,0xB4,0x00,0x0B,0x80,0xA9,0x11,0x0B,0x00,0x0F,0x80,0x27,0x11,0x0B,0x00,
+    0x0B,0x80,0x9F,0x4D,0xB7,0x00,0x07,0x80,0xA9,0x11,0x0D,0x00,0x0F,0x80,0x27,0x11,
+    0x0D,0x00,0x07,0x80,0x9F,0x4D,0xBC,0x00,0x01,0x40,0xA9,0x11,0x10,0x00,0x0F,0x80,
+    0x27,0x11,0x10,0x00,0x01,0x40,0x9F,0x4D,0xD0,0x00,0x0F,0x80,0x27,0x11,0xE2,0x00,
+    0x0D,0x80,0x27,0x11,0xE3,0x00,0x0D,0x80,0x27,0x11,0xE4,0x00,0x0B,0x80,0x27,0x11,
+    0xE6,0x00,0x09,0x80,0x27,0x11,0xE9,0x00,0x05,0x80,0x27,0x11,0xFA,0x21,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0x95,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x32,0x2B,0xE7,0x00,
+    0x0B,0x80,0x32,0x2B,0xE5,0x00,0x0B,0x80,0x32,0x2B,0xE4,0x00,0x0D,0x80,0x32,0x2B,
+    0xE2,0x00,0x0F,0x80,0x32,0x2B,0xE1,0x00,0x0F,0x80,0x32,0x2B,0xCE,0x00,0x05,0x80,
+    0xD0,0x22,0x0E,0x00,0x0F,0x80,0x32,0x2B,0x0E,0x00,0x05,0x80,0x94,0x33,0xB9,0x00,
+    0x09,0x80,0xD0,0x22,0x0C,0x00,0x0F,0x80,0x32,0x2B,0x0C,0x00,0x09,0x80,0x94,0x33,
+    0xB6,0x00,0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x32,0x2B,0x0B,0x00,0x0B,0x80,
+    0x94,0x33,0xB4,0x00,0x0D,0x80,0xD0,0x22,0x0A,0x00,0x0F,0x80,0x32,0x2B,0x0A,0x00,
+    0x0D,0x80,0x94,0x33,0xB3,0x00,0x0D,0x80,0xD0,0x22,0x0B,0x00,0x0D,0x80,0x32,0x2B,
+    0x0B,0x00,0x0D,0x80,0x94,0x33,0xB2,0x00,0x0F,0x80,0xD0,0x22,0x0A,0x00,0x0D,0x80,
+    0x32,0x2B,0x0A,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0xD0,0x22,0x0B,0x00,
+    0x0B,0x80,0x32,0x2B,0x0B,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0xD0,0x22,
+    0x0C,0x00,0x09,0x80,0x32,0x2B,0x0C,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,
+    0xD0,0x22,0x0E,0x00,0x05,0x80,0x32,0x2B,0x0E,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,
+    0x0F,0x80,0xD0,0x22,0x21,0x00,0x0F,0x80,0x94,0x33,0xB1,0x00,0x0F,0x80,0xD0,0x22,
+    0x21,0x00,0x0F,0x80,0x94,0x33,0xB2,0x00,0x0D,0x80,0xD0,0x22,0x23,0x00,0x0D,0x80,
+    0x94,0x33,0xB3,0x00,0x0D,0x80,0xD0,0x22,0x23,0x00,0x0D,0x80,0x94,0x33,0xB4,0x00,
+    0x0B,0x80,0xD0,0x22,0x25,0x00,0x0B,0x80,0x94,0x33,0xB7,0x00,0x07,0x80,0xD0,0x22,
+    0x29,0x00,0x07,0x80,0x94,0x33,0x77,0x03,0x08,0x80,0x6D,0x22,0x4B,0x00,0x08,0x80,
+    0x16,0x34,0x94,0x00,0x0A,0x80,0x6D,0x22,0x49,0x00,0x0A,0x80,0x16,0x34,0x92,0x00,
+    0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,0x16,0x34,0x90,0x00,0x0E,0x80,0x6D,0x22,
+    0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,
+    0x16,0x34,0x8E,0x00,0x0F,0x80,0x6D,0x22,0x45,0x00,0x0F,0x80,0x16,0x34,0x8D,0x00,
+    0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,0x16,0x34,0x8D,0x00,0x10,0x80,0x6D,0x22,
+    0x43,0x00,0x10,0x80,0x16,0x34,0x8D,0x00,0x10,0x80,0x6D,0x22,0x43,0x00,0x10,0x80,
+    0x16,0x34,0x8E,0x00,0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,
+    0x0E,0x80,0x6D,0x22,0x45,0x00,0x0E,0x80,0x16,0x34,0x90,0x00,0x0C,0x80,0x6D,0x22,
+    0x47,0x00,0x0C,0x80,0x16,0x34,0x91,0x00,0x0C,0x80,0x6D,0x22,0x47,0x00,0x0C,0x80,
+    0x16,0x34,0x92,0x00,0x09,0x80,0x6D,0x22,0x4B,0x00,0x09,0x80,0x16,0x34,0x95,0x00,
+    0x06,0x80,0x6D,0x22,0x4D,0x00,0x06,0x80,0x16,0x34,0x00,0x09,0x07,0x80,0x0B,0x1A,
+    0x59,0x00,0x07,0x80,0x79,0x3C,0x87,0x00,0x0B,0x80,0x0B,0x1A,0x55,0x00,0x0B,0x80,
+    0x79,0x3C,0x85,0x00,0x0B,0x80,0x0B,0x1A,0x55,0x00,0x0B,0x80,0x79,0x3C,0x84,0x00,
+    0x0D,0x80,0x0B,0x1A,0x53,0x00,0x0D,0x80,0x79,0x3C,0x82,0x00,0x0F,0x80,0x0B,0x1A,
+    0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,
+    0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,
+    0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,
+    0x51,0x00,0x0F,0x80,0x79,0x3C,0x81,0x00,0x0F,0x80,0x0B,0x1A,0x51,0x00,0x0F,0x80,
+    0x79,0x3C,0x82,0x00,0x0D,0x80,0x0B,0x1A,0x53,0x00,0x0D,0x80,0x79,0x3C,0x83,0x00,
+    0x0D,0x80,0x0B,0x1A,0x53,0x00,0x0D,0x80,0x79,0x3C,0x84,0x00,0x0B,0x80,0x0B,0x1A,
+    0x55,0x00,0x0B,0x80,0x79,0x3C,0x86,0x00,0x09,0x80,0x0B,0x1A,0x57,0x00,0x09,0x80,
+    0x79,0x3C,0x89,0x00,0x05,0x80,0x0B,0x1A,0x5B,0x00,0x05,0x80,0x79,0x3C,0x00,0x09,
+    0x08,0x80,0xA9,0x11,0x4B,0x00,0x08,0x80,0xDB,0x44,0x94,0x00,0x0A,0x80,0xA9,0x11,
+    0x49,0x00,0x0A,0x80,0xDB,0x44,0x92,0x00,0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,
+    0xDB,0x44,0x90,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,
+    0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0xDB,0x44,0x8E,0x00,0x0F,0x80,0xA9,0x11,
+    0x45,0x00,0x0F,0x80,0xDB,0x44,0x8D,0x00,0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,
+    0xDB,0x44,0x8D,0x00,0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,0xDB,0x44,0x8D,0x00,
+    0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,0xDB,0x44,0x8E,0x00,0x0E,0x80,0xA9,0x11,
+    0x45,0x00,0x0E,0x80,0xDB,0x44,0x8F,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,
+    0xDB,0x44,0x90,0x00,0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,0xDB,0x44,0x91,0x00,
+    0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,0xDB,0x44,0x92,0x00,0x09,0x80,0xA9,0x11,
+    0x4B,0x00,0x09,0x80,0xDB,0x44,0x95,0x00,0x06,0x80,0xA9,0x11,0x4D,0x00,0x06,0x80,
+    0xDB,0x44,0x89,0x02,0x05,0x80,0x27,0x11,0x2B,0x00,0x05,0x80,0x3D,0x45,0xB9,0x00,
+    0x09,0x80,0x27,0x11,0x27,0x00,0x09,0x80,0x3D,0x45,0xB6,0x00,0x0B,0x80,0x27,0x11,
+    0x25,0x00,0x0B,0x80,0x3D,0x45,0xB4,0x00,0x0D,0x80,0x27,0x11,0x23,0x00,0x0D,0x80,
+    0x3D,0x45,0xB3,0x00,0x0D,0x80,0x27,0x11,0x23,0x00,0x0D,0x80,0x3D,0x45,0xB2,0x00,
+    0x0F,0x80,0x27,0x11,0x21,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,
+    0x21,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,0x0D,0x00,0x07,0x80,
+    0x9F,0x4D,0x0D,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,0x0B,0x00,
+    0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,0x27,0x11,
+    0x0B,0x00,0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x3D,0x45,0xB1,0x00,0x0F,0x80,
+    0x27,0x11,0x0A,0x00,0x0D,0x80,0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x3D,0x45,0xB2,0x00,
+    0x0D,0x80,0x27,0x11,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0x0A,0x00,0x0D,0x80,0x3D,0x45,
+    0xB3,0x00,0x0D,0x80,0x27,0x11,0x0A,0x00,0x0F,0x80,0x9F,0x4D,0x0A,0x00,0x0D,0x80,
+    0x3D,0x45,0xB4,0x00,0x0B,0x80,0x27,0x11,0x0B,0x00,0x0F,0x80,0x9F,0x4D,0x0B,0x00,
+    0x0B,0x80,0x3D,0x45,0xB7,0x00,0x07,0x80,0x27,0x11,0x0D,0x00,0x0F,0x80,0x9F,0x4D,
+    0x0D,0x00,0x07,0x80,0x3D,0x45,0xBC,0x00,0x01,0x40,0x27,0x11,0x10,0x00,0x0F,0x80,
+    0x9F,0x4D,0x10,0x00,0x01,0x40,0x3D,0x45,0xD0,0x00,0x0F,0x80,0x9F,0x4D,0xE2,0x00,
+    0x0D,0x80,0x9F,0x4D,0xE3,0x00,0x0D,0x80,0x9F,0x4D,0xE4,0x00,0x0B,0x80,0x9F,0x4D,
+    0xE6,0x00,0x09,0x80,0x9F,0x4D,0xE9,0x00,0x05,0x80,0x9F,0x4D,0x00,0x22,0x05,0x80,
+    0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,
+    0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,0xEB,0x00,0x05,0x80,0x5F,0x55,
+    0x90,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0xD0,0x22,0xE7,0x00,
+    0x0B,0x80,0xD0,0x22,0xE5,0x00,0x0B,0x80,0xD0,0x22,0xE4,0x00,0x0D,0x80,0xD0,0x22,
+    0xE2,0x00,0x0F,0x80,0xD0,0x22,0xE1,0x00,0x0F,0x80,0xD0,0x22,0xCE,0x00,0x05,0x80,
+    0x6D,0x22,0x0E,0x00,0x0F,0x80,0xD0,0x22,0x0E,0x00,0x05,0x80,0x32,0x2B,0xB9,0x00,
+    0x09,0x80,0x6D,0x22,0x0C,0x00,0x0F,0x80,0xD0,0x22,0x0C,0x00,0x09,0x80,0x32,0x2B,
+    0xB6,0x00,0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0xD0,0x22,0x0B,0x00,0x0B,0x80,
+    0x32,0x2B,0xB4,0x00,0x0D,0x80,0x6D,0x22,0x0A,0x00,0x0F,0x80,0xD0,0x22,0x0A,0x00,
+    0x0D,0x80,0x32,0x2B,0xB3,0x00,0x0D,0x80,0x6D,0x22,0x0B,0x00,0x0D,0x80,0xD0,0x22,
+    0x0B,0x00,0x0D,0x80,0x32,0x2B,0xB2,0x00,0x0F,0x80,0x6D,0x22,0x0A,0x00,0x0D,0x80,
+    0xD0,0x22,0x0A,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x6D,0x22,0x0B,0x00,
+    0x0B,0x80,0xD0,0x22,0x0B,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x6D,0x22,
+    0x0C,0x00,0x09,0x80,0xD0,0x22,0x0C,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,
+    0x6D,0x22,0x0E,0x00,0x05,0x80,0xD0,0x22,0x0E,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,
+    0x0F,0x80,0x6D,0x22,0x21,0x00,0x0F,0x80,0x32,0x2B,0xB1,0x00,0x0F,0x80,0x6D,0x22,
+    0x21,0x00,0x0F,0x80,0x32,0x2B,0xB2,0x00,0x0D,0x80,0x6D,0x22,0x23,0x00,0x0D,0x80,
+    0x32,0x2B,0xB3,0x00,0x0D,0x80,0x6D,0x22,0x23,0x00,0x0D,0x80,0x32,0x2B,0xB4,0x00,
+    0x0B,0x80,0x6D,0x22,0x25,0x00,0x0B,0x80,0x32,0x2B,0xB7,0x00,0x07,0x80,0x6D,0x22,
+    0x29,0x00,0x07,0x80,0x32,0x2B,0x77,0x03,0x08,0x80,0x0B,0x1A,0x4B,0x00,0x08,0x80,
+    0x94,0x33,0x94,0x00,0x0A,0x80,0x0B,0x1A,0x49,0x00,0x0A,0x80,0x94,0x33,0x92,0x00,
+    0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,0x94,0x33,0x90,0x00,0x0E,0x80,0x0B,0x1A,
+    0x45,0x00,0x0E,0x80,0x94,0x33,0x8F,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,
+    0x94,0x33,0x8E,0x00,0x0F,0x80,0x0B,0x1A,0x45,0x00,0x0F,0x80,0x94,0x33,0x8D,0x00,
+    0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,0x94,0x33,0x8D,0x00,0x10,0x80,0x0B,0x1A,
+    0x43,0x00,0x10,0x80,0x94,0x33,0x8D,0x00,0x10,0x80,0x0B,0x1A,0x43,0x00,0x10,0x80,
+    0x94,0x33,0x8E,0x00,0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x94,0x33,0x8F,0x00,
+    0x0E,0x80,0x0B,0x1A,0x45,0x00,0x0E,0x80,0x94,0x33,0x90,0x00,0x0C,0x80,0x0B,0x1A,
+    0x47,0x00,0x0C,0x80,0x94,0x33,0x91,0x00,0x0C,0x80,0x0B,0x1A,0x47,0x00,0x0C,0x80,
+    0x94,0x33,0x92,0x00,0x09,0x80,0x0B,0x1A,0x4B,0x00,0x09,0x80,0x94,0x33,0x95,0x00,
+    0x06,0x80,0x0B,0x1A,0x4D,0x00,0x06,0x80,0x94,0x33,0x00,0x09,0x07,0x80,0xA9,0x11,
+    0x59,0x00,0x07,0x80,0x16,0x34,0x87,0x00,0x0B,0x80,0xA9,0x11,0x55,0x00,0x0B,0x80,
+    0x16,0x34,0x85,0x00,0x0B,0x80,0xA9,0x11,0x55,0x00,0x0B,0x80,0x16,0x34,0x84,0x00,
+    0x0D,0x80,0xA9,0x11,0x53,0x00,0x0D,0x80,0x16,0x34,0x82,0x00,0x0F,0x80,0xA9,0x11,
+    0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,
+    0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,
+    0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,
+    0x51,0x00,0x0F,0x80,0x16,0x34,0x81,0x00,0x0F,0x80,0xA9,0x11,0x51,0x00,0x0F,0x80,
+    0x16,0x34,0x82,0x00,0x0D,0x80,0xA9,0x11,0x53,0x00,0x0D,0x80,0x16,0x34,0x83,0x00,
+    0x0D,0x80,0xA9,0x11,0x53,0x00,0x0D,0x80,0x16,0x34,0x84,0x00,0x0B,0x80,0xA9,0x11,
+    0x55,0x00,0x0B,0x80,0x16,0x34,0x86,0x00,0x09,0x80,0xA9,0x11,0x57,0x00,0x09,0x80,
+    0x16,0x34,0x89,0x00,0x05,0x80,0xA9,0x11,0x5B,0x00,0x05,0x80,0x16,0x34,0x00,0x09,
+    0x08,0x80,0x27,0x11,0x4B,0x00,0x08,0x80,0x79,0x3C,0x94,0x00,0x0A,0x80,0x27,0x11,
+    0x49,0x00,0x0A,0x80,0x79,0x3C,0x92,0x00,0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,
+    0x79,0x3C,0x90,0x00,0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,
+    0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,0x79,0x3C,0x8E,0x00,0x0F,0x80,0x27,0x11,
+    0x45,0x00,0x0F,0x80,0x79,0x3C,0x8D,0x00,0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,
+    0x79,0x3C,0x8D,0x00,0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,0x79,0x3C,0x8D,0x00,
+    0x10,0x80,0x27,0x11,0x43,0x00,0x10,0x80,0x79,0x3C,0x8E,0x00,0x0E,0x80,0x27,0x11,
+    0x45,0x00,0x0E,0x80,0x79,0x3C,0x8F,0x00,0x0E,0x80,0x27,0x11,0x45,0x00,0x0E,0x80,
+    0x79,0x3C,0x90,0x00,0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,0x79,0x3C,0x91,0x00,
+    0x0C,0x80,0x27,0x11,0x47,0x00,0x0C,0x80,0x79,0x3C,0x92,0x00,0x09,0x80,0x27,0x11,
+    0x4B,0x00,0x09,0x80,0x79,0x3C,0x95,0x00,0x06,0x80,0x27,0x11,0x4D,0x00,0x06,0x80,
+    0x79,0x3C,0x89,0x02,0x05,0x80,0x9F,0x4D,0x2B,0x00,0x05,0x80,0xDB,0x44,0xB9,0x00,
+    0x09,0x80,0x9F,0x4D,0x27,0x00,0x09,0x80,0xDB,0x44,0xB6,0x00,0x0B,0x80,0x9F,0x4D,
+    0x25,0x00,0x0B,0x80,0xDB,0x44,0xB4,0x00,0x0D,0x80,0x9F,0x4D,0x23,0x00,0x0D,0x80,
+    0xDB,0x44,0xB3,0x00,0x0D,0x80,0x9F,0x4D,0x23,0x00,0x0D,0x80,0xDB,0x44,0xB2,0x00,
+    0x0F,0x80,0x9F,0x4D,0x21,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,
+    0x21,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,0x0D,0x00,0x07,0x80,
+    0x3D,0x45,0x0D,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,0x0B,0x00,
+    0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,0x9F,0x4D,
+    0x0B,0x00,0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0xDB,0x44,0xB1,0x00,0x0F,0x80,
+    0x9F,0x4D,0x0A,0x00,0x0D,0x80,0x3D,0x45,0x0A,0x00,0x0F,0x80,0xDB,0x44,0xB2,0x00,
+    0x0D,0x80,0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x3D,0x45,0x0A,0x00,0x0D,0x80,0xDB,0x44,
+    0xB3,0x00,0x0D,0x80,0x9F,0x4D,0x0A,0x00,0x0F,0x80,0x3D,0x45,0x0A,0x00,0x0D,0x80,
+    0xDB,0x44,0xB4,0x00,0x0B,0x80,0x9F,0x4D,0x0B,0x00,0x0F,0x80,0x3D,0x45,0x0B,0x00,
+    0x0B,0x80,0xDB,0x44,0xB7,0x00,0x07,0x80,0x9F,0x4D,0x0D,0x00,0x0F,0x80,0x3D,0x45,
+    0x0D,0x00,0x07,0x80,0xDB,0x44,0xBC,0x00,0x01,0x40,0x9F,0x4D,0x10,0x00,0x0F,0x80,
+    0x3D,0x45,0x10,0x00,0x01,0x40,0xDB,0x44,0xD0,0x00,0x0F,0x80,0x3D,0x45,0xE2,0x00,
+    0x0D,0x80,0x3D,0x45,0xE3,0x00,0x0D,0x80,0x3D,0x45,0xE4,0x00,0x0B,0x80,0x3D,0x45,
+    0xE6,0x00,0x09,0x80,0x3D,0x45,0xE9,0x00,0x05,0x80,0x3D,0x45,0x05,0x22,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0x8A,0x27,0x00,0x00,0x6A,0x04,0x00,0x00,0x95,0x2B,0x07,0x80,0x6D,0x22,0xE7,0x00,
+    0x0B,0x80,0x6D,0x22,0xE5,0x00,0x0B,0x80,0x6D,0x22,0xE4,0x00,0x0D,0x80,0x6D,0x22,
+    0xE2,0x00,0x0F,0x80,0x6D,0x22,0xE1,0x00,0x0F,0x80,0x6D,0x22,0xCE,0x00,0x05,0x80,
+    0x0B,0x1A,0x0E,0x00,0x0F,0x80,0x6D,0x22,0x0E,0x00,0x05,0x80,0xD0,0x22,0xB9,0x00,
+    0x09,0x80,0x0B,0x1A,0x0C,0x00,0x0F,0x80,0x6D,0x22,0x0C,0x00,0x09,0x80,0xD0,0x22,
+    0xB6,0x00,0x0B,0x80,0x0B,0x1A,0x0B,0x00,0x0F,0x80,0x6D,0x22,0x0B,0x00,0x0B,0x80,
+    0xD0,0x22,0xB4,0x00,0x0D,0x80,0x0B,0x1A,0x0A,0x00,0x0F,0x80,0x6D,0x22,0x0A,0x00,
+    0x0D,0x80,0xD0,0x22,0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x0B,0x00,0x0D,0x80,0x6D,0x22,
+    0x0B,0x00,0x0D,0x80,0xD0,0x22,0xB2,0x00,0x0F,0x80,0x0B,0x1A,0x0A,0x00,0x0D,0x80,
+    0x6D,0x22,0x0A,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x0B,0x1A,0x0B,0x00,
+    0x0B,0x80,0x6D,0x22,0x0B,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x0C,0x00,0x09,0x80,0x6D,0x22,0x0C,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,
+    0x0B,0x1A,0x0E,0x00,0x05,0x80,0x6D,0x22,0x0E,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,
+    0x0F,0x80,0x0B,0x1A,0x21,0x00,0x0F,0x80,0xD0,0x22,0xB1,0x00,0x0F,0x80,0x0B,0x1A,
+    0x21,0x00,0x0F,0x80,0xD0,0x22,0xB2,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,
+    0xD0,0x22,0xB3,0x00,0x0D,0x80,0x0B,0x1A,0x23,0x00,0x0D,0x80,0xD0,0x22,0xB4,0x00,
+    0x0B,0x80,0x0B,0x1A,0x25,0x00,0x0B,0x80,0xD0,0x22,0xB7,0x00,0x07,0x80,0x0B,0x1A,
+    0x29,0x00,0x07,0x80,0xD0,0x22,0x77,0x03,0x08,0x80,0xA9,0x11,0x4B,0x00,0x08,0x80,
+    0x32,0x2B,0x94,0x00,0x0A,0x80,0xA9,0x11,0x49,0x00,0x0A,0x80,0x32,0x2B,0x92,0x00,
+    0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,0x32,0x2B,0x90,0x00,0x0E,0x80,0xA9,0x11,
+    0x45,0x00,0x0E,0x80,0x32,0x2B,0x8F,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,
+    0x32,0x2B,0x8E,0x00,0x0F,0x80,0xA9,0x11,0x45,0x00,0x0F,0x80,0x32,0x2B,0x8D,0x00,
+    0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,0x32,0x2B,0x8D,0x00,0x10,0x80,0xA9,0x11,
+    0x43,0x00,0x10,0x80,0x32,0x2B,0x8D,0x00,0x10,0x80,0xA9,0x11,0x43,0x00,0x10,0x80,
+    0x32,0x2B,0x8E,0x00,0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0x32,0x2B,0x8F,0x00,
+    0x0E,0x80,0xA9,0x11,0x45,0x00,0x0E,0x80,0x32,0x2B,0x90,0x00,0x0C,0x80,0xA9,0x11,
+    0x47,0x00,0x0C,0x80,0x32,0x2B,0x91,0x00,0x0C,0x80,0xA9,0x11,0x47,0x00,0x0C,0x80,
+    0x32,0x2B,0x92,0x00,0x09,0x80,0xA9,0x11,0x4B,0x00,0x09,0x80,0x32,0x2B,0x95,0x00,
+    0x06,0x80,0xA9,0x11,0x4D,0x00,0x06,0x80,0x32,0x2B,0x00,0x09,0x07,0x80,0x27,0x11,
+    0x59,0x00,0x07,0x80,0x94,0x33,0x87,0x00,0x0B,0x80,0x27,0x11,0x55,0x00,0x0B,0x80,
+    0x94,0x33,0x85,0x00,0x0B,0x80,0x27,0x11,0x55,0x00,0x0B,0x80,0x94,0x33,0x84,0x00,
+    0x0D,0x80,0x27,0x11,0x53,0x00,0x0D,0x80,0x94,0x33,0x82,0x00,0x0F,0x80,0x27,0x11,
+    0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,
+    0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,
+    0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,
+    0x51,0x00,0x0F,0x80,0x94,0x33,0x81,0x00,0x0F,0x80,0x27,0x11,0x51,0x00,0x0F,0x80,
+    0x94,0x33,0x82,0x00,0x0D,0x80,0x27,0x11,0x53,0x00,0x0D,0x80,0x94,0x33,0x83,0x00,
+    0x0D,0x80,0x27,0x11,0x53,0x00,0x0D,0x80,0x94,0x33,0x84,0x00,0x0B,0x80,0x27,0x11,
+    0x55,0x00,0x0B,0x80,0x94,0x33,0x86,0x00,0x09,0x80,0x27,0x11,0x57,0x00,0x09,0x80,
+    0x94,0x33,0x89,0x00,0x05,0x80,0x27,0x11,0x5B,0x00,0x05,0x80,0x94,0x33,0x00,0x09,
+    0x08,0x80,0x9F,0x4D,0x4B,0x00,0x08,0x80,0x16,0x34,0x94,0x00,0x0A,0x80,0x9F,0x4D,
+    0x49,0x00,0x0A,0x80,0x16,0x34,0x92,0x00,0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,
+    0x16,0x34,0x90,0x00,0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,
+    0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,0x16,0x34,0x8E,0x00,0x0F,0x80,0x9F,0x4D,
+    0x45,0x00,0x0F,0x80,0x16,0x34,0x8D,0x00,0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,
+    0x16,0x34,0x8D,0x00,0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,0x16,0x34,0x8D,0x00,
+    0x10,0x80,0x9F,0x4D,0x43,0x00,0x10,0x80,0x16,0x34,0x8E,0x00,0x0E,0x80,0x9F,0x4D,
+    0x45,0x00,0x0E,0x80,0x16,0x34,0x8F,0x00,0x0E,0x80,0x9F,0x4D,0x45,0x00,0x0E,0x80,
+    0x16,0x34,0x90,0x00,0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,0x16,0x34,0x91,0x00,
+    0x0C,0x80,0x9F,0x4D,0x47,0x00,0x0C,0x80,0x16,0x34,0x92,0x00,0x09,0x80,0x9F,0x4D,
+    0x4B,0x00,0x09,0x80,0x16,0x34,0x95,0x00,0x06,0x80,0x9F,0x4D,0x4D,0x00,0x06,0x80,
+    0x16,0x34,0x89,0x02,0x05,0x80,0x3D,0x45,0x2B,0x00,0x05,0x80,0x79,0x3C,0xB9,0x00,
+    0x09,0x80,0x3D,0x45,0x27,0x00,0x09,0x80,0x79,0x3C,0xB6,0x00,0x0B,0x80,0x3D,0x45,
+    0x25,0x00,0x0B,0x80,0x79,0x3C,0xB4,0x00,0x0D,0x80,0x3D,0x45,0x23,0x00,0x0D,0x80,
+    0x79,0x3C,0xB3,0x00,0x0D,0x80,0x3D,0x45,0x23,0x00,0x0D,0x80,0x79,0x3C,0xB2,0x00,
+    0x0F,0x80,0x3D,0x45,0x21,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,
+    0x21,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,0x0D,0x00,0x07,0x80,
+    0xDB,0x44,0x0D,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,0x0B,0x00,
+    0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,0x3D,0x45,
+    0x0B,0x00,0x0B,0x80,0xDB,0x44,0x0B,0x00,0x0F,0x80,0x79,0x3C,0xB1,0x00,0x0F,0x80,
+    0x3D,0x45,0x0A,0x00,0x0D,0x80,0xDB,0x44,0x0A,0x00,0x0F,0x80,0x79,0x3C,0xB2,0x00,
+    0x0D,0x80,0x3D,0x45,0x0A,0x00,0x0F,0x80,0xDB,0x44,0x0A,0x00,0x0D,0x80,0x79,0x3C,
+    0xB3,0x00,0x0D,0x80,0x3D,0x45,0x0A,0x00,0x0F,0x80,0xDB,0x44,0x0A,0x00,0x0D,0x80,
+    0x79,0x3C,0xB4,0x00,0x0B,0x80,0x3D,0x45,0x0B,0x00,0x0F,0x80,0xDB,0x44,0x0B,0x00,
+    0x0B,0x80,0x79,0x3C,0xB7,0x00,0x07,0x80,0x3D,0x45,0x0D,0x00,0x0F,0x80,0xDB,0x44,
+    0x0D,0x00,0x07,0x80,0x79,0x3C,0xBC,0x00,0x01,0x40,0x3D,0x45,0x10,0x00,0x0F,0x80,
+    0xDB,0x44,0x10,0x00,0x01,0x40,0x79,0x3C,0xD0,0x00,0x0F,0x80,0xDB,0x44,0xE2,0x00,
+    0x0D,0x80,0xDB,0x44,0xE3,0x00,0x0D,0x80,0xDB,0x44,0xE4,0x00,0x0B,0x80,0xDB,0x44,
+    0xE6,0x00,0x09,0x80,0xDB,0x44,0xE9,0x00,0x05,0x80,0xDB,0x44,0x0B,0x22,0x06,0x80,
+    0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,
+    0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,0xEA,0x00,0x06,0x80,0x5F,0x55,
+    0x84,0x27,0x00,0x00,
+};
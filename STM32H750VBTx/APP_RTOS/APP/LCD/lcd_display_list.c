@@ -0,0 +1,389 @@
+/**
+ ******************************************************************************
+ * @file    lcd_display_list.c
+ * @brief   显示列表记录与行带光栅化
+ ******************************************************************************
+ * @note
+ *   - 光栅化时每个行带遍历全部图元，先用外接矩形跳过不相交的，
+ *     相交的只处理落在行带内的行和列
+ *   - 与 lcd_spi_154.c 一样只应在同一个任务中调用
+ ******************************************************************************
+ */
+
+#include "lcd_display_list.h"
+#include "lcd_font_index.h"
+#include "lcd_spi_154.h"
+#include "lcd_blit.h"
+#include "lcd_prof.h"
+#include <string.h>
+#include <stddef.h>
+
+/* ==================== 内部函数 ==================== */
+
+static LCD_DL_Cmd_t *DL_Alloc(LCD_DisplayList_t *dl, uint8_t type)
+{
+    LCD_DL_Cmd_t *cmd;
+
+    if (dl->count >= LCD_DL_MAX_CMDS) {
+        dl->overflow = true;
+        return NULL;
+    }
+    cmd = &dl->cmds[dl->count++];
+    memset(cmd, 0, sizeof(*cmd));
+    cmd->type = type;
+    return cmd;
+}
+
+/* 整数平方根（向下取整） */
+static uint32_t DL_Sqrt(uint32_t v)
+{
+    uint32_t root = 0, bit = 1UL << 30;
+
+    while (bit > v) bit >>= 2;
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+static void DL_Fill(uint16_t *dst, int32_t count, uint16_t color)
+{
+    while (count-- > 0) {
+        *dst++ = color;
+    }
+}
+
+/* 取字符所用的字体和字模，没有可显示的字模时返回NULL */
+static const uint8_t *DL_Glyph(const LCD_DL_Cmd_t *cmd, uint16_t code, const pFONT **font)
+{
+    const uint8_t *bits;
+
+    if (code < 0x80) {
+        if (code < 0x20 || code > 0x7E) return NULL;
+        *font = cmd->ascii;
+        return &cmd->ascii->pTable[(code - 32) * cmd->ascii->Sizes];
+    }
+    if (cmd->ch == NULL) return NULL;
+
+    bits = LCD_FontIndex_Find(cmd->ch, code);
+    if (bits == NULL) {
+        bits = LCD_FontIndex_Fallback(cmd->ch);
+    }
+    *font = cmd->ch;
+    return bits;
+}
+
+/* 文字：逐字符处理与行带相交的部分 */
+static void DL_RasterText(const LCD_DL_Cmd_t *cmd, uint16_t *buf, int32_t bx0, int32_t by0,
+                          int32_t bx1, int32_t by1, uint16_t stride)
+{
+    int32_t x = cmd->x, y0 = (cmd->y > by0) ? cmd->y : by0;
+    int32_t right = cmd->x + cmd->w;
+    uint16_t code, width = 0;
+
+    for (const char *p = cmd->text; *p && x < right && x < bx1; x += width) {
+        const pFONT *font;
+
+        p += LCD_FontIndex_Decode(p, &code);
+        const uint8_t *bits = DL_Glyph(cmd, code, &font);
+
+        if (bits == NULL) {
+            width = 0;
+            continue;
+        }
+        width = font->Width;
+        if (x + width <= bx0) continue;
+
+        /* 中英文字体高度不同时，较矮的字符只绘制自身的行 */
+        int32_t cx0 = (x > bx0) ? x : bx0;
+        int32_t cx1 = (x + width < bx1) ? x + width : bx1;
+        int32_t y1 = (cmd->y + font->Height < by1) ? cmd->y + font->Height : by1;
+        uint16_t row_bytes = (width + 7) / 8;
+
+        for (int32_t y = y0; y < y1; y++) {
+            const uint8_t *row = bits + (y - cmd->y) * row_bytes;
+            uint16_t *dst = &buf[(y - by0) * stride + (cx0 - bx0)];
+
+            for (int32_t px = cx0 - x; px < cx1 - x; px++) {
+                *dst++ = ((row[px >> 3] >> (px & 7)) & 1) ? cmd->color : cmd->color2;
+            }
+        }
+    }
+}
+
+/* 一个图元与行带相交的部分 */
+static void DL_RasterCmd(const LCD_DL_Cmd_t *cmd, uint16_t *buf, int32_t bx0, int32_t by0,
+                         int32_t bx1, int32_t by1, uint16_t stride)
+{
+    int32_t x0 = (cmd->x > bx0) ? cmd->x : bx0;
+    int32_t x1 = (cmd->x + cmd->w < bx1) ? cmd->x + cmd->w : bx1;
+    int32_t y0 = (cmd->y > by0) ? cmd->y : by0;
+    int32_t y1 = (cmd->y + cmd->h < by1) ? cmd->y + cmd->h : by1;
+
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    switch (cmd->type) {
+    case LCD_DL_FILL_RECT:
+        for (int32_t y = y0; y < y1; y++) {
+            DL_Fill(&buf[(y - by0) * stride + (x0 - bx0)], x1 - x0, cmd->color);
+        }
+        break;
+
+    case LCD_DL_RECT:
+        for (int32_t y = y0; y < y1; y++) {
+            uint16_t *row = &buf[(y - by0) * stride - bx0];
+            if (y == cmd->y || y == cmd->y + cmd->h - 1) {
+                DL_Fill(row + x0, x1 - x0, cmd->color);
+            } else {
+                if (cmd->x >= x0) row[cmd->x] = cmd->color;
+                if (cmd->x + cmd->w - 1 < x1) row[cmd->x + cmd->w - 1] = cmd->color;
+            }
+        }
+        break;
+
+    case LCD_DL_GRADIENT: {
+        /* 与 LCD_DrawGradientRect 相同的逐行插值 */
+        int32_t r1 = (cmd->color >> 11) & 0x1F, g1 = (cmd->color >> 5) & 0x3F, b1 = cmd->color & 0x1F;
+        int32_t r2 = (cmd->color2 >> 11) & 0x1F, g2 = (cmd->color2 >> 5) & 0x3F, b2 = cmd->color2 & 0x1F;
+
+        for (int32_t y = y0; y < y1; y++) {
+            int32_t row = y - cmd->y;
+            uint16_t r = (uint16_t)(r1 + (r2 - r1) * row / cmd->h) & 0x1F;
+            uint16_t g = (uint16_t)(g1 + (g2 - g1) * row / cmd->h) & 0x3F;
+            uint16_t b = (uint16_t)(b1 + (b2 - b1) * row / cmd->h) & 0x1F;
+            DL_Fill(&buf[(y - by0) * stride + (x0 - bx0)], x1 - x0, (r << 11) | (g << 5) | b);
+        }
+        break;
+    }
+
+    case LCD_DL_FILL_CIRCLE: {
+        int32_t r = (cmd->w - 1) / 2, cx = cmd->x + r, cy = cmd->y + r;
+
+        for (int32_t y = y0; y < y1; y++) {
+            int32_t dy = y - cy;
+            int32_t half = (int32_t)DL_Sqrt((uint32_t)(r * r + r - dy * dy));
+            int32_t sx0 = (cx - half > x0) ? cx - half : x0;
+            int32_t sx1 = (cx + half + 1 < x1) ? cx + half + 1 : x1;
+            if (sx0 < sx1) {
+                DL_Fill(&buf[(y - by0) * stride + (sx0 - bx0)], sx1 - sx0, cmd->color);
+            }
+        }
+        break;
+    }
+
+    case LCD_DL_TEXT:
+        DL_RasterText(cmd, buf, bx0, by0, bx1, by1, stride);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/* 全部图元外接矩形的并集（已裁剪到屏幕），没有图元时返回 false */
+static bool DL_Bounds(const LCD_DisplayList_t *dl, int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1)
+{
+    *x0 = LCD_WIDTH; *y0 = LCD_HEIGHT; *x1 = 0; *y1 = 0;
+
+    for (uint16_t i = 0; i < dl->count; i++) {
+        const LCD_DL_Cmd_t *cmd = &dl->cmds[i];
+        if (cmd->x < *x0) *x0 = cmd->x;
+        if (cmd->y < *y0) *y0 = cmd->y;
+        if (cmd->x + cmd->w > *x1) *x1 = cmd->x + cmd->w;
+        if (cmd->y + cmd->h > *y1) *y1 = cmd->y + cmd->h;
+    }
+    if (*x0 < 0) *x0 = 0;
+    if (*y0 < 0) *y0 = 0;
+    if (*x1 > LCD_WIDTH) *x1 = LCD_WIDTH;
+    if (*y1 > LCD_HEIGHT) *y1 = LCD_HEIGHT;
+    return (*x0 < *x1 && *y0 < *y1);
+}
+
+/* ==================== 接口函数 ==================== */
+
+/**
+ * @brief 开始记录一帧
+ */
+void LCD_DL_Begin(LCD_DisplayList_t *dl, bool clear, uint16_t clear_color)
+{
+    dl->count = 0;
+    dl->text_used = 0;
+    dl->clear = clear;
+    dl->overflow = false;
+    dl->clear_color = clear_color;
+}
+
+/**
+ * @brief 记录实心矩形
+ */
+HAL_StatusTypeDef LCD_DL_FillRect(LCD_DisplayList_t *dl, uint16_t x, uint16_t y,
+                                  uint16_t width, uint16_t height, uint16_t color)
+{
+    LCD_DL_Cmd_t *cmd = DL_Alloc(dl, LCD_DL_FILL_RECT);
+
+    if (cmd == NULL) return HAL_ERROR;
+    cmd->x = x; cmd->y = y; cmd->w = width; cmd->h = height;
+    cmd->color = color;
+    return HAL_OK;
+}
+
+/**
+ * @brief 记录矩形边框
+ */
+HAL_StatusTypeDef LCD_DL_DrawRect(LCD_DisplayList_t *dl, uint16_t x, uint16_t y,
+                                  uint16_t width, uint16_t height, uint16_t color)
+{
+    LCD_DL_Cmd_t *cmd = DL_Alloc(dl, LCD_DL_RECT);
+
+    if (cmd == NULL) return HAL_ERROR;
+    cmd->x = x; cmd->y = y; cmd->w = width; cmd->h = height;
+    cmd->color = color;
+    return HAL_OK;
+}
+
+/**
+ * @brief 记录垂直渐变矩形
+ */
+HAL_StatusTypeDef LCD_DL_GradientRect(LCD_DisplayList_t *dl, uint16_t x, uint16_t y,
+                                      uint16_t width, uint16_t height, uint16_t color1, uint16_t color2)
+{
+    LCD_DL_Cmd_t *cmd = DL_Alloc(dl, LCD_DL_GRADIENT);
+
+    if (cmd == NULL) return HAL_ERROR;
+    cmd->x = x; cmd->y = y; cmd->w = width; cmd->h = height;
+    cmd->color = color1;
+    cmd->color2 = color2;
+    return HAL_OK;
+}
+
+/**
+ * @brief 记录实心圆
+ */
+HAL_StatusTypeDef LCD_DL_FillCircle(LCD_DisplayList_t *dl, uint16_t x, uint16_t y, uint16_t r,
+                                    uint16_t color)
+{
+    LCD_DL_Cmd_t *cmd = DL_Alloc(dl, LCD_DL_FILL_CIRCLE);
+
+    if (cmd == NULL) return HAL_ERROR;
+    cmd->x = (int16_t)(x - r); cmd->y = (int16_t)(y - r);
+    cmd->w = 2 * r + 1; cmd->h = 2 * r + 1;
+    cmd->color = color;
+    return HAL_OK;
+}
+
+/**
+ * @brief 记录一行文字
+ */
+HAL_StatusTypeDef LCD_DL_Text(LCD_DisplayList_t *dl, uint16_t x, uint16_t y, const char *text,
+                              const pFONT *ascii, const pFONT *ch, uint16_t fg, uint16_t bg)
+{
+    uint16_t len = (uint16_t)strlen(text);
+    uint16_t code, width = 0;
+    LCD_DL_Cmd_t *cmd;
+
+    if (dl->text_used + len + 1 > LCD_DL_TEXT_POOL) {
+        dl->overflow = true;
+        return HAL_ERROR;
+    }
+    cmd = DL_Alloc(dl, LCD_DL_TEXT);
+    if (cmd == NULL) return HAL_ERROR;
+
+    cmd->text = &dl->text_pool[dl->text_used];
+    memcpy(&dl->text_pool[dl->text_used], text, len + 1);
+    dl->text_used += len + 1;
+
+    cmd->ascii = ascii;
+    cmd->ch = ch;
+    cmd->color = fg;
+    cmd->color2 = bg;
+    cmd->x = x; cmd->y = y;
+    cmd->h = (ch != NULL && ch->Height > ascii->Height) ? ch->Height : ascii->Height;
+
+    /* 外接矩形宽度：可显示字符的宽度之和 */
+    for (const char *p = cmd->text; *p; ) {
+        const pFONT *font;
+        p += LCD_FontIndex_Decode(p, &code);
+        if (DL_Glyph(cmd, code, &font) != NULL) width += font->Width;
+    }
+    cmd->w = width;
+    return HAL_OK;
+}
+
+/**
+ * @brief 合成一个矩形区域
+ */
+void LCD_DL_RasterBand(const LCD_DisplayList_t *dl, uint16_t *buf, uint16_t x0, uint16_t y0,
+                       uint16_t width, uint16_t rows)
+{
+    int32_t x1 = x0 + width, y1 = y0 + rows;
+
+    if (dl->clear) {
+        DL_Fill(buf, (int32_t)width * rows, dl->clear_color);
+    }
+    for (uint16_t i = 0; i < dl->count; i++) {
+        const LCD_DL_Cmd_t *cmd = &dl->cmds[i];
+
+        if (cmd->y >= y1 || cmd->y + cmd->h <= y0) continue;
+        DL_RasterCmd(cmd, buf, x0, y0, x1, y1, width);
+    }
+}
+
+/**
+ * @brief 渲染显示列表
+ */
+HAL_StatusTypeDef LCD_DL_Render(LCD_DisplayList_t *dl, LCD_SPI_DMA_Handle_t *hlcd)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+    int32_t x0 = 0, y0 = 0, x1 = LCD_WIDTH, y1 = LCD_HEIGHT;
+
+    dl->bands = 0;
+    dl->pixels = 0;
+    if (!dl->clear && !DL_Bounds(dl, &x0, &y0, &x1, &y1)) {
+        return HAL_OK;
+    }
+
+    /* 帧缓冲模式：按整行合成，未覆盖的像素保留帧缓冲原有内容 */
+    if (hlcd->frame_buffer_enabled) {
+        LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);         // 先等帧缓冲上的DMA2D操作
+        LCD_PROF_BEGIN(t0);
+        LCD_DL_RasterBand(dl, &hlcd->frame_buffer[y0 * LCD_WIDTH], 0, y0, LCD_WIDTH, y1 - y0);
+        LCD_PROF_END(LCD_PROF_PIXEL, t0);
+        LCD_FB_MarkDirty(hlcd, x0, y0, x1 - x0, y1 - y0);
+        dl->bands = 1;
+        return HAL_OK;
+    }
+
+    uint16_t width = x1 - x0;
+    uint16_t rows_per_band = hlcd->dma_buffer_size / width;
+
+    LCD_SPI_DMA_SetWindow(hlcd, x0, y0, width, y1 - y0);
+    for (int32_t y = y0; y < y1 && status == HAL_OK; y += rows_per_band) {
+        uint16_t rows = (y1 - y < rows_per_band) ? (y1 - y) : rows_per_band;
+        uint16_t *buf = hlcd->dma_buffer[hlcd->current_buffer];
+
+        /* 该缓冲区两个行带之前发送，启动上一个行带时已等待其完成 */
+        LCD_PROF_BEGIN(t0);
+        if (!dl->clear) {
+            DL_Fill(buf, (int32_t)width * rows, dl->clear_color);
+        }
+        LCD_DL_RasterBand(dl, buf, x0, y, width, rows);
+        LCD_PROF_END(LCD_PROF_PIXEL, t0);
+        status = LCD_SPI_DMA_WriteBuffer_Async(hlcd, buf, (uint32_t)width * rows);
+        hlcd->current_buffer = (hlcd->current_buffer + 1) % 2;
+
+        dl->bands++;
+        dl->pixels += (uint32_t)width * rows;
+    }
+
+    LCD_SPI_DMA_WaitComplete(hlcd);
+    LCD_CS_Deselect;
+    return status;
+}
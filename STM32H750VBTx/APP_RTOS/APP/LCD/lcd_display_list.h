@@ -0,0 +1,107 @@
+/**
+ ******************************************************************************
+ * @file    lcd_display_list.h
+ * @brief   显示列表 - 先记录一帧的图元，再按行带（band）光栅化后整屏发送
+ ******************************************************************************
+ * @note
+ *   - 逐个调用 LCD_DMA_FillRect / LCD_DrawRect 时，每个图元都要单独设置窗口，
+ *     相互覆盖的区域会被重复发送；显示列表把整帧合成后只发送一次，
+ *     每个像素每帧只经过SPI总线一次
+ *   - 行带高度为 dma_buffer_size / 宽度（lcd_dma_buffer0/1 为32行），
+ *     两块DMA缓冲区交替使用：DMA发送一个行带时CPU合成下一个
+ *   - 图元按记录顺序绘制，后记录的覆盖先记录的
+ *   - 文字的字符串复制到显示列表内部，记录后原字符串可以修改
+ *   - 颜色均为RGB565
+ ******************************************************************************
+ */
+
+#ifndef __LCD_DISPLAY_LIST_H
+#define __LCD_DISPLAY_LIST_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd_spi_dma.h"
+#include "lcd_fonts.h"
+
+#define LCD_DL_MAX_CMDS         64      // 每帧最多图元数
+#define LCD_DL_TEXT_POOL        512     // 每帧文字总字节数（含结束符）
+
+/* 图元类型 */
+typedef enum {
+    LCD_DL_FILL_RECT = 0,       // 实心矩形
+    LCD_DL_RECT,                // 1像素矩形边框
+    LCD_DL_GRADIENT,            // 垂直渐变矩形，color 渐变到 color2
+    LCD_DL_FILL_CIRCLE,         // 实心圆
+    LCD_DL_TEXT,                // 文字，color 为前景色，color2 为背景色
+} LCD_DL_Type_t;
+
+/* 一个图元，x/y/w/h 为外接矩形（圆可能部分超出屏幕） */
+typedef struct {
+    uint8_t  type;
+    uint8_t  reserved;
+    int16_t  x, y;
+    uint16_t w, h;
+    uint16_t color;
+    uint16_t color2;
+    const pFONT *ascii;         // 文字：ASCII字体
+    const pFONT *ch;            // 文字：中文字体，可为NULL
+    const char  *text;          // 文字：指向 text_pool
+} LCD_DL_Cmd_t;
+
+/* 显示列表 */
+typedef struct {
+    LCD_DL_Cmd_t cmds[LCD_DL_MAX_CMDS];
+    uint16_t count;
+    uint16_t text_used;
+    bool     clear;             // 先以 clear_color 清屏
+    bool     overflow;          // 有图元因容量不足未记录
+    uint16_t clear_color;
+    char     text_pool[LCD_DL_TEXT_POOL];
+    uint32_t bands;             // 上次渲染的行带数
+    uint32_t pixels;            // 上次渲染发送的像素数
+} LCD_DisplayList_t;
+
+/**
+ * @brief 开始记录一帧
+ * @param clear       是否先清屏；为 false 时只合成全部图元外接矩形的并集，其中未被图元覆盖的像素
+ *                    在直接模式下为 clear_color，在帧缓冲模式下保持原值
+ * @param clear_color 清屏颜色
+ */
+void LCD_DL_Begin(LCD_DisplayList_t *dl, bool clear, uint16_t clear_color);
+
+/* 记录图元，容量不足时返回 HAL_ERROR（已记录的图元不受影响） */
+HAL_StatusTypeDef LCD_DL_FillRect(LCD_DisplayList_t *dl, uint16_t x, uint16_t y,
+                                  uint16_t width, uint16_t height, uint16_t color);
+HAL_StatusTypeDef LCD_DL_DrawRect(LCD_DisplayList_t *dl, uint16_t x, uint16_t y,
+                                  uint16_t width, uint16_t height, uint16_t color);
+HAL_StatusTypeDef LCD_DL_GradientRect(LCD_DisplayList_t *dl, uint16_t x, uint16_t y,
+                                      uint16_t width, uint16_t height, uint16_t color1, uint16_t color2);
+/* 实心圆：与圆心距离平方不超过 r*r+r 的像素，即半径 r+0.5 以内 */
+HAL_StatusTypeDef LCD_DL_FillCircle(LCD_DisplayList_t *dl, uint16_t x, uint16_t y, uint16_t r,
+                                    uint16_t color);
+/**
+ * @brief 记录一行文字（中英文混排，编码方式见 LCD_CH_UTF8）
+ * @param ch 中文字体，为NULL时只显示ASCII字符；字库中没有的汉字显示方框
+ */
+HAL_StatusTypeDef LCD_DL_Text(LCD_DisplayList_t *dl, uint16_t x, uint16_t y, const char *text,
+                              const pFONT *ascii, const pFONT *ch, uint16_t fg, uint16_t bg);
+
+/**
+ * @brief 把显示列表中与矩形区域相交的部分合成到缓冲区
+ * @param buf   输出，width*rows 个像素，行间距为 width
+ * @param x0,y0 区域左上角在屏幕上的坐标
+ * @note  不清屏时，未被任何图元覆盖的像素保持原值
+ */
+void LCD_DL_RasterBand(const LCD_DisplayList_t *dl, uint16_t *buf, uint16_t x0, uint16_t y0,
+                       uint16_t width, uint16_t rows);
+
+/**
+ * @brief 渲染显示列表
+ * @note  直接模式：设置一次窗口，逐行带合成后经DMA连续发送；
+ *        帧缓冲模式：合成到帧缓冲并标记脏块，由 LCD_SPI_DMA_FlushFrameBuffer 发送
+ * @retval HAL状态
+ */
+HAL_StatusTypeDef LCD_DL_Render(LCD_DisplayList_t *dl, LCD_SPI_DMA_Handle_t *hlcd);
+
+#endif /* __LCD_DISPLAY_LIST_H */
@@ -0,0 +1,319 @@
+/**
+ ******************************************************************************
+ * @file    lcd_display_server.c
+ * @brief   显示服务任务 - 命令队列、逐帧合并、帧缓冲合成与脏块刷新
+ ******************************************************************************
+ */
+
+#include "lcd_display_server.h"
+#include "lcd_blit.h"
+#include "cmsis_os2.h"
+#include <string.h>
+
+static const osThreadAttr_t lcd_srv_task_attributes = {
+    .name = "LcdServer",
+    .stack_size = 1024 * 4,
+    .priority = (osPriority_t) osPriorityAboveNormal,
+};
+
+static struct {
+    LCD_SPI_DMA_Handle_t *hlcd;
+    osMessageQueueId_t queue;
+    LCD_Srv_Cmd_t frame[LCD_DL_MAX_CMDS];   // 本帧待合成的命令（已合并）
+    uint16_t frame_count;
+    uint16_t frame_text;                    // 本帧文字占用的字节数
+    uint32_t last_frame_tick;
+    LCD_DisplayList_t dl;
+    LCD_Srv_Stats_t stats;
+} srv;
+
+/* ==================== 合并 ==================== */
+
+/* 实心矩形/渐变矩形完全覆盖 old 时返回 true（文字的外接矩形要到记录时才确定，不参与） */
+static bool LCD_Server_Covers(const LCD_Srv_Cmd_t *cmd, const LCD_Srv_Cmd_t *old)
+{
+    int32_t x0, y0, x1, y1;
+
+    if (cmd->type != LCD_DL_FILL_RECT && cmd->type != LCD_DL_GRADIENT) {
+        return false;
+    }
+    switch (old->type) {
+    case LCD_DL_FILL_RECT:
+    case LCD_DL_RECT:
+    case LCD_DL_GRADIENT:
+        x0 = old->x;  y0 = old->y;  x1 = old->x + old->w;  y1 = old->y + old->h;
+        break;
+    case LCD_DL_FILL_CIRCLE:
+        x0 = old->x - old->w;  y0 = old->y - old->w;
+        x1 = old->x + old->w + 1;  y1 = old->y + old->w + 1;
+        break;
+    default:
+        return false;
+    }
+    return x0 >= cmd->x && y0 >= cmd->y && x1 <= cmd->x + cmd->w && y1 <= cmd->y + cmd->h;
+}
+
+static uint16_t LCD_Server_TextBytes(const LCD_Srv_Cmd_t *cmd)
+{
+    return (cmd->type == LCD_DL_TEXT) ? (uint16_t)(strlen(cmd->text) + 1) : 0U;
+}
+
+static void LCD_Server_Remove(uint16_t index)
+{
+    uint32_t primask;
+
+    srv.frame_text -= LCD_Server_TextBytes(&srv.frame[index]);
+    memmove(&srv.frame[index], &srv.frame[index + 1], (srv.frame_count - index - 1) * sizeof(LCD_Srv_Cmd_t));
+    srv.frame_count--;
+    primask = __get_PRIMASK();
+    __disable_irq();
+    srv.stats.coalesced++;
+    __set_PRIMASK(primask);
+}
+
+/* ==================== 合成与刷新 ==================== */
+
+static void LCD_Server_Record(const LCD_Srv_Cmd_t *cmd)
+{
+    LCD_DisplayList_t *dl = &srv.dl;
+
+    switch (cmd->type) {
+    case LCD_DL_FILL_RECT:
+        LCD_DL_FillRect(dl, cmd->x, cmd->y, cmd->w, cmd->h, cmd->style.fg);
+        break;
+    case LCD_DL_RECT:
+        LCD_DL_DrawRect(dl, cmd->x, cmd->y, cmd->w, cmd->h, cmd->style.fg);
+        break;
+    case LCD_DL_GRADIENT:
+        LCD_DL_GradientRect(dl, cmd->x, cmd->y, cmd->w, cmd->h, cmd->style.fg, cmd->style.bg);
+        break;
+    case LCD_DL_FILL_CIRCLE:
+        LCD_DL_FillCircle(dl, cmd->x, cmd->y, cmd->w, cmd->style.fg);
+        break;
+    case LCD_DL_TEXT:
+        LCD_DL_Text(dl, cmd->x, cmd->y, cmd->text, cmd->style.ascii, cmd->style.ch,
+                    cmd->style.fg, cmd->style.bg);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief 合成本帧命令到帧缓冲，只把各命令自身的外接矩形标记为脏，然后刷新
+ */
+static void LCD_Server_Render(void)
+{
+    LCD_SPI_DMA_Handle_t *hlcd = srv.hlcd;
+    int32_t y0 = LCD_HEIGHT, y1 = 0;
+    uint32_t primask;
+
+    if (srv.frame_count == 0) {
+        return;
+    }
+
+    LCD_DL_Begin(&srv.dl, false, 0);
+    for (uint16_t i = 0; i < srv.frame_count; i++) {
+        LCD_Server_Record(&srv.frame[i]);
+    }
+
+    for (uint16_t i = 0; i < srv.dl.count; i++) {
+        const LCD_DL_Cmd_t *c = &srv.dl.cmds[i];
+        int32_t cx0 = (c->x < 0) ? 0 : c->x;
+        int32_t cy0 = (c->y < 0) ? 0 : c->y;
+        int32_t cx1 = (c->x + c->w > LCD_WIDTH) ? LCD_WIDTH : c->x + c->w;
+        int32_t cy1 = (c->y + c->h > LCD_HEIGHT) ? LCD_HEIGHT : c->y + c->h;
+        if (cx0 >= cx1 || cy0 >= cy1) {
+            continue;
+        }
+        LCD_FB_MarkDirty(hlcd, cx0, cy0, cx1 - cx0, cy1 - cy0);
+        if (cy0 < y0) y0 = cy0;
+        if (cy1 > y1) y1 = cy1;
+    }
+    if (y0 < y1) {
+        LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+        LCD_DL_RasterBand(&srv.dl, &hlcd->frame_buffer[y0 * LCD_WIDTH], 0, y0, LCD_WIDTH, y1 - y0);
+    }
+    HAL_StatusTypeDef status = LCD_SPI_DMA_FlushFrameBuffer(hlcd);
+
+    // 失败时命令也算处理完（Sync 不会一直等），未发出的脏块保留，下一帧重发
+    primask = __get_PRIMASK();
+    __disable_irq();
+    srv.stats.rendered += srv.frame_count;
+    if (status == HAL_OK) {
+        srv.stats.frames++;
+    } else {
+        srv.stats.errors++;
+    }
+    __set_PRIMASK(primask);
+    srv.frame_count = 0;
+    srv.frame_text = 0;
+    srv.last_frame_tick = osKernelGetTickCount();
+}
+
+/**
+ * @brief 把命令并入本帧：替换相同slot、丢弃被完全覆盖的命令，容量不足时先刷新
+ */
+static void LCD_Server_Add(const LCD_Srv_Cmd_t *cmd)
+{
+    uint16_t text = LCD_Server_TextBytes(cmd);
+
+    for (uint16_t i = srv.frame_count; i-- > 0;) {
+        if ((cmd->slot != 0 && srv.frame[i].slot == cmd->slot) || LCD_Server_Covers(cmd, &srv.frame[i])) {
+            LCD_Server_Remove(i);
+        }
+    }
+
+    if (srv.frame_count >= LCD_DL_MAX_CMDS || srv.frame_text + text > LCD_DL_TEXT_POOL) {
+        LCD_Server_Render();
+    }
+    srv.frame[srv.frame_count++] = *cmd;
+    srv.frame_text += text;
+}
+
+static void LCD_Server_Task(void *argument)
+{
+    LCD_Srv_Cmd_t cmd;
+    (void)argument;
+
+    for (;;) {
+        if (osMessageQueueGet(srv.queue, &cmd, NULL, osWaitForever) != osOK) {
+            continue;
+        }
+        LCD_Server_Add(&cmd);
+
+        /* 收集到本帧结束：距上一帧已超过帧间隔时只取走队列中已有的命令 */
+        for (;;) {
+            uint32_t elapsed = osKernelGetTickCount() - srv.last_frame_tick;
+            uint32_t wait = (elapsed >= LCD_SRV_FRAME_MS) ? 0U : LCD_SRV_FRAME_MS - elapsed;
+            if (osMessageQueueGet(srv.queue, &cmd, NULL, wait) != osOK) {
+                break;
+            }
+            LCD_Server_Add(&cmd);
+        }
+        LCD_Server_Render();
+    }
+}
+
+/* ==================== 接口函数 ==================== */
+
+HAL_StatusTypeDef LCD_Server_Start(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    if (hlcd == NULL || srv.queue != NULL) {
+        return HAL_ERROR;
+    }
+    if (LCD_SPI_DMA_EnableFrameBuffer(hlcd) != HAL_OK) {
+        return HAL_ERROR;   // 服务任务在帧缓冲中合成，未分配帧缓冲时不能启动
+    }
+    srv.hlcd = hlcd;
+    srv.last_frame_tick = osKernelGetTickCount() - LCD_SRV_FRAME_MS;
+
+    srv.queue = osMessageQueueNew(LCD_SRV_QUEUE_LEN, sizeof(LCD_Srv_Cmd_t), NULL);
+    if (srv.queue == NULL) {
+        return HAL_ERROR;
+    }
+    if (osThreadNew(LCD_Server_Task, NULL, &lcd_srv_task_attributes) == NULL) {
+        return HAL_ERROR;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef LCD_Server_Post(const LCD_Srv_Cmd_t *cmd, uint32_t timeout)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+    uint32_t primask;
+
+    if (srv.queue == NULL || cmd == NULL) {
+        return HAL_ERROR;
+    }
+    if (cmd->type == LCD_DL_TEXT && cmd->style.ascii == NULL) {
+        status = HAL_ERROR;     // 服务任务合成文字时要用ASCII字体
+    } else if (osMessageQueuePut(srv.queue, cmd, 0, timeout) != osOK) {
+        status = (timeout == 0) ? HAL_BUSY : HAL_TIMEOUT;
+    }
+
+    // 可能在中断或调用者的临界区中执行，恢复而不是直接打开中断
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (status == HAL_OK) {
+        srv.stats.posted++;
+    } else {
+        srv.stats.rejected++;
+    }
+    __set_PRIMASK(primask);
+    return status;
+}
+
+/**
+ * @note CMSIS-RTOS2 的 osMessageQueuePut 在中断中调用时自动使用 FromISR 版本，超时必须为0
+ */
+HAL_StatusTypeDef LCD_Server_PostFromISR(const LCD_Srv_Cmd_t *cmd)
+{
+    return LCD_Server_Post(cmd, 0);
+}
+
+HAL_StatusTypeDef LCD_Server_FillRect(uint8_t slot, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                      uint16_t color)
+{
+    LCD_Srv_Cmd_t cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type = LCD_DL_FILL_RECT;
+    cmd.slot = slot;
+    cmd.x = x;  cmd.y = y;
+    cmd.w = width;  cmd.h = height;
+    cmd.style.fg = color;
+    return LCD_Server_Post(&cmd, LCD_SRV_POST_TIMEOUT_MS);
+}
+
+HAL_StatusTypeDef LCD_Server_Text(uint8_t slot, uint16_t x, uint16_t y, const char *text,
+                                  const LCD_Style_t *style)
+{
+    LCD_Srv_Cmd_t cmd;
+
+    if (text == NULL || style == NULL) {
+        return HAL_ERROR;
+    }
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type = LCD_DL_TEXT;
+    cmd.slot = slot;
+    cmd.x = x;  cmd.y = y;
+    cmd.style = *style;
+    strncpy(cmd.text, text, LCD_SRV_TEXT_MAX - 1);
+    return LCD_Server_Post(&cmd, LCD_SRV_POST_TIMEOUT_MS);
+}
+
+HAL_StatusTypeDef LCD_Server_Sync(uint32_t timeout_ms)
+{
+    uint32_t start = HAL_GetTick();
+    uint32_t primask = __get_PRIMASK();
+    uint32_t errors;
+
+    __disable_irq();
+    errors = srv.stats.errors;
+    __set_PRIMASK(primask);
+
+    for (;;) {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        bool done = srv.stats.rendered + srv.stats.coalesced >= srv.stats.posted;
+        bool failed = srv.stats.errors != errors;
+        __set_PRIMASK(primask);
+        if (done) {
+            return failed ? HAL_ERROR : HAL_OK;
+        }
+        if ((HAL_GetTick() - start) >= timeout_ms) {
+            return HAL_TIMEOUT;
+        }
+        osDelay(1);
+    }
+}
+
+void LCD_Server_GetStats(LCD_Srv_Stats_t *stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *stats = srv.stats;
+    __set_PRIMASK(primask);
+}
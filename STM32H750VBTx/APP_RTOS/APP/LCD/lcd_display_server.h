@@ -0,0 +1,89 @@
+/**
+ ******************************************************************************
+ * @file    lcd_display_server.h
+ * @brief   显示服务任务 - 独占SPI4，其他任务和中断通过消息队列提交绘图命令
+ ******************************************************************************
+ * @note
+ *   - lcd_spi_154.c 的 LCD 结构体、字体指针和 hlcd_dma 都没有互斥保护，
+ *     启动服务后只有服务任务访问它们；客户端的颜色、字体随每条命令传递
+ *   - 服务任务把一帧内收到的命令合并到显示列表（lcd_display_list.c），
+ *     合成到帧缓冲后按脏块刷新，每帧只发送一次，不会出现画到一半的画面
+ *   - 合并规则：slot 非0的命令在同一帧内只保留最后一条；
+ *     实心矩形/渐变矩形完全覆盖的先前命令被丢弃
+ *   - 帧间隔 LCD_SRV_FRAME_MS：距上一帧超过帧间隔时收到命令立即刷新，
+ *     否则继续收集到帧间隔结束
+ ******************************************************************************
+ */
+
+#ifndef __LCD_DISPLAY_SERVER_H
+#define __LCD_DISPLAY_SERVER_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd_display_list.h"
+
+#define LCD_SRV_QUEUE_LEN          32      // 消息队列深度
+#define LCD_SRV_TEXT_MAX           32      // 每条文字命令的最大字节数（含结束符）
+#define LCD_SRV_FRAME_MS           20      // 最小帧间隔（50fps）
+#define LCD_SRV_POST_TIMEOUT_MS    50U     // 便捷函数等待队列空位的超时
+
+/* 绘图样式，随命令传递 */
+typedef struct {
+    uint16_t fg;                // 前景色（RGB565）；渐变为起始色
+    uint16_t bg;                // 文字背景色；渐变为结束色
+    const pFONT *ascii;         // 文字：ASCII字体
+    const pFONT *ch;            // 文字：中文字体，可为NULL
+} LCD_Style_t;
+
+/* 绘图命令 */
+typedef struct {
+    uint8_t  type;              // LCD_DL_Type_t
+    uint8_t  slot;              // 非0：同一帧内相同slot只保留最后一条
+    uint16_t x, y;              // 左上角；圆为圆心
+    uint16_t w, h;              // 宽高；圆的半径放在 w
+    LCD_Style_t style;
+    char     text[LCD_SRV_TEXT_MAX];
+} LCD_Srv_Cmd_t;
+
+/* 统计 */
+typedef struct {
+    uint32_t posted;            // 成功入队的命令数
+    uint32_t rejected;          // 队列满或参数无效被拒绝的命令数
+    uint32_t rendered;          // 实际合成的命令数（含刷新失败的帧）
+    uint32_t coalesced;         // 合并时丢弃的命令数
+    uint32_t frames;            // 刷新成功的帧数
+    uint32_t errors;            // 刷新失败（DMA错误/超时）的帧数，未发出的脏块留到下一帧
+} LCD_Srv_Stats_t;
+
+/**
+ * @brief 启用 hlcd 的帧缓冲并创建服务任务，之后不要再直接调用 LCD_xxx / LCD_DMA_xxx 绘图
+ */
+HAL_StatusTypeDef LCD_Server_Start(LCD_SPI_DMA_Handle_t *hlcd);
+
+/**
+ * @brief 提交命令（任务中调用），队列满时最多等待 timeout 个tick
+ * @retval HAL_ERROR：文字命令的 style.ascii 为NULL
+ */
+HAL_StatusTypeDef LCD_Server_Post(const LCD_Srv_Cmd_t *cmd, uint32_t timeout);
+
+/**
+ * @brief 在中断中提交命令，不等待；队列满时返回 HAL_BUSY
+ */
+HAL_StatusTypeDef LCD_Server_PostFromISR(const LCD_Srv_Cmd_t *cmd);
+
+/* 便捷函数（任务中调用） */
+HAL_StatusTypeDef LCD_Server_FillRect(uint8_t slot, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                      uint16_t color);
+HAL_StatusTypeDef LCD_Server_Text(uint8_t slot, uint16_t x, uint16_t y, const char *text,
+                                  const LCD_Style_t *style);     // text、style、style->ascii 不能为NULL
+
+/**
+ * @brief 等待已提交的命令全部显示到屏幕上
+ * @retval HAL_ERROR：命令都已处理，但调用以来有帧刷新失败；HAL_TIMEOUT：超时
+ */
+HAL_StatusTypeDef LCD_Server_Sync(uint32_t timeout_ms);
+
+void LCD_Server_GetStats(LCD_Srv_Stats_t *stats);
+
+#endif /* __LCD_DISPLAY_SERVER_H */
@@ -0,0 +1,168 @@
+/**
+ ******************************************************************************
+ * @file    lcd_flip.c
+ * @brief   双帧缓冲页面翻转
+ ******************************************************************************
+ */
+
+#include "lcd_flip.h"
+#include "lcd_spi_154.h"
+#include "lcd_blit.h"
+#include <string.h>
+
+#if LCD_FRAME_BUFFER_SIZE > LCD_DMA_MAX_TRANSFER
+#error "整屏超过单次DMA上限，LCD_Flip_Swap 需要分块发送"
+#endif
+
+/* 两个页面放在AXI SRAM（512KB，DMA1可访问，可开启D-Cache）；不在翻转模式时借给动画播放器 */
+__attribute__((section(".ram_d1"))) __attribute__((aligned(32)))
+static uint16_t lcd_flip_pages[LCD_FLIP_PAGES][LCD_FRAME_BUFFER_SIZE];
+
+static struct {
+    bool active;
+    bool sending;                   // 前台页面已启动DMA，尚未等待其结果
+    uint8_t back;                   // 后台页面序号
+    uint32_t back_since;            // 后台页面开始绘制的时刻
+    uint32_t transfer_start;        // 前台页面启动DMA的时刻
+} flip;
+
+static LCD_Flip_Stats_t flip_stats;
+
+static void Flip_Max(uint32_t *max, uint32_t value)
+{
+    if (value > *max) {
+        *max = value;
+    }
+}
+
+/* 等待前台页面发送完成，按完成中断的时刻统计发送时间 */
+static HAL_StatusTypeDef Flip_WaitSent(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    HAL_StatusTypeDef st;
+
+    if (!flip.sending) {
+        return HAL_OK;
+    }
+    st = LCD_SPI_DMA_WaitComplete(hlcd);
+    flip.sending = false;
+
+    if (st == HAL_OK) {
+        flip_stats.transfer_cycles = hlcd->tx_sync.signal_cycles - flip.transfer_start;
+        flip_stats.transfer_cycles_total += flip_stats.transfer_cycles;
+        Flip_Max(&flip_stats.transfer_cycles_max, flip_stats.transfer_cycles);
+    } else {
+        flip_stats.errors++;
+    }
+    return st;
+}
+
+HAL_StatusTypeDef LCD_Flip_Begin(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    if (flip.active || hlcd->frame_buffer_enabled) {
+        return HAL_BUSY;
+    }
+
+    // 屏幕当前内容未知，两个页面都从黑屏开始
+    memset(lcd_flip_pages, 0, sizeof(lcd_flip_pages));
+    memset(&flip, 0, sizeof(flip));
+    LCD_SPI_DMA_WaitComplete(hlcd);
+
+    hlcd->frame_buffer = lcd_flip_pages[0];
+    hlcd->frame_buffer_enabled = true;
+    memset(hlcd->dirty_tiles, 0, sizeof(hlcd->dirty_tiles));
+
+    flip.active = true;
+    flip.back_since = DWT->CYCCNT;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef LCD_Flip_Swap(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    HAL_StatusTypeDef prev, st;
+    uint16_t *page;
+
+    if (!flip.active) {
+        return HAL_ERROR;
+    }
+
+    // 1. 后台页面上的DMA2D操作完成后才算画完
+    LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+    uint32_t t0 = DWT->CYCCNT;
+    flip_stats.draw_cycles = t0 - flip.back_since;
+    flip_stats.draw_cycles_total += flip_stats.draw_cycles;
+    Flip_Max(&flip_stats.draw_cycles_max, flip_stats.draw_cycles);
+
+    // 2. SPI同时只能发送一个页面：上一帧还在发送时等待
+    if (flip.sending && DMA_Sync_IsBusy(&hlcd->tx_sync)) {
+        flip_stats.blocked++;
+    }
+    prev = Flip_WaitSent(hlcd);
+    uint32_t t1 = DWT->CYCCNT;
+    flip_stats.wait_cycles = t1 - t0;
+    flip_stats.wait_cycles_total += flip_stats.wait_cycles;
+    Flip_Max(&flip_stats.wait_cycles_max, flip_stats.wait_cycles);
+
+    // 3. 整屏一次DMA，LCD_Xfer_Data16_DMA 先写回页面所在的D-Cache行
+    page = lcd_flip_pages[flip.back];
+    LCD_SPI_DMA_SetWindow(hlcd, 0, 0, LCD_WIDTH, LCD_HEIGHT);
+    st = LCD_SPI_DMA_WriteBuffer_Async(hlcd, page, LCD_FRAME_BUFFER_SIZE);
+    flip.transfer_start = DWT->CYCCNT;
+    flip_stats.submit_cycles = flip.transfer_start - t1;
+    if (st == HAL_OK) {
+        flip.sending = true;
+    } else {
+        flip_stats.errors++;
+    }
+
+    // 4. 交换：刚发送完的上一帧页面成为后台页面
+    flip.back ^= 1U;
+    hlcd->frame_buffer = lcd_flip_pages[flip.back];
+    memset(hlcd->dirty_tiles, 0, sizeof(hlcd->dirty_tiles));
+    flip_stats.frames++;
+    flip.back_since = DWT->CYCCNT;
+
+    return (prev != HAL_OK) ? prev : st;
+}
+
+HAL_StatusTypeDef LCD_Flip_End(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    HAL_StatusTypeDef st;
+
+    if (!flip.active) {
+        return HAL_OK;
+    }
+    LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+    st = Flip_WaitSent(hlcd);
+    LCD_CS_Deselect;
+
+    hlcd->frame_buffer = NULL;
+    hlcd->frame_buffer_enabled = false;
+    memset(hlcd->dirty_tiles, 0, sizeof(hlcd->dirty_tiles));
+    flip.active = false;
+    return st;
+}
+
+uint16_t *LCD_Flip_GetBackBuffer(void)
+{
+    return flip.active ? lcd_flip_pages[flip.back] : NULL;
+}
+
+bool LCD_Flip_IsActive(void)
+{
+    return flip.active;
+}
+
+uint16_t *LCD_Flip_BorrowPage(uint8_t page)
+{
+    return (flip.active || page >= LCD_FLIP_PAGES) ? NULL : lcd_flip_pages[page];
+}
+
+void LCD_Flip_GetStats(LCD_Flip_Stats_t *stats)
+{
+    *stats = flip_stats;
+}
+
+void LCD_Flip_ResetStats(void)
+{
+    memset(&flip_stats, 0, sizeof(flip_stats));
+}
@@ -0,0 +1,73 @@
+/**
+ ******************************************************************************
+ * @file    lcd_flip.h
+ * @brief   双帧缓冲页面翻转 - 两个整屏页面放在AXI SRAM，绘制后台页面的同时DMA发送前台页面
+ ******************************************************************************
+ * @note
+ *   - 翻转模式期间驱动句柄处于帧缓冲模式，frame_buffer 指向后台页面：
+ *     LCD_FB_xxx、LCD_DMA_FillRect/DrawImage、LCD_DL_Render、LCD_QOI_Draw 等都画到后台页面，
+ *     由 LCD_Flip_Swap 整屏发送，不使用 LCD_SPI_DMA_FlushFrameBuffer
+ *   - LCD_Flip_Swap 等待位块传输完成，写回后台页面的D-Cache（LCD_Xfer_Data16_DMA 中），
+ *     整屏一次DMA发送后立即返回；只有上一帧仍在发送时才阻塞
+ *   - 翻转后的后台页面是上上帧的内容，每帧需要重画全部改动过的区域（通常整屏重画）
+ *   - 每帧整屏只经过一次SPI且屏幕上不会出现画了一半的帧；代价是两个页面共230KB AXI SRAM，
+ *     这两个页面与动画播放器（lcd_player.c）分时共用，不能同时使用
+ *   - 同一时刻只有一个任务使用本模块
+ ******************************************************************************
+ */
+
+#ifndef __LCD_FLIP_H
+#define __LCD_FLIP_H
+
+#include "stm32h7xx_hal.h"
+#include "lcd_spi_dma.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LCD_FLIP_PAGES          2
+
+typedef struct {
+    uint32_t frames;                // 翻转次数
+    uint32_t errors;                // 发送失败或超时
+    uint32_t blocked;               // 翻转时上一帧仍在发送、需要等待的次数
+    uint32_t draw_cycles;           // 最近一帧的绘制时间：上次翻转返回到本次翻转调用（含等待位块传输）
+    uint32_t wait_cycles;           // 最近一次翻转等待上一帧发送完成的时间
+    uint32_t submit_cycles;         // 最近一次翻转写回D-Cache、设置窗口并启动DMA的时间
+    uint32_t transfer_cycles;       // 最近一帧的发送时间：启动DMA到完成中断
+    uint32_t draw_cycles_max;
+    uint32_t wait_cycles_max;
+    uint32_t transfer_cycles_max;
+    uint64_t draw_cycles_total;
+    uint64_t wait_cycles_total;
+    uint64_t transfer_cycles_total;
+} LCD_Flip_Stats_t;
+
+/**
+ * @brief 进入翻转模式，后台页面成为驱动的帧缓冲
+ * @retval HAL_BUSY 已经在翻转模式或驱动的帧缓冲模式已启用
+ * @note  两个页面清为黑色；第一次翻转之前屏幕内容不变
+ */
+HAL_StatusTypeDef LCD_Flip_Begin(LCD_SPI_DMA_Handle_t *hlcd);
+
+/**
+ * @brief 发送后台页面并交换前后台
+ * @retval 上一帧的发送结果（HAL_ERROR/HAL_TIMEOUT 时本帧仍然发送）或本帧启动DMA的结果
+ */
+HAL_StatusTypeDef LCD_Flip_Swap(LCD_SPI_DMA_Handle_t *hlcd);
+
+/* 等待最后一帧发送完成并退出翻转模式，驱动回到直接模式 */
+HAL_StatusTypeDef LCD_Flip_End(LCD_SPI_DMA_Handle_t *hlcd);
+
+uint16_t *LCD_Flip_GetBackBuffer(void);         // 当前后台页面，不在翻转模式时为NULL
+bool LCD_Flip_IsActive(void);
+
+/**
+ * @brief 借用页面内存（LCD_FRAME_BUFFER_SIZE 个像素，AXI SRAM）
+ * @retval 翻转模式期间返回NULL
+ */
+uint16_t *LCD_Flip_BorrowPage(uint8_t page);
+
+void LCD_Flip_GetStats(LCD_Flip_Stats_t *stats);
+void LCD_Flip_ResetStats(void);
+
+#endif /* __LCD_FLIP_H */
@@ -0,0 +1,297 @@
+/**
+ ******************************************************************************
+ * @file    lcd_font_blob.c
+ * @brief   压缩字库解码与文字显示
+ ******************************************************************************
+ * @note
+ *   - 字库数据只读，解码过程中不需要整字的中间点阵
+ *   - 与 lcd_spi_154.c 一样只应在同一个任务中调用
+ ******************************************************************************
+ */
+
+#include "lcd_font_blob.h"
+#include "lcd_font_index.h"
+#include <stddef.h>
+
+/* ==================== 内部函数 ==================== */
+
+static void FontBlob_Fill(uint16_t *dst, uint16_t count, uint16_t color)
+{
+    while (count--) {
+        *dst++ = color;
+    }
+}
+
+/* ==================== 接口函数 ==================== */
+
+/**
+ * @brief 打开字库
+ */
+HAL_StatusTypeDef LCD_FontBlob_Open(LCD_FontBlob_t *font, const void *data)
+{
+    const LCD_FontBlob_Header_t *header = data;
+
+    if (data == NULL || ((uintptr_t)data & 3) != 0) {
+        return HAL_ERROR;
+    }
+    if (header->magic != LCD_FONT_BLOB_MAGIC || header->version != LCD_FONT_BLOB_VERSION ||
+        (header->bpp != 1 && header->bpp != 2 && header->bpp != 4) || header->height == 0) {
+        return HAL_ERROR;
+    }
+
+    font->header = header;
+    font->index = (const LCD_FontBlob_Entry_t *)((const uint8_t *)data + header->index_offset);
+    font->data = (const uint8_t *)data + header->data_offset;
+    return HAL_OK;
+}
+
+/**
+ * @brief 查找字符（二分查找）
+ */
+const LCD_FontBlob_Entry_t *LCD_FontBlob_Find(const LCD_FontBlob_t *font, uint16_t code)
+{
+    for (int pass = 0; pass < 2; pass++) {
+        uint32_t lo = 0, hi = font->header->count;
+
+        while (lo < hi) {
+            uint32_t mid = (lo + hi) / 2;
+            uint16_t c = font->index[mid].code;
+
+            if (c == code) return &font->index[mid];
+            if (c < code) lo = mid + 1;
+            else          hi = mid;
+        }
+
+        /* 没有该字符：改用默认字符再找一次 */
+        code = font->header->default_code;
+        if (code == 0) break;
+    }
+    return NULL;
+}
+
+/**
+ * @brief 开始解码一个字符
+ */
+void LCD_FontBlob_Begin(LCD_FontBlob_Decoder_t *dec, const LCD_FontBlob_t *font,
+                        const LCD_FontBlob_Entry_t *entry)
+{
+    dec->src = font->data + entry->offset;
+    dec->width = entry->width;
+    dec->bpp = font->header->bpp;
+    dec->encoding = entry->encoding;
+    dec->run_bg = 0;
+    dec->run_fg = 0;
+    dec->tail = false;
+}
+
+/**
+ * @brief 生成显示用的调色板
+ */
+void LCD_FontBlob_MakePalette(const LCD_FontBlob_t *font, uint16_t *palette, uint16_t fg, uint16_t bg)
+{
+    LCD_Blend_Palette(palette, font->header->bpp, fg, bg);
+}
+
+/**
+ * @brief 解码一行像素
+ */
+void LCD_FontBlob_DecodeRow(LCD_FontBlob_Decoder_t *dec, uint16_t *dst, const uint16_t *palette)
+{
+    uint16_t left = dec->width;
+    uint16_t bg = palette[0], fg = palette[(1U << dec->bpp) - 1U];
+
+    if (dec->encoding == LCD_GLYPH_RAW) {
+        LCD_Blend_ExpandRow(dst, dec->src, dec->width, dec->bpp, palette);
+        dec->src += (dec->width * dec->bpp + 7) / 8;
+        return;
+    }
+
+    /* RLE：背景/前景交替的游程，一次填充一段 */
+    while (left > 0) {
+        if (dec->tail) {
+            FontBlob_Fill(dst, left, bg);
+            return;
+        }
+        if (dec->run_bg == 0 && dec->run_fg == 0) {
+            uint8_t b = *dec->src++;
+
+            if (b == 0) {
+                dec->tail = true;
+                continue;
+            }
+            dec->run_bg = b >> 4;
+            dec->run_fg = b & 0x0F;
+        }
+        if (dec->run_bg > 0) {
+            uint16_t n = (dec->run_bg < left) ? dec->run_bg : left;
+            FontBlob_Fill(dst, n, bg);
+            dst += n;
+            left -= n;
+            dec->run_bg -= n;
+        } else {
+            uint16_t n = (dec->run_fg < left) ? dec->run_fg : left;
+            FontBlob_Fill(dst, n, fg);
+            dst += n;
+            left -= n;
+            dec->run_fg -= n;
+        }
+    }
+}
+
+/**
+ * @brief 解码一行并以前景色混合到已有像素上
+ */
+void LCD_FontBlob_BlendRow(LCD_FontBlob_Decoder_t *dec, uint16_t *dst, uint16_t fg)
+{
+    uint16_t left = dec->width;
+
+    if (dec->encoding == LCD_GLYPH_RAW) {
+        LCD_Blend_AlphaRow(dst, dec->src, dec->width, dec->bpp, fg);
+        dec->src += (dec->width * dec->bpp + 7) / 8;
+        return;
+    }
+
+    /* RLE：背景游程跳过，前景游程直接写入 */
+    while (left > 0 && !dec->tail) {
+        if (dec->run_bg == 0 && dec->run_fg == 0) {
+            uint8_t b = *dec->src++;
+
+            if (b == 0) {
+                dec->tail = true;
+                break;
+            }
+            dec->run_bg = b >> 4;
+            dec->run_fg = b & 0x0F;
+        }
+        if (dec->run_bg > 0) {
+            uint16_t n = (dec->run_bg < left) ? dec->run_bg : left;
+            dst += n;
+            left -= n;
+            dec->run_bg -= n;
+        } else {
+            uint16_t n = (dec->run_fg < left) ? dec->run_fg : left;
+            FontBlob_Fill(dst, n, fg);
+            dst += n;
+            left -= n;
+            dec->run_fg -= n;
+        }
+    }
+}
+
+/**
+ * @brief 计算字符串的显示宽度
+ */
+uint16_t LCD_FontBlob_TextWidth(const LCD_FontBlob_t *font, const char *text)
+{
+    uint16_t width = 0, code;
+
+    while (*text) {
+        text += LCD_FontIndex_Decode(text, &code);
+        const LCD_FontBlob_Entry_t *entry = LCD_FontBlob_Find(font, code);
+        if (entry != NULL) {
+            width += entry->width;
+        }
+    }
+    return width;
+}
+
+/**
+ * @brief 用V2驱动显示一行文字
+ */
+HAL_StatusTypeDef LCD_FontBlob_DrawText(LCD_SPI_DMA_V2_Handle_t *hlcd, const LCD_FontBlob_t *font,
+                                        uint16_t x, uint16_t y, const char *text,
+                                        uint16_t fg, uint16_t bg)
+{
+    LCD_FontBlob_Decoder_t dec[LCD_FONT_BLOB_MAX_LINE];
+    uint16_t xoff[LCD_FONT_BLOB_MAX_LINE];
+    uint16_t palette[16];
+    uint16_t height = font->header->height;
+    uint16_t count = 0, width = 0, code;
+
+    if (x >= LCD_WIDTH_V2 || y + height > LCD_HEIGHT_V2) {
+        return HAL_ERROR;
+    }
+
+    /* 找出本行能显示的字符 */
+    while (*text && count < LCD_FONT_BLOB_MAX_LINE) {
+        text += LCD_FontIndex_Decode(text, &code);
+        const LCD_FontBlob_Entry_t *entry = LCD_FontBlob_Find(font, code);
+
+        if (entry == NULL) continue;
+        if (x + width + entry->width > LCD_WIDTH_V2) break;
+
+        LCD_FontBlob_Begin(&dec[count], font, entry);
+        xoff[count++] = width;
+        width += entry->width;
+    }
+    if (count == 0) {
+        return HAL_OK;
+    }
+
+    LCD_FontBlob_MakePalette(font, palette, fg, bg);
+
+    HAL_StatusTypeDef status = LCD_V2_SetWindow(hlcd, x, y, x + width - 1, y + height - 1);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    /* 每个DMA缓冲区装若干整行，装满即提交，DMA发送时CPU解码下一块 */
+    uint16_t rows_per_buffer = LCD_SINGLE_BUFFER_SIZE / width;
+    uint16_t row = 0;
+
+    while (row < height) {
+        uint16_t *buf = LCD_V2_GetWriteBuffer(hlcd);
+        uint16_t rows = (height - row < rows_per_buffer) ? (height - row) : rows_per_buffer;
+
+        if (buf == NULL) {
+            status = HAL_TIMEOUT;
+            break;
+        }
+        for (uint16_t r = 0; r < rows; r++) {
+            uint16_t *line = buf + r * width;
+            for (uint16_t i = 0; i < count; i++) {
+                LCD_FontBlob_DecodeRow(&dec[i], line + xoff[i], palette);
+            }
+        }
+        LCD_V2_SubmitBuffer(hlcd, (uint32_t)rows * width);
+        row += rows;
+    }
+
+    if (LCD_V2_FlushBuffers(hlcd) != HAL_OK && status == HAL_OK) {
+        status = HAL_ERROR;
+    }
+    return status;
+}
+
+/**
+ * @brief 在V2帧缓冲中显示一行文字
+ */
+HAL_StatusTypeDef LCD_FontBlob_DrawTextFB(LCD_SPI_DMA_V2_Handle_t *hlcd, const LCD_FontBlob_t *font,
+                                          uint16_t x, uint16_t y, const char *text, uint16_t fg)
+{
+    uint16_t height = font->header->height;
+    uint16_t code;
+
+    if (!hlcd->frame_buffer_enabled || hlcd->frame_buffer == NULL) {
+        return HAL_ERROR;
+    }
+    if (y + height > LCD_HEIGHT_V2) {
+        height = (y < LCD_HEIGHT_V2) ? LCD_HEIGHT_V2 - y : 0;
+    }
+
+    while (*text) {
+        text += LCD_FontIndex_Decode(text, &code);
+        const LCD_FontBlob_Entry_t *entry = LCD_FontBlob_Find(font, code);
+        LCD_FontBlob_Decoder_t dec;
+
+        if (entry == NULL) continue;
+        if (x + entry->width > LCD_WIDTH_V2) break;
+
+        LCD_FontBlob_Begin(&dec, font, entry);
+        for (uint16_t row = 0; row < height; row++) {
+            LCD_FontBlob_BlendRow(&dec, &hlcd->frame_buffer[(y + row) * LCD_WIDTH_V2 + x], fg);
+        }
+        x += entry->width;
+    }
+    return HAL_OK;
+}
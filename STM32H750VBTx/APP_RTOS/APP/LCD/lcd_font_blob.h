@@ -0,0 +1,139 @@
+/**
+ ******************************************************************************
+ * @file    lcd_font_blob.h
+ * @brief   压缩字库 - 由主机工具 host_fontc 生成，逐行解码直接写入DMA缓冲区
+ ******************************************************************************
+ * @note
+ *   字库文件结构（小端，4字节对齐），整体为一个只读数组，可放在QSPI中直接访问：
+ *     文件头 LCD_FontBlob_Header_t
+ *     索引表 LCD_FontBlob_Entry_t[count]，按编码升序排列，二分查找
+ *     字模区 每个字模按 encoding 存放：
+ *       LCD_GLYPH_RAW - 每行 (width*bpp+7)/8 字节，字节内低位在前（1bpp时与 lcd_fonts.c 相同）
+ *       LCD_GLYPH_RLE - 仅1bpp：每字节高4位为背景色像素数、低4位为前景色像素数，
+ *                       按行连续计数（可跨行），0x00 表示剩余像素全为背景色
+ *   1bpp字库由编码器对每个字模取两种方式中较短的一种；2/4bpp（抗锯齿）字库均为RAW
+ ******************************************************************************
+ */
+
+#ifndef __LCD_FONT_BLOB_H
+#define __LCD_FONT_BLOB_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd_spi_dma_v2.h"
+#include "lcd_blend.h"
+
+#define LCD_FONT_BLOB_MAGIC         0x3142464CU     // "LFB1"
+#define LCD_FONT_BLOB_VERSION       1
+#define LCD_FONT_BLOB_MAX_LINE      40              // 单行文字最多字符数（1206字体满屏宽为40个）
+
+/* 字模编码方式 */
+#define LCD_GLYPH_RAW               0
+#define LCD_GLYPH_RLE               1
+
+/* 文件头（32字节） */
+typedef struct {
+    uint32_t magic;             // LCD_FONT_BLOB_MAGIC
+    uint16_t version;           // LCD_FONT_BLOB_VERSION
+    uint8_t  bpp;               // 每像素位数：1，或抗锯齿字库的2、4
+    uint8_t  flags;             // 保留
+    uint16_t height;            // 字符高度（所有字符相同）
+    uint16_t max_width;         // 最大字符宽度
+    uint32_t count;             // 字符数量
+    uint32_t index_offset;      // 索引表偏移（相对文件头）
+    uint32_t data_offset;       // 字模区偏移（相对文件头）
+    uint32_t data_size;         // 字模区字节数
+    uint16_t default_code;      // 字库中没有的字符用该字符代替，0表示不显示
+    uint16_t reserved;
+} LCD_FontBlob_Header_t;
+
+/* 索引条目（8字节） */
+typedef struct {
+    uint16_t code;              // 字符编码（Unicode，与 LCD_FontIndex_Decode 一致）
+    uint8_t  width;             // 字符宽度（像素），也是显示时的步进
+    uint8_t  encoding;          // LCD_GLYPH_RAW / LCD_GLYPH_RLE
+    uint32_t offset;            // 字模数据偏移（相对字模区）
+} LCD_FontBlob_Entry_t;
+
+/* 已打开的字库 */
+typedef struct {
+    const LCD_FontBlob_Header_t *header;
+    const LCD_FontBlob_Entry_t  *index;
+    const uint8_t               *data;
+} LCD_FontBlob_t;
+
+/* 逐行解码器，每个正在解码的字符一个 */
+typedef struct {
+    const uint8_t *src;         // 下一个待读取的字模字节
+    uint8_t  width;
+    uint8_t  bpp;
+    uint8_t  encoding;
+    uint8_t  run_bg;            // RLE：当前字节剩余的背景色像素
+    uint8_t  run_fg;            // RLE：当前字节剩余的前景色像素
+    bool     tail;              // RLE：已读到结束标记，剩余像素全为背景色
+} LCD_FontBlob_Decoder_t;
+
+/**
+ * @brief 打开字库（只检查文件头，不复制数据）
+ * @param data 字库数据起始地址，需4字节对齐
+ * @retval HAL_OK 成功；HAL_ERROR 文件头无效或版本不支持
+ */
+HAL_StatusTypeDef LCD_FontBlob_Open(LCD_FontBlob_t *font, const void *data);
+
+/**
+ * @brief 查找字符
+ * @retval 索引条目，字库中没有时返回 default_code 对应的条目，两者都没有时返回NULL
+ */
+const LCD_FontBlob_Entry_t *LCD_FontBlob_Find(const LCD_FontBlob_t *font, uint16_t code);
+
+/**
+ * @brief 开始解码一个字符
+ */
+void LCD_FontBlob_Begin(LCD_FontBlob_Decoder_t *dec, const LCD_FontBlob_t *font,
+                        const LCD_FontBlob_Entry_t *entry);
+
+/**
+ * @brief 生成显示用的调色板（1<<bpp 个颜色，纯色背景下抗锯齿只需查表）
+ */
+void LCD_FontBlob_MakePalette(const LCD_FontBlob_t *font, uint16_t *palette, uint16_t fg, uint16_t bg);
+
+/**
+ * @brief 解码一行像素（entry->width 个RGB565像素）
+ * @param palette 由 LCD_FontBlob_MakePalette 生成
+ * @note  字符的所有行需按从上到下的顺序依次调用
+ */
+void LCD_FontBlob_DecodeRow(LCD_FontBlob_Decoder_t *dec, uint16_t *dst, const uint16_t *palette);
+
+/**
+ * @brief 解码一行并以前景色混合到已有像素上（背景透明，用于帧缓冲）
+ */
+void LCD_FontBlob_BlendRow(LCD_FontBlob_Decoder_t *dec, uint16_t *dst, uint16_t fg);
+
+/**
+ * @brief 计算字符串的显示宽度（像素）
+ */
+uint16_t LCD_FontBlob_TextWidth(const LCD_FontBlob_t *font, const char *text);
+
+/**
+ * @brief 用V2驱动显示一行文字
+ * @note  整行只设置一次窗口，各字符逐行解码后拼入DMA缓冲区，CPU解码与DMA发送交替进行；
+ *        超出屏幕宽度或 LCD_FONT_BLOB_MAX_LINE 的字符不显示
+ * @param text 字符串（编码方式见 LCD_CH_UTF8）
+ * @param fg   前景色（RGB565）
+ * @param bg   背景色（RGB565）
+ * @retval HAL状态
+ */
+HAL_StatusTypeDef LCD_FontBlob_DrawText(LCD_SPI_DMA_V2_Handle_t *hlcd, const LCD_FontBlob_t *font,
+                                        uint16_t x, uint16_t y, const char *text,
+                                        uint16_t fg, uint16_t bg);
+
+/**
+ * @brief 在V2帧缓冲中显示一行文字（背景透明，抗锯齿字库与已有画面混合）
+ * @note  只修改帧缓冲，需调用 LCD_V2_RefreshFrame 刷新到屏幕；超出屏幕的部分不显示
+ * @retval HAL_ERROR 帧缓冲未启用
+ */
+HAL_StatusTypeDef LCD_FontBlob_DrawTextFB(LCD_SPI_DMA_V2_Handle_t *hlcd, const LCD_FontBlob_t *font,
+                                          uint16_t x, uint16_t y, const char *text, uint16_t fg);
+
+#endif /* __LCD_FONT_BLOB_H */
@@ -0,0 +1,265 @@
+/**
+ ******************************************************************************
+ * @file    lcd_font_index.c
+ * @brief   中文字模索引
+ ******************************************************************************
+ * @note
+ *   - 索引按 (编码, 行号) 排序，同一汉字出现多次时取表中靠前的一个，与逐行比较的结果一致
+ *   - 字模表中未使用的行（索引行首字节为0）不进入索引
+ ******************************************************************************
+ */
+
+#include "lcd_font_index.h"
+#include <stddef.h>
+#include <stdlib.h>
+
+/* 已建立索引的字体 */
+typedef struct {
+    const pFONT *font;
+    LCD_FontIndex_Entry_t *entries;     // NULL 表示索引池不足，该字体使用逐行比较
+    uint16_t count;
+} FontIndex_t;
+
+static FontIndex_t font_indexes[LCD_FONT_INDEX_MAX_FONTS];
+static uint8_t index_count = 0;
+static FontIndex_t *last_index = NULL;     // 连续显示同一字体时免去查找
+
+static LCD_FontIndex_Entry_t index_pool[LCD_FONT_INDEX_POOL_SIZE];
+static uint16_t pool_used = 0;
+
+/* 方框字模，按最后一次请求的字体尺寸生成 */
+static uint8_t fallback_bitmap[(32 / 8) * 32];
+static const pFONT *fallback_font = NULL;
+
+/* ==================== 内部函数 ==================== */
+
+static int FontIndex_Compare(const void *a, const void *b)
+{
+    const LCD_FontIndex_Entry_t *ea = a, *eb = b;
+
+    if (ea->code != eb->code) return (ea->code < eb->code) ? -1 : 1;
+    return (ea->row < eb->row) ? -1 : (ea->row > eb->row);
+}
+
+/**
+ * @brief 扫描字模表建立排序后的索引
+ * @retval 索引条目数，存储区不足返回 -1
+ */
+static int32_t FontIndex_Build(const pFONT *font, LCD_FontIndex_Entry_t *entries, uint16_t capacity)
+{
+    uint16_t n = 0, out = 0;
+    uint16_t code;
+
+    for (uint32_t row = 0; row + 1 < font->Table_Rows; row += 2) {
+        const char *name = (const char *)(font->pTable + (row + 1) * font->Sizes);
+
+        if (name[0] == 0) continue;             // 未使用的行
+        LCD_FontIndex_Decode(name, &code);
+        if (code == 0) continue;
+        if (n >= capacity) return -1;
+
+        entries[n].code = code;
+        entries[n].row = row;
+        n++;
+    }
+
+    qsort(entries, n, sizeof(entries[0]), FontIndex_Compare);
+
+    /* 去掉重复的汉字，保留行号最小的一个 */
+    for (uint16_t i = 0; i < n; i++) {
+        if (out == 0 || entries[out - 1].code != entries[i].code) {
+            entries[out++] = entries[i];
+        }
+    }
+    return out;
+}
+
+static FontIndex_t *FontIndex_Get(const pFONT *font)
+{
+    if (last_index != NULL && last_index->font == font) {
+        return last_index;
+    }
+    for (uint8_t i = 0; i < index_count; i++) {
+        if (font_indexes[i].font == font) {
+            last_index = &font_indexes[i];
+            return last_index;
+        }
+    }
+    if (index_count >= LCD_FONT_INDEX_MAX_FONTS) {
+        return NULL;
+    }
+
+    /* 第一次使用的字体：从索引池分配 */
+    FontIndex_t *idx = &font_indexes[index_count++];
+    uint16_t need = font->Table_Rows / 2;
+
+    idx->font = font;
+    idx->entries = NULL;
+    idx->count = 0;
+    if (pool_used + need <= LCD_FONT_INDEX_POOL_SIZE) {
+        int32_t n = FontIndex_Build(font, &index_pool[pool_used], need);
+        if (n >= 0) {
+            idx->entries = &index_pool[pool_used];
+            idx->count = n;
+            pool_used += n;
+        }
+    }
+    last_index = idx;
+    return idx;
+}
+
+/* ==================== 接口函数 ==================== */
+
+/**
+ * @brief 解析一个汉字的编码
+ */
+uint8_t LCD_FontIndex_Decode(const char *pText, uint16_t *code)
+{
+    const uint8_t *p = (const uint8_t *)pText;
+
+    if (p[0] < 0x80) {
+        *code = p[0];
+        return 1;
+    }
+#if LCD_CH_UTF8
+    if ((p[0] & 0xE0) == 0xC0 && (p[1] & 0xC0) == 0x80) {
+        *code = ((p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+        return 2;
+    }
+    if ((p[0] & 0xF0) == 0xE0 && (p[1] & 0xC0) == 0x80 && (p[2] & 0xC0) == 0x80) {
+        *code = ((p[0] & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+        return 3;
+    }
+    if ((p[0] & 0xF8) == 0xF0 && (p[1] & 0xC0) == 0x80 && (p[2] & 0xC0) == 0x80 && (p[3] & 0xC0) == 0x80) {
+        *code = 0;                              // 超出16位编码范围，显示方框
+        return 4;
+    }
+#else
+    if (p[1] != 0) {
+        *code = (p[0] << 8) | p[1];
+        return 2;
+    }
+#endif
+    *code = 0;                                  // 不完整或非法的编码，跳过一个字节
+    return 1;
+}
+
+/**
+ * @brief 为字体建立索引，索引存放在调用者提供的区域
+ */
+HAL_StatusTypeDef LCD_FontIndex_Register(const pFONT *font, LCD_FontIndex_Entry_t *entries, uint16_t capacity)
+{
+    FontIndex_t *idx = NULL;
+    int32_t n;
+
+    for (uint8_t i = 0; i < index_count; i++) {
+        if (font_indexes[i].font == font) {
+            idx = &font_indexes[i];             // 重新注册：改用调用者的存储区
+            break;
+        }
+    }
+    if (idx == NULL) {
+        if (index_count >= LCD_FONT_INDEX_MAX_FONTS) {
+            return HAL_ERROR;
+        }
+        idx = &font_indexes[index_count++];
+        idx->font = font;
+        idx->entries = NULL;
+        idx->count = 0;
+    }
+
+    n = FontIndex_Build(font, entries, capacity);
+    if (n < 0) {
+        return HAL_ERROR;
+    }
+    idx->entries = entries;
+    idx->count = n;
+    last_index = idx;
+    return HAL_OK;
+}
+
+/**
+ * @brief 查找汉字的字模（二分查找）
+ */
+const uint8_t *LCD_FontIndex_Find(const pFONT *font, uint16_t code)
+{
+    FontIndex_t *idx = FontIndex_Get(font);
+    int32_t row;
+
+    if (code == 0) {
+        return NULL;
+    }
+
+    if (idx == NULL || idx->entries == NULL) {
+        row = LCD_FontIndex_Scan(font, code);
+    } else {
+        uint16_t lo = 0, hi = idx->count;
+
+        row = -1;
+        while (lo < hi) {
+            uint16_t mid = (lo + hi) / 2;
+            uint16_t c = idx->entries[mid].code;
+
+            if (c == code) {
+                row = idx->entries[mid].row;
+                break;
+            }
+            if (c < code) lo = mid + 1;
+            else          hi = mid;
+        }
+    }
+
+    return (row < 0) ? NULL : font->pTable + row * font->Sizes;
+}
+
+/**
+ * @brief 获取找不到汉字时显示的方框字模
+ */
+const uint8_t *LCD_FontIndex_Fallback(const pFONT *font)
+{
+    uint16_t w = font->Width, h = font->Height;
+    uint16_t row_bytes = (w + 7) / 8;
+
+    if (fallback_font == font) {
+        return fallback_bitmap;
+    }
+    if (row_bytes * h > sizeof(fallback_bitmap)) {
+        return NULL;
+    }
+
+    /* 四周各留出1/8字宽的空白 */
+    uint16_t x0 = w / 8, x1 = w - 1 - w / 8;
+    uint16_t y0 = h / 8, y1 = h - 1 - h / 8;
+
+    for (uint16_t i = 0; i < row_bytes * h; i++) {
+        fallback_bitmap[i] = 0;
+    }
+    for (uint16_t y = y0; y <= y1; y++) {
+        for (uint16_t x = x0; x <= x1; x++) {
+            if (y == y0 || y == y1 || x == x0 || x == x1) {
+                fallback_bitmap[y * row_bytes + x / 8] |= 1 << (x % 8);     // 字节内低位在前
+            }
+        }
+    }
+    fallback_font = font;
+    return fallback_bitmap;
+}
+
+/**
+ * @brief 逐行比较查找
+ */
+int32_t LCD_FontIndex_Scan(const pFONT *font, uint16_t code)
+{
+    uint16_t c;
+
+    for (uint32_t row = 0; row + 1 < font->Table_Rows; row += 2) {
+        const char *name = (const char *)(font->pTable + (row + 1) * font->Sizes);
+
+        if (name[0] == 0) continue;
+        LCD_FontIndex_Decode(name, &c);
+        if (c == code) {
+            return row;
+        }
+    }
+    return -1;
+}
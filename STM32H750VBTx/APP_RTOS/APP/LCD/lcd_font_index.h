@@ -0,0 +1,72 @@
+/**
+ ******************************************************************************
+ * @file    lcd_font_index.h
+ * @brief   中文字模索引 - 按字符编码排序后二分查找，替代逐行比较
+ ******************************************************************************
+ * @note
+ *   - 字模表格式不变（字模行 + 汉字索引行交替），索引在第一次使用该字体时建立
+ *   - 内置字体（CH_Font12..CH_Font32）的索引放在内部索引池中；
+ *     外部大字库（例如放在QSPI的常用字库）可用 LCD_FontIndex_Register 提供索引存储区
+ *   - 字库中找不到的汉字返回方框字模，不再读取未初始化的地址
+ ******************************************************************************
+ */
+
+#ifndef __LCD_FONT_INDEX_H
+#define __LCD_FONT_INDEX_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include "lcd_fonts.h"
+
+/* 汉字的编码方式，需与源文件（字模表中的索引汉字和显示的字符串）一致：
+ *   1 - UTF-8（本工程源文件均为UTF-8）
+ *   0 - GB2312/GBK 双字节编码 */
+#ifndef LCD_CH_UTF8
+#define LCD_CH_UTF8                 1
+#endif
+
+#define LCD_FONT_INDEX_MAX_FONTS    8           // 最多可建立索引的字体数量
+#define LCD_FONT_INDEX_POOL_SIZE    128         // 内置字体共用的索引条目数（每个汉字4字节）
+
+/* 索引条目：汉字编码 -> 字模所在的行号 */
+typedef struct {
+    uint16_t code;
+    uint16_t row;
+} LCD_FontIndex_Entry_t;
+
+/**
+ * @brief 解析一个汉字的编码
+ * @param pText 字符串中汉字的起始地址
+ * @param code  输出：汉字编码（UTF-8时为Unicode码点，GB2312时为两字节编码），无法解析时为0
+ * @retval 该字符占用的字节数（至少为1，保证调用者能继续向后解析）
+ */
+uint8_t LCD_FontIndex_Decode(const char *pText, uint16_t *code);
+
+/**
+ * @brief 为字体建立索引，索引存放在调用者提供的区域
+ * @param entries  索引存储区，至少 Table_Rows/2 个条目
+ * @retval HAL_OK 成功；HAL_ERROR 存储区不足或已注册的字体数量已满
+ */
+HAL_StatusTypeDef LCD_FontIndex_Register(const pFONT *font, LCD_FontIndex_Entry_t *entries, uint16_t capacity);
+
+/**
+ * @brief 查找汉字的字模
+ * @param code 由 LCD_FontIndex_Decode 得到的编码
+ * @retval 字模数据（font->Sizes 字节），字库中没有该汉字时返回NULL
+ * @note   未注册的字体在第一次查找时从内部索引池建立索引；索引池不足时退回逐行比较
+ */
+const uint8_t *LCD_FontIndex_Find(const pFONT *font, uint16_t code);
+
+/**
+ * @brief 获取找不到汉字时显示的方框字模（与字体同尺寸）
+ * @retval 字模数据，字体大于3232时返回NULL
+ */
+const uint8_t *LCD_FontIndex_Fallback(const pFONT *font);
+
+/**
+ * @brief 逐行比较查找（不使用索引，索引池不足时由 LCD_FontIndex_Find 调用）
+ * @retval 字模所在的行号，找不到返回 -1
+ */
+int32_t LCD_FontIndex_Scan(const pFONT *font, uint16_t code);
+
+#endif /* __LCD_FONT_INDEX_H */
@@ -0,0 +1,250 @@
+/**
+ ******************************************************************************
+ * @file    lcd_glyph_cache.c
+ * @brief   RGB565字模缓存
+ ******************************************************************************
+ * @note
+ *   - 固定大小的槽，每槽可容纳一个3232汉字；哈希表按键查找，双向链表维护LRU顺序
+ *   - 颜色是键的一部分，修改画笔色/背景色后旧条目自然失效并逐渐被淘汰
+ ******************************************************************************
+ */
+
+#include "lcd_glyph_cache.h"
+#include "mem_region.h"
+#include <stddef.h>
+
+#define GLYPH_NONE   (-1)
+
+/* 缓存条目 */
+typedef struct {
+    const pFONT *font;
+    uint16_t code;
+    uint16_t fg;
+    uint16_t bg;
+    int16_t  hash_next;     // 同一哈希桶中的下一个条目
+    int16_t  lru_prev;      // 更近使用的条目
+    int16_t  lru_next;      // 更久未使用的条目
+} GlyphEntry_t;
+
+/* 像素池 - 放在AXI SRAM（512KB），只由CPU写入；
+ * 若以后开启D-Cache并改为DMA发送，需要在发送前Clean对应区域 */
+__attribute__((section(".ram_d1"))) __attribute__((aligned(32)))
+static uint16_t glyph_pool[LCD_GLYPH_CACHE_SLOTS][LCD_GLYPH_CACHE_MAX_PIXELS];
+
+static GlyphEntry_t glyph_entries[LCD_GLYPH_CACHE_SLOTS];
+static int16_t glyph_buckets[LCD_GLYPH_CACHE_BUCKETS];
+static int16_t lru_head = GLYPH_NONE;      // 最近使用
+static int16_t lru_tail = GLYPH_NONE;      // 最久未使用
+static int16_t free_count;
+static bool cache_enabled = true;
+static bool cache_ready = false;
+static LCD_GlyphCache_Stats_t cache_stats;
+
+/* 缓存禁用时使用的临时展开区 */
+static uint16_t glyph_scratch[LCD_GLYPH_CACHE_MAX_PIXELS];
+
+/* ==================== 内部函数 ==================== */
+
+static uint32_t GlyphCache_Hash(const pFONT *font, uint16_t code, uint16_t fg, uint16_t bg)
+{
+    uint32_t h = (uint32_t)(uintptr_t)font;
+    h ^= code * 0x9E3779B1U;
+    h ^= ((uint32_t)fg << 16 | bg) * 0x85EBCA77U;
+    h ^= h >> 15;
+    return h & (LCD_GLYPH_CACHE_BUCKETS - 1);
+}
+
+static void GlyphCache_LruUnlink(int16_t idx)
+{
+    GlyphEntry_t *e = &glyph_entries[idx];
+
+    if (e->lru_prev != GLYPH_NONE) glyph_entries[e->lru_prev].lru_next = e->lru_next;
+    else                           lru_head = e->lru_next;
+    if (e->lru_next != GLYPH_NONE) glyph_entries[e->lru_next].lru_prev = e->lru_prev;
+    else                           lru_tail = e->lru_prev;
+    e->lru_prev = e->lru_next = GLYPH_NONE;
+}
+
+static void GlyphCache_LruPushFront(int16_t idx)
+{
+    GlyphEntry_t *e = &glyph_entries[idx];
+
+    e->lru_prev = GLYPH_NONE;
+    e->lru_next = lru_head;
+    if (lru_head != GLYPH_NONE) glyph_entries[lru_head].lru_prev = idx;
+    lru_head = idx;
+    if (lru_tail == GLYPH_NONE) lru_tail = idx;
+}
+
+static void GlyphCache_HashRemove(int16_t idx)
+{
+    GlyphEntry_t *e = &glyph_entries[idx];
+    int16_t *link = &glyph_buckets[GlyphCache_Hash(e->font, e->code, e->fg, e->bg)];
+
+    while (*link != GLYPH_NONE) {
+        if (*link == idx) {
+            *link = e->hash_next;
+            break;
+        }
+        link = &glyph_entries[*link].hash_next;
+    }
+    e->hash_next = GLYPH_NONE;
+}
+
+/* ==================== 接口函数 ==================== */
+
+/**
+ * @brief 初始化（清空）字模缓存
+ */
+void LCD_GlyphCache_Init(void)
+{
+    for (int16_t i = 0; i < LCD_GLYPH_CACHE_BUCKETS; i++) {
+        glyph_buckets[i] = GLYPH_NONE;
+    }
+    for (int16_t i = 0; i < LCD_GLYPH_CACHE_SLOTS; i++) {
+        glyph_entries[i].hash_next = GLYPH_NONE;
+        glyph_entries[i].lru_prev = GLYPH_NONE;
+        glyph_entries[i].lru_next = GLYPH_NONE;
+    }
+    lru_head = lru_tail = GLYPH_NONE;
+    free_count = LCD_GLYPH_CACHE_SLOTS;
+    cache_stats.entries = 0;
+    cache_ready = true;
+}
+
+/**
+ * @brief 启用/禁用缓存
+ */
+void LCD_GlyphCache_SetEnabled(bool enabled)
+{
+    cache_enabled = enabled;
+}
+
+/**
+ * @brief 清空所有缓存条目（字库内容改变时调用）
+ */
+void LCD_GlyphCache_Invalidate(void)
+{
+    LCD_GlyphCache_Init();
+}
+
+/**
+ * @brief 将1bpp字模展开为RGB565像素
+ * @note  每行占 (width+7)/8 字节，字节内低位在前，与 lcd_fonts.c 的取模方式一致
+ */
+MEM_ITCM_CODE void LCD_GlyphCache_Expand(uint16_t *dst, const uint8_t *bitmap, uint16_t width, uint16_t height,
+                                         uint16_t fg, uint16_t bg)
+{
+    uint16_t row_bytes = (width + 7) / 8;
+
+    for (uint16_t y = 0; y < height; y++) {
+        const uint8_t *row = bitmap + y * row_bytes;
+        uint16_t x = 0;
+
+        for (uint16_t b = 0; b < row_bytes; b++) {
+            uint8_t bits = row[b];
+            uint16_t n = (width - x > 8) ? 8 : (width - x);
+
+            for (uint16_t k = 0; k < n; k++) {
+                *dst++ = (bits & 0x01) ? fg : bg;
+                bits >>= 1;
+            }
+            x += n;
+        }
+    }
+}
+
+/**
+ * @brief 查找已展开的字符，命中时移到LRU表头
+ */
+const uint16_t *LCD_GlyphCache_Lookup(const pFONT *font, uint16_t code, uint16_t fg, uint16_t bg)
+{
+    if (!cache_enabled) {
+        cache_stats.misses++;
+        return NULL;
+    }
+    if (!cache_ready) {
+        LCD_GlyphCache_Init();
+    }
+
+    for (int16_t idx = glyph_buckets[GlyphCache_Hash(font, code, fg, bg)];
+         idx != GLYPH_NONE; idx = glyph_entries[idx].hash_next) {
+        GlyphEntry_t *e = &glyph_entries[idx];
+
+        if (e->font == font && e->code == code && e->fg == fg && e->bg == bg) {
+            if (lru_head != idx) {
+                GlyphCache_LruUnlink(idx);
+                GlyphCache_LruPushFront(idx);
+            }
+            cache_stats.hits++;
+            return glyph_pool[idx];
+        }
+    }
+
+    cache_stats.misses++;
+    return NULL;
+}
+
+/**
+ * @brief 展开字模并放入缓存
+ */
+const uint16_t *LCD_GlyphCache_Insert(const pFONT *font, uint16_t code, uint16_t fg, uint16_t bg,
+                                      const uint8_t *bitmap)
+{
+    int16_t idx;
+
+    if ((uint32_t)font->Width * font->Height > LCD_GLYPH_CACHE_MAX_PIXELS) {
+        return NULL;
+    }
+
+    if (!cache_enabled) {
+        LCD_GlyphCache_Expand(glyph_scratch, bitmap, font->Width, font->Height, fg, bg);
+        return glyph_scratch;
+    }
+    if (!cache_ready) {
+        LCD_GlyphCache_Init();
+    }
+
+    if (free_count > 0) {
+        idx = LCD_GLYPH_CACHE_SLOTS - free_count;   // 未用过的槽按顺序分配
+        free_count--;
+        cache_stats.entries++;
+    } else {
+        idx = lru_tail;                             // 淘汰最久未使用的字符
+        GlyphCache_LruUnlink(idx);
+        GlyphCache_HashRemove(idx);
+        cache_stats.evictions++;
+    }
+
+    GlyphEntry_t *e = &glyph_entries[idx];
+    uint32_t bucket = GlyphCache_Hash(font, code, fg, bg);
+
+    e->font = font;
+    e->code = code;
+    e->fg = fg;
+    e->bg = bg;
+    e->hash_next = glyph_buckets[bucket];
+    glyph_buckets[bucket] = idx;
+    GlyphCache_LruPushFront(idx);
+
+    LCD_GlyphCache_Expand(glyph_pool[idx], bitmap, font->Width, font->Height, fg, bg);
+    return glyph_pool[idx];
+}
+
+/**
+ * @brief 获取统计信息
+ */
+void LCD_GlyphCache_GetStats(LCD_GlyphCache_Stats_t *stats)
+{
+    *stats = cache_stats;
+}
+
+/**
+ * @brief 重置命中/未命中/淘汰计数（不清空缓存）
+ */
+void LCD_GlyphCache_ResetStats(void)
+{
+    cache_stats.hits = 0;
+    cache_stats.misses = 0;
+    cache_stats.evictions = 0;
+}
@@ -0,0 +1,64 @@
+/**
+ ******************************************************************************
+ * @file    lcd_glyph_cache.h
+ * @brief   RGB565字模缓存 - 缓存已展开的字符点阵，避免每次逐位展开1bpp字模
+ ******************************************************************************
+ * @note
+ *   - 以 (字体, 字符编码, 前景色, 背景色) 为键，LRU淘汰
+ *   - 缓存池放在AXI SRAM，展开后的数据可直接交给 LCD_WriteBuff / DMA 发送
+ *   - 与 lcd_spi_154.c 一样只应在同一个任务中调用，内部不加锁
+ ******************************************************************************
+ */
+
+#ifndef __LCD_GLYPH_CACHE_H
+#define __LCD_GLYPH_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd_fonts.h"
+
+/* 缓存配置 */
+#define LCD_GLYPH_CACHE_SLOTS       64          // 缓存槽数量
+#define LCD_GLYPH_CACHE_MAX_PIXELS  (32 * 32)   // 单个槽最大像素数（3232汉字），64槽共128KB
+#define LCD_GLYPH_CACHE_BUCKETS     128         // 哈希桶数量（2的幂）
+
+/* 统计信息 */
+typedef struct {
+    uint32_t hits;          // 命中次数
+    uint32_t misses;        // 未命中次数（需要展开字模）
+    uint32_t evictions;     // 因缓存已满而淘汰的次数
+    uint32_t entries;       // 当前缓存的字符数
+} LCD_GlyphCache_Stats_t;
+
+void LCD_GlyphCache_Init(void);
+void LCD_GlyphCache_SetEnabled(bool enabled);   // 禁用后每次都重新展开（用于对比测试）
+void LCD_GlyphCache_Invalidate(void);
+
+/**
+ * @brief 查找已展开的字符
+ * @param font 字体
+ * @param code 字符编码（ASCII为相对空格的偏移，汉字为两字节GB2312编码）
+ * @param fg   前景色（RGB565）
+ * @param bg   背景色（RGB565）
+ * @retval 像素数据（Width*Height个RGB565），未命中返回NULL
+ */
+const uint16_t *LCD_GlyphCache_Lookup(const pFONT *font, uint16_t code, uint16_t fg, uint16_t bg);
+
+/**
+ * @brief 展开1bpp字模并放入缓存（缓存满时淘汰最久未使用的字符）
+ * @param bitmap 该字符的字模数据（font->Sizes 字节，每行按低位在前）
+ * @retval 展开后的像素数据，字符尺寸超过槽大小时返回NULL
+ */
+const uint16_t *LCD_GlyphCache_Insert(const pFONT *font, uint16_t code, uint16_t fg, uint16_t bg,
+                                      const uint8_t *bitmap);
+
+/**
+ * @brief 将1bpp字模展开为RGB565像素（不经过缓存）
+ */
+void LCD_GlyphCache_Expand(uint16_t *dst, const uint8_t *bitmap, uint16_t width, uint16_t height,
+                           uint16_t fg, uint16_t bg);
+
+void LCD_GlyphCache_GetStats(LCD_GlyphCache_Stats_t *stats);
+void LCD_GlyphCache_ResetStats(void);
+
+#endif /* __LCD_GLYPH_CACHE_H */
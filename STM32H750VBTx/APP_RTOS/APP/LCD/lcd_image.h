@@ -10,6 +10,27 @@ extern const uint8_t	Image_Message_83x83[];
 extern const uint8_t	Image_Toys_83x83[];
 extern const uint8_t	Image_Video_83x83[];
 
+// JPEG图片（lcd_image_jpeg.c，由 Host/Tools/host_jpegc 生成），用 LCD_JPEG_Draw 显示
+extern const uint8_t	Image_Photo_240x240_jpg[];
+extern const uint32_t	Image_Photo_240x240_jpg_size;
+
+// 开机动画片段（lcd_clip_boot.c，由 Host/Tools/host_clipc 生成），用 LCD_Player_Play 播放；
+// 只在 CMake 选项 APP_LCD_PLAYER_DEMO=ON 时链接
+extern const uint8_t	Clip_Boot_240x240[];
+extern const uint32_t	Clip_Boot_240x240_size;
+
+// 无损图片（lcd_image_qoi.c，由 Host/Tools/host_qoic 生成），用 LCD_QOI_Draw 显示
+extern const uint8_t	Image_UI_240x240_q565[];
+extern const uint32_t	Image_UI_240x240_q565_size;
+extern const uint8_t	Image_Icon0_83x83_q565[];
+extern const uint32_t	Image_Icon0_83x83_q565_size;
+extern const uint8_t	Image_Icon1_83x83_q565[];
+extern const uint32_t	Image_Icon1_83x83_q565_size;
+extern const uint8_t	Image_Icon2_83x83_q565[];
+extern const uint32_t	Image_Icon2_83x83_q565_size;
+extern const uint8_t	Image_Icon3_83x83_q565[];
+extern const uint32_t	Image_Icon3_83x83_q565_size;
+
 #endif  // __LCD_IMAGE_H
 
 
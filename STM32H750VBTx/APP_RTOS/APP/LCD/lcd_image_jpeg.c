@@ -0,0 +1,580 @@
+/* 由 host_jpegc 生成，请勿手动修改
+ * 图片: 内置测试图，240x240，质量 75，420，9126 字节 */
+
+#include <stdint.h>
+
+const uint32_t Image_Photo_240x240_jpg_size = 9126;
+
+__attribute__((aligned(4))) const uint8_t Image_Photo_240x240_jpg[9126] = {
+    0xFF,0xD8,0xFF,0xE0,0x00,0x10,0x4A,0x46,0x49,0x46,0x00,0x01,0x01,0x00,0x00,0x01,
+    0x00,0x01,0x00,0x00,0xFF,0xDB,0x00,0x43,0x00,0x08,0x06,0x06,0x07,0x06,0x05,0x08,
+    0x07,0x07,0x07,0x09,0x09,0x08,0x0A,0x0C,0x14,0x0D,0x0C,0x0B,0x0B,0x0C,0x19,0x12,
+    0x13,0x0F,0x14,0x1D,0x1A,0x1F,0x1E,0x1D,0x1A,0x1C,0x1C,0x20,0x24,0x2E,0x27,0x20,
+    0x22,0x2C,0x23,0x1C,0x1C,0x28,0x37,0x29,0x2C,0x30,0x31,0x34,0x34,0x34,0x1F,0x27,
+    0x39,0x3D,0x38,0x32,0x3C,0x2E,0x33,0x34,0x32,0xFF,0xDB,0x00,0x43,0x01,0x09,0x09,
+    0x09,0x0C,0x0B,0x0C,0x18,0x0D,0x0D,0x18,0x32,0x21,0x1C,0x21,0x32,0x32,0x32,0x32,
+    0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,
+    0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,
+    0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0x32,0xFF,0xC0,
+    0x00,0x11,0x08,0x00,0xF0,0x00,0xF0,0x03,0x01,0x22,0x00,0x02,0x11,0x01,0x03,0x11,
+    0x01,0xFF,0xC4,0x00,0x1F,0x00,0x00,0x01,0x05,0x01,0x01,0x01,0x01,0x01,0x01,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,
+    0x0A,0x0B,0xFF,0xC4,0x00,0xB5,0x10,0x00,0x02,0x01,0x03,0x03,0x02,0x04,0x03,0x05,
+    0x05,0x04,0x04,0x00,0x00,0x01,0x7D,0x01,0x02,0x03,0x00,0x04,0x11,0x05,0x12,0x21,
+    0x31,0x41,0x06,0x13,0x51,0x61,0x07,0x22,0x71,0x14,0x32,0x81,0x91,0xA1,0x08,0x23,
+    0x42,0xB1,0xC1,0x15,0x52,0xD1,0xF0,0x24,0x33,0x62,0x72,0x82,0x09,0x0A,0x16,0x17,
+    0x18,0x19,0x1A,0x25,0x26,0x27,0x28,0x29,0x2A,0x34,0x35,0x36,0x37,0x38,0x39,0x3A,
+    0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4A,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5A,
+    0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6A,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7A,
+    0x83,0x84,0x85,0x86,0x87,0x88,0x89,0x8A,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,
+    0x9A,0xA2,0xA3,0xA4,0xA5,0xA6,0xA7,0xA8,0xA9,0xAA,0xB2,0xB3,0xB4,0xB5,0xB6,0xB7,
+    0xB8,0xB9,0xBA,0xC2,0xC3,0xC4,0xC5,0xC6,0xC7,0xC8,0xC9,0xCA,0xD2,0xD3,0xD4,0xD5,
+    0xD6,0xD7,0xD8,0xD9,0xDA,0xE1,0xE2,0xE3,0xE4,0xE5,0xE6,0xE7,0xE8,0xE9,0xEA,0xF1,
+    0xF2,0xF3,0xF4,0xF5,0xF6,0xF7,0xF8,0xF9,0xFA,0xFF,0xC4,0x00,0x1F,0x01,0x00,0x03,
+    0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0A,0x0B,0xFF,0xC4,0x00,0xB5,0x11,0x00,
+    0x02,0x01,0x02,0x04,0x04,0x03,0x04,0x07,0x05,0x04,0x04,0x00,0x01,0x02,0x77,0x00,
+    0x01,0x02,0x03,0x11,0x04,0x05,0x21,0x31,0x06,0x12,0x41,0x51,0x07,0x61,0x71,0x13,
+    0x22,0x32,0x81,0x08,0x14,0x42,0x91,0xA1,0xB1,0xC1,0x09,0x23,0x33,0x52,0xF0,0x15,
+    0x62,0x72,0xD1,0x0A,0x16,0x24,0x34,0xE1,0x25,0xF1,0x17,0x18,0x19,0x1A,0x26,0x27,
+    0x28,0x29,0x2A,0x35,0x36,0x37,0x38,0x39,0x3A,0x43,0x44,0x45,0x46,0x47,0x48,0x49,
+    0x4A,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5A,0x63,0x64,0x65,0x66,0x67,0x68,0x69,
+    0x6A,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7A,0x82,0x83,0x84,0x85,0x86,0x87,0x88,
+    0x89,0x8A,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9A,0xA2,0xA3,0xA4,0xA5,0xA6,
+    0xA7,0xA8,0xA9,0xAA,0xB2,0xB3,0xB4,0xB5,0xB6,0xB7,0xB8,0xB9,0xBA,0xC2,0xC3,0xC4,
+    0xC5,0xC6,0xC7,0xC8,0xC9,0xCA,0xD2,0xD3,0xD4,0xD5,0xD6,0xD7,0xD8,0xD9,0xDA,0xE2,
+    0xE3,0xE4,0xE5,0xE6,0xE7,0xE8,0xE9,0xEA,0xF2,0xF3,0xF4,0xF5,0xF6,0xF7,0xF8,0xF9,
+    0xFA,0xFF,0xDA,0x00,0x0C,0x03,0x01,0x00,0x02,0x11,0x03,0x11,0x00,0x3F,0x00,0x9B,
+    0x15,0xB7,0xA5,0x69,0x3F,0x69,0x50,0x48,0xCE,0x79,0xAC,0x60,0x32,0x71,0x5E,0x81,
+    0xE1,0x98,0x93,0x62,0x67,0x15,0xF5,0x18,0xBA,0xAE,0x9C,0x2E,0x8F,0x16,0x85,0x35,
+    0x29,0x59,0x99,0x93,0xF8,0x53,0x72,0x6E,0x55,0x20,0xFB,0x57,0x3D,0x7D,0xA5,0x4F,
+    0x64,0xC7,0x70,0x25,0x7D,0x6B,0xD8,0x70,0x31,0x8C,0x0C,0x56,0x07,0x88,0x2C,0x63,
+    0x6B,0x76,0x60,0xA3,0xD6,0xBC,0xEC,0x3E,0x3E,0x7C,0xD6,0x91,0xD9,0x57,0x0B,0x1E,
+    0x5B,0xA3,0xCB,0xF1,0x46,0x2A,0x59,0xA3,0x11,0xCC,0xEA,0x3A,0x03,0x4C,0xC5,0x7B,
+    0x5C,0xC7,0x9B,0x61,0xB8,0xA3,0x14,0xEC,0x51,0x8A,0x2E,0x16,0x1B,0x8A,0x31,0x4E,
+    0xC5,0x18,0xA2,0xE1,0x61,0xB8,0xA3,0x14,0xEC,0x51,0x8A,0x2E,0x16,0x1B,0x8A,0x31,
+    0x4E,0xC5,0x2A,0xF0,0xC0,0xFB,0xD1,0x70,0xB1,0x72,0xDF,0x49,0x96,0x74,0xDD,0x9C,
+    0x52,0xCF,0xA3,0xCF,0x08,0xCF,0x5A,0xE9,0xF4,0x67,0x89,0xA1,0x5C,0xE2,0xAD,0xDF,
+    0xC7,0x19,0x84,0xE3,0x18,0xAF,0x3E,0x58,0xB9,0xA9,0xD8,0xEA,0x54,0x22,0xE3,0x73,
+    0xCF,0x99,0x0A,0x31,0x56,0x18,0x22,0x9D,0x14,0x8D,0x0B,0xEF,0x53,0xCD,0x58,0xBE,
+    0x0B,0xF6,0x93,0xB6,0xAB,0x62,0xBB,0xD3,0xBA,0xD4,0xE6,0x6A,0xCC,0xE8,0xB4,0xEF,
+    0x13,0xBD,0xB6,0x03,0x64,0x56,0xEA,0xF8,0xB1,0x25,0x8B,0xEF,0x8A,0xE0,0x31,0x46,
+    0x2B,0x96,0x78,0x3A,0x53,0x77,0xB1,0xB4,0x71,0x13,0x8A,0xB1,0xB5,0xAE,0x6A,0x3F,
+    0x6B,0x18,0x07,0x39,0x35,0x87,0x8A,0x77,0x5A,0x31,0x5D,0x14,0xE2,0xA1,0x1E,0x54,
+    0x65,0x39,0x39,0x3B,0xB1,0xB8,0xA3,0x14,0xEC,0x51,0x8A,0xBB,0x93,0x61,0xB8,0xA3,
+    0x14,0xEC,0x51,0x8A,0x2E,0x16,0x1B,0x8A,0x31,0x52,0x2E,0xDE,0x73,0x4D,0xC5,0x17,
+    0x0B,0x0D,0xC5,0x18,0xA7,0x62,0x8C,0x51,0x70,0xB0,0xF0,0x30,0x45,0x74,0xDA,0x3E,
+    0xA8,0x20,0x2B,0xF3,0x0E,0x2B,0x9F,0x9D,0x36,0x4C,0xCB,0x51,0x8C,0x8E,0x84,0x8A,
+    0xE7,0xA9,0x05,0x52,0x36,0x66,0xB0,0x93,0x83,0xBA,0x3D,0x4E,0xDF,0x5A,0x85,0xD0,
+    0x64,0x8C,0xE2,0xA8,0x6B,0x1A,0x9A,0x49,0x01,0x0A,0x46,0x2B,0x82,0x8E,0xEE,0x78,
+    0xFE,0xEC,0x87,0x1E,0xF4,0xF9,0x2F,0xE7,0x91,0x76,0xB1,0xAE,0x18,0xE0,0x54,0x65,
+    0x74,0x74,0xBC,0x53,0x71,0xB1,0x5A,0x73,0xBE,0x77,0x6F,0x53,0x51,0xE2,0x9F,0x8A,
+    0x31,0x5E,0x92,0x76,0x38,0xC6,0x62,0x8C,0x53,0xF1,0x46,0x28,0xB8,0x58,0x66,0x28,
+    0xC5,0x3F,0x14,0x62,0x8B,0x85,0x86,0x62,0x8C,0x53,0xF1,0x46,0x28,0xB8,0x58,0x66,
+    0x28,0xC5,0x3F,0x14,0x62,0x8B,0x85,0x89,0xED,0x6F,0x65,0xB5,0x23,0x69,0xCA,0xE7,
+    0xA5,0x5E,0x97,0x5A,0x69,0x23,0xC1,0x07,0x35,0x95,0x8A,0x31,0x50,0xE1,0x16,0xEE,
+    0xD1,0x4A,0x52,0x4A,0xC2,0x3B,0x19,0x1C,0xB1,0xEA,0x69,0xB8,0xA7,0xE2,0x8C,0x55,
+    0xDC,0x91,0x98,0xA3,0x14,0xFC,0x50,0x14,0x93,0x80,0x28,0xB8,0x58,0x6A,0xAE,0xE6,
+    0x0A,0x3B,0x9C,0x57,0x45,0x63,0xA1,0x89,0xE3,0x19,0x50,0x7E,0xB5,0x97,0x69,0x63,
+    0x2C,0x93,0x21,0xDB,0x81,0x9A,0xF4,0x1D,0x22,0x35,0x86,0x21,0xB8,0x72,0x05,0x79,
+    0xB8,0xDC,0x74,0x29,0x2B,0x29,0x6A,0x75,0xE1,0xF0,0xEE,0x6F,0x54,0x72,0x57,0x7E,
+    0x18,0x74,0x05,0xA3,0xC8,0xF6,0xAC,0x19,0xED,0x65,0xB7,0x72,0xB2,0x29,0x15,0xEC,
+    0x05,0xA2,0x91,0x76,0xB2,0x8C,0x1A,0xE5,0x7C,0x49,0xA6,0x27,0x96,0xCC,0xA0,0x63,
+    0xD6,0xB3,0xC2,0x66,0x3E,0xD2,0x5C,0xAD,0x9A,0x57,0xC2,0x72,0xAB,0xA3,0x84,0xC5,
+    0x18,0xA7,0x95,0xC1,0x23,0xD2,0x8C,0x57,0xAD,0x73,0x82,0xC3,0x31,0x46,0x29,0xF8,
+    0xA3,0x14,0x5C,0x2C,0x33,0x14,0x62,0x9F,0x8A,0x31,0x45,0xC2,0xC4,0xD7,0x07,0x74,
+    0xEE,0x7D,0xEA,0x3C,0x53,0xF1,0x49,0x8A,0xCD,0x32,0x86,0xE2,0x8C,0x53,0xB1,0x46,
+    0x28,0xB8,0x58,0x6E,0x29,0x76,0x9C,0x67,0x06,0xA6,0x81,0x37,0xCC,0xAB,0xEA,0x6B,
+    0xAC,0xB3,0xD1,0xD2,0x78,0xC6,0x54,0x74,0xAC,0xAA,0x56,0x54,0xF7,0x2E,0x14,0xDC,
+    0xF6,0x38,0xCC,0x51,0x8A,0xEB,0x6F,0xBC,0x33,0x85,0x2C,0x8B,0x83,0xED,0x5C,0xDD,
+    0xCD,0xA4,0x96,0xB2,0x15,0x90,0x7E,0x34,0xE9,0xD7,0x8D,0x4D,0x98,0x4E,0x94,0xA1,
+    0xB9,0x5B,0x14,0x62,0x9D,0x8A,0x31,0x5A,0x5C,0x8B,0x0D,0xC5,0x18,0xA7,0x62,0x8C,
+    0x51,0x70,0xB0,0xDC,0x51,0x8A,0x76,0x28,0xC5,0x17,0x0B,0x0D,0xC5,0x18,0xA7,0x62,
+    0x8C,0x51,0x70,0xB0,0xDC,0x51,0x8A,0x76,0x2A,0x6B,0x58,0xC3,0xCC,0x01,0xA1,0xCA,
+    0xC0,0x91,0x0A,0x46,0xCE,0xC1,0x40,0xE4,0xD7,0x41,0xA6,0x68,0xDB,0xF0,0x58,0x55,
+    0xEB,0x1D,0x31,0x30,0x09,0x5A,0xDC,0x8A,0x25,0x89,0x02,0xA8,0xC5,0x7C,0xAE,0x71,
+    0x9C,0x38,0x7E,0xEA,0x96,0xE7,0xAD,0x82,0xC1,0x27,0xEF,0xCC,0xAF,0x06,0x9F,0x14,
+    0x20,0x71,0x93,0x56,0xC0,0xDB,0xD3,0x8A,0x28,0xAF,0x91,0x9D,0x59,0xCD,0xDE,0x4C,
+    0xF6,0x63,0x08,0xC7,0x44,0x87,0x07,0x61,0xDE,0xA1,0xBD,0x1E,0x7D,0xB9,0x52,0x3B,
+    0x54,0x94,0x75,0xAD,0x28,0xE2,0x6A,0x51,0x92,0x94,0x59,0x33,0xA7,0x19,0xAB,0x33,
+    0xCE,0xAF,0xAD,0x5A,0xDE,0xE1,0xC6,0x0E,0xD2,0x6A,0xAE,0x2B,0xB0,0xD6,0xAC,0x03,
+    0x29,0x60,0x3A,0xD7,0x26,0xC8,0x55,0x8A,0x9E,0xD5,0xFA,0x26,0x5B,0x8E,0x58,0xAA,
+    0x2A,0x5D,0x4F,0x9A,0xC5,0x50,0x74,0xA7,0x62,0x3C,0x51,0x8A,0x76,0x28,0xC5,0x7A,
+    0x17,0x39,0xEC,0x37,0x14,0x62,0x9D,0x8A,0x31,0x45,0xC2,0xC3,0xF1,0x46,0x29,0xD8,
+    0xA3,0x15,0x9D,0xCA,0xB0,0xDC,0x51,0x8A,0x76,0x28,0xC5,0x17,0x0B,0x0F,0xB7,0x3B,
+    0x6E,0x23,0x27,0xD6,0xBD,0x1F,0x45,0x65,0x68,0x01,0x1E,0x95,0xE6,0xA3,0x83,0x9A,
+    0xEB,0xBC,0x3D,0xAA,0x85,0x01,0x18,0xF3,0xDC,0x57,0x26,0x32,0x0E,0x51,0xBA,0x3A,
+    0x30,0xD2,0x51,0x96,0xA7,0x62,0x54,0x30,0xC1,0x19,0x15,0xCE,0x6B,0xFA,0x4A,0x49,
+    0x11,0x75,0x51,0xCD,0x74,0x48,0xEB,0x22,0xEE,0x53,0x91,0x4C,0xB8,0x41,0x24,0x0E,
+    0xA7,0xD2,0xBC,0xBA,0x73,0x70,0x95,0xD1,0xDF,0x38,0xA9,0x2B,0x1E,0x49,0x24,0x66,
+    0x39,0x19,0x1B,0xA8,0x34,0xDC,0x56,0xBE,0xB9,0x6B,0xE4,0xDD,0x16,0x03,0x00,0xD6,
+    0x56,0x2B,0xDD,0x84,0xF9,0xA2,0x99,0xE4,0xCA,0x36,0x76,0x1B,0x8A,0x31,0x4E,0xC5,
+    0x18,0xAA,0xB8,0xAC,0x37,0x14,0x62,0x9D,0x8A,0x31,0x45,0xC2,0xC3,0x71,0x46,0x29,
+    0xD8,0xA3,0x14,0x5C,0x2C,0x37,0x14,0xF8,0x49,0x49,0x95,0x87,0xAD,0x26,0x29,0xC9,
+    0xC4,0x8B,0xF5,0xA5,0x27,0xA0,0x25,0xA9,0xDC,0xE9,0xCC,0x1E,0x05,0x3E,0xD5,0x76,
+    0xB3,0x34,0x86,0xCC,0x38,0xF6,0xAD,0x3A,0xFC,0xD3,0x1E,0xDB,0xC4,0x4A,0xE7,0xD4,
+    0xE1,0xFF,0x00,0x86,0x82,0x8A,0x28,0xAE,0x33,0x60,0xA2,0x8A,0x28,0x02,0xBD,0xEC,
+    0x61,0xED,0xDB,0xDA,0xB8,0x6B,0xE8,0xF6,0x5C,0x9A,0xEF,0x2E,0x4E,0x20,0x6A,0xE5,
+    0x6E,0x2D,0x16,0xE6,0x6E,0x3A,0xD7,0xD4,0xF0,0xE5,0x47,0x17,0x24,0xF6,0x3C,0x9C,
+    0xCA,0x37,0x48,0xC4,0xC5,0x18,0xAD,0x09,0xB4,0xB9,0x63,0xE5,0x72,0x45,0x53,0x68,
+    0xD9,0x0E,0x18,0x10,0x6B,0xEB,0x94,0xD3,0xD8,0xF1,0xDC,0x5A,0xDC,0x8F,0x14,0xAA,
+    0xB9,0x60,0x29,0x71,0x4A,0x38,0x22,0x9D,0xC5,0x61,0x71,0x46,0x29,0xF8,0xA3,0x15,
+    0x9D,0xCA,0xB0,0xCC,0x51,0x8A,0x7E,0x28,0xC5,0x17,0x0B,0x0C,0xC5,0x49,0x14,0x8F,
+    0x0B,0x86,0x43,0x83,0x49,0x8A,0x31,0x45,0xC0,0xE9,0xB4,0xBF,0x10,0x94,0xC2,0x48,
+    0x70,0x7D,0xEB,0x7C,0x6A,0xF1,0xCB,0x17,0x04,0x72,0x2B,0xCE,0xB1,0x53,0x47,0x73,
+    0x34,0x5F,0x75,0xCE,0x3D,0xEB,0x96,0xA6,0x1A,0x32,0x77,0x47,0x44,0x2B,0xC9,0x2B,
+    0x33,0x67,0x5C,0xDB,0x2A,0xB1,0x00,0x71,0x5C,0xEE,0x2A,0xD4,0xB7,0x52,0x4A,0xB8,
+    0x6A,0x83,0x15,0xBD,0x35,0xCB,0x1B,0x18,0xCD,0xF3,0x3B,0x8C,0xC5,0x18,0xA7,0xE2,
+    0x8C,0x55,0xDC,0x9B,0x0C,0xC5,0x2E,0x29,0xD8,0xAB,0x16,0x51,0x89,0x2E,0x00,0x34,
+    0x9C,0xAC,0xAE,0x09,0x5C,0xAE,0x62,0x70,0x39,0x53,0x4D,0xC5,0x76,0xB6,0xFA,0x42,
+    0xCB,0x1F,0xDD,0xAA,0x3A,0x87,0x87,0x4A,0xA9,0x68,0xC6,0x0F,0xB5,0x62,0xB1,0x31,
+    0x6E,0xCC,0xD9,0xD0,0x92,0x57,0x47,0x2F,0x8A,0x5C,0x62,0xA5,0x96,0x17,0x85,0xCA,
+    0x38,0xC1,0xA6,0x62,0xB7,0xBD,0xCC,0x6C,0x74,0x7A,0x2D,0xC8,0xC0,0x04,0xD7,0x41,
+    0x5C,0x2D,0x9D,0xC1,0x82,0x41,0xCF,0x15,0xD6,0x59,0x5E,0xAC,0xA8,0x01,0x35,0xF1,
+    0x79,0xD6,0x06,0x50,0xA9,0xED,0x62,0xB4,0x67,0xB9,0x81,0xC4,0x27,0x1E,0x56,0x5E,
+    0xA2,0x8E,0xB4,0x57,0xCF,0x9E,0x88,0x51,0x45,0x43,0x3D,0xC2,0x42,0xA4,0x93,0xCD,
+    0x54,0x62,0xE4,0xEC,0x84,0xDA,0x4A,0xEC,0xAF,0xA9,0x4E,0x23,0x84,0xAE,0x6B,0x9F,
+    0xB0,0xB9,0x06,0xED,0x95,0x8F,0x53,0xC5,0x2E,0xA7,0x7C,0x65,0x62,0xA0,0xF5,0xAC,
+    0xB4,0x66,0x47,0x0C,0xA7,0x04,0x57,0xDB,0xE5,0x18,0x27,0x46,0x8D,0xE5,0xBB,0x3C,
+    0x2C,0x66,0x23,0x9E,0xA6,0x9D,0x0E,0xF2,0x1B,0x54,0x9A,0x30,0x70,0x2B,0x3F,0x50,
+    0xD1,0x95,0x94,0xE1,0x69,0xFA,0x2E,0xA4,0x24,0x45,0x04,0xF3,0x5B,0x92,0x32,0xC9,
+    0x1F,0xE1,0xCD,0x6E,0xE5,0x3A,0x72,0x05,0x18,0xCE,0x27,0x9C,0xDD,0x59,0xB5,0xBB,
+    0x91,0xCE,0x2A,0xAE,0x2B,0xA8,0xD5,0xA0,0x5C,0x31,0x00,0x57,0x34,0x46,0x09,0x15,
+    0xE8,0x53,0xA9,0xCC,0xAE,0x71,0xCE,0x1C,0xAC,0x76,0x28,0xC5,0x3F,0x14,0x62,0x8B,
+    0x8A,0xC3,0x31,0x4B,0xB4,0xE3,0x38,0x34,0xF4,0x4D,0xCE,0x05,0x6C,0xC1,0x61,0xBE,
+    0x31,0xC5,0x4C,0xA6,0xA2,0x54,0x62,0xD9,0x85,0x8A,0x31,0x5A,0x17,0x7A,0x7B,0xC3,
+    0xF3,0x05,0x38,0xF4,0xAA,0x58,0xA6,0xA4,0x9E,0xC2,0x71,0x6B,0x71,0x98,0xA3,0x14,
+    0xFC,0x51,0x8A,0x77,0x15,0x86,0x62,0x8C,0x53,0xF1,0x46,0x28,0xB8,0x58,0x66,0x28,
+    0xC5,0x3F,0x14,0x62,0x8B,0x85,0x86,0x62,0xA6,0xB6,0x93,0xCA,0x9D,0x5B,0xDE,0x99,
+    0x8A,0x31,0x43,0x77,0x03,0xD0,0xB4,0x79,0xD6,0x58,0x06,0x31,0x9C,0x56,0x93,0x28,
+    0x61,0x82,0x32,0x2B,0x84,0xD1,0x75,0x46,0xB5,0x94,0x23,0x37,0x1D,0xB3,0x5D,0xBD,
+    0xBD,0xC2,0x5C,0x46,0x1D,0x08,0xE7,0xB5,0x79,0x75,0xA9,0xB8,0xCA,0xE7,0xA1,0x4A,
+    0x6A,0x51,0x31,0x35,0xAD,0x15,0x26,0x88,0xBA,0x2F,0x3E,0xDD,0xAB,0x8B,0x96,0x16,
+    0x86,0x42,0x8C,0x39,0x15,0xEA,0x8C,0x03,0x29,0x07,0xA1,0xAE,0x3F,0xC4,0x1A,0x78,
+    0x0C,0x5D,0x47,0x22,0xB6,0xC3,0x56,0x7F,0x0B,0x32,0xAF,0x49,0x7C,0x48,0xE5,0xF1,
+    0x56,0x6D,0xEE,0x9E,0x02,0x39,0xE2,0xA1,0xC5,0x18,0xAE,0xB9,0xC6,0x33,0x5C,0xB2,
+    0x47,0x2C,0x5B,0x8B,0xBA,0x37,0x6D,0xF5,0x8C,0x00,0x0B,0x55,0xD1,0xAB,0xAE,0x3B,
+    0x57,0x2B,0x8A,0x39,0xF5,0x35,0xE5,0x55,0xC9,0xB0,0xF3,0x77,0x3B,0x23,0x8E,0xA9,
+    0x15,0x63,0xA3,0x9B,0x59,0x00,0x1C,0x1A,0xC9,0xBA,0xD4,0x5E,0x5C,0x80,0x6A,0x96,
+    0x28,0xC5,0x6F,0x87,0xCB,0x68,0x50,0x77,0x48,0xCE,0xA6,0x2A,0xA5,0x4D,0x1B,0x1A,
+    0x72,0x4E,0x4F,0x5A,0x4C,0x53,0xF1,0x46,0x2B,0xD1,0xB9,0xCC,0x3E,0xDE,0x77,0xB7,
+    0x90,0x32,0x9F,0xC2,0xBA,0x4B,0x4D,0x54,0x49,0x18,0xC9,0xAE,0x63,0x14,0xE4,0x66,
+    0x8C,0xE5,0x4E,0x0D,0x67,0x38,0x29,0x97,0x09,0xB8,0x9B,0x9A,0x95,0xC8,0x64,0x3C,
+    0xD7,0x3E,0x79,0x39,0xA9,0x9E,0x67,0x90,0x60,0x9A,0x8F,0x14,0xE0,0xB9,0x55,0x85,
+    0x27,0xCC,0xC7,0x62,0x8C,0x53,0xB1,0x46,0x29,0x5C,0x2C,0x3E,0xDF,0x89,0x86,0x6B,
+    0xAC,0xD3,0x95,0x59,0x14,0x70,0x45,0x72,0x23,0x20,0x82,0x2B,0x67,0x4C,0xD4,0x36,
+    0x30,0x56,0x38,0x22,0xB1,0xAA,0x9B,0x5A,0x1A,0xD2,0x69,0x3D,0x4E,0x96,0x7D,0x39,
+    0x65,0x8B,0xA0,0xFC,0xAB,0x92,0xD5,0x34,0xB6,0xB6,0x72,0xCA,0x38,0xEF,0x5D,0xAD,
+    0xAD,0xDA,0x4A,0x83,0x91,0x4C,0xBE,0xB5,0x49,0xD0,0xF1,0x93,0x5C,0xD4,0xEA,0xCA,
+    0x0E,0xCC,0xE8,0x9D,0x35,0x25,0xA1,0xE7,0x38,0xA4,0x62,0xA8,0x85,0xDD,0x82,0xAA,
+    0x8C,0x92,0x4E,0x00,0x15,0x67,0x5A,0x10,0xE9,0x39,0x9A,0xE2,0x41,0x1C,0x44,0xE3,
+    0x27,0xD7,0xD0,0x01,0x5C,0x06,0xAD,0xAE,0xCD,0xA9,0x6E,0x85,0x07,0x97,0x6D,0xBB,
+    0x21,0x7B,0xB7,0xA6,0xEF,0xE7,0x8F,0xE7,0x8A,0xD3,0x11,0x8D,0x85,0x18,0xDF,0x77,
+    0xD8,0xD7,0x01,0x95,0xD6,0xC6,0x4E,0xC9,0x5A,0x2B,0x77,0xFE,0x5D,0xD9,0xA1,0xAC,
+    0x78,0x8F,0xFD,0x65,0xB5,0x89,0xF6,0x33,0x83,0xF9,0xED,0xFF,0x00,0x1F,0xCB,0xB1,
+    0xA8,0x34,0x9F,0x11,0xC9,0x6F,0x88,0x2F,0x4B,0x4B,0x19,0x6F,0xF5,0xA4,0xE5,0x94,
+    0x7B,0xFA,0x8F,0xF3,0xCF,0x4A,0xE7,0xE8,0xAF,0x11,0xE3,0xAB,0x3A,0x9E,0xD2,0xFF,
+    0x00,0xE4,0x7D,0x8C,0x72,0x7C,0x22,0xA1,0xEC,0x39,0x74,0xEF,0xD6,0xFD,0xEF,0xFD,
+    0x23,0xD3,0x23,0x92,0x39,0xA3,0x12,0x44,0xEA,0xE8,0x7A,0x32,0x9C,0x83,0xF8,0xD3,
+    0xB1,0x5C,0x06,0x9B,0xAB,0x5C,0xE9,0x92,0x7E,0xED,0xB7,0x44,0x5B,0x2F,0x11,0xE8,
+    0xDF,0xE0,0x7F,0xFA,0xDD,0x6B,0xB7,0xB1,0xD4,0x2D,0xB5,0x18,0x8C,0x96,0xF2,0x6E,
+    0xC6,0x37,0x29,0x18,0x2A,0x7D,0xC7,0xF9,0x15,0xED,0x61,0x71,0xB0,0xAE,0xAD,0xB3,
+    0xED,0xFE,0x47,0xC8,0xE6,0x39,0x4D,0x5C,0x1B,0xE6,0xDE,0x1D,0xFF,0x00,0xCF,0xB1,
+    0x63,0x14,0x62,0x9D,0x8A,0x31,0x5D,0x97,0x3C,0xAB,0x0D,0xC5,0x6A,0xE9,0xBA,0xC4,
+    0xB6,0x8C,0x03,0x12,0x57,0xD6,0xB3,0x31,0x46,0x2A,0x64,0x94,0x95,0x98,0xD3,0x69,
+    0xDD,0x1D,0xE5,0xBE,0xB5,0x1C,0xC8,0x0E,0x46,0x6A,0x96,0xA9,0x70,0x92,0xC6,0xD8,
+    0x20,0xFB,0x57,0x29,0x1C,0x8F,0x11,0xCA,0x31,0x15,0x23,0x5D,0xCA,0xEB,0x86,0x35,
+    0x82,0xA0,0x93,0xBA,0x36,0x75,0x9B,0x56,0x65,0x77,0x00,0x48,0xD8,0xE9,0x9A,0x6E,
+    0x29,0xF8,0xA4,0xC5,0x74,0xDC,0xC2,0xC3,0x71,0x46,0x29,0xD8,0xA3,0x14,0x5C,0x2C,
+    0x37,0x14,0xEF,0x2D,0xF1,0xF7,0x4D,0x28,0xE0,0xE6,0xB6,0xEC,0x23,0x49,0xA3,0x03,
+    0x8C,0xD4,0xCA,0x7C,0xAA,0xE5,0x46,0x37,0x30,0x71,0x46,0x2B,0xA7,0x9F,0x45,0x47,
+    0x5C,0x85,0xE6,0xB1,0x6E,0x74,0xF9,0x6D,0xCF,0x42,0x45,0x28,0xD5,0x52,0x1C,0xA9,
+    0xB4,0x52,0xC5,0x18,0xA7,0xE2,0x93,0x15,0x77,0x22,0xC3,0x71,0x46,0x29,0xD8,0xA3,
+    0x14,0x5C,0x2C,0x3F,0x14,0x62,0x9D,0x8A,0x31,0x59,0xDC,0xAB,0x0D,0xC5,0x03,0x20,
+    0xE4,0x71,0x4E,0xC5,0x18,0xA2,0xE1,0x62,0xED,0xA6,0xA7,0x2D,0xB9,0xC1,0x24,0x8A,
+    0x9B,0x56,0xF1,0xCD,0x9E,0x91,0x6C,0xBE,0x68,0x69,0xA7,0x70,0x76,0x42,0x98,0xC9,
+    0xF7,0x27,0xB0,0xCF,0x19,0xFD,0x0E,0x0D,0x61,0x5F,0xAD,0xFB,0x42,0x16,0xC0,0xC0,
+    0xAE,0x73,0x97,0x94,0x9F,0x97,0xE8,0x00,0xEB,0xF5,0xF4,0xEF,0x58,0x16,0xBE,0x02,
+    0xD5,0xF5,0x17,0x95,0xD6,0xEA,0xD0,0xB0,0x39,0x63,0x24,0x8F,0x92,0x4E,0x7F,0xD9,
+    0xAE,0x0C,0x65,0x49,0x45,0x7B,0x91,0xF9,0x9E,0xC6,0x59,0x42,0x84,0xDF,0x36,0x22,
+    0xA2,0x4B,0xB7,0x57,0xFE,0x46,0x16,0xAB,0xAC,0x5F,0x6B,0x57,0x8D,0x73,0x7B,0x33,
+    0x39,0x24,0x95,0x40,0x4E,0xC8,0xF3,0xD9,0x47,0x61,0xC0,0xFA,0xE3,0x9C,0xD5,0x0A,
+    0xED,0x7F,0xE1,0x58,0xEB,0x5F,0xF3,0xF5,0xA7,0xFF,0x00,0xDF,0xC7,0xFF,0x00,0xE2,
+    0x28,0xFF,0x00,0x85,0x63,0xAD,0x7F,0xCF,0xD6,0x9F,0xFF,0x00,0x7F,0x1F,0xFF,0x00,
+    0x88,0xAF,0x11,0xC2,0x6D,0xDD,0xA3,0xEB,0xE1,0x8D,0xC2,0x42,0x2A,0x31,0x92,0x49,
+    0x1C,0x55,0x15,0xDA,0xFF,0x00,0xC2,0xB1,0xD6,0xBF,0xE7,0xEB,0x4F,0xFF,0x00,0xBF,
+    0x8F,0xFF,0x00,0xC4,0x51,0xFF,0x00,0x0A,0xC7,0x5A,0xFF,0x00,0x9F,0xAD,0x3F,0xFE,
+    0xFE,0x3F,0xFF,0x00,0x11,0x47,0xB3,0x9F,0x62,0xBF,0xB4,0x30,0xDF,0xCE,0x8E,0x2A,
+    0xA5,0xB7,0xB9,0x9A,0xD2,0x51,0x2C,0x12,0xB4,0x6E,0x3B,0xA9,0xEB,0xEC,0x7D,0x47,
+    0xB5,0x76,0x1F,0xF0,0xAC,0x75,0xAF,0xF9,0xFA,0xD3,0xFF,0x00,0xEF,0xE3,0xFF,0x00,
+    0xF1,0x14,0x7F,0xC2,0xB1,0xD6,0xBF,0xE7,0xEB,0x4F,0xFF,0x00,0xBF,0x8F,0xFF,0x00,
+    0xC4,0x50,0xA1,0x34,0xEE,0x90,0xA5,0x8E,0xC2,0x49,0x5A,0x53,0x4D,0x16,0x34,0x5D,
+    0x6E,0x2D,0x59,0x96,0x02,0x3C,0xBB,0xAD,0xB9,0x28,0x7A,0x37,0xAE,0xDF,0xE7,0x8F,
+    0xE7,0x8C,0xD6,0xBB,0x23,0x29,0xC3,0x02,0x2B,0x05,0x7E,0x17,0x6B,0x6E,0xD8,0x17,
+    0x5A,0x7E,0x7F,0xEB,0xA3,0xFF,0x00,0xF1,0x15,0xDC,0x68,0xFE,0x1E,0xD7,0x21,0xB6,
+    0x36,0xFA,0xCB,0xD8,0xDC,0x2A,0x20,0x11,0xCD,0x0B,0xB1,0x90,0x9F,0xF6,0xB2,0xA0,
+    0x1E,0x3B,0xF5,0xE3,0x9C,0xE7,0x35,0xEC,0xE1,0xB1,0x75,0x1A,0xE5,0xA8,0xBE,0x67,
+    0xC9,0x66,0x38,0x0C,0x34,0x5B,0xA9,0x86,0x9A,0xB7,0x6F,0xF2,0x31,0x31,0x46,0x2B,
+    0x46,0xF7,0x4B,0x96,0xD5,0x89,0x00,0x95,0xAA,0x18,0xAF,0x41,0x49,0x3D,0x8F,0x15,
+    0xC5,0xAD,0xC6,0xE2,0x8C,0x53,0xB1,0x46,0x29,0xDC,0x56,0x1B,0x8A,0x31,0x4E,0xC5,
+    0x18,0xA2,0xE1,0x61,0xB8,0xA3,0x14,0xEC,0x51,0x8A,0x2E,0x16,0x1B,0x8A,0xB5,0x65,
+    0x72,0x6D,0xE5,0x19,0xFB,0xA6,0xAB,0xE2,0x8C,0x52,0x7A,0xE8,0x35,0xA1,0xDC,0xD8,
+    0xCF,0x1C,0xF1,0x8E,0x87,0x8A,0x75,0xD5,0x92,0x48,0x87,0x81,0x5C,0xAE,0x9D,0x7E,
+    0xD6,0xEE,0x11,0x89,0xDB,0x5D,0x44,0x37,0x8B,0x2C,0x43,0x9E,0xB5,0xC9,0x38,0xB8,
+    0xBB,0xA3,0xAA,0x12,0x52,0x5A,0x9C,0xCE,0xA1,0x61,0xE5,0xB1,0x65,0x15,0x94,0x57,
+    0x07,0x06,0xBA,0xDB,0xF0,0x19,0x4D,0x73,0x13,0x0C,0x4A,0xD5,0xD1,0x4E,0x6D,0xAD,
+    0x4C,0x2A,0x46,0xCC,0x87,0x14,0x62,0x9D,0x8A,0x31,0x5A,0x5C,0xCE,0xC3,0xF1,0x4E,
+    0x58,0x99,0xBA,0x0A,0x31,0x5A,0xD6,0x56,0xE1,0x94,0x03,0x59,0x39,0x58,0xB5,0x1B,
+    0x98,0xE5,0x4A,0x9C,0x11,0x46,0x2B,0x72,0xEB,0x4E,0x0C,0xA4,0x81,0xCD,0x63,0xBC,
+    0x66,0x36,0x2A,0xC2,0x92,0x9D,0xC6,0xE3,0x62,0x3C,0x56,0xD7,0x87,0xFF,0x00,0xE5,
+    0xE3,0xFE,0x03,0xFD,0x6B,0x1F,0x15,0xB3,0xA0,0x7F,0xCB,0xC7,0xFC,0x07,0xFA,0xD6,
+    0x78,0x87,0xFB,0xB6,0x5D,0x1F,0x8D,0x1B,0x54,0x51,0x45,0x79,0xA7,0x70,0x51,0x45,
+    0x14,0x00,0x51,0x45,0x14,0x01,0x81,0xE2,0xED,0x42,0xEF,0x4E,0xD2,0x12,0x5B,0x39,
+    0xCC,0x2E,0xF2,0x88,0xD9,0x80,0xE7,0x69,0x56,0xE8,0x7B,0x76,0xE4,0x73,0x5E,0x63,
+    0x7D,0x3B,0xB4,0xAC,0x5C,0xB4,0x92,0xB1,0xDC,0xCC,0x58,0xB1,0x2C,0x49,0x24,0xE7,
+    0xD7,0x3F,0xD6,0xBD,0x1B,0xC7,0x44,0x0D,0x0E,0x10,0x48,0x19,0xB8,0x51,0xCF,0xFB,
+    0xAD,0x5E,0x60,0xEE,0x66,0x76,0x55,0x0A,0x00,0xFB,0xB9,0x39,0xFA,0x60,0xFE,0x55,
+    0xE7,0xE2,0x2E,0xEA,0x6B,0xB2,0x3C,0xCC,0x4A,0x72,0xAC,0x6D,0x68,0x7A,0xDE,0xA1,
+    0xA6,0xC4,0xB1,0x47,0x31,0x92,0xDB,0xA7,0x95,0x28,0xCA,0x0E,0xB9,0xC7,0x4C,0x72,
+    0x49,0xE3,0xAF,0xBD,0x74,0x90,0xDF,0x5A,0xEA,0x41,0xDE,0xDF,0x29,0x22,0xF2,0xF1,
+    0x12,0x32,0x3D,0xC7,0xA8,0xCF,0x7F,0xD0,0x57,0x19,0x0C,0x61,0x22,0x52,0x14,0x02,
+    0x07,0xDD,0x3D,0x78,0x3F,0x87,0xAF,0x7A,0xAD,0x24,0xBB,0x65,0x46,0xC9,0xE0,0x86,
+    0x0F,0x9C,0x6D,0x39,0xCF,0x5F,0x5F,0xFF,0x00,0x5D,0x5E,0x1B,0x19,0x52,0x94,0xBB,
+    0xAE,0xC6,0x11,0x9C,0xB9,0xAD,0xD0,0xEF,0xF1,0x46,0x2B,0x1A,0xC3,0x5B,0xCA,0x6C,
+    0xBE,0x01,0x1C,0x63,0x0E,0xA3,0x83,0xF5,0x1E,0xB5,0xB2,0x8C,0x92,0x28,0x64,0x65,
+    0x65,0x3D,0x0A,0x9C,0x8A,0xF7,0xE8,0xE2,0x69,0xD6,0x57,0x83,0x35,0x8C,0x94,0xB6,
+    0x0C,0x51,0x8A,0x76,0x28,0xC5,0x6D,0x72,0xAC,0x37,0x14,0x62,0x9D,0x8A,0x31,0x45,
+    0xC2,0xC3,0x71,0x46,0x29,0xD8,0xA3,0x14,0x5C,0x2C,0x37,0x15,0x7A,0xD2,0xF5,0xA2,
+    0xC2,0xB3,0x71,0xDA,0xA9,0xE2,0x8C,0x52,0x7A,0x8D,0x68,0x6B,0xCD,0x75,0xBD,0x3A,
+    0xD6,0x3B,0x9D,0xCE,0x4D,0x3B,0x27,0x18,0xCF,0x14,0x98,0xA4,0xB4,0x1B,0x77,0x1B,
+    0x8A,0x31,0x4E,0xC5,0x18,0xAA,0xB9,0x36,0x1E,0x07,0x22,0xB6,0x6C,0x1C,0x00,0x05,
+    0x72,0xDA,0x4E,0xAB,0x1E,0xA5,0x11,0x04,0x6C,0xB8,0x41,0xF3,0xA7,0xF5,0x1E,0xDF,
+    0xCA,0xB6,0x21,0x9C,0xC4,0x6B,0x9D,0x4E,0x35,0x23,0xCD,0x1D,0x8B,0x8B,0xEA,0x75,
+    0x20,0x2B,0xA5,0x62,0x6A,0x76,0x80,0x65,0xD4,0x72,0x2A,0xC5,0xBE,0xA0,0xA4,0x63,
+    0x34,0xEB,0x89,0x56,0x44,0xEB,0x49,0x5D,0x33,0x67,0x69,0x23,0x9E,0xC5,0x6C,0xE8,
+    0x5F,0xF2,0xF1,0xFF,0x00,0x01,0xFE,0xB5,0x87,0x3D,0xE5,0x9C,0x53,0x32,0x35,0xDC,
+    0x0A,0xC0,0x90,0x41,0x90,0x02,0x0F,0xE7,0x5B,0x3E,0x1E,0x9A,0x29,0x85,0xC1,0x8A,
+    0x54,0x90,0x0D,0xB9,0x28,0xC0,0xE3,0xAD,0x4D,0x69,0xC5,0xC1,0xA4,0xC8,0xA5,0x6E,
+    0x74,0x6D,0xD1,0x45,0x50,0xD6,0xEE,0x25,0xB4,0xD0,0x75,0x1B,0x98,0x1B,0x64,0xD0,
+    0xDA,0xCB,0x22,0x36,0x01,0xC3,0x05,0x24,0x1C,0x1F,0x7A,0xE1,0x3B,0x92,0xB9,0x7E,
+    0x8A,0xF0,0xCF,0xF8,0x58,0x3E,0x28,0xFF,0x00,0xA0,0xA7,0xFE,0x4B,0xC5,0xFF,0x00,
+    0xC4,0xD7,0x57,0xF0,0xFF,0x00,0xC5,0x3A,0xCE,0xB7,0xAF,0x4F,0x6D,0xA8,0xDE,0x79,
+    0xD0,0xAD,0xAB,0x48,0x17,0xCA,0x45,0xC3,0x06,0x51,0x9C,0xA8,0x1D,0x89,0xAC,0xD5,
+    0x54,0xDD,0x8D,0xA5,0x42,0x51,0x57,0x67,0xA4,0x51,0x45,0x15,0xA9,0x81,0xCA,0xF8,
+    0xFC,0xE3,0xC3,0xF1,0x1E,0x7F,0xE3,0xE1,0x79,0x1D,0xBE,0x56,0xFC,0x6B,0xCC,0xA0,
+    0x42,0x59,0x80,0x3C,0x67,0x2A,0xA4,0x72,0x3F,0x03,0xD6,0xBD,0x23,0xE2,0x31,0x3F,
+    0xF0,0x8F,0x40,0x33,0x80,0xD7,0x4A,0x0F,0xD3,0x63,0x9F,0xE9,0x5E,0x79,0x6B,0x1E,
+    0xD5,0x5D,0xFC,0xF0,0x4B,0x6D,0xE0,0x76,0xAE,0x0C,0x46,0x92,0x6C,0xE1,0xC4,0xE9,
+    0x26,0xC7,0xC8,0xC1,0x23,0x8D,0x41,0x0B,0xD7,0x9C,0x61,0x47,0x3E,0xBE,0xB5,0x5A,
+    0x13,0xBA,0x55,0x62,0x55,0x86,0x71,0xB4,0xF7,0x35,0x25,0xC3,0xB2,0x1C,0x00,0x30,
+    0x07,0xA6,0x4F,0xBF,0xF9,0xFF,0x00,0x1A,0x4B,0x55,0x12,0x7C,0xCE,0x48,0x50,0x06,
+    0x73,0xDF,0x9C,0xF1,0xFE,0x7B,0xD6,0x09,0x5A,0x37,0x39,0x54,0x79,0x63,0x72,0xDB,
+    0x48,0x16,0x3C,0xF1,0x96,0x04,0x73,0xDC,0x74,0xFF,0x00,0x22,0xAB,0xAC,0xCE,0x2F,
+    0xC3,0xAC,0x8C,0xB2,0x0C,0xA8,0x29,0xD4,0x0C,0x75,0xE3,0xEA,0x69,0x6E,0x65,0xF9,
+    0x40,0xC6,0xD0,0x70,0x08,0x0D,0xD3,0xDC,0xF1,0x9A,0x8A,0xDA,0x3D,0xFB,0x89,0x20,
+    0x8E,0xA4,0x93,0xDB,0xA9,0xA5,0x15,0x65,0xCC,0x44,0x63,0x65,0xCC,0x6A,0xBD,0xFD,
+    0xD8,0x8C,0xED,0xB8,0x97,0x76,0x7A,0x19,0x0F,0x3F,0x8F,0x6A,0xA3,0xFD,0xA3,0x78,
+    0xEC,0x40,0xBA,0xB8,0xE3,0x05,0x87,0x9A,0xC0,0xE3,0xEB,0x9A,0x5B,0x99,0x55,0x62,
+    0x05,0x06,0x49,0x20,0x60,0x8E,0x3B,0xFF,0x00,0x8D,0x41,0x0A,0x86,0x75,0x2C,0xAA,
+    0xC7,0x1C,0xFC,0xD9,0x04,0x7F,0x9C,0x55,0x42,0x73,0x4A,0xF7,0x61,0x04,0xEC,0xE4,
+    0xCD,0x7B,0x6D,0x4A,0xF6,0x23,0xB8,0xDC,0x33,0x64,0x8C,0xAB,0xFC,0xD9,0xC7,0x5C,
+    0x66,0xB6,0x74,0xDD,0x6A,0x1B,0xE9,0x04,0x0F,0x88,0xE7,0x24,0x2A,0xE7,0x3B,0x5C,
+    0xFB,0x7A,0x7D,0x0F,0xA8,0xEB,0x5C,0xBC,0x93,0xF9,0x51,0x84,0x93,0x24,0x10,0x4F,
+    0x50,0x3F,0xCE,0x7D,0x7A,0x73,0x55,0xED,0xD9,0x9C,0xFC,0xB8,0x04,0x63,0x1D,0xC0,
+    0x06,0xB6,0xA1,0x8B,0xAD,0x4B,0x5B,0xDD,0x05,0x36,0xD2,0xBB,0x3D,0x1D,0xA2,0x74,
+    0xFB,0xCA,0x45,0x33,0x14,0xDF,0x0C,0x6B,0xB0,0x5F,0xF9,0x7A,0x66,0xA2,0xE1,0x6E,
+    0x5B,0xE5,0x82,0x66,0xE3,0xCD,0xF4,0x53,0x9E,0xFE,0x87,0xBF,0xD7,0xAE,0xCD,0xF6,
+    0x92,0xD0,0xE5,0x90,0x7E,0x15,0xEE,0x51,0xC4,0x46,0xAC,0x79,0xA2,0x75,0x46,0xD3,
+    0x8F,0x34,0x4C,0x8C,0x51,0x8A,0x79,0x52,0x0E,0x0F,0x5A,0x31,0x5B,0xDC,0x2C,0x33,
+    0x14,0x62,0x9F,0x8A,0x86,0xEA,0xE2,0x3B,0x3B,0x67,0xB8,0x97,0x3B,0x10,0x73,0xB4,
+    0x64,0x9E,0xC0,0x7E,0x74,0x9C,0x92,0x57,0x60,0x36,0xE2,0x78,0xED,0xA2,0xF3,0x24,
+    0x38,0x19,0xC0,0x03,0xA9,0x3E,0x82,0xB9,0x2D,0x53,0x52,0x96,0xEC,0xC8,0xAF,0x23,
+    0x47,0x08,0xFE,0x00,0xC3,0x1C,0x7A,0xF7,0x3D,0x29,0xF7,0xBA,0x84,0xD7,0x4E,0x65,
+    0x90,0xED,0x4F,0xE0,0x8F,0xB2,0xFD,0x7D,0x7F,0xCF,0xA7,0x18,0xF2,0x48,0x19,0x8A,
+    0xED,0x5D,0xA3,0xA6,0x4F,0x43,0xFE,0x7D,0xBE,0xB5,0xE1,0x62,0x71,0x92,0xAF,0x2E,
+    0x58,0x69,0x1F,0xCC,0xE7,0xE6,0x73,0x96,0x9B,0x16,0x2C,0xCB,0x2B,0x0D,0xA5,0x96,
+    0x45,0xE7,0x82,0x7A,0xE3,0xF3,0xFC,0x7F,0xFA,0xD5,0xAE,0x7C,0x45,0x7D,0x02,0x11,
+    0xFB,0x99,0x9F,0x3F,0xC4,0x39,0xE9,0xDB,0x18,0xFF,0x00,0x1A,0xCC,0x50,0x89,0x19,
+    0x76,0xC0,0xF9,0x78,0x3C,0xE7,0xD7,0x9F,0xF3,0xDA,0xAA,0x31,0xDD,0x27,0x3B,0x57,
+    0x80,0x73,0x9C,0xFF,0x00,0x9E,0x95,0xCB,0x4E,0xA4,0xE3,0x26,0xE0,0xEC,0x28,0xDF,
+    0x99,0xB4,0x6F,0xAF,0x89,0x6F,0x65,0x00,0x22,0xC4,0xA4,0xF2,0x4A,0xA9,0xCE,0x33,
+    0xEE,0x48,0xAA,0x3A,0x85,0xFC,0xF7,0x0A,0x44,0xF7,0x32,0x3F,0x25,0xB6,0x6F,0xC8,
+    0x07,0xD8,0x74,0xE9,0xC7,0xE2,0x45,0x41,0x0A,0xAC,0x24,0x12,0x4A,0x9F,0x94,0x76,
+    0x3E,0x95,0x56,0xE2,0x60,0x64,0xCB,0x6D,0x6C,0x64,0x8C,0x70,0x0F,0x34,0x4A,0xAD,
+    0x4A,0xB2,0xD5,0xB6,0x84,0xB9,0xA7,0x2D,0x59,0x25,0xBA,0x34,0x8D,0x9C,0x0E,0x46,
+    0x4E,0x7E,0xEE,0xDF,0xEB,0xFF,0x00,0xD6,0xAE,0xFF,0x00,0xC0,0x38,0xDD,0xA8,0xE0,
+    0xE7,0xFD,0x5E,0x49,0x04,0x73,0xF3,0xD7,0x0B,0x06,0x55,0x77,0x16,0x3C,0x8C,0x6F,
+    0xC7,0x6E,0xFF,0x00,0xCA,0xBB,0x5F,0x87,0x6C,0x4C,0x9A,0xA0,0x23,0xA7,0x93,0xDF,
+    0xFD,0xFA,0xAA,0x1A,0xD5,0x46,0xD8,0x75,0x7A,0xE9,0x9D,0xCD,0x66,0x78,0x8F,0xFE,
+    0x45,0x7D,0x5F,0xFE,0xBC,0xA6,0xFF,0x00,0xD0,0x0D,0x69,0xD6,0x67,0x88,0xFF,0x00,
+    0xE4,0x57,0xD5,0xFF,0x00,0xEB,0xCA,0x6F,0xFD,0x00,0xD7,0xA2,0xF6,0x3D,0x78,0xEE,
+    0x8F,0x9E,0x6B,0xB9,0xF8,0x53,0xFF,0x00,0x23,0x45,0xCF,0xFD,0x79,0x37,0xFE,0x86,
+    0x95,0xC3,0x57,0x73,0xF0,0xA7,0xFE,0x46,0x8B,0x9F,0xFA,0xF2,0x6F,0xFD,0x0D,0x2B,
+    0x96,0x1F,0x12,0x3B,0xEA,0xFC,0x0C,0xF6,0x0A,0x28,0xA2,0xBA,0xCF,0x38,0xE4,0x3E,
+    0x23,0x21,0x7F,0x0F,0x40,0xA0,0xF5,0xBA,0x5E,0x33,0xD7,0xE4,0x7E,0x2B,0xCF,0xD1,
+    0x44,0x31,0x37,0x25,0x0B,0x10,0x0E,0x0F,0x1C,0xFF,0x00,0x93,0x5E,0x89,0xF1,0x00,
+    0x21,0xD0,0xAD,0xCB,0xA9,0x2A,0x2E,0x94,0xF1,0xDB,0xE5,0x6E,0x6B,0xCD,0xA6,0x75,
+    0x58,0xF7,0x2E,0x30,0x33,0xF2,0x81,0xF8,0x9F,0xCB,0x9F,0x4A,0xE0,0xC4,0x6B,0x3B,
+    0x1C,0x58,0x85,0x79,0xD8,0x81,0xDF,0x2E,0x1B,0x76,0x71,0xD4,0x83,0xEB,0xCF,0xEB,
+    0xEF,0xDF,0x35,0x75,0x14,0x6D,0xDC,0xA4,0x1C,0x90,0x78,0x5C,0xFD,0x07,0x1E,0xD8,
+    0xFD,0x6A,0x9C,0x48,0xC5,0x88,0x39,0xDD,0xCE,0xDE,0xE7,0xAF,0x5C,0xE2,0xAC,0xB9,
+    0x44,0x8F,0x05,0xB1,0xF2,0xF2,0x33,0xFA,0x7E,0xB5,0x8C,0xD7,0x43,0x2A,0x8B,0x68,
+    0x95,0xE5,0x94,0x49,0x23,0x67,0x68,0xF5,0x23,0x1D,0x7F,0xC9,0xFE,0x75,0x6A,0x24,
+    0x61,0x1B,0x33,0x0D,0xA1,0x54,0x70,0x38,0xE4,0x7F,0x4F,0xAD,0x53,0x8B,0x73,0x30,
+    0x7F,0xBC,0x4F,0x27,0x23,0xAE,0x3A,0x7F,0x8D,0x5C,0x76,0xDB,0x01,0x2B,0xBB,0x8E,
+    0x36,0x81,0xDB,0xB6,0x47,0xE3,0x44,0xD6,0xC9,0x11,0x52,0x3B,0x44,0x82,0x59,0x18,
+    0xCA,0x06,0x72,0x48,0x2B,0x82,0x73,0x93,0x8F,0x6F,0xF3,0xD2,0xA6,0x8D,0x12,0x38,
+    0xCB,0xED,0xF4,0xDC,0xAB,0x8E,0x3D,0xAA,0x9A,0x36,0x4F,0xCC,0x4E,0x4F,0xCB,0xC9,
+    0x04,0x9E,0x79,0xC1,0xED,0xDF,0xF4,0xAB,0xA0,0x0B,0x7B,0x7D,0xCA,0x49,0x20,0x1C,
+    0x10,0x3A,0x74,0xE9,0xC7,0xB9,0xA5,0x25,0x6D,0x05,0x38,0xD9,0x28,0x91,0x5D,0x33,
+    0x9F,0x97,0x1C,0x64,0xB7,0x23,0x91,0xF9,0x7E,0x15,0x25,0xA8,0xDA,0x9B,0xD9,0x40,
+    0x39,0xC1,0xC0,0x38,0xC7,0xFF,0x00,0xAB,0xF9,0xD5,0x4C,0xBC,0x8E,0x37,0x06,0x5F,
+    0x98,0x8D,0xCA,0xB8,0xFC,0x7A,0x7F,0x9C,0x55,0xDD,0xAB,0x0A,0x91,0x86,0x2A,0x38,
+    0xE3,0x8F,0x5F,0xC3,0xA5,0x12,0x56,0x56,0x09,0xC6,0xD1,0xB0,0xCB,0x99,0xB7,0x7E,
+    0xEF,0x27,0x9E,0x99,0xE8,0x3D,0x3F,0xAF,0x6A,0xF4,0x6F,0x07,0xF8,0xAF,0xFB,0x4A,
+    0x14,0xD2,0x75,0x57,0x26,0xE9,0x46,0xD8,0x6E,0x1C,0xFF,0x00,0xAC,0xFF,0x00,0x65,
+    0x8F,0xF7,0xBA,0x60,0xF7,0xE3,0x3C,0xF2,0x7C,0xCA,0x46,0x26,0x52,0x99,0xDD,0xCF,
+    0xDD,0xCF,0x6C,0x8F,0x6A,0xBB,0x17,0xEE,0xE3,0x24,0x91,0x92,0x32,0x08,0x1C,0x9C,
+    0x7F,0x90,0x6A,0xE9,0xD5,0x95,0x1B,0x38,0x89,0x49,0xD1,0xB3,0x47,0xA7,0x6A,0x56,
+    0xBE,0x4C,0xB9,0x03,0x83,0x54,0x31,0x5C,0xED,0xAF,0x8C,0xA7,0x58,0xDA,0x0D,0x43,
+    0x37,0x48,0xA4,0x05,0x94,0x11,0xBD,0x70,0x31,0x83,0xFD,0xEE,0x40,0xE4,0xE3,0xA9,
+    0xE4,0xD5,0xB1,0xE2,0x4B,0x56,0x8C,0x32,0xC3,0x3E,0x5B,0x3B,0x77,0x00,0x32,0x7D,
+    0x0E,0x09,0xAF,0x66,0x18,0xDA,0x4E,0x37,0x6E,0xC6,0xAE,0xA4,0x37,0x34,0xE7,0x9A,
+    0x2B,0x68,0x1E,0x69,0x9C,0x24,0x68,0x32,0xCC,0x7B,0x57,0x1D,0x7D,0xAA,0xCB,0xAB,
+    0x4F,0xF2,0x86,0x4B,0x75,0x3F,0x22,0x63,0x04,0x9F,0x53,0xF9,0x76,0xE9,0x50,0xEA,
+    0x9A,0xBC,0xDA,0x8B,0x6C,0x7C,0x08,0xD5,0xF2,0xA8,0xBD,0x31,0x9C,0x7D,0x73,0x8E,
+    0xFF,0x00,0xCB,0x35,0x15,0xBC,0x7B,0x02,0xB0,0x55,0x19,0xE4,0x9E,0xB8,0xF5,0xFF,
+    0x00,0x3E,0xF5,0xE7,0xE2,0xF1,0x8E,0xA2,0xE5,0x8E,0x8B,0xF3,0x32,0xA9,0x3B,0xAD,
+    0x08,0xE6,0x38,0x4F,0x2C,0xA9,0x19,0xE4,0x03,0xCE,0x3B,0x55,0x38,0x95,0x9A,0x57,
+    0xDE,0x79,0x2B,0xCF,0x1C,0xFB,0xFF,0x00,0x9F,0xA5,0x58,0xBA,0x9F,0x71,0xD8,0x01,
+    0x63,0x9C,0x11,0x9C,0xF1,0xFC,0xBF,0xCF,0xE6,0xF8,0x01,0x56,0x32,0x13,0x8E,0x46,
+    0xE5,0xC7,0x6F,0xF0,0xC7,0xF5,0xAE,0x38,0xFB,0xB1,0x08,0xC7,0x96,0x17,0x1C,0xE1,
+    0x84,0x0A,0xAD,0xFD,0xDE,0xE0,0xE7,0x3E,0x9D,0x3D,0xC7,0xAD,0x53,0x85,0x8B,0x48,
+    0x19,0x80,0x20,0xF2,0xC0,0xAF,0xF5,0xA7,0x5C,0x33,0xC9,0x21,0x52,0xC4,0x95,0x6C,
+    0x12,0x07,0x00,0xFB,0x73,0xEC,0x2A,0x6B,0x60,0xC5,0x06,0x39,0xDB,0x85,0x20,0x76,
+    0xE7,0x9E,0x3F,0xCF,0x4A,0x76,0xE5,0x89,0x7C,0xBC,0xB1,0x27,0x67,0x0B,0x1B,0x2C,
+    0x60,0x6E,0xEA,0x0F,0x72,0x71,0xFC,0xFA,0xD5,0x04,0x0C,0x5B,0xF8,0x57,0x07,0x3E,
+    0x83,0x1F,0x9F,0xB5,0x3E,0x66,0xC4,0x44,0x63,0xE5,0xE8,0x4B,0x11,0x8C,0xFF,0x00,
+    0x9F,0xE9,0x4B,0x6C,0x06,0xDC,0xED,0xC6,0x73,0x9D,0xBC,0x91,0xEF,0xF9,0x51,0x15,
+    0xCA,0xAE,0x11,0x8F,0x2C,0x6E,0x58,0x1B,0x7C,0xAD,0xCD,0xDC,0x71,0x81,0xFE,0x1D,
+    0x3F,0xC9,0xAE,0xCB,0xE1,0xB3,0xB3,0x9D,0x54,0x92,0x08,0xDD,0x16,0x31,0xFF,0x00,
+    0x02,0xAE,0x1A,0xED,0xC7,0x94,0xC1,0x8B,0x13,0x8E,0xA7,0x3F,0x37,0xF9,0xC9,0xAD,
+    0xBF,0x0B,0x78,0x8B,0xFB,0x03,0xED,0x4D,0xF6,0x61,0x70,0x67,0xF2,0xD7,0x02,0x4D,
+    0x9B,0x76,0xEE,0xF6,0x3F,0xDE,0xAD,0x28,0xDA,0x2F,0x99,0x9A,0x50,0x4A,0x0F,0x99,
+    0x9E,0xB7,0x59,0x9E,0x23,0xFF,0x00,0x91,0x5F,0x57,0xFF,0x00,0xAF,0x29,0xBF,0xF4,
+    0x03,0x5C,0xBC,0xBF,0x11,0x9A,0x36,0x60,0x34,0x8C,0xE0,0x7F,0xCF,0xC7,0xFF,0x00,
+    0x61,0x54,0xEF,0xBC,0x7E,0x35,0x4D,0x2E,0xEA,0xC8,0x69,0xC2,0x3F,0xB4,0x43,0x24,
+    0x45,0xBC,0xFD,0xDB,0x43,0x02,0x37,0x63,0x68,0xCF,0x5F,0x5A,0xEB,0x75,0xA0,0xD5,
+    0xEE,0x76,0xAA,0xD0,0xDE,0xE7,0x96,0xD7,0x73,0xF0,0xA7,0xFE,0x46,0x8B,0x9F,0xFA,
+    0xF2,0x6F,0xFD,0x0D,0x2B,0x99,0x93,0x48,0x58,0xF3,0xFE,0x93,0x93,0x92,0x07,0xC9,
+    0xC1,0xFC,0x73,0x5A,0xFE,0x11,0xD4,0x5B,0xC3,0x7A,0xB4,0xB7,0x86,0x0F,0xB4,0x07,
+    0x84,0xC4,0x17,0x7E,0xC3,0xCB,0x02,0x0F,0x43,0xFD,0xDF,0xD6,0xB0,0x84,0x95,0xEE,
+    0x76,0x4F,0x17,0x46,0x50,0x76,0x7F,0x99,0xED,0xF4,0x57,0x08,0xFF,0x00,0x12,0x15,
+    0x63,0x67,0xFE,0xCB,0x38,0x03,0xFE,0x7E,0x38,0xF6,0xFE,0x1A,0x8E,0x3F,0x89,0x66,
+    0x46,0x50,0x34,0x7E,0xB8,0xCF,0xFA,0x4F,0x4F,0xFC,0x76,0xBA,0x3D,0xB4,0x3B,0x9C,
+    0x6A,0xA4,0x5A,0xBA,0x66,0xB7,0x8F,0x31,0xFD,0x89,0x6E,0x0B,0x15,0x06,0xE4,0x74,
+    0xFF,0x00,0x71,0xEB,0xCA,0xE6,0x6D,0xD2,0x85,0xDF,0xC8,0x38,0x1B,0x81,0xF6,0x3D,
+    0x3D,0x7F,0xCF,0xD7,0xAD,0xF1,0x27,0x8B,0x17,0x5A,0xD3,0x62,0x83,0xEC,0x7E,0x48,
+    0x59,0x44,0x9B,0xFC,0xD2,0xDD,0x88,0xE9,0xB4,0x7A,0xD7,0x20,0xA1,0x9A,0x60,0xA6,
+    0x4D,0xDB,0x7F,0x87,0x19,0x23,0xD3,0x8F,0xC6,0xB9,0xE6,0xD4,0xA6,0xE4,0x8C,0x9D,
+    0xA5,0x2E,0x64,0x5B,0xB4,0x52,0xF1,0xF4,0xDB,0x93,0xC6,0x4F,0x5E,0xE4,0x8F,0xD7,
+    0xF3,0xA8,0x67,0x77,0x2C,0x3C,0xBC,0x1E,0x81,0x5B,0x18,0x15,0x61,0xB1,0x14,0x2D,
+    0x82,0x3E,0x50,0x30,0x57,0x39,0x07,0xA7,0x4F,0xC6,0xA8,0xEF,0x26,0x46,0xC9,0x3D,
+    0x77,0x7B,0x73,0xD7,0xF9,0xFF,0x00,0x2A,0xCA,0x2A,0xED,0xB3,0x28,0xC6,0xF2,0xB9,
+    0x6A,0xDD,0x54,0xB6,0xE7,0xE1,0xCF,0x38,0x5C,0x1C,0xF7,0xC7,0x4F,0x6F,0xD6,0x9B,
+    0x75,0x28,0x46,0x02,0x32,0x31,0xEB,0xD7,0x1F,0x5E,0x7A,0x73,0x52,0xC6,0xA4,0x45,
+    0xB4,0x81,0x80,0x30,0x00,0x3E,0xE4,0x66,0xAA,0x4E,0xE2,0x49,0x37,0x06,0x6D,0x9E,
+    0x99,0x3F,0x9E,0x7F,0x2E,0xB4,0xA2,0xAF,0x22,0x54,0x79,0xA5,0x72,0xC5,0xB2,0x93,
+    0x26,0xF2,0x85,0xC0,0xEE,0xFD,0xBD,0xBD,0x38,0xE7,0xFC,0xF3,0x4E,0xB9,0x22,0x35,
+    0xF2,0xFA,0x60,0xE0,0x90,0x3A,0xFA,0x7F,0x8F,0xE1,0xF8,0x53,0xE1,0xD8,0x23,0x5E,
+    0x30,0x1B,0xA6,0x4E,0x41,0x1E,0x9E,0xF5,0x52,0x57,0x92,0x47,0x0A,0xAE,0x0F,0x18,
+    0x27,0xB0,0xCF,0x61,0x49,0x2B,0xC8,0x14,0x79,0xA7,0x71,0xF6,0xED,0xB9,0x8F,0xCB,
+    0x91,0x8E,0x40,0x19,0xE3,0xFC,0x3F,0xCF,0xD6,0x6B,0xB9,0x4E,0xE2,0x06,0x4A,0xA8,
+    0x3C,0xE3,0xA7,0xE9,0xC7,0xFF,0x00,0xAA,0x92,0x08,0x8F,0x91,0xB8,0x9C,0x1C,0xF5,
+    0x20,0xF3,0xF9,0x7B,0xD4,0x37,0x6F,0xE6,0x32,0x01,0x95,0x00,0x9C,0x86,0xE3,0xF4,
+    0xFF,0x00,0x3D,0x7B,0x51,0x64,0xE6,0x27,0x1E,0x69,0x0B,0x01,0x02,0x46,0x26,0x3C,
+    0x10,0x06,0x08,0x3C,0x1F,0x6F,0xF3,0xE9,0x56,0xEE,0x09,0x8E,0x10,0x5B,0x00,0x74,
+    0xC7,0x40,0x3F,0xCF,0xF4,0xFC,0xE2,0x85,0x58,0x39,0xC6,0x58,0x83,0x8C,0x95,0xE3,
+    0x3F,0xFE,0xAA,0x65,0xC4,0xC1,0x9C,0xA8,0x27,0x77,0xF1,0x01,0xD8,0x74,0xC7,0xBF,
+    0xF9,0xF7,0xA4,0xD7,0x34,0x8C,0xE5,0x1E,0x69,0xD8,0x64,0x39,0x2E,0x5C,0xA8,0x19,
+    0xE4,0x7C,0xC3,0x39,0xFF,0x00,0x3F,0xCA,0xAE,0x3E,0x3C,0xA3,0x90,0xAC,0x71,0x8F,
+    0x43,0x8F,0x4E,0x3B,0xF6,0xA8,0x6D,0x54,0x08,0xC9,0x3D,0xCF,0x39,0xEA,0xBF,0x87,
+    0xE5,0xF9,0x52,0x5D,0x3A,0xED,0x2A,0x5F,0x79,0xE9,0x92,0x41,0xC7,0xBF,0xEB,0xF8,
+    0xD2,0x6A,0xF2,0xB1,0x94,0xA1,0xCD,0x3B,0x11,0xAA,0x89,0x64,0x66,0x60,0xC4,0xFB,
+    0x61,0xB1,0xF5,0xC7,0xE7,0xF9,0x55,0xB3,0x84,0x8C,0x0C,0x0C,0x2A,0x90,0x46,0x31,
+    0xCE,0x7D,0xBB,0xF4,0xAA,0xD6,0xEA,0xE3,0xE6,0x70,0x09,0xC9,0x38,0xC7,0x4F,0xCB,
+    0xBF,0x5A,0x5B,0x99,0x7F,0x76,0xFC,0x6D,0xDD,0xF7,0x8E,0x06,0x07,0xFF,0x00,0x5F,
+    0x9A,0x1A,0xBB,0xB1,0x6E,0x37,0x95,0x88,0x25,0x3B,0x98,0x39,0x04,0x8F,0xEF,0x72,
+    0x01,0xE7,0x8C,0xFF,0x00,0x9E,0x9F,0xA5,0xB1,0xB5,0x13,0x71,0x73,0xD7,0x68,0x00,
+    0x8F,0x5E,0x82,0xAB,0x41,0x16,0x64,0x0C,0xA3,0xE5,0x27,0x00,0x8F,0x4F,0x7F,0x4F,
+    0xCA,0xA5,0x9E,0x46,0x88,0xE7,0x03,0x96,0x19,0xEC,0x7F,0xC3,0xFF,0x00,0xD7,0x57,
+    0x2D,0x74,0x46,0xD2,0x8D,0xDA,0x89,0x58,0x32,0xB4,0x98,0x39,0x62,0x0E,0x40,0xEF,
+    0xF8,0x9A,0xBC,0x84,0x2C,0x5C,0x60,0x0C,0x6E,0x05,0xBB,0x8F,0xC7,0xE8,0x2A,0x9D,
+    0xA4,0x49,0xBF,0x27,0xBE,0x3A,0x9E,0x33,0xFE,0x7B,0x7F,0x93,0x3D,0xC3,0x79,0x71,
+    0x03,0xD0,0x13,0xCF,0x3F,0x8E,0x46,0x68,0x9A,0xBB,0xB2,0x34,0xA9,0x1B,0xB5,0x12,
+    0xAC,0xBF,0xBC,0xF9,0x94,0x13,0xB9,0x88,0x18,0x1D,0xFD,0x6A,0xF2,0x6E,0x89,0x77,
+    0x79,0x8A,0x14,0x11,0xC0,0x38,0xE7,0x1F,0xCB,0xA5,0x52,0x82,0x36,0x62,0x70,0xDF,
+    0x39,0x39,0xE1,0x32,0x0F,0xE9,0x53,0xCD,0x31,0x40,0x06,0x30,0x5B,0x9C,0x9C,0x73,
+    0xD7,0x9F,0xF0,0xFA,0x53,0x92,0xBF,0xBA,0x82,0x71,0xD5,0x45,0x10,0x4E,0xC1,0xA4,
+    0xED,0xB8,0x8C,0x91,0x8C,0xF5,0xEF,0x9F,0x4C,0x0F,0xD6,0xAD,0x5B,0xAA,0xAA,0x16,
+    0x77,0xE8,0xB9,0x07,0xBE,0x39,0xC9,0xF5,0xF4,0x15,0x4A,0x10,0x9B,0xC0,0x20,0xA9,
+    0x24,0xF2,0x46,0x30,0x47,0xB7,0xF9,0xEB,0x56,0xDD,0x80,0xE0,0xB1,0x19,0x1F,0x32,
+    0x8E,0x39,0x1F,0xCF,0xBF,0xE5,0x4E,0x6B,0xEC,0x84,0xE3,0xB4,0x51,0x14,0xB2,0x8F,
+    0x33,0xEF,0x28,0xDA,0x78,0xE7,0x23,0x9F,0x71,0xD7,0xBF,0xE7,0x52,0x5A,0x2E,0xD2,
+    0x1B,0x86,0x01,0x72,0xC3,0xEB,0x9F,0xFF,0x00,0x55,0x55,0x40,0x59,0xD8,0xEE,0x3B,
+    0x8E,0x46,0x4A,0x75,0x39,0xED,0xF9,0x7A,0xF7,0xAB,0xAE,0x40,0x84,0xE3,0x2A,0xB9,
+    0xCE,0x71,0xDF,0xA1,0x3F,0xE7,0xD6,0x94,0x95,0x95,0x85,0x52,0x36,0x4A,0x25,0x79,
+    0xE4,0x04,0xEF,0xDC,0x40,0x27,0x9E,0x31,0xC0,0xED,0x8F,0xCA,0xA5,0xB6,0x03,0x93,
+    0x92,0x48,0x1C,0x1E,0x9E,0xFD,0xBE,0x95,0x48,0xAF,0x99,0x28,0x23,0xA0,0x38,0xC9,
+    0x39,0xFC,0x7F,0x2C,0xD5,0xF8,0xC6,0xC8,0x03,0x48,0x48,0xC7,0x19,0x1D,0x3A,0x75,
+    0xCF,0xE5,0x4E,0x4A,0xCA,0xC3,0x94,0x6C,0x94,0x48,0x2E,0x1F,0x6A,0x92,0xCA,0x59,
+    0x81,0x18,0x07,0xAF,0xBD,0x2D,0xB2,0x92,0x4C,0xA4,0x70,0xC3,0x9E,0x41,0xC7,0x5F,
+    0xCC,0x62,0xAB,0x48,0x44,0x92,0x38,0x51,0x96,0x2C,0x49,0x15,0x71,0x41,0x20,0x1E,
+    0x0B,0x67,0x8C,0xB6,0x79,0xE3,0xD7,0xFA,0x53,0x6A,0xD1,0xB1,0x6E,0x3C,0xB1,0xB0,
+    0xCB,0xA0,0xA0,0x32,0x13,0xB7,0xE6,0xC8,0xCA,0xE7,0x27,0x9F,0xFE,0xBD,0x25,0xB0,
+    0x01,0x49,0x6F,0x97,0x3C,0x67,0xB9,0xF4,0x39,0xFF,0x00,0x3D,0x6A,0x19,0xDF,0x74,
+    0xAC,0x9F,0x79,0x86,0x3A,0xF7,0x3F,0xCF,0x15,0x6A,0x2C,0x24,0x01,0x40,0x19,0x03,
+    0x07,0xDB,0xDF,0xF9,0xF1,0xD2,0x86,0xAD,0x1B,0x16,0xE3,0xCB,0x0B,0x0C,0x9A,0x62,
+    0xA4,0x29,0x3F,0x37,0x5D,0xD9,0xC7,0x1E,0x9F,0xD6,0xA2,0xB7,0x51,0xE6,0x03,0x90,
+    0xB9,0xE4,0xA1,0xF5,0xFF,0x00,0x3F,0xE7,0xB5,0x32,0xE5,0x83,0x4A,0xCA,0x08,0x52,
+    0x09,0x38,0xCF,0x3F,0xE7,0x9A,0xB1,0x6C,0x81,0x4F,0x3B,0x80,0x18,0xE0,0x9E,0xA3,
+    0xD3,0xF3,0x14,0xDA,0xB4,0x44,0xE3,0xCB,0x02,0x49,0xDC,0x2A,0x63,0x3B,0x7B,0x01,
+    0x8D,0xA4,0x77,0xFC,0xAA,0xB5,0xB8,0x77,0x66,0x38,0xC9,0xEA,0x71,0xC6,0x49,0xC7,
+    0x5F,0xF3,0x8A,0x6D,0xC4,0xED,0x23,0xF2,0x1B,0x6E,0xE0,0x42,0x8E,0x31,0xC7,0xF8,
+    0x55,0x8B,0x24,0x21,0x49,0x07,0x38,0xEF,0xB8,0x70,0x3F,0x0E,0x3F,0xFD,0x54,0xAD,
+    0xCB,0x11,0x72,0xF2,0xC0,0x92,0xE1,0x95,0x22,0x0A,0xA7,0xB0,0x60,0x77,0x60,0x77,
+    0xF5,0xAA,0xC8,0x03,0x64,0x9F,0x97,0x2C,0x0E,0x58,0x82,0x3A,0x7A,0x51,0x7B,0x2E,
+    0x57,0x66,0x72,0x72,0x4A,0xAE,0x38,0x3F,0xA6,0x7D,0x69,0xD6,0xA3,0x2C,0xC5,0x88,
+    0x38,0x3B,0x8E,0x41,0xF4,0xF5,0xFC,0xE8,0x4A,0xD1,0xB8,0x46,0x3C,0xB1,0xB9,0x62,
+    0x4C,0xAA,0x7C,0x80,0xE0,0x1C,0xE7,0xD0,0xD5,0x68,0x79,0x97,0x68,0x5E,0x83,0x18,
+    0xC6,0x33,0x8F,0xAF,0xE5,0x4F,0xB8,0x91,0xF6,0xFE,0xEC,0xEE,0x24,0x36,0x33,0xD7,
+    0x3F,0xA9,0xFF,0x00,0x22,0x9B,0x04,0x64,0xB0,0xDD,0x95,0xC0,0xCE,0x46,0x3F,0x2F,
+    0xA5,0x24,0xAD,0x11,0x46,0x3C,0xB1,0xB9,0x6B,0x68,0xF2,0x77,0x83,0xB4,0x37,0x03,
+    0x8E,0x00,0xE8,0x09,0xFD,0x7F,0xCF,0x35,0x47,0x2F,0x2B,0x96,0x19,0x00,0x76,0xC6,
+    0x0E,0x33,0xF9,0x7A,0xD5,0x8B,0x82,0x55,0x7A,0x29,0xE7,0xA8,0x3C,0x11,0xDF,0xDB,
+    0x8A,0x8E,0xDC,0x79,0x92,0xA6,0xE5,0x6C,0x91,0xCE,0x38,0xE3,0xA6,0x7F,0xCF,0xF8,
+    0xD1,0x15,0x65,0x72,0x23,0x0B,0x27,0x22,0xE4,0x41,0x8A,0x86,0x5C,0x28,0xDA,0x3E,
+    0xEF,0x7C,0x7D,0x0D,0x56,0x99,0xF7,0x4A,0x41,0x56,0x3B,0x47,0x04,0xF1,0xCF,0xD7,
+    0x3F,0x4E,0x3E,0xB5,0x2C,0xEC,0x4A,0x38,0xDE,0x71,0x80,0xC1,0xBA,0xFB,0xF2,0x3F,
+    0xFA,0xD5,0x5E,0x21,0xB8,0x92,0xCC,0x00,0x07,0x03,0x07,0xFC,0xFF,0x00,0x90,0x2A,
+    0x62,0xBA,0x91,0x08,0x6F,0x26,0x5D,0xB7,0x5D,0x91,0xAE,0xF0,0xA7,0x39,0x3B,0x7B,
+    0x0E,0xBD,0xBB,0x7F,0xF5,0xAA,0x9C,0xEF,0xBE,0x49,0x14,0x9F,0x7E,0x4F,0xA6,0x07,
+    0x23,0x1F,0xE7,0x15,0x3C,0xF2,0x3A,0xC4,0x43,0x38,0x50,0x47,0x1E,0xA1,0x7F,0xC8,
+    0x1F,0xAD,0x52,0x4C,0xCB,0x2E,0x7A,0x8D,0xC7,0x91,0x8F,0x4E,0x7F,0xA5,0x38,0x47,
+    0x79,0x32,0xA9,0x47,0x79,0x17,0x2D,0xE2,0x40,0x0A,0xEE,0xC6,0x01,0x19,0xC8,0x38,
+    0x1F,0xD6,0xAA,0x4C,0xC4,0x96,0xC1,0x50,0x40,0xE3,0x03,0x3D,0xF0,0x3F,0xAD,0x5A,
+    0x90,0x01,0x00,0x3B,0x81,0x63,0x9E,0x4F,0xF5,0xAA,0xB1,0x86,0x79,0x4F,0x2C,0x00,
+    0x39,0xC7,0xA7,0x3F,0xE7,0xF5,0xEF,0x55,0x1E,0xAC,0xBA,0x71,0xBB,0x72,0x2D,0x42,
+    0x8D,0x0A,0x11,0xB7,0x20,0xF7,0x39,0x38,0xE9,0xC0,0x3F,0x5A,0xAD,0x37,0xCC,0x85,
+    0x78,0x3B,0x76,0xE3,0x1F,0x87,0x6F,0x42,0x7F,0x3A,0xB0,0xEC,0x44,0x07,0x2E,0x98,
+    0x50,0x0E,0x18,0xE7,0xB7,0x53,0x54,0xF8,0x69,0x1B,0x7B,0x8E,0x1B,0x83,0xDB,0x39,
+    0xE9,0xCE,0x7F,0xCF,0xD6,0x9C,0x16,0xB7,0x36,0x84,0x6E,0xDC,0x8B,0x50,0x11,0xB9,
+    0x5B,0xF2,0x00,0x67,0x03,0xF9,0x77,0xE9,0x51,0xDC,0xB6,0x25,0xC6,0x39,0x27,0xFE,
+    0xFA,0x3F,0x5F,0xFF,0x00,0x55,0x4A,0xCE,0x22,0x84,0x9F,0xE2,0x61,0xCF,0xA7,0x63,
+    0xFD,0x6A,0x83,0xC8,0x0B,0xFD,0xEC,0xE7,0x27,0x1E,0x87,0xDF,0x9E,0xFE,0x94,0xE3,
+    0x1B,0xBB,0x84,0x23,0x79,0x39,0x17,0x6D,0x55,0xBB,0xF2,0xDB,0xB2,0x0A,0xF1,0xDB,
+    0xD3,0xF2,0x34,0xDB,0xE7,0x54,0x76,0x53,0xBB,0xE6,0xE4,0x0E,0x99,0xF6,0xC7,0xA7,
+    0xF9,0xEF,0x4E,0x85,0x42,0xC2,0x36,0x8C,0x3B,0x70,0x73,0xC1,0x1C,0x76,0xCF,0xBD,
+    0x52,0x2E,0xC6,0x65,0xC1,0x23,0x18,0xC0,0x2C,0x46,0x7B,0x9F,0xF3,0xEF,0x44,0x63,
+    0x79,0x5C,0x23,0x1E,0x69,0x5C,0xB7,0x6E,0x15,0x8A,0xB7,0xCA,0x77,0x60,0x65,0x97,
+    0x3E,0xFF,0x00,0x95,0x3E,0xE2,0x62,0x0F,0x03,0xAF,0x20,0x85,0xCE,0x3F,0xCF,0x14,
+    0xB1,0x04,0x48,0x89,0x21,0xB0,0xBC,0x9E,0x80,0x31,0xAA,0x97,0x07,0x7C,0x84,0x84,
+    0x25,0xBA,0x12,0x07,0xD3,0x9F,0xF3,0xCD,0x24,0xB9,0xA4,0x25,0x1E,0x69,0x5C,0x9A,
+    0xD8,0x07,0x24,0x90,0x36,0x9C,0x12,0x08,0xCF,0x6F,0xFE,0xB5,0x3E,0xEA,0xE0,0x15,
+    0xDA,0xBC,0x01,0xC6,0x73,0xD7,0xAF,0xAF,0x4E,0xBE,0xF4,0xB6,0xF8,0x48,0xD8,0x96,
+    0xDA,0x4B,0x71,0x91,0xD3,0x39,0xFC,0xAA,0xBC,0xF2,0x03,0x30,0x8D,0x73,0xD8,0xEE,
+    0x3C,0x74,0xEF,0x42,0x57,0x90,0xD4,0x79,0xA6,0x10,0x2B,0x99,0x5C,0xB1,0xCA,0xF6,
+    0x00,0x72,0x7B,0xFF,0x00,0x9F,0xAD,0x59,0x9D,0x8A,0xAE,0x41,0xE4,0x2F,0x27,0xA7,
+    0x23,0xFC,0xE7,0x9A,0x8E,0xDB,0xE5,0x8C,0xB2,0xEE,0x0D,0x9E,0x01,0x39,0x39,0xFC,
+    0xFD,0xFF,0x00,0x5A,0x8E,0xE9,0xD8,0xBE,0x3C,0xC3,0x8C,0xE3,0x24,0x63,0x27,0xB6,
+    0x7D,0x69,0xDA,0xF2,0x2B,0x97,0x9A,0x63,0x23,0x3B,0xA4,0x0C,0x80,0x0E,0x73,0xC1,
+    0xCF,0x7E,0xB8,0x15,0x66,0x72,0xC9,0x11,0x19,0x18,0x19,0xDB,0x93,0xE9,0xFC,0xFA,
+    0x7E,0xB4,0xDB,0x70,0x51,0x03,0xB0,0xF5,0xC0,0x1D,0x73,0xCE,0x7F,0x5C,0x1F,0xFF,
+    0x00,0x55,0x45,0x34,0xA0,0x39,0x19,0x2C,0xA0,0xE0,0x2A,0x75,0xCF,0xAF,0xF3,0xA7,
+    0xBC,0xB4,0x1B,0x8F,0x34,0xAC,0x31,0x5B,0xCC,0x98,0xE4,0xE7,0xAE,0x0E,0xEE,0x48,
+    0xFC,0x7A,0x73,0xFF,0x00,0xEA,0xAB,0x84,0xF9,0x76,0xE5,0x46,0x4A,0x67,0x80,0x14,
+    0x80,0x6A,0xB5,0xAE,0x0A,0xE4,0xB6,0x06,0x01,0x1C,0xE0,0x7B,0xFB,0x7E,0x34,0xEB,
+    0xA9,0x3C,0xB0,0x98,0x2C,0x06,0x0E,0x41,0x1D,0x71,0xDF,0x9E,0xFD,0x4D,0x12,0x57,
+    0x95,0x82,0x6B,0x9A,0x56,0x21,0xD8,0x5E,0x50,0x14,0x80,0xFC,0x9F,0x9B,0x07,0x07,
+    0x22,0xAF,0xA8,0xC4,0x0C,0x14,0x6D,0x38,0xC0,0x63,0xE9,0xF4,0xFC,0x3F,0xFD,0x55,
+    0x46,0xD3,0x25,0xCB,0x2B,0x65,0x72,0x72,0xC7,0x8F,0xF3,0xF9,0xD4,0xB3,0xCA,0x12,
+    0x2C,0xA1,0x08,0x09,0xC0,0xDC,0x7D,0xBF,0x9F,0xE7,0x44,0xD3,0x6E,0xC2,0x9C,0x6E,
+    0xF9,0x48,0xA5,0x65,0x76,0x0A,0x5C,0xE0,0x1C,0x3B,0x74,0xFD,0x3F,0x4F,0x5E,0x2A,
+    0xF8,0x0C,0xB0,0xE4,0xB6,0x30,0x39,0x20,0x1C,0x7E,0x7F,0x95,0x50,0x81,0x1A,0x46,
+    0xDD,0x9C,0x90,0x79,0x00,0x6E,0xE7,0x81,0x9F,0xFE,0xB5,0x59,0x96,0x44,0x4E,0x84,
+    0x0E,0x0F,0x00,0xF0,0x3D,0xFF,0x00,0x21,0x4A,0x6B,0x64,0x82,0x71,0xBB,0x51,0x20,
+    0xBA,0x63,0x2B,0x0D,0xCE,0x0B,0x0E,0xA4,0x37,0x4E,0xB5,0x66,0x25,0xF2,0xE0,0xC9,
+    0xC2,0x13,0x9C,0xED,0x5E,0x9F,0x87,0xA7,0x15,0x4E,0x34,0x76,0x93,0x76,0x5B,0x27,
+    0xE6,0x07,0xA7,0xD3,0xA6,0x6A,0xE4,0xAC,0xF1,0xB1,0x5C,0x06,0xE7,0x81,0x9C,0x0C,
+    0x8F,0x4A,0x24,0xB6,0x8A,0x0A,0x91,0xDA,0x24,0x12,0x16,0xF3,0x30,0x0B,0x73,0x8C,
+    0x13,0xC7,0xAE,0x6A,0xCC,0x0E,0x10,0x23,0x7D,0xD3,0x8F,0xBB,0xEB,0xF8,0x55,0x28,
+    0x8B,0xCB,0x36,0xE0,0x07,0x04,0x93,0x8F,0x94,0xE2,0xAE,0x1C,0x0B,0x71,0xB7,0x1B,
+    0x80,0x0B,0xB7,0xD4,0xF3,0xC8,0xF6,0x34,0xA6,0xBA,0x13,0x52,0x36,0x4A,0x28,0xAF,
+    0x75,0x37,0xEF,0x80,0x65,0x6C,0xB1,0xFB,0xB8,0xE3,0xB5,0x58,0xB7,0x54,0x54,0xCE,
+    0xE3,0x8C,0xF5,0xC7,0x24,0xE3,0xF3,0xEA,0x2A,0x98,0x3E,0x63,0x31,0x0C,0x43,0xF3,
+    0xB4,0x03,0x93,0xFE,0x71,0xDB,0x9A,0xBB,0xC4,0x48,0xBB,0x06,0x37,0x8E,0x54,0x9E,
+    0x70,0x33,0x8A,0x24,0xAC,0xAC,0x89,0x9C,0x6C,0xAC,0x47,0x71,0x38,0x2D,0x9E,0x76,
+    0x12,0x4E,0x47,0xF2,0xFD,0x3F,0x95,0x25,0xA2,0x93,0xCE,0x0E,0x49,0xC9,0x63,0xEC,
+    0x3A,0xFF,0x00,0x33,0xCF,0x15,0x5B,0xEF,0xC8,0xD9,0xC0,0x1C,0x61,0xB9,0x07,0xAF,
+    0xBD,0x5D,0x56,0x08,0xAC,0x85,0x8B,0x12,0x79,0xC7,0x7F,0xCF,0xAF,0xF2,0xA6,0xD5,
+    0x95,0x90,0xDC,0x79,0x63,0x62,0x3B,0xD9,0x1C,0x2B,0x8D,0xDD,0x58,0x64,0x9F,0x4F,
+    0xA5,0x36,0x01,0xB8,0xE7,0x39,0x1F,0x78,0x1C,0x03,0x81,0xD8,0xD4,0x13,0x17,0x32,
+    0xAE,0x10,0x96,0x61,0xCE,0x38,0x19,0x1D,0x3A,0x8F,0xA5,0x5C,0xB6,0x5D,0x91,0x9C,
+    0xA9,0xDE,0x30,0x48,0x23,0x91,0xFA,0x7F,0x9F,0xC2,0x86,0xB9,0x62,0x5B,0x8F,0x2C,
+    0x6C,0x57,0xBA,0x97,0x04,0x22,0x36,0xE5,0x1D,0x10,0x1E,0x0F,0x3E,0xDF,0x4A,0x2D,
+    0xC3,0x33,0x3B,0x33,0x61,0x81,0xC7,0x20,0x0F,0xF3,0xD7,0xDE,0xAB,0xCB,0x89,0x27,
+    0x03,0xCC,0xC3,0x33,0x60,0x9C,0x74,0xFC,0xFF,0x00,0x1A,0xB5,0x16,0x20,0xC1,0x93,
+    0x2A,0x47,0x70,0xB8,0x1F,0x5F,0x7E,0xDF,0x95,0x5B,0x56,0x8D,0x8D,0xA5,0x1E,0x58,
+    0xD8,0x74,0xF2,0x32,0xA0,0x54,0x52,0x4E,0x39,0x23,0xA7,0xD3,0xF3,0xC5,0x57,0xB6,
+    0x5F,0x31,0xF7,0x0C,0x05,0x2D,0x92,0x39,0x3F,0x36,0x0F,0x06,0x99,0x70,0xC0,0xCE,
+    0x41,0x0A,0xCA,0x46,0x3A,0xF1,0x91,0x56,0x2D,0xD8,0x24,0x44,0x85,0x07,0x77,0x20,
+    0x81,0xC0,0x1D,0x28,0xB7,0x2C,0x41,0xC7,0x96,0x04,0x97,0x64,0x6C,0x20,0xE7,0x0A,
+    0x08,0x2B,0x90,0x36,0xFE,0x75,0x5A,0xDD,0x0C,0xA4,0x1C,0xFB,0x60,0x30,0xE7,0xA1,
+    0xFC,0x7B,0xD2,0x5C,0x3E,0xE9,0x54,0x6F,0x19,0x07,0x83,0x83,0xC1,0xEF,0xD7,0x8A,
+    0x9A,0x08,0xC0,0x4D,0xC4,0x06,0x50,0xBB,0x99,0x77,0x67,0x71,0xFC,0xFF,0x00,0x5A,
+    0x2D,0xCB,0x10,0xE5,0xE5,0x80,0xFB,0xB0,0x61,0x4D,0xCA,0x79,0x1C,0xF2,0x7E,0x9E,
+    0xBE,0xFF,0x00,0xCA,0xAB,0x5B,0x92,0x46,0x00,0xC0,0x3D,0x7D,0x87,0xE3,0x8F,0x5A,
+    0x75,0xD3,0x60,0x9F,0xEF,0x72,0xDB,0x88,0xC8,0xC7,0xA5,0x3E,0xD9,0x09,0x46,0x90,
+    0x74,0x1C,0xF2,0x3D,0xCE,0x68,0x5A,0x40,0x14,0x79,0x63,0x72,0x79,0x58,0x2A,0xE3,
+    0xCC,0x51,0xB7,0x8C,0xFA,0x0F,0xC4,0xE7,0xFC,0xFA,0xD5,0x25,0x0D,0x24,0x87,0x00,
+    0xE5,0xB9,0xE0,0xF4,0x15,0x25,0xEC,0x81,0x78,0x1E,0xB8,0x3C,0x67,0x9A,0x2C,0xE3,
+    0x2F,0x97,0x7C,0x15,0x60,0x7A,0x36,0x7A,0xE7,0xB7,0x7E,0xA6,0x88,0xAE,0x58,0xDC,
+    0x23,0x1E,0x58,0xDC,0xB3,0x96,0xF2,0xF7,0xB2,0xFC,0xB8,0x00,0x00,0x38,0x3D,0xB8,
+    0xF4,0xAC,0xFC,0xB4,0xB3,0x10,0x41,0x62,0x7A,0x6E,0x3D,0x3F,0xCE,0x7F,0xAD,0x58,
+    0xBB,0x70,0xAC,0x54,0x32,0xB6,0x3A,0xE3,0x00,0xF4,0xA8,0xA0,0x89,0x77,0x13,0x23,
+    0xF2,0x0F,0x60,0x78,0xE7,0x9C,0x7F,0x9E,0xF4,0xE0,0xAC,0xAE,0x10,0x8D,0xA3,0x72,
+    0xF6,0xD0,0xB1,0x00,0x50,0x85,0xED,0x81,0x92,0x7D,0xBF,0x3F,0xE5,0xF8,0xD6,0x7C,
+    0xB2,0x33,0x4D,0x80,0xC4,0xF1,0xC2,0xB2,0xF3,0xF5,0xC7,0xF9,0x35,0x6E,0xE2,0x76,
+    0x8D,0x48,0xDD,0x97,0x1C,0x13,0xC7,0x3E,0x9D,0xFD,0xFF,0x00,0xCF,0x5A,0xAD,0x0C,
+    0x7E,0x64,0xC0,0x7C,0xA4,0xE4,0xE0,0x1C,0x0E,0xDE,0x9E,0x9F,0xE1,0x4A,0x0A,0xCA,
+    0xEC,0x70,0x8D,0x93,0x91,0x6E,0x36,0x51,0x6D,0xF3,0x29,0x3B,0x78,0x25,0x87,0x20,
+    0xFA,0xD5,0x49,0xBE,0x79,0x48,0x65,0x5C,0x8E,0xAD,0x8E,0x07,0xE7,0xDA,0xAC,0x4C,
+    0xE6,0x35,0xDA,0x14,0x10,0x53,0xAF,0x50,0x79,0xEB,0xFA,0x9A,0xAA,0xA3,0x2D,0x92,
+    0xDC,0x93,0xCB,0x63,0x93,0xEE,0x39,0xE9,0xC5,0x38,0x2E,0xA1,0x08,0xEF,0x26,0x5C,
+    0xB7,0xFD,0xDC,0x0A,0x48,0xE5,0xB9,0x04,0xF0,0x41,0xF5,0xA8,0x6E,0x64,0x2E,0x4A,
+    0xFC,0xA3,0x1C,0x31,0xEB,0x9F,0xF1,0xA9,0xCA,0x9D,0xA3,0xE6,0xF9,0xB2,0x4A,0xA9,
+    0xEA,0x39,0xCF,0xE7,0xD6,0xA8,0x0D,0xD2,0xBE,0x3E,0xF7,0xBF,0x19,0x3C,0xFF,0x00,
+    0x9F,0xCE,0x94,0x55,0xDF,0x30,0x42,0x3A,0xB9,0x32,0xE5,0xBA,0x81,0x00,0xCA,0xE3,
+    0x39,0xE5,0x9B,0xA7,0xB7,0x15,0x05,0xDC,0xCF,0x2B,0x6D,0x21,0x79,0xC7,0x24,0xFD,
+    0x6A,0xC1,0x65,0x50,0xCC,0x0F,0xF0,0x92,0x3B,0x15,0xE3,0xFC,0xFF,0x00,0x4A,0xA9,
+    0xBD,0x9A,0xE4,0xA6,0x0E,0x0E,0x58,0x75,0xA7,0x15,0xAD,0xC5,0x08,0xDD,0xB9,0x16,
+    0x2C,0xB6,0xED,0x25,0xB3,0xC0,0xCA,0xB7,0x5E,0x7B,0x1C,0x7F,0x9E,0x94,0x93,0x4C,
+    0xF9,0x23,0x03,0x7E,0x33,0xC9,0x1D,0x3F,0xCF,0xF4,0xA9,0x63,0x52,0xA8,0x41,0x0B,
+    0x9E,0xC3,0xAE,0x78,0xF7,0xFC,0x2A,0x94,0x99,0x72,0x9B,0x86,0x18,0x9C,0x01,0x8E,
+    0xC3,0xFF,0x00,0xD5,0x49,0x24,0xE5,0x70,0x8C,0x79,0xA5,0x72,0xCD,0xA2,0x80,0xC4,
+    0xB2,0x8E,0x3B,0x8E,0x3B,0xFF,0x00,0x3F,0xAD,0x3E,0xE6,0x55,0xE8,0xBD,0x73,0xD8,
+    0x0C,0x0F,0x7E,0x7B,0x7F,0x2A,0x91,0x48,0x8E,0x00,0xF9,0x18,0xC6,0x78,0x5E,0xBD,
+    0x71,0x9E,0x7F,0x4A,0xA9,0x23,0x82,0xFB,0x33,0x8D,0xB9,0xC3,0x7E,0x9F,0xD6,0x92,
+    0x5C,0xD2,0xB8,0x28,0xF3,0x4A,0xE3,0xAD,0x03,0x09,0x14,0x85,0x27,0x03,0x1C,0xE3,
+    0xF1,0xFA,0xF3,0x53,0xDC,0xB9,0x3B,0x94,0x1C,0x60,0x7F,0x73,0xA9,0xFE,0x58,0xFA,
+    0xFA,0xD3,0x6D,0x90,0xC6,0xA4,0xE3,0x81,0xC2,0x9C,0x0C,0x91,0xCE,0x6A,0x09,0xC0,
+    0x67,0x52,0x84,0x84,0xC1,0x3B,0xB3,0x92,0x3F,0x3F,0xC6,0x8B,0x5E,0x62,0x50,0xE6,
+    0x98,0xB1,0x6D,0x3F,0x21,0x64,0x23,0x3F,0xDD,0xEF,0xF8,0x73,0xE9,0x56,0x26,0x71,
+    0xB4,0x8D,0xC3,0x68,0xCE,0x32,0x3D,0x71,0xFE,0x79,0xA6,0x40,0xAA,0x91,0x83,0x81,
+    0x9C,0x63,0x3E,0x84,0xFF,0x00,0x3A,0x86,0x79,0x0E,0xFE,0x5C,0xF5,0x24,0xE1,0x8F,
+    0xCC,0x3D,0x7F,0xA5,0x3B,0x5E,0x41,0xCB,0xCD,0x30,0x8D,0x19,0xE4,0xC0,0x3B,0x97,
+    0x18,0xE3,0xBF,0x3C,0xF4,0xFC,0x6A,0xCC,0x8E,0x88,0x33,0xD4,0xE3,0x1C,0x92,0x4F,
+    0x41,0x8F,0xE7,0xFC,0xEA,0x08,0x10,0x22,0x8C,0x72,0xD9,0x0B,0xE9,0xB7,0xFA,0x74,
+    0xA2,0xEE,0x54,0xDA,0x80,0xE4,0x06,0xE3,0x1E,0x9E,0xDD,0x3D,0x28,0x6A,0xF2,0xB0,
+    0xDC,0x79,0xA5,0x63,0xFF,0xD9,
+};
@@ -0,0 +1,530 @@
+/* 由 host_qoic 生成，请勿手动修改
+ * 图片: 内置界面测试图，240x240，QOI565 4068 字节（RGB565 115200 字节） */
+
+#include <stdint.h>
+
+const uint32_t Image_UI_240x240_q565_size = 4068;
+
+__attribute__((aligned(4))) const uint8_t Image_UI_240x240_q565[4068] = {
+    0x51,0x35,0x36,0x35,0xF0,0x00,0xF0,0x00,0xD8,0x0F,0x00,0x00,0xFE,0x7B,0x2B,0xFF,
+    0xE0,0x1B,0xFE,0x8A,0x21,0xFF,0x60,0x05,0x6E,0xFF,0x90,0x02,0x6B,0xFF,0xBA,0x00,
+    0x87,0xA5,0xFF,0x29,0x00,0x1A,0xC8,0x0C,0xFF,0x29,0x00,0x1A,0xD2,0x0C,0xA9,0x98,
+    0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,
+    0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,
+    0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,
+    0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,
+    0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,
+    0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,
+    0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,
+    0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,
+    0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,
+    0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x6E,0xC8,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1F,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1F,0xD2,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1F,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1F,0xD2,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1F,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1F,0xD2,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1F,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1F,0xD2,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1F,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1F,0xD2,
+    0x0C,0x24,0xEC,0x99,0xC8,0x96,0xC7,0x99,0xC8,0x9A,0xB8,0x9D,0xA8,0x66,0x37,0x14,
+    0x07,0x06,0x25,0x24,0xEC,0x0C,0x1F,0xC8,0x0C,0x24,0xEC,0x9E,0x56,0x9C,0x46,0x9D,
+    0x67,0x9E,0x66,0x45,0x5A,0x0D,0x1F,0x07,0x37,0x39,0x24,0xEC,0x0C,0xBA,0x6B,0xD2,
+    0x0C,0x24,0xE9,0x9A,0xB7,0x90,0xF7,0x92,0xF8,0x99,0xC8,0xC9,0x21,0x18,0x2A,0x24,
+    0xE9,0x0C,0x1F,0xC8,0x0C,0x24,0xE9,0x39,0x9A,0x25,0x9B,0x35,0x9E,0x56,0xC9,0x3B,
+    0x16,0x39,0x24,0xE9,0x0C,0x1F,0xC8,0x7A,0xC8,0x0C,0x24,0xE7,0x2A,0xFE,0x50,0xEC,
+    0xFE,0x47,0xEA,0xCF,0x31,0x2A,0x24,0xE7,0x0C,0xBA,0x7B,0xC8,0x0C,0x24,0xE7,0x39,
+    0x98,0x14,0x10,0xCF,0x38,0x39,0x24,0xE7,0x0C,0x22,0xC8,0x6B,0xC8,0x0C,0x24,0xE6,
+    0xFE,0x34,0xED,0xFE,0x47,0xEA,0xD3,0x30,0x24,0xE6,0x0C,0x29,0xC8,0x0C,0x24,0xE6,
+    0x99,0x03,0x10,0xD3,0x1E,0x24,0xE6,0x0C,0x29,0xD2,0x0C,0x24,0xE4,0x9D,0xA8,0x14,
+    0x22,0xD5,0x14,0x07,0x24,0xE4,0x0C,0x29,0xC8,0x0C,0x24,0xE4,0x45,0xFE,0x52,0x6E,
+    0x10,0xD5,0x1F,0x12,0x24,0xE4,0x0C,0x29,0xD2,0x0C,0x24,0xE3,0x2A,0xFE,0x4B,0xEB,
+    0x22,0xD7,0x26,0x2A,0x24,0xE3,0x0C,0x29,0xC8,0x0C,0x24,0xE3,0x39,0xFE,0x10,0x56,
+    0x10,0xD7,0x3E,0x39,0x24,0xE3,0x0C,0x29,0xD2,0x0C,0x24,0xE2,0x9B,0xB8,0x21,0x22,
+    0xD9,0x21,0x36,0x24,0xE2,0x0C,0x29,0xC8,0x0C,0x24,0xE2,0x9E,0x67,0x3B,0x10,0xD9,
+    0x3B,0x03,0x24,0xE2,0x0C,0x29,0xD2,0x0C,0x24,0xE2,0xFE,0x8C,0xEB,0x22,0xDB,0x37,
+    0x24,0xE2,0x0C,0x29,0xC8,0x0C,0x24,0xE2,0x0D,0x10,0xDB,0x0D,0x24,0xE2,0x0C,0x29,
+    0xD2,0x0C,0x24,0xE1,0xFE,0x71,0xEC,0x22,0xDD,0x3D,0x24,0xE1,0x0C,0x29,0xC8,0x0C,
+    0x24,0xE1,0xFE,0x94,0x7E,0x10,0xDD,0x3D,0x24,0xE1,0x0C,0x29,0xD2,0x0C,0x24,0xE0,
+    0x92,0xF7,0x22,0xDF,0x26,0x24,0xE0,0x0C,0x29,0xC8,0x0C,0x24,0xE0,0x9B,0x35,0x10,
+    0xDF,0x09,0x24,0xE0,0x0C,0x29,0xC8,0x6E,0xC8,0x0C,0x24,0xE0,0xFE,0x4B,0xEB,0x22,
+    0xDF,0x26,0x24,0xE0,0x0C,0x2E,0xC8,0x0C,0x24,0xE0,0x3E,0x10,0xDF,0x3E,0x24,0xE0,
+    0x0C,0x2E,0xD2,0x0C,0x24,0xDF,0x06,0x22,0xE1,0x06,0x24,0xDF,0x0C,0x2E,0xC8,0x0C,
+    0x24,0xDF,0x9A,0x14,0x10,0xE1,0x37,0x24,0xDF,0x0C,0x2E,0xD2,0x0C,0x24,0xDF,0x32,
+    0x22,0xE1,0x32,0x24,0xDF,0x0C,0x2E,0xC8,0x0C,0x24,0xDF,0x0A,0x10,0xE1,0x0A,0x24,
+    0xDF,0x0C,0x2E,0xD2,0x0C,0x24,0xDE,0x97,0xD8,0x22,0xE3,0x14,0x24,0xDE,0x0C,0x2E,
+    0xC8,0x0C,0x24,0xDE,0x9D,0x56,0x10,0xE3,0x2A,0x24,0xDE,0x0C,0x2E,0xD2,0x0C,0x24,
+    0xDE,0x18,0x22,0xE3,0x18,0x24,0xDE,0x0C,0x2E,0xC8,0x0C,0x24,0xDE,0x16,0x10,0xE3,
+    0x16,0x24,0xDE,0x0C,0x2E,0xD2,0x0C,0x24,0xDE,0xFE,0x8C,0xEB,0x22,0xE3,0x37,0x24,
+    0xDE,0x0C,0x2E,0xC8,0x0C,0x24,0xDE,0x0D,0x10,0xE3,0x0D,0x24,0xDE,0x0C,0x2E,0xD2,
+    0x0C,0x24,0xDE,0xFE,0x68,0xEA,0x22,0xE3,0x2E,0x24,0xDE,0x0C,0xBB,0x7C,0xC8,0x0C,
+    0x24,0xDE,0xFE,0xCD,0x35,0x10,0xE3,0x13,0x24,0xDE,0x0C,0x2E,0xD2,0x0C,0x24,0xDD,
+    0x9A,0xB7,0x22,0xE5,0x2A,0x24,0xDD,0x0C,0x2E,0xC8,0x0C,0x24,0xDD,0x39,0x10,0xE5,
+    0x39,0x24,0xDD,0x0C,0x2E,0xD2,0x0C,0x24,0xDD,0x96,0xD7,0x22,0xE5,0x08,0x24,0xDD,
+    0x0C,0x2E,0xC8,0x0C,0x24,0xDD,0x9C,0x45,0x10,0xE5,0x1B,0x24,0xDD,0x0C,0x2E,0xD2,
+    0x0C,0x24,0xDD,0x93,0xF8,0x22,0xE5,0x32,0x24,0xDD,0x0C,0x2E,0xC8,0x0C,0x24,0xDD,
+    0x9C,0x35,0x10,0xE5,0x18,0x24,0xDD,0x0C,0x2E,0xD2,0x0C,0x24,0xDD,0x32,0x22,0xE5,
+    0x32,0x24,0xDD,0x0C,0x2E,0xC8,0x0C,0x24,0xDD,0x18,0x10,0xE5,0x18,0x24,0xDD,0x0C,
+    0x2E,0xD2,0x0C,0x24,0xDD,0x08,0x22,0xE5,0x08,0x24,0xDD,0x0C,0x2E,0xC8,0x0C,0x24,
+    0xDD,0x1B,0x10,0xE5,0x1B,0x24,0xDD,0x0C,0x2E,0xD2,0x0C,0x24,0xDD,0x2A,0x22,0xE5,
+    0x2A,0x24,0xDD,0x0C,0x2E,0xC8,0x0C,0x24,0xDD,0x39,0x10,0xE5,0x39,0x24,0xDD,0x0C,
+    0x2E,0xC8,0x6B,0xC8,0x0C,0x24,0xDE,0xFE,0x68,0xEA,0x22,0xE3,0x2E,0x24,0xDE,0x0C,
+    0x35,0xC8,0x0C,0x24,0xDE,0x13,0x10,0xE3,0x13,0x24,0xDE,0x0C,0x35,0xD2,0x0C,0x24,
+    0xDE,0x37,0x22,0xE3,0x37,0x24,0xDE,0x0C,0x35,0xC8,0x0C,0x24,0xDE,0x0D,0x10,0xE3,
+    0x0D,0x24,0xDE,0x0C,0x35,0xC8,0x6E,0xC8,0x0C,0x24,0xDE,0xFE,0xF2,0xEC,0x22,0xE3,
+    0x18,0x24,0xDE,0x0C,0x3A,0xC8,0x0C,0x24,0xDE,0x16,0x10,0xE3,0x16,0x24,0xDE,0x0C,
+    0x3A,0xD2,0x0C,0x24,0xDE,0x14,0x22,0xE3,0x14,0x24,0xDE,0x0C,0x3A,0xC8,0x0C,0x24,
+    0xDE,0x9D,0x56,0x10,0xE3,0x2A,0x24,0xDE,0x0C,0x3A,0xD2,0x0C,0x24,0xDF,0xFE,0x6C,
+    0xEB,0x22,0xE1,0x32,0x24,0xDF,0x0C,0x3A,0xC8,0x0C,0x24,0xDF,0x0A,0x10,0xE1,0x0A,
+    0x24,0xDF,0x0C,0x3A,0xD2,0x0C,0x24,0xDF,0x06,0x22,0xE1,0x06,0x24,0xDF,0x0C,0x3A,
+    0xC8,0x0C,0x24,0xDF,0x9A,0x14,0x10,0xE1,0x37,0x24,0xDF,0x0C,0x3A,0xD2,0x0C,0x24,
+    0xE0,0x26,0x22,0xDF,0x26,0x24,0xE0,0x0C,0x3A,0xC8,0x0C,0x24,0xE0,0x3E,0x10,0xDF,
+    0x3E,0x24,0xE0,0x0C,0x3A,0xD2,0x0C,0x24,0xE0,0x92,0xF7,0x22,0xDF,0x26,0x24,0xE0,
+    0x0C,0x3A,0xC8,0x0C,0x24,0xE0,0x09,0x10,0xDF,0x09,0x24,0xE0,0x0C,0x3A,0xD2,0x0C,
+    0x24,0xE1,0xFE,0x71,0xEC,0x22,0xDD,0x3D,0x24,0xE1,0x0C,0x3A,0xC8,0x0C,0x24,0xE1,
+    0xFE,0x94,0x7E,0x10,0xDD,0x3D,0x24,0xE1,0x0C,0x3A,0xD2,0x0C,0x24,0xE2,0xFE,0x8C,
+    0xEB,0x22,0xDB,0x37,0x24,0xE2,0x0C,0x3A,0xC8,0x0C,0x24,0xE2,0x0D,0x10,0xDB,0x0D,
+    0x24,0xE2,0x0C,0x3A,0xD2,0x0C,0x24,0xE2,0x36,0x21,0x22,0xD9,0x21,0x36,0x24,0xE2,
+    0x0C,0x3A,0xC8,0x0C,0x24,0xE2,0x03,0x3B,0x10,0xD9,0x3B,0x03,0x24,0xE2,0x0C,0x3A,
+    0xD2,0x0C,0x24,0xE3,0x9A,0xB7,0xFE,0x4B,0xEB,0x22,0xD7,0x26,0x2A,0x24,0xE3,0x0C,
+    0x3A,0xC8,0x0C,0x24,0xE3,0x39,0x3E,0x10,0xD7,0x3E,0x39,0x24,0xE3,0x0C,0x3A,0xD2,
+    0x0C,0x24,0xE4,0x07,0xFE,0xEE,0xEB,0x22,0xD5,0x14,0x07,0x24,0xE4,0x0C,0x3A,0xC8,
+    0x0C,0x24,0xE4,0x12,0x1F,0x10,0xD5,0x1F,0x12,0x24,0xE4,0x0C,0x3A,0xD2,0x0C,0x24,
+    0xE6,0x30,0x22,0xD3,0x30,0x24,0xE6,0x0C,0x3A,0xC8,0x0C,0x24,0xE6,0x1E,0x10,0xD3,
+    0x1E,0x24,0xE6,0x0C,0x3A,0xD2,0x0C,0x24,0xE7,0x2A,0x31,0x22,0xCF,0x31,0x2A,0x24,
+    0xE7,0x0C,0x3A,0xC8,0x0C,0x24,0xE7,0x39,0x38,0x10,0xCF,0x38,0x39,0x24,0xE7,0x0C,
+    0x3A,0xD2,0x0C,0x24,0xE9,0x2A,0x18,0x21,0x22,0xC9,0x21,0x18,0x2A,0x24,0xE9,0x0C,
+    0x3A,0xC8,0x0C,0x24,0xE9,0x39,0x16,0x3B,0x10,0xC9,0x3B,0x16,0x39,0x24,0xE9,0x0C,
+    0x3A,0xD2,0x0C,0x24,0xEC,0x25,0x06,0x99,0xC8,0x14,0x37,0x32,0x37,0x14,0x07,0x06,
+    0x25,0x24,0xEC,0x0C,0x3A,0xC8,0x0C,0x24,0xEC,0x39,0x9C,0x46,0x9D,0x67,0x1F,0x0D,
+    0x0A,0x0D,0x1F,0x07,0x37,0x39,0x24,0xEC,0x0C,0x3A,0xC8,0x6E,0xC8,0x0C,0x24,0xFF,
+    0x27,0x00,0x0C,0x3F,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x3F,0xD2,0x0C,0x24,0xFF,
+    0x27,0x00,0x0C,0x3F,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x3F,0xC8,0x7A,0xC8,0x0C,
+    0x24,0xFF,0x27,0x00,0x0C,0x02,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x02,0xC8,0x6B,
+    0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,
+    0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,
+    0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,
+    0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,
+    0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,
+    0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,
+    0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,
+    0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,
+    0xD2,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x09,0xC8,0x0C,0x24,0xD2,0x0C,0xFD,
+    0x24,0xD2,0x0C,0x09,0xD2,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x09,0xC8,0x0C,
+    0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x09,0xD2,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,
+    0x0C,0x09,0xC8,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x09,0xD2,0x0C,0x24,0xD2,
+    0x0C,0xFD,0x24,0xD2,0x0C,0x09,0xC8,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x09,
+    0xC8,0x6E,0xC8,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x0E,0xC8,0x0C,0x24,0xD2,
+    0x0C,0xFD,0x24,0xD2,0x0C,0x0E,0xD2,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x0E,
+    0xC8,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x0E,0xD2,0x0C,0x24,0xFF,0x27,0x00,
+    0x0C,0x0E,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x0E,0xD2,0x0C,0x24,0xFF,0x27,0x00,
+    0x0C,0x0E,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x0E,0xD2,0x0C,0x24,0xFF,0x27,0x00,
+    0x0C,0x0E,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x0E,0xD2,0x0C,0x24,0xFF,0x27,0x00,
+    0x0C,0x0E,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x0E,0xD2,0x0C,0x24,0xFF,0x27,0x00,
+    0x0C,0x0E,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x0E,0xD2,0x0C,0x24,0xD7,0x0C,0xF2,
+    0x24,0xD8,0x0C,0x0E,0xC8,0x0C,0x24,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x0E,0xC8,0x6B,
+    0xC8,0x0C,0x24,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x15,0xC8,0x0C,0x24,0xD7,0x0C,0xF2,
+    0x24,0xD8,0x0C,0x15,0xD2,0x0C,0x24,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x15,0xC8,0x0C,
+    0x24,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x15,0xD2,0x0C,0x24,0xD7,0x0C,0xF2,0x24,0xD8,
+    0x0C,0x15,0xC8,0x0C,0x24,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x15,0xD2,0x0C,0x24,0xD7,
+    0x0C,0xF2,0x24,0xD8,0x0C,0x15,0xC8,0x0C,0x24,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x15,
+    0xD2,0x0C,0x24,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x15,0xC8,0x0C,0x24,0xD7,0x0C,0xF2,
+    0x24,0xD8,0x0C,0x15,0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,0x0C,0x24,0xFF,
+    0x27,0x00,0x0C,0x15,0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,0x0C,0x24,0xFF,
+    0x27,0x00,0x0C,0x15,0xC8,0x6E,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,
+    0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,
+    0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x0C,
+    0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0xFF,0x29,0x00,0x1A,0xC8,0x0C,0xFF,0x29,
+    0x00,0x1A,0xFF,0x4A,0x07,0x7A,0xFF,0xB0,0x00,0x6B,0xFF,0xBA,0x00,0x0C,0xFF,0x29,
+    0x00,0x24,0xC8,0x0C,0xFF,0x29,0x00,0x24,0xC8,0x6E,0xC8,0x0C,0xA9,0x98,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x29,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x29,0xC8,0x6E,0xC8,0x0C,0x24,
+    0xEC,0x9D,0xA5,0x9C,0xA4,0x9C,0xA5,0x9E,0x95,0x60,0xC1,0x17,0x3D,0x34,0x32,0x24,
+    0xEC,0x0C,0x2E,0xC8,0x0C,0x24,0xEC,0x99,0xAB,0x97,0xAC,0x98,0xAB,0x9B,0x9B,0x9D,
+    0x9A,0x65,0x11,0x23,0x02,0x37,0x34,0x24,0xEC,0x0C,0x2E,0xD2,0x0C,0x24,0xE9,0x9D,
+    0xA6,0x99,0xC1,0x9A,0xB2,0x9D,0xA6,0xC9,0x2C,0x09,0x39,0x24,0xE9,0x0C,0x2E,0xC8,
+    0x0C,0x24,0xE9,0x9A,0x9A,0x90,0xBF,0x92,0xBD,0x9A,0x9B,0xC9,0x33,0x13,0x39,0x24,
+    0xE9,0x0C,0x2E,0xD2,0x0C,0x24,0xE7,0x9D,0xA6,0x97,0xD0,0x01,0xCF,0x31,0x39,0x24,
+    0xE7,0x0C,0x2E,0xC8,0x0C,0x24,0xE7,0x9A,0x9A,0xFE,0x7C,0xB4,0x0F,0xCF,0x35,0x39,
+    0x24,0xE7,0x0C,0x2E,0xC8,0x6B,0xC8,0x0C,0x24,0xE6,0x97,0xD0,0x01,0xD3,0x1C,0x24,
+    0xE6,0x0C,0x35,0xC8,0x0C,0x24,0xE6,0xFE,0x3D,0xC5,0x0F,0xD3,0x20,0x24,0xE6,0x0C,
+    0x35,0xD2,0x0C,0x24,0xE4,0x64,0x17,0x01,0xD5,0x17,0x11,0x24,0xE4,0x0C,0x35,0xC8,
+    0x0C,0x24,0xE4,0x9D,0x9A,0x23,0x0F,0xD5,0x23,0x12,0x24,0xE4,0x0C,0x35,0xD2,0x0C,
+    0x24,0xE3,0x9D,0xA6,0xFE,0xA8,0xF5,0x01,0xD7,0x33,0x39,0x24,0xE3,0x0C,0x35,0xC8,
+    0x0C,0x24,0xE3,0x9A,0x9A,0xFE,0x5B,0xA3,0x0F,0xD7,0x3B,0x39,0x24,0xE3,0x0C,0x35,
+    0xD2,0x0C,0x24,0xE2,0x9E,0x95,0x2C,0x01,0xD9,0x2C,0x3E,0x24,0xE2,0x0C,0x35,0xC8,
+    0x0C,0x24,0xE2,0x9B,0xAA,0xFE,0x3B,0x9B,0x0F,0xD9,0x33,0x01,0x24,0xE2,0x0C,0x35,
+    0xD2,0x0C,0x24,0xE2,0x3F,0x9C,0xA4,0xDB,0x3F,0x24,0xE2,0x0C,0x35,0xC8,0x0C,0x24,
+    0xE2,0xFE,0xBC,0xA3,0x0F,0xDB,0x11,0x24,0xE2,0x0C,0x35,0xD2,0x0C,0x24,0xE1,0xFE,
+    0x4E,0xF6,0x01,0xDD,0x36,0x24,0xE1,0x0C,0x35,0xC8,0x0C,0x24,0xE1,0xFE,0x9C,0xB4,
+    0x0F,0xDD,0x3A,0x24,0xE1,0x0C,0x35,0xD2,0x0C,0x24,0xE0,0x9A,0xB2,0x01,0xDF,0x07,
+    0x24,0xE0,0x0C,0x35,0xC8,0x0C,0x24,0xE0,0x93,0xBD,0x0F,0xDF,0x09,0x24,0xE0,0x0C,
+    0x35,0xD2,0x0C,0x24,0xE0,0xFE,0xA8,0xF5,0x01,0xDF,0x33,0x24,0xE0,0x0C,0x35,0xC8,
+    0x0C,0x24,0xE0,0x3B,0x0F,0xDF,0x3B,0x24,0xE0,0x0C,0x35,0xD2,0x0C,0x24,0xDF,0x99,
+    0xC1,0x01,0xE1,0x34,0x24,0xDF,0x0C,0x35,0xC8,0x0C,0x24,0xDF,0x37,0x0F,0xE1,0x37,
+    0x24,0xDF,0x0C,0x35,0xD2,0x0C,0x24,0xDF,0x3F,0x01,0xE1,0x3F,0x24,0xDF,0x0C,0x35,
+    0xC8,0x0C,0x24,0xDF,0x05,0x0F,0xE1,0x05,0x24,0xDF,0x0C,0x35,0xD2,0x0C,0x24,0xDE,
+    0x9C,0xA4,0x01,0xE3,0x26,0x24,0xDE,0x0C,0x35,0xC8,0x0C,0x24,0xDE,0x97,0xAC,0x0F,
+    0xE3,0x27,0x24,0xDE,0x0C,0x35,0xD2,0x0C,0x24,0xDE,0xFE,0x70,0xF6,0x01,0xE3,0x09,
+    0x24,0xDE,0x0C,0x35,0xC8,0x0C,0x24,0xDE,0x13,0x0F,0xE3,0x13,0x24,0xDE,0x0C,0x35,
+    0xC8,0x6E,0xC8,0x0C,0x24,0xDE,0x3F,0x01,0xE3,0x3F,0x24,0xDE,0x0C,0x3A,0xC8,0x0C,
+    0x24,0xDE,0x11,0x0F,0xE3,0x11,0x24,0xDE,0x0C,0x3A,0xD2,0x0C,0x24,0xDE,0xFE,0x44,
+    0xF5,0x01,0xE3,0x08,0x24,0xDE,0x0C,0x3A,0xC8,0x0C,0x24,0xDE,0xFE,0x9B,0x92,0x0F,
+    0xE3,0x17,0x24,0xDE,0x0C,0x3A,0xD2,0x0C,0x24,0xDD,0x9D,0xA6,0x01,0xE5,0x39,0x24,
+    0xDD,0x0C,0x3A,0xC8,0x0C,0x24,0xDD,0x9A,0x9A,0x0F,0xE5,0x39,0x24,0xDD,0x0C,0x3A,
+    0xD2,0x0C,0x24,0xDD,0x9B,0xB4,0x01,0xE5,0x1A,0x24,0xDD,0x0C,0x3A,0xC8,0x0C,0x24,
+    0xDD,0x96,0xAC,0x0F,0xE5,0x22,0x24,0xDD,0x0C,0x3A,0xD2,0x0C,0x24,0xDD,0x9A,0xB3,
+    0x01,0xE5,0x0E,0x24,0xDD,0x0C,0x3A,0xC8,0x0C,0x24,0xDD,0x94,0xAD,0x0F,0xE5,0x15,
+    0x24,0xDD,0x0C,0x3A,0xD2,0x0C,0x24,0xDD,0x0E,0x01,0xE5,0x0E,0x24,0xDD,0x0C,0x3A,
+    0xC8,0x0C,0x24,0xDD,0x15,0x0F,0xE5,0x15,0x24,0xDD,0x0C,0x3A,0xD2,0x0C,0x24,0xDD,
+    0x1A,0x01,0xE5,0x1A,0x24,0xDD,0x0C,0x3A,0xC8,0x0C,0x24,0xDD,0x22,0x0F,0xE5,0x22,
+    0x24,0xDD,0x0C,0x3A,0xC8,0x7A,0xC8,0x0C,0x24,0xDD,0x9D,0xA6,0x01,0xE5,0x39,0x24,
+    0xDD,0x0C,0x3D,0xC8,0x0C,0x24,0xDD,0x9A,0x9A,0x0F,0xE5,0x39,0x24,0xDD,0x0C,0x3D,
+    0xC8,0x6B,0xC8,0x0C,0x24,0xDE,0x08,0x01,0xE3,0x08,0x24,0xDE,0x0C,0x04,0xC8,0x0C,
+    0x24,0xDE,0x17,0x0F,0xE3,0x17,0x24,0xDE,0x0C,0x04,0xD2,0x0C,0x24,0xDE,0x3F,0x01,
+    0xE3,0x3F,0x24,0xDE,0x0C,0x04,0xC8,0x0C,0x24,0xDE,0x11,0x0F,0xE3,0x11,0x24,0xDE,
+    0x0C,0x04,0xD2,0x0C,0x24,0xDE,0x09,0x01,0xE3,0x09,0x24,0xDE,0x0C,0x04,0xC8,0x0C,
+    0x24,0xDE,0x13,0x0F,0xE3,0x13,0x24,0xDE,0x0C,0x04,0xD2,0x0C,0x24,0xDE,0x26,0x01,
+    0xE3,0x26,0x24,0xDE,0x0C,0x04,0xC8,0x0C,0x24,0xDE,0x27,0x0F,0xE3,0x27,0x24,0xDE,
+    0x0C,0x04,0xD2,0x0C,0x24,0xDF,0x3F,0x01,0xE1,0x3F,0x24,0xDF,0x0C,0x04,0xC8,0x0C,
+    0x24,0xDF,0x05,0x0F,0xE1,0x05,0x24,0xDF,0x0C,0x04,0xD2,0x0C,0x24,0xDF,0x34,0x01,
+    0xE1,0x34,0x24,0xDF,0x0C,0x04,0xC8,0x0C,0x24,0xDF,0x37,0x0F,0xE1,0x37,0x24,0xDF,
+    0x0C,0x04,0xD2,0x0C,0x24,0xE0,0x33,0x01,0xDF,0x33,0x24,0xE0,0x0C,0x04,0xC8,0x0C,
+    0x24,0xE0,0x3B,0x0F,0xDF,0x3B,0x24,0xE0,0x0C,0x04,0xC8,0x6E,0xC8,0x0C,0x24,0xE0,
+    0x07,0x01,0xDF,0x07,0x24,0xE0,0x0C,0x09,0xC8,0x0C,0x24,0xE0,0x93,0xBD,0x0F,0xDF,
+    0x09,0x24,0xE0,0x0C,0x83,0x6E,0xD2,0x0C,0x24,0xE1,0x36,0x01,0xDD,0x36,0x24,0xE1,
+    0x0C,0x09,0xC8,0x0C,0x24,0xE1,0xFE,0x9C,0xB4,0x0F,0xDD,0x3A,0x24,0xE1,0x0C,0x09,
+    0xD2,0x0C,0x24,0xE2,0x3F,0x01,0xDB,0x3F,0x24,0xE2,0x0C,0x09,0xC8,0x0C,0x24,0xE2,
+    0x11,0x0F,0xDB,0x11,0x24,0xE2,0x0C,0x09,0xD2,0x0C,0x24,0xE2,0x3E,0x2C,0x01,0xD9,
+    0x2C,0x3E,0x24,0xE2,0x0C,0x09,0xC8,0x0C,0x24,0xE2,0x9B,0xAA,0xFE,0x3B,0x9B,0x0F,
+    0xD9,0x33,0x01,0x24,0xE2,0x0C,0x09,0xD2,0x0C,0x24,0xE3,0x9D,0xA6,0xFE,0xA8,0xF5,
+    0x9D,0xA5,0xD7,0x33,0x39,0x24,0xE3,0x0C,0x09,0xC8,0x0C,0x24,0xE3,0x9A,0x9A,0x3B,
+    0x0F,0xD7,0x3B,0x39,0x24,0xE3,0x0C,0x09,0xD2,0x0C,0x24,0xE4,0x64,0xFE,0x0B,0xF6,
+    0x01,0xD5,0x17,0x11,0x24,0xE4,0x0C,0x09,0xC8,0x0C,0x24,0xE4,0x12,0x23,0x0F,0xD5,
+    0x23,0x12,0x24,0xE4,0x0C,0x09,0xD2,0x0C,0x24,0xE6,0x1C,0x01,0xD3,0x1C,0x24,0xE6,
+    0x0C,0x09,0xC8,0x0C,0x24,0xE6,0x20,0x0F,0xD3,0x20,0x24,0xE6,0x0C,0x09,0xD2,0x0C,
+    0x24,0xE7,0x9D,0xA6,0x31,0x01,0xCF,0x31,0x39,0x24,0xE7,0x0C,0x09,0xC8,0x0C,0x24,
+    0xE7,0x9A,0x9A,0xFE,0x7C,0xB4,0x0F,0xCF,0x35,0x39,0x24,0xE7,0x0C,0x09,0xD2,0x0C,
+    0x24,0xE9,0x9D,0xA6,0x99,0xC1,0x2C,0x01,0xC9,0x2C,0x09,0x39,0x24,0xE9,0x0C,0x83,
+    0x6E,0xC8,0x0C,0x24,0xE9,0x9A,0x9A,0x13,0x92,0xBD,0x0F,0xC9,0x33,0x13,0x39,0x24,
+    0xE9,0x0C,0x09,0xD2,0x0C,0x24,0xEC,0x32,0x34,0x9C,0xA5,0x17,0x3F,0xC1,0x17,0x3D,
+    0x34,0x32,0x24,0xEC,0x0C,0x09,0xC8,0x0C,0x24,0xEC,0x99,0xAB,0x37,0x02,0x23,0x9D,
+    0x9A,0x05,0x11,0x23,0x02,0x37,0x34,0x24,0xEC,0x0C,0x09,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x09,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x09,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,0xD2,0x0C,0x24,0xFF,0x27,
+    0x00,0x0C,0x09,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x09,0xC8,0x6B,0xC8,0x0C,0x24,
+    0xFF,0x27,0x00,0x0C,0x10,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x10,0xD2,0x0C,0x24,
+    0xFF,0x27,0x00,0x0C,0x10,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x10,0xC8,0x6E,0xC8,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xD2,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xD2,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xD2,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xD2,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xD2,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xD2,
+    0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x15,0xC8,0x0C,0x24,0xD2,0x0C,0xFD,0x24,
+    0xD2,0x0C,0x15,0xD2,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x15,0xC8,0x0C,0x24,
+    0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x15,0xD2,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,
+    0x15,0xC8,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x15,0xD2,0x0C,0x24,0xD2,0x0C,
+    0xFD,0x24,0xD2,0x0C,0x15,0xC8,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x15,0xD2,
+    0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x15,0xC8,0x0C,0x24,0xD2,0x0C,0xFD,0x24,
+    0xD2,0x0C,0x15,0xD2,0x0C,0x24,0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x15,0xC8,0x0C,0x24,
+    0xD2,0x0C,0xFD,0x24,0xD2,0x0C,0x15,0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,
+    0x0C,0x24,0xFF,0x27,0x00,0x0C,0x15,0xC8,0x6E,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,
+    0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xD2,0x0C,0x24,0xFF,0x27,0x00,0x0C,
+    0x1A,0xC8,0x0C,0x24,0xFF,0x27,0x00,0x0C,0x1A,0xC8,0x7A,0xC8,0x0C,0x24,0xD7,0x0C,
+    0xF2,0x24,0xD8,0x0C,0x1D,0xC8,0x0C,0x24,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x1D,0xC8,
+    0x6B,0xC8,0x0C,0xA9,0x98,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x85,0x6F,0xC8,0x0C,0xA9,
+    0x98,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x85,0x6F,0xD2,0x0C,0xA9,0x98,0xD7,0x0C,0xF2,
+    0x24,0xD8,0x0C,0x85,0x6F,0xC8,0x0C,0xA9,0x98,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x85,
+    0x6F,0xD2,0x0C,0xA9,0x98,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x85,0x6F,0xC8,0x0C,0xA9,
+    0x98,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x85,0x6F,0xD2,0x0C,0xA9,0x98,0xD7,0x0C,0xF2,
+    0x24,0xD8,0x0C,0x85,0x6F,0xC8,0x0C,0xA9,0x98,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x85,
+    0x6F,0xD2,0x0C,0xA9,0x98,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x85,0x6F,0xC8,0x0C,0xA9,
+    0x98,0xD7,0x0C,0xF2,0x24,0xD8,0x0C,0x85,0x6F,0xD2,0x0C,0xA9,0x98,0xFF,0x27,0x00,
+    0x0C,0x85,0x6F,0xC8,0x0C,0xA9,0x98,0xFF,0x27,0x00,0x0C,0x85,0x6F,0xD2,0x0C,0xA9,
+    0x98,0xFF,0x27,0x00,0x0C,0x85,0x6F,0xC8,0x0C,0xA9,0x98,0xFF,0x27,0x00,0x0C,0x85,
+    0x6F,0xD2,0x0C,0xA9,0x98,0xFF,0x27,0x00,0x0C,0x85,0x6F,0xC8,0x0C,0xA9,0x98,0xFF,
+    0x27,0x00,0x0C,0x85,0x6F,0xD2,0x0C,0xA9,0x98,0xFF,0x27,0x00,0x0C,0x85,0x6F,0xC8,
+    0x0C,0xA9,0x98,0xFF,0x27,0x00,0x0C,0x85,0x6F,0xD2,0x0C,0xA9,0x98,0xFF,0x27,0x00,
+    0x0C,0x85,0x6F,0xC8,0x0C,0xA9,0x98,0xFF,0x27,0x00,0x0C,0x85,0x6F,0xD2,0x0C,0xFF,
+    0x29,0x00,0x24,0xC8,0x0C,0xFF,0x29,0x00,0x24,0xFF,0xBA,0x00,0x6E,0xFF,0x40,0x07,
+    0x6B,0xFF,0xB0,0x00,
+};
+
+/* 由 host_qoic 生成，请勿手动修改
+ * 图片: 内置图标测试图，83x83，QOI565 832 字节（RGB565 13778 字节） */
+
+const uint32_t Image_Icon0_83x83_q565_size = 832;
+
+__attribute__((aligned(4))) const uint8_t Image_Icon0_83x83_q565[832] = {
+    0x51,0x35,0x36,0x35,0x53,0x00,0x53,0x00,0x34,0x03,0x00,0x00,0xA9,0x8A,0xFF,0x73,
+    0x00,0xA5,0x6A,0xA7,0x6C,0xA6,0x6A,0xA4,0x79,0xA3,0x79,0x6F,0xED,0x3C,0x1F,0x33,
+    0x2F,0x18,0x23,0xD6,0xAA,0x4C,0xAB,0x4C,0x08,0xF7,0x10,0x17,0x23,0xD2,0xA8,0x5B,
+    0xAD,0x3E,0xA4,0x79,0xFB,0x17,0x3F,0x23,0xCF,0xAE,0x2D,0x03,0xFF,0x01,0x00,0x00,
+    0x23,0xCD,0xB1,0x2F,0x03,0xFF,0x03,0x00,0x27,0x23,0xCB,0x27,0x03,0xFF,0x05,0x00,
+    0x27,0x23,0xC9,0x00,0x03,0xFF,0x07,0x00,0x00,0x23,0xC7,0x3F,0x03,0xFF,0x09,0x00,
+    0x3F,0x23,0xC6,0x10,0x03,0xFF,0x09,0x00,0x10,0x23,0xC5,0xAA,0x4C,0x03,0xFF,0x0B,
+    0x00,0x17,0x23,0xC4,0xB4,0x0F,0x3C,0xFF,0x0B,0x00,0x04,0x23,0xC3,0x18,0xFE,0x3B,
+    0x3C,0xFF,0x0D,0x00,0x18,0x23,0xC2,0xAC,0x3C,0x37,0xFF,0x0D,0x00,0x28,0x23,0xC2,
+    0x27,0x37,0xFF,0x0D,0x00,0x27,0x23,0xC2,0x10,0x37,0xFF,0x0D,0x00,0x10,0x23,0xC2,
+    0xFE,0x1A,0x3C,0x37,0xFF,0x0D,0x00,0x2B,0x23,0xC2,0x37,0xFF,0x0F,0x00,0x23,0xC2,
+    0x37,0xFF,0x0F,0x00,0x23,0xC2,0x37,0xFF,0x0F,0x00,0x23,0xC2,0x37,0xFF,0x0F,0x00,
+    0x23,0xC2,0xFE,0x1B,0x3C,0xFF,0x0F,0x00,0x23,0xC2,0x32,0xFF,0x0F,0x00,0x23,0xC2,
+    0x2B,0xE4,0xA3,0x88,0x7A,0x04,0x2B,0xE4,0x23,0xC2,0xFE,0x1A,0x34,0xDF,0x2B,0xAB,
+    0xB5,0xA8,0xB5,0xA7,0xA7,0xA5,0xA6,0xC3,0x0C,0x99,0x7A,0x08,0x2B,0x28,0xDF,0x23,
+    0xC2,0x28,0xDD,0x07,0xAE,0xC3,0xAD,0xC4,0x31,0xC9,0x29,0x3C,0x07,0x28,0xDD,0x23,
+    0xC2,0x28,0xDC,0xAE,0xD4,0x31,0xCF,0x27,0x28,0xDC,0x23,0xC2,0x28,0xDA,0xA2,0x97,
+    0xB4,0xE2,0x31,0xD1,0x28,0x38,0x42,0xDA,0x23,0xC2,0x28,0xD9,0xA4,0xA7,0xB6,0xE0,
+    0x31,0xD3,0x05,0x0F,0x28,0xD9,0x23,0xC2,0x28,0xD8,0x38,0x05,0x31,0xD5,0x05,0x38,
+    0x28,0xD8,0x23,0xC2,0x28,0xD8,0xB6,0xF1,0x31,0xD7,0x28,0x8A,0x1F,0xD8,0x23,0xC2,
+    0xFE,0xFA,0x33,0xD7,0xAF,0xD3,0x31,0xD9,0x20,0x23,0xD7,0xFE,0x26,0x21,0xC2,0xFE,
+    0xFA,0x33,0xD6,0xA4,0x96,0x31,0xDB,0x00,0x23,0xD6,0xFE,0x26,0x21,0xC2,0xFE,0xFA,
+    0x33,0xD6,0x3C,0x31,0xDB,0x3C,0x23,0xD6,0xFE,0x26,0x21,0xC2,0xFE,0xF9,0x33,0xD5,
+    0x2B,0x29,0x31,0xDB,0x29,0x2B,0x1C,0xD5,0x23,0xC2,0x1C,0xD5,0xAB,0xC5,0x31,0xDD,
+    0x3C,0x1C,0xD5,0x23,0xC2,0x1C,0xD5,0x0C,0x31,0xDD,0x0C,0x1C,0xD5,0x23,0xC2,0x1C,
+    0xD5,0x05,0x31,0xDD,0x05,0x1C,0xD5,0x23,0xC2,0x1C,0xD5,0x31,0xDF,0x1C,0xD5,0x23,
+    0xC2,0x1C,0xD4,0xA2,0x98,0x31,0xDF,0x33,0x1C,0xD4,0x23,0xC2,0xFE,0xD9,0x33,0xD4,
+    0xA4,0x97,0x31,0xDF,0x3B,0x17,0xD4,0x23,0xC2,0x17,0xD4,0xA3,0x97,0x31,0xDF,0x2C,
+    0x17,0xD4,0x23,0xC2,0x17,0xD5,0x31,0xDF,0x17,0xD5,0x23,0xC2,0x17,0xD5,0xFE,0x3E,
+    0xDF,0x31,0xDD,0x00,0x17,0xD5,0x23,0xC2,0x17,0xD5,0xB4,0xD2,0x31,0xDD,0x04,0x17,
+    0xD5,0x23,0xC2,0x17,0xD5,0xAB,0xC5,0x31,0xDD,0x37,0x17,0xD5,0x23,0xC2,0x10,0xD5,
+    0x17,0x29,0x31,0xDB,0x29,0x17,0x10,0xD5,0x23,0xC2,0x10,0xD6,0xB2,0xD3,0x31,0xDB,
+    0x30,0x10,0xD6,0x23,0xC2,0x10,0xD6,0x2C,0x31,0xDB,0x2C,0x10,0xD6,0x23,0xC2,0x10,
+    0xD7,0xAF,0xD4,0x31,0xD9,0x14,0x10,0xD7,0x23,0xC2,0xFE,0xB8,0x33,0xD8,0xB8,0xE1,
+    0x31,0xD7,0x1C,0x0B,0xD8,0x23,0xC2,0x0B,0xD8,0xA3,0x97,0x00,0x31,0xD5,0x00,0x20,
+    0x0B,0xD8,0x23,0xC2,0x0B,0xD9,0xA5,0x97,0x00,0x31,0xD3,0x00,0x34,0x0B,0xD9,0x23,
+    0xC2,0x0B,0xDA,0x20,0x1C,0x31,0xD1,0x1C,0x20,0x0B,0xDA,0x23,0xC2,0x0B,0xDC,0x14,
+    0x31,0xCF,0x14,0x0B,0xDC,0x23,0xC2,0x0B,0xDD,0x20,0x30,0xAD,0xC5,0x31,0xC9,0x24,
+    0x30,0x20,0x0B,0xDD,0x23,0xC2,0x0B,0xE0,0xAB,0xB5,0xAA,0xA5,0x00,0x31,0xC3,0x00,
+    0x3D,0x28,0x0B,0xE0,0x23,0xC2,0xB4,0x0F,0xE4,0xA2,0x98,0x20,0x1B,0x04,0xE4,0x23,
+    0xC2,0x04,0xFF,0x0F,0x00,0x23,0xC2,0xFE,0x97,0x33,0xFF,0x0F,0x00,0x23,0xC2,0x3F,
+    0xFF,0x0F,0x00,0x23,0xC2,0x3F,0xFF,0x0F,0x00,0x23,0xC2,0x3F,0xFF,0x0F,0x00,0x23,
+    0xC2,0x3F,0xFF,0x0F,0x00,0x23,0xC2,0xB2,0x1F,0x3F,0xFF,0x0D,0x00,0x33,0x23,0xC2,
+    0xB0,0x1E,0x3F,0xFF,0x0D,0x00,0x18,0x23,0xC2,0xAD,0x3E,0x3F,0xFF,0x0D,0x00,0x3B,
+    0x23,0xC2,0xA9,0x5C,0x3F,0xFF,0x0D,0x00,0x0B,0x23,0xC2,0xA4,0x69,0xAE,0x2E,0xFF,
+    0x0D,0x00,0x0C,0x23,0xC3,0xAF,0x2E,0x30,0xFF,0x0B,0x00,0x0C,0x23,0xC4,0xA7,0x5C,
+    0x30,0xFF,0x0B,0x00,0x37,0x23,0xC5,0xAF,0x2F,0x30,0xFF,0x09,0x00,0x13,0x23,0xC6,
+    0xA5,0x6B,0x30,0xFF,0x09,0x00,0x1F,0x23,0xC7,0xAA,0x4C,0x30,0xFF,0x07,0x00,0x17,
+    0x23,0xC9,0x2F,0x30,0xFF,0x05,0x00,0x2F,0x23,0xCB,0x2F,0x30,0xFF,0x03,0x00,0x2F,
+    0x23,0xCD,0x17,0x30,0xFF,0x01,0x00,0x17,0x23,0xCF,0x1F,0x0C,0x30,0xFB,0x0C,0x1F,
+    0x23,0xD2,0xA7,0x5B,0xA7,0x6C,0xA3,0x7A,0xF7,0x07,0x30,0x23,0xD6,0xA3,0x7A,0xA5,
+    0x6A,0x2F,0x0C,0xA2,0x79,0x2B,0xED,0x24,0x0C,0x2F,0x3C,0x07,0x23,0xFF,0x73,0x00,
+};
+
+/* 由 host_qoic 生成，请勿手动修改
+ * 图片: 内置图标测试图，83x83，QOI565 1130 字节（RGB565 13778 字节） */
+
+const uint32_t Image_Icon1_83x83_q565_size = 1130;
+
+__attribute__((aligned(4))) const uint8_t Image_Icon1_83x83_q565[1130] = {
+    0x51,0x35,0x36,0x35,0x53,0x00,0x53,0x00,0x5E,0x04,0x00,0x00,0xA9,0x8A,0xFF,0x73,
+    0x00,0xA2,0xC7,0xA2,0xE7,0xA2,0xC8,0xA2,0xB7,0xA1,0xA8,0x7A,0xED,0x1C,0x11,0x3B,
+    0x1B,0x3C,0x23,0xD6,0xFE,0x86,0x71,0xFE,0x07,0xC2,0x1F,0xF7,0x09,0x10,0x23,0xD2,
+    0xA3,0xE7,0x09,0x1F,0xFB,0x09,0x07,0x23,0xCF,0xFE,0xC6,0x89,0x1F,0xFF,0x01,0x00,
+    0x23,0xFE,0x26,0x21,0xCD,0xFE,0xE6,0xA1,0x1F,0xFF,0x03,0x00,0x31,0x23,0xCB,0x31,
+    0x1F,0xFF,0x05,0x00,0x31,0x23,0xC9,0xFE,0xC6,0x89,0x1F,0xFF,0x07,0x00,0x23,0xFE,
+    0x26,0x21,0xC7,0xA2,0xE7,0x1F,0xFF,0x09,0x00,0x02,0x23,0xC6,0x09,0x1F,0xFF,0x09,
+    0x00,0x09,0x23,0xC5,0xFE,0x86,0x69,0xFE,0x27,0xE2,0xFF,0x0B,0x00,0x0D,0x23,0xC4,
+    0xFE,0x07,0xBA,0xA1,0xC8,0xFF,0x0B,0x00,0x06,0x23,0xC3,0xA1,0xD8,0x17,0xFF,0x0D,
+    0x00,0x37,0x23,0xC2,0xFE,0xA6,0x79,0x17,0xFF,0x0D,0x00,0x18,0x23,0xC2,0x31,0x17,
+    0xFF,0x0D,0x00,0x31,0x23,0xC2,0x09,0x17,0xFF,0x0D,0x00,0x09,0x23,0xC2,0xFE,0x27,
+    0xD2,0x17,0xFF,0x0D,0x00,0x14,0x23,0xC2,0x17,0xFF,0x0F,0x00,0x23,0xC2,0x17,0xFF,
+    0x0F,0x00,0x23,0xC2,0x17,0xE2,0xA2,0x77,0xA5,0x79,0xA3,0x79,0xA2,0x78,0x2F,0x12,
+    0x21,0x17,0xE2,0x23,0xC2,0x17,0xDE,0xA3,0x78,0xAE,0x29,0xAC,0x48,0xAB,0x49,0xA6,
+    0x58,0xC5,0x3E,0x1A,0x2E,0x2D,0x17,0xDE,0x23,0xC2,0x17,0xDC,0x2F,0x1A,0x31,0xCD,
+    0x1A,0x2F,0x17,0xDC,0x23,0xC2,0x17,0xDA,0xA7,0x58,0xFE,0x17,0xF6,0x31,0xD1,0x2B,
+    0x0F,0x17,0xDA,0x23,0xC2,0x14,0xD9,0xB4,0x19,0x31,0xD5,0x0E,0x14,0xD9,0x23,0xC2,
+    0xFE,0x26,0xD2,0xD8,0x1A,0x31,0xD7,0x1A,0x0D,0xD8,0x23,0xC2,0x0D,0xD6,0x6F,0xFE,
+    0x79,0xF6,0x31,0xD9,0x08,0x19,0x0D,0xD6,0x23,0xC2,0x0D,0xD6,0x08,0x31,0xCA,0x98,
+    0xC8,0x9B,0xB8,0x2B,0x3F,0x2D,0x31,0xCA,0x08,0x0D,0xD6,0x23,0xC2,0x0D,0xD5,0xFE,
+    0xD6,0xED,0x31,0xC8,0xFE,0xB6,0xF5,0x91,0xF8,0x95,0xE7,0x66,0xC3,0x27,0x0F,0x15,
+    0x31,0xC8,0x17,0x0D,0xD5,0x23,0xC2,0xFE,0x06,0xD2,0xD4,0xB5,0x09,0x31,0xC7,0xFE,
+    0x75,0xF5,0xFE,0xC9,0xEA,0x22,0xC9,0x04,0xFE,0x75,0xF5,0x31,0xC7,0xFE,0xB1,0xE4,
+    0x08,0xD4,0x23,0xC2,0x08,0xD3,0xA8,0x58,0x31,0xC6,0x9B,0xB8,0xFE,0xCE,0xEB,0x22,
+    0xCD,0x0F,0x03,0x31,0xC6,0xFE,0x0A,0xDB,0x08,0xD3,0x23,0xC2,0x08,0xD3,0xFE,0xF7,
+    0xF5,0x31,0xC5,0x2D,0xFE,0x0A,0xEB,0x22,0xCF,0x15,0x2D,0x31,0xC5,0x26,0x08,0xD3,
+    0x23,0xC2,0x08,0xD2,0xAB,0x49,0x31,0xC5,0x03,0x15,0x22,0xD1,0x15,0x03,0x31,0xC5,
+    0x2C,0x08,0xD2,0x23,0xC2,0x08,0xD2,0x17,0x31,0xC5,0xFE,0xCE,0xEB,0x22,0xD3,0x0F,
+    0x31,0xC5,0x17,0x08,0xD2,0x23,0xC2,0x08,0xD1,0xA3,0x79,0x31,0xC5,0xFE,0x75,0xF5,
+    0x22,0xD5,0x04,0x31,0xC5,0x25,0x08,0xD1,0x23,0xC2,0xFE,0x06,0xCA,0xD1,0x2E,0x31,
+    0xC5,0xFE,0xC9,0xEA,0x22,0xD5,0x04,0x31,0xC5,0x2E,0x05,0xD1,0x23,0xC2,0x05,0xD1,
+    0x17,0x31,0xC4,0xFE,0xB6,0xF5,0x22,0xD7,0x15,0x31,0xC4,0x17,0x05,0xD1,0x23,0xC2,
+    0x05,0xD1,0xFE,0x1C,0xFF,0x31,0xC4,0x0F,0x22,0xD7,0x0F,0x31,0xC4,0x39,0x05,0xD1,
+    0x23,0xC2,0x05,0xD0,0xA2,0x78,0x31,0xC5,0x27,0x22,0xD7,0x27,0x31,0xC5,0x16,0x05,
+    0xD0,0x23,0xC2,0x05,0xD0,0xA7,0x69,0x31,0xC4,0x2D,0x22,0xD9,0x2D,0x31,0xC4,0x07,
+    0x05,0xD0,0x23,0xC2,0x05,0xD0,0x2C,0x31,0xC4,0x3F,0x22,0xD9,0x3F,0x31,0xC4,0x2C,
+    0x05,0xD0,0x23,0xC2,0x05,0xD0,0xAC,0x49,0x31,0xC4,0x2B,0x22,0xD9,0x2B,0x31,0xC4,
+    0x38,0x05,0xD0,0x23,0xC2,0x05,0xD0,0xAB,0x49,0x31,0xC4,0x3F,0x22,0xD9,0x3F,0x31,
+    0xC4,0x29,0x05,0xD0,0x23,0xC2,0x05,0xD0,0x07,0x31,0xC4,0x2D,0x22,0xD9,0x2D,0x31,
+    0xC4,0x07,0x05,0xD0,0x23,0xC2,0x05,0xD0,0x11,0x31,0xC5,0x27,0x22,0xD7,0x27,0x31,
+    0xC5,0x11,0x05,0xD0,0x23,0xC2,0x05,0xD1,0xFE,0x1C,0xF7,0x31,0xC4,0x0F,0x22,0xD7,
+    0x0F,0x31,0xC4,0x36,0x05,0xD1,0x23,0xC2,0x05,0xD1,0x17,0x31,0xC4,0x15,0x22,0xD7,
+    0x15,0x31,0xC4,0x17,0x05,0xD1,0x23,0xC2,0xFE,0xE6,0xC1,0xD1,0xB2,0x28,0x31,0xC5,
+    0x04,0x22,0xD5,0x04,0x31,0xC5,0x1F,0x3D,0xD1,0x23,0xC2,0x3D,0xD1,0x16,0x31,0xC5,
+    0xFE,0x75,0xF5,0x22,0xD5,0x04,0x31,0xC5,0x16,0x3D,0xD1,0x23,0xC2,0x3D,0xD2,0x17,
+    0x31,0xC5,0x0F,0x22,0xD3,0x0F,0x31,0xC5,0x17,0x3D,0xD2,0x23,0xC2,0x3D,0xD2,0xAB,
+    0x59,0x31,0xC5,0x03,0xFE,0x0A,0xEB,0x22,0xD1,0x15,0x03,0x31,0xC5,0x24,0x3D,0xD2,
+    0x23,0xC2,0x3D,0xD3,0xFE,0xF7,0xED,0x31,0xC5,0x2D,0x15,0x22,0xCF,0x15,0x2D,0x31,
+    0xC5,0x23,0x3D,0xD3,0xFE,0x26,0x21,0xC2,0x3D,0xD3,0xA8,0x58,0x31,0xC6,0x03,0x0F,
+    0x22,0xCD,0x0F,0x03,0x31,0xC6,0x04,0x3D,0xD3,0x23,0xC2,0x3D,0xD4,0xB5,0x19,0x31,
+    0xC7,0xFE,0x75,0xF5,0xFE,0xC9,0xEA,0x22,0xC9,0x04,0xFE,0x75,0xF5,0x31,0xC7,0x3C,
+    0x3D,0xD4,0x23,0xC2,0x3D,0xD5,0x17,0x31,0xC8,0xFE,0xB6,0xF5,0x0F,0x27,0x22,0xC3,
+    0x27,0x0F,0x15,0x31,0xC8,0x17,0x3D,0xD5,0x23,0xC2,0x3D,0xD6,0xFE,0x59,0xEE,0x31,
+    0xCA,0x2D,0x3F,0x2B,0x3F,0x2D,0x31,0xCA,0x00,0x3D,0xD6,0x23,0xC2,0x3D,0xD6,0xA2,
+    0x78,0x00,0x31,0xD9,0x00,0x0E,0x3D,0xD6,0x23,0xC2,0x3D,0xD8,0x17,0x31,0xD7,0x17,
+    0x3D,0xD8,0x23,0xC2,0xFE,0xE6,0xB9,0xD9,0x3C,0x31,0xD5,0x3C,0x3A,0xD9,0x23,0xC2,
+    0x3A,0xDA,0xA7,0x79,0xB9,0x09,0x31,0xD1,0x23,0x3F,0x3A,0xDA,0xFE,0x26,0x21,0xC2,
+    0x3A,0xDC,0xAB,0x59,0xB4,0x18,0x31,0xCD,0x14,0x21,0x3A,0xDC,0x23,0xC2,0x3A,0xDE,
+    0xA3,0x88,0xAF,0x39,0x14,0x36,0x31,0xC5,0x36,0x14,0x1C,0x13,0x3A,0xDE,0x23,0xC2,
+    0x3A,0xE2,0x06,0xA6,0x68,0x21,0x6E,0x21,0x3C,0x06,0x3A,0xE2,0x23,0xC2,0x3A,0xFF,
+    0x0F,0x00,0x23,0xC2,0x3A,0xFF,0x0F,0x00,0x23,0xC2,0xFE,0xC6,0xB1,0x7A,0xFF,0x0D,
+    0x00,0x32,0x23,0xC2,0xFE,0xC6,0xA1,0x35,0xFF,0x0D,0x00,0x2C,0x23,0xC2,0xFE,0xA6,
+    0x89,0x35,0xFF,0x0D,0x00,0x1E,0x23,0xC2,0xFE,0x66,0x69,0x35,0xFF,0x0D,0x00,0x08,
+    0x23,0xC2,0xA1,0xC8,0xFE,0xC5,0xB1,0xFF,0x0D,0x00,0x34,0x23,0xC3,0xFE,0xA5,0x99,
+    0x2B,0xFF,0x0B,0x00,0x1D,0x23,0xC4,0x02,0x2B,0xFF,0x0B,0x00,0x02,0x23,0xC5,0x1D,
+    0x2B,0xFF,0x09,0x00,0x1D,0x23,0xC6,0x37,0x2B,0xFF,0x09,0x00,0x37,0x23,0xC7,0xFE,
+    0x85,0x71,0x2B,0xFF,0x07,0x00,0x09,0x23,0xC9,0xFE,0x85,0x81,0x2B,0xFF,0x05,0x00,
+    0x0F,0x23,0xCB,0x0F,0x2B,0xFF,0x03,0x00,0x0F,0x23,0xCD,0x09,0x2B,0xFF,0x01,0x00,
+    0x09,0x23,0xCF,0xA1,0xD7,0x1D,0x2B,0xFB,0x1D,0x30,0x23,0xD2,0xA2,0xE6,0xA2,0xE7,
+    0x2B,0xF7,0x1A,0x3B,0x23,0xD6,0xA1,0xB7,0xA1,0xD8,0x0F,0x1D,0xA0,0xA8,0x2B,0xED,
+    0x23,0x1D,0x0F,0x3E,0x2A,0x9F,0x6A,0xFF,0x73,0x00,
+};
+
+/* 由 host_qoic 生成，请勿手动修改
+ * 图片: 内置图标测试图，83x83，QOI565 903 字节（RGB565 13778 字节） */
+
+const uint32_t Image_Icon2_83x83_q565_size = 903;
+
+__attribute__((aligned(4))) const uint8_t Image_Icon2_83x83_q565[903] = {
+    0x51,0x35,0x36,0x35,0x53,0x00,0x53,0x00,0x7B,0x03,0x00,0x00,0xA9,0x8A,0xFF,0x73,
+    0x00,0xA7,0x56,0xAA,0x35,0xA8,0x56,0xA6,0x56,0xA4,0x67,0x6E,0xED,0x06,0x2B,0x9A,
+    0xBA,0x0D,0x96,0xDB,0x23,0xD6,0xAF,0x14,0xAE,0x23,0x0B,0xF7,0x1A,0x03,0x23,0xD2,
+    0xAB,0x35,0xB3,0x03,0x0B,0xFB,0x26,0x28,0x23,0xCF,0xFE,0xAA,0x23,0x0B,0xFF,0x01,
+    0x00,0x23,0xFE,0x26,0x21,0xCD,0xFE,0x2A,0x2C,0x0B,0xFF,0x03,0x00,0x3A,0x23,0xCB,
+    0x3A,0x0B,0xFF,0x05,0x00,0x3A,0x23,0xC9,0xFE,0xA9,0x23,0xAF,0x25,0xFF,0x07,0x00,
+    0x1C,0x23,0xC7,0x28,0x06,0xFF,0x09,0x00,0x28,0x23,0xC6,0x1A,0x06,0xFF,0x09,0x00,
+    0x1A,0x23,0xC5,0xAE,0x13,0xFE,0x8C,0x2D,0xFF,0x0B,0x00,0x37,0x23,0xC4,0xFE,0xAB,
+    0x2C,0x3F,0xFF,0x0B,0x00,0x15,0x23,0xC3,0x0D,0x3F,0xFF,0x0D,0x00,0x0D,0x23,0xC2,
+    0xB1,0x03,0x3F,0xFF,0x0D,0x00,0x0D,0x23,0xC2,0x3A,0xAA,0x35,0xFF,0x0D,0x00,0x96,
+    0xDB,0x23,0xC2,0xFE,0xEB,0x2C,0xA4,0x67,0xFF,0x0D,0x00,0x1F,0x23,0xC2,0xFE,0x4C,
+    0x2D,0x3A,0xFF,0x0D,0x00,0x35,0x23,0xC2,0x3A,0xFF,0x0F,0x00,0x23,0xC2,0x3A,0xFF,
+    0x0F,0x00,0x23,0xC2,0x3A,0xFF,0x0F,0x00,0x23,0xC2,0x3A,0xFF,0x0F,0x00,0x23,0xC2,
+    0x3A,0xFF,0x0F,0x00,0x23,0xC2,0x35,0xFF,0x0F,0x00,0x23,0xC2,0x35,0xFF,0x0F,0x00,
+    0x23,0xC2,0x35,0xFF,0x0F,0x00,0x23,0xC2,0x35,0xFF,0x0F,0x00,0x23,0xC2,0x35,0xFF,
+    0x0F,0x00,0x23,0xC2,0x35,0xFF,0x0F,0x00,0x23,0xC2,0x35,0xFF,0x0F,0x00,0x23,0xC2,
+    0xFE,0x2C,0x2D,0xFF,0x0F,0x00,0x23,0xC2,0x30,0xFF,0x0F,0x00,0x23,0xC2,0x30,0xFF,
+    0x0F,0x00,0x23,0xC2,0x30,0xFF,0x0F,0x00,0x23,0xC2,0x30,0xFF,0x0F,0x00,0x23,0xC2,
+    0x30,0xD3,0xA6,0xCA,0xA3,0xBA,0x59,0x9C,0x67,0x30,0xCA,0xA2,0x99,0xA5,0xDA,0x36,
+    0x18,0x0E,0x30,0xCA,0x37,0x2C,0x36,0x06,0x30,0xD3,0x23,0xC2,0xFE,0x2B,0x2D,0xD1,
+    0xA8,0xEC,0xAC,0xFC,0xA2,0xA9,0xC2,0x9C,0x56,0x06,0x29,0xC6,0x30,0xFE,0xD7,0xAE,
+    0x31,0xC3,0x2E,0x30,0x29,0xC6,0x06,0x32,0x31,0xC2,0x10,0x27,0x29,0xD1,0x23,0xC2,
+    0xFE,0x0B,0x2D,0xD0,0xFE,0x75,0x96,0x31,0xC6,0x18,0x24,0xC4,0x30,0xFE,0x5B,0xCF,
+    0x31,0xC5,0x2A,0x30,0x24,0xC4,0x18,0x31,0xC6,0x08,0x24,0xD0,0x23,0xC2,0x24,0xCF,
+    0x37,0x31,0xC7,0x55,0xFE,0x4D,0x3D,0x24,0xC3,0x2E,0x31,0xC7,0x2E,0x24,0xC3,0x02,
+    0x22,0x31,0xC7,0x37,0x24,0xCF,0x23,0xC2,0x24,0xCF,0xFE,0x19,0xBF,0x31,0xC8,0x08,
+    0x24,0xC2,0xA3,0x99,0x31,0xC9,0x07,0x24,0xC2,0x08,0x31,0xC8,0x0C,0x24,0xCF,0x23,
+    0xC2,0x24,0xCF,0x22,0x31,0xC8,0x9A,0x46,0x24,0xC2,0x18,0x31,0xC9,0x18,0x24,0xC2,
+    0x1B,0x31,0xC8,0x22,0x24,0xCF,0x23,0xC2,0x24,0xCE,0x30,0x31,0xC9,0x9C,0x67,0x24,
+    0xC2,0x36,0x31,0xC9,0x36,0x24,0xC2,0x3C,0x31,0xC9,0x30,0x24,0xCE,0x23,0xC2,0x24,
+    0xCF,0x22,0x31,0xC8,0x1B,0x24,0xC2,0x18,0x31,0xC9,0x18,0x24,0xC2,0x1B,0x31,0xC8,
+    0x22,0x24,0xCF,0x23,0xC2,0x24,0xCF,0x0C,0x31,0xC8,0x08,0x24,0xC2,0x02,0x31,0xC9,
+    0x02,0x24,0xC2,0x08,0x31,0xC8,0x0C,0x24,0xCF,0x23,0xC2,0x1F,0xCF,0xA6,0xBA,0x31,
+    0xC7,0x22,0xFE,0x2D,0x3D,0x1F,0xC3,0x2E,0x31,0xC7,0x2E,0x1F,0xC3,0x3D,0x22,0x31,
+    0xC7,0x32,0x1F,0xCF,0x23,0xC2,0x1F,0xD0,0x08,0x31,0xC6,0xFE,0xF2,0x75,0x1F,0xC4,
+    0x2B,0x2A,0x31,0xC5,0x2A,0x2B,0x1F,0xC4,0x13,0x31,0xC6,0x08,0x1F,0xD0,0x23,0xC2,
+    0x1F,0xD1,0xA9,0xEC,0x10,0x31,0xC2,0x9B,0x67,0x94,0x04,0x1F,0xC6,0x2B,0x2E,0x31,
+    0xC3,0x2E,0x2B,0x1F,0xC6,0x01,0x2D,0x31,0xC2,0x10,0x22,0x1F,0xD1,0x23,0xC2,0xFE,
+    0xEB,0x24,0xD3,0x01,0xA3,0xBA,0x27,0x9B,0x68,0x1C,0xCA,0x02,0x18,0x36,0x18,0x02,
+    0x1C,0xCA,0x2A,0x27,0x31,0x01,0x1C,0xD3,0x23,0xC2,0x1C,0xFF,0x0F,0x00,0x23,0xC2,
+    0x1C,0xFF,0x0F,0x00,0x23,0xC2,0x1C,0xFF,0x0F,0x00,0x23,0xC2,0xFE,0xCB,0x24,0xFF,
+    0x0F,0x00,0x23,0xC2,0x17,0xFF,0x0F,0x00,0x23,0xC2,0x17,0xFF,0x0F,0x00,0x23,0xC2,
+    0x17,0xFF,0x0F,0x00,0x23,0xC2,0x17,0xFF,0x0F,0x00,0x23,0xC2,0x17,0xFF,0x0F,0x00,
+    0x23,0xC2,0x17,0xFF,0x0F,0x00,0x23,0xC2,0x17,0xFF,0x0F,0x00,0x23,0xC2,0xFE,0xAB,
+    0x24,0xFF,0x0F,0x00,0x23,0xC2,0x12,0xFF,0x0F,0x00,0x23,0xC2,0xFE,0xAA,0x24,0xFF,
+    0x0F,0x00,0x23,0xC2,0x0B,0xFF,0x0F,0x00,0x23,0xC2,0x0B,0xFF,0x0F,0x00,0x23,0xC2,
+    0x0B,0xFF,0x0F,0x00,0x23,0xC2,0xFE,0x8A,0x24,0x0B,0xFF,0x0D,0x00,0x06,0x23,0xC2,
+    0xFE,0x2A,0x24,0x06,0xFF,0x0D,0x00,0x37,0x23,0xC2,0xFE,0x89,0x23,0x06,0xFF,0x0D,
+    0x00,0x17,0x23,0xC2,0xAD,0x24,0x06,0xFF,0x0D,0x00,0x32,0x23,0xC2,0xA5,0x67,0x06,
+    0xFF,0x0D,0x00,0x03,0x23,0xC3,0xFE,0xE9,0x23,0x06,0xFF,0x0B,0x00,0x26,0x23,0xC4,
+    0xAB,0x34,0x06,0xFF,0x0B,0x00,0x21,0x23,0xC5,0x26,0x06,0xFF,0x09,0x00,0x26,0x23,
+    0xC6,0xA8,0x45,0xFE,0x6A,0x24,0xFF,0x09,0x00,0x12,0x23,0xC7,0xAF,0x13,0x01,0xFF,
+    0x07,0x00,0x3C,0x23,0xC9,0xFE,0x69,0x23,0x01,0xFF,0x05,0x00,0x12,0x23,0xCB,0xFE,
+    0x68,0x23,0x01,0xFF,0x03,0x00,0x0B,0x23,0xCD,0xAE,0x13,0x01,0xFF,0x01,0x00,0x37,
+    0x23,0xCF,0xA8,0x45,0x26,0x01,0xFB,0x26,0x12,0x23,0xD2,0xAA,0x34,0xAB,0x35,0x01,
+    0xF7,0x21,0x1C,0x23,0xD6,0xA5,0x66,0xA7,0x57,0x0B,0x26,0xA3,0x78,0xEF,0x26,0x0B,
+    0x2D,0x99,0xCA,0x23,0xFF,0x73,0x00,
+};
+
+/* 由 host_qoic 生成，请勿手动修改
+ * 图片: 内置图标测试图，83x83，QOI565 850 字节（RGB565 13778 字节） */
+
+const uint32_t Image_Icon3_83x83_q565_size = 850;
+
+__attribute__((aligned(4))) const uint8_t Image_Icon3_83x83_q565[850] = {
+    0x51,0x35,0x36,0x35,0x53,0x00,0x53,0x00,0x46,0x03,0x00,0x00,0xA9,0x8A,0xFF,0x73,
+    0x00,0xA7,0xA4,0xA9,0xB3,0xA7,0xB5,0xA5,0xA5,0xA3,0xA7,0xA2,0x87,0xED,0x34,0x1C,
+    0x3E,0x09,0x0E,0x23,0xD6,0xAD,0xC1,0xAD,0xD0,0xA6,0x95,0xF7,0x0F,0x3B,0x23,0xD2,
+    0xAA,0xB2,0xFE,0x83,0xCC,0x39,0xFB,0x14,0x26,0x23,0xCF,0xFE,0x64,0x93,0x39,0xFF,
+    0x01,0x00,0x19,0x23,0xCD,0xFE,0xE4,0xAB,0x39,0xFF,0x03,0x00,0x36,0x23,0xCB,0x36,
+    0x39,0xFF,0x05,0x00,0x36,0x23,0xC9,0x19,0x39,0xFF,0x07,0x00,0x19,0x23,0xC7,0x26,
+    0x39,0xFF,0x09,0x00,0x26,0x23,0xC6,0x0F,0x39,0xFF,0x09,0x00,0x0F,0x23,0xC5,0xAD,
+    0xC0,0xFE,0x03,0xED,0xFF,0x0B,0x00,0xFE,0xC4,0x72,0x23,0xC4,0xFE,0x43,0xC4,0xA6,
+    0xA5,0xFF,0x0B,0x00,0x07,0x23,0xC3,0xA6,0xA4,0x34,0xFF,0x0D,0x00,0x09,0x23,0xC2,
+    0xFE,0x04,0x83,0xFE,0x03,0xE5,0xFF,0x0D,0x00,0x04,0x23,0xC2,0x36,0x31,0xFF,0x0D,
+    0x00,0x36,0x23,0xC2,0x14,0x31,0xFF,0x0D,0x00,0x14,0x23,0xC2,0xFE,0xC3,0xDC,0x31,
+    0xFF,0x0D,0x00,0x24,0x23,0xC2,0x31,0xFF,0x0F,0x00,0x23,0xC2,0xFE,0xE3,0xE4,0xFF,
+    0x0F,0x00,0x23,0xC2,0x2C,0xFF,0x0F,0x00,0x23,0xC2,0x2C,0xFF,0x0F,0x00,0x23,0xC2,
+    0x2C,0xFF,0x0F,0x00,0x23,0xC2,0x2C,0xFF,0x0F,0x00,0x23,0xC2,0x2C,0xE4,0xA2,0x79,
+    0x6B,0x04,0x2C,0xE4,0x23,0xC2,0xFE,0xE3,0xDC,0xE0,0xA8,0x6D,0xA7,0x6D,0xA5,0x7C,
+    0xA4,0x6B,0xC3,0x3A,0x34,0x16,0x29,0xE0,0x23,0xC2,0x29,0xDD,0x0B,0xAB,0x5F,0xAA,
+    0x4F,0x31,0xC9,0x25,0x1C,0x0B,0x29,0xDD,0x23,0xC2,0x24,0xDC,0xAC,0x4F,0x31,0xCF,
+    0x01,0x24,0xDC,0x23,0xC2,0x24,0xDA,0xA2,0x79,0xFE,0x17,0xF7,0x31,0xD1,0x13,0x3C,
+    0x24,0xDA,0x23,0xC2,0x24,0xD9,0xA3,0x8B,0x3A,0x31,0xD3,0x3A,0x12,0x24,0xD9,0x23,
+    0xC2,0x24,0xD8,0x3C,0x3A,0x31,0xD5,0x3A,0x3C,0x24,0xD8,0x23,0xC2,0x24,0xD8,0x13,
+    0x31,0xD7,0x13,0x24,0xD8,0x23,0xC2,0x24,0xD7,0xFE,0x30,0xEE,0x31,0xD9,0x3C,0x24,
+    0xD7,0x23,0xC2,0x24,0xD6,0xA2,0x7A,0x31,0xDB,0x03,0x24,0xD6,0x23,0xC2,0xFE,0xA3,
+    0xDC,0xD6,0xFE,0x92,0xEE,0x31,0xDB,0x19,0x1F,0xD6,0x23,0xC2,0x1F,0xD5,0x24,0x25,
+    0x31,0xDB,0x25,0x24,0x1F,0xD5,0x23,0xC2,0xFE,0xA3,0xD4,0xD5,0xA9,0x6D,0x31,0xDD,
+    0x0E,0x1C,0xD5,0x23,0xC2,0x1C,0xD5,0xFE,0xB4,0xEE,0x31,0xDD,0x2C,0x1C,0xD5,0x23,
+    0xC2,0x1C,0xD5,0x3A,0x31,0xDD,0x3A,0x1C,0xD5,0x23,0xC2,0x1C,0xD5,0x31,0xDF,0x1C,
+    0xD5,0x23,0xC2,0x1C,0xD4,0xA2,0x79,0x31,0xDF,0x34,0x1C,0xD4,0x23,0xC2,0x1C,0xD4,
+    0xA2,0x8A,0x31,0xDF,0x3E,0x1C,0xD4,0x23,0xC2,0xFE,0x83,0xD4,0xD4,0xA2,0x79,0x31,
+    0xDF,0x2F,0x17,0xD4,0x23,0xC2,0x17,0xD5,0x31,0xDF,0x17,0xD5,0x23,0xC2,0x17,0xD5,
+    0xFE,0x7A,0xF7,0x31,0xDD,0x37,0x17,0xD5,0x23,0xC2,0x17,0xD5,0x2C,0x31,0xDD,0x2C,
+    0x17,0xD5,0x23,0xC2,0x17,0xD5,0xA9,0x6D,0x31,0xDD,0x09,0x17,0xD5,0x23,0xC2,0x14,
+    0xD5,0x17,0x25,0x31,0xDB,0x25,0x17,0x14,0xD5,0x23,0xC2,0x14,0xD6,0xFE,0x72,0xEE,
+    0x31,0xDB,0x14,0x91,0xC1,0xD6,0x23,0xC2,0x14,0xD6,0x2F,0x31,0xDB,0x2F,0x14,0xD6,
+    0x23,0xC2,0x0F,0xD7,0xAD,0x5F,0x31,0xD9,0x34,0x0F,0xD7,0x23,0xC2,0x0F,0xD8,0xFE,
+    0xF7,0xF6,0x31,0xD7,0x0E,0x0F,0xD8,0x23,0xC2,0x0F,0xD8,0xA2,0x89,0xFE,0x5A,0xF7,
+    0x31,0xD5,0x32,0x2A,0x0F,0xD8,0x23,0xC2,0xFE,0x62,0xCC,0xD9,0xA4,0x7A,0x32,0x31,
+    0xD3,0x32,0x3B,0x08,0xD9,0x23,0xC2,0x08,0xDA,0xA2,0x79,0xFE,0xF7,0xEE,0x31,0xD1,
+    0x0B,0x20,0x08,0xDA,0x23,0xC2,0x08,0xDC,0x34,0x31,0xCF,0x34,0x08,0xDC,0x23,0xC2,
+    0x08,0xDD,0xA3,0x7A,0xAC,0x5F,0x25,0x31,0xC9,0x25,0x0C,0x2C,0x08,0xDD,0x23,0xC2,
+    0x08,0xDF,0x0F,0xA9,0x6D,0xA8,0x6C,0x32,0x31,0xC3,0x32,0x27,0x01,0x0F,0x08,0xDF,
+    0x23,0xC2,0xFE,0x42,0xC4,0xE4,0xA2,0x89,0x6F,0x1B,0x00,0xE4,0x23,0xC2,0x00,0xFF,
+    0x0F,0x00,0x23,0xC2,0x00,0xFF,0x0F,0x00,0x23,0xC2,0x00,0xFF,0x0F,0x00,0x23,0xC2,
+    0x00,0xFF,0x0F,0x00,0x23,0xC2,0x00,0xFF,0x0F,0x00,0x23,0xC2,0x00,0xFF,0x0F,0x00,
+    0x23,0xC2,0xFE,0x22,0xBC,0x00,0xFF,0x0D,0x00,0x38,0x23,0xC2,0xFE,0xC3,0xAB,0xA3,
+    0xA6,0xFF,0x0D,0x00,0x2A,0x23,0xC2,0xFE,0x43,0x93,0x3B,0xFF,0x0D,0x00,0x0D,0x23,
+    0xC2,0xAC,0xB0,0x3B,0xFF,0x0D,0x00,0x2C,0x23,0xC2,0xA5,0xA5,0x38,0xFF,0x0D,0x00,
+    0x01,0x23,0xC3,0xFE,0x83,0xA3,0x38,0xFF,0x0B,0x00,0x1D,0x23,0xC4,0xAA,0xB1,0x38,
+    0xFF,0x0B,0x00,0x1F,0x23,0xC5,0xFE,0xA3,0xA3,0x38,0xFF,0x09,0x00,0x22,0x23,0xC6,
+    0xA7,0xB4,0x38,0xFF,0x09,0x00,0x11,0x23,0xC7,0xAD,0xC0,0xAA,0xC1,0xFF,0x07,0x00,
+    0x34,0x23,0xC9,0xFE,0x23,0x8B,0x33,0xFF,0x05,0x00,0x05,0x23,0xCB,0x05,0x33,0xFF,
+    0x03,0x00,0x05,0x23,0xCD,0x34,0x33,0xFF,0x01,0x00,0x34,0x23,0xCF,0x11,0x1D,0x33,
+    0xFB,0x1D,0x11,0x23,0xD2,0xA9,0xB2,0xA9,0xC3,0x33,0xF7,0x15,0x17,0x23,0xD6,0xA4,
+    0xA5,0xA7,0xA4,0x05,0x1D,0xA3,0x96,0x6E,0xED,0x2B,0x1D,0x05,0x27,0x3C,0x23,0xFF,
+    0x73,0x00,
+};
@@ -0,0 +1,974 @@
+/**
+ ******************************************************************************
+ * @file    lcd_jpeg.c
+ * @brief   JPEG 图片显示 - 硬件JPEG后端、基线软件解码器与 YCbCr -> RGB565 转换
+ ******************************************************************************
+ */
+
+#include "lcd_jpeg.h"
+#include "lcd_spi_154.h"
+#include "lcd_blit.h"
+#include <string.h>
+
+#if defined(JPEG) && defined(HAL_JPEG_MODULE_ENABLED)
+#define LCD_JPEG_HAS_CODEC   1
+#else
+#define LCD_JPEG_HAS_CODEC   0
+#endif
+
+#define JPEG_FAST_BITS      9               // 哈夫曼快速查找表的码长
+#define JPEG_MAX_COMPS      3
+
+/* 标记 */
+#define JPEG_SOI            0xD8
+#define JPEG_EOI            0xD9
+#define JPEG_SOF0           0xC0
+#define JPEG_SOF1           0xC1
+#define JPEG_DHT            0xC4
+#define JPEG_DQT            0xDB
+#define JPEG_DRI            0xDD
+#define JPEG_SOS            0xDA
+
+/* 之字形序号 -> 自然顺序 */
+static const uint8_t jpeg_zigzag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10,
+    17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+typedef struct {
+    uint8_t  id;
+    uint8_t  h, v;                          // 采样因子
+    uint8_t  tq;                            // 量化表
+    uint8_t  td, ta;                        // DC/AC 哈夫曼表
+    int32_t  pred;                          // DC预测值
+} JPEG_Component_t;
+
+typedef struct {
+    uint16_t fast[1U << JPEG_FAST_BITS];    // (码长<<8)|符号，0表示码长超过 JPEG_FAST_BITS
+    int32_t  maxcode[17];                   // 各码长的最大码字，-1表示没有
+    int32_t  valoff[17];                    // 码字 + valoff[码长] = 符号在 huffval 中的位置
+    uint8_t  huffval[256];
+    bool     defined;
+} JPEG_Huffman_t;
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t pos;
+    uint32_t end;
+    uint32_t acc;
+    int32_t  count;                         // acc 中未读的位数
+    bool     marker;                        // 遇到标记，之后补0
+} JPEG_Bits_t;
+
+/* 输出：解码器按MCU行把像素写入行带，行带写满或图片结束时交给 end */
+typedef struct JPEG_Sink JPEG_Sink_t;
+struct JPEG_Sink {
+    uint16_t *(*begin)(JPEG_Sink_t *sink, uint16_t y);
+    HAL_StatusTypeDef (*end)(JPEG_Sink_t *sink, uint16_t *band, uint16_t rows);
+    uint16_t stride;
+    uint16_t band_rows;                     // MCU高度的整数倍
+    uint16_t *dst;
+    uint16_t width;
+    LCD_SPI_DMA_Handle_t *hlcd;
+};
+
+typedef struct {
+    LCD_JPEG_Info_t info;
+    JPEG_Component_t comp[JPEG_MAX_COMPS];
+    uint8_t  ncomp;
+    uint16_t qt[4][64];                     // 之字形顺序
+    bool     qt_defined[4];
+    JPEG_Huffman_t dc[2];
+    JPEG_Huffman_t ac[2];
+    uint32_t scan_offset;                   // 熵编码数据起点
+    JPEG_Bits_t bits;
+
+    JPEG_Sink_t *sink;
+    uint16_t *band;
+    uint16_t band_y;
+    uint16_t mcus_x;
+    uint32_t mcu_index;
+    uint32_t mcu_count;
+    HAL_StatusTypeDef status;
+} JPEG_Decoder_t;
+
+static JPEG_Decoder_t jpeg_dec;
+static LCD_JPEG_Backend_t jpeg_backend = LCD_JPEG_BACKEND_SW;
+static LCD_JPEG_Stats_t jpeg_stats;
+
+/* ==================== YCbCr -> RGB565 ==================== */
+
+/* 与 libjpeg jdcolor.c 相同的16位定点表 */
+#define JPEG_SCALEBITS      16
+#define JPEG_ONE_HALF       ((int32_t)1 << (JPEG_SCALEBITS - 1))
+#define JPEG_FIX(x)         ((int32_t)((x) * (1L << JPEG_SCALEBITS) + 0.5))
+
+static int16_t jpeg_cr_r[256];
+static int16_t jpeg_cb_b[256];
+static int32_t jpeg_cr_g[256];
+static int32_t jpeg_cb_g[256];
+static bool jpeg_tables_ready;
+
+static void JPEG_BuildColorTables(void)
+{
+    for (int32_t i = 0; i < 256; i++) {
+        int32_t x = i - 128;
+        jpeg_cr_r[i] = (int16_t)((JPEG_FIX(1.40200) * x + JPEG_ONE_HALF) >> JPEG_SCALEBITS);
+        jpeg_cb_b[i] = (int16_t)((JPEG_FIX(1.77200) * x + JPEG_ONE_HALF) >> JPEG_SCALEBITS);
+        jpeg_cr_g[i] = -JPEG_FIX(0.71414) * x;
+        jpeg_cb_g[i] = -JPEG_FIX(0.34414) * x + JPEG_ONE_HALF;
+    }
+    jpeg_tables_ready = true;
+}
+
+static inline uint32_t JPEG_Clamp(int32_t v)
+{
+    return (v < 0) ? 0U : (v > 255) ? 255U : (uint32_t)v;
+}
+
+/**
+ * @brief 把一个MCU的 YCbCr 块转换为 RGB565，只写左上角 w x h 的有效部分
+ * @note  块顺序与硬件JPEG输出相同：亮度块按行排列，之后是 Cb、Cr 各一块
+ */
+static void JPEG_ConvertMCU(const LCD_JPEG_Info_t *info, const uint8_t *mcu,
+                            uint16_t *dst, uint16_t stride, uint16_t w, uint16_t h)
+{
+    if (info->subsampling == LCD_JPEG_GRAY) {
+        for (uint16_t py = 0; py < h; py++) {
+            const uint8_t *src = &mcu[py * 8U];
+            for (uint16_t px = 0; px < w; px++) {
+                uint32_t g = src[px];
+                dst[px] = (uint16_t)(((g & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (g >> 3));
+            }
+            dst += stride;
+        }
+        return;
+    }
+
+    uint32_t y_cols = info->mcu_width / 8U;
+    uint32_t hshift = (info->mcu_width == 16U) ? 1U : 0U;
+    uint32_t vshift = (info->mcu_height == 16U) ? 1U : 0U;
+    const uint8_t *cb = &mcu[(info->mcu_blocks - 2U) * 64U];
+    const uint8_t *cr = cb + 64;
+
+    for (uint16_t py = 0; py < h; py++) {
+        const uint8_t *cb_row = &cb[(py >> vshift) * 8U];
+        const uint8_t *cr_row = &cr[(py >> vshift) * 8U];
+        for (uint16_t px = 0; px < w; px++) {
+            const uint8_t *yb = &mcu[((py >> 3) * y_cols + (px >> 3)) * 64U];
+            int32_t y = yb[(py & 7U) * 8U + (px & 7U)];
+            uint32_t c_b = cb_row[px >> hshift];
+            uint32_t c_r = cr_row[px >> hshift];
+            uint32_t r = JPEG_Clamp(y + jpeg_cr_r[c_r]);
+            uint32_t g = JPEG_Clamp(y + ((jpeg_cb_g[c_b] + jpeg_cr_g[c_r]) >> JPEG_SCALEBITS));
+            uint32_t b = JPEG_Clamp(y + jpeg_cb_b[c_b]);
+            dst[px] = (uint16_t)(((r & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (b >> 3));
+        }
+        dst += stride;
+    }
+}
+
+/**
+ * @brief 接收一个解码完成的MCU，转换到行带；一个行带写满时交给输出
+ */
+static HAL_StatusTypeDef JPEG_PutMCU(JPEG_Decoder_t *d, const uint8_t *mcu)
+{
+    JPEG_Sink_t *sink = d->sink;
+    const LCD_JPEG_Info_t *info = &d->info;
+
+    if (d->mcu_index >= d->mcu_count) {
+        return HAL_OK;                      // 硬件输出缓冲区末尾的填充
+    }
+
+    uint16_t mx = (uint16_t)(d->mcu_index % d->mcus_x);
+    uint16_t x0 = (uint16_t)(mx * info->mcu_width);
+    uint16_t y0 = (uint16_t)(d->mcu_index / d->mcus_x * info->mcu_height);
+    uint16_t w = (uint16_t)((info->width - x0 < info->mcu_width) ? info->width - x0 : info->mcu_width);
+    uint16_t h = (uint16_t)((info->height - y0 < info->mcu_height) ? info->height - y0 : info->mcu_height);
+
+    if (d->band == NULL) {
+        d->band_y = y0;
+        d->band = sink->begin(sink, y0);
+    }
+    JPEG_ConvertMCU(info, mcu, &d->band[(y0 - d->band_y) * sink->stride + x0], sink->stride, w, h);
+    d->mcu_index++;
+
+    if (mx == d->mcus_x - 1U) {
+        uint16_t next_y = (uint16_t)(y0 + info->mcu_height);
+        if (next_y - d->band_y >= sink->band_rows || next_y >= info->height) {
+            uint16_t rows = (uint16_t)(y0 + h - d->band_y);
+            uint16_t *band = d->band;
+            d->band = NULL;
+            return sink->end(sink, band, rows);
+        }
+    }
+    return HAL_OK;
+}
+
+/* ==================== 文件头 ==================== */
+
+static HAL_StatusTypeDef JPEG_BuildHuffman(JPEG_Huffman_t *t, const uint8_t *bits, const uint8_t *vals, uint32_t n)
+{
+    uint32_t code = 0, k = 0;
+
+    if (n > sizeof(t->huffval)) {
+        return HAL_ERROR;
+    }
+    memset(t->fast, 0, sizeof(t->fast));
+    memcpy(t->huffval, vals, n);
+
+    for (uint32_t l = 1; l <= 16U; l++) {
+        t->valoff[l] = (int32_t)k - (int32_t)code;
+        for (uint32_t i = 0; i < bits[l - 1U]; i++, k++, code++) {
+            if (code >= (1U << l)) {
+                return HAL_ERROR;           // 码字数超过该码长能表示的数量
+            }
+            if (l <= JPEG_FAST_BITS) {
+                uint32_t shift = JPEG_FAST_BITS - l;
+                for (uint32_t j = 0; j < (1U << shift); j++) {
+                    t->fast[(code << shift) | j] = (uint16_t)((l << 8) | vals[k]);
+                }
+            }
+        }
+        t->maxcode[l] = bits[l - 1U] ? (int32_t)code - 1 : -1;
+        code <<= 1;
+    }
+    t->defined = true;
+    return HAL_OK;
+}
+
+static inline uint16_t JPEG_Read16(const uint8_t *p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static HAL_StatusTypeDef JPEG_ParseSOF(JPEG_Decoder_t *d, const uint8_t *p, uint16_t len)
+{
+    LCD_JPEG_Info_t *info = &d->info;
+
+    if (len < 6U || p[0] != 8U) {
+        return HAL_ERROR;                   // 只支持8位精度
+    }
+    info->height = JPEG_Read16(&p[1]);
+    info->width = JPEG_Read16(&p[3]);
+    d->ncomp = p[5];
+    if (info->width == 0U || info->height == 0U ||
+        (d->ncomp != 1U && d->ncomp != 3U) || len < 6U + d->ncomp * 3U) {
+        return HAL_ERROR;
+    }
+    for (uint8_t i = 0; i < d->ncomp; i++) {
+        d->comp[i].id = p[6 + i * 3];
+        d->comp[i].h = p[7 + i * 3] >> 4;
+        d->comp[i].v = p[7 + i * 3] & 0x0FU;
+        d->comp[i].tq = p[8 + i * 3] & 0x03U;
+    }
+
+    if (d->ncomp == 1U) {
+        d->comp[0].h = d->comp[0].v = 1;    // 单分量扫描的MCU总是一个块
+        info->subsampling = LCD_JPEG_GRAY;
+        info->mcu_width = info->mcu_height = 8;
+        info->mcu_blocks = 1;
+        return HAL_OK;
+    }
+
+    /* 色度必须是1x1，亮度 1x1 / 2x1 / 2x2 */
+    if (d->comp[1].h != 1U || d->comp[1].v != 1U || d->comp[2].h != 1U || d->comp[2].v != 1U) {
+        return HAL_ERROR;
+    }
+    if (d->comp[0].h == 1U && d->comp[0].v == 1U) {
+        info->subsampling = LCD_JPEG_444;
+    } else if (d->comp[0].h == 2U && d->comp[0].v == 1U) {
+        info->subsampling = LCD_JPEG_422;
+    } else if (d->comp[0].h == 2U && d->comp[0].v == 2U) {
+        info->subsampling = LCD_JPEG_420;
+    } else {
+        return HAL_ERROR;
+    }
+    info->mcu_width = (uint8_t)(d->comp[0].h * 8U);
+    info->mcu_height = (uint8_t)(d->comp[0].v * 8U);
+    info->mcu_blocks = (uint8_t)(d->comp[0].h * d->comp[0].v + 2U);
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef JPEG_ParseDQT(JPEG_Decoder_t *d, const uint8_t *p, uint16_t len)
+{
+    while (len > 0U) {
+        uint8_t pq = p[0] >> 4, tq = p[0] & 0x0FU;
+        uint16_t need = (uint16_t)(1U + 64U * (pq + 1U));
+        if (tq > 3U || pq > 1U || len < need) {
+            return HAL_ERROR;
+        }
+        for (uint32_t k = 0; k < 64U; k++) {
+            d->qt[tq][k] = pq ? JPEG_Read16(&p[1 + k * 2]) : p[1 + k];
+        }
+        d->qt_defined[tq] = true;
+        p += need;
+        len -= need;
+    }
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef JPEG_ParseDHT(JPEG_Decoder_t *d, const uint8_t *p, uint16_t len)
+{
+    while (len >= 17U) {
+        uint8_t tc = p[0] >> 4, th = p[0] & 0x0FU;
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < 16U; i++) {
+            n += p[1 + i];
+        }
+        if (tc > 1U || th > 1U || len < 17U + n ||
+            JPEG_BuildHuffman(tc ? &d->ac[th] : &d->dc[th], &p[1], &p[17], n) != HAL_OK) {
+            return HAL_ERROR;
+        }
+        p += 17U + n;
+        len -= (uint16_t)(17U + n);
+    }
+    return (len == 0U) ? HAL_OK : HAL_ERROR;
+}
+
+static HAL_StatusTypeDef JPEG_ParseSOS(JPEG_Decoder_t *d, const uint8_t *p, uint16_t len)
+{
+    uint8_t ns = p[0];
+
+    /* 基线只解一个交织扫描，包含全部分量 */
+    if (ns != d->ncomp || len < 4U + ns * 2U) {
+        return HAL_ERROR;
+    }
+    for (uint8_t i = 0; i < ns; i++) {
+        JPEG_Component_t *c = NULL;
+        for (uint8_t j = 0; j < d->ncomp; j++) {
+            if (d->comp[j].id == p[1 + i * 2]) c = &d->comp[j];
+        }
+        if (c == NULL || c != &d->comp[i]) {
+            return HAL_ERROR;               // 扫描中的分量顺序必须与帧头相同
+        }
+        c->td = p[2 + i * 2] >> 4;
+        c->ta = p[2 + i * 2] & 0x0FU;
+        if (c->td > 1U || c->ta > 1U || !d->dc[c->td].defined || !d->ac[c->ta].defined ||
+            !d->qt_defined[c->tq]) {
+            return HAL_ERROR;
+        }
+    }
+    /* Ss=0, Se=63, Ah/Al=0 */
+    if (p[1 + ns * 2] != 0U || p[2 + ns * 2] != 63U || p[3 + ns * 2] != 0U) {
+        return HAL_ERROR;
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief 解析到第一个扫描的数据起点，填写尺寸、量化表和哈夫曼表
+ */
+static HAL_StatusTypeDef JPEG_ParseHeader(JPEG_Decoder_t *d, const uint8_t *jpeg, uint32_t size)
+{
+    uint32_t pos = 2;
+    bool have_sof = false;
+
+    memset(d, 0, sizeof(*d));
+    if (jpeg == NULL || size < 4U || jpeg[0] != 0xFFU || jpeg[1] != JPEG_SOI) {
+        return HAL_ERROR;
+    }
+
+    while (pos + 4U <= size) {
+        if (jpeg[pos] != 0xFFU) {
+            return HAL_ERROR;
+        }
+        uint8_t marker = jpeg[pos + 1U];
+        if (marker == 0xFFU) {
+            pos++;                          // 填充字节
+            continue;
+        }
+        uint16_t len = JPEG_Read16(&jpeg[pos + 2U]);
+        if (len < 2U || pos + 2U + len > size) {
+            return HAL_ERROR;
+        }
+        const uint8_t *p = &jpeg[pos + 4U];
+        uint16_t plen = (uint16_t)(len - 2U);
+        HAL_StatusTypeDef st = HAL_OK;
+
+        switch (marker) {
+        case JPEG_SOF0:
+        case JPEG_SOF1:
+            st = JPEG_ParseSOF(d, p, plen);
+            have_sof = (st == HAL_OK);
+            break;
+        case JPEG_DQT:
+            st = JPEG_ParseDQT(d, p, plen);
+            break;
+        case JPEG_DHT:
+            st = JPEG_ParseDHT(d, p, plen);
+            break;
+        case JPEG_DRI:
+            st = (plen >= 2U) ? HAL_OK : HAL_ERROR;
+            d->info.restart_interval = JPEG_Read16(p);
+            break;
+        case JPEG_SOS:
+            if (!have_sof || JPEG_ParseSOS(d, p, plen) != HAL_OK) {
+                return HAL_ERROR;
+            }
+            d->scan_offset = pos + 2U + len;
+            d->mcus_x = (uint16_t)((d->info.width + d->info.mcu_width - 1U) / d->info.mcu_width);
+            d->mcu_count = (uint32_t)d->mcus_x *
+                           ((d->info.height + d->info.mcu_height - 1U) / d->info.mcu_height);
+            return HAL_OK;
+        default:
+            /* 其它SOFn（渐进式、算术编码、无损）不支持；APPn、COM 等跳过 */
+            if (marker >= 0xC0U && marker <= 0xCFU && marker != JPEG_DHT && marker != 0xC8U && marker != 0xCCU) {
+                return HAL_ERROR;
+            }
+            break;
+        }
+        if (st != HAL_OK) {
+            return HAL_ERROR;
+        }
+        pos += 2U + len;
+    }
+    return HAL_ERROR;
+}
+
+/* ==================== 软件解码器 ==================== */
+
+static inline void JPEG_Fill(JPEG_Bits_t *b)
+{
+    while (b->count <= 24) {
+        uint32_t byte = 0;
+        if (!b->marker && b->pos < b->end) {
+            byte = b->data[b->pos];
+            if (byte == 0xFFU) {
+                if (b->pos + 1U < b->end && b->data[b->pos + 1U] == 0x00U) {
+                    b->pos += 2U;           // 填充的 0x00
+                } else {
+                    b->marker = true;       // RSTn 或 EOI：停在标记处，之后补0
+                    byte = 0;
+                }
+            } else {
+                b->pos++;
+            }
+        }
+        b->acc = (b->acc << 8) | byte;
+        b->count += 8;
+    }
+}
+
+static inline uint32_t JPEG_GetBits(JPEG_Bits_t *b, uint32_t n)
+{
+    JPEG_Fill(b);
+    b->count -= (int32_t)n;
+    return (b->acc >> b->count) & ((1U << n) - 1U);
+}
+
+static inline int32_t JPEG_Extend(uint32_t v, uint32_t n)
+{
+    return (v < (1U << (n - 1U))) ? (int32_t)v - (int32_t)(1U << n) + 1 : (int32_t)v;
+}
+
+static int32_t JPEG_HuffDecode(JPEG_Bits_t *b, const JPEG_Huffman_t *t)
+{
+    JPEG_Fill(b);
+    uint16_t e = t->fast[(b->acc >> (b->count - JPEG_FAST_BITS)) & ((1U << JPEG_FAST_BITS) - 1U)];
+    if (e != 0U) {
+        b->count -= e >> 8;
+        return e & 0xFF;
+    }
+    for (uint32_t l = JPEG_FAST_BITS + 1U; l <= 16U; l++) {
+        int32_t code = (int32_t)((b->acc >> (b->count - (int32_t)l)) & ((1U << l) - 1U));
+        if (code <= t->maxcode[l]) {
+            b->count -= (int32_t)l;
+            return t->huffval[code + t->valoff[l]];
+        }
+    }
+    return -1;
+}
+
+/* libjpeg jidctint.c（islow）的定点常数 */
+#define IDCT_CONST_BITS     13
+#define IDCT_PASS1_BITS     2
+#define FIX_0_298631336     2446
+#define FIX_0_390180644     3196
+#define FIX_0_541196100     4433
+#define FIX_0_765366865     6270
+#define FIX_0_899976223     7373
+#define FIX_1_175875602     9633
+#define FIX_1_501321110     12299
+#define FIX_1_847759065     15137
+#define FIX_1_961570560     16069
+#define FIX_2_053119869     16819
+#define FIX_2_562915447     20995
+#define FIX_3_072711026     25172
+#define IDCT_DESCALE(x, n)  (((x) + ((int32_t)1 << ((n) - 1))) >> (n))
+
+/**
+ * @brief 8x8 反DCT，输入为反量化后的系数（自然顺序），输出加128并限幅
+ */
+static void JPEG_IDCT(const int32_t *in, uint8_t *out)
+{
+    int32_t ws[64];
+    int32_t tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13, z1, z2, z3, z4, z5;
+
+    /* 第一遍：列 */
+    for (uint32_t c = 0; c < 8U; c++) {
+        const int32_t *col = &in[c];
+        int32_t *w = &ws[c];
+        if ((col[8] | col[16] | col[24] | col[32] | col[40] | col[48] | col[56]) == 0) {
+            int32_t dc = col[0] * (1 << IDCT_PASS1_BITS);
+            for (uint32_t r = 0; r < 8U; r++) w[r * 8U] = dc;
+            continue;
+        }
+        z2 = col[16];
+        z3 = col[48];
+        z1 = (z2 + z3) * FIX_0_541196100;
+        tmp2 = z1 + z3 * (-FIX_1_847759065);
+        tmp3 = z1 + z2 * FIX_0_765366865;
+        tmp0 = (col[0] + col[32]) * (1 << IDCT_CONST_BITS);
+        tmp1 = (col[0] - col[32]) * (1 << IDCT_CONST_BITS);
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+
+        tmp0 = col[56];
+        tmp1 = col[40];
+        tmp2 = col[24];
+        tmp3 = col[8];
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        z4 = tmp1 + tmp3;
+        z5 = (z3 + z4) * FIX_1_175875602;
+        tmp0 *= FIX_0_298631336;
+        tmp1 *= FIX_2_053119869;
+        tmp2 *= FIX_3_072711026;
+        tmp3 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 = z3 * (-FIX_1_961570560) + z5;
+        z4 = z4 * (-FIX_0_390180644) + z5;
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+        w[0]  = IDCT_DESCALE(tmp10 + tmp3, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[56] = IDCT_DESCALE(tmp10 - tmp3, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[8]  = IDCT_DESCALE(tmp11 + tmp2, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[48] = IDCT_DESCALE(tmp11 - tmp2, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[16] = IDCT_DESCALE(tmp12 + tmp1, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[40] = IDCT_DESCALE(tmp12 - tmp1, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[24] = IDCT_DESCALE(tmp13 + tmp0, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+        w[32] = IDCT_DESCALE(tmp13 - tmp0, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+    }
+
+    /* 第二遍：行 */
+    for (uint32_t r = 0; r < 8U; r++) {
+        const int32_t *w = &ws[r * 8U];
+        uint8_t *o = &out[r * 8U];
+        const uint32_t shift = IDCT_CONST_BITS + IDCT_PASS1_BITS + 3;
+
+        z2 = w[2];
+        z3 = w[6];
+        z1 = (z2 + z3) * FIX_0_541196100;
+        tmp2 = z1 + z3 * (-FIX_1_847759065);
+        tmp3 = z1 + z2 * FIX_0_765366865;
+        tmp0 = (w[0] + w[4]) * (1 << IDCT_CONST_BITS);
+        tmp1 = (w[0] - w[4]) * (1 << IDCT_CONST_BITS);
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+
+        tmp0 = w[7];
+        tmp1 = w[5];
+        tmp2 = w[3];
+        tmp3 = w[1];
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        z4 = tmp1 + tmp3;
+        z5 = (z3 + z4) * FIX_1_175875602;
+        tmp0 *= FIX_0_298631336;
+        tmp1 *= FIX_2_053119869;
+        tmp2 *= FIX_3_072711026;
+        tmp3 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 = z3 * (-FIX_1_961570560) + z5;
+        z4 = z4 * (-FIX_0_390180644) + z5;
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+        o[0] = (uint8_t)JPEG_Clamp(IDCT_DESCALE(tmp10 + tmp3, shift) + 128);
+        o[7] = (uint8_t)JPEG_Clamp(IDCT_DESCALE(tmp10 - tmp3, shift) + 128);
+        o[1] = (uint8_t)JPEG_Clamp(IDCT_DESCALE(tmp11 + tmp2, shift) + 128);
+        o[6] = (uint8_t)JPEG_Clamp(IDCT_DESCALE(tmp11 - tmp2, shift) + 128);
+        o[2] = (uint8_t)JPEG_Clamp(IDCT_DESCALE(tmp12 + tmp1, shift) + 128);
+        o[5] = (uint8_t)JPEG_Clamp(IDCT_DESCALE(tmp12 - tmp1, shift) + 128);
+        o[3] = (uint8_t)JPEG_Clamp(IDCT_DESCALE(tmp13 + tmp0, shift) + 128);
+        o[4] = (uint8_t)JPEG_Clamp(IDCT_DESCALE(tmp13 - tmp0, shift) + 128);
+    }
+}
+
+static HAL_StatusTypeDef JPEG_DecodeBlock(JPEG_Decoder_t *d, JPEG_Component_t *c, uint8_t *out)
+{
+    int32_t coef[64];
+    const uint16_t *q = d->qt[c->tq];
+    int32_t s;
+
+    memset(coef, 0, sizeof(coef));
+
+    s = JPEG_HuffDecode(&d->bits, &d->dc[c->td]);
+    if (s < 0 || s > 11) {
+        return HAL_ERROR;
+    }
+    if (s != 0) {
+        c->pred += JPEG_Extend(JPEG_GetBits(&d->bits, (uint32_t)s), (uint32_t)s);
+    }
+    coef[0] = c->pred * q[0];
+
+    for (uint32_t k = 1; k < 64U; k++) {
+        int32_t rs = JPEG_HuffDecode(&d->bits, &d->ac[c->ta]);
+        if (rs < 0) {
+            return HAL_ERROR;
+        }
+        uint32_t run = (uint32_t)rs >> 4, size = (uint32_t)rs & 0x0FU;
+        if (size == 0U) {
+            if (run != 15U) {
+                break;                      // EOB
+            }
+            k += 15U;                       // ZRL：16个0
+            continue;
+        }
+        k += run;
+        if (k > 63U) {
+            return HAL_ERROR;
+        }
+        coef[jpeg_zigzag[k]] = JPEG_Extend(JPEG_GetBits(&d->bits, size), size) * q[k];
+    }
+
+    JPEG_IDCT(coef, out);
+    return HAL_OK;
+}
+
+/* 复位标记：丢弃缓冲的位，跳过 RSTn，DC预测值清零 */
+static HAL_StatusTypeDef JPEG_Restart(JPEG_Decoder_t *d)
+{
+    JPEG_Bits_t *b = &d->bits;
+
+    while (b->pos + 1U < b->end && !(b->data[b->pos] == 0xFFU && (b->data[b->pos + 1U] & 0xF8U) == 0xD0U)) {
+        b->pos++;
+    }
+    if (b->pos + 1U >= b->end) {
+        return HAL_ERROR;
+    }
+    b->pos += 2U;
+    b->acc = 0;
+    b->count = 0;
+    b->marker = false;
+    for (uint8_t i = 0; i < d->ncomp; i++) {
+        d->comp[i].pred = 0;
+    }
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef JPEG_DecodeSW(JPEG_Decoder_t *d, const uint8_t *jpeg, uint32_t size)
+{
+    uint8_t mcu[6 * 64];
+    uint16_t ri = d->info.restart_interval;
+
+    d->bits.data = jpeg;
+    d->bits.pos = d->scan_offset;
+    d->bits.end = size;
+
+    for (uint32_t m = 0; m < d->mcu_count; m++) {
+        if (ri != 0U && m != 0U && m % ri == 0U && JPEG_Restart(d) != HAL_OK) {
+            return HAL_ERROR;
+        }
+        uint8_t *blk = mcu;
+        for (uint8_t i = 0; i < d->ncomp; i++) {
+            JPEG_Component_t *c = &d->comp[i];
+            for (uint32_t n = 0; n < (uint32_t)c->h * c->v; n++) {
+                if (JPEG_DecodeBlock(d, c, blk) != HAL_OK) {
+                    return HAL_ERROR;
+                }
+                blk += 64;
+            }
+        }
+        if (JPEG_PutMCU(d, mcu) != HAL_OK) {
+            return HAL_ERROR;
+        }
+    }
+    return HAL_OK;
+}
+
+/* ==================== 硬件JPEG后端 ==================== */
+
+#if LCD_JPEG_HAS_CODEC
+
+#define JPEG_HW_IN_CHUNK    4096U
+#define JPEG_HW_OUT_BYTES   (6U * 64U * 4U)     // 4个4:2:0 MCU
+
+static JPEG_HandleTypeDef hjpeg;
+static bool jpeg_hw_ready;
+/* 轮询模式由CPU读写输出缓冲区，可以放在DTCM */
+static uint8_t jpeg_hw_out[JPEG_HW_OUT_BYTES] __attribute__((aligned(4)));
+static uint32_t jpeg_hw_out_len;
+static const uint8_t *jpeg_hw_in;
+static uint32_t jpeg_hw_in_size;
+static uint32_t jpeg_hw_in_pos;
+
+void HAL_JPEG_InfoReadyCallback(JPEG_HandleTypeDef *h, JPEG_ConfTypeDef *pInfo)
+{
+    (void)h;
+    if (pInfo->ImageWidth != jpeg_dec.info.width || pInfo->ImageHeight != jpeg_dec.info.height) {
+        jpeg_dec.status = HAL_ERROR;
+    }
+}
+
+void HAL_JPEG_GetDataCallback(JPEG_HandleTypeDef *h, uint32_t NbDecodedData)
+{
+    jpeg_hw_in_pos += NbDecodedData;
+    uint32_t remain = (jpeg_hw_in_pos < jpeg_hw_in_size) ? jpeg_hw_in_size - jpeg_hw_in_pos : 0U;
+    HAL_JPEG_ConfigInputBuffer(h, (uint8_t *)&jpeg_hw_in[jpeg_hw_in_pos],
+                               remain > JPEG_HW_IN_CHUNK ? JPEG_HW_IN_CHUNK : remain);
+}
+
+void HAL_JPEG_DataReadyCallback(JPEG_HandleTypeDef *h, uint8_t *pDataOut, uint32_t OutDataLength)
+{
+    uint32_t mcu_bytes = jpeg_dec.info.mcu_blocks * 64U;
+
+    for (uint32_t off = 0; off + mcu_bytes <= OutDataLength && jpeg_dec.status == HAL_OK; off += mcu_bytes) {
+        jpeg_dec.status = JPEG_PutMCU(&jpeg_dec, &pDataOut[off]);
+    }
+    HAL_JPEG_ConfigOutputBuffer(h, jpeg_hw_out, jpeg_hw_out_len);
+}
+
+void HAL_JPEG_ErrorCallback(JPEG_HandleTypeDef *h)
+{
+    (void)h;
+    jpeg_dec.status = HAL_ERROR;
+}
+
+/**
+ * @brief 硬件解码：文件头由硬件重新解析，输出的MCU在回调中转换并送出
+ */
+static HAL_StatusTypeDef JPEG_DecodeHW(JPEG_Decoder_t *d, const uint8_t *jpeg, uint32_t size)
+{
+    uint32_t mcu_bytes = d->info.mcu_blocks * 64U;
+    HAL_StatusTypeDef st;
+
+    jpeg_hw_out_len = (JPEG_HW_OUT_BYTES / mcu_bytes) * mcu_bytes;
+    jpeg_hw_in = jpeg;
+    jpeg_hw_in_size = size;
+    jpeg_hw_in_pos = 0;
+
+    st = HAL_JPEG_Decode(&hjpeg, (uint8_t *)jpeg, size > JPEG_HW_IN_CHUNK ? JPEG_HW_IN_CHUNK : size,
+                         jpeg_hw_out, jpeg_hw_out_len, LCD_JPEG_TIMEOUT_MS);
+    if (st != HAL_OK) {
+        HAL_JPEG_Abort(&hjpeg);
+        return st;
+    }
+    if (d->status != HAL_OK || d->mcu_index != d->mcu_count) {
+        return HAL_ERROR;
+    }
+    return HAL_OK;
+}
+
+#endif /* LCD_JPEG_HAS_CODEC */
+
+/* ==================== 输出 ==================== */
+
+/* 内存（帧缓冲或调用者的缓冲区）：直接写到目标位置 */
+static uint16_t *Sink_Memory_Begin(JPEG_Sink_t *sink, uint16_t y)
+{
+    return &sink->dst[(uint32_t)y * sink->stride];
+}
+
+static HAL_StatusTypeDef Sink_Memory_End(JPEG_Sink_t *sink, uint16_t *band, uint16_t rows)
+{
+    (void)sink;
+    (void)band;
+    (void)rows;
+    return HAL_OK;
+}
+
+/* 直接模式：行带写在空闲的DMA缓冲区中，写满后异步发送，同时解码下一个行带 */
+static uint16_t *Sink_LCD_Begin(JPEG_Sink_t *sink, uint16_t y)
+{
+    (void)y;
+    return sink->hlcd->dma_buffer[sink->hlcd->current_buffer];
+}
+
+static HAL_StatusTypeDef Sink_LCD_End(JPEG_Sink_t *sink, uint16_t *band, uint16_t rows)
+{
+    LCD_SPI_DMA_Handle_t *hlcd = sink->hlcd;
+    HAL_StatusTypeDef st = LCD_SPI_DMA_WriteBuffer_Async(hlcd, band, (uint32_t)rows * sink->width);
+
+    hlcd->current_buffer = (hlcd->current_buffer + 1) % 2;
+    return st;
+}
+
+/* ==================== 接口函数 ==================== */
+
+static HAL_StatusTypeDef JPEG_Run(const uint8_t *jpeg, uint32_t size, JPEG_Sink_t *sink)
+{
+    JPEG_Decoder_t *d = &jpeg_dec;
+    HAL_StatusTypeDef st;
+
+    d->sink = sink;
+    d->band = NULL;
+    d->mcu_index = 0;
+    d->status = HAL_OK;
+    if (!jpeg_tables_ready) {
+        JPEG_BuildColorTables();
+    }
+
+#if LCD_JPEG_HAS_CODEC
+    if (jpeg_backend == LCD_JPEG_BACKEND_HW) {
+        st = JPEG_DecodeHW(d, jpeg, size);
+        if (st == HAL_OK) {
+            jpeg_stats.hw_images++;
+        }
+    } else
+#endif
+    {
+        st = JPEG_DecodeSW(d, jpeg, size);
+    }
+
+    if (st == HAL_OK) {
+        jpeg_stats.images++;
+        jpeg_stats.mcus += d->mcu_count;
+    } else {
+        jpeg_stats.errors++;
+    }
+    return st;
+}
+
+HAL_StatusTypeDef LCD_JPEG_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+#if LCD_JPEG_HAS_CODEC
+    if (!jpeg_hw_ready) {
+        __HAL_RCC_JPGDECEN_CLK_ENABLE();
+        hjpeg.Instance = JPEG;
+        if (HAL_JPEG_Init(&hjpeg) != HAL_OK) {
+            return HAL_ERROR;
+        }
+        jpeg_hw_ready = true;
+    }
+    jpeg_backend = LCD_JPEG_BACKEND_HW;
+#endif
+    return HAL_OK;
+}
+
+void LCD_JPEG_SetBackend(LCD_JPEG_Backend_t backend)
+{
+#if LCD_JPEG_HAS_CODEC
+    if (backend == LCD_JPEG_BACKEND_HW && !jpeg_hw_ready) {
+        return;
+    }
+    jpeg_backend = backend;
+#else
+    (void)backend;
+#endif
+}
+
+LCD_JPEG_Backend_t LCD_JPEG_GetBackend(void)
+{
+    return jpeg_backend;
+}
+
+HAL_StatusTypeDef LCD_JPEG_GetInfo(const uint8_t *jpeg, uint32_t size, LCD_JPEG_Info_t *info)
+{
+    if (JPEG_ParseHeader(&jpeg_dec, jpeg, size) != HAL_OK) {
+        return HAL_ERROR;
+    }
+    *info = jpeg_dec.info;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef LCD_JPEG_Decode(const uint8_t *jpeg, uint32_t size, uint16_t *dst, uint16_t dst_stride)
+{
+    JPEG_Sink_t sink;
+    uint32_t start = DWT->CYCCNT;
+
+    if (JPEG_ParseHeader(&jpeg_dec, jpeg, size) != HAL_OK || dst_stride < jpeg_dec.info.width) {
+        jpeg_stats.errors++;
+        return HAL_ERROR;
+    }
+
+    sink.begin = Sink_Memory_Begin;
+    sink.end = Sink_Memory_End;
+    sink.stride = dst_stride;
+    sink.band_rows = jpeg_dec.info.mcu_height;
+    sink.dst = dst;
+    sink.width = jpeg_dec.info.width;
+    sink.hlcd = NULL;
+
+    HAL_StatusTypeDef st = JPEG_Run(jpeg, size, &sink);
+    jpeg_stats.last_cycles = DWT->CYCCNT - start;
+    return st;
+}
+
+HAL_StatusTypeDef LCD_JPEG_Draw(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
+                                const uint8_t *jpeg, uint32_t size)
+{
+    JPEG_Sink_t sink;
+    const LCD_JPEG_Info_t *info = &jpeg_dec.info;
+    HAL_StatusTypeDef st;
+    uint32_t start = DWT->CYCCNT;
+
+    if (JPEG_ParseHeader(&jpeg_dec, jpeg, size) != HAL_OK ||
+        x + info->width > LCD_WIDTH || y + info->height > LCD_HEIGHT) {
+        jpeg_stats.errors++;
+        return HAL_ERROR;
+    }
+
+    if (hlcd->frame_buffer_enabled) {
+        // 帧缓冲模式 - 解码到帧缓冲（先等待未完成的位块传输）
+        LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+        st = LCD_JPEG_Decode(jpeg, size, &hlcd->frame_buffer[y * LCD_WIDTH + x], LCD_WIDTH);
+        LCD_FB_MarkDirty(hlcd, x, y, info->width, info->height);
+        return st;
+    }
+
+    // 直接模式 - 每个行带是DMA缓冲区能容纳的最多MCU行
+    sink.band_rows = (uint16_t)(hlcd->dma_buffer_size / info->width / info->mcu_height * info->mcu_height);
+    if (sink.band_rows == 0U) {
+        jpeg_stats.errors++;
+        return HAL_ERROR;
+    }
+    sink.begin = Sink_LCD_Begin;
+    sink.end = Sink_LCD_End;
+    sink.stride = info->width;
+    sink.dst = NULL;
+    sink.width = info->width;
+    sink.hlcd = hlcd;
+
+    LCD_SPI_DMA_SetWindow(hlcd, x, y, info->width, info->height);
+    st = JPEG_Run(jpeg, size, &sink);
+
+    // 等待最后一次完成
+    HAL_StatusTypeDef wait = LCD_SPI_DMA_WaitComplete(hlcd);
+    LCD_CS_Deselect;
+    jpeg_stats.last_cycles = DWT->CYCCNT - start;
+    return (st != HAL_OK) ? st : wait;
+}
+
+void LCD_JPEG_GetStats(LCD_JPEG_Stats_t *stats)
+{
+    *stats = jpeg_stats;
+}
+
+void LCD_JPEG_ResetStats(void)
+{
+    memset(&jpeg_stats, 0, sizeof(jpeg_stats));
+}
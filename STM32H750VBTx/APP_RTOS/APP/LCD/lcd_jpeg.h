@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @file    lcd_jpeg.h
+ * @brief   JPEG 图片显示 - 硬件JPEG编解码器与结果相同的软件解码器，逐行带流式送屏
+ ******************************************************************************
+ * @note
+ *   - 支持基线（baseline）JPEG：灰度或 YCbCr 4:4:4 / 4:2:2 / 4:2:0，可带复位间隔；
+ *     渐进式、算术编码、12位精度不支持（返回 HAL_ERROR）
+ *   - 图片数组直接放在 .rodata（QSPI内存映射区），240x240照片约10~20KB，
+ *     原始RGB565需要115KB
+ *   - 解码器按MCU输出 YCbCr 8x8块（与硬件JPEG的输出格式相同），
+ *     本模块查表转换为 RGB565，写入 LCD_DMA_DrawImage 使用的两个DMA缓冲区：
+ *     一个行带（若干MCU行）经SPI发送时解码下一个行带
+ *   - 颜色转换与 libjpeg 的 jdcolor.c 相同（16位定点查表），色度按复制上采样；
+ *     软件解码器的反DCT为 libjpeg 的 jidctint.c（islow），结果与 libjpeg 逐像素一致
+ *   - 有JPEG外设时 LCD_JPEG_Init 切换到硬件后端（轮询模式，CPU从QSPI读入数据）；
+ *     主机构建只有软件后端
+ *   - 同一时刻只有一个任务使用本模块
+ ******************************************************************************
+ */
+
+#ifndef __LCD_JPEG_H
+#define __LCD_JPEG_H
+
+#include "stm32h7xx_hal.h"
+#include "lcd_spi_dma.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LCD_JPEG_TIMEOUT_MS     1000    // 硬件解码一张图片的超时
+
+typedef enum {
+    LCD_JPEG_GRAY = 0,
+    LCD_JPEG_444,
+    LCD_JPEG_422,                       // 亮度水平2倍采样，MCU 16x8
+    LCD_JPEG_420,                       // 亮度水平、垂直2倍采样，MCU 16x16
+} LCD_JPEG_Subsampling_t;
+
+typedef enum {
+    LCD_JPEG_BACKEND_SW = 0,
+    LCD_JPEG_BACKEND_HW,
+} LCD_JPEG_Backend_t;
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    LCD_JPEG_Subsampling_t subsampling;
+    uint8_t  mcu_width;                 // 8 或 16
+    uint8_t  mcu_height;                // 8 或 16
+    uint8_t  mcu_blocks;                // 每个MCU的8x8块数：1、3、4、6
+    uint16_t restart_interval;          // 0 表示没有复位标记
+} LCD_JPEG_Info_t;
+
+typedef struct {
+    uint32_t images;                    // 解码成功的图片数
+    uint32_t hw_images;                 // 其中由硬件解码的
+    uint32_t errors;                    // 格式不支持、数据损坏或发送失败
+    uint32_t mcus;
+    uint32_t last_cycles;               // 最近一张图片从开始解码到最后一块发送完成的周期数
+} LCD_JPEG_Stats_t;
+
+/**
+ * @brief 初始化硬件JPEG编解码器并切换到硬件后端（没有JPEG外设时保持软件后端）
+ */
+HAL_StatusTypeDef LCD_JPEG_Init(void);
+
+void LCD_JPEG_SetBackend(LCD_JPEG_Backend_t backend);   // 没有JPEG外设时忽略
+LCD_JPEG_Backend_t LCD_JPEG_GetBackend(void);
+
+/**
+ * @brief 解析文件头，得到尺寸和采样方式
+ * @retval HAL_OK 是支持的JPEG；HAL_ERROR 格式不支持或文件头损坏
+ */
+HAL_StatusTypeDef LCD_JPEG_GetInfo(const uint8_t *jpeg, uint32_t size, LCD_JPEG_Info_t *info);
+
+/**
+ * @brief 解码整张图片到 RGB565 缓冲区
+ * @param dst_stride 目标每行的像素数，不小于图片宽度
+ */
+HAL_StatusTypeDef LCD_JPEG_Decode(const uint8_t *jpeg, uint32_t size, uint16_t *dst, uint16_t dst_stride);
+
+/**
+ * @brief 在 (x, y) 显示JPEG图片，图片必须完整位于屏幕内
+ * @note  直接模式：设置一次窗口，逐行带解码到DMA双缓冲并异步发送，返回前等待最后一块完成；
+ *        帧缓冲模式：解码到帧缓冲并标记脏块
+ *        一个MCU行的像素数不能超过DMA缓冲区大小（240宽时任何采样方式都满足）
+ */
+HAL_StatusTypeDef LCD_JPEG_Draw(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
+                                const uint8_t *jpeg, uint32_t size);
+
+void LCD_JPEG_GetStats(LCD_JPEG_Stats_t *stats);
+void LCD_JPEG_ResetStats(void);
+
+#endif /* __LCD_JPEG_H */
@@ -0,0 +1,367 @@
+/**
+ ******************************************************************************
+ * @file    lcd_player.c
+ * @brief   动画/短视频播放 - 片段读取、游程/差分解码与三缓冲显示调度
+ ******************************************************************************
+ * @note
+ *   帧缓冲状态：空闲 -> 已解码（等待显示时刻）-> 发送中（作业队列）-> 空闲（DMA完成中断）
+ *   播放循环每次做一件事：队首帧到时刻则提交，否则有空闲帧缓冲则解码下一帧，
+ *   否则等待DMA完成或显示时刻
+ ******************************************************************************
+ */
+
+#include "lcd_player.h"
+#include "lcd_jpeg.h"
+#include "lcd_spi_job.h"
+#include "lcd_flip.h"
+#include "cmsis_os2.h"
+#include <string.h>
+
+#define CLIP_OP_SKIP        0U
+#define CLIP_OP_LITERAL     1U
+#define CLIP_OP_FILL        2U
+
+typedef enum {
+    PLAYER_BUF_FREE = 0,
+    PLAYER_BUF_READY,
+    PLAYER_BUF_SENDING,
+} Player_BufState_t;
+
+static struct {
+    uint16_t *buf[LCD_PLAYER_BUFFERS];
+    volatile uint8_t state[LCD_PLAYER_BUFFERS];     // Player_BufState_t，DMA完成中断中改为空闲
+    volatile uint32_t submit_cycles[LCD_PLAYER_BUFFERS];
+    uint8_t count;
+    uint8_t ready[LCD_PLAYER_BUFFERS];              // 已解码帧的显示顺序
+    uint8_t ready_head;
+    uint8_t ready_count;
+    osThreadId_t thread;
+    volatile bool stop;
+    volatile uint32_t transfer_errors;              // 中断中累计，播放结束时并入统计
+    uint32_t last_sent_cycles;                      // 上一帧发送完成的时刻（中断中更新）
+    bool sent_cycles_valid;
+} player;
+
+static LCD_Player_Stats_t player_stats = { .interval_us_min = UINT32_MAX };
+
+/* ==================== 片段读取与解码 ==================== */
+
+HAL_StatusTypeDef LCD_Clip_Open(LCD_Clip_t *clip, const uint8_t *data, uint32_t size)
+{
+    LCD_Clip_Header_t *h = &clip->header;
+
+    if (data == NULL || ((uintptr_t)data & 3U) != 0U || size < sizeof(LCD_Clip_Header_t)) {
+        return HAL_ERROR;
+    }
+    memcpy(h, data, sizeof(*h));
+    if (h->magic != LCD_CLIP_MAGIC || h->version != LCD_CLIP_VERSION || h->codec > LCD_CLIP_RLE ||
+        h->width == 0U || h->height == 0U || (uint32_t)h->width * h->height > LCD_PLAYER_FRAME_PIXELS ||
+        h->frames == 0U || h->frame_us == 0U) {
+        return HAL_ERROR;
+    }
+    clip->data = data;
+    clip->size = size;
+    LCD_Clip_Rewind(clip);
+    return HAL_OK;
+}
+
+void LCD_Clip_Rewind(LCD_Clip_t *clip)
+{
+    clip->pos = sizeof(LCD_Clip_Header_t);
+    clip->index = 0;
+}
+
+/**
+ * @brief 游程/差分解码，ref 为NULL时不允许跳过操作
+ */
+static HAL_StatusTypeDef Clip_DecodeRLE(const uint16_t *op, uint32_t words, const uint16_t *ref,
+                                        uint16_t *dst, uint32_t pixels)
+{
+    const uint16_t *end = op + words;
+    uint32_t pos = 0;
+
+    while (op < end) {
+        uint16_t token = *op++;
+        uint32_t n = token & LCD_CLIP_RLE_MAX_RUN;
+
+        if (n == 0U || n > pixels - pos) {
+            return HAL_ERROR;
+        }
+        switch (token >> 14) {
+        case CLIP_OP_SKIP:
+            if (ref == NULL) {
+                return HAL_ERROR;
+            }
+            if (ref != dst) {
+                memcpy(&dst[pos], &ref[pos], n * sizeof(uint16_t));
+            }
+            break;
+        case CLIP_OP_LITERAL:
+            if ((uint32_t)(end - op) < n) {
+                return HAL_ERROR;
+            }
+            memcpy(&dst[pos], op, n * sizeof(uint16_t));
+            op += n;
+            break;
+        case CLIP_OP_FILL: {
+            if (op >= end) {
+                return HAL_ERROR;
+            }
+            uint16_t color = *op++;
+            uint16_t *p = &dst[pos];
+            for (uint32_t i = 0; i < n; i++) {
+                p[i] = color;
+            }
+            break;
+        }
+        default:
+            return HAL_ERROR;
+        }
+        pos += n;
+    }
+    return (pos == pixels) ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef LCD_Clip_DecodeNext(LCD_Clip_t *clip, const uint16_t *ref, uint16_t *dst)
+{
+    const LCD_Clip_Header_t *h = &clip->header;
+    uint32_t record, len;
+    const uint8_t *payload;
+
+    if (clip->index >= h->frames || clip->size - clip->pos < 4U) {
+        return HAL_ERROR;
+    }
+    memcpy(&record, clip->data + clip->pos, sizeof(record));
+    len = record & 0x00FFFFFFU;
+    if (len > clip->size - clip->pos - 4U) {
+        return HAL_ERROR;
+    }
+    payload = clip->data + clip->pos + 4U;
+    clip->pos += 4U + ((len + 3U) & ~3U);
+    clip->index++;
+
+    if (h->codec == LCD_CLIP_JPEG) {
+        LCD_JPEG_Info_t info;
+        if (LCD_JPEG_GetInfo(payload, len, &info) != HAL_OK ||
+            info.width != h->width || info.height != h->height) {
+            return HAL_ERROR;
+        }
+        return LCD_JPEG_Decode(payload, len, dst, h->width);
+    }
+
+    if ((record >> 24) & LCD_CLIP_FRAME_KEY) {
+        ref = NULL;
+    }
+    return Clip_DecodeRLE((const uint16_t *)payload, len / 2U, ref, dst, (uint32_t)h->width * h->height);
+}
+
+/* ==================== 播放 ==================== */
+
+/**
+ * @brief 作业完成回调（DMA完成中断）：释放帧缓冲，唤醒播放任务
+ */
+static void Player_FrameSent(void *ctx, HAL_StatusTypeDef status)
+{
+    uint32_t idx = (uint32_t)(uintptr_t)ctx;
+    uint32_t now = DWT->CYCCNT;
+    uint32_t start = player.submit_cycles[idx];
+
+    // 排在上一帧之后的作业从上一帧发送完成时才开始
+    if (player.sent_cycles_valid && (int32_t)(player.last_sent_cycles - start) > 0) {
+        start = player.last_sent_cycles;
+    }
+    player.last_sent_cycles = now;
+    player.sent_cycles_valid = true;
+    uint32_t cycles = now - start;
+
+    player_stats.transfer_cycles += cycles;
+    if (cycles > player_stats.transfer_cycles_max) {
+        player_stats.transfer_cycles_max = cycles;
+    }
+    if (status != HAL_OK) {
+        player.transfer_errors++;
+    }
+    player.state[idx] = PLAYER_BUF_FREE;
+    osThreadFlagsSet(player.thread, LCD_PLAYER_FLAG);
+}
+
+/**
+ * @brief 选一个空闲帧缓冲，优先选 last（其中已是上一帧，差分帧跳过的像素无需拷贝）
+ * @retval 帧缓冲序号，没有空闲时为-1
+ */
+static int Player_FindFree(int last)
+{
+    if (last >= 0 && player.state[last] == PLAYER_BUF_FREE) {
+        return last;
+    }
+    for (int i = 0; i < player.count; i++) {
+        if (player.state[i] == PLAYER_BUF_FREE) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* 第n帧的预定显示时刻（tick） */
+static inline uint32_t Player_Due(uint32_t start_tick, uint32_t n, uint32_t frame_us)
+{
+    return start_tick + (uint32_t)((uint64_t)n * frame_us / 1000U);
+}
+
+HAL_StatusTypeDef LCD_Player_Play(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
+                                  const uint8_t *data, uint32_t size, uint32_t frame_us, uint32_t loops)
+{
+    LCD_Clip_t clip;
+    uint64_t total, decoded = 0, presented = 0;
+    uint32_t start_tick = 0, sched_base = 0, last_submit = 0;
+    uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+    uint32_t frame_ticks;
+    bool started = false;
+    int last = -1;
+    HAL_StatusTypeDef st = HAL_OK;
+
+    if (LCD_Clip_Open(&clip, data, size) != HAL_OK ||
+        x + clip.header.width > LCD_WIDTH || y + clip.header.height > LCD_HEIGHT) {
+        player_stats.errors++;
+        return HAL_ERROR;
+    }
+    // 两个帧缓冲借用页面翻转的AXI SRAM页面，翻转模式期间不能播放
+    if (LCD_Flip_IsActive()) {
+        player_stats.errors++;
+        return HAL_BUSY;
+    }
+    if (frame_us == 0U) {
+        frame_us = clip.header.frame_us;
+    }
+    frame_ticks = (frame_us + 999U) / 1000U;
+    total = (loops == 0U) ? UINT64_MAX : (uint64_t)loops * clip.header.frames;
+
+    // SPI4交给作业队列：先等驱动未完成的DMA
+    LCD_SPI_DMA_WaitComplete(hlcd);
+    LCD_Job_Init(hlcd->hspi);
+
+    memset(&player, 0, sizeof(player));
+    player.buf[0] = LCD_Flip_BorrowPage(0);
+    player.buf[1] = LCD_Flip_BorrowPage(1);
+    player.buf[2] = LCD_SPI_DMA_BorrowFrameMemory(hlcd);
+    player.count = (player.buf[2] != NULL) ? 3 : 2;
+    player.thread = osThreadGetId();
+    player_stats.buffers = player.count;
+    osThreadFlagsClear(LCD_PLAYER_FLAG);
+
+    while (st == HAL_OK && presented < total && !player.stop) {
+        uint32_t now = osKernelGetTickCount();
+        uint32_t due = Player_Due(sched_base, (uint32_t)presented, frame_us);
+
+        // 1. 队首帧到了显示时刻：提交
+        if (player.ready_count > 0U && (!started || (int32_t)(now - due) >= 0)) {
+            uint8_t idx = player.ready[player.ready_head];
+            uint32_t cyc = DWT->CYCCNT;
+
+            player.ready_head = (uint8_t)((player.ready_head + 1U) % LCD_PLAYER_BUFFERS);
+            player.ready_count--;
+            if (!started) {
+                started = true;
+                start_tick = sched_base = now;
+            } else {
+                uint32_t us = (cyc - last_submit) / cycles_per_us;
+                if (us < player_stats.interval_us_min) player_stats.interval_us_min = us;
+                if (us > player_stats.interval_us_max) player_stats.interval_us_max = us;
+                if ((int32_t)(now - due) > (int32_t)frame_ticks) {
+                    // 落后超过一帧：以当前时刻重新排期，之后的帧不连续补发
+                    sched_base = now - (uint32_t)((uint64_t)presented * frame_us / 1000U);
+                }
+            }
+            last_submit = cyc;
+            player.state[idx] = PLAYER_BUF_SENDING;
+            player.submit_cycles[idx] = cyc;
+            if (LCD_Job_WriteWindow(x, y, clip.header.width, clip.header.height, player.buf[idx],
+                                    Player_FrameSent, (void *)(uintptr_t)idx) != HAL_OK) {
+                player.state[idx] = PLAYER_BUF_FREE;
+                player_stats.errors++;
+                st = HAL_ERROR;
+                break;
+            }
+            presented++;
+            player_stats.frames++;
+            continue;
+        }
+
+        // 2. 有空闲帧缓冲：读取并解码下一帧
+        int idx = (decoded < total) ? Player_FindFree(last) : -1;
+        if (idx >= 0) {
+            uint32_t pos = clip.pos;
+            uint32_t cyc = DWT->CYCCNT;
+
+            if (clip.index >= clip.header.frames) {
+                LCD_Clip_Rewind(&clip);                 // 循环播放
+                pos = clip.pos;
+            }
+            st = LCD_Clip_DecodeNext(&clip, (last >= 0) ? player.buf[last] : NULL, player.buf[idx]);
+            cyc = DWT->CYCCNT - cyc;
+            player_stats.decode_cycles += cyc;
+            if (cyc > player_stats.decode_cycles_max) {
+                player_stats.decode_cycles_max = cyc;
+            }
+            player_stats.bytes += clip.pos - pos;
+            if (st != HAL_OK) {
+                player_stats.errors++;
+                break;
+            }
+            if (started && (int32_t)(osKernelGetTickCount() - Player_Due(sched_base, (uint32_t)decoded, frame_us)) > 0) {
+                player_stats.late++;
+            }
+            player.state[idx] = PLAYER_BUF_READY;
+            player.ready[(player.ready_head + player.ready_count) % LCD_PLAYER_BUFFERS] = (uint8_t)idx;
+            player.ready_count++;
+            last = idx;
+            decoded++;
+            continue;
+        }
+
+        // 3. 等待DMA完成（释放帧缓冲）或队首帧的显示时刻
+        uint32_t cyc = DWT->CYCCNT;
+        uint32_t timeout = (player.ready_count > 0U) ? (due - now) : LCD_PLAYER_TIMEOUT_MS;
+        uint32_t flags = osThreadFlagsWait(LCD_PLAYER_FLAG, osFlagsWaitAny, timeout);
+        cyc = DWT->CYCCNT - cyc;
+        if (player.ready_count > 0U) {
+            player_stats.pace_wait_cycles += cyc;
+        } else {
+            player_stats.buffer_wait_cycles += cyc;
+            if ((flags & osFlagsError) != 0U && Player_FindFree(last) < 0) {
+                player_stats.errors++;
+                st = HAL_TIMEOUT;
+            }
+        }
+    }
+
+    if (LCD_Job_WaitIdle(LCD_PLAYER_TIMEOUT_MS) != HAL_OK && st == HAL_OK) {
+        st = HAL_TIMEOUT;
+    }
+    if (started) {
+        player_stats.elapsed_ms += osKernelGetTickCount() - start_tick;
+    }
+    if (player.transfer_errors != 0U) {
+        player_stats.errors += player.transfer_errors;
+        if (st == HAL_OK) {
+            st = HAL_ERROR;
+        }
+    }
+    return st;
+}
+
+void LCD_Player_Stop(void)
+{
+    player.stop = true;
+}
+
+void LCD_Player_GetStats(LCD_Player_Stats_t *stats)
+{
+    *stats = player_stats;
+}
+
+void LCD_Player_ResetStats(void)
+{
+    memset(&player_stats, 0, sizeof(player_stats));
+    player_stats.interval_us_min = UINT32_MAX;
+}
@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ * @file    lcd_player.h
+ * @brief   动画/短视频播放 - 从QSPI顺序读取帧，解码到三个帧缓冲，
+ *          解码与上一帧的SPI4 DMA发送重叠，按目标帧率提交显示
+ ******************************************************************************
+ * @note
+ *   - 片段（clip）格式，全部小端，由 Host/Tools/host_clipc 生成：
+ *       文件头 LCD_Clip_Header_t（20字节）
+ *       每帧：uint32 记录头（低24位为数据字节数，高8位为 LCD_CLIP_FRAME_* 标志），
+ *             数据，补齐到4字节
+ *   - 编码方式：
+ *       LCD_CLIP_JPEG：每帧是一张基线JPEG（MJPEG），由 lcd_jpeg 解码（有外设时为硬件）
+ *       LCD_CLIP_RLE ：RGB565 游程/差分编码，16位指令序列：
+ *                      高2位为操作，低14位为像素数（1~16383）
+ *                        0 跳过：与上一帧相同
+ *                        1 原样：后跟 n 个像素
+ *                        2 填充：后跟 1 个像素，重复 n 次
+ *                      关键帧（LCD_CLIP_FRAME_KEY）不含跳过操作
+ *   - 帧缓冲：两个借用页面翻转（lcd_flip.c）在AXI SRAM中的页面，翻转模式期间不能播放；
+ *     帧缓冲模式关闭时再借用 lcd_spi_dma 的帧缓冲（D2 SRAM）作为第三个，否则只用两个。
+ *     显示中的帧发完即可重用（屏幕自带显存），
+ *     因此三个缓冲区分别为：正在发送、已解码等待显示时刻、正在解码
+ *   - 显示经 LCD_Job_WriteWindow 提交，DMA完成中断释放帧缓冲并唤醒播放任务；
+ *     播放期间SPI4归播放器所有，其它任务不能绘图
+ *   - LCD_Player_Play 在调用任务中运行直到播放结束或 LCD_Player_Stop
+ ******************************************************************************
+ */
+
+#ifndef __LCD_PLAYER_H
+#define __LCD_PLAYER_H
+
+#include "stm32h7xx_hal.h"
+#include "lcd_spi_dma.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LCD_PLAYER_BUFFERS        3
+#define LCD_PLAYER_FRAME_PIXELS   (LCD_WIDTH * LCD_HEIGHT)  // 单个帧缓冲的像素数，片段尺寸的上限
+#define LCD_PLAYER_TIMEOUT_MS     1000                      // 等待帧缓冲释放的超时
+#define LCD_PLAYER_FLAG           0x00020000U               // 线程标志位：帧发送完成（DMA_SYNC_FLAG 之上）
+
+#define LCD_CLIP_MAGIC            0x50494C43U   // "CLIP"
+#define LCD_CLIP_VERSION          1
+#define LCD_CLIP_FRAME_KEY        0x01U         // 关键帧：不参考上一帧
+#define LCD_CLIP_RLE_MAX_RUN      0x3FFFU
+
+typedef enum {
+    LCD_CLIP_JPEG = 0,
+    LCD_CLIP_RLE,
+} LCD_Clip_Codec_t;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t codec;                     // LCD_Clip_Codec_t
+    uint16_t width;
+    uint16_t height;
+    uint32_t frame_us;                  // 帧间隔，30fps 为 33333
+    uint32_t frames;
+} LCD_Clip_Header_t;
+
+/* 顺序读取器：片段数据直接在QSPI内存映射区中读取，不复制 */
+typedef struct {
+    const uint8_t *data;
+    uint32_t size;
+    LCD_Clip_Header_t header;
+    uint32_t pos;                       // 下一帧记录的偏移
+    uint32_t index;                     // 下一帧的序号
+} LCD_Clip_t;
+
+typedef struct {
+    uint32_t frames;                    // 已显示的帧数
+    uint32_t late;                      // 解码完成时已过预定显示时刻的帧
+    uint32_t errors;                    // 数据损坏、解码或发送失败
+    uint32_t bytes;                     // 读取的压缩数据字节数
+    uint8_t  buffers;                   // 本次播放使用的帧缓冲数（2或3）
+    /* 各阶段的累计/最大周期数（DWT） */
+    uint64_t decode_cycles;             // 读取并解码一帧
+    uint32_t decode_cycles_max;
+    uint64_t transfer_cycles;           // 发送一帧：提交（或前一帧发送完成）到DMA完成
+    uint32_t transfer_cycles_max;
+    uint64_t buffer_wait_cycles;        // 等待空闲帧缓冲（解码被发送阻塞）
+    uint64_t pace_wait_cycles;          // 等待预定显示时刻（解码领先）
+    uint32_t interval_us_min;           // 相邻两帧提交的间隔
+    uint32_t interval_us_max;
+    uint32_t elapsed_ms;                // 第一帧提交到最后一帧发送完成
+} LCD_Player_Stats_t;
+
+/**
+ * @brief 打开片段，检查文件头
+ * @retval HAL_ERROR 格式错误或尺寸超过 LCD_PLAYER_FRAME_PIXELS
+ */
+HAL_StatusTypeDef LCD_Clip_Open(LCD_Clip_t *clip, const uint8_t *data, uint32_t size);
+void              LCD_Clip_Rewind(LCD_Clip_t *clip);
+
+/**
+ * @brief 解码下一帧到 dst（width*height 个像素，连续存放）
+ * @param ref 上一帧的像素，差分帧需要；可以与 dst 相同（dst 中已是上一帧时跳过无需拷贝）
+ * @retval HAL_ERROR 数据损坏、没有更多帧或差分帧缺少 ref
+ */
+HAL_StatusTypeDef LCD_Clip_DecodeNext(LCD_Clip_t *clip, const uint16_t *ref, uint16_t *dst);
+
+/**
+ * @brief 在 (x, y) 播放片段
+ * @param frame_us 帧间隔，0 使用片段中的帧率
+ * @param loops    播放次数，0 为循环播放直到 LCD_Player_Stop
+ * @note  返回前等待最后一帧发送完成
+ */
+HAL_StatusTypeDef LCD_Player_Play(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
+                                  const uint8_t *data, uint32_t size, uint32_t frame_us, uint32_t loops);
+
+void LCD_Player_Stop(void);                 // 可在其它任务中调用，当前帧提交后结束
+
+void LCD_Player_GetStats(LCD_Player_Stats_t *stats);
+void LCD_Player_ResetStats(void);
+
+#endif /* __LCD_PLAYER_H */
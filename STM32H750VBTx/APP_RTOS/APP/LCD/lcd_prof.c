@@ -0,0 +1,226 @@
+/**
+ ******************************************************************************
+ * @file    lcd_prof.c
+ * @brief   LCD流水线周期剖析
+ ******************************************************************************
+ */
+
+#include "lcd_prof.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *const prof_stage_names[LCD_PROF_STAGE_COUNT] = {
+    "pixel", "copy", "setaddr", "dma", "wait",
+};
+
+static struct {
+    bool in_frame;
+    bool dma_running;
+    uint32_t frame_start;
+    uint32_t dma_start;
+    volatile uint32_t cycles[LCD_PROF_STAGE_COUNT];     // 本帧累计
+    volatile uint32_t events[LCD_PROF_STAGE_COUNT];
+} prof;
+
+static LCD_Prof_Stats_t prof_stats;
+
+static uint32_t Prof_CyclesPerUs(void)
+{
+    uint32_t c = SystemCoreClock / 1000000U;
+    return (c != 0U) ? c : 1U;
+}
+
+/* 微秒数所在的直方图格：0 → 0，[2^(k-1), 2^k) → k */
+static uint32_t Prof_Bin(uint32_t us)
+{
+    uint32_t bin = (us == 0U) ? 0U : 32U - (uint32_t)__builtin_clz(us);
+    return (bin < LCD_PROF_HIST_BINS) ? bin : LCD_PROF_HIST_BINS - 1U;
+}
+
+static void Prof_Record(LCD_Prof_StageStats_t *s, uint32_t cycles, uint32_t events, bool first)
+{
+    s->cycles_total += cycles;
+    if (first || cycles < s->cycles_min) {
+        s->cycles_min = cycles;
+    }
+    if (cycles > s->cycles_max) {
+        s->cycles_max = cycles;
+    }
+    s->events += events;
+    s->hist[Prof_Bin(cycles / Prof_CyclesPerUs())]++;
+}
+
+void LCD_Prof_Reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    __disable_irq();
+    memset(&prof_stats, 0, sizeof(prof_stats));
+    prof.in_frame = false;
+    for (uint32_t i = 0; i < LCD_PROF_STAGE_COUNT; i++) {
+        prof.cycles[i] = 0;
+        prof.events[i] = 0;
+    }
+    __set_PRIMASK(primask);
+}
+
+void LCD_Prof_FrameBegin(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    for (uint32_t i = 0; i < LCD_PROF_STAGE_COUNT; i++) {
+        prof.cycles[i] = 0;
+        prof.events[i] = 0;
+    }
+    prof.frame_start = DWT->CYCCNT;
+    prof.in_frame = true;
+    __set_PRIMASK(primask);
+}
+
+void LCD_Prof_FrameEnd(void)
+{
+    uint32_t cycles[LCD_PROF_STAGE_COUNT], events[LCD_PROF_STAGE_COUNT];
+    uint32_t frame, primask;
+    bool first;
+
+    if (!prof.in_frame) {
+        return;
+    }
+    primask = __get_PRIMASK();
+    __disable_irq();
+    frame = DWT->CYCCNT - prof.frame_start;
+    for (uint32_t i = 0; i < LCD_PROF_STAGE_COUNT; i++) {
+        cycles[i] = prof.cycles[i];
+        events[i] = prof.events[i];
+    }
+    prof.in_frame = false;
+    __set_PRIMASK(primask);
+
+    first = (prof_stats.frames == 0U);
+    Prof_Record(&prof_stats.frame, frame, 1, first);
+    for (uint32_t i = 0; i < LCD_PROF_STAGE_COUNT; i++) {
+        Prof_Record(&prof_stats.stage[i], cycles[i], events[i], first);
+    }
+    prof_stats.frames++;
+}
+
+void LCD_Prof_Add(LCD_Prof_Stage_t stage, uint32_t t0)
+{
+    uint32_t dt = DWT->CYCCNT - t0;
+
+    if (!prof.in_frame || stage >= LCD_PROF_STAGE_COUNT) {
+        return;
+    }
+    prof.cycles[stage] += dt;
+    prof.events[stage]++;
+}
+
+void LCD_Prof_DmaStart(void)
+{
+    prof.dma_start = DWT->CYCCNT;
+    prof.dma_running = true;
+}
+
+void LCD_Prof_DmaDone(void)
+{
+    if (!prof.dma_running) {
+        return;
+    }
+    prof.dma_running = false;
+    if (prof.in_frame) {
+        prof.cycles[LCD_PROF_DMA] += DWT->CYCCNT - prof.dma_start;
+        prof.events[LCD_PROF_DMA]++;
+    }
+}
+
+void LCD_Prof_GetStats(LCD_Prof_Stats_t *stats)
+{
+    *stats = prof_stats;
+}
+
+/* 非零直方图格写成 "<上限us:帧数"，最后一格写成 ">=下限us:帧数" */
+static void Prof_FormatHist(char *buf, size_t size, const uint32_t *hist)
+{
+    size_t len = 0;
+
+    buf[0] = '\0';
+    for (uint32_t k = 0; k < LCD_PROF_HIST_BINS && len < size; k++) {
+        if (hist[k] == 0U) {
+            continue;
+        }
+        if (k == LCD_PROF_HIST_BINS - 1U) {
+            len += (size_t)snprintf(buf + len, size - len, " >=%lu:%lu",
+                                    (unsigned long)(1UL << (k - 1U)), (unsigned long)hist[k]);
+        } else {
+            len += (size_t)snprintf(buf + len, size - len, " <%lu:%lu",
+                                    (unsigned long)(1UL << k), (unsigned long)hist[k]);
+        }
+    }
+}
+
+/* 千分比写成 "12.3" */
+static void Prof_FormatPermille(char *buf, size_t size, uint32_t permille)
+{
+    snprintf(buf, size, "%lu.%lu", (unsigned long)(permille / 10U), (unsigned long)(permille % 10U));
+}
+
+void LCD_Prof_Report(const char *name, LCD_Prof_Print_t print)
+{
+    const LCD_Prof_Stats_t *s = &prof_stats;
+    uint32_t cyc_us = Prof_CyclesPerUs();
+    uint64_t frame_total = s->frame.cycles_total;
+    uint64_t cpu_total = 0;
+    uint32_t dma_pm, wait_pm, frames = s->frames;
+    char line[200], hist[120], pct[16];
+    const char *verdict;
+
+    if (frames == 0U || frame_total == 0U) {
+        snprintf(line, sizeof(line), "[Prof] %s: no frames\r\n", name);
+        print(line);
+        return;
+    }
+
+    dma_pm = (uint32_t)(s->stage[LCD_PROF_DMA].cycles_total * 1000U / frame_total);
+    wait_pm = (uint32_t)(s->stage[LCD_PROF_WAIT].cycles_total * 1000U / frame_total);
+    // DMA几乎一直在发送：缩短CPU时间没有用；等待很少：SPI有空闲，CPU是瓶颈
+    verdict = (dma_pm >= 800U) ? "SPI-bound" : (wait_pm <= 100U) ? "CPU-bound" : "mixed";
+
+    snprintf(line, sizeof(line),
+             "[Prof] %s: %lu frames, frame avg %lu us (min %lu max %lu), %lu.%lu fps, %s (dma %lu%%, wait %lu%%)\r\n",
+             name, (unsigned long)frames,
+             (unsigned long)(frame_total / frames / cyc_us),
+             (unsigned long)(s->frame.cycles_min / cyc_us), (unsigned long)(s->frame.cycles_max / cyc_us),
+             (unsigned long)((uint64_t)frames * SystemCoreClock / frame_total),
+             (unsigned long)((uint64_t)frames * SystemCoreClock * 10U / frame_total % 10U),
+             verdict, (unsigned long)(dma_pm / 10U), (unsigned long)(wait_pm / 10U));
+    print(line);
+    snprintf(line, sizeof(line), "[Prof]   %-8s %8s %8s %6s %8s  hist(us<bound:frames)\r\n",
+             "stage", "avg_us", "max_us", "frame%", "ev/frame");
+    print(line);
+
+    for (uint32_t i = 0; i < LCD_PROF_STAGE_COUNT; i++) {
+        const LCD_Prof_StageStats_t *st = &s->stage[i];
+
+        if (i != LCD_PROF_DMA) {
+            cpu_total += st->cycles_total;
+        }
+        Prof_FormatPermille(pct, sizeof(pct), (uint32_t)(st->cycles_total * 1000U / frame_total));
+        Prof_FormatHist(hist, sizeof(hist), st->hist);
+        snprintf(line, sizeof(line), "[Prof]   %-8s %8lu %8lu %6s %8lu %s\r\n",
+                 prof_stage_names[i], (unsigned long)(st->cycles_total / frames / cyc_us),
+                 (unsigned long)(st->cycles_max / cyc_us), pct, (unsigned long)(st->events / frames), hist);
+        print(line);
+    }
+
+    // 其余CPU时间：轮询发送、字模查找、应用逻辑
+    uint64_t other = (frame_total > cpu_total) ? frame_total - cpu_total : 0U;
+    Prof_FormatPermille(pct, sizeof(pct), (uint32_t)(other * 1000U / frame_total));
+    Prof_FormatHist(hist, sizeof(hist), s->frame.hist);
+    snprintf(line, sizeof(line), "[Prof]   %-8s %8lu %8s %6s %8s  frame hist:%s\r\n",
+             "other", (unsigned long)(other / frames / cyc_us), "-", pct, "-", hist);
+    print(line);
+}
@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @file    lcd_prof.h
+ * @brief   LCD流水线周期剖析 - 用DWT->CYCCNT统计各阶段每帧耗时，按帧累计直方图
+ ******************************************************************************
+ * @note
+ *   - 阶段：像素生成、缓冲区复制、窗口命令（CASET/RASET/RAMWR）、DMA传输、等待DMA/位块传输完成；
+ *     探针放在驱动内部（lcd_spi_dma.c、lcd_spi_dma_v2.c、lcd_spi_xfer.c、lcd_blit.c、lcd_display_list.c），
+ *     应用只需要用 LCD_Prof_FrameBegin/FrameEnd 划分帧
+ *   - FrameEnd 把本帧各阶段的总周期计入统计：平均/最小/最大和按微秒的log2直方图
+ *     （第k格为 [2^(k-1), 2^k) us，最后一格不设上限）
+ *   - DMA传输时间从启动DMA到SPI完成中断，与CPU阶段重叠；跨帧的传输计入完成时所在的帧
+ *   - 帧时间减去CPU阶段（像素、复制、命令、等待）为“其他”：轮询发送的文字/线段、应用逻辑等；
+ *     帧之间的主动延时不在帧内
+ *   - 不在帧内时探针读一次CYCCNT后直接返回；LCD_PROF_ENABLE 为0时探针全部编译为空
+ *   - 只有一个绘制任务；中断中的探针（DMA完成、作业队列在完成中断中发送的窗口命令）
+ *     与任务可能同时累加，偶尔丢失一次样本
+ ******************************************************************************
+ */
+
+#ifndef __LCD_PROF_H
+#define __LCD_PROF_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef LCD_PROF_ENABLE
+#define LCD_PROF_ENABLE         1
+#endif
+
+#define LCD_PROF_HIST_BINS      16          // <1us, 1us, 2us ... 16ms, >=16ms
+
+typedef enum {
+    LCD_PROF_PIXEL = 0,         // 像素生成：填充、混合、光栅化到缓冲区
+    LCD_PROF_COPY,              // 缓冲区复制：图像/帧缓冲拷贝到DMA缓冲区（软件路径）
+    LCD_PROF_SETADDR,           // 窗口命令：CASET/RASET/RAMWR 轮询发送
+    LCD_PROF_DMA,               // DMA传输中（与CPU阶段重叠）
+    LCD_PROF_WAIT,              // 任务等待SPI DMA或DMA2D完成
+    LCD_PROF_STAGE_COUNT
+} LCD_Prof_Stage_t;
+
+typedef struct {
+    uint64_t cycles_total;      // 所有帧累计
+    uint32_t cycles_min;        // 单帧最小
+    uint32_t cycles_max;        // 单帧最大
+    uint32_t events;            // 探针次数（DMA为传输次数，命令为窗口数）
+    uint32_t hist[LCD_PROF_HIST_BINS];
+} LCD_Prof_StageStats_t;
+
+typedef struct {
+    uint32_t frames;
+    LCD_Prof_StageStats_t frame;                        // 整帧时间
+    LCD_Prof_StageStats_t stage[LCD_PROF_STAGE_COUNT];
+} LCD_Prof_Stats_t;
+
+/* 报告按行输出，每行以 "\r\n" 结尾 */
+typedef void (*LCD_Prof_Print_t)(const char *line);
+
+#if LCD_PROF_ENABLE
+#define LCD_PROF_BEGIN(t)           uint32_t t = DWT->CYCCNT
+#define LCD_PROF_END(stage, t)      LCD_Prof_Add((stage), (t))
+#define LCD_PROF_DMA_START()        LCD_Prof_DmaStart()
+#define LCD_PROF_DMA_DONE()         LCD_Prof_DmaDone()
+#else
+#define LCD_PROF_BEGIN(t)           do { } while (0)
+#define LCD_PROF_END(stage, t)      do { } while (0)
+#define LCD_PROF_DMA_START()        do { } while (0)
+#define LCD_PROF_DMA_DONE()         do { } while (0)
+#endif
+
+/* 清零统计并使能DWT周期计数器 */
+void LCD_Prof_Reset(void);
+
+void LCD_Prof_FrameBegin(void);
+void LCD_Prof_FrameEnd(void);       // 未调用 FrameBegin 时忽略
+
+/* 探针：从 t0（DWT->CYCCNT）到现在的周期计入本帧的 stage */
+void LCD_Prof_Add(LCD_Prof_Stage_t stage, uint32_t t0);
+
+/* SPI DMA启动（任务）与完成（中断） */
+void LCD_Prof_DmaStart(void);
+void LCD_Prof_DmaDone(void);
+
+void LCD_Prof_GetStats(LCD_Prof_Stats_t *stats);
+
+/**
+ * @brief 输出紧凑报告：整帧与各阶段的平均/最大微秒、占帧时间的比例、非零直方图格，
+ *        以及按DMA占用和等待比例给出的瓶颈判断（SPI-bound / CPU-bound / mixed）
+ * @param name 场景名，出现在第一行
+ */
+void LCD_Prof_Report(const char *name, LCD_Prof_Print_t print);
+
+#endif /* __LCD_PROF_H */
@@ -0,0 +1,237 @@
+/**
+ ******************************************************************************
+ * @file    lcd_qoi.c
+ * @brief   无损图片（QOI变体，RGB565）- 流式解码器
+ ******************************************************************************
+ */
+
+#include "lcd_qoi.h"
+#include "lcd_spi_154.h"
+#include "lcd_blit.h"
+#include <string.h>
+
+/* 解码状态：跨行带保持，一个行带解完后从中断处继续 */
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    uint32_t run;                           // 上一像素还需重复的次数
+    uint16_t px;                            // 上一像素
+    uint16_t index[64];
+} QOI_State_t;
+
+static LCD_QOI_Stats_t qoi_stats;
+
+static HAL_StatusTypeDef QOI_Begin(QOI_State_t *s, const uint8_t *data, uint32_t size,
+                                   uint16_t *width, uint16_t *height)
+{
+    LCD_QOI_Header_t h;
+
+    if (data == NULL || size < sizeof(h)) {
+        return HAL_ERROR;
+    }
+    memcpy(&h, data, sizeof(h));
+    if (h.magic != LCD_QOI_MAGIC || h.width == 0U || h.height == 0U || h.data_size > size - sizeof(h)) {
+        return HAL_ERROR;
+    }
+    s->p = data + sizeof(h);
+    s->end = s->p + h.data_size;
+    s->run = 0;
+    s->px = 0;
+    memset(s->index, 0, sizeof(s->index));
+    *width = h.width;
+    *height = h.height;
+    return HAL_OK;
+}
+
+/**
+ * @brief 解码 rows 行到 dst
+ */
+static HAL_StatusTypeDef QOI_DecodeRows(QOI_State_t *s, uint16_t *dst, uint16_t width, uint32_t stride, uint32_t rows)
+{
+    const uint8_t *p = s->p, *end = s->end;
+    uint32_t run = s->run;
+    uint16_t px = s->px;
+    uint16_t *index = s->index;
+
+    for (uint32_t row = 0; row < rows; row++, dst += stride) {
+        uint32_t x = 0;
+
+        while (x < width) {
+            if (run != 0U) {
+                uint32_t n = (run < width - x) ? run : width - x;
+                uint16_t *d = &dst[x];
+                for (uint32_t i = 0; i < n; i++) {
+                    d[i] = px;
+                }
+                x += n;
+                run -= n;
+                continue;
+            }
+            if (p >= end) {
+                return HAL_ERROR;
+            }
+
+            uint8_t b0 = *p++;
+            if (b0 < LCD_QOI_OP_DIFF) {                             // INDEX
+                px = index[b0];
+                dst[x++] = px;
+                continue;
+            }
+            if (b0 >= LCD_QOI_OP_PIXEL) {                           // PIXEL / LONGRUN
+                if (end - p < 2) {
+                    return HAL_ERROR;
+                }
+                uint16_t v = (uint16_t)(p[0] | (p[1] << 8));
+                p += 2;
+                if (b0 == LCD_QOI_OP_LONGRUN) {
+                    run = 63U + v;
+                    continue;
+                }
+                px = v;
+            } else if (b0 >= LCD_QOI_OP_RUN) {                      // RUN
+                run = (uint32_t)(b0 & 0x3FU) + 1U;
+                continue;
+            } else {
+                uint32_t r = px >> 11, g = (px >> 5) & 0x3FU, b = px & 0x1FU;
+                if (b0 < LCD_QOI_OP_LUMA) {                         // DIFF
+                    r += ((b0 >> 4) & 3U) - 2U;
+                    g += ((b0 >> 2) & 3U) - 2U;
+                    b += (b0 & 3U) - 2U;
+                } else {                                            // LUMA
+                    if (p >= end) {
+                        return HAL_ERROR;
+                    }
+                    uint8_t b1 = *p++;
+                    int32_t dg = (int32_t)(b0 & 0x3FU) - 32;
+                    int32_t half = ((dg + 32) >> 1) - 16;           // dg/2 向下取整
+                    g += (uint32_t)dg;
+                    r += (uint32_t)((int32_t)(b1 >> 4) - 8 + half);
+                    b += (uint32_t)((int32_t)(b1 & 0x0FU) - 8 + half);
+                }
+                px = (uint16_t)(((r & 0x1FU) << 11) | ((g & 0x3FU) << 5) | (b & 0x1FU));
+            }
+            index[LCD_QOI_HASH(px)] = px;
+            dst[x++] = px;
+        }
+    }
+
+    s->p = p;
+    s->run = run;
+    s->px = px;
+    return HAL_OK;
+}
+
+/* 最后一行之后数据必须恰好用完 */
+static HAL_StatusTypeDef QOI_End(const QOI_State_t *s)
+{
+    return (s->run == 0U && s->p == s->end) ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef LCD_QOI_GetInfo(const uint8_t *data, uint32_t size, uint16_t *width, uint16_t *height)
+{
+    QOI_State_t s;
+
+    return QOI_Begin(&s, data, size, width, height);
+}
+
+HAL_StatusTypeDef LCD_QOI_Decode(const uint8_t *data, uint32_t size, uint16_t *dst, uint16_t dst_stride)
+{
+    QOI_State_t s;
+    uint16_t width, height;
+    uint32_t start = DWT->CYCCNT;
+    HAL_StatusTypeDef st;
+
+    if (QOI_Begin(&s, data, size, &width, &height) != HAL_OK || dst_stride < width) {
+        qoi_stats.errors++;
+        return HAL_ERROR;
+    }
+    st = QOI_DecodeRows(&s, dst, width, dst_stride, height);
+    if (st == HAL_OK) {
+        st = QOI_End(&s);
+    }
+
+    uint32_t cycles = DWT->CYCCNT - start;
+    qoi_stats.decode_cycles += cycles;
+    qoi_stats.last_cycles = cycles;
+    if (st == HAL_OK) {
+        qoi_stats.images++;
+        qoi_stats.pixels += (uint32_t)width * height;
+        qoi_stats.bytes += sizeof(LCD_QOI_Header_t) + (uint32_t)(s.end - (data + sizeof(LCD_QOI_Header_t)));
+    } else {
+        qoi_stats.errors++;
+    }
+    return st;
+}
+
+HAL_StatusTypeDef LCD_QOI_Draw(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
+                               const uint8_t *data, uint32_t size)
+{
+    QOI_State_t s;
+    uint16_t width, height;
+    HAL_StatusTypeDef st = HAL_OK;
+    uint32_t start = DWT->CYCCNT, decode = 0;
+
+    if (QOI_Begin(&s, data, size, &width, &height) != HAL_OK ||
+        x + width > LCD_WIDTH || y + height > LCD_HEIGHT) {
+        qoi_stats.errors++;
+        return HAL_ERROR;
+    }
+
+    if (hlcd->frame_buffer_enabled) {
+        // 帧缓冲模式 - 解码到帧缓冲（先等待未完成的位块传输）
+        LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+        st = LCD_QOI_Decode(data, size, &hlcd->frame_buffer[y * LCD_WIDTH + x], LCD_WIDTH);
+        LCD_FB_MarkDirty(hlcd, x, y, width, height);
+        return st;
+    }
+
+    // 直接模式 - 每个行带是DMA缓冲区能容纳的最多整行
+    uint32_t band_rows = hlcd->dma_buffer_size / width;
+
+    LCD_SPI_DMA_SetWindow(hlcd, x, y, width, height);
+    for (uint32_t row = 0; row < height && st == HAL_OK; row += band_rows) {
+        uint32_t rows = (height - row < band_rows) ? height - row : band_rows;
+        uint16_t *band = hlcd->dma_buffer[hlcd->current_buffer];
+        uint32_t t0 = DWT->CYCCNT;
+
+        st = QOI_DecodeRows(&s, band, width, width, rows);
+        if (st == HAL_OK && row + rows == height) {
+            st = QOI_End(&s);
+        }
+        decode += DWT->CYCCNT - t0;
+        if (st != HAL_OK) {
+            break;
+        }
+        // WriteBuffer_Async 先等待上一块发送完成，再发送这一块
+        st = LCD_SPI_DMA_WriteBuffer_Async(hlcd, band, rows * width);
+        hlcd->current_buffer = (hlcd->current_buffer + 1) % 2;
+    }
+
+    // 等待最后一次完成
+    HAL_StatusTypeDef wait = LCD_SPI_DMA_WaitComplete(hlcd);
+    LCD_CS_Deselect;
+    if (st == HAL_OK) {
+        st = wait;
+    }
+
+    qoi_stats.decode_cycles += decode;
+    qoi_stats.last_cycles = DWT->CYCCNT - start;
+    if (st == HAL_OK) {
+        qoi_stats.images++;
+        qoi_stats.pixels += (uint32_t)width * height;
+        qoi_stats.bytes += sizeof(LCD_QOI_Header_t) + (uint32_t)(s.end - (data + sizeof(LCD_QOI_Header_t)));
+    } else {
+        qoi_stats.errors++;
+    }
+    return st;
+}
+
+void LCD_QOI_GetStats(LCD_QOI_Stats_t *stats)
+{
+    *stats = qoi_stats;
+}
+
+void LCD_QOI_ResetStats(void)
+{
+    memset(&qoi_stats, 0, sizeof(qoi_stats));
+}
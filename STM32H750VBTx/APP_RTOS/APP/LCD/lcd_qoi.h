@@ -0,0 +1,84 @@
+/**
+ ******************************************************************************
+ * @file    lcd_qoi.h
+ * @brief   无损图片（QOI变体，直接编码RGB565）- 逐行带流式解码到DMA双缓冲
+ ******************************************************************************
+ * @note
+ *   - 用于图标、背景、渐变等不能有JPEG失真的界面素材，由 Host/Tools/host_qoic 生成
+ *   - 文件头 LCD_QOI_Header_t（12字节，小端）之后为字节流操作，r/g/b 为5/6/5位分量：
+ *       00iiiiii           INDEX   颜色表第 i 项（64项，位置为 (r*3+g*5+b*7)%64）
+ *       01rrggbb           DIFF    与上一像素的差 dr/dg/db 各 -2~1（加2存储，分量按位宽回绕）
+ *       10gggggg rrrrbbbb  LUMA    dg -32~31（加32），dr-dg/2、db-dg/2 各 -8~7（加8），dg/2向下取整
+ *       11nnnnnn           RUN     重复上一像素 n+1 次（n 为 0~61）
+ *       11111110 lo hi     PIXEL   RGB565像素
+ *       11111111 lo hi     LONGRUN 重复上一像素 63+n 次
+ *     上一像素初始为0，颜色表初始全0；每个非RUN操作之后把像素写入颜色表
+ *   - 无损：解码结果与编码时的RGB565逐像素相同；数据必须恰好解出 width*height 个像素
+ *   - 直接模式边解码边发送：行带写入 LCD_DMA_DrawImage 使用的两个DMA缓冲区，
+ *     一块经SPI发送时解码下一块，不需要整图缓冲；帧缓冲模式直接解码到帧缓冲
+ *   - 同一时刻只有一个任务使用本模块
+ ******************************************************************************
+ */
+
+#ifndef __LCD_QOI_H
+#define __LCD_QOI_H
+
+#include "stm32h7xx_hal.h"
+#include "lcd_spi_dma.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LCD_QOI_MAGIC       0x35363551U     // "Q565"
+
+#define LCD_QOI_OP_INDEX    0x00U
+#define LCD_QOI_OP_DIFF     0x40U
+#define LCD_QOI_OP_LUMA     0x80U
+#define LCD_QOI_OP_RUN      0xC0U
+#define LCD_QOI_OP_PIXEL    0xFEU
+#define LCD_QOI_OP_LONGRUN  0xFFU
+#define LCD_QOI_RUN_MAX     62U             // RUN 操作的最大长度
+#define LCD_QOI_LONGRUN_MAX (63U + 0xFFFFU)
+
+/* 颜色表位置 */
+#define LCD_QOI_HASH(px)    ((((px) >> 11) * 3U + (((px) >> 5) & 0x3FU) * 5U + ((px) & 0x1FU) * 7U) & 63U)
+
+typedef struct {
+    uint32_t magic;
+    uint16_t width;
+    uint16_t height;
+    uint32_t data_size;                     // 文件头之后的字节数
+} LCD_QOI_Header_t;
+
+typedef struct {
+    uint32_t images;                        // 解码成功的图片数
+    uint32_t errors;                        // 格式错误、数据损坏或发送失败
+    uint64_t pixels;                        // 解码的像素数
+    uint64_t bytes;                         // 读取的压缩数据字节数（含文件头）
+    uint64_t decode_cycles;                 // 解码本身的周期数（不含等待DMA）
+    uint32_t last_cycles;                   // 最近一张图片从开始到最后一块发送完成的周期数
+} LCD_QOI_Stats_t;
+
+/**
+ * @brief 检查文件头，得到尺寸
+ * @retval HAL_ERROR 不是QOI565数据或长度不符
+ */
+HAL_StatusTypeDef LCD_QOI_GetInfo(const uint8_t *data, uint32_t size, uint16_t *width, uint16_t *height);
+
+/**
+ * @brief 解码整张图片到 RGB565 缓冲区
+ * @param dst_stride 目标每行的像素数，不小于图片宽度
+ */
+HAL_StatusTypeDef LCD_QOI_Decode(const uint8_t *data, uint32_t size, uint16_t *dst, uint16_t dst_stride);
+
+/**
+ * @brief 在 (x, y) 显示图片，图片必须完整位于屏幕内
+ * @note  直接模式：设置一次窗口，逐行带解码到DMA双缓冲并异步发送，返回前等待最后一块完成；
+ *        帧缓冲模式：解码到帧缓冲并标记脏块
+ */
+HAL_StatusTypeDef LCD_QOI_Draw(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
+                               const uint8_t *data, uint32_t size);
+
+void LCD_QOI_GetStats(LCD_QOI_Stats_t *stats);
+void LCD_QOI_ResetStats(void);
+
+#endif /* __LCD_QOI_H */
@@ -0,0 +1,377 @@
+/**
+ ******************************************************************************
+ * @file    lcd_raster.c
+ * @brief   线段/圆/椭圆的游程光栅化
+ ******************************************************************************
+ * @note
+ *   每个图元按走线顺序逐点送入游程累加器（线段1个，圆/椭圆每个象限1个），
+ *   累加器把与上一点相邻且方向一致的点接在当前游程后面，方向改变、出现
+ *   不相邻的点、遇到裁剪或游程已满时把游程交给 sink 输出
+ ******************************************************************************
+ */
+
+#include "lcd_raster.h"
+#include "lcd_blend.h"
+#include <stddef.h>
+
+/* 游程累加器 */
+typedef struct {
+    int16_t  x, y;              // 第一个点
+    int16_t  lx, ly;            // 最后一个点
+    int8_t   dx, dy;            // 走线方向，len >= 2 时有效
+    uint16_t len;
+    uint16_t colors[LCD_RASTER_MAX_RUN];
+} Raster_Run_t;
+
+#define RASTER_RUNS             16      // 抗锯齿圆：8个八分圆 x 内外两层
+
+static Raster_Run_t raster_runs[RASTER_RUNS];
+
+/**
+ * @brief 输出一个游程，反向走线的游程翻转为坐标递增顺序
+ */
+static void Raster_Flush(const LCD_Raster_t *r, Raster_Run_t *run)
+{
+    uint16_t len = run->len;
+    int16_t  x = run->x;
+    int16_t  y = run->y;
+    bool     vertical = false;
+
+    if (len == 0) {
+        return;
+    }
+
+    if (len > 1) {
+        vertical = (run->dx == 0);
+        if (run->dx < 0 || run->dy < 0) {
+            for (uint16_t i = 0, j = len - 1; i < j; i++, j--) {
+                uint16_t t = run->colors[i];
+                run->colors[i] = run->colors[j];
+                run->colors[j] = t;
+            }
+            x = run->lx;
+            y = run->ly;
+        }
+    }
+
+    r->sink(r->ctx, (uint16_t)x, (uint16_t)y, len, vertical, run->colors);
+    run->len = 0;
+}
+
+/**
+ * @brief 把一个点加入游程
+ * @note  与最后一个点重合时只更新颜色（八分圆交界处、Bresenham 原地迭代）
+ */
+static void Raster_Plot(const LCD_Raster_t *r, Raster_Run_t *run, int16_t x, int16_t y, uint16_t color)
+{
+    if (x < 0 || y < 0 || x >= (int16_t)r->width || y >= (int16_t)r->height) {
+        Raster_Flush(r, run);
+        return;
+    }
+
+    if (run->len > 0) {
+        int16_t ddx = x - run->lx;
+        int16_t ddy = y - run->ly;
+
+        if (ddx == 0 && ddy == 0) {
+            run->colors[run->len - 1] = color;
+            return;
+        }
+
+        bool adjacent = ((ddx == 0) != (ddy == 0)) && ddx >= -1 && ddx <= 1 && ddy >= -1 && ddy <= 1;
+        if (adjacent && run->len > 1) {
+            adjacent = (ddx == run->dx && ddy == run->dy);
+        }
+
+        if (!adjacent || run->len == LCD_RASTER_MAX_RUN) {
+            Raster_Flush(r, run);
+        } else if (run->len == 1) {
+            run->dx = (int8_t)ddx;
+            run->dy = (int8_t)ddy;
+        }
+    }
+
+    if (run->len == 0) {
+        run->x = x;
+        run->y = y;
+    }
+    run->colors[run->len++] = color;
+    run->lx = x;
+    run->ly = y;
+}
+
+static void Raster_Reset(uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++) {
+        raster_runs[i].len = 0;
+    }
+}
+
+static void Raster_FlushAll(const LCD_Raster_t *r, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++) {
+        Raster_Flush(r, &raster_runs[i]);
+    }
+}
+
+/* 0~32 覆盖率对应的颜色 */
+static inline uint16_t Raster_Shade(uint16_t fg, uint16_t bg, uint32_t alpha)
+{
+    return LCD_Blend565(fg, bg, alpha);
+}
+
+/**
+ * @brief 整数平方根，返回 floor(sqrt(v))
+ */
+static uint32_t Raster_Sqrt(uint32_t v)
+{
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > v) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (v >= res + bit) {
+            v -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+/**
+ * @brief 线段，与原 LCD_DrawLine 的 Bresenham 走线逐点一致
+ */
+void LCD_Raster_Line(const LCD_Raster_t *r, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
+{
+    Raster_Run_t *run = &raster_runs[0];
+    int16_t deltax = (x2 > x1) ? (x2 - x1) : (x1 - x2);
+    int16_t deltay = (y2 > y1) ? (y2 - y1) : (y1 - y2);
+    int16_t xinc1 = (x2 >= x1) ? 1 : -1;
+    int16_t yinc1 = (y2 >= y1) ? 1 : -1;
+    int16_t xinc2 = xinc1;
+    int16_t yinc2 = yinc1;
+    int16_t den, num, numadd, numpixels;
+    int16_t x = x1;
+    int16_t y = y1;
+
+    if (deltax >= deltay) {
+        xinc1 = 0;
+        yinc2 = 0;
+        den = deltax;
+        num = deltax / 2;
+        numadd = deltay;
+        numpixels = deltax;
+    } else {
+        xinc2 = 0;
+        yinc1 = 0;
+        den = deltay;
+        num = deltay / 2;
+        numadd = deltax;
+        numpixels = deltay;
+    }
+
+    Raster_Reset(1);
+    for (int16_t i = 0; i <= numpixels; i++) {
+        Raster_Plot(r, run, x, y, color);
+        num += numadd;
+        if (num >= den) {
+            num -= den;
+            x += xinc1;
+            y += yinc1;
+        }
+        x += xinc2;
+        y += yinc2;
+    }
+    Raster_Flush(r, run);
+}
+
+/**
+ * @brief 圆，与原 LCD_DrawCircle 逐点一致，每个象限一个游程累加器
+ */
+void LCD_Raster_Circle(const LCD_Raster_t *r, int16_t x, int16_t y, uint16_t radius, uint16_t color)
+{
+    int xadd = -(int)radius, yadd = 0, err = 2 - 2 * (int)radius, e2;
+
+    Raster_Reset(4);
+    do {
+        Raster_Plot(r, &raster_runs[0], x - xadd, y + yadd, color);
+        Raster_Plot(r, &raster_runs[1], x + xadd, y + yadd, color);
+        Raster_Plot(r, &raster_runs[2], x + xadd, y - yadd, color);
+        Raster_Plot(r, &raster_runs[3], x - xadd, y - yadd, color);
+
+        e2 = err;
+        if (e2 <= yadd) {
+            err += ++yadd * 2 + 1;
+            if (-xadd == yadd && e2 <= xadd) {
+                e2 = 0;
+            }
+        }
+        if (e2 > xadd) {
+            err += ++xadd * 2 + 1;
+        }
+    } while (xadd <= 0);
+    Raster_FlushAll(r, 4);
+}
+
+static void Raster_Plot4(const LCD_Raster_t *r, int16_t cx, int16_t cy, int16_t x, int16_t y, uint16_t color)
+{
+    Raster_Plot(r, &raster_runs[0], cx + x, cy + y, color);
+    Raster_Plot(r, &raster_runs[1], cx - x, cy + y, color);
+    Raster_Plot(r, &raster_runs[2], cx - x, cy - y, color);
+    Raster_Plot(r, &raster_runs[3], cx + x, cy - y, color);
+}
+
+/**
+ * @brief 椭圆，中点算法；判别式放大4倍以避免小数，使用64位以支持整屏大小的半轴
+ */
+void LCD_Raster_Ellipse(const LCD_Raster_t *r, int16_t x, int16_t y, uint16_t rx, uint16_t ry, uint16_t color)
+{
+    int64_t rx2 = (int64_t)rx * rx;
+    int64_t ry2 = (int64_t)ry * ry;
+    int64_t px, py, p;
+    int16_t ex = 0;
+    int16_t ey = (int16_t)ry;
+
+    if (rx == 0 || ry == 0) {
+        LCD_Raster_Line(r, x - rx, y - ry, x + rx, y + ry, color);
+        return;
+    }
+
+    Raster_Reset(4);
+
+    /* 区域1：斜率绝对值小于1，x 每步加1 */
+    px = 0;
+    py = 2 * rx2 * ey;
+    p  = 4 * ry2 - 4 * rx2 * ry + rx2;
+    while (px < py) {
+        Raster_Plot4(r, x, y, ex, ey, color);
+        ex++;
+        px += 2 * ry2;
+        if (p < 0) {
+            p += 4 * (ry2 + px);
+        } else {
+            ey--;
+            py -= 2 * rx2;
+            p += 4 * (ry2 + px - py);
+        }
+    }
+
+    /* 区域2：y 每步减1 */
+    p = ry2 * (2 * ex + 1) * (2 * ex + 1) + 4 * rx2 * (ey - 1) * (ey - 1) - 4 * rx2 * ry2;
+    while (ey >= 0) {
+        Raster_Plot4(r, x, y, ex, ey, color);
+        ey--;
+        py -= 2 * rx2;
+        if (p > 0) {
+            p += 4 * (rx2 - py);
+        } else {
+            ex++;
+            px += 2 * ry2;
+            p += 4 * (rx2 - py + px);
+        }
+    }
+    Raster_FlushAll(r, 4);
+}
+
+/**
+ * @brief 抗锯齿线段（Wu算法）
+ * @note  16.16 定点步进，每个主方向坐标输出上下两个像素，覆盖率取小数部分高5位；
+ *        端点为整数坐标，覆盖率为32
+ */
+void LCD_Raster_LineAA(const LCD_Raster_t *r, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                       uint16_t fg, uint16_t bg)
+{
+    int16_t adx = (x2 > x1) ? (x2 - x1) : (x1 - x2);
+    int16_t ady = (y2 > y1) ? (y2 - y1) : (y1 - y2);
+    bool    steep = ady > adx;
+    int16_t t;
+    int32_t gradient, intery;
+
+    if (steep) {
+        t = x1; x1 = y1; y1 = t;
+        t = x2; x2 = y2; y2 = t;
+    }
+    if (x1 > x2) {
+        t = x1; x1 = x2; x2 = t;
+        t = y1; y1 = y2; y2 = t;
+    }
+
+    gradient = (x2 != x1) ? (((int32_t)(y2 - y1) << 16) / (x2 - x1)) : 0;
+    intery = (int32_t)y1 << 16;
+
+    Raster_Reset(2);
+    for (int16_t x = x1; x <= x2; x++) {
+        int16_t  yi = (int16_t)(intery >> 16);
+        uint32_t frac = ((uint32_t)intery >> 11) & 0x1F;
+
+        if (steep) {
+            Raster_Plot(r, &raster_runs[0], yi, x, Raster_Shade(fg, bg, LCD_BLEND_ALPHA_MAX - frac));
+            if (frac) {
+                Raster_Plot(r, &raster_runs[1], yi + 1, x, Raster_Shade(fg, bg, frac));
+            }
+        } else {
+            Raster_Plot(r, &raster_runs[0], x, yi, Raster_Shade(fg, bg, LCD_BLEND_ALPHA_MAX - frac));
+            if (frac) {
+                Raster_Plot(r, &raster_runs[1], x, yi + 1, Raster_Shade(fg, bg, frac));
+            }
+        }
+        intery += gradient;
+    }
+    Raster_FlushAll(r, 2);
+}
+
+/**
+ * @brief 抗锯齿圆（Wu算法）
+ * @note  在第一个八分圆内对每个 x 求 y = sqrt(r^2 - x^2)（5位小数），
+ *        内侧像素覆盖率为 32-小数、外侧为小数，再对称到8个八分圆，
+ *        最后补画对角线上的像素；
+ *        每个八分圆的内外两层各用一个游程累加器
+ */
+void LCD_Raster_CircleAA(const LCD_Raster_t *r, int16_t x, int16_t y, uint16_t radius,
+                         uint16_t fg, uint16_t bg)
+{
+    static const int8_t oct[8][3] = {       // x符号, y符号, 交换xy
+        { 1,  1, 0}, {-1,  1, 0}, { 1, -1, 0}, {-1, -1, 0},
+        { 1,  1, 1}, {-1,  1, 1}, { 1, -1, 1}, {-1, -1, 1},
+    };
+    uint32_t r2 = (uint32_t)radius * radius;
+
+    Raster_Reset(16);
+    for (int16_t ox = 0; ; ox++) {
+        uint32_t ys = Raster_Sqrt((r2 - (uint32_t)ox * ox) << 10);
+        int16_t  oy = (int16_t)(ys >> 5);
+        uint32_t frac = ys & 0x1F;
+        uint16_t inner, outer;
+
+        if (ox > oy) {
+            /* 对角线上的像素 (ox,ox) 只是上一列的外侧像素，补画后结束 */
+            if (ox == oy + 1 && frac) {
+                outer = Raster_Shade(fg, bg, frac);
+                for (uint8_t k = 0; k < 4; k++) {
+                    Raster_Plot(r, &raster_runs[k * 2 + 1], x + oct[k][0] * ox, y + oct[k][1] * ox, outer);
+                }
+            }
+            break;
+        }
+        inner = Raster_Shade(fg, bg, LCD_BLEND_ALPHA_MAX - frac);
+        outer = Raster_Shade(fg, bg, frac);
+
+        for (uint8_t k = 0; k < 8; k++) {
+            int16_t px = oct[k][2] ? oy : ox;
+            int16_t py = oct[k][2] ? ox : oy;
+            int16_t qx = oct[k][2] ? (oy + 1) : ox;
+            int16_t qy = oct[k][2] ? ox : (oy + 1);
+
+            Raster_Plot(r, &raster_runs[k * 2], x + oct[k][0] * px, y + oct[k][1] * py, inner);
+            if (frac) {
+                Raster_Plot(r, &raster_runs[k * 2 + 1], x + oct[k][0] * qx, y + oct[k][1] * qy, outer);
+            }
+        }
+    }
+    Raster_FlushAll(r, 16);
+}
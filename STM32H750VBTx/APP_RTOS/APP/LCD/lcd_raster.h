@@ -0,0 +1,57 @@
+/**
+ ******************************************************************************
+ * @file    lcd_raster.h
+ * @brief   线段/圆/椭圆的游程光栅化 - 把逐点输出合并为水平或垂直的游程
+ ******************************************************************************
+ * @note
+ *   - 逐点绘制时每个像素都要单独设置一次窗口（CASET/RASET/RAMWR），
+ *     这里把相邻的同方向像素合并为一段，每段只设置一次窗口、连续写入
+ *   - 光栅化与传输分离：游程通过 sink 回调输出，lcd_spi_154.c 中写入屏幕，
+ *     主机端测试中写入内存校验
+ *   - LCD_Raster_Line / LCD_Raster_Circle 输出的像素与原 LCD_DrawLine / LCD_DrawCircle
+ *     逐点绘制的完全相同，只是合并了传输
+ *   - 抗锯齿（Wu算法，定点运算）版本按 0~32 的覆盖率与背景色混合（纯色背景）
+ *   - 内部使用静态游程缓冲区，不可重入，与 lcd_spi_154.c 一样只应在同一个任务中调用
+ ******************************************************************************
+ */
+
+#ifndef __LCD_RASTER_H
+#define __LCD_RASTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LCD_RASTER_MAX_RUN      64      // 单个游程最大像素数，超过时拆为多段
+
+/**
+ * @brief 游程输出回调
+ * @param vertical false 为水平游程 (x..x+len-1, y)，true 为垂直游程 (x, y..y+len-1)
+ * @param colors   len 个RGB565颜色，按坐标递增顺序排列
+ */
+typedef void (*LCD_Raster_Sink_t)(void *ctx, uint16_t x, uint16_t y, uint16_t len,
+                                  bool vertical, const uint16_t *colors);
+
+/* 光栅化目标 */
+typedef struct {
+    LCD_Raster_Sink_t sink;
+    void    *ctx;
+    uint16_t width;             // 裁剪区域，超出 [0,width)x[0,height) 的像素丢弃
+    uint16_t height;
+} LCD_Raster_t;
+
+void LCD_Raster_Line(const LCD_Raster_t *r, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+void LCD_Raster_Circle(const LCD_Raster_t *r, int16_t x, int16_t y, uint16_t radius, uint16_t color);
+
+/**
+ * @brief 椭圆（中点算法，整数运算）
+ * @param rx,ry 水平、垂直半轴长度
+ */
+void LCD_Raster_Ellipse(const LCD_Raster_t *r, int16_t x, int16_t y, uint16_t rx, uint16_t ry, uint16_t color);
+
+/* 抗锯齿线段/圆，fg 为线条颜色，bg 为背景色 */
+void LCD_Raster_LineAA(const LCD_Raster_t *r, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                       uint16_t fg, uint16_t bg);
+void LCD_Raster_CircleAA(const LCD_Raster_t *r, int16_t x, int16_t y, uint16_t radius,
+                         uint16_t fg, uint16_t bg);
+
+#endif /* __LCD_RASTER_H */
@@ -26,6 +26,10 @@
 ***/
 
 #include "lcd_spi_154.h"
+#include "lcd_glyph_cache.h"
+#include "lcd_font_index.h"
+#include "lcd_raster.h"
+#include "lcd_spi_xfer.h"
 #include "spi.h"
 #include <stdio.h>
 
@@ -56,10 +60,8 @@ struct	//LCD相关参数结构体
    uint8_t  Y_Offset;         // Y坐标偏移，用于设置屏幕控制器的显存写入方式
 }LCD;
 
-// 该函数修改于HAL的SPI库函数，专为 LCD_Clear() 清屏函数修改，
-// 目的是为了SPI传输数据不限数据长度的写入
-HAL_StatusTypeDef LCD_SPI_Transmit(SPI_HandleTypeDef *hspi, uint16_t pData, uint32_t Size);
-HAL_StatusTypeDef LCD_SPI_TransmitBuffer (SPI_HandleTypeDef *hspi, uint16_t *pData, uint32_t Size);
+// 命令/数据的发送经 lcd_spi_xfer.c 完成：直接改写SPI寄存器切换8位/16位帧宽，
+// 不再反复调用 HAL_SPI_Init；设置坐标、写显存在同一次片选内完成
 
 // Note: HAL_SPI_MspInit 和 MX_SPI4_Init 已在 Core/Src/spi.c 中定义
 
@@ -74,11 +76,9 @@ HAL_StatusTypeDef LCD_SPI_TransmitBuffer (SPI_HandleTypeDef *hspi, uint16_t *pDa
 
 void  LCD_WriteCommand(uint8_t lcd_command)
 {
-   LCD_CS_Select;      // 选中LCD，CS引脚输出低电平
-   LCD_DC_Command;     // 数据指令选择 引脚输出低电平，代表本次传输 指令
-
-   HAL_SPI_Transmit(&LCD_SPI, &lcd_command, 1, 1000); // 启动SPI传输
-   LCD_CS_Deselect;    // 取消选中LCD，CS引脚输出高电平
+   LCD_Xfer_Begin(&LCD_SPI);                    // 选中LCD
+   LCD_Xfer_Command(&LCD_SPI, lcd_command);     // DC输出低电平，发送指令
+   LCD_Xfer_End(&LCD_SPI);                      // 取消选中LCD
 }
 
 /****************************************************************************************************************************************
@@ -92,11 +92,9 @@ void  LCD_WriteCommand(uint8_t lcd_command)
 
 void  LCD_WriteData_8bit(uint8_t lcd_data)
 {
-   LCD_CS_Select;      // 选中LCD，CS引脚输出低电平
-   LCD_DC_Data;     // 数据指令选择 引脚输出高电平，代表本次传输 数据
-
-   HAL_SPI_Transmit(&LCD_SPI, &lcd_data, 1, 1000) ; // 启动SPI传输
-   LCD_CS_Deselect;    // 取消选中LCD，CS引脚输出高电平
+   LCD_Xfer_Begin(&LCD_SPI);                    // 选中LCD
+   LCD_Xfer_Data8(&LCD_SPI, &lcd_data, 1);      // DC输出高电平，发送数据
+   LCD_Xfer_End(&LCD_SPI);                      // 取消选中LCD
 }
 
 /****************************************************************************************************************************************
@@ -110,15 +108,9 @@ void  LCD_WriteData_8bit(uint8_t lcd_data)
 
 void  LCD_WriteData_16bit(uint16_t lcd_data)
 {
-   uint8_t lcd_data_buff[2];    // 数据发送区
-   LCD_CS_Select;      // 选中LCD，CS引脚输出低电平
-   LCD_DC_Data;      // 数据指令选择 引脚输出高电平，代表本次传输 数据
-
-   lcd_data_buff[0] = lcd_data>>8;  // 将数据拆分
-   lcd_data_buff[1] = lcd_data;
-
-	HAL_SPI_Transmit(&LCD_SPI, lcd_data_buff, 2, 1000) ;   // 启动SPI传输
-	LCD_CS_Deselect;    // 取消选中LCD，CS引脚输出高电平
+   LCD_Xfer_Begin(&LCD_SPI);                    // 选中LCD
+   LCD_Xfer_Data16(&LCD_SPI, &lcd_data, 1);     // 16位帧，高字节在前
+   LCD_Xfer_End(&LCD_SPI);                      // 取消选中LCD
 }
 
 /****************************************************************************************************************************************
@@ -132,19 +124,9 @@ void  LCD_WriteData_16bit(uint16_t lcd_data)
 
 void  LCD_WriteBuff(uint16_t *DataBuff, uint16_t DataSize)
 {
-	LCD_CS_Select;      // 选中LCD，CS引脚输出低电平
-	LCD_DC_Data;     // 数据指令选择 引脚输出高电平，代表本次传输 数据
-
-// 修改为16位数据宽度，写入数据更加效率，不需要拆分
-   LCD_SPI.Init.DataSize 	= SPI_DATASIZE_16BIT;   //	16位数据宽度
-   HAL_SPI_Init(&LCD_SPI);
-
-	HAL_SPI_Transmit(&LCD_SPI, (uint8_t *)DataBuff, DataSize, 1000) ; // 启动SPI传输
-
-// 改回8位数据宽度，因为指令和部分数据都是按照8位传输的
-	LCD_SPI.Init.DataSize 	= SPI_DATASIZE_8BIT;    //	8位数据宽度
-   HAL_SPI_Init(&LCD_SPI);
-   LCD_CS_Deselect;    // 取消选中LCD，CS引脚输出高电平
+   LCD_Xfer_Begin(&LCD_SPI);                          // 选中LCD
+   LCD_Xfer_Data16(&LCD_SPI, DataBuff, DataSize);     // 16位帧宽直接写寄存器切换，不需要拆分
+   LCD_Xfer_End(&LCD_SPI);                            // 取消选中LCD
 }
 
 /****************************************************************************************************************************************
@@ -263,15 +245,10 @@ void SPI_LCD_Init(void)
 
 void LCD_SetAddress(uint16_t x1,uint16_t y1,uint16_t x2,uint16_t y2)		
 {
-	LCD_WriteCommand(0x2a);			//	列地址设置，即X坐标
-	LCD_WriteData_16bit(x1+LCD.X_Offset);
-	LCD_WriteData_16bit(x2+LCD.X_Offset);
-
-	LCD_WriteCommand(0x2b);			//	行地址设置，即Y坐标
-	LCD_WriteData_16bit(y1+LCD.Y_Offset);
-	LCD_WriteData_16bit(y2+LCD.Y_Offset);
-
-	LCD_WriteCommand(0x2c);			//	开始写入显存，即要显示的颜色数据
+	LCD_Xfer_Begin(&LCD_SPI);
+	LCD_Xfer_Window(&LCD_SPI, x1+LCD.X_Offset, y1+LCD.Y_Offset,		//	列地址、行地址设置，开始写入显存
+	                          x2+LCD.X_Offset, y2+LCD.Y_Offset);
+	LCD_Xfer_End(&LCD_SPI);
 }
 
 /****************************************************************************************************************************************
@@ -402,21 +379,10 @@ void LCD_SetAsciiFont(pFONT *Asciifonts)
 
 void LCD_Clear(void)
 {
-   LCD_SetAddress(0,0,LCD.Width-1,LCD.Height-1);	// 设置坐标
-
-	LCD_CS_Select;      // 选中LCD，CS引脚输出低电平
-	LCD_DC_Data;     // 数据指令选择 引脚输出高电平，代表本次传输 数据
-
-// 修改为16位数据宽度，写入数据更加效率，不需要拆分
-   LCD_SPI.Init.DataSize 	= SPI_DATASIZE_16BIT;   //	16位数据宽度
-   HAL_SPI_Init(&LCD_SPI);
-
-   LCD_SPI_Transmit(&LCD_SPI, LCD.BackColor, LCD.Width * LCD.Height) ;   // 启动传输
-
-// 改回8位数据宽度，因为指令和部分数据都是按照8位传输的
-	LCD_SPI.Init.DataSize 	= SPI_DATASIZE_8BIT;    //	8位数据宽度
-   HAL_SPI_Init(&LCD_SPI);
-   LCD_CS_Deselect;    // 取消选中LCD，CS引脚输出高电平
+   LCD_Xfer_Begin(&LCD_SPI);                                      // 设置坐标和写显存在同一次片选内完成
+   LCD_Xfer_Window(&LCD_SPI, LCD.X_Offset, LCD.Y_Offset, LCD.Width-1+LCD.X_Offset, LCD.Height-1+LCD.Y_Offset);
+   LCD_Xfer_Fill16(&LCD_SPI, LCD.BackColor, LCD.Width * LCD.Height);
+   LCD_Xfer_End(&LCD_SPI);
 }
 
 /****************************************************************************************************************************************
@@ -436,22 +402,10 @@ void LCD_Clear(void)
 
 void LCD_ClearRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
 {
-   LCD_SetAddress( x, y, x+width-1, y+height-1);	// 设置坐标
-
-	LCD_CS_Select;      // 选中LCD，CS引脚输出低电平
-	LCD_DC_Data;     // 数据指令选择 引脚输出高电平，代表本次传输 数据
-
-// 修改为16位数据宽度，写入数据更加效率，不需要拆分
-   LCD_SPI.Init.DataSize 	= SPI_DATASIZE_16BIT;   //	16位数据宽度
-   HAL_SPI_Init(&LCD_SPI);
-
-   LCD_SPI_Transmit(&LCD_SPI, LCD.BackColor, width*height) ;  // 启动传输
-
-// 改回8位数据宽度，因为指令和部分数据都是按照8位传输的
-	LCD_SPI.Init.DataSize 	= SPI_DATASIZE_8BIT;    //	8位数据宽度
-   HAL_SPI_Init(&LCD_SPI);
-   LCD_CS_Deselect;    // 取消选中LCD，CS引脚输出高电平
-
+   LCD_Xfer_Begin(&LCD_SPI);                                      // 设置坐标和写显存在同一次片选内完成
+   LCD_Xfer_Window(&LCD_SPI, x+LCD.X_Offset, y+LCD.Y_Offset, x+width-1+LCD.X_Offset, y+height-1+LCD.Y_Offset);
+   LCD_Xfer_Fill16(&LCD_SPI, LCD.BackColor, width*height);
+   LCD_Xfer_End(&LCD_SPI);
 }
 
 /****************************************************************************************************************************************
@@ -492,36 +446,20 @@ void LCD_DrawPoint(uint16_t x,uint16_t y,uint32_t color)
 
 void LCD_DisplayChar(uint16_t x, uint16_t y,uint8_t c)
 {
-	uint16_t  index = 0, counter = 0 ,i = 0, w = 0;		// 计数变量
-   uint8_t   disChar;		//存储字符的地址
+   const uint16_t *pGlyph;		// 展开后的RGB565字符数据
 
 	c = c - 32; 	// 计算ASCII字符的偏移
 
-	for(index = 0; index < LCD_AsciiFonts->Sizes; index++)	
+	// 先查字模缓存，未命中时展开1bpp字模并放入缓存
+	pGlyph = LCD_GlyphCache_Lookup(LCD_AsciiFonts, c, LCD.Color, LCD.BackColor);
+	if( pGlyph == NULL )
 	{
-		disChar = LCD_AsciiFonts->pTable[c*LCD_AsciiFonts->Sizes + index]; //获取字符的模值
-		for(counter = 0; counter < 8; counter++)
-		{ 
-			if(disChar & 0x01)	
-			{		
-            LCD_Buff[i] =  LCD.Color;			// 当前模值不为0时，使用画笔色绘点
-			}
-			else		
-			{		
-            LCD_Buff[i] = LCD.BackColor;		//否则使用背景色绘制点
-			}
-			disChar >>= 1;
-			i++;
-         w++;
- 			if( w == LCD_AsciiFonts->Width ) // 如果写入的数据达到了字符宽度，则退出当前循环
-			{								   // 进入下一字符的写入的绘制
-				w = 0;
-				break;
-			}        
-		}	
-	}		
+		pGlyph = LCD_GlyphCache_Insert(LCD_AsciiFonts, c, LCD.Color, LCD.BackColor,
+		                               &LCD_AsciiFonts->pTable[c*LCD_AsciiFonts->Sizes]);
+		if( pGlyph == NULL )	return;	// 字符尺寸超出缓存槽大小
+	}
    LCD_SetAddress( x, y, x+LCD_AsciiFonts->Width-1, y+LCD_AsciiFonts->Height-1);	   // 设置坐标	
-   LCD_WriteBuff(LCD_Buff,LCD_AsciiFonts->Width*LCD_AsciiFonts->Height);          // 写入显存
+   LCD_WriteBuff((uint16_t *)pGlyph,LCD_AsciiFonts->Width*LCD_AsciiFonts->Height);   // 写入显存
 }
 
 /****************************************************************************************************************************************
@@ -596,51 +534,27 @@ void LCD_SetTextFont(pFONT *fonts)
 
 void LCD_DisplayChinese(uint16_t x, uint16_t y, char *pText) 
 {
-	uint16_t  i=0,index = 0, counter = 0;	// 计数变量
-	uint16_t  addr;	// 字模地址
-   uint8_t   disChar;	//字模的值
-	uint16_t  Xaddress = 0; //水平坐标
-
-	while(1)
-	{		
-		// 对比数组中的汉字编码，用以定位该汉字字模的地址		
-		if ( *(LCD_CHFonts->pTable + (i+1)*LCD_CHFonts->Sizes + 0)==*pText && *(LCD_CHFonts->pTable + (i+1)*LCD_CHFonts->Sizes + 1)==*(pText+1) )	
-		{   
-			addr=i;	// 字模地址偏移
-			break;
-		}				
-		i+=2;	// 每个中文字符编码占两字节
-
-		if(i >= LCD_CHFonts->Table_Rows)	break;	// 字模列表中无相应的汉字	
-	}	
-	i=0;
-	for(index = 0; index <LCD_CHFonts->Sizes; index++)
-	{	
-		disChar = *(LCD_CHFonts->pTable + (addr)*LCD_CHFonts->Sizes + index);	// 获取相应的字模地址
-		
-		for(counter = 0; counter < 8; counter++)
-		{ 
-			if(disChar & 0x01)	
-			{		
-            LCD_Buff[i] =  LCD.Color;			// 当前模值不为0时，使用画笔色绘点
-			}
-			else		
-			{		
-            LCD_Buff[i] = LCD.BackColor;		// 否则使用背景色绘制点
-			}
-         i++;
-			disChar >>= 1;
-			Xaddress++;  //水平坐标自加
-			
-			if( Xaddress == LCD_CHFonts->Width ) 	//	如果水平坐标达到了字符宽度，则退出当前循环
-			{														//	进入下一行的绘制
-				Xaddress = 0;
-				break;
-			}
-		}	
-	}	
+	uint16_t  code;		// 汉字编码，作为索引和缓存的键
+	const uint8_t  *pFont;	// 字模地址
+   const uint16_t *pGlyph;	// 展开后的RGB565字符数据
+
+	LCD_FontIndex_Decode(pText, &code);
+
+	// 已缓存的汉字无需再查找字模
+	pGlyph = LCD_GlyphCache_Lookup(LCD_CHFonts, code, LCD.Color, LCD.BackColor);
+	if( pGlyph == NULL )
+	{
+		pFont = LCD_FontIndex_Find(LCD_CHFonts, code);		// 通过索引定位字模
+		if( pFont == NULL )
+		{
+			pFont = LCD_FontIndex_Fallback(LCD_CHFonts);		// 字模列表中无相应的汉字，显示方框
+			if( pFont == NULL )	return;
+		}
+		pGlyph = LCD_GlyphCache_Insert(LCD_CHFonts, code, LCD.Color, LCD.BackColor, pFont);	// 展开字模并放入缓存
+		if( pGlyph == NULL )	return;	// 字符尺寸超出缓存槽大小
+	}
    LCD_SetAddress( x, y, x+LCD_CHFonts->Width-1, y+LCD_CHFonts->Height-1);	   // 设置坐标	
-   LCD_WriteBuff(LCD_Buff,LCD_CHFonts->Width*LCD_CHFonts->Height);            // 写入显存
+   LCD_WriteBuff((uint16_t *)pGlyph,LCD_CHFonts->Width*LCD_CHFonts->Height);    // 写入显存
 }
 
 /*****************************************************************************************************************************************
@@ -672,9 +586,10 @@ void LCD_DisplayText(uint16_t x, uint16_t y, char *pText)
 		}
 		else					// 若字符为汉字
 		{			
+			uint16_t code;
 			LCD_DisplayChinese(x,y,pText);	// 显示汉字
 			x+=LCD_CHFonts->Width;				// 水平坐标调到下一个字符处
-			pText+=2;								// 字符串地址+2，汉字的编码要2字节
+			pText+=LCD_FontIndex_Decode(pText, &code);	// 跳过该汉字的编码（UTF-8为3字节，GB2312为2字节）
 		}
 	}	
 }
@@ -772,6 +687,36 @@ void  LCD_DisplayDecimals( uint16_t x, uint16_t y, double decimals, uint8_t len,
 }
 
 
+/***************************************************************************************************************************************
+*	函 数 名: LCD_RasterSink
+*
+*	函数功能: 光栅化游程的输出，设置一次窗口后连续写入整段像素
+*
+*	说    明: 1. 线段、圆、椭圆由 lcd_raster.c 合并为水平/垂直游程，每段只发送一次 CASET/RASET，
+*				    原来逐点绘制时每个像素都要 8 次 SPI 传输、13 字节
+*				 2. 游程很短（圆的斜45度附近只有1~2个像素），启动DMA的开销比传输本身还大，
+*				    因此轮询发送
+*				 3. 片选由调用者（LCD_DrawLine 等）在整个图形前后各操作一次，同一图形的所有游程在一次片选内完成
+*
+*****************************************************************************************************************************************/
+
+static void LCD_RasterSink(void *ctx, uint16_t x, uint16_t y, uint16_t len, bool vertical, const uint16_t *colors)
+{
+	uint16_t x2 = vertical ? x : (uint16_t)(x + len - 1);
+	uint16_t y2 = vertical ? (uint16_t)(y + len - 1) : y;
+
+	(void)ctx;
+
+	LCD_Xfer_Window(&LCD_SPI, x+LCD.X_Offset, y+LCD.Y_Offset, x2+LCD.X_Offset, y2+LCD.Y_Offset);
+	LCD_Xfer_Data16(&LCD_SPI, colors, len);
+}
+
+static LCD_Raster_t LCD_RasterTarget(void)
+{
+	LCD_Raster_t raster = { LCD_RasterSink, NULL, LCD.Width, LCD.Height };
+	return raster;
+}
+
 /***************************************************************************************************************************************
 *	函 数 名: LCD_DrawLine
 *
@@ -783,76 +728,40 @@ void  LCD_DisplayDecimals( uint16_t x, uint16_t y, double decimals, uint8_t len,
 *
 *	函数功能: 在两点之间画线
 *
-*	说    明: 该函数移植于ST官方评估板的例程
+*	说    明: 1. 该函数移植于ST官方评估板的例程，走线不变，逐点输出改为按水平/垂直游程批量发送
+*				 2. 超出屏幕的部分被裁剪
 *						 
 *****************************************************************************************************************************************/
 
-#define ABS(X)  ((X) > 0 ? (X) : -(X))    
-
 void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
-	int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-	yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
-	curpixel = 0;
+	LCD_Raster_t raster = LCD_RasterTarget();
 
-	deltax = ABS(x2 - x1);        /* The difference between the x's */
-	deltay = ABS(y2 - y1);        /* The difference between the y's */
-	x = x1;                       /* Start x off at the first pixel */
-	y = y1;                       /* Start y off at the first pixel */
+	LCD_Xfer_Begin(&LCD_SPI);
+	LCD_Raster_Line(&raster, x1, y1, x2, y2, LCD.Color);
+	LCD_Xfer_End(&LCD_SPI);
+}
 
-	if (x2 >= x1)                 /* The x-values are increasing */
-	{
-	 xinc1 = 1;
-	 xinc2 = 1;
-	}
-	else                          /* The x-values are decreasing */
-	{
-	 xinc1 = -1;
-	 xinc2 = -1;
-	}
+/***************************************************************************************************************************************
+*	函 数 名: LCD_DrawLineAA
+*
+*	入口参数: x1,y1 - 起点坐标
+*				 x2,y2 - 终点坐标
+*
+*	函数功能: 在两点之间画抗锯齿线（Wu算法）
+*
+*	说    明: 1. 边缘像素按覆盖率混合画笔色与背景色（LCD_SetBackColor），适用于纯色背景
+*				 2. 每个像素的颜色不同，但同样按游程发送
+*
+*****************************************************************************************************************************************/
 
-	if (y2 >= y1)                 /* The y-values are increasing */
-	{
-	 yinc1 = 1;
-	 yinc2 = 1;
-	}
-	else                          /* The y-values are decreasing */
-	{
-	 yinc1 = -1;
-	 yinc2 = -1;
-	}
+void LCD_DrawLineAA(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	LCD_Raster_t raster = LCD_RasterTarget();
 
-	if (deltax >= deltay)         /* There is at least one x-value for every y-value */
-	{
-	 xinc1 = 0;                  /* Don't change the x when numerator >= denominator */
-	 yinc2 = 0;                  /* Don't change the y for every iteration */
-	 den = deltax;
-	 num = deltax / 2;
-	 numadd = deltay;
-	 numpixels = deltax;         /* There are more x-values than y-values */
-	}
-	else                          /* There is at least one y-value for every x-value */
-	{
-	 xinc2 = 0;                  /* Don't change the x for every iteration */
-	 yinc1 = 0;                  /* Don't change the y when numerator >= denominator */
-	 den = deltay;
-	 num = deltay / 2;
-	 numadd = deltax;
-	 numpixels = deltay;         /* There are more y-values than x-values */
-	}
-	for (curpixel = 0; curpixel <= numpixels; curpixel++)
-	{
-	 LCD_DrawPoint(x,y,LCD.Color);             /* Draw the current pixel */
-	 num += numadd;              /* Increase the numerator by the top of the fraction */
-	 if (num >= den)             /* Check if numerator >= denominator */
-	 {
-		num -= den;               /* Calculate the new numerator value */
-		x += xinc1;               /* Change the x as appropriate */
-		y += yinc1;               /* Change the y as appropriate */
-	 }
-	 x += xinc2;                 /* Change the x as appropriate */
-	 y += yinc2;                 /* Change the y as appropriate */
-	}  
+	LCD_Xfer_Begin(&LCD_SPI);
+	LCD_Raster_LineAA(&raster, x1, y1, x2, y2, LCD.Color, LCD.BackColor);
+	LCD_Xfer_End(&LCD_SPI);
 }
 
 /***************************************************************************************************************************************
@@ -946,31 +855,41 @@ void LCD_DrawRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
 *
 *	函数功能: 在坐标 (x,y) 绘制半径为 r 的圆形线条
 *
-*	说    明: 1. 该函数移植于ST官方评估板的例程
-*				 2. 要绘制的区域不能超过屏幕的显示区域
+*	说    明: 1. 该函数移植于ST官方评估板的例程，走线不变，逐点输出改为按水平/垂直游程批量发送
+*				 2. 超出屏幕的部分被裁剪
 *
 *****************************************************************************************************************************************/
 
 void LCD_DrawCircle(uint16_t x, uint16_t y, uint16_t r)
 {
-	int Xadd = -r, Yadd = 0, err = 2-2*r, e2;
-	do {   
-
-		LCD_DrawPoint(x-Xadd,y+Yadd,LCD.Color);
-		LCD_DrawPoint(x+Xadd,y+Yadd,LCD.Color);
-		LCD_DrawPoint(x+Xadd,y-Yadd,LCD.Color);
-		LCD_DrawPoint(x-Xadd,y-Yadd,LCD.Color);
-		
-		e2 = err;
-		if (e2 <= Yadd) {
-			err += ++Yadd*2+1;
-			if (-Xadd == Yadd && e2 <= Xadd) e2 = 0;
-		}
-		if (e2 > Xadd) err += ++Xadd*2+1;
-    }
-    while (Xadd <= 0);   
+	LCD_Raster_t raster = LCD_RasterTarget();
+
+	LCD_Xfer_Begin(&LCD_SPI);
+	LCD_Raster_Circle(&raster, x, y, r, LCD.Color);
+	LCD_Xfer_End(&LCD_SPI);
 }
 
+/***************************************************************************************************************************************
+*	函 数 名: LCD_DrawCircleAA
+*
+*	入口参数: x - 圆心 水平坐标
+*			 	 y - 圆心 垂直坐标
+*			 	 r  - 半径
+*
+*	函数功能: 在坐标 (x,y) 绘制半径为 r 的抗锯齿圆形线条（Wu算法）
+*
+*	说    明: 边缘像素按覆盖率混合画笔色与背景色（LCD_SetBackColor），适用于纯色背景
+*
+*****************************************************************************************************************************************/
+
+void LCD_DrawCircleAA(uint16_t x, uint16_t y, uint16_t r)
+{
+	LCD_Raster_t raster = LCD_RasterTarget();
+
+	LCD_Xfer_Begin(&LCD_SPI);
+	LCD_Raster_CircleAA(&raster, x, y, r, LCD.Color, LCD.BackColor);
+	LCD_Xfer_End(&LCD_SPI);
+}
 
 /***************************************************************************************************************************************
 *	函 数 名: LCD_DrawEllipse
@@ -982,59 +901,18 @@ void LCD_DrawCircle(uint16_t x, uint16_t y, uint16_t r)
 *
 *	函数功能: 在坐标 (x,y) 绘制水平半轴为 r1 垂直半轴为 r2 的椭圆线条
 *
-*	说    明: 1. 该函数移植于ST官方评估板的例程
-*				 2. 要绘制的区域不能超过屏幕的显示区域
+*	说    明: 1. 使用整数中点算法，按水平/垂直游程批量发送
+*				 2. 超出屏幕的部分被裁剪
 *
 *****************************************************************************************************************************************/
 
 void LCD_DrawEllipse(int x, int y, int r1, int r2)
 {
-  int Xadd = -r1, Yadd = 0, err = 2-2*r1, e2;
-  float K = 0, rad1 = 0, rad2 = 0;
-   
-  rad1 = r1;
-  rad2 = r2;
-  
-  if (r1 > r2)
-  { 
-    do {
-      K = (float)(rad1/rad2);
-		 
-		LCD_DrawPoint(x-Xadd,y+(uint16_t)(Yadd/K),LCD.Color);
-		LCD_DrawPoint(x+Xadd,y+(uint16_t)(Yadd/K),LCD.Color);
-		LCD_DrawPoint(x+Xadd,y-(uint16_t)(Yadd/K),LCD.Color);
-		LCD_DrawPoint(x-Xadd,y-(uint16_t)(Yadd/K),LCD.Color);     
-		 
-      e2 = err;
-      if (e2 <= Yadd) {
-        err += ++Yadd*2+1;
-        if (-Xadd == Yadd && e2 <= Xadd) e2 = 0;
-      }
-      if (e2 > Xadd) err += ++Xadd*2+1;
-    }
-    while (Xadd <= 0);
-  }
-  else
-  {
-    Yadd = -r2; 
-    Xadd = 0;
-    do { 
-      K = (float)(rad2/rad1);
-
-		LCD_DrawPoint(x-(uint16_t)(Xadd/K),y+Yadd,LCD.Color);
-		LCD_DrawPoint(x+(uint16_t)(Xadd/K),y+Yadd,LCD.Color);
-		LCD_DrawPoint(x+(uint16_t)(Xadd/K),y-Yadd,LCD.Color);
-		LCD_DrawPoint(x-(uint16_t)(Xadd/K),y-Yadd,LCD.Color);  
-		 
-      e2 = err;
-      if (e2 <= Xadd) {
-        err += ++Xadd*3+1;
-        if (-Yadd == Xadd && e2 <= Yadd) e2 = 0;
-      }
-      if (e2 > Yadd) err += ++Yadd*3+1;     
-    }
-    while (Yadd <= 0);
-  }
+	LCD_Raster_t raster = LCD_RasterTarget();
+
+	LCD_Xfer_Begin(&LCD_SPI);
+	LCD_Raster_Ellipse(&raster, x, y, r1, r2, LCD.Color);
+	LCD_Xfer_End(&LCD_SPI);
 }
 
 /***************************************************************************************************************************************
@@ -1108,21 +986,10 @@ void LCD_FillCircle(uint16_t x, uint16_t y, uint16_t r)
 
 void LCD_FillRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
 {
-   LCD_SetAddress( x, y, x+width-1, y+height-1);	// 设置坐标
-
-	LCD_CS_Select;      // 选中LCD，CS引脚输出低电平
-	LCD_DC_Data;     // 数据指令选择 引脚输出高电平，代表本次传输 数据
-
-// 修改为16位数据宽度，写入数据更加效率，不需要拆分
-   LCD_SPI.Init.DataSize 	= SPI_DATASIZE_16BIT;   //	16位数据宽度
-   HAL_SPI_Init(&LCD_SPI);
-
-   LCD_SPI_Transmit(&LCD_SPI, LCD.Color, width*height) ;
-
-// 改回8位数据宽度，因为指令和部分数据都是按照8位传输的
-	LCD_SPI.Init.DataSize 	= SPI_DATASIZE_8BIT;    //	8位数据宽度
-   HAL_SPI_Init(&LCD_SPI);
-   LCD_CS_Deselect;    // 取消选中LCD，CS引脚输出高电平
+   LCD_Xfer_Begin(&LCD_SPI);                                      // 设置坐标和写显存在同一次片选内完成
+   LCD_Xfer_Window(&LCD_SPI, x+LCD.X_Offset, y+LCD.Y_Offset, x+width-1+LCD.X_Offset, y+height-1+LCD.Y_Offset);
+   LCD_Xfer_Fill16(&LCD_SPI, LCD.Color, width*height);
+   LCD_Xfer_End(&LCD_SPI);
 }
 
 
@@ -1216,387 +1083,10 @@ void 	LCD_DrawImage(uint16_t x,uint16_t y,uint16_t width,uint16_t height,const u
 
 void	LCD_CopyBuffer(uint16_t x, uint16_t y,uint16_t width,uint16_t height,uint16_t *DataBuff)
 {
-
-	LCD_SetAddress(x,y,x+width-1,y+height-1);
-
-	LCD_CS_Select;      // 选中LCD，CS引脚输出低电平
-	LCD_DC_Data;     // 数据指令选择 引脚输出高电平，代表本次传输 数据
-
-// 修改为16位数据宽度，写入数据更加效率，不需要拆分
-   LCD_SPI.Init.DataSize 	= SPI_DATASIZE_16BIT;   //	16位数据宽度
-   HAL_SPI_Init(&LCD_SPI);
-
-	LCD_SPI_TransmitBuffer(&LCD_SPI, DataBuff,width * height) ;
-
-//	HAL_SPI_Transmit(&hspi5, (uint8_t *)DataBuff, (x2-x1+1) * (y2-y1+1), 1000) ;
-
-// 改回8位数据宽度，因为指令和部分数据都是按照8位传输的
-	LCD_SPI.Init.DataSize 	= SPI_DATASIZE_8BIT;    //	8位数据宽度
-   HAL_SPI_Init(&LCD_SPI);
-   LCD_CS_Deselect;    // 取消选中LCD，CS引脚输出高电平
-
-}
-
-/**********************************************************************************************************************************
-*
-* 以下几个函数修改于HAL的库函数，目的是为了SPI传输数据不限数据长度的写入，并且提高清屏的速度
-*
-*****************************************************************************************************************FANKE************/
-
-
-/**
-  * @brief Handle SPI Communication Timeout.
-  * @param hspi: pointer to a SPI_HandleTypeDef structure that contains
-  *              the configuration information for SPI module.
-  * @param Flag: SPI flag to check
-  * @param Status: flag state to check
-  * @param Timeout: Timeout duration
-  * @param Tickstart: Tick start value
-  * @retval HAL status
-  */
-HAL_StatusTypeDef LCD_SPI_WaitOnFlagUntilTimeout(SPI_HandleTypeDef *hspi, uint32_t Flag, FlagStatus Status,
-                                                    uint32_t Tickstart, uint32_t Timeout)
-{
-   /* Wait until flag is set */
-   while ((__HAL_SPI_GET_FLAG(hspi, Flag) ? SET : RESET) == Status)
-   {
-      /* Check for the Timeout */
-      if ((((HAL_GetTick() - Tickstart) >=  Timeout) && (Timeout != HAL_MAX_DELAY)) || (Timeout == 0U))
-      {
-         return HAL_TIMEOUT;
-      }
-   }
-   return HAL_OK;
-}
-
-
-/**
- * @brief  Close Transfer and clear flags.
- * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
- *               the configuration information for SPI module.
- * @retval HAL_ERROR: if any error detected
- *         HAL_OK: if nothing detected
- */
- void LCD_SPI_CloseTransfer(SPI_HandleTypeDef *hspi)
-{
-  uint32_t itflag = hspi->Instance->SR;
-
-  __HAL_SPI_CLEAR_EOTFLAG(hspi);
-  __HAL_SPI_CLEAR_TXTFFLAG(hspi);
-
-  /* Disable SPI peripheral */
-  __HAL_SPI_DISABLE(hspi);
-
-  /* Disable ITs */
-  __HAL_SPI_DISABLE_IT(hspi, (SPI_IT_EOT | SPI_IT_TXP | SPI_IT_RXP | SPI_IT_DXP | SPI_IT_UDR | SPI_IT_OVR | SPI_IT_FRE | SPI_IT_MODF));
-
-  /* Disable Tx DMA Request */
-  CLEAR_BIT(hspi->Instance->CFG1, SPI_CFG1_TXDMAEN | SPI_CFG1_RXDMAEN);
-
-  /* Report UnderRun error for non RX Only communication */
-  if (hspi->State != HAL_SPI_STATE_BUSY_RX)
-  {
-    if ((itflag & SPI_FLAG_UDR) != 0UL)
-    {
-      SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_UDR);
-      __HAL_SPI_CLEAR_UDRFLAG(hspi);
-    }
-  }
-
-  /* Report OverRun error for non TX Only communication */
-  if (hspi->State != HAL_SPI_STATE_BUSY_TX)
-  {
-    if ((itflag & SPI_FLAG_OVR) != 0UL)
-    {
-      SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_OVR);
-      __HAL_SPI_CLEAR_OVRFLAG(hspi);
-    }
-  }
-
-  /* SPI Mode Fault error interrupt occurred -------------------------------*/
-  if ((itflag & SPI_FLAG_MODF) != 0UL)
-  {
-    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_MODF);
-    __HAL_SPI_CLEAR_MODFFLAG(hspi);
-  }
-
-  /* SPI Frame error interrupt occurred ------------------------------------*/
-  if ((itflag & SPI_FLAG_FRE) != 0UL)
-  {
-    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_FRE);
-    __HAL_SPI_CLEAR_FREFLAG(hspi);
-  }
-
-  hspi->TxXferCount = (uint16_t)0UL;
-  hspi->RxXferCount = (uint16_t)0UL;
-}
-
-
-/**
-  * @brief  专为屏幕清屏而修改，将需要清屏的颜色批量传输
-  * @param  hspi   : spi的句柄
-  * @param  pData  : 要写入的数据
-  * @param  Size   : 数据大小
-  * @retval HAL status
-  */
-
-HAL_StatusTypeDef LCD_SPI_Transmit(SPI_HandleTypeDef *hspi,uint16_t pData, uint32_t Size)
-{
-   uint32_t    tickstart;  
-   uint32_t    Timeout = 1000;      // 超时判断
-   uint32_t    LCD_pData_32bit;     // 按32位传输时的数据
-   uint32_t    LCD_TxDataCount;     // 传输计数
-   HAL_StatusTypeDef errorcode = HAL_OK;
-
-	/* Check Direction parameter */
-	assert_param(IS_SPI_DIRECTION_2LINES_OR_1LINE_2LINES_TXONLY(hspi->Init.Direction));
-
-	/* Process Locked */
-	__HAL_LOCK(hspi);
-
-	/* Init tickstart for timeout management*/
-	tickstart = HAL_GetTick();
-
-	if (hspi->State != HAL_SPI_STATE_READY)
-	{
-		errorcode = HAL_BUSY;
-		__HAL_UNLOCK(hspi);
-		return errorcode;
-	}
-
-	if ( Size == 0UL)
-	{
-		errorcode = HAL_ERROR;
-		__HAL_UNLOCK(hspi);
-		return errorcode;
-	}
-
-	/* Set the transaction information */
-	hspi->State       = HAL_SPI_STATE_BUSY_TX;
-	hspi->ErrorCode   = HAL_SPI_ERROR_NONE;
-
-	LCD_TxDataCount   = Size;                // 传输的数据长度
-	LCD_pData_32bit   = (pData<<16)|pData ;  // 按32位传输时，合并2个像素点的颜色  
-
-	/*Init field not used in handle to zero */
-	hspi->pRxBuffPtr  = NULL;
-	hspi->RxXferSize  = (uint16_t) 0UL;
-	hspi->RxXferCount = (uint16_t) 0UL;
-	hspi->TxISR       = NULL;
-	hspi->RxISR       = NULL;
-
-	/* Configure communication direction : 1Line */
-	if (hspi->Init.Direction == SPI_DIRECTION_1LINE)
-	{
-		SPI_1LINE_TX(hspi);
-	}
-
-// 不使用硬件 TSIZE 控制，此处设置为0，即不限制传输的数据长度
-	MODIFY_REG(hspi->Instance->CR2, SPI_CR2_TSIZE, 0);
-
-	/* Enable SPI peripheral */
-	__HAL_SPI_ENABLE(hspi);
-
-	if (hspi->Init.Mode == SPI_MODE_MASTER)
-	{
-		 /* Master transfer start */
-		 SET_BIT(hspi->Instance->CR1, SPI_CR1_CSTART);
-	}
-
-	/* Transmit data in 16 Bit mode */
-	while (LCD_TxDataCount > 0UL)
-	{
-		/* Wait until TXP flag is set to send data */
-		if (__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_TXP))
-		{
-			if ((hspi->TxXferCount > 1UL) && (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA))
-			{
-				*((__IO uint32_t *)&hspi->Instance->TXDR) = (uint32_t )LCD_pData_32bit;
-				LCD_TxDataCount -= (uint16_t)2UL;
-			}
-			else
-			{
-				*((__IO uint16_t *)&hspi->Instance->TXDR) =  (uint16_t )pData;
-				LCD_TxDataCount--;
-			}
-		}
-		else
-		{
-			/* Timeout management */
-			if ((((HAL_GetTick() - tickstart) >=  Timeout) && (Timeout != HAL_MAX_DELAY)) || (Timeout == 0U))
-			{
-				/* Call standard close procedure with error check */
-				LCD_SPI_CloseTransfer(hspi);
-
-				/* Process Unlocked */
-				__HAL_UNLOCK(hspi);
-
-				SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_TIMEOUT);
-				hspi->State = HAL_SPI_STATE_READY;
-				return HAL_ERROR;
-			}
-		}
-	}
-
-	if (LCD_SPI_WaitOnFlagUntilTimeout(hspi, SPI_SR_TXC, RESET, tickstart, Timeout) != HAL_OK)
-	{
-		SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_FLAG);
-	}
-
-	SET_BIT((hspi)->Instance->CR1 , SPI_CR1_CSUSP); // 请求挂起SPI传输
-	/* 等待SPI挂起 */
-	if (LCD_SPI_WaitOnFlagUntilTimeout(hspi, SPI_FLAG_SUSP, RESET, tickstart, Timeout) != HAL_OK)
-	{
-		SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_FLAG);
-	}
-	LCD_SPI_CloseTransfer(hspi);   /* Call standard close procedure with error check */
-
-	SET_BIT((hspi)->Instance->IFCR , SPI_IFCR_SUSPC);  // 清除挂起标志位
-
-
-	/* Process Unlocked */
-	__HAL_UNLOCK(hspi);
-
-	hspi->State = HAL_SPI_STATE_READY;
-
-	if (hspi->ErrorCode != HAL_SPI_ERROR_NONE)
-	{
-		return HAL_ERROR;
-	}
-	return errorcode;
-}
-
-/**
-  * @brief  专为批量写入数据修改，使之不限长度的传输数据
-  * @param  hspi   : spi的句柄
-  * @param  pData  : 要写入的数据
-  * @param  Size   : 数据大小
-  * @retval HAL status
-  */
-HAL_StatusTypeDef LCD_SPI_TransmitBuffer (SPI_HandleTypeDef *hspi, uint16_t *pData, uint32_t Size)
-{
-   uint32_t    tickstart;  
-   uint32_t    Timeout = 1000;      // 超时判断
-   uint32_t    LCD_TxDataCount;     // 传输计数
-   HAL_StatusTypeDef errorcode = HAL_OK;
-
-	/* Check Direction parameter */
-	assert_param(IS_SPI_DIRECTION_2LINES_OR_1LINE_2LINES_TXONLY(hspi->Init.Direction));
-
-	/* Process Locked */
-	__HAL_LOCK(hspi);
-
-	/* Init tickstart for timeout management*/
-	tickstart = HAL_GetTick();
-
-	if (hspi->State != HAL_SPI_STATE_READY)
-	{
-		errorcode = HAL_BUSY;
-		__HAL_UNLOCK(hspi);
-		return errorcode;
-	}
-
-	if ( Size == 0UL)
-	{
-		errorcode = HAL_ERROR;
-		__HAL_UNLOCK(hspi);
-		return errorcode;
-	}
-
-	/* Set the transaction information */
-	hspi->State       = HAL_SPI_STATE_BUSY_TX;
-	hspi->ErrorCode   = HAL_SPI_ERROR_NONE;
-
-	LCD_TxDataCount   = Size;                // 传输的数据长度
-
-	/*Init field not used in handle to zero */
-	hspi->pRxBuffPtr  = NULL;
-	hspi->RxXferSize  = (uint16_t) 0UL;
-	hspi->RxXferCount = (uint16_t) 0UL;
-	hspi->TxISR       = NULL;
-	hspi->RxISR       = NULL;
-
-	/* Configure communication direction : 1Line */
-	if (hspi->Init.Direction == SPI_DIRECTION_1LINE)
-	{
-		SPI_1LINE_TX(hspi);
-	}
-
-// 不使用硬件 TSIZE 控制，此处设置为0，即不限制传输的数据长度
-	MODIFY_REG(hspi->Instance->CR2, SPI_CR2_TSIZE, 0);
-
-	/* Enable SPI peripheral */
-	__HAL_SPI_ENABLE(hspi);
-
-	if (hspi->Init.Mode == SPI_MODE_MASTER)
-	{
-		 /* Master transfer start */
-		 SET_BIT(hspi->Instance->CR1, SPI_CR1_CSTART);
-	}
-
-	/* Transmit data in 16 Bit mode */
-	while (LCD_TxDataCount > 0UL)
-	{
-		/* Wait until TXP flag is set to send data */
-		if (__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_TXP))
-		{
-			if ((LCD_TxDataCount > 1UL) && (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA))
-			{
-				*((__IO uint32_t *)&hspi->Instance->TXDR) = *((uint32_t *)pData);
-				pData += 2;
-				LCD_TxDataCount -= 2;
-			}
-			else
-			{
-				*((__IO uint16_t *)&hspi->Instance->TXDR) = *((uint16_t *)pData);
-				pData += 1;
-				LCD_TxDataCount--;
-			}
-		}
-		else
-		{
-			/* Timeout management */
-			if ((((HAL_GetTick() - tickstart) >=  Timeout) && (Timeout != HAL_MAX_DELAY)) || (Timeout == 0U))
-			{
-				/* Call standard close procedure with error check */
-				LCD_SPI_CloseTransfer(hspi);
-
-				/* Process Unlocked */
-				__HAL_UNLOCK(hspi);
-
-				SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_TIMEOUT);
-				hspi->State = HAL_SPI_STATE_READY;
-				return HAL_ERROR;
-			}
-		}
-	}
-
-	if (LCD_SPI_WaitOnFlagUntilTimeout(hspi, SPI_SR_TXC, RESET, tickstart, Timeout) != HAL_OK)
-	{
-		SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_FLAG);
-	}
-
-	SET_BIT((hspi)->Instance->CR1 , SPI_CR1_CSUSP); // 请求挂起SPI传输
-	/* 等待SPI挂起 */
-	if (LCD_SPI_WaitOnFlagUntilTimeout(hspi, SPI_FLAG_SUSP, RESET, tickstart, Timeout) != HAL_OK)
-	{
-		SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_FLAG);
-	}
-	LCD_SPI_CloseTransfer(hspi);   /* Call standard close procedure with error check */
-
-	SET_BIT((hspi)->Instance->IFCR , SPI_IFCR_SUSPC);  // 清除挂起标志位
-
-
-	/* Process Unlocked */
-	__HAL_UNLOCK(hspi);
-
-	hspi->State = HAL_SPI_STATE_READY;
-
-	if (hspi->ErrorCode != HAL_SPI_ERROR_NONE)
-	{
-		return HAL_ERROR;
-	}
-	return errorcode;
+   LCD_Xfer_Begin(&LCD_SPI);
+   LCD_Xfer_Window(&LCD_SPI, x+LCD.X_Offset, y+LCD.Y_Offset, x+width-1+LCD.X_Offset, y+height-1+LCD.Y_Offset);
+   LCD_Xfer_Data16(&LCD_SPI, DataBuff, width * height);
+   LCD_Xfer_End(&LCD_SPI);
 }
 
 /**************************************************************************************************************************************************************************************************************************************************************************FANKE***/
@@ -92,9 +92,11 @@ void  LCD_DrawPoint(uint16_t x,uint16_t y,uint32_t color);   	//画点
 void  LCD_DrawLine_V(uint16_t x, uint16_t y, uint16_t height);          // 画垂直线
 void  LCD_DrawLine_H(uint16_t x, uint16_t y, uint16_t width);           // 画水平线
 void  LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);	// 两点之间画线
+void  LCD_DrawLineAA(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);	// 两点之间画抗锯齿线
 
 void  LCD_DrawRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height);			//画矩形
 void  LCD_DrawCircle(uint16_t x, uint16_t y, uint16_t r);									//画圆
+void  LCD_DrawCircleAA(uint16_t x, uint16_t y, uint16_t r);								//画抗锯齿圆
 void  LCD_DrawEllipse(int x, int y, int r1, int r2);											//画椭圆
 
 //>>>>>	区域填充函数
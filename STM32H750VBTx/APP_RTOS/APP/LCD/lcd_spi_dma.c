@@ -6,18 +6,25 @@
  */
 
 #include "lcd_spi_dma.h"
+#include "lcd_spi_dma_v2.h"
 #include "lcd_spi_154.h"
+#include "lcd_spi_xfer.h"
+#include "lcd_spi_job.h"
+#include "isr_event.h"
+#include "lcd_blit.h"
+#include "mem_region.h"
+#include "lcd_prof.h"
 #include <string.h>
 #include <stdlib.h>
-#include <stdio.h>
-#include "usart.h"
 
-/* 静态DMA缓冲区 - 放在D2 SRAM (SRAM1/2)，该区域通常配置为Non-Cacheable，适合DMA */
+/* 静态DMA缓冲区 - 放在D2 SRAM (SRAM1/2)，Mem_Init 将该区域配置为Non-Cacheable，适合DMA */
 __attribute__((section(".ram_d2"))) __attribute__((aligned(32))) static uint16_t lcd_dma_buffer0[LCD_DMA_BUFFER_SIZE];
 __attribute__((section(".ram_d2"))) __attribute__((aligned(32))) static uint16_t lcd_dma_buffer1[LCD_DMA_BUFFER_SIZE];
 
+#if LCD_FRAME_BUFFER_STATIC
 /* 可选的帧缓冲区 - 115KB，放在D2 SRAM */
 __attribute__((section(".ram_d2"))) __attribute__((aligned(32))) static uint16_t lcd_frame_buffer[LCD_FRAME_BUFFER_SIZE];
+#endif
 
 /**
  * @brief 初始化LCD SPI DMA操作句柄
@@ -26,7 +33,7 @@ void LCD_SPI_DMA_Init(LCD_SPI_DMA_Handle_t *hlcd, SPI_HandleTypeDef *hspi)
 {
     hlcd->hspi = hspi;
     hlcd->hdma_tx = hspi->hdmatx;
-    hlcd->dma_busy = false;
+    DMA_Sync_Init(&hlcd->tx_sync);
     hlcd->dma_buffer[0] = lcd_dma_buffer0;
     hlcd->dma_buffer[1] = lcd_dma_buffer1;
     hlcd->current_buffer = 0;
@@ -34,7 +41,24 @@ void LCD_SPI_DMA_Init(LCD_SPI_DMA_Handle_t *hlcd, SPI_HandleTypeDef *hspi)
     hlcd->frame_buffer = NULL;
     hlcd->frame_buffer_enabled = false;
     hlcd->tc_callback = NULL;
-    hlcd->task_to_notify = NULL;  // 添加：初始化任务通知句柄
+    memset(hlcd->dirty_tiles, 0, sizeof(hlcd->dirty_tiles));
+    hlcd->flush_windows = 0;
+    hlcd->flush_pixels = 0;
+    hlcd->image_zero_copy = true;
+    hlcd->image_direct = 0;
+    hlcd->image_bounce = 0;
+    hlcd->image_copy_cycles = 0;
+}
+
+/**
+ * @brief 设置显示窗口：等待DMA完成、释放CS后再发送坐标命令（帧宽由传输层切换）
+ */
+void LCD_SPI_DMA_SetWindow(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
+                           uint16_t width, uint16_t height)
+{
+    LCD_SPI_DMA_WaitComplete(hlcd);
+    LCD_CS_Deselect;
+    LCD_SetAddress(x, y, x + width - 1, y + height - 1);
 }
 
 /**
@@ -49,38 +73,28 @@ void LCD_SPI_DMA_DeInit(LCD_SPI_DMA_Handle_t *hlcd)
 }
 
 /**
- * @brief 等待DMA传输完成 - 简化版（轮询模式）
+ * @brief 等待DMA传输完成：任务阻塞到完成/错误中断唤醒，超时则停止DMA
+ * @note  错误中断已经上报过 ErrorCode；超时在这里以 HAL_SPI_ERROR_TIMEOUT 上报（不占用日志串口）
  */
-void LCD_SPI_DMA_WaitComplete(LCD_SPI_DMA_Handle_t *hlcd)
+HAL_StatusTypeDef LCD_SPI_DMA_WaitComplete(LCD_SPI_DMA_Handle_t *hlcd)
 {
-    if (!hlcd->dma_busy) return;
-
-    // 使用轮询方式等待DMA完成
-    uint32_t timeout = HAL_GetTick() + 2000;  // 2秒超时
+    LCD_PROF_BEGIN(t0);
+    HAL_StatusTypeDef status = DMA_Sync_Wait(&hlcd->tx_sync, LCD_DMA_TIMEOUT_MS);
+    LCD_PROF_END(LCD_PROF_WAIT, t0);
 
-    while (hlcd->dma_busy && (HAL_GetTick() < timeout)) {
-        // 让出CPU给其他任务
-        osDelay(1);
-    }
-
-    if (hlcd->dma_busy) {
-        // 超时 - 强制停止
-        extern UART_HandleTypeDef huart1;
-        HAL_UART_Transmit(&huart1, (uint8_t*)"[DMA] Timeout!\r\n", 16, 100);
+    if (status == HAL_TIMEOUT) {
         HAL_SPI_DMAStop(hlcd->hspi);
-        hlcd->dma_busy = false;
+        ISR_Event_PostFromTask(ISR_EVT_DMA_ERROR, ISR_SRC_SPI4_TX, HAL_SPI_ERROR_TIMEOUT);
     }
+    return status;
 }
 
 /**
- * @brief DMA传输完成回调 (内部) - 简化版
+ * @brief DMA传输完成回调 (内部，中断上下文，不做阻塞调用)
  */
-void LCD_SPI_DMA_TxCpltCallback(LCD_SPI_DMA_Handle_t *hlcd)
+MEM_ITCM_CODE void LCD_SPI_DMA_TxCpltCallback(LCD_SPI_DMA_Handle_t *hlcd)
 {
-    extern UART_HandleTypeDef huart1;
-    HAL_UART_Transmit(&huart1, (uint8_t*)".", 1, 10);  // 简短的完成标记
-
-    hlcd->dma_busy = false;
+    DMA_Sync_Complete(&hlcd->tx_sync);
 
     if (hlcd->tc_callback != NULL) {
         hlcd->tc_callback();
@@ -90,82 +104,80 @@ void LCD_SPI_DMA_TxCpltCallback(LCD_SPI_DMA_Handle_t *hlcd)
 /**
  * @brief 映射到 HAL 的回调函数 - 简化版
  */
-void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+MEM_ITCM_CODE void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
 {
     extern LCD_SPI_DMA_Handle_t hlcd_dma;
+    if (hspi->Instance == SPI4) {
+        LCD_PROF_DMA_DONE();
+        ISR_Event_Post(ISR_EVT_DMA_DONE, ISR_SRC_SPI4_TX, 0);
+    }
+    if (LCD_Job_HandleTxCplt(hspi)) {
+        return;     // 异步窗口作业队列正在使用该SPI
+    }
+    if (LCD_V2_HandleTxCplt(hspi)) {
+        return;     // V2双缓冲流水线正在使用该SPI
+    }
     if (hspi->Instance == SPI4) {
         LCD_SPI_DMA_TxCpltCallback(&hlcd_dma);
     }
 }
 
 /**
- * @brief 使用DMA发送命令（8位）- 非阻塞优化版
+ * @brief 映射到 HAL 的错误回调
  */
-HAL_StatusTypeDef LCD_SPI_DMA_WriteCommand(LCD_SPI_DMA_Handle_t *hlcd, uint8_t cmd)
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
 {
-    LCD_SPI_DMA_WaitComplete(hlcd);
-
-    LCD_CS_Select;
-    LCD_DC_Command;
-
-    // 切换到8位数据模式（仅在必要时）
-    static bool is_8bit_mode = true;  // 假设初始为8位
-    if (!is_8bit_mode) {
-        hlcd->hspi->Init.DataSize = SPI_DATASIZE_8BIT;
-        HAL_SPI_Init(hlcd->hspi);
-        is_8bit_mode = true;
+    extern LCD_SPI_DMA_Handle_t hlcd_dma;
+    if (hspi->Instance == SPI4) {
+        ISR_Event_Post(ISR_EVT_DMA_ERROR, ISR_SRC_SPI4_TX, hspi->ErrorCode);
+    }
+    if (LCD_Job_HandleError(hspi)) {
+        return;
+    }
+    if (LCD_V2_HandleError(hspi)) {
+        return;
+    }
+    if (hspi->Instance == SPI4) {
+        DMA_Sync_Fail(&hlcd_dma.tx_sync, hspi->ErrorCode);
     }
+}
 
-    // 使用轮询方式发送单字节命令（速度快）
-    HAL_StatusTypeDef status = HAL_SPI_Transmit(hlcd->hspi, &cmd, 1, 100);
+/**
+ * @brief 发送命令（8位，轮询）
+ */
+HAL_StatusTypeDef LCD_SPI_DMA_WriteCommand(LCD_SPI_DMA_Handle_t *hlcd, uint8_t cmd)
+{
+    LCD_SPI_DMA_WaitComplete(hlcd);
 
-    LCD_CS_Deselect;
+    LCD_Xfer_Begin(hlcd->hspi);
+    HAL_StatusTypeDef status = LCD_Xfer_Command(hlcd->hspi, cmd);
+    LCD_Xfer_End(hlcd->hspi);
     return status;
 }
 
 /**
- * @brief 使用DMA发送8位数据 - 非阻塞优化版
+ * @brief 发送8位数据（轮询）
  */
 HAL_StatusTypeDef LCD_SPI_DMA_WriteData8(LCD_SPI_DMA_Handle_t *hlcd, uint8_t data)
 {
     LCD_SPI_DMA_WaitComplete(hlcd);
 
-    LCD_CS_Select;
-    LCD_DC_Data;
-
-    // 切换到8位数据模式（仅在必要时）
-    static bool is_8bit_mode = true;
-    if (!is_8bit_mode) {
-        hlcd->hspi->Init.DataSize = SPI_DATASIZE_8BIT;
-        HAL_SPI_Init(hlcd->hspi);
-        is_8bit_mode = true;
-    }
-
-    // 使用轮询方式发送单字节数据
-    HAL_StatusTypeDef status = HAL_SPI_Transmit(hlcd->hspi, &data, 1, 100);
-
-    LCD_CS_Deselect;
+    LCD_Xfer_Begin(hlcd->hspi);
+    HAL_StatusTypeDef status = LCD_Xfer_Data8(hlcd->hspi, &data, 1);
+    LCD_Xfer_End(hlcd->hspi);
     return status;
 }
 
 /**
- * @brief 使用DMA发送16位数据
+ * @brief 发送16位数据（轮询）
  */
 HAL_StatusTypeDef LCD_SPI_DMA_WriteData16(LCD_SPI_DMA_Handle_t *hlcd, uint16_t data)
 {
     LCD_SPI_DMA_WaitComplete(hlcd);
 
-    LCD_CS_Select;
-    LCD_DC_Data;
-
-    if (hlcd->hspi->Init.DataSize != SPI_DATASIZE_16BIT) {
-        hlcd->hspi->Init.DataSize = SPI_DATASIZE_16BIT;
-        HAL_SPI_Init(hlcd->hspi);
-    }
-
-    HAL_StatusTypeDef status = HAL_SPI_Transmit(hlcd->hspi, (uint8_t*)&data, 1, 100);
-
-    LCD_CS_Deselect;
+    LCD_Xfer_Begin(hlcd->hspi);
+    HAL_StatusTypeDef status = LCD_Xfer_Data16(hlcd->hspi, &data, 1);
+    LCD_Xfer_End(hlcd->hspi);
     return status;
 }
 
@@ -178,7 +190,7 @@ HAL_StatusTypeDef LCD_SPI_DMA_WriteBuffer(LCD_SPI_DMA_Handle_t *hlcd, uint16_t *
 {
     HAL_StatusTypeDef status = LCD_SPI_DMA_WriteBuffer_Async(hlcd, pData, length);
     if (status == HAL_OK) {
-        LCD_SPI_DMA_WaitComplete(hlcd);
+        status = LCD_SPI_DMA_WaitComplete(hlcd);
         LCD_CS_Deselect;
     }
     return status;
@@ -189,38 +201,29 @@ HAL_StatusTypeDef LCD_SPI_DMA_WriteBuffer(LCD_SPI_DMA_Handle_t *hlcd, uint16_t *
  */
 HAL_StatusTypeDef LCD_SPI_DMA_WriteBuffer_Async(LCD_SPI_DMA_Handle_t *hlcd, uint16_t *pData, uint32_t length)
 {
-    // 等待上一次DMA传输完成
-    LCD_SPI_DMA_WaitComplete(hlcd);
-
-    LCD_CS_Select;
-    LCD_DC_Data;
-
-    // 切换到16位数据模式
-    static bool is_16bit_mode = false;
-    if (!is_16bit_mode) {
-        hlcd->hspi->Init.DataSize = SPI_DATASIZE_16BIT;
-        HAL_SPI_Init(hlcd->hspi);
-        is_16bit_mode = true;
+    // 等待上一次DMA传输完成，上一块失败时不再继续发送
+    HAL_StatusTypeDef status = LCD_SPI_DMA_WaitComplete(hlcd);
+    if (status != HAL_OK) {
+        LCD_CS_Deselect;
+        return status;
     }
 
-    // 标记DMA忙
-    hlcd->dma_busy = true;
+    // CS保持选中直到 SetWindow 或调用者释放，连续的分块属于同一次写显存
+    LCD_CS_Select;
 
-    // 由于使用D2 SRAM (Non-Cacheable)，不需要Cache维护
-    // 如果使用AXI SRAM，取消注释下面这行：
-    // SCB_CleanDCache_by_Addr((uint32_t*)pData, length * sizeof(uint16_t));
+    // 标记DMA忙，完成中断据此唤醒等待的任务
+    DMA_Sync_Arm(&hlcd->tx_sync);
 
-    // 启动DMA传输
-    HAL_StatusTypeDef status = HAL_SPI_Transmit_DMA(hlcd->hspi, (uint8_t*)pData, length);
+    // 16位帧宽直接改写寄存器（仅在必要时），先写回源数据的D-Cache行，经 DMA1_Stream1 发送
+    status = LCD_Xfer_Data16_DMA(hlcd->hspi, pData, (uint16_t)length);
 
     if (status != HAL_OK) {
-        hlcd->dma_busy = false;
+        DMA_Sync_Cancel(&hlcd->tx_sync);
         LCD_CS_Deselect;
 
-        extern UART_HandleTypeDef huart1;
-        char msg[32];
-        snprintf(msg, sizeof(msg), "[DMA] Err:%d\r\n", status);
-        HAL_UART_Transmit(&huart1, (uint8_t*)msg, strlen(msg), 100);
+        // DMA未能启动，没有错误中断；ErrorCode为空时（HAL_BUSY）按DMA错误上报
+        ISR_Event_PostFromTask(ISR_EVT_DMA_ERROR, ISR_SRC_SPI4_TX,
+                               (hlcd->hspi->ErrorCode != HAL_SPI_ERROR_NONE) ? hlcd->hspi->ErrorCode : HAL_SPI_ERROR_DMA);
     }
 
     return status;
@@ -234,14 +237,18 @@ HAL_StatusTypeDef LCD_SPI_DMA_EnableFrameBuffer(LCD_SPI_DMA_Handle_t *hlcd)
     if (hlcd->frame_buffer_enabled) {
         return HAL_OK;  // 已经启用
     }
-
+#if !LCD_FRAME_BUFFER_STATIC
+    return HAL_ERROR;   // 未分配帧缓冲
+#else
     hlcd->frame_buffer = lcd_frame_buffer;
     hlcd->frame_buffer_enabled = true;
 
-    // 清空帧缓冲
+    // 清空帧缓冲，屏幕当前内容未知，首次刷新需要整屏发送
     memset(hlcd->frame_buffer, 0, LCD_FRAME_BUFFER_SIZE * sizeof(uint16_t));
+    LCD_FB_MarkAllDirty(hlcd);
 
     return HAL_OK;
+#endif
 }
 
 /**
@@ -250,41 +257,178 @@ HAL_StatusTypeDef LCD_SPI_DMA_EnableFrameBuffer(LCD_SPI_DMA_Handle_t *hlcd)
 void LCD_SPI_DMA_DisableFrameBuffer(LCD_SPI_DMA_Handle_t *hlcd)
 {
     if (hlcd->frame_buffer_enabled) {
+        LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
         hlcd->frame_buffer = NULL;
         hlcd->frame_buffer_enabled = false;
     }
 }
 
 /**
- * @brief 刷新帧缓冲到LCD（整屏DMA传输）
+ * @brief 借用帧缓冲内存（LCD_FRAME_BUFFER_SIZE 个像素，D2 SRAM）
+ * @retval 帧缓冲模式已启用或未分配帧缓冲（LCD_FRAME_BUFFER_STATIC 为0）时返回NULL
+ * @note  帧缓冲模式关闭时这块内存空闲，可由视频播放器等临时使用；使用期间不能启用帧缓冲模式
+ */
+uint16_t *LCD_SPI_DMA_BorrowFrameMemory(LCD_SPI_DMA_Handle_t *hlcd)
+{
+#if LCD_FRAME_BUFFER_STATIC
+    return hlcd->frame_buffer_enabled ? NULL : lcd_frame_buffer;
+#else
+    (void)hlcd;
+    return NULL;
+#endif
+}
+
+/**
+ * @brief 源数据能否由DMA1直接读取
+ * @note  DMA1经总线矩阵访问QSPI映射区、内部Flash、AXI/D2/D3 SRAM，不能访问ITCM/DTCM
+ *        （.data/.bss/栈都在DTCM）；起始地址须按 LCD_DMA_DIRECT_ALIGN 对齐
+ */
+bool LCD_DMA_CanReadDirect(const void *src, uint32_t bytes)
+{
+    uintptr_t a = (uintptr_t)src;
+
+    if ((a & (LCD_DMA_DIRECT_ALIGN - 1U)) != 0U || bytes == 0U) {
+        return false;
+    }
+#if defined(D1_DTCMRAM_BASE)
+    uintptr_t end = a + bytes - 1U;
+    if (a - D1_ITCMRAM_BASE < 0x00010000U || end - D1_ITCMRAM_BASE < 0x00010000U ||
+        a - D1_DTCMRAM_BASE < 0x00020000U || end - D1_DTCMRAM_BASE < 0x00020000U) {
+        return false;
+    }
+#endif
+    return true;
+}
+
+/**
+ * @brief 将帧缓冲中的一个矩形窗口发送到LCD
+ * @note  整行宽度的窗口在帧缓冲中是连续的，直接DMA（每次最多 LCD_DMA_MAX_TRANSFER 个像素）；
+ *        否则用位块传输拷贝到双DMA缓冲区，拷贝下一块的同时SPI DMA发送上一块
+ */
+static HAL_StatusTypeDef LCD_SPI_DMA_FlushWindow(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
+                                                 uint16_t width, uint16_t height)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+
+    LCD_SPI_DMA_SetWindow(hlcd, x, y, width, height);
+
+    if (width == LCD_WIDTH) {
+        uint32_t remaining = (uint32_t)width * height;
+        uint16_t *src = &hlcd->frame_buffer[y * LCD_WIDTH];
+
+        while (remaining > 0 && status == HAL_OK) {
+            uint32_t transfer_size = (remaining > LCD_DMA_MAX_TRANSFER) ? LCD_DMA_MAX_TRANSFER : remaining;
+            status = LCD_SPI_DMA_WriteBuffer_Async(hlcd, src, transfer_size);
+            src += transfer_size;
+            remaining -= transfer_size;
+        }
+    } else {
+        uint16_t rows_per_chunk = hlcd->dma_buffer_size / width;
+        uint16_t row = 0;
+
+        while (row < height && status == HAL_OK) {
+            uint16_t rows = (height - row > rows_per_chunk) ? rows_per_chunk : (height - row);
+            uint16_t *dst = hlcd->dma_buffer[hlcd->current_buffer];
+
+            LCD_Blit_Copy(dst, width, &hlcd->frame_buffer[(y + row) * LCD_WIDTH + x], LCD_WIDTH, width, rows);
+            status = LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+            if (status == HAL_OK) {
+                status = LCD_SPI_DMA_WriteBuffer_Async(hlcd, dst, (uint32_t)rows * width);
+            }
+            hlcd->current_buffer = (hlcd->current_buffer + 1) % 2;
+            row += rows;
+        }
+    }
+
+    if (status == HAL_OK) {
+        status = LCD_SPI_DMA_WaitComplete(hlcd);
+    }
+    LCD_CS_Deselect;
+
+    hlcd->flush_windows++;
+    hlcd->flush_pixels += (uint32_t)width * height;
+    return status;
+}
+
+/**
+ * @brief 刷新帧缓冲到LCD（只发送脏块）
+ * @note  同一行中相邻的脏块合并为一段，下方各行若包含完全相同的一段则向下合并，
+ *        每个合并后的矩形只需一次 CASET/RASET/RAMWR。
+ *        脏块超过 LCD_DIRTY_FULL_TILES 时直接整屏发送。
+ *        发送失败时未发出的脏块（含失败的窗口）放回 dirty_tiles，下次刷新重发。
  */
 HAL_StatusTypeDef LCD_SPI_DMA_FlushFrameBuffer(LCD_SPI_DMA_Handle_t *hlcd)
 {
+    uint16_t dirty[LCD_TILE_ROWS];
+    uint32_t dirty_count = 0;
+    HAL_StatusTypeDef status = HAL_OK;
+
     if (!hlcd->frame_buffer_enabled || hlcd->frame_buffer == NULL) {
         return HAL_ERROR;
     }
 
-    // 设置全屏地址
-    LCD_SetAddress(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
-
-    // 分块传输帧缓冲（避免单次DMA传输过大）
-    const uint32_t chunk_size = LCD_DMA_BUFFER_SIZE;  // 每次传输32行
-    uint32_t remaining = LCD_FRAME_BUFFER_SIZE;
-    uint16_t *src = hlcd->frame_buffer;
+    /* 等待尚未完成的帧缓冲绘制（DMA2D） */
+    status = LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+    if (status != HAL_OK) {
+        return status;
+    }
 
-    while (remaining > 0) {
-        uint32_t transfer_size = (remaining > chunk_size) ? chunk_size : remaining;
+    memcpy(dirty, hlcd->dirty_tiles, sizeof(dirty));
+    memset(hlcd->dirty_tiles, 0, sizeof(hlcd->dirty_tiles));
+    hlcd->flush_windows = 0;
+    hlcd->flush_pixels = 0;
 
-        HAL_StatusTypeDef status = LCD_SPI_DMA_WriteBuffer(hlcd, src, transfer_size);
+    for (uint16_t ty = 0; ty < LCD_TILE_ROWS; ty++) {
+        dirty_count += __builtin_popcount(dirty[ty]);
+    }
+    if (dirty_count == 0) {
+        return HAL_OK;
+    }
+    if (dirty_count >= LCD_DIRTY_FULL_TILES) {
+        status = LCD_SPI_DMA_FlushWindow(hlcd, 0, 0, LCD_WIDTH, LCD_HEIGHT);
         if (status != HAL_OK) {
-            return status;
+            for (uint16_t ty = 0; ty < LCD_TILE_ROWS; ty++) {
+                hlcd->dirty_tiles[ty] |= dirty[ty];
+            }
         }
+        return status;
+    }
 
-        src += transfer_size;
-        remaining -= transfer_size;
+    for (uint16_t ty = 0; ty < LCD_TILE_ROWS && status == HAL_OK; ty++) {
+        while (dirty[ty] != 0 && status == HAL_OK) {
+            // 找出本行最左侧的一段连续脏块 [tx0, tx1]
+            uint16_t tx0 = __builtin_ctz(dirty[ty]);
+            uint16_t tx1 = tx0;
+            while (tx1 + 1 < LCD_TILE_COLS && (dirty[ty] & (1U << (tx1 + 1)))) {
+                tx1++;
+            }
+            uint16_t mask = (uint16_t)(((1U << (tx1 + 1)) - 1) & ~((1U << tx0) - 1));
+
+            // 向下合并包含同一段的行
+            uint16_t ty1 = ty;
+            while (ty1 + 1 < LCD_TILE_ROWS && (dirty[ty1 + 1] & mask) == mask) {
+                ty1++;
+                dirty[ty1] &= ~mask;
+            }
+            dirty[ty] &= ~mask;
+
+            status = LCD_SPI_DMA_FlushWindow(hlcd, tx0 * LCD_TILE_SIZE, ty * LCD_TILE_SIZE,
+                                             (tx1 - tx0 + 1) * LCD_TILE_SIZE,
+                                             (ty1 - ty + 1) * LCD_TILE_SIZE);
+            if (status != HAL_OK) {
+                for (uint16_t r = ty; r <= ty1; r++) {
+                    dirty[r] |= mask;
+                }
+            }
+        }
     }
 
-    return HAL_OK;
+    if (status != HAL_OK) {
+        for (uint16_t ty = 0; ty < LCD_TILE_ROWS; ty++) {
+            hlcd->dirty_tiles[ty] |= dirty[ty];
+        }
+    }
+    return status;
 }
 
 /**
@@ -300,16 +444,18 @@ void LCD_DMA_FillRect(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
     }
 
     // 直接模式 - DMA传输到LCD
-    LCD_SetAddress(x, y, x + width - 1, y + height - 1);
+    LCD_SPI_DMA_SetWindow(hlcd, x, y, width, height);
 
     uint32_t total_pixels = (uint32_t)width * height;
 
     // 预先填充两个缓冲区（对于单色填充，其实只需要填一次，这里为了演示流水线通用性）
     uint32_t buffer_pixels = (total_pixels > hlcd->dma_buffer_size) ? hlcd->dma_buffer_size : total_pixels;
+    LCD_PROF_BEGIN(t0);
     for (uint32_t i = 0; i < buffer_pixels; i++) {
         hlcd->dma_buffer[0][i] = color;
         hlcd->dma_buffer[1][i] = color;
     }
+    LCD_PROF_END(LCD_PROF_PIXEL, t0);
 
     // 分块DMA传输
     uint32_t remaining = total_pixels;
@@ -339,28 +485,46 @@ void LCD_DMA_Clear(LCD_SPI_DMA_Handle_t *hlcd, uint16_t color)
 }
 
 /**
- * @brief 使用DMA绘制图像（高性能v2：双缓冲流水线）
+ * @brief 使用DMA绘制图像
+ * @note  源图可由DMA直接读取时（见 LCD_DMA_CanReadDirect，例如QSPI中的图片）零拷贝发送，
+ *        每次DMA最多 LCD_DMA_MAX_TRANSFER 个像素，整屏只需一次；
+ *        否则复制到双DMA缓冲区，复制下一块的同时SPI DMA发送上一块
  */
 void LCD_DMA_DrawImage(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
                        uint16_t width, uint16_t height, const uint16_t *image)
 {
     if (hlcd->frame_buffer_enabled) {
-        // 帧缓冲模式 - 复制到帧缓冲
-        for (uint16_t row = 0; row < height; row++) {
-            uint32_t fb_offset = (y + row) * LCD_WIDTH + x;
-            uint32_t img_offset = row * width;
-            memcpy(&hlcd->frame_buffer[fb_offset], &image[img_offset], width * sizeof(uint16_t));
-        }
+        // 帧缓冲模式 - 位块传输复制到帧缓冲；等DMA2D读完源图再返回，调用者随后可以改写或释放 image
+        LCD_Blit_Copy(&hlcd->frame_buffer[y * LCD_WIDTH + x], LCD_WIDTH, image, width, width, height);
+        LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+        LCD_FB_MarkDirty(hlcd, x, y, width, height);
         return;
     }
 
     // 直接模式 - DMA传输到LCD
-    LCD_SetAddress(x, y, x + width - 1, y + height - 1);
+    LCD_SPI_DMA_SetWindow(hlcd, x, y, width, height);
 
     uint32_t total_pixels = (uint32_t)width * height;
     uint32_t remaining = total_pixels;
     const uint16_t *src = image;
 
+    if (hlcd->image_zero_copy && LCD_DMA_CanReadDirect(image, total_pixels * sizeof(uint16_t))) {
+        // 零拷贝 - DMA直接读取源图
+        hlcd->image_direct++;
+        while (remaining > 0) {
+            uint32_t transfer_size = (remaining > LCD_DMA_MAX_TRANSFER) ? LCD_DMA_MAX_TRANSFER : remaining;
+            if (LCD_SPI_DMA_WriteBuffer_Async(hlcd, (uint16_t *)src, transfer_size) != HAL_OK) {
+                break;
+            }
+            src += transfer_size;
+            remaining -= transfer_size;
+        }
+        LCD_SPI_DMA_WaitComplete(hlcd);
+        LCD_CS_Deselect;
+        return;
+    }
+
+    hlcd->image_bounce++;
     while (remaining > 0) {
         uint32_t transfer_size = (remaining > hlcd->dma_buffer_size) ? hlcd->dma_buffer_size : remaining;
 
@@ -368,9 +532,12 @@ void LCD_DMA_DrawImage(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
         // 其实 WriteBuffer_Async 内部已经调用了 WaitComplete，所以这里可以直接复制
 
         // 2. 将数据复制到“下一个”缓冲区（当前非忙的那个）
-        // 实际上 WriteBuffer_Async 等待的是 dma_busy，所以只要它返回，
+        // 实际上 WriteBuffer_Async 等待的是上一块的完成中断，所以只要它返回，
         // 说明我们可以开始准备下一个缓冲区了
+        uint32_t start = DWT->CYCCNT;
         memcpy(hlcd->dma_buffer[hlcd->current_buffer], src, transfer_size * sizeof(uint16_t));
+        hlcd->image_copy_cycles += DWT->CYCCNT - start;
+        LCD_PROF_END(LCD_PROF_COPY, start);
 
         // 3. 异步启动传输
         LCD_SPI_DMA_WriteBuffer_Async(hlcd, hlcd->dma_buffer[hlcd->current_buffer], transfer_size);
@@ -398,7 +565,11 @@ void LCD_FB_SetPixel(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y, uint16_
         return;
     }
 
+    if (LCD_Blit_IsBusy()) {
+        LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+    }
     hlcd->frame_buffer[y * LCD_WIDTH + x] = color;
+    hlcd->dirty_tiles[y / LCD_TILE_SIZE] |= 1U << (x / LCD_TILE_SIZE);
 }
 
 /**
@@ -416,13 +587,9 @@ void LCD_FB_FillRect(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
     if (x + width > LCD_WIDTH) width = LCD_WIDTH - x;
     if (y + height > LCD_HEIGHT) height = LCD_HEIGHT - y;
 
-    // 填充矩形
-    for (uint16_t row = 0; row < height; row++) {
-        uint32_t offset = (y + row) * LCD_WIDTH + x;
-        for (uint16_t col = 0; col < width; col++) {
-            hlcd->frame_buffer[offset + col] = color;
-        }
-    }
+    // 填充矩形（DMA2D异步执行，刷新前等待）
+    LCD_Blit_Fill(&hlcd->frame_buffer[y * LCD_WIDTH + x], LCD_WIDTH, width, height, color);
+    LCD_FB_MarkDirty(hlcd, x, y, width, height);
 }
 
 /**
@@ -434,7 +601,36 @@ void LCD_FB_Clear(LCD_SPI_DMA_Handle_t *hlcd, uint16_t color)
         return;
     }
 
-    for (uint32_t i = 0; i < LCD_FRAME_BUFFER_SIZE; i++) {
-        hlcd->frame_buffer[i] = color;
+    LCD_Blit_Fill(hlcd->frame_buffer, LCD_WIDTH, LCD_WIDTH, LCD_HEIGHT, color);
+    LCD_FB_MarkAllDirty(hlcd);
+}
+
+/**
+ * @brief 标记帧缓冲中的矩形区域为脏（超出屏幕部分自动裁剪）
+ */
+void LCD_FB_MarkDirty(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
+                      uint16_t width, uint16_t height)
+{
+    if (width == 0 || height == 0 || x >= LCD_WIDTH || y >= LCD_HEIGHT) {
+        return;
+    }
+    uint16_t x2 = (x + width > LCD_WIDTH) ? (LCD_WIDTH - 1) : (x + width - 1);
+    uint16_t y2 = (y + height > LCD_HEIGHT) ? (LCD_HEIGHT - 1) : (y + height - 1);
+
+    uint16_t tx0 = x / LCD_TILE_SIZE, tx1 = x2 / LCD_TILE_SIZE;
+    uint16_t mask = (uint16_t)(((1U << (tx1 + 1)) - 1) & ~((1U << tx0) - 1));
+
+    for (uint16_t ty = y / LCD_TILE_SIZE; ty <= y2 / LCD_TILE_SIZE; ty++) {
+        hlcd->dirty_tiles[ty] |= mask;
+    }
+}
+
+/**
+ * @brief 标记整个帧缓冲为脏，下次刷新时整屏发送
+ */
+void LCD_FB_MarkAllDirty(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    for (uint16_t ty = 0; ty < LCD_TILE_ROWS; ty++) {
+        hlcd->dirty_tiles[ty] = (uint16_t)((1U << LCD_TILE_COLS) - 1);
     }
 }
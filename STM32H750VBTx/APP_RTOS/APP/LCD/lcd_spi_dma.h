@@ -13,6 +13,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "cmsis_os2.h"
+#include "dma_sync.h"
 
 /* LCD屏幕尺寸 */
 #define LCD_WIDTH     240
@@ -21,19 +22,40 @@
 /* DMA传输缓冲区配置 */
 #define LCD_DMA_BUFFER_SIZE    (LCD_WIDTH * 32)  // 32行缓冲（15KB，可根据RAM调整）
 #define LCD_FRAME_BUFFER_SIZE  (LCD_WIDTH * LCD_HEIGHT)  // 完整帧缓冲（115KB）
+#ifndef LCD_FRAME_BUFFER_STATIC
+#define LCD_FRAME_BUFFER_STATIC 1         // 0：不分配帧缓冲（CMake 选项 APP_LCD_FRAME_BUFFER=OFF），省下D2的115.2KB
+#endif
+#define LCD_DMA_TIMEOUT_MS     2000                       // 单次DMA传输的等待超时
+
+/* 图片零拷贝发送：DMA1直接读取源图（QSPI映射区、AXI/D2/D3 SRAM），不经DMA缓冲区 */
+#define LCD_DMA_DIRECT_ALIGN   16U        // 源地址对齐：存储器端突发 INC8 x 半字，突发不跨1KB边界
+#define LCD_DMA_MAX_TRANSFER   65528U     // 单次DMA最多像素数（NDTR 16位，取8的倍数使下一块仍然对齐）
+
+/* 帧缓冲脏区跟踪：按16x16像素分块，刷新时只发送被改动过的块 */
+#define LCD_TILE_SIZE          16
+#define LCD_TILE_COLS          (LCD_WIDTH / LCD_TILE_SIZE)    // 15列
+#define LCD_TILE_ROWS          (LCD_HEIGHT / LCD_TILE_SIZE)   // 15行
+#define LCD_TILE_COUNT         (LCD_TILE_COLS * LCD_TILE_ROWS)
+#define LCD_DIRTY_FULL_TILES   (LCD_TILE_COUNT * 9 / 10)      // 脏块超过90%时直接整屏刷新
 
 /* LCD SPI操作结构体 */
 typedef struct {
     SPI_HandleTypeDef *hspi;          // SPI句柄
     DMA_HandleTypeDef *hdma_tx;       // DMA TX句柄
-    volatile bool dma_busy;           // DMA传输忙标志
+    DMA_Sync_t tx_sync;               // DMA完成同步：完成/错误中断唤醒等待任务
     uint16_t *dma_buffer[2];          // 双DMA缓冲区指针 (v2)
     uint8_t current_buffer;           // 当前正在使用的缓冲区索引 (v2)
     uint32_t dma_buffer_size;         // DMA缓冲区大小
     uint16_t *frame_buffer;           // 帧缓冲区指针（可选）
     bool frame_buffer_enabled;        // 帧缓冲模式启用标志
     void (*tc_callback)(void);        // 传输完成回调 (v2)
-    osThreadId_t task_to_notify;      // 用于非阻塞同步的任务句柄 (v2)
+    uint16_t dirty_tiles[LCD_TILE_ROWS]; // 脏块位图，每行一个字，bit n 对应第n列
+    uint32_t flush_windows;           // 上次刷新发送的窗口数
+    uint32_t flush_pixels;            // 上次刷新发送的像素数
+    bool image_zero_copy;             // DrawImage 允许DMA直接读取源图（默认开启）
+    uint32_t image_direct;            // DrawImage 由DMA直接读取源图的次数
+    uint32_t image_bounce;            // DrawImage 经DMA缓冲区复制发送的次数
+    uint32_t image_copy_cycles;       // 复制到DMA缓冲区花费的CPU周期累计
 } LCD_SPI_DMA_Handle_t;
 
 /* LCD SPI DMA操作函数 */
@@ -47,13 +69,18 @@ HAL_StatusTypeDef LCD_SPI_DMA_WriteData16(LCD_SPI_DMA_Handle_t *hlcd, uint16_t d
 HAL_StatusTypeDef LCD_SPI_DMA_WriteBuffer(LCD_SPI_DMA_Handle_t *hlcd, uint16_t *pData, uint32_t length);
 HAL_StatusTypeDef LCD_SPI_DMA_WriteBuffer_Async(LCD_SPI_DMA_Handle_t *hlcd, uint16_t *pData, uint32_t length); // (v2)
 
-/* 等待DMA传输完成 */
-void LCD_SPI_DMA_WaitComplete(LCD_SPI_DMA_Handle_t *hlcd);
+/* 设置显示窗口，之后用 WriteBuffer_Async 连续发送 width*height 个像素 */
+void LCD_SPI_DMA_SetWindow(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
+                           uint16_t width, uint16_t height);
 
-/* 帧缓冲相关函数 */
+/* 等待DMA传输完成：HAL_ERROR 时错误原因见 DMA_Sync_GetError(&hlcd->tx_sync) */
+HAL_StatusTypeDef LCD_SPI_DMA_WaitComplete(LCD_SPI_DMA_Handle_t *hlcd);
+
+/* 帧缓冲相关函数（LCD_FRAME_BUFFER_STATIC 为0时 Enable 返回 HAL_ERROR，Borrow 返回NULL） */
 HAL_StatusTypeDef LCD_SPI_DMA_EnableFrameBuffer(LCD_SPI_DMA_Handle_t *hlcd);
 void LCD_SPI_DMA_DisableFrameBuffer(LCD_SPI_DMA_Handle_t *hlcd);
-HAL_StatusTypeDef LCD_SPI_DMA_FlushFrameBuffer(LCD_SPI_DMA_Handle_t *hlcd);
+HAL_StatusTypeDef LCD_SPI_DMA_FlushFrameBuffer(LCD_SPI_DMA_Handle_t *hlcd);   // 只刷新脏块
+uint16_t *LCD_SPI_DMA_BorrowFrameMemory(LCD_SPI_DMA_Handle_t *hlcd);      // 帧缓冲模式关闭时借用其内存
 
 /* DMA传输完成回调（由用户在stm32h7xx_it.c中调用） */
 void LCD_SPI_DMA_TxCpltCallback(LCD_SPI_DMA_Handle_t *hlcd);
@@ -64,6 +91,7 @@ void LCD_DMA_FillRect(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
 void LCD_DMA_Clear(LCD_SPI_DMA_Handle_t *hlcd, uint16_t color);
 void LCD_DMA_DrawImage(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
                        uint16_t width, uint16_t height, const uint16_t *image);
+bool LCD_DMA_CanReadDirect(const void *src, uint32_t bytes);   // 源数据能否由DMA1直接读取
 
 /* 帧缓冲绘图函数 */
 void LCD_FB_SetPixel(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y, uint16_t color);
@@ -71,4 +99,10 @@ void LCD_FB_FillRect(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
                      uint16_t width, uint16_t height, uint16_t color);
 void LCD_FB_Clear(LCD_SPI_DMA_Handle_t *hlcd, uint16_t color);
 
+/* 脏区标记（直接改写 frame_buffer 时需手动调用；改写前先 LCD_Blit_Wait，
+   FillRect/Clear 的DMA2D操作可能尚未完成） */
+void LCD_FB_MarkDirty(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
+                      uint16_t width, uint16_t height);
+void LCD_FB_MarkAllDirty(LCD_SPI_DMA_Handle_t *hlcd);
+
 #endif /* __LCD_SPI_DMA_H */
@@ -0,0 +1,681 @@
+/**
+ ******************************************************************************
+ * @file    lcd_spi_dma_v2.c
+ * @brief   高性能LCD SPI DMA驱动 - 中断驱动的双缓冲流水线
+ ******************************************************************************
+ * @note
+ *   - CPU填充一个缓冲区的同时，DMA发送另一个缓冲区
+ *   - DMA完成中断直接启动下一个已就绪的缓冲区，不需要任务参与
+ *   - CPU只在两个缓冲区都处于 READY/TRANSFERRING 时才等待
+ *   - SPI数据宽度经 lcd_spi_xfer.c 直接改写寄存器，只在真正需要时切换
+ ******************************************************************************
+ */
+
+#include "lcd_spi_dma_v2.h"
+#include "lcd_spi_154.h"
+#include "lcd_spi_xfer.h"
+#include "mem_region.h"
+#include "lcd_prof.h"
+#include "cmsis_os2.h"
+#include <string.h>
+
+/* 双缓冲区 - 放在D2 SRAM，供DMA直接读取（80行 x 2 = 76.8KB） */
+__attribute__((section(".ram_d2"))) __attribute__((aligned(32))) static uint16_t lcd_v2_buffer0[LCD_SINGLE_BUFFER_SIZE];
+__attribute__((section(".ram_d2"))) __attribute__((aligned(32))) static uint16_t lcd_v2_buffer1[LCD_SINGLE_BUFFER_SIZE];
+
+/* 帧缓冲区 - 115KB，D2 SRAM已被V1驱动占用大半，放在AXI SRAM
+ * 帧缓冲只由CPU读写，刷新时由CPU拷贝到双缓冲区，DMA不直接访问 */
+__attribute__((section(".ram_d1"))) __attribute__((aligned(32))) static uint16_t lcd_v2_frame_buffer[LCD_FULL_FRAME_SIZE];
+
+/* 当前占用SPI的V2句柄，供HAL回调分发 */
+static LCD_SPI_DMA_V2_Handle_t *lcd_v2_active = NULL;
+
+#define LCD_V2_WAIT_TIMEOUT_MS   1000U     // 等待缓冲区/DMA的默认超时
+#define LCD_V2_DMA_MAX_FRAMES    0xFFFFU   // HAL_SPI_Transmit_DMA 单次最大帧数
+
+/* ==================== 内部函数 ==================== */
+
+/**
+ * @brief 等待期间让出CPU（调度器未启动时忙等）
+ */
+static void LCD_V2_Yield(void)
+{
+    if (osKernelGetState() == osKernelRunning) {
+        osThreadYield();
+    }
+}
+
+/**
+ * @brief 切换SPI数据宽度，直接改写 CFG1，仅在与寄存器中的实际值不同时操作
+ * @note  调用前必须确保DMA空闲
+ */
+static HAL_StatusTypeDef LCD_V2_SetDataSize(LCD_SPI_DMA_V2_Handle_t *hlcd, uint32_t data_size)
+{
+    return LCD_Xfer_SetFrame(hlcd->hspi, data_size);
+}
+
+/**
+ * @brief 启动指定缓冲区的DMA传输（任务中须在关中断状态下调用，或在ISR中调用）
+ */
+static void LCD_V2_StartTransfer(LCD_SPI_DMA_V2_Handle_t *hlcd, uint8_t index)
+{
+    DoubleBuffer_t *db = &hlcd->double_buffer;
+
+    db->state[index] = BUFFER_TRANSFERRING;
+    db->transfer_buffer = index;
+    hlcd->dma_busy = true;
+    hlcd->transfer_complete = false;
+
+    LCD_PROF_DMA_START();
+    if (HAL_SPI_Transmit_DMA(hlcd->hspi, (uint8_t *)db->buffer[index], (uint16_t)db->length[index]) != HAL_OK) {
+        db->state[index] = BUFFER_IDLE;
+        hlcd->dma_busy = false;
+        hlcd->error_count++;
+    }
+}
+
+/**
+ * @brief 等待流水线排空（所有缓冲区空闲且DMA停止）
+ */
+static HAL_StatusTypeDef LCD_V2_WaitIdle(LCD_SPI_DMA_V2_Handle_t *hlcd, uint32_t timeout_ms)
+{
+    DoubleBuffer_t *db = &hlcd->double_buffer;
+    uint32_t start = HAL_GetTick();
+    LCD_PROF_BEGIN(t0);
+
+    while (hlcd->dma_busy ||
+           db->state[0] == BUFFER_READY || db->state[1] == BUFFER_READY) {
+        if ((HAL_GetTick() - start) >= timeout_ms) {
+            /* 超时 - 强制停止并复位流水线 */
+            HAL_SPI_DMAStop(hlcd->hspi);
+            __disable_irq();
+            db->state[0] = BUFFER_IDLE;
+            db->state[1] = BUFFER_IDLE;
+            hlcd->dma_busy = false;
+            __enable_irq();
+            hlcd->error_count++;
+            LCD_PROF_END(LCD_PROF_WAIT, t0);
+            return HAL_TIMEOUT;
+        }
+        LCD_V2_Yield();
+    }
+    LCD_PROF_END(LCD_PROF_WAIT, t0);
+    return HAL_OK;
+}
+
+/**
+ * @brief 结束一次窗口写入：根据CS保持模式决定是否释放片选
+ */
+static void LCD_V2_EndWindow(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    if (!hlcd->cs_hold_mode) {
+        LCD_CS_Deselect;
+    }
+}
+
+/* ==================== 初始化和配置函数 ==================== */
+
+/**
+ * @brief 初始化LCD SPI DMA V2驱动
+ */
+HAL_StatusTypeDef LCD_V2_Init(LCD_SPI_DMA_V2_Handle_t *hlcd,
+                               SPI_HandleTypeDef *hspi,
+                               LCD_TransferMode_t mode)
+{
+    if (hlcd == NULL || hspi == NULL) {
+        return HAL_ERROR;
+    }
+
+    memset(hlcd, 0, sizeof(*hlcd));
+    hlcd->hspi = hspi;
+    hlcd->hdma_tx = hspi->hdmatx;
+    hlcd->transfer_mode = mode;
+    hlcd->transfer_complete = true;
+
+    hlcd->double_buffer.buffer[0] = lcd_v2_buffer0;
+    hlcd->double_buffer.buffer[1] = lcd_v2_buffer1;
+    hlcd->double_buffer.state[0] = BUFFER_IDLE;
+    hlcd->double_buffer.state[1] = BUFFER_IDLE;
+    hlcd->double_buffer.buffer_size = LCD_SINGLE_BUFFER_SIZE;
+
+    // 填充水位标记，LCD_V2_GetBufferHighWater 查找最高一个被改写的字
+    for (uint32_t i = 0; i < LCD_SINGLE_BUFFER_SIZE; i++) {
+        lcd_v2_buffer0[i] = LCD_V2_CANARY;
+        lcd_v2_buffer1[i] = LCD_V2_CANARY;
+    }
+
+    lcd_v2_active = hlcd;
+    return HAL_OK;
+}
+
+/**
+ * @brief 反初始化LCD驱动
+ */
+void LCD_V2_DeInit(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    LCD_V2_FlushBuffers(hlcd);
+    LCD_CS_Deselect;
+    LCD_V2_SetDataSize(hlcd, SPI_DATASIZE_8BIT);   // 恢复为8位，兼容 lcd_spi_154.c
+
+    if (lcd_v2_active == hlcd) {
+        lcd_v2_active = NULL;
+    }
+    LCD_V2_DisableFrameBuffer(hlcd);
+    hlcd->hspi = NULL;
+    hlcd->hdma_tx = NULL;
+}
+
+/**
+ * @brief 启用帧缓冲模式
+ */
+HAL_StatusTypeDef LCD_V2_EnableFrameBuffer(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    hlcd->frame_buffer = lcd_v2_frame_buffer;
+    hlcd->frame_buffer_enabled = true;
+    return HAL_OK;
+}
+
+/**
+ * @brief 禁用帧缓冲模式
+ */
+void LCD_V2_DisableFrameBuffer(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    hlcd->frame_buffer = NULL;
+    hlcd->frame_buffer_enabled = false;
+}
+
+/**
+ * @brief 启用CS保持模式
+ */
+void LCD_V2_EnableCSHold(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    hlcd->cs_hold_mode = true;
+}
+
+/**
+ * @brief 禁用CS保持模式
+ */
+void LCD_V2_DisableCSHold(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    if (LCD_V2_WaitIdle(hlcd, LCD_V2_WAIT_TIMEOUT_MS) == HAL_OK) {
+        LCD_CS_Deselect;
+    }
+    hlcd->cs_hold_mode = false;
+}
+
+/**
+ * @brief 设置显存坐标偏移
+ */
+void LCD_V2_SetWindowOffset(LCD_SPI_DMA_V2_Handle_t *hlcd, uint16_t x_offset, uint16_t y_offset)
+{
+    hlcd->x_offset = x_offset;
+    hlcd->y_offset = y_offset;
+}
+
+/* ==================== 数据传输函数 ==================== */
+
+/**
+ * @brief 发送命令（8位，轮询）
+ */
+HAL_StatusTypeDef LCD_V2_WriteCommand(LCD_SPI_DMA_V2_Handle_t *hlcd, uint8_t cmd)
+{
+    HAL_StatusTypeDef status = LCD_V2_WaitIdle(hlcd, LCD_V2_WAIT_TIMEOUT_MS);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    LCD_CS_Select;
+    status = LCD_Xfer_Command(hlcd->hspi, cmd);
+    LCD_V2_EndWindow(hlcd);
+    return status;
+}
+
+/**
+ * @brief 发送8位数据（轮询）
+ */
+HAL_StatusTypeDef LCD_V2_WriteData8(LCD_SPI_DMA_V2_Handle_t *hlcd, uint8_t data)
+{
+    HAL_StatusTypeDef status = LCD_V2_WaitIdle(hlcd, LCD_V2_WAIT_TIMEOUT_MS);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    LCD_CS_Select;
+    status = LCD_Xfer_Data8(hlcd->hspi, &data, 1);
+    LCD_V2_EndWindow(hlcd);
+    return status;
+}
+
+/**
+ * @brief 设置写入窗口
+ * @note  CS在整个命令序列中保持选中，只切换DC
+ */
+HAL_StatusTypeDef LCD_V2_SetWindow(LCD_SPI_DMA_V2_Handle_t *hlcd,
+                                    uint16_t x1, uint16_t y1,
+                                    uint16_t x2, uint16_t y2)
+{
+    HAL_StatusTypeDef status = LCD_V2_WaitIdle(hlcd, LCD_V2_WAIT_TIMEOUT_MS);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    x1 += hlcd->x_offset;  x2 += hlcd->x_offset;
+    y1 += hlcd->y_offset;  y2 += hlcd->y_offset;
+
+    LCD_Xfer_Begin(hlcd->hspi);
+    status = LCD_Xfer_Window(hlcd->hspi, x1, y1, x2, y2);
+
+    /* 后续像素数据均为16位，流水线期间不再切换 */
+    LCD_V2_SetDataSize(hlcd, SPI_DATASIZE_16BIT);
+    return status;
+}
+
+/**
+ * @brief 批量发送16位数据
+ * @note  先排空双缓冲流水线保证数据顺序；超过DMA单次上限时前面的分块同步发送
+ */
+HAL_StatusTypeDef LCD_V2_WriteBuffer(LCD_SPI_DMA_V2_Handle_t *hlcd,
+                                      uint16_t *pData,
+                                      uint32_t length,
+                                      bool async)
+{
+    HAL_StatusTypeDef status = LCD_V2_WaitIdle(hlcd, LCD_V2_WAIT_TIMEOUT_MS);
+    if (status != HAL_OK || length == 0) {
+        return status;
+    }
+
+    LCD_V2_SetDataSize(hlcd, SPI_DATASIZE_16BIT);
+    LCD_CS_Select;
+    LCD_DC_Data;
+
+    while (length > 0) {
+        uint16_t chunk = (length > LCD_V2_DMA_MAX_FRAMES) ? LCD_V2_DMA_MAX_FRAMES : (uint16_t)length;
+
+        if (hlcd->transfer_mode == LCD_TRANSFER_POLLING) {
+            status = LCD_SPI_LL_Transmit(hlcd->hspi, pData, chunk);
+        } else {
+            hlcd->dma_busy = true;
+            hlcd->transfer_complete = false;
+            Mem_Cache_Clean(pData, (uint32_t)chunk * sizeof(uint16_t));    // pData 可能在AXI（帧缓冲）
+            status = HAL_SPI_Transmit_DMA(hlcd->hspi, (uint8_t *)pData, chunk);
+            if (status != HAL_OK) {
+                hlcd->dma_busy = false;
+            } else if (!async || chunk < length || hlcd->transfer_mode == LCD_TRANSFER_DMA_BLOCK) {
+                status = LCD_V2_WaitComplete(hlcd, LCD_V2_WAIT_TIMEOUT_MS);
+            }
+        }
+        if (status != HAL_OK) {
+            break;
+        }
+        if (hlcd->transfer_mode == LCD_TRANSFER_POLLING) {
+            hlcd->transfer_count++;     // DMA传输次数在完成中断中统计
+        }
+        hlcd->total_pixels += chunk;
+        pData += chunk;
+        length -= chunk;
+    }
+    return status;
+}
+
+/**
+ * @brief 等待DMA传输完成（包括双缓冲中已提交但尚未发送的数据）
+ */
+HAL_StatusTypeDef LCD_V2_WaitComplete(LCD_SPI_DMA_V2_Handle_t *hlcd, uint32_t timeout_ms)
+{
+    return LCD_V2_WaitIdle(hlcd, timeout_ms);
+}
+
+/* ==================== 双缓冲管理函数 ==================== */
+
+/**
+ * @brief 获取当前可填充的缓冲区指针
+ */
+uint16_t* LCD_V2_GetWriteBuffer(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    DoubleBuffer_t *db = &hlcd->double_buffer;
+    uint8_t index = db->active_buffer;
+
+    if (db->state[index] == BUFFER_FILLING) {
+        return db->buffer[index];   // 重复获取，未提交前继续填充同一块
+    }
+
+    if (db->state[index] != BUFFER_IDLE) {
+        /* 两个缓冲区都已交给DMA，等待完成中断释放当前这一块 */
+        uint32_t start = HAL_GetTick();
+        LCD_PROF_BEGIN(t0);
+        hlcd->cpu_wait_count++;
+        while (db->state[index] != BUFFER_IDLE) {
+            if ((HAL_GetTick() - start) >= LCD_V2_WAIT_TIMEOUT_MS) {
+                hlcd->error_count++;
+                return NULL;
+            }
+            LCD_V2_Yield();
+        }
+        LCD_PROF_END(LCD_PROF_WAIT, t0);
+    }
+
+    db->state[index] = BUFFER_FILLING;
+    return db->buffer[index];
+}
+
+/**
+ * @brief 标记缓冲区已填充完成，DMA空闲时立即启动，否则由完成中断接力
+ */
+HAL_StatusTypeDef LCD_V2_SubmitBuffer(LCD_SPI_DMA_V2_Handle_t *hlcd, uint32_t pixel_count)
+{
+    DoubleBuffer_t *db = &hlcd->double_buffer;
+    uint8_t index = db->active_buffer;
+
+    if (db->state[index] != BUFFER_FILLING || pixel_count == 0 || pixel_count > db->buffer_size) {
+        return HAL_ERROR;
+    }
+    db->length[index] = pixel_count;
+    db->active_buffer = index ^ 1U;
+
+    if (hlcd->transfer_mode == LCD_TRANSFER_POLLING) {
+        HAL_StatusTypeDef status = LCD_Xfer_Data16(hlcd->hspi, db->buffer[index], pixel_count);
+        db->state[index] = BUFFER_IDLE;
+        hlcd->transfer_count++;
+        hlcd->total_pixels += pixel_count;
+        return status;
+    }
+
+    /* 与完成中断互斥：ISR在 dma_busy 为真时才会接力READY缓冲区 */
+    __disable_irq();
+    db->state[index] = BUFFER_READY;
+    if (!hlcd->dma_busy) {
+        LCD_V2_StartTransfer(hlcd, index);
+    }
+    __enable_irq();
+
+    if (hlcd->transfer_mode == LCD_TRANSFER_DMA_BLOCK) {
+        return LCD_V2_WaitIdle(hlcd, LCD_V2_WAIT_TIMEOUT_MS);
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief 提交未启动的缓冲区并等待流水线排空，结束本次窗口写入
+ */
+HAL_StatusTypeDef LCD_V2_FlushBuffers(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    DoubleBuffer_t *db = &hlcd->double_buffer;
+    HAL_StatusTypeDef status;
+
+    __disable_irq();
+    if (!hlcd->dma_busy) {
+        uint8_t next = db->active_buffer;   // 最早提交的缓冲区
+        if (db->state[next] == BUFFER_READY) {
+            LCD_V2_StartTransfer(hlcd, next);
+        } else if (db->state[next ^ 1U] == BUFFER_READY) {
+            LCD_V2_StartTransfer(hlcd, next ^ 1U);
+        }
+    }
+    __enable_irq();
+
+    status = LCD_V2_WaitIdle(hlcd, LCD_V2_WAIT_TIMEOUT_MS);
+    LCD_V2_EndWindow(hlcd);
+    return status;
+}
+
+/* ==================== 高性能绘图函数 ==================== */
+
+/**
+ * @brief 高性能清屏
+ */
+void LCD_V2_Clear(LCD_SPI_DMA_V2_Handle_t *hlcd, uint16_t color)
+{
+    LCD_V2_FillRect(hlcd, 0, 0, LCD_WIDTH_V2, LCD_HEIGHT_V2, color);
+}
+
+/**
+ * @brief 高性能填充矩形
+ * @note  每个缓冲区只填充一次颜色，之后的分块直接复用
+ */
+void LCD_V2_FillRect(LCD_SPI_DMA_V2_Handle_t *hlcd,
+                     uint16_t x, uint16_t y,
+                     uint16_t width, uint16_t height,
+                     uint16_t color)
+{
+    uint32_t start_time = HAL_GetTick();
+    uint32_t remaining = (uint32_t)width * height;
+    uint32_t filled[2] = {0, 0};
+
+    if (remaining == 0) {
+        return;
+    }
+    if (LCD_V2_SetWindow(hlcd, x, y, x + width - 1, y + height - 1) != HAL_OK) {
+        return;
+    }
+
+    while (remaining > 0) {
+        uint8_t index = hlcd->double_buffer.active_buffer;
+        uint16_t *buf = LCD_V2_GetWriteBuffer(hlcd);
+        uint32_t chunk = (remaining > LCD_SINGLE_BUFFER_SIZE) ? LCD_SINGLE_BUFFER_SIZE : remaining;
+
+        if (buf == NULL) {
+            break;
+        }
+        LCD_PROF_BEGIN(t0);
+        for (uint32_t i = filled[index]; i < chunk; i++) {
+            buf[i] = color;
+        }
+        LCD_PROF_END(LCD_PROF_PIXEL, t0);
+        if (chunk > filled[index]) {
+            filled[index] = chunk;
+        }
+        LCD_V2_SubmitBuffer(hlcd, chunk);
+        remaining -= chunk;
+    }
+
+    LCD_V2_FlushBuffers(hlcd);
+    hlcd->last_transfer_time = HAL_GetTick() - start_time;
+}
+
+/**
+ * @brief 高性能绘制图像，拷贝下一块的同时DMA发送上一块
+ */
+void LCD_V2_DrawImage(LCD_SPI_DMA_V2_Handle_t *hlcd,
+                      uint16_t x, uint16_t y,
+                      uint16_t width, uint16_t height,
+                      const uint16_t *image)
+{
+    uint32_t start_time = HAL_GetTick();
+    uint32_t remaining = (uint32_t)width * height;
+
+    if (remaining == 0 || image == NULL) {
+        return;
+    }
+    if (LCD_V2_SetWindow(hlcd, x, y, x + width - 1, y + height - 1) != HAL_OK) {
+        return;
+    }
+
+    while (remaining > 0) {
+        uint16_t *buf = LCD_V2_GetWriteBuffer(hlcd);
+        uint32_t chunk = (remaining > LCD_SINGLE_BUFFER_SIZE) ? LCD_SINGLE_BUFFER_SIZE : remaining;
+
+        if (buf == NULL) {
+            break;
+        }
+        LCD_PROF_BEGIN(t0);
+        memcpy(buf, image, chunk * sizeof(uint16_t));
+        LCD_PROF_END(LCD_PROF_COPY, t0);
+        LCD_V2_SubmitBuffer(hlcd, chunk);
+        image += chunk;
+        remaining -= chunk;
+    }
+
+    LCD_V2_FlushBuffers(hlcd);
+    hlcd->last_transfer_time = HAL_GetTick() - start_time;
+}
+
+/**
+ * @brief 刷新整个帧缓冲到屏幕
+ */
+HAL_StatusTypeDef LCD_V2_RefreshFrame(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    uint32_t errors;
+
+    if (!hlcd->frame_buffer_enabled || hlcd->frame_buffer == NULL) {
+        return HAL_ERROR;
+    }
+
+    errors = hlcd->error_count;
+    LCD_V2_DrawImage(hlcd, 0, 0, LCD_WIDTH_V2, LCD_HEIGHT_V2, hlcd->frame_buffer);
+    return (hlcd->error_count == errors) ? HAL_OK : HAL_ERROR;
+}
+
+/* ==================== 帧缓冲操作函数 ==================== */
+
+/**
+ * @brief 在帧缓冲中设置像素
+ */
+void LCD_V2_FB_SetPixel(LCD_SPI_DMA_V2_Handle_t *hlcd,
+                        uint16_t x, uint16_t y,
+                        uint16_t color)
+{
+    if (!hlcd->frame_buffer_enabled || x >= LCD_WIDTH_V2 || y >= LCD_HEIGHT_V2) {
+        return;
+    }
+    hlcd->frame_buffer[y * LCD_WIDTH_V2 + x] = color;
+}
+
+/**
+ * @brief 在帧缓冲中填充矩形
+ */
+void LCD_V2_FB_FillRect(LCD_SPI_DMA_V2_Handle_t *hlcd,
+                        uint16_t x, uint16_t y,
+                        uint16_t width, uint16_t height,
+                        uint16_t color)
+{
+    if (!hlcd->frame_buffer_enabled || x >= LCD_WIDTH_V2 || y >= LCD_HEIGHT_V2) {
+        return;
+    }
+    if (x + width > LCD_WIDTH_V2)  width = LCD_WIDTH_V2 - x;
+    if (y + height > LCD_HEIGHT_V2) height = LCD_HEIGHT_V2 - y;
+
+    for (uint16_t row = 0; row < height; row++) {
+        uint16_t *line = &hlcd->frame_buffer[(y + row) * LCD_WIDTH_V2 + x];
+        for (uint16_t col = 0; col < width; col++) {
+            line[col] = color;
+        }
+    }
+}
+
+/**
+ * @brief 清空帧缓冲
+ */
+void LCD_V2_FB_Clear(LCD_SPI_DMA_V2_Handle_t *hlcd, uint16_t color)
+{
+    LCD_V2_FB_FillRect(hlcd, 0, 0, LCD_WIDTH_V2, LCD_HEIGHT_V2, color);
+}
+
+/* ==================== 回调函数 ==================== */
+
+/**
+ * @brief DMA传输完成回调（中断上下文）
+ * @note  释放刚发送完的缓冲区；若另一块已就绪则立即接力启动，保持SPI总线连续
+ */
+void LCD_V2_DMA_TxCpltCallback(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    DoubleBuffer_t *db = &hlcd->double_buffer;
+    uint8_t done = db->transfer_buffer;
+
+    if (db->state[done] == BUFFER_TRANSFERRING) {
+        db->state[done] = BUFFER_IDLE;
+        hlcd->transfer_count++;
+        hlcd->total_pixels += db->length[done];
+
+        if (db->state[done ^ 1U] == BUFFER_READY) {
+            hlcd->isr_chain_count++;
+            LCD_V2_StartTransfer(hlcd, done ^ 1U);
+            return;
+        }
+    } else {
+        /* LCD_V2_WriteBuffer 直接发起的传输 */
+        hlcd->transfer_count++;
+    }
+
+    hlcd->dma_busy = false;
+    hlcd->transfer_complete = true;
+}
+
+/**
+ * @brief DMA传输错误回调（中断上下文）
+ */
+void LCD_V2_DMA_TxErrorCallback(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    hlcd->double_buffer.state[0] = BUFFER_IDLE;
+    hlcd->double_buffer.state[1] = BUFFER_IDLE;
+    hlcd->error_count++;
+    hlcd->dma_busy = false;
+    hlcd->transfer_complete = true;
+}
+
+/**
+ * @brief HAL完成回调分发
+ */
+MEM_ITCM_CODE bool LCD_V2_HandleTxCplt(SPI_HandleTypeDef *hspi)
+{
+    if (lcd_v2_active == NULL || lcd_v2_active->hspi != hspi || !lcd_v2_active->dma_busy) {
+        return false;
+    }
+    LCD_V2_DMA_TxCpltCallback(lcd_v2_active);
+    return true;
+}
+
+/**
+ * @brief HAL错误回调分发
+ */
+bool LCD_V2_HandleError(SPI_HandleTypeDef *hspi)
+{
+    if (lcd_v2_active == NULL || lcd_v2_active->hspi != hspi || !lcd_v2_active->dma_busy) {
+        return false;
+    }
+    LCD_V2_DMA_TxErrorCallback(lcd_v2_active);
+    return true;
+}
+
+/* ==================== 性能监控函数 ==================== */
+
+/**
+ * @brief 获取传输统计信息
+ */
+void LCD_V2_GetStats(LCD_SPI_DMA_V2_Handle_t *hlcd,
+                     uint32_t *transfer_count,
+                     uint32_t *total_pixels,
+                     uint32_t *last_time_ms)
+{
+    if (transfer_count != NULL) *transfer_count = hlcd->transfer_count;
+    if (total_pixels != NULL)   *total_pixels = hlcd->total_pixels;
+    if (last_time_ms != NULL)   *last_time_ms = hlcd->last_transfer_time;
+}
+
+/**
+ * @brief 重置统计信息
+ */
+void LCD_V2_ResetStats(LCD_SPI_DMA_V2_Handle_t *hlcd)
+{
+    __disable_irq();
+    hlcd->transfer_count = 0;
+    hlcd->total_pixels = 0;
+    hlcd->last_transfer_time = 0;
+    hlcd->isr_chain_count = 0;
+    hlcd->cpu_wait_count = 0;
+    hlcd->error_count = 0;
+    __enable_irq();
+}
+
+/**
+ * @brief 双缓冲区的使用水位（字节）
+ */
+uint32_t LCD_V2_GetBufferHighWater(uint8_t index)
+{
+    const uint16_t *buf = (index == 0) ? lcd_v2_buffer0 : lcd_v2_buffer1;
+    uint32_t n = LCD_SINGLE_BUFFER_SIZE;
+
+    while (n > 0 && buf[n - 1] == LCD_V2_CANARY) {
+        n--;
+    }
+    return n * sizeof(uint16_t);
+}
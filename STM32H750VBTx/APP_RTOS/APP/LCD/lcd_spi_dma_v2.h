@@ -33,6 +33,7 @@
 /* 缓冲区大小计算 */
 #define LCD_SINGLE_BUFFER_SIZE   (LCD_WIDTH_V2 * LCD_BUFFER_LINES)
 #define LCD_FULL_FRAME_SIZE      (LCD_WIDTH_V2 * LCD_HEIGHT_V2)
+#define LCD_V2_CANARY            0xA5C3U    // LCD_V2_Init 填入双缓冲区的值，用于统计使用水位
 
 /* 传输模式 */
 typedef enum {
@@ -49,13 +50,16 @@ typedef enum {
     BUFFER_TRANSFERRING          // DMA正在传输
 } BufferState_t;
 
-/* 双缓冲控制结构 */
+/* 双缓冲控制结构
+ * 状态流转：IDLE -> FILLING(GetWriteBuffer) -> READY(SubmitBuffer) -> TRANSFERRING -> IDLE(DMA完成中断)
+ * DMA完成中断会直接启动另一个处于READY状态的缓冲区，CPU只在两个缓冲区都未空闲时才阻塞 */
 typedef struct {
-    uint16_t *buffer[2];         // 双缓冲区指针
-    BufferState_t state[2];      // 双缓冲区状态
-    uint8_t active_buffer;       // 当前活动缓冲区索引（0或1）
-    uint8_t transfer_buffer;     // 当前传输缓冲区索引
-    uint32_t buffer_size;        // 单个缓冲区大小
+    uint16_t *buffer[2];                 // 双缓冲区指针
+    volatile BufferState_t state[2];     // 双缓冲区状态（ISR中修改）
+    volatile uint32_t length[2];         // 已提交的像素数
+    uint8_t active_buffer;               // 当前活动缓冲区索引（0或1），CPU填充用
+    volatile uint8_t transfer_buffer;    // 当前传输缓冲区索引，DMA使用
+    uint32_t buffer_size;                // 单个缓冲区大小（像素）
 } DoubleBuffer_t;
 
 /* LCD SPI DMA V2 操作句柄 */
@@ -77,12 +81,19 @@ typedef struct {
     bool frame_buffer_enabled;       // 帧缓冲模式
 
     /* 性能统计 */
-    uint32_t transfer_count;         // 传输次数
-    uint32_t total_pixels;           // 已传输像素数
+    volatile uint32_t transfer_count;// 传输次数
+    volatile uint32_t total_pixels;  // 已传输像素数
     uint32_t last_transfer_time;     // 上次传输时间（ms）
+    volatile uint32_t isr_chain_count;// 由DMA完成中断直接启动的传输次数
+    uint32_t cpu_wait_count;         // CPU因两个缓冲区都在使用而阻塞的次数
+    volatile uint32_t error_count;   // DMA错误次数
 
     /* CS保持模式 */
     bool cs_hold_mode;               // CS保持模式（减少切换开销）
+
+    /* 显存坐标偏移，与 LCD_SetDirection() 设置的偏移保持一致 */
+    uint16_t x_offset;
+    uint16_t y_offset;
 } LCD_SPI_DMA_V2_Handle_t;
 
 /* ==================== 初始化和配置函数 ==================== */
@@ -125,6 +136,11 @@ void LCD_V2_EnableCSHold(LCD_SPI_DMA_V2_Handle_t *hlcd);
  */
 void LCD_V2_DisableCSHold(LCD_SPI_DMA_V2_Handle_t *hlcd);
 
+/**
+ * @brief 设置显存坐标偏移（翻转方向时为80，见 LCD_SetDirection）
+ */
+void LCD_V2_SetWindowOffset(LCD_SPI_DMA_V2_Handle_t *hlcd, uint16_t x_offset, uint16_t y_offset);
+
 /* ==================== 数据传输函数 ==================== */
 
 /**
@@ -157,11 +173,20 @@ HAL_StatusTypeDef LCD_V2_WriteBuffer(LCD_SPI_DMA_V2_Handle_t *hlcd,
  */
 HAL_StatusTypeDef LCD_V2_WaitComplete(LCD_SPI_DMA_V2_Handle_t *hlcd, uint32_t timeout_ms);
 
+/**
+ * @brief 设置写入窗口（CASET/RASET/RAMWR），之后提交的像素依次写入该窗口
+ * @note  会先等待流水线排空；返回后CS保持选中、DC为数据，SPI处于16位模式
+ */
+HAL_StatusTypeDef LCD_V2_SetWindow(LCD_SPI_DMA_V2_Handle_t *hlcd,
+                                    uint16_t x1, uint16_t y1,
+                                    uint16_t x2, uint16_t y2);
+
 /* ==================== 双缓冲管理函数 ==================== */
 
 /**
  * @brief 获取当前可填充的缓冲区指针
- * @retval 缓冲区指针，如果没有可用缓冲区则返回NULL
+ * @note  两个缓冲区都在等待/正在传输时阻塞，直到DMA释放其中一个
+ * @retval 缓冲区指针，如果超时仍没有可用缓冲区则返回NULL
  */
 uint16_t* LCD_V2_GetWriteBuffer(LCD_SPI_DMA_V2_Handle_t *hlcd);
 
@@ -243,6 +268,13 @@ void LCD_V2_DMA_TxCpltCallback(LCD_SPI_DMA_V2_Handle_t *hlcd);
  */
 void LCD_V2_DMA_TxErrorCallback(LCD_SPI_DMA_V2_Handle_t *hlcd);
 
+/**
+ * @brief HAL回调分发：若该SPI当前由V2驱动占用，则处理完成/错误事件并返回true
+ * @note  在 HAL_SPI_TxCpltCallback / HAL_SPI_ErrorCallback 中最先调用
+ */
+bool LCD_V2_HandleTxCplt(SPI_HandleTypeDef *hspi);
+bool LCD_V2_HandleError(SPI_HandleTypeDef *hspi);
+
 /* ==================== 性能监控函数 ==================== */
 
 /**
@@ -258,4 +290,12 @@ void LCD_V2_GetStats(LCD_SPI_DMA_V2_Handle_t *hlcd,
  */
 void LCD_V2_ResetStats(LCD_SPI_DMA_V2_Handle_t *hlcd);
 
+/**
+ * @brief 双缓冲区的使用水位：第 index 块中最高一个被改写（不等于 LCD_V2_CANARY）的字，
+ *        换算为字节数；0 表示自 LCD_V2_Init 以来从未写入
+ * @note  扫描整块缓冲区，只在统计时调用；末尾像素恰好等于填充值时会少算。
+ *        两块缓冲区（LCD_SINGLE_BUFFER_SIZE x 2 x 2 字节）始终链接在D2，与水位无关
+ */
+uint32_t LCD_V2_GetBufferHighWater(uint8_t index);
+
 #endif /* __LCD_SPI_DMA_V2_H */
@@ -0,0 +1,289 @@
+/**
+ ******************************************************************************
+ * @file    lcd_spi_job.c
+ * @brief   LCD异步窗口写入 - 作业队列与DMA完成中断状态机
+ ******************************************************************************
+ * @note
+ *   作业状态：排队 -> 窗口命令（轮询，中断或提交者关中断时执行）
+ *             -> 像素DMA（超过65535帧时在完成中断中分块接力）-> 释放CS、回调 -> 下一个作业
+ ******************************************************************************
+ */
+
+#include "lcd_spi_job.h"
+#include "lcd_spi_xfer.h"
+#include "lcd_spi_154.h"
+#include "mem_region.h"
+#include "cmsis_os2.h"
+#include <string.h>
+
+#define LCD_JOB_DMA_MAX_FRAMES   0xFFFFU   // HAL_SPI_Transmit_DMA 单次最大帧数
+
+typedef struct {
+    uint16_t x1, y1, x2, y2;        // 控制器坐标（已含偏移）
+    const uint16_t *pixels;         // 下一块待发送的像素
+    uint32_t remaining;             // 未发送的像素数
+    LCD_Job_Callback_t done;
+    void *ctx;
+    uint32_t submit_cycles;         // 提交时的 DWT->CYCCNT
+} LCD_Job_t;
+
+static struct {
+    SPI_HandleTypeDef *hspi;
+    LCD_Job_t queue[LCD_JOB_QUEUE_SIZE];
+    volatile uint32_t head;         // 当前/下一个执行的作业（中断中推进）
+    volatile uint32_t tail;         // 下一个空位（提交者推进）
+    volatile bool running;          // 队列正在执行，完成中断会接力下一个作业
+    uint16_t x_offset;
+    uint16_t y_offset;
+    LCD_Job_Stats_t stats;
+} job_ctx;
+
+static void LCD_Job_Yield(void)
+{
+    if (osKernelGetState() == osKernelRunning) {
+        osThreadYield();
+    }
+}
+
+/**
+ * @brief 发送当前作业的下一块像素
+ */
+static HAL_StatusTypeDef LCD_Job_SendChunk(LCD_Job_t *job)
+{
+    uint16_t chunk = (job->remaining > LCD_JOB_DMA_MAX_FRAMES) ? LCD_JOB_DMA_MAX_FRAMES : (uint16_t)job->remaining;
+    HAL_StatusTypeDef status = LCD_Xfer_Data16_DMA(job_ctx.hspi, job->pixels, chunk);
+
+    if (status == HAL_OK) {
+        job->pixels += chunk;
+        job->remaining -= chunk;
+    }
+    return status;
+}
+
+/**
+ * @brief 启动队首作业：轮询发送窗口命令，再启动像素DMA
+ */
+static HAL_StatusTypeDef LCD_Job_Start(LCD_Job_t *job)
+{
+    HAL_StatusTypeDef status;
+
+    LCD_CS_Select;
+    status = LCD_Xfer_Window(job_ctx.hspi, job->x1, job->y1, job->x2, job->y2);
+    if (status == HAL_OK) {
+        status = LCD_Job_SendChunk(job);
+    }
+    return status;
+}
+
+/**
+ * @brief 记录提交到完成的延迟
+ */
+static void LCD_Job_Record(const LCD_Job_t *job, HAL_StatusTypeDef status)
+{
+    LCD_Job_Stats_t *s = &job_ctx.stats;
+    uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+    uint32_t us = (DWT->CYCCNT - job->submit_cycles) / (cycles_per_us ? cycles_per_us : 1U);
+    uint32_t bin = 0;
+
+    while (bin < LCD_JOB_HIST_BINS - 1U && (us >> bin) != 0U) {
+        bin++;
+    }
+    s->latency_hist[bin]++;
+    if (us > s->latency_max_us) {
+        s->latency_max_us = us;
+    }
+    s->jobs++;
+    if (status != HAL_OK) {
+        s->errors++;
+    }
+}
+
+/**
+ * @brief 结束队首作业并启动后续作业（中断中或关中断状态下调用）
+ */
+static void LCD_Job_Complete(HAL_StatusTypeDef status)
+{
+    for (;;) {
+        LCD_Job_t *job = &job_ctx.queue[job_ctx.head % LCD_JOB_QUEUE_SIZE];
+
+        LCD_CS_Deselect;
+        LCD_Job_Record(job, status);
+        if (job->done != NULL) {
+            job->done(job->ctx, status);
+        }
+        job_ctx.head++;
+
+        if (job_ctx.head == job_ctx.tail) {
+            job_ctx.running = false;
+            return;
+        }
+        status = LCD_Job_Start(&job_ctx.queue[job_ctx.head % LCD_JOB_QUEUE_SIZE]);
+        if (status == HAL_OK) {
+            return;
+        }
+    }
+}
+
+/* ==================== 接口函数 ==================== */
+
+HAL_StatusTypeDef LCD_Job_Init(SPI_HandleTypeDef *hspi)
+{
+    if (hspi == NULL) {
+        return HAL_ERROR;
+    }
+    memset(&job_ctx, 0, sizeof(job_ctx));
+    job_ctx.hspi = hspi;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    return HAL_OK;
+}
+
+void LCD_Job_SetWindowOffset(uint16_t x_offset, uint16_t y_offset)
+{
+    job_ctx.x_offset = x_offset;
+    job_ctx.y_offset = y_offset;
+}
+
+HAL_StatusTypeDef LCD_Job_WriteWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                      const uint16_t *pixels, LCD_Job_Callback_t done, void *ctx)
+{
+    uint32_t start = HAL_GetTick();
+    uint32_t submit, primask;
+    LCD_Job_t *job;
+    HAL_StatusTypeDef status = HAL_OK;
+
+    if (job_ctx.hspi == NULL || pixels == NULL || width == 0 || height == 0) {
+        return HAL_ERROR;
+    }
+
+    /* 队列满时等待空位，等待时间不计入提交开销；空位在关中断后再确认，
+       其它任务可能在两次检查之间抢先占用最后一个空位 */
+    for (;;) {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        if (job_ctx.tail - job_ctx.head < LCD_JOB_QUEUE_SIZE) {
+            break;
+        }
+        __set_PRIMASK(primask);
+        if ((HAL_GetTick() - start) >= LCD_JOB_WAIT_TIMEOUT_MS) {
+            return HAL_TIMEOUT;
+        }
+        LCD_Job_Yield();
+    }
+    submit = DWT->CYCCNT;
+
+    job = &job_ctx.queue[job_ctx.tail % LCD_JOB_QUEUE_SIZE];
+    job->x1 = x + job_ctx.x_offset;
+    job->y1 = y + job_ctx.y_offset;
+    job->x2 = x + width - 1 + job_ctx.x_offset;
+    job->y2 = y + height - 1 + job_ctx.y_offset;
+    job->pixels = pixels;
+    job->remaining = (uint32_t)width * height;
+    job->done = done;
+    job->ctx = ctx;
+    job->submit_cycles = submit;
+    job_ctx.tail++;
+
+    if (!job_ctx.running) {
+        /* 队列空闲：由提交者启动，之后的作业都由完成中断接力 */
+        job_ctx.running = true;
+        status = LCD_Job_Start(job);
+        if (status != HAL_OK) {
+            LCD_Job_Complete(status);
+        }
+    }
+
+    uint32_t cycles = DWT->CYCCNT - submit;
+    job_ctx.stats.submits++;
+    job_ctx.stats.submit_cycles_total += cycles;
+    if (cycles > job_ctx.stats.submit_cycles_max) {
+        job_ctx.stats.submit_cycles_max = cycles;
+    }
+    __set_PRIMASK(primask);
+    return status;
+}
+
+bool LCD_Job_IsBusy(void)
+{
+    return job_ctx.running;
+}
+
+/**
+ * @brief 等待队列中的作业全部完成，超时则停止DMA并丢弃剩余作业
+ * @note  丢弃的作业（含正在发送的）逐个以 HAL_TIMEOUT 调用完成回调，提交者不会一直等下去
+ */
+HAL_StatusTypeDef LCD_Job_WaitIdle(uint32_t timeout_ms)
+{
+    uint32_t start = HAL_GetTick();
+
+    while (job_ctx.running) {
+        if ((HAL_GetTick() - start) >= timeout_ms) {
+            uint32_t primask;
+
+            HAL_SPI_DMAStop(job_ctx.hspi);
+            primask = __get_PRIMASK();
+            __disable_irq();
+            LCD_CS_Deselect;
+            while (job_ctx.head != job_ctx.tail) {
+                LCD_Job_t *job = &job_ctx.queue[job_ctx.head % LCD_JOB_QUEUE_SIZE];
+
+                LCD_Job_Record(job, HAL_TIMEOUT);
+                if (job->done != NULL) {
+                    job->done(job->ctx, HAL_TIMEOUT);
+                }
+                job_ctx.head++;
+            }
+            job_ctx.running = false;
+            __set_PRIMASK(primask);
+            return HAL_TIMEOUT;
+        }
+        LCD_Job_Yield();
+    }
+    return HAL_OK;
+}
+
+MEM_ITCM_CODE bool LCD_Job_HandleTxCplt(SPI_HandleTypeDef *hspi)
+{
+    if (!job_ctx.running || hspi != job_ctx.hspi) {
+        return false;
+    }
+
+    LCD_Job_t *job = &job_ctx.queue[job_ctx.head % LCD_JOB_QUEUE_SIZE];
+    if (job->remaining > 0U) {
+        if (LCD_Job_SendChunk(job) == HAL_OK) {
+            return true;
+        }
+        LCD_Job_Complete(HAL_ERROR);
+        return true;
+    }
+    LCD_Job_Complete(HAL_OK);
+    return true;
+}
+
+bool LCD_Job_HandleError(SPI_HandleTypeDef *hspi)
+{
+    if (!job_ctx.running || hspi != job_ctx.hspi) {
+        return false;
+    }
+    LCD_Job_Complete(HAL_ERROR);
+    return true;
+}
+
+void LCD_Job_GetStats(LCD_Job_Stats_t *stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *stats = job_ctx.stats;
+    __set_PRIMASK(primask);
+}
+
+void LCD_Job_ResetStats(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    memset(&job_ctx.stats, 0, sizeof(job_ctx.stats));
+    __set_PRIMASK(primask);
+}
@@ -0,0 +1,78 @@
+/**
+ ******************************************************************************
+ * @file    lcd_spi_job.h
+ * @brief   LCD异步窗口写入 - 设置窗口与像素发送作为一个作业排队，由中断接力完成
+ ******************************************************************************
+ * @note
+ *   - 调用 LCD_Job_WriteWindow 提交后立即返回，调用方的CPU开销与窗口大小无关
+ *   - 作业按提交顺序执行：CASET/RASET/RAMWR 共11字节在中断中轮询发送（60MHz约1.5us，
+ *     不超过SPI FIFO深度的几倍），像素经 DMA1_Stream1 发送，DMA完成中断释放CS
+ *     并启动下一个作业
+ *   - 像素缓冲区不复制，在完成回调之前不能改写，且必须位于DMA可访问的内存（D1/D2 SRAM）
+ *   - 作业执行期间SPI4归作业队列所有，LCD_Xfer_Begin 会先等待队列排空
+ ******************************************************************************
+ */
+
+#ifndef __LCD_SPI_JOB_H
+#define __LCD_SPI_JOB_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LCD_JOB_QUEUE_SIZE       16      // 同时排队的作业数
+#define LCD_JOB_HIST_BINS        16      // 延迟直方图格数
+#define LCD_JOB_WAIT_TIMEOUT_MS  1000U   // 等待队列空位/排空的默认超时
+
+/* 作业完成回调，在DMA完成中断中调用；status 为 HAL_OK 或出错状态，
+   LCD_Job_WaitIdle 超时丢弃的作业为 HAL_TIMEOUT（在等待的任务中调用） */
+typedef void (*LCD_Job_Callback_t)(void *ctx, HAL_StatusTypeDef status);
+
+/* 作业统计
+ * latency_hist：提交到完成的时间，第0格 <1us，第i格 [2^(i-1), 2^i) us，最后一格包含更长的时间 */
+typedef struct {
+    uint32_t jobs;                               // 已完成的作业数
+    uint32_t errors;                             // 出错的作业数
+    uint32_t latency_hist[LCD_JOB_HIST_BINS];
+    uint32_t latency_max_us;
+    uint32_t submit_cycles_max;                  // LCD_Job_WriteWindow 单次最大CPU周期（不含等待空位）
+    uint64_t submit_cycles_total;
+    uint32_t submits;
+} LCD_Job_Stats_t;
+
+/**
+ * @brief 初始化作业队列并使能DWT周期计数器
+ */
+HAL_StatusTypeDef LCD_Job_Init(SPI_HandleTypeDef *hspi);
+
+/**
+ * @brief 设置显存坐标偏移（与 LCD_SetDirection 对应）
+ */
+void LCD_Job_SetWindowOffset(uint16_t x_offset, uint16_t y_offset);
+
+/**
+ * @brief 提交一次窗口写入
+ * @param x, y, width, height  窗口（屏幕坐标）
+ * @param pixels  RGB565像素，width*height 个，完成回调之前保持有效
+ * @param done    完成回调，可为NULL
+ * @retval HAL_TIMEOUT：队列一直满；HAL_ERROR：参数错误；
+ *         队列空闲时立即启动的作业启动失败，返回该状态（完成回调已以同一状态调用）
+ * @note  队列满时让出CPU等待空位；多个任务可同时提交，空位在关中断后确认；不能在中断中调用
+ */
+HAL_StatusTypeDef LCD_Job_WriteWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                      const uint16_t *pixels, LCD_Job_Callback_t done, void *ctx);
+
+bool              LCD_Job_IsBusy(void);
+HAL_StatusTypeDef LCD_Job_WaitIdle(uint32_t timeout_ms);
+
+/**
+ * @brief HAL回调分发：若该SPI当前由作业队列占用，则处理完成/错误事件并返回true
+ * @note  在 HAL_SPI_TxCpltCallback / HAL_SPI_ErrorCallback 中最先调用
+ */
+bool LCD_Job_HandleTxCplt(SPI_HandleTypeDef *hspi);
+bool LCD_Job_HandleError(SPI_HandleTypeDef *hspi);
+
+void LCD_Job_GetStats(LCD_Job_Stats_t *stats);
+void LCD_Job_ResetStats(void);
+
+#endif /* __LCD_SPI_JOB_H */
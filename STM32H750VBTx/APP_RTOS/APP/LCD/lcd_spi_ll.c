@@ -0,0 +1,158 @@
+/**
+ ******************************************************************************
+ * @file    lcd_spi_ll.c
+ * @brief   LCD SPI4 寄存器级发送（lcd_spi_xfer.c 的底层，仅目标板）
+ ******************************************************************************
+ * @note
+ *   - 由 lcd_spi_154.c 中原 LCD_SPI_Transmit / LCD_SPI_TransmitBuffer 整理而来：
+ *     TSIZE=0（不限长度），填满FIFO后等待TXC，再用 CSUSP 挂起并关闭SPE
+ *   - CFG1 只能在 SPE=0 时改写；每次发送结束都会关闭SPE，
+ *     HAL的DMA传输在完成中断中同样会关闭SPE
+ *   - 不修改 hspi->State 以外的HAL句柄字段，也不调用 HAL_SPI_Init
+ ******************************************************************************
+ */
+
+#include "lcd_spi_xfer.h"
+
+#define LCD_SPI_LL_TIMEOUT_MS    1000U
+
+/**
+ * @brief 等待标志位变化，超时返回 HAL_TIMEOUT
+ */
+static HAL_StatusTypeDef LCD_SPI_LL_WaitFlag(SPI_TypeDef *spi, uint32_t flag, uint32_t tickstart)
+{
+    while ((spi->SR & flag) == 0U) {
+        if ((HAL_GetTick() - tickstart) >= LCD_SPI_LL_TIMEOUT_MS) {
+            return HAL_TIMEOUT;
+        }
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief 等待最后一帧移出后挂起传输、清除标志并关闭SPI
+ */
+static HAL_StatusTypeDef LCD_SPI_LL_Close(SPI_HandleTypeDef *hspi, uint32_t tickstart)
+{
+    SPI_TypeDef *spi = hspi->Instance;
+    HAL_StatusTypeDef status = LCD_SPI_LL_WaitFlag(spi, SPI_SR_TXC, tickstart);
+
+    SET_BIT(spi->CR1, SPI_CR1_CSUSP);               // 请求挂起SPI传输
+    if (LCD_SPI_LL_WaitFlag(spi, SPI_SR_SUSP, tickstart) != HAL_OK) {
+        status = HAL_TIMEOUT;
+    }
+
+    SET_BIT(spi->IFCR, SPI_IFCR_EOTC | SPI_IFCR_TXTFC | SPI_IFCR_SUSPC | SPI_IFCR_UDRC);
+    CLEAR_BIT(spi->CR1, SPI_CR1_SPE);
+    hspi->State = HAL_SPI_STATE_READY;
+
+    if (status != HAL_OK) {
+        SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_TIMEOUT);
+    }
+    return status;
+}
+
+/**
+ * @brief 启动一次不限长度的发送
+ */
+static HAL_StatusTypeDef LCD_SPI_LL_Start(SPI_HandleTypeDef *hspi)
+{
+    SPI_TypeDef *spi = hspi->Instance;
+
+    if (hspi->State != HAL_SPI_STATE_READY) {
+        return HAL_BUSY;
+    }
+    hspi->State = HAL_SPI_STATE_BUSY_TX;
+    hspi->ErrorCode = HAL_SPI_ERROR_NONE;
+
+    MODIFY_REG(spi->CR2, SPI_CR2_TSIZE, 0);         // 不使用硬件 TSIZE 控制
+    SET_BIT(spi->CR1, SPI_CR1_SPE);
+    SET_BIT(spi->CR1, SPI_CR1_CSTART);
+    return HAL_OK;
+}
+
+uint32_t LCD_SPI_LL_GetDataSize(SPI_HandleTypeDef *hspi)
+{
+    return hspi->Instance->CFG1 & SPI_CFG1_DSIZE;
+}
+
+void LCD_SPI_LL_SetDataSize(SPI_HandleTypeDef *hspi, uint32_t data_size)
+{
+    SPI_TypeDef *spi = hspi->Instance;
+
+    CLEAR_BIT(spi->CR1, SPI_CR1_SPE);
+    MODIFY_REG(spi->CFG1, SPI_CFG1_DSIZE, data_size);
+}
+
+/**
+ * @brief 按当前帧宽轮询发送，8位帧按字节、16位帧按半字写 TXDR
+ */
+HAL_StatusTypeDef LCD_SPI_LL_Transmit(SPI_HandleTypeDef *hspi, const void *data, uint32_t frames)
+{
+    SPI_TypeDef *spi = hspi->Instance;
+    uint32_t tickstart = HAL_GetTick();
+    HAL_StatusTypeDef status;
+
+    if (frames == 0U) {
+        return HAL_OK;
+    }
+    status = LCD_SPI_LL_Start(hspi);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    if ((spi->CFG1 & SPI_CFG1_DSIZE) > SPI_DATASIZE_8BIT) {
+        const uint16_t *p = (const uint16_t *)data;
+        while (frames > 0U) {
+            if (spi->SR & SPI_SR_TXP) {
+                *((__IO uint16_t *)&spi->TXDR) = *p++;
+                frames--;
+            } else if ((HAL_GetTick() - tickstart) >= LCD_SPI_LL_TIMEOUT_MS) {
+                break;
+            }
+        }
+    } else {
+        const uint8_t *p = (const uint8_t *)data;
+        while (frames > 0U) {
+            if (spi->SR & SPI_SR_TXP) {
+                *((__IO uint8_t *)&spi->TXDR) = *p++;
+                frames--;
+            } else if ((HAL_GetTick() - tickstart) >= LCD_SPI_LL_TIMEOUT_MS) {
+                break;
+            }
+        }
+    }
+
+    status = LCD_SPI_LL_Close(hspi, tickstart);
+    return (frames == 0U) ? status : HAL_TIMEOUT;
+}
+
+/**
+ * @brief 重复发送同一个16位帧（清屏、填充矩形）
+ */
+HAL_StatusTypeDef LCD_SPI_LL_Fill(SPI_HandleTypeDef *hspi, uint16_t value, uint32_t frames)
+{
+    SPI_TypeDef *spi = hspi->Instance;
+    uint32_t tickstart = HAL_GetTick();
+    HAL_StatusTypeDef status;
+
+    if (frames == 0U) {
+        return HAL_OK;
+    }
+    status = LCD_SPI_LL_Start(hspi);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    while (frames > 0U) {
+        if (spi->SR & SPI_SR_TXP) {
+            *((__IO uint16_t *)&spi->TXDR) = value;
+            frames--;
+        } else if ((HAL_GetTick() - tickstart) >= LCD_SPI_LL_TIMEOUT_MS) {
+            break;
+        }
+    }
+
+    status = LCD_SPI_LL_Close(hspi, tickstart);
+    return (frames == 0U) ? status : HAL_TIMEOUT;
+}
@@ -0,0 +1,154 @@
+/**
+ ******************************************************************************
+ * @file    lcd_spi_xfer.c
+ * @brief   ST7789 命令/数据传输层
+ ******************************************************************************
+ */
+
+#include "lcd_spi_xfer.h"
+#include "lcd_spi_job.h"
+#include "lcd_spi_154.h"
+#include "mem_region.h"
+#include "lcd_prof.h"
+
+static LCD_Xfer_Stats_t xfer_stats;
+
+/**
+ * @brief 设置SPI帧宽，以 CFG1 中的实际值为准，相同时不做任何操作
+ */
+HAL_StatusTypeDef LCD_Xfer_SetFrame(SPI_HandleTypeDef *hspi, uint32_t data_size)
+{
+    if (LCD_SPI_LL_GetDataSize(hspi) != data_size) {
+        if (hspi->State != HAL_SPI_STATE_READY) {
+            return HAL_BUSY;
+        }
+        LCD_SPI_LL_SetDataSize(hspi, data_size);
+        xfer_stats.frame_switches++;
+    }
+    hspi->Init.DataSize = data_size;    // HAL传输函数按句柄中的配置计算帧数
+    return HAL_OK;
+}
+
+/**
+ * @brief 开始一次事务，异步窗口作业（lcd_spi_job.c）未完成时先等待其排空
+ */
+void LCD_Xfer_Begin(SPI_HandleTypeDef *hspi)
+{
+    (void)hspi;
+    if (LCD_Job_IsBusy()) {
+        LCD_Job_WaitIdle(LCD_JOB_WAIT_TIMEOUT_MS);
+    }
+    xfer_stats.transactions++;
+    LCD_CS_Select;
+}
+
+void LCD_Xfer_End(SPI_HandleTypeDef *hspi)
+{
+    (void)hspi;
+    LCD_CS_Deselect;
+}
+
+HAL_StatusTypeDef LCD_Xfer_Command(SPI_HandleTypeDef *hspi, uint8_t cmd)
+{
+    HAL_StatusTypeDef status = LCD_Xfer_SetFrame(hspi, SPI_DATASIZE_8BIT);
+    if (status != HAL_OK) {
+        return status;
+    }
+    LCD_DC_Command;
+    xfer_stats.commands++;
+    status = LCD_SPI_LL_Transmit(hspi, &cmd, 1);
+    LCD_DC_Data;
+    return status;
+}
+
+HAL_StatusTypeDef LCD_Xfer_Data8(SPI_HandleTypeDef *hspi, const uint8_t *data, uint32_t len)
+{
+    HAL_StatusTypeDef status = LCD_Xfer_SetFrame(hspi, SPI_DATASIZE_8BIT);
+    if (status != HAL_OK) {
+        return status;
+    }
+    LCD_DC_Data;
+    xfer_stats.data_bytes += len;
+    return LCD_SPI_LL_Transmit(hspi, data, len);
+}
+
+HAL_StatusTypeDef LCD_Xfer_Data16(SPI_HandleTypeDef *hspi, const uint16_t *data, uint32_t count)
+{
+    HAL_StatusTypeDef status = LCD_Xfer_SetFrame(hspi, SPI_DATASIZE_16BIT);
+    if (status != HAL_OK) {
+        return status;
+    }
+    LCD_DC_Data;
+    xfer_stats.data_bytes += count * 2U;
+    return LCD_SPI_LL_Transmit(hspi, data, count);
+}
+
+HAL_StatusTypeDef LCD_Xfer_Fill16(SPI_HandleTypeDef *hspi, uint16_t value, uint32_t count)
+{
+    HAL_StatusTypeDef status = LCD_Xfer_SetFrame(hspi, SPI_DATASIZE_16BIT);
+    if (status != HAL_OK) {
+        return status;
+    }
+    LCD_DC_Data;
+    xfer_stats.data_bytes += count * 2U;
+    return LCD_SPI_LL_Fill(hspi, value, count);
+}
+
+/**
+ * @brief 设置写入窗口，命令和参数都按8位发送，整个序列只有一次帧宽切换（如果有）
+ */
+HAL_StatusTypeDef LCD_Xfer_Window(SPI_HandleTypeDef *hspi, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    uint8_t param[4];
+    HAL_StatusTypeDef status;
+    LCD_PROF_BEGIN(t0);
+
+    param[0] = x1 >> 8;  param[1] = x1 & 0xFF;
+    param[2] = x2 >> 8;  param[3] = x2 & 0xFF;
+    status = LCD_Xfer_Command(hspi, 0x2A);          // 列地址
+    if (status == HAL_OK) {
+        status = LCD_Xfer_Data8(hspi, param, 4);
+    }
+
+    param[0] = y1 >> 8;  param[1] = y1 & 0xFF;
+    param[2] = y2 >> 8;  param[3] = y2 & 0xFF;
+    if (status == HAL_OK) {
+        status = LCD_Xfer_Command(hspi, 0x2B);      // 行地址
+    }
+    if (status == HAL_OK) {
+        status = LCD_Xfer_Data8(hspi, param, 4);
+    }
+
+    if (status == HAL_OK) {
+        status = LCD_Xfer_Command(hspi, 0x2C);      // 写显存
+    }
+    LCD_PROF_END(LCD_PROF_SETADDR, t0);
+    return status;
+}
+
+HAL_StatusTypeDef LCD_Xfer_Data16_DMA(SPI_HandleTypeDef *hspi, const uint16_t *data, uint16_t count)
+{
+    HAL_StatusTypeDef status = LCD_Xfer_SetFrame(hspi, SPI_DATASIZE_16BIT);
+    if (status != HAL_OK) {
+        return status;
+    }
+    LCD_DC_Data;
+    // D-Cache开启时写回CPU刚写入的数据（AXI中的帧缓冲、翻转页面；D2不可缓存，直接返回），DMA读取的是内存而不是缓存
+    Mem_Cache_Clean(data, (uint32_t)count * sizeof(uint16_t));
+    LCD_PROF_DMA_START();
+    xfer_stats.data_bytes += (uint32_t)count * 2U;
+    return HAL_SPI_Transmit_DMA(hspi, (const uint8_t *)data, count);
+}
+
+void LCD_Xfer_GetStats(LCD_Xfer_Stats_t *stats)
+{
+    *stats = xfer_stats;
+}
+
+void LCD_Xfer_ResetStats(void)
+{
+    xfer_stats.transactions = 0;
+    xfer_stats.commands = 0;
+    xfer_stats.data_bytes = 0;
+    xfer_stats.frame_switches = 0;
+}
@@ -0,0 +1,72 @@
+/**
+ ******************************************************************************
+ * @file    lcd_spi_xfer.h
+ * @brief   ST7789 命令/数据传输层 - 直接操作SPI4寄存器，热路径上不调用 HAL_SPI_Init
+ ******************************************************************************
+ * @note
+ *   - 一次事务：LCD_Xfer_Begin 拉低CS，期间任意组合命令/参数/像素阶段，
+ *     LCD_Xfer_End 释放CS；阶段之间只切换DC引脚
+ *   - 8位/16位帧宽直接改写 CFG1.DSIZE（SPE=0时），不再经过 HAL_SPI_Init；
+ *     以寄存器中的实际值为准，同时同步 hspi->Init.DataSize，
+ *     HAL_SPI_Transmit / HAL_SPI_Transmit_DMA 仍按句柄中的配置计算帧数
+ *   - 命令和参数按8位轮询发送，像素按16位轮询或经 DMA1_Stream1 发送
+ *   - 寄存器操作集中在 lcd_spi_ll.c，主机端由 Host/Src/host_spi.c 模拟
+ ******************************************************************************
+ */
+
+#ifndef __LCD_SPI_XFER_H
+#define __LCD_SPI_XFER_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* 传输统计 */
+typedef struct {
+    uint32_t transactions;      // LCD_Xfer_Begin 次数（CS选中次数）
+    uint32_t commands;          // 命令字节数
+    uint32_t data_bytes;        // 参数和像素字节数（轮询与DMA；V2流水线直接调用HAL的DMA不计入）
+    uint32_t frame_switches;    // CFG1.DSIZE 实际改写次数
+} LCD_Xfer_Stats_t;
+
+/**
+ * @brief 设置SPI帧宽
+ * @param data_size SPI_DATASIZE_8BIT 或 SPI_DATASIZE_16BIT
+ * @retval HAL_BUSY：SPI正在传输（DMA未完成），不能改写 CFG1
+ */
+HAL_StatusTypeDef LCD_Xfer_SetFrame(SPI_HandleTypeDef *hspi, uint32_t data_size);
+
+/* 事务：CS在 Begin 与 End 之间保持选中 */
+void LCD_Xfer_Begin(SPI_HandleTypeDef *hspi);
+void LCD_Xfer_End(SPI_HandleTypeDef *hspi);
+
+/* 轮询发送（须在事务内调用） */
+HAL_StatusTypeDef LCD_Xfer_Command(SPI_HandleTypeDef *hspi, uint8_t cmd);
+HAL_StatusTypeDef LCD_Xfer_Data8(SPI_HandleTypeDef *hspi, const uint8_t *data, uint32_t len);
+HAL_StatusTypeDef LCD_Xfer_Data16(SPI_HandleTypeDef *hspi, const uint16_t *data, uint32_t count);
+HAL_StatusTypeDef LCD_Xfer_Fill16(SPI_HandleTypeDef *hspi, uint16_t value, uint32_t count);
+
+/**
+ * @brief 设置写入窗口（CASET/RASET/RAMWR），坐标为控制器坐标（已含偏移）
+ * @note  返回时处于RAMWR数据阶段，随后用 Data16/Fill16/Data16_DMA 写像素
+ */
+HAL_StatusTypeDef LCD_Xfer_Window(SPI_HandleTypeDef *hspi, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+/**
+ * @brief 经 DMA 发送16位像素，立即返回
+ * @note  完成由 HAL_SPI_TxCpltCallback 通知；完成前不能调用其他传输函数或 End；
+ *        data 在可缓存的AXI SRAM中时先写回对应的D-Cache行
+ */
+HAL_StatusTypeDef LCD_Xfer_Data16_DMA(SPI_HandleTypeDef *hspi, const uint16_t *data, uint16_t count);
+
+void LCD_Xfer_GetStats(LCD_Xfer_Stats_t *stats);
+void LCD_Xfer_ResetStats(void);
+
+/* ---- 底层寄存器操作：目标板由 lcd_spi_ll.c 实现，主机端由 host_spi.c 模拟 ---- */
+
+uint32_t          LCD_SPI_LL_GetDataSize(SPI_HandleTypeDef *hspi);                         // 读 CFG1.DSIZE
+void              LCD_SPI_LL_SetDataSize(SPI_HandleTypeDef *hspi, uint32_t data_size);      // 改写 CFG1.DSIZE
+HAL_StatusTypeDef LCD_SPI_LL_Transmit(SPI_HandleTypeDef *hspi, const void *data, uint32_t frames);  // 按当前帧宽轮询发送
+HAL_StatusTypeDef LCD_SPI_LL_Fill(SPI_HandleTypeDef *hspi, uint16_t value, uint32_t frames);        // 重复发送同一帧
+
+#endif /* __LCD_SPI_XFER_H */
@@ -0,0 +1,219 @@
+/**
+ ******************************************************************************
+ * @file    lcd_strip.c
+ * @brief   行带渲染 - 绘制回调按行带合成，V2双缓冲流水线发送
+ ******************************************************************************
+ */
+
+#include "lcd_strip.h"
+#include "lcd_blend.h"
+#include <string.h>
+
+static LCD_Strip_Stats_t strip_stats;
+
+/* 矩形与行带求交，结果为屏幕坐标的半开区间，不相交时返回 false */
+static bool Strip_Clip(const LCD_Strip_Canvas_t *c, int32_t x, int32_t y, int32_t w, int32_t h,
+                       int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1)
+{
+    *x0 = (x > c->x0) ? x : c->x0;
+    *y0 = (y > c->y0) ? y : c->y0;
+    *x1 = (x + w < c->x0 + c->width) ? x + w : c->x0 + c->width;
+    *y1 = (y + h < c->y0 + c->rows) ? y + h : c->y0 + c->rows;
+    return *x0 < *x1 && *y0 < *y1;
+}
+
+static inline uint16_t *Strip_Row(const LCD_Strip_Canvas_t *c, int32_t x, int32_t y)
+{
+    return &c->buf[(y - c->y0) * c->width + (x - c->x0)];
+}
+
+static void Strip_Fill(uint16_t *dst, int32_t count, uint16_t color)
+{
+    while (count-- > 0) {
+        *dst++ = color;
+    }
+}
+
+/* 光栅化游程写入行带，行带外的像素丢弃 */
+static void Strip_Sink(void *ctx, uint16_t x, uint16_t y, uint16_t len, bool vertical, const uint16_t *colors)
+{
+    const LCD_Strip_Canvas_t *c = (const LCD_Strip_Canvas_t *)ctx;
+    int32_t x0, y0, x1, y1;
+
+    if (!Strip_Clip(c, x, y, vertical ? 1 : len, vertical ? len : 1, &x0, &y0, &x1, &y1)) {
+        return;
+    }
+    if (vertical) {
+        for (int32_t py = y0; py < y1; py++) {
+            *Strip_Row(c, x0, py) = colors[py - y];
+        }
+    } else {
+        memcpy(Strip_Row(c, x0, y0), &colors[x0 - x], (size_t)(x1 - x0) * sizeof(uint16_t));
+    }
+}
+
+/* ==================== 渲染 ==================== */
+
+HAL_StatusTypeDef LCD_Strip_Render(LCD_SPI_DMA_V2_Handle_t *hlcd,
+                                   uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                   LCD_Strip_Draw_t draw, void *ctx)
+{
+    HAL_StatusTypeDef st, flush;
+    uint32_t start = DWT->CYCCNT;
+    uint16_t band_rows;
+
+    if (draw == NULL || width == 0 || height == 0 ||
+        x + width > LCD_WIDTH_V2 || y + height > LCD_HEIGHT_V2) {
+        strip_stats.errors++;
+        return HAL_ERROR;
+    }
+
+    band_rows = (uint16_t)(hlcd->double_buffer.buffer_size / width);
+    if (band_rows > height) {
+        band_rows = height;
+    }
+
+    strip_stats.bands = 0;
+    st = LCD_V2_SetWindow(hlcd, x, y, x + width - 1, y + height - 1);
+    for (uint16_t row = 0; row < height && st == HAL_OK; row += band_rows) {
+        uint16_t rows = (height - row < band_rows) ? height - row : band_rows;
+        LCD_Strip_Band_t *b = &strip_stats.band[strip_stats.bands];
+        LCD_Strip_Canvas_t canvas;
+
+        // 两个缓冲区都在发送队列中时，等待DMA释放较早的一块
+        uint32_t t0 = DWT->CYCCNT;
+        canvas.buf = LCD_V2_GetWriteBuffer(hlcd);
+        uint32_t t1 = DWT->CYCCNT;
+        if (canvas.buf == NULL) {
+            st = HAL_TIMEOUT;
+            break;
+        }
+        canvas.x0 = x;
+        canvas.y0 = y + row;
+        canvas.width = width;
+        canvas.rows = rows;
+        canvas.band = (uint16_t)strip_stats.bands;
+        draw(&canvas, ctx);
+        uint32_t t2 = DWT->CYCCNT;
+
+        st = LCD_V2_SubmitBuffer(hlcd, (uint32_t)width * rows);
+
+        b->y = canvas.y0;
+        b->rows = rows;
+        b->wait_cycles = t1 - t0;
+        b->draw_cycles = t2 - t1;
+        if (b->wait_cycles > strip_stats.wait_cycles_max) strip_stats.wait_cycles_max = b->wait_cycles;
+        if (b->draw_cycles > strip_stats.draw_cycles_max) strip_stats.draw_cycles_max = b->draw_cycles;
+        strip_stats.bands++;
+    }
+
+    // 发送剩余的行带并等待完成
+    flush = LCD_V2_FlushBuffers(hlcd);
+    if (st == HAL_OK) {
+        st = flush;
+    }
+
+    strip_stats.last_cycles = DWT->CYCCNT - start;
+    if (st == HAL_OK) {
+        strip_stats.frames++;
+    } else {
+        strip_stats.errors++;
+    }
+    return st;
+}
+
+/* ==================== 绘图函数 ==================== */
+
+void LCD_Strip_Clear(LCD_Strip_Canvas_t *c, uint16_t color)
+{
+    Strip_Fill(c->buf, (int32_t)c->width * c->rows, color);
+}
+
+void LCD_Strip_FillRect(LCD_Strip_Canvas_t *c, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                        uint16_t color)
+{
+    int32_t x0, y0, x1, y1;
+
+    if (!Strip_Clip(c, x, y, width, height, &x0, &y0, &x1, &y1)) {
+        return;
+    }
+    for (int32_t py = y0; py < y1; py++) {
+        Strip_Fill(Strip_Row(c, x0, py), x1 - x0, color);
+    }
+}
+
+void LCD_Strip_BlendRect(LCD_Strip_Canvas_t *c, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                         uint16_t color, uint8_t alpha)
+{
+    int32_t x0, y0, x1, y1;
+
+    if (alpha >= LCD_BLEND_ALPHA_MAX) {
+        LCD_Strip_FillRect(c, x, y, width, height, color);
+        return;
+    }
+    if (alpha == 0 || !Strip_Clip(c, x, y, width, height, &x0, &y0, &x1, &y1)) {
+        return;
+    }
+    for (int32_t py = y0; py < y1; py++) {
+        uint16_t *p = Strip_Row(c, x0, py);
+        for (int32_t n = x1 - x0; n > 0; n--, p++) {
+            *p = LCD_Blend565(color, *p, alpha);
+        }
+    }
+}
+
+void LCD_Strip_GradientRect(LCD_Strip_Canvas_t *c, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                            uint16_t color1, uint16_t color2)
+{
+    int32_t r1 = (color1 >> 11) & 0x1F, g1 = (color1 >> 5) & 0x3F, b1 = color1 & 0x1F;
+    int32_t r2 = (color2 >> 11) & 0x1F, g2 = (color2 >> 5) & 0x3F, b2 = color2 & 0x1F;
+    int32_t x0, y0, x1, y1;
+
+    if (!Strip_Clip(c, x, y, width, height, &x0, &y0, &x1, &y1)) {
+        return;
+    }
+    // 只计算落在本行带内的行，颜色按在整个矩形中的行号插值
+    for (int32_t py = y0; py < y1; py++) {
+        int32_t row = py - y;
+        uint16_t r = (uint16_t)(r1 + (r2 - r1) * row / height) & 0x1F;
+        uint16_t g = (uint16_t)(g1 + (g2 - g1) * row / height) & 0x3F;
+        uint16_t b = (uint16_t)(b1 + (b2 - b1) * row / height) & 0x1F;
+        Strip_Fill(Strip_Row(c, x0, py), x1 - x0, (uint16_t)((r << 11) | (g << 5) | b));
+    }
+}
+
+void LCD_Strip_DrawImage(LCD_Strip_Canvas_t *c, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                         const uint16_t *image)
+{
+    int32_t x0, y0, x1, y1;
+
+    if (image == NULL || !Strip_Clip(c, x, y, width, height, &x0, &y0, &x1, &y1)) {
+        return;
+    }
+    for (int32_t py = y0; py < y1; py++) {
+        memcpy(Strip_Row(c, x0, py), &image[(py - y) * width + (x0 - x)], (size_t)(x1 - x0) * sizeof(uint16_t));
+    }
+}
+
+void LCD_Strip_Raster(LCD_Strip_Canvas_t *c, LCD_Raster_t *r)
+{
+    r->sink = Strip_Sink;
+    r->ctx = c;
+    r->width = LCD_WIDTH_V2;
+    r->height = LCD_HEIGHT_V2;
+}
+
+/* ==================== 统计 ==================== */
+
+void LCD_Strip_GetStats(LCD_Strip_Stats_t *stats)
+{
+    *stats = strip_stats;
+    // 双缓冲区在 LCD_V2_Init 时填充了标记，最高被改写的位置即实际用到的字节数
+    stats->peak_ram = LCD_V2_GetBufferHighWater(0) + LCD_V2_GetBufferHighWater(1);
+    stats->linked_ram = LCD_SINGLE_BUFFER_SIZE * sizeof(uint16_t) * 2U;
+}
+
+void LCD_Strip_ResetStats(void)
+{
+    memset(&strip_stats, 0, sizeof(strip_stats));
+}
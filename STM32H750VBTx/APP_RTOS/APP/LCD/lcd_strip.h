@@ -0,0 +1,107 @@
+/**
+ ******************************************************************************
+ * @file    lcd_strip.h
+ * @brief   行带渲染 - 不用帧缓冲，按行带重复调用绘制回调，合成后经V2双缓冲流水线发送
+ ******************************************************************************
+ * @note
+ *   - 整屏只需要V2驱动的两块80行缓冲区（各38.4KB，D2 SRAM），不需要115KB的帧缓冲；
+ *     但 lcd_spi_dma.c 的 lcd_frame_buffer 是静态数组，默认仍占用D2，单用行带渲染并不省内存。
+ *     只用行带渲染的固件关闭 CMake 选项 APP_LCD_FRAME_BUFFER 才真正省下这115.2KB
+ *     （此时V1帧缓冲模式不可用）；保留时可经 LCD_SPI_DMA_BorrowFrameMemory 交给其它DMA用户
+ *   - 应用提供绘制回调，每个行带调用一次；回调按屏幕坐标绘制整帧，
+ *     画布的裁剪矩形为当前行带，超出的部分由下面的绘图函数丢弃，
+ *     因此可以任意覆盖绘制，后画的覆盖先画的
+ *   - 回调每帧被调用多次，同一帧内必须画出相同的内容（不要在回调里推进动画状态）
+ *   - DMA发送一个行带时CPU合成下一个；行带高度为缓冲区能容纳的最多整行
+ *   - 显示列表可在回调中用 LCD_DL_RasterBand(dl, c->buf, c->x0, c->y0, c->width, c->rows) 合成
+ *   - 统计：每个行带的绘制/等待周期数；缓冲区使用水位由 LCD_V2_Init 填充的标记在 GetStats 时扫描得到，
+ *     只反映用到了多少，两块缓冲区本身总是链接的；同一时刻只有一个任务使用本模块
+ ******************************************************************************
+ */
+
+#ifndef __LCD_STRIP_H
+#define __LCD_STRIP_H
+
+#include "stm32h7xx_hal.h"
+#include "lcd_spi_dma_v2.h"
+#include "lcd_raster.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* 一帧最多的行带数：宽度不超过屏幕宽度时，每个行带至少 LCD_BUFFER_LINES 行 */
+#define LCD_STRIP_MAX_BANDS     ((LCD_HEIGHT_V2 + LCD_BUFFER_LINES - 1) / LCD_BUFFER_LINES)
+
+/* 画布：当前行带，也是裁剪矩形 [x0, x0+width) x [y0, y0+rows) */
+typedef struct {
+    uint16_t *buf;              // 行带像素，行距为 width
+    uint16_t  x0, y0;           // 行带左上角的屏幕坐标
+    uint16_t  width, rows;
+    uint16_t  band;             // 本帧第几个行带
+} LCD_Strip_Canvas_t;
+
+/**
+ * @brief 绘制回调
+ * @note  调用时行带内容未定义，回调须覆盖整个行带（通常先 LCD_Strip_Clear）
+ */
+typedef void (*LCD_Strip_Draw_t)(LCD_Strip_Canvas_t *c, void *ctx);
+
+/* 单个行带的耗时 */
+typedef struct {
+    uint16_t y, rows;
+    uint32_t draw_cycles;       // 回调合成本行带的周期数
+    uint32_t wait_cycles;       // 等待DMA释放缓冲区的周期数
+} LCD_Strip_Band_t;
+
+typedef struct {
+    uint32_t frames;            // 渲染完成的帧数
+    uint32_t errors;            // 参数错误、获取缓冲区超时或发送失败
+    uint32_t bands;             // 最近一帧的行带数
+    LCD_Strip_Band_t band[LCD_STRIP_MAX_BANDS];     // 最近一帧各行带
+    uint32_t last_cycles;       // 最近一帧从开始到最后一个行带发送完成的周期数
+    uint32_t draw_cycles_max;   // 单个行带绘制的最大周期数
+    uint32_t wait_cycles_max;   // 单个行带等待的最大周期数
+    uint32_t peak_ram;          // 两块V2缓冲区的使用水位之和：自 LCD_V2_Init 以来最高被改写的位置（含其它V2绘制）
+    uint32_t linked_ram;        // 两块V2缓冲区的链接大小（76.8KB），与绘制内容无关，始终占用D2
+} LCD_Strip_Stats_t;
+
+/**
+ * @brief 按行带渲染屏幕上的一个矩形区域
+ * @param x,y,width,height 区域，必须完整位于屏幕内；整屏为 (0, 0, LCD_WIDTH_V2, LCD_HEIGHT_V2)
+ * @param draw 绘制回调，每个行带调用一次
+ * @note  驱动须为DMA模式（LCD_TRANSFER_DMA_ASYNC 下合成与发送重叠）；返回前等待最后一个行带发送完成
+ */
+HAL_StatusTypeDef LCD_Strip_Render(LCD_SPI_DMA_V2_Handle_t *hlcd,
+                                   uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                   LCD_Strip_Draw_t draw, void *ctx);
+
+/* ==================== 回调中使用的绘图函数（屏幕坐标，按行带裁剪）==================== */
+
+void LCD_Strip_Clear(LCD_Strip_Canvas_t *c, uint16_t color);
+void LCD_Strip_FillRect(LCD_Strip_Canvas_t *c, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                        uint16_t color);
+
+/**
+ * @brief 半透明矩形，与行带中已有的像素混合
+ * @param alpha 0~32（LCD_BLEND_ALPHA_MAX）
+ */
+void LCD_Strip_BlendRect(LCD_Strip_Canvas_t *c, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                         uint16_t color, uint8_t alpha);
+
+/* 垂直渐变矩形，color1 渐变到 color2，与 LCD_DrawGradientRect 相同的逐行插值 */
+void LCD_Strip_GradientRect(LCD_Strip_Canvas_t *c, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                            uint16_t color1, uint16_t color2);
+
+/* RGB565图像，行距为 width */
+void LCD_Strip_DrawImage(LCD_Strip_Canvas_t *c, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                         const uint16_t *image);
+
+/**
+ * @brief 得到写入本行带的光栅化目标，用于 LCD_Raster_Line / LCD_Raster_Circle 等
+ * @note  抗锯齿版本与纯色背景 bg 混合，不读取行带中已有的像素
+ */
+void LCD_Strip_Raster(LCD_Strip_Canvas_t *c, LCD_Raster_t *r);
+
+void LCD_Strip_GetStats(LCD_Strip_Stats_t *stats);
+void LCD_Strip_ResetStats(void);
+
+#endif /* __LCD_STRIP_H */
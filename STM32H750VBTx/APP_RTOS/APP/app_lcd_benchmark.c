@@ -3,11 +3,14 @@
  * @brief LCD性能基准测试 - 复杂页面渲染
  */
 
-#include "lcd_spi_dma.h"
+#include "app_lcd_benchmark.h"
 #include "lcd_spi_154.h"
+#include "lcd_spi_xfer.h"
+#include "lcd_display_list.h"
 #include "usart.h"
 #include "cmsis_os2.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
@@ -121,6 +124,53 @@ void LCD_DrawDashboard(LCD_SPI_DMA_Handle_t *hlcd, uint32_t fps, uint32_t frame_
     LCD_FillCircle(220, 15, 8);
 }
 
+/**
+ * @brief 用显示列表绘制与 LCD_DrawDashboard 相同的仪表盘
+ * @note  所有图元先记录，再按行带合成，整屏只设置一次窗口，每个像素只发送一次
+ */
+void LCD_DrawDashboard_DL(LCD_SPI_DMA_Handle_t *hlcd, uint32_t fps, uint32_t frame_count)
+{
+    static LCD_DisplayList_t dl;
+    char text_buf[32];
+
+    // 1. 深蓝色背景
+    LCD_DL_Begin(&dl, true, 0x0010);
+
+    // 2. 顶部标题栏 - 渐变
+    LCD_DL_GradientRect(&dl, 0, 0, 240, 30, COLOR_BLUE, COLOR_CYAN);
+    LCD_DL_Text(&dl, 30, 3, "性能测试", &ASCII_Font24, &CH_Font24, COLOR_WHITE, COLOR_BLUE);
+
+    // 3. FPS显示区域 - 绿色卡片
+    LCD_DL_FillRect(&dl, 10, 40, 220, 50, 0x0660);
+    LCD_DL_DrawRect(&dl, 10, 40, 220, 50, COLOR_GREEN);
+    snprintf(text_buf, sizeof(text_buf), "FPS: %lu", fps);
+    LCD_DL_Text(&dl, 20, 50, text_buf, &ASCII_Font24, NULL, COLOR_WHITE, 0x0660);
+
+    // 4. 帧计数显示 - 橙色卡片
+    LCD_DL_FillRect(&dl, 10, 100, 220, 40, 0x8200);
+    LCD_DL_DrawRect(&dl, 10, 100, 220, 40, COLOR_ORANGE);
+    snprintf(text_buf, sizeof(text_buf), "Frame: %lu", frame_count);
+    LCD_DL_Text(&dl, 20, 110, text_buf, &ASCII_Font24, NULL, COLOR_WHITE, 0x8200);
+
+    // 5. 彩色进度条效果
+    uint16_t colors[] = {COLOR_RED, COLOR_ORANGE, COLOR_YELLOW, COLOR_GREEN, COLOR_CYAN, COLOR_BLUE, COLOR_MAGENTA};
+    for (int i = 0; i < 7; i++) {
+        LCD_DL_FillRect(&dl, 10 + i * 32, 150, 30, 20, colors[i]);
+    }
+
+    // 6. 底部动态条纹（超出右边缘的部分裁掉）
+    uint16_t stripe_offset = (frame_count * 5) % 240;
+    for (int i = 0; i < 6; i++) {
+        uint16_t x = (stripe_offset + i * 40) % 240;
+        LCD_DL_FillRect(&dl, x, 220, 30, 20, colors[i % 7]);
+    }
+
+    // 7. 状态指示灯
+    LCD_DL_FillCircle(&dl, 220, 15, 8, COLOR_GREEN);
+
+    LCD_DL_Render(&dl, hlcd);
+}
+
 /**
  * @brief 绘制复杂的图形测试页面
  */
@@ -196,7 +246,121 @@ void LCD_DrawDataVisualization(LCD_SPI_DMA_Handle_t *hlcd, uint32_t tick)
 }
 
 /**
- * @brief 性能基准测试主函数
+ * @brief 全屏刷新测试：黑白交替整屏填充，中间显示FPS
+ */
+void LCD_DrawFullScreenTest(LCD_SPI_DMA_Handle_t *hlcd, uint32_t fps, uint32_t frame_count)
+{
+    char text_buf[16];
+
+    LCD_DMA_Clear(hlcd, (frame_count % 2) ? COLOR_WHITE : COLOR_BLACK);
+    LCD_SetTextFont(&ASCII_Font24);
+    LCD_SetColor((frame_count % 2) ? COLOR_BLACK : COLOR_WHITE);
+    LCD_SetBackColor((frame_count % 2) ? COLOR_WHITE : COLOR_BLACK);
+    snprintf(text_buf, sizeof(text_buf), "FPS:%lu", fps);
+    LCD_DisplayString(80, 110, text_buf);
+}
+
+/* ==================== 固定帧数测试 ==================== */
+
+/* 显示的FPS数字由帧号生成，每次运行画面相同 */
+static void Scene_Dashboard(LCD_SPI_DMA_Handle_t *hlcd, uint32_t frame)
+{
+    LCD_DrawDashboard(hlcd, frame % 100U, frame);
+}
+
+static void Scene_Graphics(LCD_SPI_DMA_Handle_t *hlcd, uint32_t frame)
+{
+    LCD_DrawComplexGraphicsTest(hlcd, frame);
+}
+
+static void Scene_DataViz(LCD_SPI_DMA_Handle_t *hlcd, uint32_t frame)
+{
+    LCD_DrawDataVisualization(hlcd, frame);
+}
+
+static void Scene_FullScreen(LCD_SPI_DMA_Handle_t *hlcd, uint32_t frame)
+{
+    LCD_DrawFullScreenTest(hlcd, frame % 100U, frame);
+}
+
+static void Scene_Dashboard_DL(LCD_SPI_DMA_Handle_t *hlcd, uint32_t frame)
+{
+    LCD_DrawDashboard_DL(hlcd, frame % 100U, frame);
+}
+
+/* 顺序与 LCD_Benchmark_Run 的模式编号一致 */
+const LCD_Bench_Scene_t LCD_Bench_Scenes[LCD_BENCH_SCENE_COUNT] = {
+    { "dashboard",    Scene_Dashboard },
+    { "graphics",     Scene_Graphics },
+    { "dataviz",      Scene_DataViz },
+    { "fullscreen",   Scene_FullScreen },
+    { "dashboard_dl", Scene_Dashboard_DL },
+};
+
+void LCD_Benchmark_RunScene(LCD_SPI_DMA_Handle_t *hlcd, const LCD_Bench_Scene_t *scene,
+                            uint32_t frames, LCD_Bench_Result_t *result)
+{
+    LCD_Prof_Stats_t prof;
+    LCD_Xfer_Stats_t xfer;
+
+    LCD_Prof_Reset();
+    LCD_Xfer_ResetStats();
+    for (uint32_t n = 0; n < frames; n++) {
+        LCD_Prof_FrameBegin();
+        scene->draw(hlcd, n);
+        LCD_Prof_FrameEnd();
+    }
+    LCD_Prof_GetStats(&prof);
+    LCD_Xfer_GetStats(&xfer);
+
+    result->frames = prof.frames;
+    result->cycles = prof.frame.cycles_total;
+    result->cmd_bytes = xfer.commands;
+    result->bus_bytes = (uint64_t)xfer.commands + xfer.data_bytes;
+}
+
+int LCD_Benchmark_Format(char *buf, uint32_t size, const char *name, const LCD_Bench_Result_t *result)
+{
+    uint32_t frames = (result->frames != 0U) ? result->frames : 1U;
+    uint64_t cycles = (result->cycles != 0U) ? result->cycles : 1U;
+    uint32_t fps_x10 = (uint32_t)((uint64_t)result->frames * SystemCoreClock * 10U / cycles);
+
+    return snprintf(buf, size,
+                    "BENCH scene=%s frames=%lu fps=%lu.%lu cycles_per_frame=%lu bus_bytes_per_frame=%lu cmd_bytes_per_frame=%lu\r\n",
+                    name, (unsigned long)result->frames,
+                    (unsigned long)(fps_x10 / 10U), (unsigned long)(fps_x10 % 10U),
+                    (unsigned long)(result->cycles / frames),
+                    (unsigned long)(result->bus_bytes / frames),
+                    (unsigned long)(result->cmd_bytes / frames));
+}
+
+void LCD_Benchmark_RunFixed(LCD_SPI_DMA_Handle_t *hlcd, uint32_t frames, LCD_Prof_Print_t print)
+{
+    LCD_Bench_Result_t result;
+    char line[192];
+
+    snprintf(line, sizeof(line), "BENCH begin scenes=%u frames=%lu cpu_hz=%lu\r\n",
+             LCD_BENCH_SCENE_COUNT, (unsigned long)frames, (unsigned long)SystemCoreClock);
+    print(line);
+    for (uint32_t i = 0; i < LCD_BENCH_SCENE_COUNT; i++) {
+        LCD_Benchmark_RunScene(hlcd, &LCD_Bench_Scenes[i], frames, &result);
+        LCD_Benchmark_Format(line, sizeof(line), LCD_Bench_Scenes[i].name, &result);
+        print(line);
+    }
+    print("BENCH end\r\n");
+}
+
+/* ==================== 交互演示 ==================== */
+
+static void Benchmark_Print(const char *line)
+{
+    HAL_UART_Transmit(&huart1, (uint8_t*)line, strlen(line), 100);
+}
+
+/**
+ * @brief 交互演示主函数
+ * @note  帧时间由 lcd_prof 用DWT周期计数器统计（不含限帧延时），每秒输出FPS和各阶段剖析报告；
+ *        HAL_GetTick 只用于报告周期和模式切换
  */
 void LCD_Benchmark_Run(LCD_SPI_DMA_Handle_t *hlcd)
 {
@@ -205,11 +369,14 @@ void LCD_Benchmark_Run(LCD_SPI_DMA_Handle_t *hlcd)
     uint32_t last_fps_time = HAL_GetTick();
     uint32_t fps = 0;
     uint32_t test_mode = 0;
+    LCD_Prof_Stats_t stats;
 
     HAL_UART_Transmit(&huart1, (uint8_t*)"\r\n=== LCD Benchmark Started ===\r\n", 32, 100);
+    LCD_Prof_Reset();
 
     while (1) {
-        uint32_t frame_start = HAL_GetTick();
+        LCD_Prof_FrameBegin();
+        uint32_t frame_start = DWT->CYCCNT;
 
         // 根据测试模式绘制不同页面
         switch (test_mode) {
@@ -230,41 +397,48 @@ void LCD_Benchmark_Run(LCD_SPI_DMA_Handle_t *hlcd)
 
             case 3:
                 // 全屏刷新测试
-                LCD_DMA_Clear(hlcd, (frame_count % 2) ? COLOR_WHITE : COLOR_BLACK);
-                LCD_SetTextFont(&ASCII_Font24);
-                LCD_SetColor((frame_count % 2) ? COLOR_BLACK : COLOR_WHITE);
-                LCD_SetBackColor((frame_count % 2) ? COLOR_WHITE : COLOR_BLACK);
-                snprintf(msg, sizeof(msg), "FPS:%lu", fps);
-                LCD_DisplayString(80, 110, msg);
+                LCD_DrawFullScreenTest(hlcd, fps, frame_count);
+                break;
+
+            case 4:
+                // 仪表盘模式（显示列表）
+                LCD_DrawDashboard_DL(hlcd, fps, frame_count);
                 break;
         }
 
+        LCD_Prof_FrameEnd();
+        uint32_t frame_us = (DWT->CYCCNT - frame_start) / (SystemCoreClock / 1000000U);
         frame_count++;
 
-        // 计算FPS
+        // 每秒输出一次：FPS按不限帧时的平均帧时间计算
         uint32_t current_time = HAL_GetTick();
         if (current_time - last_fps_time >= 1000) {
-            fps = frame_count * 1000 / (current_time - last_fps_time);
+            LCD_Prof_GetStats(&stats);
+            uint32_t avg_us = (uint32_t)(stats.frame.cycles_total / stats.frames / (SystemCoreClock / 1000000U));
+            fps = (avg_us != 0U) ? 1000000U / avg_us : 0U;
 
-            snprintf(msg, sizeof(msg), "[Benchmark] Mode:%lu FPS:%lu AvgTime:%lums\r\n",
-                     test_mode, fps, (current_time - last_fps_time) / frame_count);
+            snprintf(msg, sizeof(msg), "[Benchmark] Mode:%lu FPS:%lu AvgTime:%luus\r\n",
+                     test_mode, fps, avg_us);
             HAL_UART_Transmit(&huart1, (uint8_t*)msg, strlen(msg), 100);
+            snprintf(msg, sizeof(msg), "Mode %lu", test_mode);
+            LCD_Prof_Report(msg, Benchmark_Print);
+            LCD_Prof_Reset();
 
             frame_count = 0;
-            last_fps_time = current_time;
+            last_fps_time = HAL_GetTick();
         }
 
         // 每10秒切换测试模式
-        if ((HAL_GetTick() / 10000) % 4 != test_mode) {
-            test_mode = (HAL_GetTick() / 10000) % 4;
+        if ((HAL_GetTick() / 10000) % 5 != test_mode) {
+            test_mode = (HAL_GetTick() / 10000) % 5;
             snprintf(msg, sizeof(msg), "[Benchmark] Switch to Mode %lu\r\n", test_mode);
             HAL_UART_Transmit(&huart1, (uint8_t*)msg, strlen(msg), 100);
+            LCD_Prof_Reset();
         }
 
         // 控制帧率，避免过快
-        uint32_t frame_time = HAL_GetTick() - frame_start;
-        if (frame_time < 50) {
-            osDelay(50 - frame_time);  // 限制最高20 FPS
+        if (frame_us < 50000U) {
+            osDelay((50000U - frame_us) / 1000U);  // 限制最高20 FPS
         }
     }
 }
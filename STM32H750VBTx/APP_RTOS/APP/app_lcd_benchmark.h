@@ -0,0 +1,74 @@
+/**
+ ******************************************************************************
+ * @file    app_lcd_benchmark.h
+ * @brief   LCD性能基准测试 - 固定帧数的场景测试与可解析的结果输出
+ ******************************************************************************
+ * @note
+ *   - 每个场景按帧号绘制，画面（以及总线字节数）只取决于帧号，与运行时间无关
+ *   - LCD_Benchmark_RunFixed 依次运行全部场景各固定帧数，不限帧率，每个场景输出一行：
+ *       BENCH scene=<名称> frames=<帧数> fps=<帧率> cycles_per_frame=<周期> bus_bytes_per_frame=<字节> cmd_bytes_per_frame=<字节>
+ *     前后各有一行 "BENCH begin ..." / "BENCH end"，其余输出不以 "BENCH " 开头
+ *   - 帧时间由 lcd_prof（DWT周期计数器）统计，总线字节数取自传输层统计（lcd_spi_xfer.c）
+ *   - CMake 选项 APP_LCD_BENCHMARK（预设 Bench）让LCD任务启动后只运行一次 LCD_Benchmark_RunFixed；
+ *     主机端 host_lcd_bench 用同样的场景代码对照模拟屏幕检查总线字节数
+ ******************************************************************************
+ */
+
+#ifndef __APP_LCD_BENCHMARK_H
+#define __APP_LCD_BENCHMARK_H
+
+#include "lcd_spi_dma.h"
+#include "lcd_prof.h"
+#include <stdint.h>
+
+#ifndef LCD_BENCH_FRAMES
+#define LCD_BENCH_FRAMES        200U        // 每个场景的帧数
+#endif
+
+#define LCD_BENCH_SCENE_COUNT   5
+
+/* 按帧号绘制一帧，返回时所有传输都已完成 */
+typedef void (*LCD_Bench_Draw_t)(LCD_SPI_DMA_Handle_t *hlcd, uint32_t frame);
+
+typedef struct {
+    const char *name;
+    LCD_Bench_Draw_t draw;
+} LCD_Bench_Scene_t;
+
+typedef struct {
+    uint32_t frames;
+    uint64_t cycles;            // 全部帧的CPU周期
+    uint64_t bus_bytes;         // 命令 + 参数 + 像素
+    uint64_t cmd_bytes;         // 命令字节（DC=0）
+} LCD_Bench_Result_t;
+
+extern const LCD_Bench_Scene_t LCD_Bench_Scenes[LCD_BENCH_SCENE_COUNT];
+
+/* 场景绘制函数 */
+void LCD_DrawDashboard(LCD_SPI_DMA_Handle_t *hlcd, uint32_t fps, uint32_t frame_count);
+void LCD_DrawDashboard_DL(LCD_SPI_DMA_Handle_t *hlcd, uint32_t fps, uint32_t frame_count);
+void LCD_DrawComplexGraphicsTest(LCD_SPI_DMA_Handle_t *hlcd, uint32_t phase);
+void LCD_DrawDataVisualization(LCD_SPI_DMA_Handle_t *hlcd, uint32_t tick);
+void LCD_DrawFullScreenTest(LCD_SPI_DMA_Handle_t *hlcd, uint32_t fps, uint32_t frame_count);
+
+/**
+ * @brief 运行一个场景固定帧数（第0帧到 frames-1 帧），不限帧率
+ * @note  会重置 lcd_prof 和传输层统计
+ */
+void LCD_Benchmark_RunScene(LCD_SPI_DMA_Handle_t *hlcd, const LCD_Bench_Scene_t *scene,
+                            uint32_t frames, LCD_Bench_Result_t *result);
+
+/* 把结果格式化为一行 "BENCH scene=..."（以 "\r\n" 结尾），返回写入的长度 */
+int LCD_Benchmark_Format(char *buf, uint32_t size, const char *name, const LCD_Bench_Result_t *result);
+
+/**
+ * @brief 依次运行全部场景各 frames 帧，每个场景输出一行结果
+ */
+void LCD_Benchmark_RunFixed(LCD_SPI_DMA_Handle_t *hlcd, uint32_t frames, LCD_Prof_Print_t print);
+
+/**
+ * @brief 交互演示：每10秒按时间切换场景，限制20 FPS，每秒输出FPS和剖析报告（结果不可复现）
+ */
+void LCD_Benchmark_Run(LCD_SPI_DMA_Handle_t *hlcd);
+
+#endif /* __APP_LCD_BENCHMARK_H */
@@ -5,47 +5,62 @@
 
 #include "lcd_spi_dma.h"
 #include "lcd_spi_154.h"
+#include "lcd_glyph_cache.h"
+#include "lcd_blend.h"
+#include "lcd_spi_xfer.h"
+#include "lcd_spi_job.h"
+#include "lcd_spi_dma_v2.h"
+#include "lcd_display_server.h"
+#include "lcd_blit.h"
+#include "lcd_jpeg.h"
+#include "lcd_player.h"
+#include "lcd_qoi.h"
+#include "lcd_strip.h"
+#include "lcd_flip.h"
+#include "lcd_display_list.h"
+#include "lcd_image.h"
+#include "mem_region.h"
+#include "isr_event.h"
+#include "lcd_prof.h"
+#include "spi.h"
 #include <stdio.h>
 #include "cmsis_os2.h"
 #include "usart.h"
 #include <string.h>
 
+static void Test_Print(const char *line)
+{
+    HAL_UART_Transmit(&huart1, (uint8_t*)line, strlen(line), 100);
+}
+
 /**
  * @brief 运行LCD v2性能测试
  * @param hlcd LCD DMA句柄
+ * @note  每次填充作为一帧交给 lcd_prof 统计，报告各阶段耗时和瓶颈判断
  */
 void LCD_V2_Performance_Test(LCD_SPI_DMA_Handle_t *hlcd)
 {
-    uint32_t start, end;
-    char log_buf[128];
-
     // 1. 全屏填充测试 (240x240 pixels)
     HAL_UART_Transmit(&huart1, (uint8_t*)"[Test] Starting Full Screen Fill (v2)...\r\n", 42, 100);
 
-    start = HAL_GetTick();
+    LCD_Prof_Reset();
     for(int i = 0; i < 100; i++) {
+        LCD_Prof_FrameBegin();
         LCD_DMA_Clear(hlcd, (i % 2) ? 0xF800 : 0x07E0); // 红绿交替
+        LCD_Prof_FrameEnd();
     }
-    end = HAL_GetTick();
-
-    float time_per_frame = (float)(end - start) / 100.0f;
-    float fps = 1000.0f / time_per_frame;
-
-    snprintf(log_buf, sizeof(log_buf), "[Test] Full Fill: %.2f ms/frame, %.1f FPS\r\n", time_per_frame, fps);
-    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    LCD_Prof_Report("Full Fill", Test_Print);
 
     // 2. 局部矩形流水线测试
     HAL_UART_Transmit(&huart1, (uint8_t*)"[Test] Starting 100x100 Rect Pipelining...\r\n", 44, 100);
 
-    start = HAL_GetTick();
+    LCD_Prof_Reset();
     for(int i = 0; i < 500; i++) {
+        LCD_Prof_FrameBegin();
         LCD_DMA_FillRect(hlcd, 70, 70, 100, 100, (i % 2) ? 0x001F : 0xFFE0); // 蓝黄交替
+        LCD_Prof_FrameEnd();
     }
-    end = HAL_GetTick();
-
-    time_per_frame = (float)(end - start) / 500.0f;
-    snprintf(log_buf, sizeof(log_buf), "[Test] 100x100 Rect: %.2f ms/operation\r\n", time_per_frame);
-    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    LCD_Prof_Report("100x100 Rect", Test_Print);
 }
 
 /**
@@ -79,3 +94,955 @@ void LCD_V2_Example_Gradient(LCD_SPI_DMA_Handle_t *hlcd, uint16_t x, uint16_t y,
     LCD_SPI_DMA_WaitComplete(hlcd);
     LCD_CS_Deselect;
 }
+
+/**
+ * @brief 整屏文字重绘测试：对比字模缓存关闭/开启时的每帧耗时
+ * @note  2412字体，每帧10行x20字符，内容为状态界面常见的标签和数字
+ */
+void LCD_V2_Text_Cache_Test(void)
+{
+    static const char *lines[] = {
+        "FPS: 60.0", "Frame: 12345", "Mode: 2", "Time: 16ms",
+        "CPU: 37%", "SPI: 60MHz", "Temp: 41.5C", "Volt: 3.30V",
+        "Mem: 128KB", "Tick: 987654"
+    };
+    const int frames = 20;
+    uint32_t cyc_us = SystemCoreClock / 1000000U, start, elapsed[2];
+    char log_buf[128];
+    LCD_GlyphCache_Stats_t stats;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    LCD_SetAsciiFont(&ASCII_Font24);
+    LCD_SetColor(LCD_WHITE);
+    LCD_SetBackColor(LCD_BLACK);
+
+    for (int pass = 0; pass < 2; pass++) {
+        LCD_GlyphCache_SetEnabled(pass == 1);
+        LCD_GlyphCache_Invalidate();
+        LCD_GlyphCache_ResetStats();
+
+        start = DWT->CYCCNT;
+        for (int f = 0; f < frames; f++) {
+            for (int row = 0; row < 10; row++) {
+                LCD_DisplayString(0, row * 24, (char *)lines[(row + f) % 10]);
+            }
+        }
+        elapsed[pass] = (DWT->CYCCNT - start) / cyc_us;
+
+        LCD_GlyphCache_GetStats(&stats);
+        snprintf(log_buf, sizeof(log_buf),
+                 "[Text] cache %s: %lu us/frame, hit %lu miss %lu evict %lu\r\n",
+                 pass ? "on " : "off", elapsed[pass] / frames,
+                 stats.hits, stats.misses, stats.evictions);
+        HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    }
+
+    LCD_GlyphCache_SetEnabled(true);
+}
+
+/**
+ * @brief 抗锯齿字模测试：对比1bpp与4bpp字模每字符的解码/混合周期数
+ * @note  4bpp字模由CH_Font32的点阵按2x2超采样缩小为16x16得到，与CH_Font16尺寸相同；
+ *        用DWT周期计数器计时，结果不含SPI发送。LCD_DisplayText 一栏为现有1bpp显示路径
+ *        （含SPI发送）的每字符周期数，作为参照
+ */
+void LCD_V2_Text_AA_Test(void)
+{
+    static uint8_t glyph_4bpp[16 * 8];                   // 16x16，每行8字节
+    static uint16_t pixels[16 * 16];
+    const uint8_t *glyph_1bpp = CH_Font16.pTable;       // 第一个汉字
+    const uint8_t *src = CH_Font32.pTable;
+    const int loops = 1000;
+    uint16_t palette[16];
+    uint32_t start, cycles[4];
+    char log_buf[160];
+
+    /* 2x2超采样：4个子像素的覆盖数换算为0~15 */
+    memset(glyph_4bpp, 0, sizeof(glyph_4bpp));
+    for (int y = 0; y < 16; y++) {
+        for (int x = 0; x < 16; x++) {
+            uint32_t n = 0;
+            for (int k = 0; k < 4; k++) {
+                int sx = x * 2 + (k & 1), sy = y * 2 + (k >> 1);
+                n += (src[sy * 4 + sx / 8] >> (sx % 8)) & 1;
+            }
+            glyph_4bpp[y * 8 + x / 2] |= ((n * 15 + 2) / 4) << ((x & 1) * 4);
+        }
+    }
+
+    /* 使能DWT周期计数器 */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* 1bpp 调色板展开（纯色背景） */
+    LCD_Blend_Palette(palette, 1, 0xFFFF, 0x0000);
+    start = DWT->CYCCNT;
+    for (int i = 0; i < loops; i++) {
+        for (int y = 0; y < 16; y++) {
+            LCD_Blend_ExpandRow(&pixels[y * 16], &glyph_1bpp[y * 2], 16, 1, palette);
+        }
+    }
+    cycles[0] = (DWT->CYCCNT - start) / loops;
+
+    /* 4bpp 调色板展开（纯色背景） */
+    LCD_Blend_Palette(palette, 4, 0xFFFF, 0x0000);
+    start = DWT->CYCCNT;
+    for (int i = 0; i < loops; i++) {
+        for (int y = 0; y < 16; y++) {
+            LCD_Blend_ExpandRow(&pixels[y * 16], &glyph_4bpp[y * 8], 16, 4, palette);
+        }
+    }
+    cycles[1] = (DWT->CYCCNT - start) / loops;
+
+    /* 4bpp 逐像素混合到已有像素上 */
+    start = DWT->CYCCNT;
+    for (int i = 0; i < loops; i++) {
+        for (int y = 0; y < 16; y++) {
+            LCD_Blend_AlphaRow(&pixels[y * 16], &glyph_4bpp[y * 8], 16, 4, (uint16_t)i);
+        }
+    }
+    cycles[2] = (DWT->CYCCNT - start) / loops;
+
+    /* 现有 LCD_DisplayText，16号字体一行10个汉字 */
+    LCD_SetTextFont(&CH_Font16);
+    LCD_SetColor(LCD_WHITE);
+    LCD_SetBackColor(LCD_BLACK);
+    start = DWT->CYCCNT;
+    for (int i = 0; i < 10; i++) {
+        LCD_DisplayText(0, 0, (char *)"反客科技反客科技反客");
+    }
+    cycles[3] = (DWT->CYCCNT - start) / 100;
+
+    snprintf(log_buf, sizeof(log_buf),
+             "[Text AA] cycles/glyph 16x16: 1bpp %lu, 4bpp palette %lu (x%.2f), "
+             "4bpp blend %lu (x%.2f), LCD_DisplayText %lu\r\n",
+             cycles[0], cycles[1], (float)cycles[1] / cycles[0],
+             cycles[2], (float)cycles[2] / cycles[0], cycles[3]);
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+}
+
+/**
+ * @brief 传输层测试：8x16字符窗口每秒写入次数
+ * @note  HAL 一栏按改动前的方式逐阶段调用 HAL_SPI_Transmit，8位/16位切换经 HAL_SPI_Init；
+ *        Xfer 一栏为 LCD_CopyBuffer（寄存器级传输层，一次片选完成窗口和像素）。
+ *        用DWT周期计数器计时，含SPI发送
+ */
+void LCD_V2_Xfer_Test(void)
+{
+    static uint16_t glyph[8 * 16];
+    const int loops = 1000;
+    uint32_t start, cycles[2];
+    LCD_Xfer_Stats_t stats;
+    char log_buf[160];
+
+    for (int i = 0; i < 8 * 16; i++) {
+        glyph[i] = (uint16_t)(i * 0x0841);
+    }
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* 改动前：每个命令/参数单独片选，帧宽切换重新初始化SPI */
+    start = DWT->CYCCNT;
+    for (int i = 0; i < loops; i++) {
+        uint16_t x = (i % 30) * 8, y = ((i / 30) % 15) * 16;
+        uint8_t cmd[3] = { 0x2A, 0x2B, 0x2C };
+        uint8_t param[2][4] = {
+            { x >> 8, x & 0xFF, (x + 7) >> 8, (x + 7) & 0xFF },
+            { y >> 8, y & 0xFF, (y + 15) >> 8, (y + 15) & 0xFF },
+        };
+        for (int k = 0; k < 3; k++) {
+            LCD_CS_Select;
+            LCD_DC_Command;
+            HAL_SPI_Transmit(&hspi4, &cmd[k], 1, 100);
+            LCD_CS_Deselect;
+            if (k < 2) {
+                LCD_CS_Select;
+                LCD_DC_Data;
+                HAL_SPI_Transmit(&hspi4, param[k], 4, 100);
+                LCD_CS_Deselect;
+            }
+        }
+        hspi4.Init.DataSize = SPI_DATASIZE_16BIT;
+        HAL_SPI_Init(&hspi4);
+        LCD_CS_Select;
+        LCD_DC_Data;
+        HAL_SPI_Transmit(&hspi4, (uint8_t *)glyph, 8 * 16, 100);
+        LCD_CS_Deselect;
+        hspi4.Init.DataSize = SPI_DATASIZE_8BIT;
+        HAL_SPI_Init(&hspi4);
+    }
+    cycles[0] = (DWT->CYCCNT - start) / loops;
+
+    /* 传输层 */
+    LCD_Xfer_ResetStats();
+    start = DWT->CYCCNT;
+    for (int i = 0; i < loops; i++) {
+        LCD_CopyBuffer((i % 30) * 8, ((i / 30) % 15) * 16, 8, 16, glyph);
+    }
+    cycles[1] = (DWT->CYCCNT - start) / loops;
+    LCD_Xfer_GetStats(&stats);
+
+    snprintf(log_buf, sizeof(log_buf),
+             "[Xfer] 8x16 windows/s: HAL %lu, Xfer %lu (x%.2f), DSIZE writes %lu/%lu\r\n",
+             SystemCoreClock / cycles[0], SystemCoreClock / cycles[1],
+             (float)cycles[0] / cycles[1], stats.frame_switches, stats.transactions);
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+}
+
+/**
+ * @brief 异步窗口写入测试：字符/图标/整行窗口的提交开销和提交到完成的延迟直方图
+ * @note  像素缓冲区借用V2双缓冲区（D2 SRAM，DMA可访问）
+ */
+void LCD_V2_Job_Test(void)
+{
+    static const struct { uint16_t w, h; const char *name; } sizes[3] = {
+        { 8, 16, "glyph" }, { 32, 32, "icon" }, { 240, 40, "band" },
+    };
+    LCD_SPI_DMA_V2_Handle_t hlcd_v2;
+    LCD_Job_Stats_t stats;
+    char log_buf[200];
+    int len;
+
+    LCD_V2_Init(&hlcd_v2, &hspi4, LCD_TRANSFER_DMA_BLOCK);
+    uint16_t *pixels = LCD_V2_GetWriteBuffer(&hlcd_v2);     // 240x80，足够一个整行窗口
+    for (uint32_t i = 0; i < 240 * 40; i++) {
+        pixels[i] = (uint16_t)(i * 0x0841);
+    }
+    LCD_Job_Init(&hspi4);
+
+    for (int s = 0; s < 3; s++) {
+        uint16_t cols = 240 / sizes[s].w, rows = 240 / sizes[s].h;
+
+        LCD_Job_ResetStats();
+        for (uint32_t k = 0; k < (uint32_t)cols * rows; k++) {
+            LCD_Job_WriteWindow((k % cols) * sizes[s].w, (k / cols) * sizes[s].h,
+                                sizes[s].w, sizes[s].h, pixels, NULL, NULL);
+        }
+        LCD_Job_WaitIdle(LCD_JOB_WAIT_TIMEOUT_MS);
+        LCD_Job_GetStats(&stats);
+
+        len = snprintf(log_buf, sizeof(log_buf), "[Job] %-5s jobs %lu err %lu submit %lu cyc (max %lu) latency:",
+                       sizes[s].name, stats.jobs, stats.errors,
+                       (uint32_t)(stats.submit_cycles_total / stats.submits), stats.submit_cycles_max);
+        for (int b = 0; b < LCD_JOB_HIST_BINS && len < (int)sizeof(log_buf) - 24; b++) {
+            if (stats.latency_hist[b] != 0) {
+                len += snprintf(log_buf + len, sizeof(log_buf) - len, " <%luus:%lu", 1UL << b, stats.latency_hist[b]);
+            }
+        }
+        snprintf(log_buf + len, sizeof(log_buf) - len, "\r\n");
+        HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    }
+    LCD_V2_DeInit(&hlcd_v2);
+}
+
+/**
+ * @brief 显示服务测试：启动服务后连续提交计数文字和进度条，统计合并与帧数
+ * @note  测试结束后服务任务继续运行，之后只能通过 LCD_Server_xxx 绘图
+ */
+void LCD_V2_Server_Test(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    LCD_Style_t style = { 0xFFFF, 0x0010, &ASCII_Font24, NULL };
+    LCD_Srv_Stats_t stats;
+    char text[LCD_SRV_TEXT_MAX];
+    char log_buf[160];
+
+    if (LCD_Server_Start(hlcd) != HAL_OK) {
+        HAL_UART_Transmit(&huart1, (uint8_t*)"[Srv] start failed\r\n", 20, 100);
+        return;
+    }
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    uint32_t start = DWT->CYCCNT;
+    for (uint32_t i = 1; i <= 500; i++) {
+        snprintf(text, sizeof(text), "Count %lu", i);
+        LCD_Server_Text(1, 10, 10, text, &style);
+        LCD_Server_FillRect(2, 10, 50, (uint16_t)(i * 220 / 500), 20, 0x07E0);
+        if (i % 50 == 0) {
+            osDelay(5);
+        }
+    }
+    HAL_StatusTypeDef sync = LCD_Server_Sync(1000);
+    uint32_t elapsed = (DWT->CYCCNT - start) / (SystemCoreClock / 1000000U);
+
+    LCD_Server_GetStats(&stats);
+    snprintf(log_buf, sizeof(log_buf),
+             "[Srv] %lu us posted %lu rejected %lu rendered %lu coalesced %lu frames %lu errors %lu, sync %d\r\n",
+             elapsed, stats.posted, stats.rejected, stats.rendered, stats.coalesced, stats.frames, stats.errors, sync);
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+}
+
+#define BLIT_TEST_W  64
+#define BLIT_TEST_H  48
+
+/**
+ * @brief 位块传输测试：DMA2D与软件后端逐像素比较，帧缓冲清屏耗时
+ * @note  缓冲区放在D2 SRAM（DMA2D不能访问DTCM）；DMA2D一栏是启动到完成的时间，
+ *        overlap 为DMA2D清屏期间CPU空出来的查询次数（CPU不必等待DMA2D）
+ */
+void LCD_V2_Blit_Test(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    static const char *names[] = { "fill", "copy", "rgb888", "argb8888", "blend565", "blend8888" };
+    __attribute__((section(".ram_d2"))) __attribute__((aligned(32))) static uint32_t src[BLIT_TEST_W * BLIT_TEST_H];
+    __attribute__((section(".ram_d2"))) __attribute__((aligned(32))) static uint16_t hw[BLIT_TEST_W * BLIT_TEST_H];
+    __attribute__((section(".ram_d2"))) __attribute__((aligned(32))) static uint16_t sw[BLIT_TEST_W * BLIT_TEST_H];
+    uint32_t mismatch[6] = { 0 };
+    uint32_t seed = 1, start, cycles[4];
+    LCD_Blit_Stats_t stats;
+    char log_buf[200];
+    int len;
+
+    if (LCD_Blit_Init() != HAL_OK) {
+        HAL_UART_Transmit(&huart1, (uint8_t*)"[Blit] DMA2D init failed\r\n", 27, 100);
+        return;
+    }
+    for (uint32_t i = 0; i < BLIT_TEST_W * BLIT_TEST_H; i++) {
+        seed = seed * 1103515245U + 12345U;
+        src[i] = seed;
+    }
+
+    /* 同一操作分别用两种后端执行，比较结果（窄一列的矩形，验证stride） */
+    for (int op = 0; op < 6; op++) {
+        for (int b = 0; b < 2; b++) {
+            uint16_t *dst = (b == 0) ? hw : sw;
+            LCD_Blit_SetBackend(b == 0 ? LCD_BLIT_BACKEND_DMA2D : LCD_BLIT_BACKEND_SW);
+            for (uint32_t i = 0; i < BLIT_TEST_W * BLIT_TEST_H; i++) {
+                dst[i] = (uint16_t)(i * 0x2E5B);
+            }
+            switch (op) {
+            case 0: LCD_Blit_Fill(dst, BLIT_TEST_W, BLIT_TEST_W - 1, BLIT_TEST_H, 0x5AA5); break;
+            case 1: LCD_Blit_Copy(dst, BLIT_TEST_W, (const uint16_t *)src, BLIT_TEST_W, BLIT_TEST_W - 1, BLIT_TEST_H); break;
+            case 2: LCD_Blit_Convert(dst, BLIT_TEST_W, src, BLIT_TEST_W, LCD_BLIT_RGB888, BLIT_TEST_W - 1, BLIT_TEST_H); break;
+            case 3: LCD_Blit_Convert(dst, BLIT_TEST_W, src, BLIT_TEST_W, LCD_BLIT_ARGB8888, BLIT_TEST_W - 1, BLIT_TEST_H); break;
+            case 4: LCD_Blit_Blend(dst, BLIT_TEST_W, src, BLIT_TEST_W, LCD_BLIT_RGB565, 100, BLIT_TEST_W - 1, BLIT_TEST_H); break;
+            default: LCD_Blit_Blend(dst, BLIT_TEST_W, src, BLIT_TEST_W, LCD_BLIT_ARGB8888, 200, BLIT_TEST_W - 1, BLIT_TEST_H); break;
+            }
+            LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+        }
+        for (uint32_t i = 0; i < BLIT_TEST_W * BLIT_TEST_H; i++) {
+            if (hw[i] != sw[i]) mismatch[op]++;
+        }
+    }
+
+    /* 帧缓冲清屏：原逐像素循环、软件后端、DMA2D */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    if (LCD_SPI_DMA_EnableFrameBuffer(hlcd) != HAL_OK) {
+        HAL_UART_Transmit(&huart1, (uint8_t*)"[Blit] no frame buffer\r\n", 24, 100);
+        return;
+    }
+
+    start = DWT->CYCCNT;
+    for (uint32_t i = 0; i < LCD_FRAME_BUFFER_SIZE; i++) {
+        hlcd->frame_buffer[i] = 0x001F;
+    }
+    cycles[0] = DWT->CYCCNT - start;
+
+    LCD_Blit_SetBackend(LCD_BLIT_BACKEND_SW);
+    start = DWT->CYCCNT;
+    LCD_FB_Clear(hlcd, 0x07E0);
+    cycles[1] = DWT->CYCCNT - start;
+
+    LCD_Blit_SetBackend(LCD_BLIT_BACKEND_DMA2D);
+    LCD_Blit_ResetStats();
+    start = DWT->CYCCNT;
+    LCD_FB_Clear(hlcd, 0xF800);
+    uint32_t side_polls = 0;
+    while (LCD_Blit_IsBusy() && side_polls < 4096U) {
+        side_polls++;                   // DMA2D工作期间CPU可以继续做别的事
+    }
+    LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+    cycles[2] = DWT->CYCCNT - start;
+    LCD_Blit_GetStats(&stats);
+
+    start = DWT->CYCCNT;
+    LCD_SPI_DMA_FlushFrameBuffer(hlcd);
+    cycles[3] = DWT->CYCCNT - start;
+    LCD_SPI_DMA_DisableFrameBuffer(hlcd);
+
+    len = snprintf(log_buf, sizeof(log_buf), "[Blit] hw/sw mismatch:");
+    for (int op = 0; op < 6; op++) {
+        len += snprintf(log_buf + len, sizeof(log_buf) - len, " %s %lu", names[op], mismatch[op]);
+    }
+    snprintf(log_buf + len, sizeof(log_buf) - len, "\r\n");
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+
+    snprintf(log_buf, sizeof(log_buf),
+             "[Blit] FB clear us: loop %lu, sw %lu, DMA2D %lu (overlap %lu polls, hw ops %lu err %lu), flush %lu\r\n",
+             cycles[0] / (SystemCoreClock / 1000000U), cycles[1] / (SystemCoreClock / 1000000U),
+             cycles[2] / (SystemCoreClock / 1000000U), side_polls, stats.hw_ops, stats.errors,
+             cycles[3] / (SystemCoreClock / 1000000U));
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+}
+
+/**
+ * @brief JPEG图片测试：硬件与软件解码结果比较，解码与原始图片从QSPI读出、发送的耗时
+ * @note  raw load 为从QSPI读出一张整屏RGB565图片大小（115KB）的数据，以固件所在区域代替图片；
+ *        硬件JPEG的反DCT不保证与软件（libjpeg islow）逐位相同，rows diff 为结果不同的行数
+ */
+void LCD_V2_JPEG_Test(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    static uint32_t row_hash[LCD_HEIGHT];
+    const uint8_t *jpeg = Image_Photo_240x240_jpg;
+    uint32_t size = Image_Photo_240x240_jpg_size;
+    uint32_t start, cycles[5], rows_diff = 0;
+    HAL_StatusTypeDef st[2];
+    LCD_JPEG_Stats_t stats;
+    char log_buf[200];
+
+    if (LCD_JPEG_Init() != HAL_OK) {
+        HAL_UART_Transmit(&huart1, (uint8_t*)"[JPEG] codec init failed\r\n", 26, 100);
+        return;
+    }
+    if (LCD_SPI_DMA_EnableFrameBuffer(hlcd) != HAL_OK) {
+        HAL_UART_Transmit(&huart1, (uint8_t*)"[JPEG] no frame buffer\r\n", 24, 100);
+        return;
+    }
+    uint16_t *fb = hlcd->frame_buffer;
+
+    start = DWT->CYCCNT;
+    memcpy(fb, (const void *)QSPI_BASE, LCD_FRAME_BUFFER_SIZE * sizeof(uint16_t));
+    cycles[0] = DWT->CYCCNT - start;
+
+    /* 软件解码，记录每行的哈希 */
+    LCD_JPEG_SetBackend(LCD_JPEG_BACKEND_SW);
+    start = DWT->CYCCNT;
+    st[0] = LCD_JPEG_Decode(jpeg, size, fb, LCD_WIDTH);
+    cycles[1] = DWT->CYCCNT - start;
+    for (uint32_t y = 0; y < LCD_HEIGHT; y++) {
+        uint32_t h = 2166136261U;
+        for (uint32_t x = 0; x < LCD_WIDTH; x++) h = (h ^ fb[y * LCD_WIDTH + x]) * 16777619U;
+        row_hash[y] = h;
+    }
+
+    /* 硬件解码 */
+    LCD_JPEG_SetBackend(LCD_JPEG_BACKEND_HW);
+    start = DWT->CYCCNT;
+    st[1] = LCD_JPEG_Decode(jpeg, size, fb, LCD_WIDTH);
+    cycles[2] = DWT->CYCCNT - start;
+    for (uint32_t y = 0; y < LCD_HEIGHT; y++) {
+        uint32_t h = 2166136261U;
+        for (uint32_t x = 0; x < LCD_WIDTH; x++) h = (h ^ fb[y * LCD_WIDTH + x]) * 16777619U;
+        if (h != row_hash[y]) rows_diff++;
+    }
+    LCD_SPI_DMA_DisableFrameBuffer(hlcd);
+
+    /* 显示：原始RGB565（上面解码的结果仍在帧缓冲中）与JPEG逐行带解码发送 */
+    start = DWT->CYCCNT;
+    LCD_DMA_DrawImage(hlcd, 0, 0, LCD_WIDTH, LCD_HEIGHT, fb);
+    cycles[3] = DWT->CYCCNT - start;
+
+    LCD_JPEG_ResetStats();
+    start = DWT->CYCCNT;
+    LCD_JPEG_Draw(hlcd, 0, 0, jpeg, size);
+    cycles[4] = DWT->CYCCNT - start;
+    LCD_JPEG_GetStats(&stats);
+
+    snprintf(log_buf, sizeof(log_buf),
+             "[JPEG] %lu bytes (raw %lu), sw %d hw %d, rows diff %lu, errors %lu\r\n",
+             size, (uint32_t)(LCD_FRAME_BUFFER_SIZE * sizeof(uint16_t)), st[0], st[1], rows_diff, stats.errors);
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+
+    snprintf(log_buf, sizeof(log_buf),
+             "[JPEG] us: raw load %lu, sw decode %lu, hw decode %lu, raw draw %lu, jpeg draw %lu\r\n",
+             cycles[0] / (SystemCoreClock / 1000000U), cycles[1] / (SystemCoreClock / 1000000U),
+             cycles[2] / (SystemCoreClock / 1000000U), cycles[3] / (SystemCoreClock / 1000000U),
+             cycles[4] / (SystemCoreClock / 1000000U));
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+}
+
+#if defined(APP_LCD_PLAYER_DEMO) && APP_LCD_PLAYER_DEMO
+/**
+ * @brief 动画播放测试：开机动画按片段帧率循环两遍，再不限帧率播放一遍，打印各阶段耗时
+ * @note  不限帧率时每帧时间接近SPI发送时间说明解码被DMA发送掩盖；
+ *        片段数据只在 APP_LCD_PLAYER_DEMO=ON 时链接
+ */
+void LCD_V2_Player_Test(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    static const struct { uint32_t frame_us; uint32_t loops; const char *name; } runs[2] = {
+        { 0, 2, "30fps" }, { 1, 1, "uncapped" },
+    };
+    LCD_Player_Stats_t s;
+    char log_buf[200];
+    uint32_t cyc_us = SystemCoreClock / 1000000U;
+
+    for (int r = 0; r < 2; r++) {
+        LCD_Player_ResetStats();
+        HAL_StatusTypeDef st = LCD_Player_Play(hlcd, 0, 0, Clip_Boot_240x240, Clip_Boot_240x240_size,
+                                               runs[r].frame_us, runs[r].loops);
+        LCD_Player_GetStats(&s);
+        if (s.frames == 0U) {
+            s.frames = 1U;
+        }
+
+        snprintf(log_buf, sizeof(log_buf),
+                 "[Player] %-8s st %d: %lu frames in %lu ms, late %lu, err %lu, %u buffers, %lu bytes read\r\n",
+                 runs[r].name, st, s.frames, s.elapsed_ms, s.late, s.errors, s.buffers, s.bytes);
+        HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+
+        snprintf(log_buf, sizeof(log_buf),
+                 "[Player] us/frame: decode %lu (max %lu), transfer %lu (max %lu), wait buf %lu, wait pace %lu, interval %lu..%lu\r\n",
+                 (uint32_t)(s.decode_cycles / s.frames / cyc_us), s.decode_cycles_max / cyc_us,
+                 (uint32_t)(s.transfer_cycles / s.frames / cyc_us), s.transfer_cycles_max / cyc_us,
+                 (uint32_t)(s.buffer_wait_cycles / s.frames / cyc_us), (uint32_t)(s.pace_wait_cycles / s.frames / cyc_us),
+                 s.interval_us_min, s.interval_us_max);
+        HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    }
+}
+#endif /* APP_LCD_PLAYER_DEMO */
+
+/**
+ * @brief 无损图片测试：从QSPI解码的速度，原始RGB565与QOI565逐行带解码发送的耗时和读取字节数
+ * @note  背景为整屏界面图，图标为4个83x83图标排成一行（相邻重叠）；
+ *        raw 一栏发送的是先解码到帧缓冲的同一图片，结果逐像素相同
+ */
+void LCD_V2_QOI_Test(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    static const uint8_t *const icons[4] = {
+        Image_Icon0_83x83_q565, Image_Icon1_83x83_q565, Image_Icon2_83x83_q565, Image_Icon3_83x83_q565,
+    };
+    const uint32_t *const icon_sizes[4] = {
+        &Image_Icon0_83x83_q565_size, &Image_Icon1_83x83_q565_size,
+        &Image_Icon2_83x83_q565_size, &Image_Icon3_83x83_q565_size,
+    };
+    uint32_t start, cycles[5], icon_bytes = 0, cyc_us = SystemCoreClock / 1000000U;
+    HAL_StatusTypeDef st;
+    LCD_QOI_Stats_t stats;
+    char log_buf[200];
+
+    if (LCD_SPI_DMA_EnableFrameBuffer(hlcd) != HAL_OK) {
+        HAL_UART_Transmit(&huart1, (uint8_t*)"[QOI] no frame buffer\r\n", 23, 100);
+        return;
+    }
+    uint16_t *fb = hlcd->frame_buffer;
+    LCD_SPI_DMA_DisableFrameBuffer(hlcd);
+
+    /* 只解码：背景到帧缓冲内存 */
+    LCD_QOI_ResetStats();
+    start = DWT->CYCCNT;
+    st = LCD_QOI_Decode(Image_UI_240x240_q565, Image_UI_240x240_q565_size, fb, LCD_WIDTH);
+    cycles[0] = DWT->CYCCNT - start;
+
+    /* 背景：原始RGB565与QOI565逐行带解码发送 */
+    start = DWT->CYCCNT;
+    LCD_DMA_DrawImage(hlcd, 0, 0, LCD_WIDTH, LCD_HEIGHT, fb);
+    cycles[1] = DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    LCD_QOI_Draw(hlcd, 0, 0, Image_UI_240x240_q565, Image_UI_240x240_q565_size);
+    cycles[2] = DWT->CYCCNT - start;
+
+    /* 图标：先解码到帧缓冲内存作为原始图片，再分别发送 */
+    cycles[3] = cycles[4] = 0;
+    for (uint32_t i = 0; i < 4; i++) {
+        uint16_t x = (uint16_t)(i * 52U), y = 150;
+        LCD_QOI_Decode(icons[i], *icon_sizes[i], fb, 83);
+        icon_bytes += *icon_sizes[i];
+
+        start = DWT->CYCCNT;
+        LCD_DMA_DrawImage(hlcd, x, y, 83, 83, fb);
+        cycles[3] += DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        LCD_QOI_Draw(hlcd, x, y, icons[i], *icon_sizes[i]);
+        cycles[4] += DWT->CYCCNT - start;
+    }
+    LCD_QOI_GetStats(&stats);
+
+    snprintf(log_buf, sizeof(log_buf),
+             "[QOI] bg %lu bytes (raw %lu), 4 icons %lu bytes (raw %lu), st %d, images %lu errors %lu\r\n",
+             Image_UI_240x240_q565_size, (uint32_t)(LCD_WIDTH * LCD_HEIGHT * 2U), icon_bytes, 4U * 83U * 83U * 2U, st, stats.images, stats.errors);
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+
+    snprintf(log_buf, sizeof(log_buf),
+             "[QOI] us: bg decode %lu (%lu MB/s), bg raw draw %lu, bg qoi draw %lu, icons raw draw %lu, icons qoi draw %lu\r\n",
+             cycles[0] / cyc_us, (uint32_t)(LCD_WIDTH * LCD_HEIGHT * 2U) / (cycles[0] / cyc_us + 1U),
+             cycles[1] / cyc_us, cycles[2] / cyc_us, cycles[3] / cyc_us, cycles[4] / cyc_us);
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+}
+
+/**
+ * @brief 图片零拷贝测试：QSPI中的图片由DMA直接读取与复制到DMA缓冲区发送的耗时对比
+ * @note  以固件所在的QSPI映射区代替图片（内容无意义，只比较耗时）；
+ *        wall 为调用开始到发送完成的时间，copy 为复制到DMA缓冲区的CPU时间，
+ *        零拷贝时这部分CPU时间留给其它任务。程序本身也在QSPI中执行，取指与DMA读取会竞争QSPI带宽
+ */
+void LCD_V2_ZeroCopy_Test(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    static const char *const names[2] = { "full", "icons" };
+    const uint16_t *qspi = (const uint16_t *)QSPI_BASE;
+    uint32_t cyc_us = SystemCoreClock / 1000000U;
+    char log_buf[200];
+
+    for (int k = 0; k < 2; k++) {
+        uint32_t wall[2], copy[2], direct[2];
+
+        for (int zc = 0; zc < 2; zc++) {
+            hlcd->image_zero_copy = (zc == 1);
+            hlcd->image_copy_cycles = 0;
+            hlcd->image_direct = 0;
+            uint32_t start = DWT->CYCCNT;
+            for (int round = 0; round < 10; round++) {
+                if (k == 0) {
+                    LCD_DMA_DrawImage(hlcd, 0, 0, LCD_WIDTH, LCD_HEIGHT, qspi);
+                } else {
+                    // 6个83x83图标，每个图标在QSPI中的起始地址按 LCD_DMA_DIRECT_ALIGN 对齐
+                    for (uint32_t i = 0; i < 6; i++) {
+                        LCD_DMA_DrawImage(hlcd, (uint16_t)((i % 3U) * 78U), (uint16_t)((i / 3U) * 120U + 20U),
+                                          83, 83, &qspi[i * 6896U]);
+                    }
+                }
+            }
+            wall[zc] = (DWT->CYCCNT - start) / 10U;
+            copy[zc] = hlcd->image_copy_cycles / 10U;
+            direct[zc] = hlcd->image_direct;
+        }
+        hlcd->image_zero_copy = true;
+
+        snprintf(log_buf, sizeof(log_buf),
+                 "[ZeroCopy] %-5s us: bounce wall %lu copy %lu, zero-copy wall %lu copy %lu (%lu direct)\r\n",
+                 names[k], wall[0] / cyc_us, copy[0] / cyc_us, wall[1] / cyc_us, copy[1] / cyc_us, direct[1]);
+        HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    }
+}
+
+/* 行带渲染测试场景：渐变背景、卡片、跨行带的进度条和半透明层，文字由显示列表合成 */
+typedef struct {
+    LCD_DisplayList_t dl;
+    uint32_t frame;
+} Strip_Scene_t;
+
+static void Strip_Draw(LCD_Strip_Canvas_t *c, void *ctx)
+{
+    Strip_Scene_t *s = (Strip_Scene_t *)ctx;
+    LCD_Raster_t r;
+    uint16_t bar = (uint16_t)(s->frame % 200U);
+
+    LCD_Strip_GradientRect(c, 0, 0, LCD_WIDTH_V2, LCD_HEIGHT_V2, 0x18C9, 0x4A9F);
+    LCD_Strip_FillRect(c, 0, 0, LCD_WIDTH_V2, 28, 0x2B7B);
+    for (int i = 0; i < 4; i++) {
+        LCD_Strip_FillRect(c, (int16_t)(10 + (i & 1) * 115), (int16_t)(40 + (i >> 1) * 100), 105, 90, 0xF7BE);
+    }
+    LCD_Strip_FillRect(c, 20, 150, 200, 14, 0x8410);
+    LCD_Strip_FillRect(c, 20, 150, bar, 14, 0x07E0);
+    LCD_Strip_BlendRect(c, 30, 60, 180, 150, 0x001F, 10);
+
+    LCD_Strip_Raster(c, &r);
+    LCD_Raster_Circle(&r, 120, 130, 95, 0xFFE0);
+    LCD_DL_RasterBand(&s->dl, c->buf, c->x0, c->y0, c->width, c->rows);
+}
+
+/**
+ * @brief 行带渲染测试：不启用帧缓冲，整屏界面每帧按3个80行行带合成并发送
+ * @note  打印帧率、最后一帧各行带的绘制/等待时间和缓冲区使用水位（两块缓冲区始终链接，共76.8KB；帧缓冲方案另需115KB）
+ */
+void LCD_V2_Strip_Test(void)
+{
+    static Strip_Scene_t scene;
+    LCD_SPI_DMA_V2_Handle_t hlcd_v2;
+    LCD_Strip_Stats_t stats;
+    uint32_t cyc_us = SystemCoreClock / 1000000U, start, frames = 100;
+    char text[32], log_buf[200];
+
+    LCD_V2_Init(&hlcd_v2, &hspi4, LCD_TRANSFER_DMA_ASYNC);
+    LCD_Strip_ResetStats();
+
+    start = DWT->CYCCNT;
+    for (scene.frame = 0; scene.frame < frames; scene.frame++) {
+        // 文字每帧变化：回调之外先记录好，回调中每个行带只合成
+        snprintf(text, sizeof(text), "Frame %lu", scene.frame);
+        LCD_DL_Begin(&scene.dl, false, 0);
+        LCD_DL_Text(&scene.dl, 8, 2, "Strip render", &ASCII_Font24, NULL, 0xFFFF, 0x2B7B);
+        LCD_DL_Text(&scene.dl, 30, 70, text, &ASCII_Font24, NULL, 0x0000, 0xF7BE);
+        LCD_Strip_Render(&hlcd_v2, 0, 0, LCD_WIDTH_V2, LCD_HEIGHT_V2, Strip_Draw, &scene);
+    }
+    uint32_t frame_us = (DWT->CYCCNT - start) / cyc_us / frames;
+    LCD_Strip_GetStats(&stats);
+    LCD_V2_DeInit(&hlcd_v2);
+
+    // 缓冲区水位由 LCD_V2_Init 填充的标记扫描得到；栈余量为本任务运行至今的最低值（FreeRTOS 栈水位）
+    snprintf(log_buf, sizeof(log_buf),
+             "[Strip] %lu frames, %lu us/frame, errors %lu, buffer high-water %lu of %lu linked bytes, "
+             "stack free min %lu bytes, frame buffer %s\r\n",
+             stats.frames, frame_us, stats.errors, stats.peak_ram, stats.linked_ram,
+             osThreadGetStackSpace(osThreadGetId()),
+             LCD_FRAME_BUFFER_STATIC ? "allocated (115200 bytes)" : "not allocated");
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    for (uint32_t b = 0; b < stats.bands; b++) {
+        snprintf(log_buf, sizeof(log_buf), "[Strip] band %lu y %u rows %u: draw %lu us, wait %lu us\r\n",
+                 b, stats.band[b].y, stats.band[b].rows,
+                 stats.band[b].draw_cycles / cyc_us, stats.band[b].wait_cycles / cyc_us);
+        HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    }
+    snprintf(log_buf, sizeof(log_buf), "[Strip] max draw %lu us, max wait %lu us\r\n",
+             stats.draw_cycles_max / cyc_us, stats.wait_cycles_max / cyc_us);
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+}
+
+/**
+ * @brief 页面翻转测试：每帧在后台页面整屏重画（DMA2D清屏+移动的矩形），分别统计绘制、等待和发送时间
+ * @note  与单帧缓冲（画完后 LCD_SPI_DMA_FlushFrameBuffer）的帧时间对比
+ */
+void LCD_V2_Flip_Test(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    LCD_Flip_Stats_t stats;
+    uint32_t cyc_us = SystemCoreClock / 1000000U, start, frames = 100;
+    uint32_t flip_us, single_us;
+    char log_buf[200];
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    LCD_Blit_Init();
+
+    LCD_Flip_ResetStats();
+    if (LCD_Flip_Begin(hlcd) != HAL_OK) {
+        HAL_UART_Transmit(&huart1, (uint8_t*)"[Flip] begin failed\r\n", 21, 100);
+        return;
+    }
+    start = DWT->CYCCNT;
+    for (uint32_t n = 0; n < frames; n++) {
+        LCD_FB_Clear(hlcd, (n & 1U) ? 0x001F : 0x0010);
+        LCD_FB_FillRect(hlcd, (uint16_t)(n * 2U % (LCD_WIDTH - 60U)), 90, 60, 60, 0xFFE0);
+        LCD_Flip_Swap(hlcd);
+    }
+    flip_us = (DWT->CYCCNT - start) / cyc_us / frames;
+    LCD_Flip_End(hlcd);
+    LCD_Flip_GetStats(&stats);
+
+    if (LCD_SPI_DMA_EnableFrameBuffer(hlcd) != HAL_OK) {
+        HAL_UART_Transmit(&huart1, (uint8_t*)"[Flip] no frame buffer\r\n", 24, 100);
+        return;
+    }
+    start = DWT->CYCCNT;
+    for (uint32_t n = 0; n < frames; n++) {
+        LCD_FB_Clear(hlcd, (n & 1U) ? 0x001F : 0x0010);
+        LCD_FB_FillRect(hlcd, (uint16_t)(n * 2U % (LCD_WIDTH - 60U)), 90, 60, 60, 0xFFE0);
+        LCD_Blit_Wait(LCD_BLIT_TIMEOUT_MS);
+        LCD_SPI_DMA_FlushFrameBuffer(hlcd);
+    }
+    single_us = (DWT->CYCCNT - start) / cyc_us / frames;
+    LCD_SPI_DMA_DisableFrameBuffer(hlcd);
+
+    snprintf(log_buf, sizeof(log_buf), "[Flip] %lu frames, errors %lu, blocked %lu: flip %lu us/frame, single buffer %lu us/frame\r\n",
+             stats.frames, stats.errors, stats.blocked, flip_us, single_us);
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    snprintf(log_buf, sizeof(log_buf), "[Flip] draw avg %lu max %lu us, wait avg %lu max %lu us, transfer avg %lu max %lu us\r\n",
+             (uint32_t)(stats.draw_cycles_total / stats.frames / cyc_us), stats.draw_cycles_max / cyc_us,
+             (uint32_t)(stats.wait_cycles_total / stats.frames / cyc_us), stats.wait_cycles_max / cyc_us,
+             (uint32_t)(stats.transfer_cycles_total / stats.frames / cyc_us), stats.transfer_cycles_max / cyc_us);
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+}
+
+/* ==================== 热点代码放置 ==================== */
+
+#define HOT_TEST_W          120U
+#define HOT_TEST_H          32U
+#define HOT_TEST_RUNS       8U          // 每项取最小值：去掉缓存冷启动和中断的干扰
+#define HOT_TEST_SWITCHES   1000U
+#define HOT_PING_FLAG       0x01U
+#define HOT_STOP_FLAG       0x02U
+
+enum {
+    HOT_FILL_DTCM = 0,
+    HOT_FILL_AXI,
+    HOT_BLEND,
+    HOT_EXPAND_ROW,
+    HOT_GLYPH,
+    HOT_CTX_SWITCH,
+    HOT_ISR_SPI4,
+    HOT_ISR_DMA,
+    HOT_ITEM_COUNT
+};
+
+static const char *const hot_item_names[HOT_ITEM_COUNT] = {
+    "SW fill 120x32 DTCM", "SW fill 120x32 AXI", "SW blend 120x32 ARGB", "ExpandRow 4bpp 240px",
+    "Glyph expand 32x32", "Context switch", "SPI4 IRQ (avg)", "DMA1_S1 IRQ (avg)",
+};
+
+static osThreadId_t hot_main_thread;
+
+/* 线程标志乒乓：每轮两次任务切换 */
+static void Hot_PingTask(void *argument)
+{
+    (void)argument;
+    for (;;) {
+        uint32_t flags = osThreadFlagsWait(HOT_PING_FLAG | HOT_STOP_FLAG, osFlagsWaitAny, osWaitForever);
+        if ((flags & osFlagsError) != 0U || (flags & HOT_STOP_FLAG) != 0U) {
+            break;
+        }
+        osThreadFlagsSet(hot_main_thread, HOT_PING_FLAG);
+    }
+    osThreadExit();
+}
+
+static uint32_t Hot_ContextSwitch(void)
+{
+    const osThreadAttr_t attr = {
+        .name = "hot_ping",
+        .stack_size = 128 * 4,
+        .priority = osThreadGetPriority(osThreadGetId()),
+    };
+    osThreadId_t peer;
+    uint32_t start, cycles;
+
+    hot_main_thread = osThreadGetId();
+    peer = osThreadNew(Hot_PingTask, NULL, &attr);
+    if (peer == NULL) {
+        return 0;
+    }
+    start = DWT->CYCCNT;
+    for (uint32_t i = 0; i < HOT_TEST_SWITCHES; i++) {
+        osThreadFlagsSet(peer, HOT_PING_FLAG);
+        osThreadFlagsWait(HOT_PING_FLAG, osFlagsWaitAny, osWaitForever);
+    }
+    cycles = (DWT->CYCCNT - start) / (HOT_TEST_SWITCHES * 2U);
+    osThreadFlagsSet(peer, HOT_STOP_FLAG);
+    osDelay(2);
+    return cycles;
+}
+
+/* 按当前缓存设置测一遍全部项目 */
+static void Hot_Measure(LCD_SPI_DMA_Handle_t *hlcd, uint16_t *dtcm, uint16_t *axi, const uint32_t *argb,
+                        uint32_t result[HOT_ITEM_COUNT])
+{
+    static uint8_t row_4bpp[LCD_WIDTH / 2];
+    static uint8_t glyph_1bpp[32 * 4];
+    uint16_t palette[16];
+    uint32_t start, cycles;
+
+    for (uint32_t i = 0; i < sizeof(row_4bpp); i++) {
+        row_4bpp[i] = (uint8_t)(i * 37U);
+    }
+    for (uint32_t i = 0; i < sizeof(glyph_1bpp); i++) {
+        glyph_1bpp[i] = (uint8_t)(i * 73U + 5U);
+    }
+    LCD_Blend_Palette(palette, 4, 0xFFFF, 0x0000);
+
+    for (uint32_t k = 0; k < HOT_ITEM_COUNT; k++) {
+        result[k] = UINT32_MAX;
+    }
+    for (uint32_t run = 0; run < HOT_TEST_RUNS; run++) {
+        uint32_t c[HOT_CTX_SWITCH];
+
+        start = DWT->CYCCNT;
+        LCD_Blit_Fill(dtcm, HOT_TEST_W, HOT_TEST_W, HOT_TEST_H, (uint16_t)(0x1234U + run));
+        c[HOT_FILL_DTCM] = DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        LCD_Blit_Fill(axi, HOT_TEST_W, HOT_TEST_W, HOT_TEST_H, (uint16_t)(0x4321U + run));
+        c[HOT_FILL_AXI] = DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        LCD_Blit_Blend(dtcm, HOT_TEST_W, argb, HOT_TEST_W, LCD_BLIT_ARGB8888, 200, HOT_TEST_W, HOT_TEST_H);
+        c[HOT_BLEND] = DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        LCD_Blend_ExpandRow(axi, row_4bpp, LCD_WIDTH, 4, palette);
+        c[HOT_EXPAND_ROW] = DWT->CYCCNT - start;
+
+        start = DWT->CYCCNT;
+        LCD_GlyphCache_Expand(dtcm, glyph_1bpp, 32, 32, 0xFFFF, 0x0000);
+        c[HOT_GLYPH] = DWT->CYCCNT - start;
+
+        for (uint32_t k = 0; k < HOT_CTX_SWITCH; k++) {
+            if (c[k] < result[k]) {
+                result[k] = c[k];
+            }
+        }
+    }
+    result[HOT_CTX_SWITCH] = Hot_ContextSwitch();
+
+    /* 中断处理时间：发送若干次小窗口，由 stm32h7xx_it.c 的 ISR_MEASURE 统计 */
+    result[HOT_ISR_SPI4] = 0;
+    result[HOT_ISR_DMA] = 0;
+#ifdef ISR_EVENT_MEASURE
+    ISR_Event_Stats_t isr;
+
+    ISR_Event_ResetStats();
+    for (uint32_t run = 0; run < HOT_TEST_RUNS; run++) {
+        LCD_SPI_DMA_SetWindow(hlcd, 0, 0, HOT_TEST_W, HOT_TEST_H);
+        LCD_SPI_DMA_WriteBuffer(hlcd, axi, HOT_TEST_W * HOT_TEST_H);
+    }
+    osDelay(10);        // 等事件任务汇总
+    ISR_Event_GetStats(&isr);
+    cycles = isr.source[ISR_SRC_SPI4_IRQ].isr_count;
+    result[HOT_ISR_SPI4] = (cycles != 0U) ? (uint32_t)(isr.source[ISR_SRC_SPI4_IRQ].isr_cycles_total / cycles) : 0U;
+    cycles = isr.source[ISR_SRC_DMA1_S1].isr_count;
+    result[HOT_ISR_DMA] = (cycles != 0U) ? (uint32_t)(isr.source[ISR_SRC_DMA1_S1].isr_cycles_total / cycles) : 0U;
+#else
+    (void)hlcd;
+    (void)cycles;
+#endif
+}
+
+/**
+ * @brief 热点代码放置测试：分别在缓存关闭、I+D缓存开启时测量各热点函数的周期数
+ * @note  放置方式由编译选项决定（APP_ITCM_HOT=ON 为ITCM，OFF 为QSPI就地执行），两次编译各运行一次，
+ *        得到 XIP / XIP+cache / ITCM / ITCM+cache 四组结果；中断处理时间需要 APP_ISR_MEASURE=ON。
+ *        测试结束后恢复原来的缓存设置和位块传输后端
+ */
+void LCD_V2_Hot_Test(LCD_SPI_DMA_Handle_t *hlcd)
+{
+    uint32_t result[2][HOT_ITEM_COUNT];
+    uint32_t ccr = 0;
+    uint16_t *dtcm, *axi;
+    uint32_t *argb;
+    LCD_Blit_Backend_t backend;
+    char log_buf[160];
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    LCD_Blit_Init();
+
+    dtcm = (uint16_t *)Mem_Alloc(MEM_CLASS_FAST, HOT_TEST_W * HOT_TEST_H * sizeof(uint16_t));
+    axi = (uint16_t *)Mem_AllocFrom(MEM_POOL_AXI, HOT_TEST_W * HOT_TEST_H * sizeof(uint16_t), MEM_CACHE_LINE);
+    argb = (uint32_t *)Mem_AllocFrom(MEM_POOL_AXI, HOT_TEST_W * HOT_TEST_H * sizeof(uint32_t), MEM_CACHE_LINE);
+    if (dtcm == NULL || Mem_PoolOf(dtcm) != MEM_POOL_DTCM || axi == NULL || argb == NULL) {
+        HAL_UART_Transmit(&huart1, (uint8_t*)"[Hot] buffer alloc failed\r\n", 27, 100);
+        Mem_Free(dtcm);
+        Mem_Free(axi);
+        Mem_Free(argb);
+        return;
+    }
+    for (uint32_t i = 0; i < HOT_TEST_W * HOT_TEST_H; i++) {
+        argb[i] = ((i * 7U) << 24) | (i * 2654435761U >> 8);
+    }
+
+    // 软件后端才执行CPU上的像素循环
+    backend = LCD_Blit_GetBackend();
+    LCD_Blit_SetBackend(LCD_BLIT_BACKEND_SW);
+#if defined(SCB_CCR_DC_Msk)
+    ccr = SCB->CCR;
+#endif
+
+    Mem_Cache_Config(false, false);
+    Hot_Measure(hlcd, dtcm, axi, argb, result[0]);
+    Mem_Cache_Config(true, true);
+    Hot_Measure(hlcd, dtcm, axi, argb, result[1]);
+
+#if defined(SCB_CCR_DC_Msk)
+    Mem_Cache_Config((ccr & SCB_CCR_IC_Msk) != 0U, (ccr & SCB_CCR_DC_Msk) != 0U);
+#endif
+    LCD_Blit_SetBackend(backend);
+
+    snprintf(log_buf, sizeof(log_buf), "[Hot] placement %s (LCD_Blend_ExpandRow @0x%08lx), cycles, min of %u runs\r\n",
+             APP_ITCM_HOT ? "ITCM" : "XIP", (uint32_t)(uintptr_t)LCD_Blend_ExpandRow, HOT_TEST_RUNS);
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    snprintf(log_buf, sizeof(log_buf), "[Hot] %-22s %10s %10s\r\n", "", "no cache", "I+D cache");
+    HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    for (uint32_t k = 0; k < HOT_ITEM_COUNT; k++) {
+        snprintf(log_buf, sizeof(log_buf), "[Hot] %-22s %10lu %10lu\r\n", hot_item_names[k], result[0][k], result[1][k]);
+        HAL_UART_Transmit(&huart1, (uint8_t*)log_buf, strlen(log_buf), 100);
+    }
+#ifndef ISR_EVENT_MEASURE
+    HAL_UART_Transmit(&huart1, (uint8_t*)"[Hot] IRQ times need APP_ISR_MEASURE=ON\r\n", 41, 100);
+#endif
+
+    Mem_Free(dtcm);
+    Mem_Free(axi);
+    Mem_Free(argb);
+}
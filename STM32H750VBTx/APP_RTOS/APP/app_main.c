@@ -9,6 +9,12 @@
 #include "spi.h"
 #include "lcd_spi_154.h"
 #include "lcd_spi_dma.h"
+#include "uart_dma.h"
+#include "isr_event.h"
+#include "mem_region.h"
+#include "lcd_blit.h"
+#include "lcd_jpeg.h"
+#include "app_lcd_benchmark.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -32,11 +38,31 @@ const osThreadAttr_t task_lcd_attributes = {
     .priority = (osPriority_t) osPriorityNormal,
 };
 
+#if defined(APP_LCD_BENCHMARK) && APP_LCD_BENCHMARK
+static void Bench_Print(const char *line)
+{
+    UART_DMA_Transmit(line, (uint16_t)strlen(line), 100);
+}
+#endif
+
 /**
  * @brief Initialize application tasks
  */
 void app_main_init(void)
 {
+    /* 分区内存池与SRAM的MPU属性（D2/D3不可缓存），须在其它模块分配内存、开启D-Cache之前 */
+    Mem_Init();
+#if defined(APP_CACHE_ENABLE) && APP_CACHE_ENABLE
+    /* MPU属性就绪后开启缓存；发送给DMA的数据由 Mem_Cache_Clean 写回（lcd_spi_xfer.c、lcd_blit.c） */
+    Mem_Cache_Config(true, true);
+#endif
+
+    /* 中断事件任务：DMA完成/错误等中断事件在任务上下文中汇总 */
+    ISR_Event_Start();
+
+    /* 日志经USART1 DMA发送，发送期间调用的任务阻塞在完成中断上；须在各任务使用串口之前 */
+    UART_DMA_Init(&huart1);
+
     /* Create LOG thread */
     task_log_handle = osThreadNew(task_log_entry, NULL, &task_log_attributes);
 
@@ -99,7 +125,17 @@ void task_log_entry(void *argument)
             snprintf(msg_buffer, sizeof(msg_buffer),
                      "[LOG] Breath Cycle: %lu, FreeRTOS running from QSPI XIP\r\n",
                      tick_count);
-            HAL_UART_Transmit(&huart1, (uint8_t*)msg_buffer, strlen(msg_buffer), HAL_MAX_DELAY);
+            UART_DMA_Transmit(msg_buffer, strlen(msg_buffer), 100);
+
+            /* 中断事件统计（中断里不再打印） */
+            ISR_Event_Stats_t isr_stats;
+            ISR_Event_GetStats(&isr_stats);
+            snprintf(msg_buffer, sizeof(msg_buffer),
+                     "[ISR] SPI4 ok %lu err %lu/0x%lX drop %lu irq max %lu cyc\r\n",
+                     isr_stats.source[ISR_SRC_SPI4_TX].done, isr_stats.source[ISR_SRC_SPI4_TX].errors,
+                     isr_stats.source[ISR_SRC_SPI4_TX].last_error, isr_stats.dropped,
+                     isr_stats.source[ISR_SRC_SPI4_IRQ].isr_cycles_max);
+            UART_DMA_Transmit(msg_buffer, strlen(msg_buffer), 100);
         }
     }
 }
@@ -152,6 +188,12 @@ void task_lcd_entry(void *argument)
     LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
     HAL_UART_Transmit(&huart1, (uint8_t*)"[LCD] DMA Init OK\r\n", 19, 100);
 
+    /* 帧缓冲绘制使用DMA2D（失败时保持软件实现） */
+    LCD_Blit_Init();
+
+    /* JPEG图片使用硬件JPEG解码（失败时保持软件解码器） */
+    LCD_JPEG_Init();
+
     /* 打印DMA缓冲区地址，验证是否在D2 SRAM */
     char addr_msg[128];
     snprintf(addr_msg, sizeof(addr_msg),
@@ -162,10 +204,44 @@ void task_lcd_entry(void *argument)
               (uint32_t)hlcd_dma.dma_buffer[0] < 0x40000000) ? "DISABLED" : "ENABLED");
     HAL_UART_Transmit(&huart1, (uint8_t*)addr_msg, strlen(addr_msg), 100);
 
+#if defined(APP_LCD_BENCHMARK) && APP_LCD_BENCHMARK
+    /* 基准测试固件（CMake预设 Bench）：各场景固定帧数运行一次，结果按 "BENCH " 行输出后停在这里 */
+    LCD_Benchmark_RunFixed(&hlcd_dma, LCD_BENCH_FRAMES, Bench_Print);
+    for (;;) {
+        osDelay(1000);
+    }
+#endif
+
     /* 跳过性能测试，直接显示内容 */
     // extern void LCD_V2_Performance_Test(LCD_SPI_DMA_Handle_t *hlcd);
     // HAL_UART_Transmit(&huart1, (uint8_t*)"[LCD] Starting Performance Test...\r\n", 37, 100);
     // LCD_V2_Performance_Test(&hlcd_dma);
+    // extern void LCD_V2_Text_Cache_Test(void);
+    // LCD_V2_Text_Cache_Test();
+    // extern void LCD_V2_Text_AA_Test(void);
+    // LCD_V2_Text_AA_Test();
+    // extern void LCD_V2_Xfer_Test(void);
+    // LCD_V2_Xfer_Test();
+    // extern void LCD_V2_Job_Test(void);
+    // LCD_V2_Job_Test();
+    // extern void LCD_V2_Server_Test(LCD_SPI_DMA_Handle_t *hlcd);
+    // LCD_V2_Server_Test(&hlcd_dma);
+    // extern void LCD_V2_Blit_Test(LCD_SPI_DMA_Handle_t *hlcd);
+    // LCD_V2_Blit_Test(&hlcd_dma);
+    // extern void LCD_V2_JPEG_Test(LCD_SPI_DMA_Handle_t *hlcd);
+    // LCD_V2_JPEG_Test(&hlcd_dma);
+    // extern void LCD_V2_Player_Test(LCD_SPI_DMA_Handle_t *hlcd);     // 需 APP_LCD_PLAYER_DEMO=ON
+    // LCD_V2_Player_Test(&hlcd_dma);
+    // extern void LCD_V2_QOI_Test(LCD_SPI_DMA_Handle_t *hlcd);
+    // LCD_V2_QOI_Test(&hlcd_dma);
+    // extern void LCD_V2_ZeroCopy_Test(LCD_SPI_DMA_Handle_t *hlcd);
+    // LCD_V2_ZeroCopy_Test(&hlcd_dma);
+    // extern void LCD_V2_Strip_Test(void);
+    // LCD_V2_Strip_Test();
+    // extern void LCD_V2_Flip_Test(LCD_SPI_DMA_Handle_t *hlcd);
+    // LCD_V2_Flip_Test(&hlcd_dma);
+    // extern void LCD_V2_Hot_Test(LCD_SPI_DMA_Handle_t *hlcd);
+    // LCD_V2_Hot_Test(&hlcd_dma);
 
     /* 直接使用DMA模式填充红色 - 快速验证LCD和DMA */
     HAL_UART_Transmit(&huart1, (uint8_t*)"[LCD] Filling RED with DMA...\r\n", 31, 100);
@@ -199,6 +275,10 @@ void task_lcd_entry(void *argument)
     // LCD_SPI_DMA_EnableFrameBuffer(&hlcd_dma);
     // LCD_FB_Clear(&hlcd_dma, 0x0000);
 
+    /* 方案3: 显示服务任务（lcd_display_server.h），启动后由服务任务独占SPI4，
+       其他任务和中断通过 LCD_Server_xxx 提交命令，下面的主循环需改为只提交命令 */
+    // LCD_Server_Start(&hlcd_dma);
+
     last_tick = HAL_GetTick();
 
     HAL_UART_Transmit(&huart1, (uint8_t*)"[LCD] Entering main loop...\r\n", 29, 100);
@@ -0,0 +1,150 @@
+/**
+ ******************************************************************************
+ * @file    dma_sync.c
+ * @brief   DMA完成同步对象 - 线程标志唤醒、超时与错误原因
+ ******************************************************************************
+ */
+
+#include "dma_sync.h"
+#include "mem_region.h"
+#include <string.h>
+
+void DMA_Sync_Init(DMA_Sync_t *sync)
+{
+    memset(sync, 0, sizeof(*sync));
+    sync->reported = true;
+
+    /* 唤醒延迟统计使用DWT周期计数器 */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+void DMA_Sync_Arm(DMA_Sync_t *sync)
+{
+    __disable_irq();
+    sync->error = 0;
+    sync->reported = false;
+    sync->busy = true;
+    __enable_irq();
+}
+
+void DMA_Sync_Cancel(DMA_Sync_t *sync)
+{
+    __disable_irq();
+    sync->busy = false;
+    sync->reported = true;
+    __enable_irq();
+}
+
+/**
+ * @brief 结束本次传输并唤醒等待任务（中断上下文）
+ */
+MEM_ITCM_CODE static void DMA_Sync_Signal(DMA_Sync_t *sync, uint32_t error)
+{
+    osThreadId_t waiter;
+
+    if (!sync->busy) {
+        return;     // 已超时复位，迟到的中断
+    }
+    sync->error = error;
+    sync->transfers++;
+    sync->signal_cycles = DWT->CYCCNT;
+    sync->busy = false;
+
+    waiter = sync->waiter;
+    if (waiter != NULL) {
+        osThreadFlagsSet(waiter, DMA_SYNC_FLAG);
+    }
+}
+
+MEM_ITCM_CODE void DMA_Sync_Complete(DMA_Sync_t *sync)
+{
+    DMA_Sync_Signal(sync, 0);
+}
+
+void DMA_Sync_Fail(DMA_Sync_t *sync, uint32_t error_code)
+{
+    if (sync->busy) {
+        sync->errors++;
+    }
+    DMA_Sync_Signal(sync, (error_code != 0U) ? error_code : DMA_SYNC_ERR_UNKNOWN);
+}
+
+HAL_StatusTypeDef DMA_Sync_Wait(DMA_Sync_t *sync, uint32_t timeout_ms)
+{
+    uint32_t start = HAL_GetTick();
+    bool blocking = (osKernelGetState() == osKernelRunning);
+    HAL_StatusTypeDef status;
+
+    while (sync->busy) {
+        uint32_t elapsed = HAL_GetTick() - start;
+
+        if (elapsed >= timeout_ms) {
+            __disable_irq();
+            if (sync->busy) {
+                sync->busy = false;
+                sync->reported = true;
+                sync->error = DMA_SYNC_ERR_TIMEOUT;
+                sync->timeouts++;
+                __enable_irq();
+                return HAL_TIMEOUT;
+            }
+            __enable_irq();
+            break;
+        }
+        if (!blocking) {
+            continue;       // 调度器未启动：忙等
+        }
+
+        /* 先清掉上次残留的标志，再在关中断状态下登记等待者，
+           此后到来的完成中断一定能看到 waiter */
+        osThreadFlagsClear(DMA_SYNC_FLAG);
+        __disable_irq();
+        if (!sync->busy) {
+            __enable_irq();
+            break;
+        }
+        sync->waiter = osThreadGetId();
+        __enable_irq();
+
+        uint32_t flags = osThreadFlagsWait(DMA_SYNC_FLAG, osFlagsWaitAny, timeout_ms - elapsed);
+        sync->waiter = NULL;
+
+        if ((flags & osFlagsError) == 0U && !sync->busy) {
+            uint32_t cycles = DWT->CYCCNT - sync->signal_cycles;
+            sync->wakeups++;
+            sync->wake_cycles_total += cycles;
+            if (cycles > sync->wake_cycles_max) {
+                sync->wake_cycles_max = cycles;
+            }
+        }
+    }
+
+    __disable_irq();
+    status = (sync->reported || sync->error == 0U) ? HAL_OK : HAL_ERROR;
+    sync->reported = true;
+    __enable_irq();
+    return status;
+}
+
+bool DMA_Sync_IsBusy(const DMA_Sync_t *sync)
+{
+    return sync->busy;
+}
+
+uint32_t DMA_Sync_GetError(const DMA_Sync_t *sync)
+{
+    return sync->error;
+}
+
+void DMA_Sync_ResetStats(DMA_Sync_t *sync)
+{
+    __disable_irq();
+    sync->transfers = 0;
+    sync->errors = 0;
+    sync->timeouts = 0;
+    sync->wakeups = 0;
+    sync->wake_cycles_max = 0;
+    sync->wake_cycles_total = 0;
+    __enable_irq();
+}
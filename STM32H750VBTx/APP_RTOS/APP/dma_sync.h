@@ -0,0 +1,73 @@
+/**
+ ******************************************************************************
+ * @file    dma_sync.h
+ * @brief   DMA完成同步对象 - 由完成/错误中断唤醒等待任务，替代 osDelay(1) 轮询
+ ******************************************************************************
+ * @note
+ *   - 用法：启动DMA前 DMA_Sync_Arm，完成回调中 DMA_Sync_Complete，
+ *     错误回调中 DMA_Sync_Fail，任务中 DMA_Sync_Wait
+ *   - 等待任务阻塞在线程标志上（CMSIS-RTOS2 对 FreeRTOS 任务通知的封装），
+ *     中断置标志后直接切换到等待任务，延迟是一次中断退出加任务切换，与tick无关
+ *   - 调度器未启动时退化为忙等；不能在中断中等待
+ *   - 每个对象同一时刻只允许一个任务等待；每次传输的结果只由 Wait 返回一次
+ *   - 目前的使用者：lcd_spi_dma.c（SPI4 TX）、uart_dma.c（USART1 TX）
+ ******************************************************************************
+ */
+
+#ifndef __DMA_SYNC_H
+#define __DMA_SYNC_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "cmsis_os2.h"
+
+#define DMA_SYNC_FLAG            0x00010000U    // 线程标志位，避开应用自用的低位
+#define DMA_SYNC_ERR_TIMEOUT     0x80000000U    // 错误原因：等待超时（外设 ErrorCode 不使用此位）
+#define DMA_SYNC_ERR_UNKNOWN     0x40000000U    // 错误原因：错误回调中外设 ErrorCode 为0
+
+/* DMA完成同步对象 */
+typedef struct {
+    volatile bool busy;                 // 传输进行中
+    volatile bool reported;             // 本次结果已由 Wait 返回
+    volatile uint32_t error;            // 本次传输的错误原因，0为成功
+    osThreadId_t volatile waiter;       // 阻塞等待中的任务
+    volatile uint32_t signal_cycles;    // 中断置位时的 DWT->CYCCNT
+
+    /* 统计 */
+    uint32_t transfers;                 // 完成的传输数（含失败）
+    uint32_t errors;                    // 错误回调次数
+    uint32_t timeouts;                  // 等待超时次数
+    uint32_t wakeups;                   // 被中断唤醒的次数
+    uint32_t wake_cycles_max;           // 中断到等待任务恢复运行的最大周期数
+    uint64_t wake_cycles_total;
+} DMA_Sync_t;
+
+void DMA_Sync_Init(DMA_Sync_t *sync);
+
+/**
+ * @brief 标记传输开始（启动DMA之前调用）
+ */
+void DMA_Sync_Arm(DMA_Sync_t *sync);
+
+/**
+ * @brief DMA未能启动时撤销 Arm，不计入统计
+ */
+void DMA_Sync_Cancel(DMA_Sync_t *sync);
+
+/* 完成/错误回调中调用（中断上下文），对象空闲时忽略 */
+void DMA_Sync_Complete(DMA_Sync_t *sync);
+void DMA_Sync_Fail(DMA_Sync_t *sync, uint32_t error_code);
+
+/**
+ * @brief 等待传输结束
+ * @retval HAL_OK 成功或没有未报告的传输；HAL_ERROR 错误回调（原因见 DMA_Sync_GetError）；
+ *         HAL_TIMEOUT 超时，对象已复位为空闲，由调用者停止外设
+ */
+HAL_StatusTypeDef DMA_Sync_Wait(DMA_Sync_t *sync, uint32_t timeout_ms);
+
+bool     DMA_Sync_IsBusy(const DMA_Sync_t *sync);
+uint32_t DMA_Sync_GetError(const DMA_Sync_t *sync);
+void     DMA_Sync_ResetStats(DMA_Sync_t *sync);
+
+#endif /* __DMA_SYNC_H */
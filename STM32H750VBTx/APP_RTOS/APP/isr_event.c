@@ -0,0 +1,175 @@
+/**
+ ******************************************************************************
+ * @file    isr_event.c
+ * @brief   中断事件环 - 无锁SPSC队列与事件任务
+ ******************************************************************************
+ */
+
+#include "isr_event.h"
+#include "mem_region.h"
+#include "cmsis_os2.h"
+#include <string.h>
+
+static const osThreadAttr_t isr_event_task_attributes = {
+    .name = "IsrEvtTask",
+    .stack_size = 512 * 4,
+    .priority = (osPriority_t) osPriorityBelowNormal,
+};
+
+static ISR_EventRing_t isr_ring;
+static osThreadId_t isr_worker;
+static ISR_Event_Hook_t isr_hook;
+static ISR_Event_Stats_t isr_stats;
+
+/* ==================== 环形队列 ==================== */
+
+void ISR_EventRing_Init(ISR_EventRing_t *ring)
+{
+    memset(ring, 0, sizeof(*ring));
+}
+
+MEM_ITCM_CODE bool ISR_EventRing_Push(ISR_EventRing_t *ring, const ISR_Event_t *evt)
+{
+    uint32_t head = ring->head;
+
+    if (head - ring->tail >= ISR_EVENT_RING_SIZE) {
+        ring->dropped++;
+        return false;
+    }
+    ring->buf[head & (ISR_EVENT_RING_SIZE - 1U)] = *evt;
+    __DMB();                    // 记录写完后再发布 head
+    ring->head = head + 1U;
+    return true;
+}
+
+bool ISR_EventRing_Pop(ISR_EventRing_t *ring, ISR_Event_t *evt)
+{
+    uint32_t tail = ring->tail;
+
+    if (ring->head == tail) {
+        return false;
+    }
+    __DMB();                    // 先看到 head 再读记录
+    *evt = ring->buf[tail & (ISR_EVENT_RING_SIZE - 1U)];
+    __DMB();                    // 记录读完后再释放槽位
+    ring->tail = tail + 1U;
+    return true;
+}
+
+uint32_t ISR_EventRing_Count(const ISR_EventRing_t *ring)
+{
+    return ring->head - ring->tail;
+}
+
+/* ==================== 事件任务 ==================== */
+
+static void ISR_Event_Account(const ISR_Event_t *evt)
+{
+    ISR_Event_SourceStats_t *s;
+
+    if (evt->source >= ISR_SRC_COUNT) {
+        return;
+    }
+    s = &isr_stats.source[evt->source];
+
+    __disable_irq();
+    switch (evt->type) {
+    case ISR_EVT_DMA_DONE:
+        s->done++;
+        break;
+    case ISR_EVT_DMA_ERROR:
+        s->errors++;
+        s->last_error = evt->arg;
+        break;
+    case ISR_EVT_ISR_TIME:
+        s->isr_count++;
+        s->isr_cycles_total += evt->arg;
+        if (evt->arg > s->isr_cycles_max) {
+            s->isr_cycles_max = evt->arg;
+        }
+        break;
+    default:
+        break;
+    }
+    isr_stats.drained++;
+    __enable_irq();
+}
+
+static void ISR_Event_Task(void *argument)
+{
+    ISR_Event_t evt;
+    (void)argument;
+
+    for (;;) {
+        /* 先取到队列为空再等待：中断只在队列由空变非空时置标志，
+           任务启动前已进入队列的事件也在这里取走 */
+        while (ISR_EventRing_Pop(&isr_ring, &evt)) {
+            ISR_Event_Account(&evt);
+            if (isr_hook != NULL) {
+                isr_hook(&evt);
+            }
+        }
+
+        osThreadFlagsWait(ISR_EVENT_FLAG, osFlagsWaitAny, osWaitForever);
+    }
+}
+
+/* ==================== 接口函数 ==================== */
+
+HAL_StatusTypeDef ISR_Event_Start(void)
+{
+    if (isr_worker != NULL) {
+        return HAL_OK;
+    }
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    isr_worker = osThreadNew(ISR_Event_Task, NULL, &isr_event_task_attributes);
+    return (isr_worker != NULL) ? HAL_OK : HAL_ERROR;
+}
+
+MEM_ITCM_CODE void ISR_Event_Post(ISR_Event_Type_t type, ISR_Event_Source_t source, uint32_t arg)
+{
+    ISR_Event_t evt;
+    bool was_empty = (ISR_EventRing_Count(&isr_ring) == 0U);
+
+    evt.type = (uint8_t)type;
+    evt.source = (uint8_t)source;
+    evt.reserved = 0;
+    evt.arg = arg;
+    evt.cycles = DWT->CYCCNT;
+
+    if (ISR_EventRing_Push(&isr_ring, &evt) && was_empty && isr_worker != NULL) {
+        osThreadFlagsSet(isr_worker, ISR_EVENT_FLAG);
+    }
+}
+
+void ISR_Event_PostFromTask(ISR_Event_Type_t type, ISR_Event_Source_t source, uint32_t arg)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    ISR_Event_Post(type, source, arg);
+    __set_PRIMASK(primask);
+}
+
+void ISR_Event_SetHook(ISR_Event_Hook_t hook)
+{
+    isr_hook = hook;
+}
+
+void ISR_Event_GetStats(ISR_Event_Stats_t *stats)
+{
+    __disable_irq();
+    *stats = isr_stats;
+    stats->dropped = isr_ring.dropped;
+    __enable_irq();
+}
+
+void ISR_Event_ResetStats(void)
+{
+    __disable_irq();
+    memset(&isr_stats, 0, sizeof(isr_stats));
+    isr_ring.dropped = 0;
+    __enable_irq();
+}
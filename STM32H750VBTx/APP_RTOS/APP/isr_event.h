@@ -0,0 +1,125 @@
+/**
+ ******************************************************************************
+ * @file    isr_event.h
+ * @brief   中断事件环 - 中断只写入定长记录，由事件任务在任务上下文中处理
+ ******************************************************************************
+ * @note
+ *   - 单生产者/单消费者无锁环形队列：生产者只写 head，消费者只写 tail，
+ *     写入记录后用 __DMB 保证记录先于 head 可见
+ *   - 单生产者的前提：所有调用 ISR_Event_Post 的中断使用同一抢占优先级
+ *     （目前 DMA1_Stream0/1、SPI4、USART1、DMA2D 均为6），互相不会嵌套
+ *   - 队列满时丢弃新事件并计数，中断中不等待
+ *   - 任务中发现的错误（如等待超时）用 ISR_Event_PostFromTask 上报：关中断期间写入，
+ *     与中断生产者不会交错
+ *   - 中断里禁止阻塞调用（如 HAL_UART_Transmit），需要打印的内容由事件任务或日志任务输出
+ *   - ISR_EVENT_MEASURE 为1时，stm32h7xx_it.c 中的中断入口用DWT测量处理时间并作为事件上报
+ ******************************************************************************
+ */
+
+#ifndef __ISR_EVENT_H
+#define __ISR_EVENT_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ISR_EVENT_RING_SIZE      64             // 必须是2的幂
+#define ISR_EVENT_FLAG           0x00020000U    // 事件任务的线程标志位
+
+#ifndef ISR_EVENT_MEASURE
+#define ISR_EVENT_MEASURE        0              // 1：测量中断处理时间
+#endif
+
+/* 事件类型 */
+typedef enum {
+    ISR_EVT_DMA_DONE = 1,       // DMA传输完成，arg 未用
+    ISR_EVT_DMA_ERROR,          // DMA/外设错误，arg 为 ErrorCode
+    ISR_EVT_ISR_TIME,           // 中断处理时间，arg 为DWT周期数
+} ISR_Event_Type_t;
+
+/* 事件来源 */
+typedef enum {
+    ISR_SRC_SPI4_TX = 0,        // LCD SPI4 发送（V1/V2/作业队列）
+    ISR_SRC_USART1_TX,          // 日志串口发送
+    ISR_SRC_DMA1_S0,            // DMA1_Stream0_IRQHandler（USART1 TX）
+    ISR_SRC_DMA1_S1,            // DMA1_Stream1_IRQHandler（SPI4 TX）
+    ISR_SRC_SPI4_IRQ,           // SPI4_IRQHandler（EOT，完成回调在这里调用）
+    ISR_SRC_USART1_IRQ,         // USART1_IRQHandler（TC）
+    ISR_SRC_DMA2D,              // DMA2D 位块传输（lcd_blit.c）
+    ISR_SRC_COUNT
+} ISR_Event_Source_t;
+
+/* 事件记录 */
+typedef struct {
+    uint8_t  type;              // ISR_Event_Type_t
+    uint8_t  source;            // ISR_Event_Source_t
+    uint16_t reserved;
+    uint32_t arg;
+    uint32_t cycles;            // 写入时的 DWT->CYCCNT
+} ISR_Event_t;
+
+/* 单生产者/单消费者环形队列 */
+typedef struct {
+    ISR_Event_t buf[ISR_EVENT_RING_SIZE];
+    volatile uint32_t head;     // 生产者写入位置（只由中断修改）
+    volatile uint32_t tail;     // 消费者读取位置（只由事件任务修改）
+    volatile uint32_t dropped;  // 队列满丢弃的事件数
+} ISR_EventRing_t;
+
+/* 每个来源的统计（由事件任务汇总） */
+typedef struct {
+    uint32_t done;
+    uint32_t errors;
+    uint32_t last_error;
+    uint32_t isr_count;         // 收到的处理时间样本数
+    uint32_t isr_cycles_max;
+    uint64_t isr_cycles_total;
+} ISR_Event_SourceStats_t;
+
+typedef struct {
+    ISR_Event_SourceStats_t source[ISR_SRC_COUNT];
+    uint32_t drained;           // 事件任务处理的事件数
+    uint32_t dropped;
+} ISR_Event_Stats_t;
+
+typedef void (*ISR_Event_Hook_t)(const ISR_Event_t *evt);
+
+/* 环形队列（可单独使用） */
+void     ISR_EventRing_Init(ISR_EventRing_t *ring);
+bool     ISR_EventRing_Push(ISR_EventRing_t *ring, const ISR_Event_t *evt);   // 生产者
+bool     ISR_EventRing_Pop(ISR_EventRing_t *ring, ISR_Event_t *evt);          // 消费者
+uint32_t ISR_EventRing_Count(const ISR_EventRing_t *ring);
+
+/**
+ * @brief 创建事件任务，之后 ISR_Event_Post 的事件由它处理
+ */
+HAL_StatusTypeDef ISR_Event_Start(void);
+
+/**
+ * @brief 中断中上报事件（只写入环形队列，必要时置位事件任务的线程标志）
+ */
+void ISR_Event_Post(ISR_Event_Type_t type, ISR_Event_Source_t source, uint32_t arg);
+
+/**
+ * @brief 任务中上报事件（不阻塞，可在已关中断时调用）
+ */
+void ISR_Event_PostFromTask(ISR_Event_Type_t type, ISR_Event_Source_t source, uint32_t arg);
+
+/**
+ * @brief 事件任务对每个事件额外调用的处理函数（任务上下文，可阻塞）
+ */
+void ISR_Event_SetHook(ISR_Event_Hook_t hook);
+
+void ISR_Event_GetStats(ISR_Event_Stats_t *stats);
+void ISR_Event_ResetStats(void);
+
+/* 中断处理时间测量：放在中断入口函数的开头和结尾 */
+#if ISR_EVENT_MEASURE
+#define ISR_MEASURE_BEGIN()       uint32_t isr_measure_t0 = DWT->CYCCNT
+#define ISR_MEASURE_END(source)   ISR_Event_Post(ISR_EVT_ISR_TIME, (source), DWT->CYCCNT - isr_measure_t0)
+#else
+#define ISR_MEASURE_BEGIN()       do { } while (0)
+#define ISR_MEASURE_END(source)   do { } while (0)
+#endif
+
+#endif /* __ISR_EVENT_H */
@@ -0,0 +1,444 @@
+/**
+ ******************************************************************************
+ * @file    mem_region.c
+ * @brief   分区内存分配 - 每个池一条按地址排序的空闲链表，MPU区域与D-Cache维护
+ ******************************************************************************
+ */
+
+#include "mem_region.h"
+#include <string.h>
+
+#define MEM_AXI_BASE        0x24000000U
+#define MEM_AXI_SIZE        0x00080000U     // 512KB
+#define MEM_D2_BASE         0x30000000U
+#define MEM_D3_BASE         0x38000000U
+
+#define MEM_USED            0x80000000U     // 块大小的最高位：已分配
+#define MEM_MAGIC           0x4D454D41U     // 已分配块的标记 "MEMA"
+#define MEM_NIL             0xFFFFFFFFU
+
+/* 块头，紧挨着用户数据之前；空闲块的 next 为下一个空闲块相对池首的偏移 */
+typedef struct {
+    uint32_t size;                  // 整块字节数（含块头），已分配时或上 MEM_USED
+    uint32_t next;                  // 空闲：下一个空闲块偏移；已分配：MEM_MAGIC
+} Mem_Block_t;
+
+#define MEM_HDR             ((uint32_t)sizeof(Mem_Block_t))
+#define MEM_MIN_BLOCK       (MEM_HDR + MEM_ALIGN_MIN)
+
+typedef struct {
+    uint8_t *base;
+    uint32_t size;
+    uint32_t free_head;             // 第一个空闲块偏移
+    Mem_PoolStats_t stats;
+} Mem_PoolState_t;
+
+/* 默认池：DTCM 中的在 .bss */
+__attribute__((aligned(32))) static uint8_t mem_dtcm_arena[MEM_POOL_DTCM_SIZE];
+__attribute__((section(".ram_d1"))) __attribute__((aligned(32))) static uint8_t mem_axi_arena[MEM_POOL_AXI_SIZE];
+__attribute__((section(".ram_d2"))) __attribute__((aligned(32))) static uint8_t mem_d2_arena[MEM_POOL_D2_SIZE];
+__attribute__((section(".ram_d3"))) __attribute__((aligned(32))) static uint8_t mem_d3_arena[MEM_POOL_D3_SIZE];
+
+static Mem_PoolState_t mem_pools[MEM_POOL_COUNT];
+
+/* 各类别依次尝试的池 */
+static const Mem_Pool_t mem_class_pools[MEM_CLASS_COUNT][MEM_POOL_COUNT] = {
+    [MEM_CLASS_FAST]    = { MEM_POOL_DTCM, MEM_POOL_AXI, MEM_POOL_COUNT },
+    [MEM_CLASS_DMA]     = { MEM_POOL_AXI, MEM_POOL_D2, MEM_POOL_D3, MEM_POOL_COUNT },
+    [MEM_CLASS_NOCACHE] = { MEM_POOL_D2, MEM_POOL_D3, MEM_POOL_COUNT },
+};
+
+static inline Mem_Block_t *Mem_At(Mem_PoolState_t *p, uint32_t off)
+{
+    return (Mem_Block_t *)(p->base + off);
+}
+
+static inline uintptr_t Mem_AlignUp(uintptr_t v, uint32_t align)
+{
+    return (v + align - 1U) & ~(uintptr_t)(align - 1U);
+}
+
+/* ==================== MPU ==================== */
+
+#if defined(__MPU_PRESENT) && (__MPU_PRESENT == 1U)
+static void Mem_MPU_Region(uint8_t number, uint32_t base, uint8_t size, bool cacheable)
+{
+    MPU_Region_InitTypeDef r = {0};
+
+    r.Enable = MPU_REGION_ENABLE;
+    r.Number = number;
+    r.BaseAddress = base;
+    r.Size = size;
+    r.SubRegionDisable = 0x00;
+    // TEX=1：普通存储器；C=B=1 为写回/写分配，C=B=0 为不可缓存
+    r.TypeExtField = MPU_TEX_LEVEL1;
+    r.AccessPermission = MPU_REGION_FULL_ACCESS;
+    r.DisableExec = MPU_INSTRUCTION_ACCESS_ENABLE;
+    r.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+    r.IsCacheable = cacheable ? MPU_ACCESS_CACHEABLE : MPU_ACCESS_NOT_CACHEABLE;
+    r.IsBufferable = cacheable ? MPU_ACCESS_BUFFERABLE : MPU_ACCESS_NOT_BUFFERABLE;
+    HAL_MPU_ConfigRegion(&r);
+}
+#endif
+
+/**
+ * @brief 在 MPU_Config（区域0背景、区域1 QSPI）之后追加SRAM区域
+ * @note  MPU区域大小必须是2的幂且按大小对齐：D2的288KB分成SRAM1+SRAM2（256KB）和SRAM3（32KB）两个区域
+ */
+static void Mem_MPU_Config(void)
+{
+#if defined(__MPU_PRESENT) && (__MPU_PRESENT == 1U)
+    __DMB();
+    HAL_MPU_Disable();
+    Mem_MPU_Region(MPU_REGION_NUMBER2, MEM_AXI_BASE, MPU_REGION_SIZE_512KB, true);
+    Mem_MPU_Region(MPU_REGION_NUMBER3, MEM_D2_BASE, MPU_REGION_SIZE_256KB, false);
+    Mem_MPU_Region(MPU_REGION_NUMBER4, MEM_D2_BASE + 0x40000U, MPU_REGION_SIZE_32KB, false);
+    Mem_MPU_Region(MPU_REGION_NUMBER5, MEM_D3_BASE, MPU_REGION_SIZE_64KB, false);
+    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+#endif
+}
+
+/* ==================== 初始化 ==================== */
+
+void Mem_Init(void)
+{
+    Mem_MPU_Config();
+
+    Mem_InitPool(MEM_POOL_DTCM, mem_dtcm_arena, sizeof(mem_dtcm_arena));
+    Mem_InitPool(MEM_POOL_AXI, mem_axi_arena, sizeof(mem_axi_arena));
+    Mem_InitPool(MEM_POOL_D2, mem_d2_arena, sizeof(mem_d2_arena));
+    Mem_InitPool(MEM_POOL_D3, mem_d3_arena, sizeof(mem_d3_arena));
+}
+
+HAL_StatusTypeDef Mem_InitPool(Mem_Pool_t pool, void *base, uint32_t size)
+{
+    Mem_PoolState_t *p;
+    uint32_t primask;
+
+    if (pool >= MEM_POOL_COUNT || base == NULL || ((uintptr_t)base & (MEM_ALIGN_MIN - 1U)) != 0U) {
+        return HAL_ERROR;
+    }
+    size &= ~(MEM_ALIGN_MIN - 1U);
+    if (size < MEM_MIN_BLOCK || size >= MEM_USED) {
+        return HAL_ERROR;
+    }
+
+    p = &mem_pools[pool];
+    primask = __get_PRIMASK();
+    __disable_irq();
+    memset(p, 0, sizeof(*p));
+    p->base = (uint8_t *)base;
+    p->size = size;
+    p->free_head = 0;
+    Mem_At(p, 0)->size = size;
+    Mem_At(p, 0)->next = MEM_NIL;
+    p->stats.size = size;
+    __set_PRIMASK(primask);
+    return HAL_OK;
+}
+
+/* ==================== 分配/释放 ==================== */
+
+/* 首次适配；关中断调用 */
+static void *Mem_PoolAlloc(Mem_PoolState_t *p, uint32_t size, uint32_t align)
+{
+    uint32_t need = (uint32_t)Mem_AlignUp(size, MEM_ALIGN_MIN) + MEM_HDR;
+    uint32_t prev = MEM_NIL, off = p->free_head;
+
+    while (off != MEM_NIL) {
+        Mem_Block_t *b = Mem_At(p, off);
+        uintptr_t addr = (uintptr_t)b;
+        // 用户数据按 align 对齐；前面剩下的空隙不够一个空闲块时再往后挪一个对齐单位
+        uint32_t lead = (uint32_t)(Mem_AlignUp(addr + MEM_HDR, align) - MEM_HDR - addr);
+        if (lead != 0U && lead < MEM_MIN_BLOCK) {
+            lead = (uint32_t)(Mem_AlignUp(addr + MEM_HDR + MEM_MIN_BLOCK, align) - MEM_HDR - addr);
+        }
+
+        if (lead + need <= b->size) {
+            uint32_t start = off + lead;
+            uint32_t tail = b->size - lead - need;
+            uint32_t next = b->next;
+
+            // 尾部剩余够一个空闲块时拆出来，否则并入本块
+            if (tail >= MEM_MIN_BLOCK) {
+                Mem_Block_t *t = Mem_At(p, start + need);
+                t->size = tail;
+                t->next = next;
+                next = start + need;
+            } else {
+                need += tail;
+            }
+            // 前部空隙保留为原空闲块
+            if (lead != 0U) {
+                b->size = lead;
+                b->next = next;
+            } else if (prev == MEM_NIL) {
+                p->free_head = next;
+            } else {
+                Mem_At(p, prev)->next = next;
+            }
+
+            Mem_Block_t *a = Mem_At(p, start);
+            a->size = need | MEM_USED;
+            a->next = MEM_MAGIC;
+            p->stats.used += need;
+            if (p->stats.used > p->stats.peak) {
+                p->stats.peak = p->stats.used;
+            }
+            p->stats.allocs++;
+            return (uint8_t *)a + MEM_HDR;
+        }
+        prev = off;
+        off = b->next;
+    }
+    return NULL;
+}
+
+static void *Mem_TryAlloc(Mem_Pool_t pool, uint32_t size, uint32_t align, bool count_failure)
+{
+    Mem_PoolState_t *p = &mem_pools[pool];
+    uint32_t primask = __get_PRIMASK();
+    void *ptr = NULL;
+
+    __disable_irq();
+    if (p->size != 0U) {
+        ptr = Mem_PoolAlloc(p, size, align);
+        if (ptr == NULL && count_failure) {
+            p->stats.failures++;
+        }
+    }
+    __set_PRIMASK(primask);
+    return ptr;
+}
+
+void *Mem_AllocFrom(Mem_Pool_t pool, uint32_t size, uint32_t align)
+{
+    if (pool >= MEM_POOL_COUNT || size == 0U || size >= MEM_USED || (align & (align - 1U)) != 0U) {
+        return NULL;
+    }
+    if (align < MEM_ALIGN_MIN) {
+        align = MEM_ALIGN_MIN;
+    }
+    return Mem_TryAlloc(pool, size, align, true);
+}
+
+void *Mem_Alloc(Mem_Class_t cls, uint32_t size)
+{
+    uint32_t align = MEM_ALIGN_MIN;
+    void *ptr = NULL;
+
+    if (cls >= MEM_CLASS_COUNT || size == 0U || size >= MEM_USED - MEM_CACHE_LINE) {
+        return NULL;
+    }
+    // DMA缓冲区独占缓存行：首地址和长度都按行对齐，失效操作不会波及相邻数据
+    if (cls != MEM_CLASS_FAST) {
+        align = MEM_CACHE_LINE;
+        size = (uint32_t)Mem_AlignUp(size, MEM_CACHE_LINE);
+    }
+    for (uint32_t i = 0; ptr == NULL && mem_class_pools[cls][i] != MEM_POOL_COUNT; i++) {
+        // 还有后备池时不计失败
+        bool last = (i + 1U == MEM_POOL_COUNT) || mem_class_pools[cls][i + 1U] == MEM_POOL_COUNT;
+        ptr = Mem_TryAlloc(mem_class_pools[cls][i], size, align, last);
+    }
+    return ptr;
+}
+
+Mem_Pool_t Mem_PoolOf(const void *ptr)
+{
+    for (uint32_t i = 0; i < MEM_POOL_COUNT; i++) {
+        const Mem_PoolState_t *p = &mem_pools[i];
+        if (p->size != 0U && (uintptr_t)ptr - (uintptr_t)p->base < p->size) {
+            return (Mem_Pool_t)i;
+        }
+    }
+    return MEM_POOL_COUNT;
+}
+
+HAL_StatusTypeDef Mem_Free(void *ptr)
+{
+    Mem_Pool_t pool;
+    Mem_PoolState_t *p;
+    Mem_Block_t *a;
+    uint32_t primask, off, size, prev, next;
+
+    if (ptr == NULL) {
+        return HAL_OK;
+    }
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    pool = Mem_PoolOf(ptr);
+    if (pool == MEM_POOL_COUNT) {
+        __set_PRIMASK(primask);
+        return HAL_ERROR;
+    }
+    p = &mem_pools[pool];
+    off = (uint32_t)((uint8_t *)ptr - p->base);
+    a = (off >= MEM_HDR) ? Mem_At(p, off - MEM_HDR) : NULL;
+    if (a == NULL || a->next != MEM_MAGIC || (a->size & MEM_USED) == 0U) {
+        p->stats.bad_frees++;
+        __set_PRIMASK(primask);
+        return HAL_ERROR;
+    }
+    off -= MEM_HDR;
+    size = a->size & ~MEM_USED;
+    p->stats.used -= size;
+    p->stats.frees++;
+
+    // 按地址插入空闲链表，与前后相邻的空闲块合并
+    prev = MEM_NIL;
+    next = p->free_head;
+    while (next != MEM_NIL && next < off) {
+        prev = next;
+        next = Mem_At(p, next)->next;
+    }
+    a->size = size;
+    a->next = next;
+    if (next != MEM_NIL && off + size == next) {
+        a->size += Mem_At(p, next)->size;
+        a->next = Mem_At(p, next)->next;
+    }
+    if (prev == MEM_NIL) {
+        p->free_head = off;
+    } else if (prev + Mem_At(p, prev)->size == off) {
+        Mem_At(p, prev)->size += a->size;
+        Mem_At(p, prev)->next = a->next;
+    } else {
+        Mem_At(p, prev)->next = off;
+    }
+
+    __set_PRIMASK(primask);
+    return HAL_OK;
+}
+
+/* ==================== D-Cache ==================== */
+
+bool Mem_IsCacheable(const void *addr)
+{
+    return (uintptr_t)addr - MEM_AXI_BASE < MEM_AXI_SIZE;
+}
+
+#if defined(SCB_CCR_DC_Msk)
+/* 需要维护的缓存行范围；D-Cache未开启或地址不经过缓存时返回 false */
+static bool Mem_CacheRange(const void *addr, uint32_t bytes, uint32_t **line, int32_t *len)
+{
+    uintptr_t a = (uintptr_t)addr;
+
+    if ((SCB->CCR & SCB_CCR_DC_Msk) == 0U || bytes == 0U || !Mem_IsCacheable(addr)) {
+        return false;
+    }
+    *line = (uint32_t *)(a & ~(uintptr_t)(MEM_CACHE_LINE - 1U));
+    *len = (int32_t)(bytes + (a & (MEM_CACHE_LINE - 1U)));
+    return true;
+}
+#endif
+
+void Mem_Cache_Clean(const void *addr, uint32_t bytes)
+{
+#if defined(SCB_CCR_DC_Msk)
+    uint32_t *line;
+    int32_t len;
+
+    if (Mem_CacheRange(addr, bytes, &line, &len)) {
+        SCB_CleanDCache_by_Addr(line, len);
+    }
+#else
+    (void)addr;
+    (void)bytes;
+#endif
+}
+
+void Mem_Cache_Invalidate(void *addr, uint32_t bytes)
+{
+#if defined(SCB_CCR_DC_Msk)
+    uint32_t *line;
+    int32_t len;
+
+    if (Mem_CacheRange(addr, bytes, &line, &len)) {
+        SCB_InvalidateDCache_by_Addr(line, len);
+    }
+#else
+    (void)addr;
+    (void)bytes;
+#endif
+}
+
+void Mem_Cache_CleanInvalidate(void *addr, uint32_t bytes)
+{
+#if defined(SCB_CCR_DC_Msk)
+    uint32_t *line;
+    int32_t len;
+
+    if (Mem_CacheRange(addr, bytes, &line, &len)) {
+        SCB_CleanInvalidateDCache_by_Addr(line, len);
+    }
+#else
+    (void)addr;
+    (void)bytes;
+#endif
+}
+
+void Mem_Cache_Config(bool icache, bool dcache)
+{
+#if defined(SCB_CCR_DC_Msk)
+    bool ic_on = (SCB->CCR & SCB_CCR_IC_Msk) != 0U;
+    bool dc_on = (SCB->CCR & SCB_CCR_DC_Msk) != 0U;
+
+    if (icache && !ic_on) {
+        SCB_EnableICache();
+    } else if (!icache && ic_on) {
+        SCB_DisableICache();
+    }
+    if (dcache && !dc_on) {
+        SCB_EnableDCache();
+    } else if (!dcache && dc_on) {
+        SCB_DisableDCache();        // 内部先 clean+invalidate 全部缓存行
+    }
+#else
+    (void)icache;
+    (void)dcache;
+#endif
+}
+
+/* ==================== 统计 ==================== */
+
+void Mem_GetStats(Mem_Pool_t pool, Mem_PoolStats_t *stats)
+{
+    Mem_PoolState_t *p;
+    uint32_t primask;
+
+    memset(stats, 0, sizeof(*stats));
+    if (pool >= MEM_POOL_COUNT) {
+        return;
+    }
+    p = &mem_pools[pool];
+    primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = p->stats;
+    if (p->size != 0U) {
+        for (uint32_t off = p->free_head; off != MEM_NIL; off = Mem_At(p, off)->next) {
+            uint32_t avail = Mem_At(p, off)->size - MEM_HDR;
+            if (avail > stats->largest_free) {
+                stats->largest_free = avail;
+            }
+            stats->free_blocks++;
+        }
+    }
+    __set_PRIMASK(primask);
+}
+
+void Mem_ResetStats(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    for (uint32_t i = 0; i < MEM_POOL_COUNT; i++) {
+        Mem_PoolStats_t *s = &mem_pools[i].stats;
+        s->peak = s->used;
+        s->allocs = 0;
+        s->frees = 0;
+        s->failures = 0;
+        s->bad_frees = 0;
+    }
+    __set_PRIMASK(primask);
+}
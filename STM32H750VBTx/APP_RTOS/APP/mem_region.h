@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * @file    mem_region.h
+ * @brief   分区内存分配 - DTCM/AXI/D2/D3 各一个池，按用途类别选择池，配置对应的MPU区域
+ ******************************************************************************
+ * @note
+ *   - 四个池互相独立，各自是一段静态数组（放在对应SRAM的段中），首次适配，释放时与相邻空闲块合并
+ *   - 用途类别决定从哪些池分配（依次尝试）：
+ *       MEM_CLASS_FAST     只由CPU访问的热点数据：DTCM（零等待、不经缓存）→ AXI
+ *       MEM_CLASS_DMA      DMA1/DMA2/DMA2D读写的大缓冲区：AXI（可缓存）→ D2 → D3；
+ *                          首地址和长度都按32字节缓存行对齐，缓冲区独占所在的缓存行，
+ *                          CPU写完后 Mem_Cache_Clean，DMA写完后 Mem_Cache_Invalidate
+ *       MEM_CLASS_NOCACHE  与DMA共享、频繁小量读写的数据（描述符、行缓冲）：D2 → D3，不需要缓存维护
+ *     DTCM 只有CPU和MDMA能访问，DMA1/DMA2/DMA2D 不能使用
+ *   - Mem_Init 配置MPU：AXI SRAM 为写回/写分配可缓存，D2（SRAM1~3）和D3（SRAM4）为不可缓存；
+ *     之前 .ram_d2 中的DMA缓冲区（lcd_spi_dma.c、lcd_spi_dma_v2.c、uart_dma.c）默认也是可缓存的，
+ *     开启D-Cache必须在 Mem_Init 之后
+ *   - 可以在任务和中断中调用，分配/释放期间关中断（遍历空闲链表，不在中断中分配大量小块）
+ *   - 代码/常量表的放置：MEM_ITCM_CODE 把函数放到ITCM（启动代码从QSPI复制，零等待，不依赖I-Cache），
+ *     MEM_DTCM_DATA 把只读表放到DTCM（随 .data 复制）；APP_ITCM_HOT 为0时（CMake选项OFF）两者为空，
+ *     仍在QSPI中就地执行。第三方代码（FreeRTOS、HAL中断路径）在 cmake/ld/itcm/hot_code.ld 中按段名列出
+ ******************************************************************************
+ */
+
+#ifndef __MEM_REGION_H
+#define __MEM_REGION_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* 各池大小，需与链接脚本中各SRAM剩余空间匹配（超出时链接报错） */
+#ifndef MEM_POOL_DTCM_SIZE
+#define MEM_POOL_DTCM_SIZE      (16U * 1024U)   // .bss，与栈、FreeRTOS堆共用128KB DTCM
+#endif
+#ifndef MEM_POOL_AXI_SIZE
+#define MEM_POOL_AXI_SIZE       (32U * 1024U)   // .ram_d1，帧缓冲/字模缓存/翻转页面之外
+#endif
+#ifndef MEM_POOL_D2_SIZE
+#define MEM_POOL_D2_SIZE        (32U * 1024U)   // .ram_d2，DMA缓冲区/V1帧缓冲之外
+#endif
+#ifndef MEM_POOL_D3_SIZE
+#define MEM_POOL_D3_SIZE        (32U * 1024U)   // .ram_d3，其余模块未使用
+#endif
+
+#define MEM_CACHE_LINE          32U             // Cortex-M7 D-Cache 行大小
+#define MEM_ALIGN_MIN           8U              // 最小对齐
+
+#ifndef APP_ITCM_HOT
+#define APP_ITCM_HOT            0
+#endif
+
+#if APP_ITCM_HOT
+/* noinline：内联到QSPI中的调用者后就不在ITCM中执行了 */
+#define MEM_ITCM_CODE           __attribute__((section(".itcm_text"), noinline))
+/* 只用于const表；同一文件中可写变量放到同名段会与只读表冲突 */
+#define MEM_DTCM_DATA           __attribute__((section(".dtcm_data")))
+#else
+#define MEM_ITCM_CODE
+#define MEM_DTCM_DATA
+#endif
+
+typedef enum {
+    MEM_POOL_DTCM = 0,          // 0x20000000，128KB
+    MEM_POOL_AXI,               // 0x24000000，512KB
+    MEM_POOL_D2,                // 0x30000000，288KB
+    MEM_POOL_D3,                // 0x38000000，64KB
+    MEM_POOL_COUNT
+} Mem_Pool_t;
+
+typedef enum {
+    MEM_CLASS_FAST = 0,
+    MEM_CLASS_DMA,
+    MEM_CLASS_NOCACHE,
+    MEM_CLASS_COUNT
+} Mem_Class_t;
+
+typedef struct {
+    uint32_t size;              // 池总字节数，0为未初始化
+    uint32_t used;              // 已分配字节数（含块头和对齐填充）
+    uint32_t peak;              // used 的最大值
+    uint32_t largest_free;      // 最大空闲块可分配的字节数
+    uint32_t free_blocks;       // 空闲块个数（碎片程度）
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t failures;          // 空间不足的分配次数（按类别分配时只计最后尝试的池）
+    uint32_t bad_frees;         // 释放不属于本池、已释放或块头被改写的指针
+} Mem_PoolStats_t;
+
+/**
+ * @brief 用各SRAM中的默认池初始化，并配置MPU区域
+ * @note  在其它模块分配之前、开启D-Cache之前调用一次（app_main_init）
+ */
+void Mem_Init(void);
+
+/**
+ * @brief 用指定内存作为某个池（测试或临时借用一块大缓冲区），池中原有的分配全部作废
+ * @param base 至少8字节对齐
+ * @retval HAL_ERROR 内存太小或未对齐
+ */
+HAL_StatusTypeDef Mem_InitPool(Mem_Pool_t pool, void *base, uint32_t size);
+
+/**
+ * @brief 按用途类别分配
+ * @retval 所有候选池都不足时返回NULL
+ */
+void *Mem_Alloc(Mem_Class_t cls, uint32_t size);
+
+/**
+ * @brief 从指定池分配
+ * @param align 2的幂，小于8时按8对齐
+ */
+void *Mem_AllocFrom(Mem_Pool_t pool, uint32_t size, uint32_t align);
+
+/**
+ * @brief 释放，NULL 直接返回 HAL_OK
+ * @retval HAL_ERROR 指针不是本模块分配的或已经释放
+ */
+HAL_StatusTypeDef Mem_Free(void *ptr);
+
+/* 指针所在的池，不属于任何池时返回 MEM_POOL_COUNT */
+Mem_Pool_t Mem_PoolOf(const void *ptr);
+
+/* 地址所在的存储器在 Mem_Init 的MPU配置下是否经过D-Cache（只有AXI SRAM） */
+bool Mem_IsCacheable(const void *addr);
+
+/**
+ * @brief D-Cache维护，D-Cache未开启或地址不可缓存时直接返回
+ * @note  Clean：CPU写入的数据写回内存，之后DMA读取（发送）
+ *        Invalidate：丢弃缓存行，之后CPU读取DMA写入的数据；首尾不满一行的部分会连同相邻数据一起丢弃，
+ *        缓冲区应当来自 MEM_CLASS_DMA 或自行按缓存行对齐
+ *        CleanInvalidate：DMA写入前调用，避免CPU的脏行之后被逐出覆盖DMA的结果
+ */
+void Mem_Cache_Clean(const void *addr, uint32_t bytes);
+void Mem_Cache_Invalidate(void *addr, uint32_t bytes);
+void Mem_Cache_CleanInvalidate(void *addr, uint32_t bytes);
+
+/**
+ * @brief 开启/关闭 I-Cache 和 D-Cache
+ * @note  开启D-Cache须在 Mem_Init 之后（D2/D3先设为不可缓存）；关闭D-Cache时先写回全部脏行；
+ *        已是目标状态时不做任何操作
+ */
+void Mem_Cache_Config(bool icache, bool dcache);
+
+void Mem_GetStats(Mem_Pool_t pool, Mem_PoolStats_t *stats);
+void Mem_ResetStats(void);      // 清零计数，peak 从当前 used 重新开始
+
+#endif /* __MEM_REGION_H */
@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ * @file    uart_dma.c
+ * @brief   USART1 DMA发送 - 完成/错误回调经 dma_sync 唤醒发送任务
+ ******************************************************************************
+ */
+
+#include "uart_dma.h"
+#include "isr_event.h"
+#include "cmsis_os2.h"
+#include <string.h>
+
+__attribute__((section(".ram_d2"))) __attribute__((aligned(32))) static uint8_t uart_dma_buffer[UART_DMA_BUFFER_SIZE];
+
+static UART_HandleTypeDef *uart_dma_huart;
+static DMA_Sync_t uart_dma_sync;
+static osMutexId_t uart_dma_mutex;
+
+void UART_DMA_Init(UART_HandleTypeDef *huart)
+{
+    uart_dma_huart = huart;
+    DMA_Sync_Init(&uart_dma_sync);
+    if (uart_dma_mutex == NULL) {
+        uart_dma_mutex = osMutexNew(NULL);
+    }
+}
+
+HAL_StatusTypeDef UART_DMA_Transmit(const void *data, uint16_t length, uint32_t timeout_ms)
+{
+    const uint8_t *src = data;
+    HAL_StatusTypeDef status = HAL_OK;
+
+    if (uart_dma_huart == NULL || data == NULL) {
+        return HAL_ERROR;
+    }
+    if (uart_dma_mutex != NULL && osMutexAcquire(uart_dma_mutex, timeout_ms) != osOK) {
+        return HAL_BUSY;
+    }
+
+    while (length > 0 && status == HAL_OK) {
+        uint16_t chunk = (length > UART_DMA_BUFFER_SIZE) ? UART_DMA_BUFFER_SIZE : length;
+
+        memcpy(uart_dma_buffer, src, chunk);
+        DMA_Sync_Arm(&uart_dma_sync);
+        status = HAL_UART_Transmit_DMA(uart_dma_huart, uart_dma_buffer, chunk);
+        if (status != HAL_OK) {
+            DMA_Sync_Cancel(&uart_dma_sync);
+            break;
+        }
+        status = DMA_Sync_Wait(&uart_dma_sync, timeout_ms);
+        if (status == HAL_TIMEOUT) {
+            HAL_UART_AbortTransmit(uart_dma_huart);
+        }
+        src += chunk;
+        length -= chunk;
+    }
+    if (uart_dma_mutex != NULL) {
+        osMutexRelease(uart_dma_mutex);
+    }
+    return status;
+}
+
+DMA_Sync_t *UART_DMA_GetSync(void)
+{
+    return &uart_dma_sync;
+}
+
+/**
+ * @brief 发送完成回调（USART1_IRQHandler -> HAL_UART_IRQHandler，TC中断）
+ */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    if (huart == uart_dma_huart) {
+        DMA_Sync_Complete(&uart_dma_sync);
+        ISR_Event_Post(ISR_EVT_DMA_DONE, ISR_SRC_USART1_TX, 0);
+    }
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    if (huart == uart_dma_huart) {
+        DMA_Sync_Fail(&uart_dma_sync, huart->ErrorCode);
+        ISR_Event_Post(ISR_EVT_DMA_ERROR, ISR_SRC_USART1_TX, huart->ErrorCode);
+    }
+}
@@ -0,0 +1,36 @@
+/**
+ ******************************************************************************
+ * @file    uart_dma.h
+ * @brief   USART1 DMA发送 - 发送期间任务阻塞在完成中断上，不占用CPU
+ ******************************************************************************
+ * @note
+ *   - 数据先拷贝到D2 SRAM中的发送缓冲区（DMA1不能访问DTCM中的任务栈），
+ *     超过缓冲区长度时分块发送
+ *   - 多个任务可以调用，互斥量保证一次只有一个任务在发送；
+ *     DMA发送期间其他任务直接调用 HAL_UART_Transmit 会返回 HAL_BUSY，日志和错误信息都应经本模块发送
+ *   - UART_DMA_Init 在创建使用串口的任务之前调用（app_main_init）
+ ******************************************************************************
+ */
+
+#ifndef __UART_DMA_H
+#define __UART_DMA_H
+
+#include "stm32h7xx_hal.h"
+#include <stdint.h>
+#include "dma_sync.h"
+
+#define UART_DMA_BUFFER_SIZE    256     // 发送缓冲区字节数
+
+void UART_DMA_Init(UART_HandleTypeDef *huart);
+
+/**
+ * @brief 经DMA发送并等待完成
+ * @param timeout_ms  等待其他任务发送完成、以及每一块DMA发送的超时
+ * @retval HAL_ERROR 时错误原因（HAL_UART_ERROR_xxx）见 UART_DMA_GetSync()->error；
+ *         等不到互斥量时返回 HAL_BUSY
+ */
+HAL_StatusTypeDef UART_DMA_Transmit(const void *data, uint16_t length, uint32_t timeout_ms);
+
+DMA_Sync_t *UART_DMA_GetSync(void);
+
+#endif /* __UART_DMA_H */
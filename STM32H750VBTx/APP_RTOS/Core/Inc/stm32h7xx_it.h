@@ -57,7 +57,7 @@ void DMA1_Stream1_IRQHandler(void);
 void TIM6_DAC_IRQHandler(void);
 void SPI4_IRQHandler(void);
 /* USER CODE BEGIN EFP */
-
+void USART1_IRQHandler(void);
 /* USER CODE END EFP */
 
 #ifdef __cplusplus
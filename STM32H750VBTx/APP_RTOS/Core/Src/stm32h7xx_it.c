@@ -22,6 +22,8 @@
 #include "stm32h7xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "isr_event.h"
+#include "lcd_blit.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -61,7 +63,7 @@ extern DMA_HandleTypeDef hdma_usart1_tx;
 extern TIM_HandleTypeDef htim6;
 
 /* USER CODE BEGIN EV */
-
+extern UART_HandleTypeDef huart1;
 /* USER CODE END EV */
 
 /******************************************************************************/
@@ -168,11 +170,11 @@ void DebugMon_Handler(void)
 void DMA1_Stream0_IRQHandler(void)
 {
   /* USER CODE BEGIN DMA1_Stream0_IRQn 0 */
-
+  ISR_MEASURE_BEGIN();
   /* USER CODE END DMA1_Stream0_IRQn 0 */
   HAL_DMA_IRQHandler(&hdma_usart1_tx);
   /* USER CODE BEGIN DMA1_Stream0_IRQn 1 */
-
+  ISR_MEASURE_END(ISR_SRC_DMA1_S0);
   /* USER CODE END DMA1_Stream0_IRQn 1 */
 }
 
@@ -182,11 +184,11 @@ void DMA1_Stream0_IRQHandler(void)
 void DMA1_Stream1_IRQHandler(void)
 {
   /* USER CODE BEGIN DMA1_Stream1_IRQn 0 */
-
+  ISR_MEASURE_BEGIN();
   /* USER CODE END DMA1_Stream1_IRQn 0 */
   HAL_DMA_IRQHandler(&hdma_spi4_tx);
   /* USER CODE BEGIN DMA1_Stream1_IRQn 1 */
-
+  ISR_MEASURE_END(ISR_SRC_DMA1_S1);
   /* USER CODE END DMA1_Stream1_IRQn 1 */
 }
 
@@ -210,14 +212,36 @@ void TIM6_DAC_IRQHandler(void)
 void SPI4_IRQHandler(void)
 {
   /* USER CODE BEGIN SPI4_IRQn 0 */
-
+  ISR_MEASURE_BEGIN();
   /* USER CODE END SPI4_IRQn 0 */
   HAL_SPI_IRQHandler(&hspi4);
   /* USER CODE BEGIN SPI4_IRQn 1 */
-
+  ISR_MEASURE_END(ISR_SRC_SPI4_IRQ);
   /* USER CODE END SPI4_IRQn 1 */
 }
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles USART1 global interrupt.
+  * @note  DMA发送结束后HAL打开TC中断，发送完成回调在这里调用（uart_dma.c）
+  */
+void USART1_IRQHandler(void)
+{
+  ISR_MEASURE_BEGIN();
+  HAL_UART_IRQHandler(&huart1);
+  ISR_MEASURE_END(ISR_SRC_USART1_IRQ);
+}
+
+/**
+  * @brief This function handles DMA2D global interrupt.
+  * @note  DMA2D不在CubeMX配置中，时钟和NVIC由 LCD_Blit_Init 打开
+  */
+void DMA2D_IRQHandler(void)
+{
+  ISR_MEASURE_BEGIN();
+  LCD_Blit_IRQHandler();
+  ISR_MEASURE_END(ISR_SRC_DMA2D);
+}
+
 /* USER CODE END 1 */
@@ -0,0 +1,281 @@
+/**
+ ******************************************************************************
+ * @file    host_display_list.c
+ * @brief   主机端显示列表测试 - 行带光栅化的金样校验与总线开销对比
+ ******************************************************************************
+ * @note
+ *   - 场景与 app_lcd_benchmark.c 中的 LCD_DrawDashboard_DL 相同
+ *   - 参考图由本文件中逐像素的简单实现整帧绘制，其哈希值作为金样固定在下面；
+ *     各种行带高度和局部区域的光栅化结果都必须与参考图逐像素一致
+ *   - 经模拟SPI/DMA渲染到屏幕模型后再次比较，并统计字节数和窗口数；
+ *     同一场景中的矩形类图元逐个用 LCD_DMA_FillRect 发送作为对照
+ ******************************************************************************
+ */
+
+#include "lcd_display_list.h"
+#include "lcd_font_index.h"
+#include "host_panel.h"
+#include "spi.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define GOLDEN_HASH      0x9C9CA0CDU     // 参考图的FNV-1a哈希，场景或绘制规则变化时需更新
+
+#define COLOR_RED       0xF800
+#define COLOR_GREEN     0x07E0
+#define COLOR_BLUE      0x001F
+#define COLOR_YELLOW    0xFFE0
+#define COLOR_CYAN      0x07FF
+#define COLOR_MAGENTA   0xF81F
+#define COLOR_WHITE     0xFFFF
+#define COLOR_ORANGE    0xFD20
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+static LCD_DisplayList_t dl;
+static uint16_t reference[LCD_WIDTH * LCD_HEIGHT];
+static uint16_t frame[LCD_WIDTH * LCD_HEIGHT];
+
+static const uint16_t colors[] = { COLOR_RED, COLOR_ORANGE, COLOR_YELLOW, COLOR_GREEN, COLOR_CYAN, COLOR_BLUE, COLOR_MAGENTA };
+
+/* 仪表盘场景，与 LCD_DrawDashboard_DL 相同 */
+static void Build_Dashboard(LCD_DisplayList_t *list, uint32_t fps, uint32_t frame_count)
+{
+    char text_buf[32];
+
+    LCD_DL_Begin(list, true, 0x0010);
+    LCD_DL_GradientRect(list, 0, 0, 240, 30, COLOR_BLUE, COLOR_CYAN);
+    LCD_DL_Text(list, 30, 3, "性能测试", &ASCII_Font24, &CH_Font24, COLOR_WHITE, COLOR_BLUE);
+
+    LCD_DL_FillRect(list, 10, 40, 220, 50, 0x0660);
+    LCD_DL_DrawRect(list, 10, 40, 220, 50, COLOR_GREEN);
+    snprintf(text_buf, sizeof(text_buf), "FPS: %lu", (unsigned long)fps);
+    LCD_DL_Text(list, 20, 50, text_buf, &ASCII_Font24, NULL, COLOR_WHITE, 0x0660);
+
+    LCD_DL_FillRect(list, 10, 100, 220, 40, 0x8200);
+    LCD_DL_DrawRect(list, 10, 100, 220, 40, COLOR_ORANGE);
+    snprintf(text_buf, sizeof(text_buf), "Frame: %lu", (unsigned long)frame_count);
+    LCD_DL_Text(list, 20, 110, text_buf, &ASCII_Font24, NULL, COLOR_WHITE, 0x8200);
+
+    for (int i = 0; i < 7; i++) {
+        LCD_DL_FillRect(list, 10 + i * 32, 150, 30, 20, colors[i]);
+    }
+    uint16_t stripe_offset = (frame_count * 5) % 240;
+    for (int i = 0; i < 6; i++) {
+        LCD_DL_FillRect(list, (stripe_offset + i * 40) % 240, 220, 30, 20, colors[i % 7]);
+    }
+    LCD_DL_FillCircle(list, 220, 15, 8, COLOR_GREEN);
+}
+
+/* ==================== 参考实现：整帧逐像素绘制 ==================== */
+
+static void Ref_Pixel(int32_t x, int32_t y, uint16_t color)
+{
+    if (x >= 0 && x < LCD_WIDTH && y >= 0 && y < LCD_HEIGHT) {
+        reference[y * LCD_WIDTH + x] = color;
+    }
+}
+
+static void Ref_Cmd(const LCD_DL_Cmd_t *cmd)
+{
+    switch (cmd->type) {
+    case LCD_DL_FILL_RECT:
+    case LCD_DL_RECT:
+        for (int32_t y = cmd->y; y < cmd->y + cmd->h; y++) {
+            for (int32_t x = cmd->x; x < cmd->x + cmd->w; x++) {
+                int edge = (x == cmd->x || x == cmd->x + cmd->w - 1 || y == cmd->y || y == cmd->y + cmd->h - 1);
+                if (cmd->type == LCD_DL_FILL_RECT || edge) Ref_Pixel(x, y, cmd->color);
+            }
+        }
+        break;
+
+    case LCD_DL_GRADIENT:
+        for (int32_t row = 0; row < cmd->h; row++) {
+            int r1 = cmd->color >> 11, g1 = (cmd->color >> 5) & 0x3F, b1 = cmd->color & 0x1F;
+            int r2 = cmd->color2 >> 11, g2 = (cmd->color2 >> 5) & 0x3F, b2 = cmd->color2 & 0x1F;
+            uint16_t c = (uint16_t)(((r1 + (r2 - r1) * row / cmd->h) << 11) |
+                                    ((g1 + (g2 - g1) * row / cmd->h) << 5) | (b1 + (b2 - b1) * row / cmd->h));
+            for (int32_t x = cmd->x; x < cmd->x + cmd->w; x++) Ref_Pixel(x, cmd->y + row, c);
+        }
+        break;
+
+    case LCD_DL_FILL_CIRCLE: {
+        int32_t r = (cmd->w - 1) / 2, cx = cmd->x + r, cy = cmd->y + r;
+        for (int32_t dy = -r; dy <= r; dy++) {
+            for (int32_t dx = -r; dx <= r; dx++) {
+                if (dx * dx + dy * dy <= r * r + r) Ref_Pixel(cx + dx, cy + dy, cmd->color);
+            }
+        }
+        break;
+    }
+
+    case LCD_DL_TEXT: {
+        int32_t x = cmd->x;
+        uint16_t code;
+        for (const char *p = cmd->text; *p; ) {
+            const pFONT *font;
+            const uint8_t *bits;
+
+            p += LCD_FontIndex_Decode(p, &code);
+            if (code >= 0x20 && code < 0x7F) {
+                font = cmd->ascii;
+                bits = &font->pTable[(code - 32) * font->Sizes];
+            } else if (code >= 0x80 && cmd->ch != NULL) {
+                font = cmd->ch;
+                bits = LCD_FontIndex_Find(font, code);
+                if (bits == NULL) bits = LCD_FontIndex_Fallback(font);
+            } else {
+                continue;
+            }
+            for (int32_t y = 0; y < font->Height; y++) {
+                for (int32_t i = 0; i < font->Width; i++) {
+                    int on = (bits[y * ((font->Width + 7) / 8) + i / 8] >> (i % 8)) & 1;
+                    Ref_Pixel(x + i, cmd->y + y, on ? cmd->color : cmd->color2);
+                }
+            }
+            x += font->Width;
+        }
+        break;
+    }
+    }
+}
+
+static void Ref_Draw(const LCD_DisplayList_t *list)
+{
+    for (uint32_t i = 0; i < LCD_WIDTH * LCD_HEIGHT; i++) reference[i] = list->clear_color;
+    for (uint16_t i = 0; i < list->count; i++) Ref_Cmd(&list->cmds[i]);
+}
+
+static uint32_t Hash(const uint16_t *pixels, uint32_t count)
+{
+    uint32_t h = 2166136261U;
+    for (uint32_t i = 0; i < count; i++) {
+        h = (h ^ (pixels[i] & 0xFF)) * 16777619U;
+        h = (h ^ (pixels[i] >> 8)) * 16777619U;
+    }
+    return h;
+}
+
+/* ==================== 测试 ==================== */
+
+/* 按指定行带高度光栅化 (x0, y0, width, height) 区域，与参考图比较 */
+static uint32_t Check_Bands(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height, uint16_t band)
+{
+    static uint16_t buf[LCD_WIDTH * LCD_HEIGHT];
+    uint32_t errors = 0;
+
+    for (uint16_t y = y0; y < y0 + height; y += band) {
+        uint16_t rows = (y0 + height - y < band) ? (y0 + height - y) : band;
+
+        LCD_DL_RasterBand(&dl, buf, x0, y, width, rows);
+        for (uint16_t r = 0; r < rows; r++) {
+            for (uint16_t i = 0; i < width; i++) {
+                if (buf[r * width + i] != reference[(y + r) * LCD_WIDTH + x0 + i]) errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+static uint32_t Compare_Panel(void)
+{
+    uint32_t errors = 0;
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            if (HostPanel_GetPixel(x, y) != reference[y * LCD_WIDTH + x]) errors++;
+        }
+    }
+    return errors;
+}
+
+/* 同一场景中的矩形类图元逐个发送（文字和圆由 lcd_spi_154.c 绘制，主机上不计） */
+static void Immediate_Dashboard(void)
+{
+    LCD_DMA_Clear(&hlcd_dma, dl.clear_color);
+    for (uint16_t i = 0; i < dl.count; i++) {
+        const LCD_DL_Cmd_t *cmd = &dl.cmds[i];
+        uint16_t w = (cmd->x + cmd->w > LCD_WIDTH) ? LCD_WIDTH - cmd->x : cmd->w;
+
+        if (cmd->type == LCD_DL_FILL_RECT) {
+            LCD_DMA_FillRect(&hlcd_dma, cmd->x, cmd->y, w, cmd->h, cmd->color);
+        } else if (cmd->type == LCD_DL_GRADIENT) {
+            for (uint16_t row = 0; row < cmd->h; row++) {      // LCD_DrawGradientRect 逐行发送
+                LCD_DMA_FillRect(&hlcd_dma, cmd->x, cmd->y + row, w, 1, reference[(cmd->y + row) * LCD_WIDTH + cmd->x]);
+            }
+        } else if (cmd->type == LCD_DL_RECT) {
+            LCD_DMA_FillRect(&hlcd_dma, cmd->x, cmd->y, w, 1, cmd->color);
+            LCD_DMA_FillRect(&hlcd_dma, cmd->x, cmd->y + cmd->h - 1, w, 1, cmd->color);
+            LCD_DMA_FillRect(&hlcd_dma, cmd->x, cmd->y, 1, cmd->h, cmd->color);
+            LCD_DMA_FillRect(&hlcd_dma, cmd->x + w - 1, cmd->y, 1, cmd->h, cmd->color);
+        }
+    }
+}
+
+int main(void)
+{
+    const uint16_t bands[] = { 1, 7, 32, 80, 240 };
+    HostSPI_Stats_t stats;
+    uint32_t errors = 0;
+
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+
+    printf("=== LCD Display List (host) ===\r\n");
+
+    Build_Dashboard(&dl, 45, 123);
+    Ref_Draw(&dl);
+    uint32_t hash = Hash(reference, LCD_WIDTH * LCD_HEIGHT);
+    printf("  %u primitives, reference hash 0x%08X (golden 0x%08X)\r\n", dl.count, hash, GOLDEN_HASH);
+    if (hash != GOLDEN_HASH || dl.overflow) errors++;
+
+    /* 不同行带高度、局部区域 */
+    for (uint32_t i = 0; i < sizeof(bands) / sizeof(bands[0]); i++) {
+        uint32_t err = Check_Bands(0, 0, LCD_WIDTH, LCD_HEIGHT, bands[i]);
+        printf("  band %3u rows: mismatch %u\r\n", bands[i], err);
+        errors += err;
+    }
+    uint32_t err = Check_Bands(37, 11, 101, 150, 13);
+    printf("  region (37,11) 101x150, band 13: mismatch %u\r\n", err);
+    errors += err;
+
+    /* 经模拟SPI/DMA渲染 */
+    HostPanel_Reset();
+    HostSPI_ResetStats();
+    uint64_t t0 = HostSPI_NowNs();
+    LCD_DL_Render(&dl, &hlcd_dma);
+    HostSPI_WaitIdle();
+    double ms_dl = (HostSPI_NowNs() - t0) / 1e6;
+    HostSPI_GetStats(&stats);
+    err = Compare_Panel();
+    printf("  display list : %2u bands, %u windows, %7llu data B, %5.2f ms, panel mismatch %u\r\n",
+           dl.bands, HostPanel_GetWindowCount(), (unsigned long long)stats.data_bytes, ms_dl, err);
+    if (stats.data_bytes != LCD_WIDTH * LCD_HEIGHT * 2 + 8 || HostPanel_GetWindowCount() != 1) errors++;   // 8字节为CASET/RASET参数
+    errors += err;
+
+    /* 对照：矩形逐个发送 */
+    HostPanel_Reset();
+    HostSPI_ResetStats();
+    t0 = HostSPI_NowNs();
+    Immediate_Dashboard();
+    HostSPI_WaitIdle();
+    double ms_imm = (HostSPI_NowNs() - t0) / 1e6;
+    HostSPI_GetStats(&stats);
+    printf("  immediate    : rects only, %u windows, %7llu data B, %5.2f ms\r\n",
+           HostPanel_GetWindowCount(), (unsigned long long)stats.data_bytes, ms_imm);
+
+    /* 帧缓冲模式：合成到帧缓冲，再按脏块刷新 */
+    LCD_SPI_DMA_EnableFrameBuffer(&hlcd_dma);
+    LCD_DL_Render(&dl, &hlcd_dma);
+    memcpy(frame, hlcd_dma.frame_buffer, sizeof(frame));
+    err = (memcmp(frame, reference, sizeof(frame)) != 0);
+    LCD_SPI_DMA_DisableFrameBuffer(&hlcd_dma);
+    printf("  frame buffer : mismatch %u\r\n", err);
+    errors += err;
+
+    LCD_SPI_DMA_DeInit(&hlcd_dma);
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
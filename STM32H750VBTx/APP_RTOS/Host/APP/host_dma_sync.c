@@ -0,0 +1,249 @@
+/**
+ ******************************************************************************
+ * @file    host_dma_sync.c
+ * @brief   主机端DMA完成同步测试 - 唤醒延迟、超时、错误原因与LCD分块发送开销
+ ******************************************************************************
+ * @note
+ *   - 唤醒延迟：模拟中断线程在随机时刻完成传输，对比原 osDelay(1) 轮询
+ *     与 DMA_Sync_Wait 从"中断"到等待任务恢复运行的时间
+ *   - 超时：没有中断时按时返回 HAL_TIMEOUT，迟到的中断被忽略
+ *   - 错误：错误回调的 ErrorCode 经 Wait 返回一次，之后的 Wait 返回 HAL_OK
+ *   - LCD：LCD_DMA_Clear 分块发送，每块在总线时间之外的额外耗时；
+ *     模拟器注入DMA错误后 WriteBuffer 返回 HAL_ERROR 并带回 HAL_SPI_ERROR_DMA
+ *   - 主机上以 pthread 实现的 CMSIS-RTOS2 子集代替 FreeRTOS，
+ *     调度延迟与开发板不同，但能反映是否与tick绑定
+ ******************************************************************************
+ */
+
+#include "dma_sync.h"
+#include "lcd_spi_dma.h"
+#include "host_panel.h"
+#include "spi.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define LATENCY_ROUNDS   200
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+static DMA_Sync_t sync_obj;
+static volatile bool polled_busy;
+static volatile uint64_t signal_ns;
+
+typedef enum { MODE_POLL, MODE_SYNC, MODE_FAIL, MODE_LATE } Isr_Mode_t;
+
+typedef struct {
+    Isr_Mode_t mode;
+    uint32_t delay_us;
+    uint32_t error_code;
+} Isr_Job_t;
+
+static void Sleep_Us(uint32_t us)
+{
+    struct timespec ts = { (time_t)(us / 1000000U), (long)(us % 1000000U) * 1000L };
+    nanosleep(&ts, NULL);
+}
+
+/* 模拟中断：延时后在"中断锁"内结束传输 */
+static void *Isr_Thread(void *arg)
+{
+    Isr_Job_t *job = arg;
+
+    Sleep_Us(job->delay_us);
+    __disable_irq();
+    signal_ns = HostSPI_NowNs();
+    switch (job->mode) {
+    case MODE_POLL:
+        polled_busy = false;
+        break;
+    case MODE_SYNC:
+    case MODE_LATE:
+        DMA_Sync_Complete(&sync_obj);
+        break;
+    case MODE_FAIL:
+        DMA_Sync_Fail(&sync_obj, job->error_code);
+        break;
+    }
+    __enable_irq();
+    return NULL;
+}
+
+static pthread_t Start_Isr(Isr_Job_t *job)
+{
+    pthread_t t;
+    pthread_create(&t, NULL, Isr_Thread, job);
+    return t;
+}
+
+/* 原 LCD_SPI_DMA_WaitComplete 的等待方式 */
+static void Poll_Wait(void)
+{
+    while (polled_busy) {
+        osDelay(1);
+    }
+}
+
+static uint32_t Test_Latency(void)
+{
+    uint64_t poll_total = 0, poll_max = 0, sync_total = 0, sync_max = 0;
+    uint32_t errors = 0;
+
+    srand(1);
+    for (uint32_t i = 0; i < LATENCY_ROUNDS; i++) {
+        Isr_Job_t job = { MODE_POLL, 50U + (uint32_t)rand() % 450U, 0 };
+
+        polled_busy = true;
+        pthread_t t = Start_Isr(&job);
+        Poll_Wait();
+        uint64_t lat = HostSPI_NowNs() - signal_ns;
+        pthread_join(t, NULL);
+        poll_total += lat;
+        if (lat > poll_max) poll_max = lat;
+
+        job.mode = MODE_SYNC;
+        DMA_Sync_Arm(&sync_obj);
+        t = Start_Isr(&job);
+        if (DMA_Sync_Wait(&sync_obj, 100) != HAL_OK) errors++;
+        lat = HostSPI_NowNs() - signal_ns;
+        pthread_join(t, NULL);
+        sync_total += lat;
+        if (lat > sync_max) sync_max = lat;
+    }
+
+    double cycles_per_us = SystemCoreClock / 1e6;
+    printf("  wake latency  osDelay(1) poll: avg %7.1f us max %7.1f us\r\n",
+           poll_total / 1000.0 / LATENCY_ROUNDS, poll_max / 1000.0);
+    printf("                DMA_Sync_Wait  : avg %7.1f us max %7.1f us  (wakeups %u, DWT avg %.1f us max %.1f us)\r\n",
+           sync_total / 1000.0 / LATENCY_ROUNDS, sync_max / 1000.0, sync_obj.wakeups,
+           sync_obj.wakeups ? sync_obj.wake_cycles_total / cycles_per_us / sync_obj.wakeups : 0.0,
+           sync_obj.wake_cycles_max / cycles_per_us);
+
+    if (sync_obj.transfers != LATENCY_ROUNDS || sync_total * 4U > poll_total) {
+        errors++;
+    }
+    return errors;
+}
+
+static uint32_t Test_Timeout_Error(void)
+{
+    uint32_t errors = 0;
+    HAL_StatusTypeDef status;
+
+    /* 超时：没有中断 */
+    DMA_Sync_ResetStats(&sync_obj);
+    DMA_Sync_Arm(&sync_obj);
+    uint64_t t0 = HostSPI_NowNs();
+    status = DMA_Sync_Wait(&sync_obj, 5);
+    double ms = (HostSPI_NowNs() - t0) / 1e6;
+    printf("  timeout       : status %d after %.2f ms, error 0x%08X\r\n", status, ms,
+           DMA_Sync_GetError(&sync_obj));
+    if (status != HAL_TIMEOUT || ms < 5.0 || ms > 20.0 || DMA_Sync_GetError(&sync_obj) != DMA_SYNC_ERR_TIMEOUT ||
+        DMA_Sync_IsBusy(&sync_obj) || sync_obj.timeouts != 1) {
+        errors++;
+    }
+
+    /* 迟到的中断被忽略 */
+    Isr_Job_t late = { MODE_LATE, 0, 0 };
+    pthread_join(Start_Isr(&late), NULL);
+    if (sync_obj.transfers != 0 || DMA_Sync_Wait(&sync_obj, 5) != HAL_OK) {
+        errors++;
+    }
+
+    /* 错误回调 */
+    Isr_Job_t fail = { MODE_FAIL, 200, HAL_SPI_ERROR_DMA };
+    DMA_Sync_Arm(&sync_obj);
+    pthread_t t = Start_Isr(&fail);
+    status = DMA_Sync_Wait(&sync_obj, 100);
+    pthread_join(t, NULL);
+    HAL_StatusTypeDef again = DMA_Sync_Wait(&sync_obj, 100);
+    printf("  error         : status %d, error 0x%08X, next wait %d\r\n", status,
+           DMA_Sync_GetError(&sync_obj), again);
+    if (status != HAL_ERROR || DMA_Sync_GetError(&sync_obj) != HAL_SPI_ERROR_DMA || again != HAL_OK) {
+        errors++;
+    }
+
+    /* 错误回调中没有错误码 */
+    fail.error_code = 0;
+    DMA_Sync_Arm(&sync_obj);
+    t = Start_Isr(&fail);
+    status = DMA_Sync_Wait(&sync_obj, 100);
+    pthread_join(t, NULL);
+    if (status != HAL_ERROR || DMA_Sync_GetError(&sync_obj) != DMA_SYNC_ERR_UNKNOWN || sync_obj.errors != 2) {
+        errors++;
+    }
+
+    /* 中断先于 Wait 到达 */
+    Isr_Job_t early = { MODE_SYNC, 0, 0 };
+    DMA_Sync_Arm(&sync_obj);
+    pthread_join(Start_Isr(&early), NULL);
+    if (DMA_Sync_Wait(&sync_obj, 100) != HAL_OK) {
+        errors++;
+    }
+    return errors;
+}
+
+static uint32_t Test_LCD(void)
+{
+    uint32_t errors = 0, mismatch = 0;
+    uint32_t chunks = (LCD_WIDTH * LCD_HEIGHT + LCD_DMA_BUFFER_SIZE - 1) / LCD_DMA_BUFFER_SIZE;
+
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+
+    /* 预热一次，排除首次创建DMA线程的开销 */
+    LCD_DMA_Clear(&hlcd_dma, 0x0000);
+
+    uint64_t t0 = HostSPI_NowNs();
+    LCD_DMA_Clear(&hlcd_dma, 0x07E0);
+    double ms = (HostSPI_NowNs() - t0) / 1e6;
+    double bus_ms = LCD_WIDTH * LCD_HEIGHT * 2.0 * 8.0 / TEST_SPI_CLOCK * 1e3;
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            if (HostPanel_GetPixel(x, y) != 0x07E0) mismatch++;
+        }
+    }
+    double overhead_us = (ms - bus_ms) * 1000.0 / chunks;
+    printf("  LCD_DMA_Clear : %u chunks, %.2f ms (bus %.2f ms), %.1f us/chunk overhead, mismatch %u\r\n",
+           chunks, ms, bus_ms, overhead_us, mismatch);
+    if (mismatch != 0 || overhead_us > 500.0) {
+        errors++;
+    }
+
+    /* 注入DMA错误 */
+    static uint16_t line[LCD_WIDTH];
+    LCD_SPI_DMA_SetWindow(&hlcd_dma, 0, 0, LCD_WIDTH, 1);
+    HostSPI_FailNextDMA(HAL_SPI_ERROR_DMA);
+    HAL_StatusTypeDef status = LCD_SPI_DMA_WriteBuffer(&hlcd_dma, line, LCD_WIDTH);
+    uint32_t cause = DMA_Sync_GetError(&hlcd_dma.tx_sync);
+    printf("  LCD DMA error : status %d, cause 0x%08X\r\n", status, cause);
+    if (status != HAL_ERROR || cause != HAL_SPI_ERROR_DMA) {
+        errors++;
+    }
+    LCD_DMA_FillRect(&hlcd_dma, 0, 0, LCD_WIDTH, 1, 0xF800);
+    if (HostPanel_GetPixel(10, 0) != 0xF800) {
+        errors++;
+    }
+
+    LCD_SPI_DMA_DeInit(&hlcd_dma);
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors = 0;
+
+    printf("=== DMA Completion Sync (host) ===\r\n");
+    DMA_Sync_Init(&sync_obj);
+
+    errors += Test_Latency();
+    errors += Test_Timeout_Error();
+    errors += Test_LCD();
+
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+/**
+ ******************************************************************************
+ * @file    host_flip.c
+ * @brief   主机端页面翻转测试 - 不撕裂、只在上一帧仍在发送时阻塞、绘制/发送时间分开统计
+ ******************************************************************************
+ * @note
+ *   - 每帧在后台页面画满与帧号相关的图案，再用驱动的帧缓冲绘图函数画一个移动的矩形；
+ *     每次翻转返回时屏幕模型上必须恰好是上一帧（模拟DMA在传输结束时才读取数据，
+ *     改写在途页面会直接体现在比较结果里）
+ *   - 绘制时间短于发送时间时每次翻转都要等待；绘制时间长于发送时间时不等待，帧时间约等于绘制时间
+ *   - 与单帧缓冲（画完后 LCD_SPI_DMA_FlushFrameBuffer 整屏发送）比较帧时间
+ *   - 注入DMA错误后下一次翻转返回错误，之后恢复
+ ******************************************************************************
+ */
+
+#include "lcd_flip.h"
+#include "lcd_blit.h"
+#include "host_panel.h"
+#include "host_spi.h"
+#include "spi.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define TEST_FRAMES      12
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+static uint16_t expect[LCD_FRAME_BUFFER_SIZE];
+
+/* 第n帧的图案（移动矩形之外） */
+static uint16_t Pattern(uint32_t n, uint32_t i)
+{
+    return (uint16_t)((i * 31U) ^ (n * 0x9E37U) ^ (i >> 7));
+}
+
+/* 在后台页面画第n帧，busy_us 模拟更复杂的绘制 */
+static void Draw_Frame(uint32_t n, uint32_t busy_us)
+{
+    uint16_t *page = LCD_Flip_GetBackBuffer();
+    uint64_t until = HostSPI_NowNs() + (uint64_t)busy_us * 1000U;
+
+    for (uint32_t i = 0; i < LCD_FRAME_BUFFER_SIZE; i++) {
+        page[i] = Pattern(n, i);
+    }
+    LCD_DMA_FillRect(&hlcd_dma, (uint16_t)(10U + n * 7U), 40, 60, 50, 0xF800);
+    while (HostSPI_NowNs() < until) {
+    }
+}
+
+static void Expect_Frame(uint32_t n)
+{
+    for (uint32_t i = 0; i < LCD_FRAME_BUFFER_SIZE; i++) {
+        expect[i] = Pattern(n, i);
+    }
+    for (uint32_t y = 40; y < 90; y++) {
+        for (uint32_t x = 10U + n * 7U; x < 70U + n * 7U; x++) {
+            expect[y * LCD_WIDTH + x] = 0xF800;
+        }
+    }
+}
+
+static uint32_t Compare_Panel(void)
+{
+    uint32_t mismatch = 0;
+
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            if (HostPanel_GetPixel(x, y) != expect[y * LCD_WIDTH + x]) mismatch++;
+        }
+    }
+    return mismatch;
+}
+
+static double Cycles_Ms(uint64_t cycles)
+{
+    return cycles / (SystemCoreClock / 1e3);
+}
+
+/* ==================== 正确性 ==================== */
+
+static uint32_t Test_Correctness(void)
+{
+    uint32_t errors = 0, torn = 0;
+    HostSPI_Stats_t spi;
+
+    if (LCD_Flip_Begin(&hlcd_dma) != HAL_OK || LCD_Flip_Begin(&hlcd_dma) != HAL_BUSY ||
+        LCD_Flip_BorrowPage(0) != NULL || hlcd_dma.frame_buffer != LCD_Flip_GetBackBuffer()) {
+        errors++;
+    }
+    HostSPI_ResetStats();
+    for (uint32_t n = 0; n < TEST_FRAMES; n++) {
+        Draw_Frame(n, 0);
+        if (LCD_Flip_Swap(&hlcd_dma) != HAL_OK) errors++;
+        // 翻转只等待了上一帧：此时屏幕上恰好是上一帧
+        if (n > 0) {
+            Expect_Frame(n - 1);
+            torn += (Compare_Panel() != 0);
+        }
+    }
+    LCD_Flip_End(&hlcd_dma);
+    HostSPI_GetStats(&spi);
+    Expect_Frame(TEST_FRAMES - 1);
+    uint32_t last = Compare_Panel();
+
+    printf("  %u frames: torn %u, last frame mismatch %u, %u DMA, %u bytes\r\n",
+           TEST_FRAMES, torn, last, spi.dma_transfers, (unsigned)spi.data_bytes);
+    // data_bytes 包含每帧 CASET/RASET 的8个参数字节
+    if (torn != 0 || last != 0 || spi.dma_transfers != TEST_FRAMES ||
+        spi.data_bytes != (uint64_t)TEST_FRAMES * (LCD_FRAME_BUFFER_SIZE * 2U + 8U)) {
+        errors++;
+    }
+    if (hlcd_dma.frame_buffer_enabled || LCD_Flip_GetBackBuffer() != NULL || LCD_Flip_BorrowPage(1) == NULL) {
+        errors++;
+    }
+
+    /* 帧缓冲模式下不能进入翻转模式 */
+    LCD_SPI_DMA_EnableFrameBuffer(&hlcd_dma);
+    if (LCD_Flip_Begin(&hlcd_dma) != HAL_BUSY) errors++;
+    LCD_SPI_DMA_DisableFrameBuffer(&hlcd_dma);
+
+    /* 注入DMA错误：下一次翻转报告错误，之后恢复 */
+    LCD_Flip_ResetStats();
+    LCD_Flip_Begin(&hlcd_dma);
+    Draw_Frame(0, 0);
+    HostSPI_FailNextDMA(HAL_SPI_ERROR_DMA);
+    LCD_Flip_Swap(&hlcd_dma);
+    Draw_Frame(1, 0);
+    HAL_StatusTypeDef st_err = LCD_Flip_Swap(&hlcd_dma);
+    Draw_Frame(2, 0);
+    HAL_StatusTypeDef st_ok = LCD_Flip_Swap(&hlcd_dma);
+    HAL_StatusTypeDef st_end = LCD_Flip_End(&hlcd_dma);
+    LCD_Flip_Stats_t stats;
+    LCD_Flip_GetStats(&stats);
+    Expect_Frame(2);
+    uint32_t recovered = Compare_Panel();
+    printf("  DMA error: swap %d, next %d, end %d, errors %u, mismatch after recovery %u\r\n",
+           st_err, st_ok, st_end, stats.errors, recovered);
+    if (st_err != HAL_ERROR || st_ok != HAL_OK || st_end != HAL_OK || stats.errors != 1 || recovered != 0) {
+        errors++;
+    }
+    return errors;
+}
+
+/* ==================== 耗时 ==================== */
+
+static double Run_Flip(uint32_t busy_us, LCD_Flip_Stats_t *stats)
+{
+    LCD_Flip_ResetStats();
+    LCD_Flip_Begin(&hlcd_dma);
+    uint64_t t0 = HostSPI_NowNs();
+    for (uint32_t n = 0; n < TEST_FRAMES; n++) {
+        Draw_Frame(n, busy_us);
+        LCD_Flip_Swap(&hlcd_dma);
+    }
+    double frame_ms = (HostSPI_NowNs() - t0) / 1e6 / TEST_FRAMES;
+    LCD_Flip_End(&hlcd_dma);
+    LCD_Flip_GetStats(stats);
+    return frame_ms;
+}
+
+/* 对照：单帧缓冲，画完后整屏刷新，发送期间不能绘制 */
+static double Run_Single(uint32_t busy_us)
+{
+    LCD_SPI_DMA_EnableFrameBuffer(&hlcd_dma);
+    uint64_t t0 = HostSPI_NowNs();
+    for (uint32_t n = 0; n < TEST_FRAMES; n++) {
+        uint64_t until = HostSPI_NowNs() + (uint64_t)busy_us * 1000U;
+        for (uint32_t i = 0; i < LCD_FRAME_BUFFER_SIZE; i++) {
+            hlcd_dma.frame_buffer[i] = Pattern(n, i);
+        }
+        LCD_FB_MarkAllDirty(&hlcd_dma);
+        while (HostSPI_NowNs() < until) {
+        }
+        LCD_SPI_DMA_FlushFrameBuffer(&hlcd_dma);
+    }
+    double frame_ms = (HostSPI_NowNs() - t0) / 1e6 / TEST_FRAMES;
+    LCD_SPI_DMA_DisableFrameBuffer(&hlcd_dma);
+    return frame_ms;
+}
+
+static uint32_t Test_Timing(void)
+{
+    static const uint32_t busy_us[2] = { 3000, 22000 };     // 绘制时间短于/长于发送时间（约15.4ms）
+    uint32_t errors = 0;
+
+    for (int k = 0; k < 2; k++) {
+        LCD_Flip_Stats_t s;
+        double flip_ms = Run_Flip(busy_us[k], &s);
+        double single_ms = Run_Single(busy_us[k]);
+        double draw = Cycles_Ms(s.draw_cycles_total) / s.frames;
+        double wait = Cycles_Ms(s.wait_cycles_total) / s.frames;
+        double xfer = Cycles_Ms(s.transfer_cycles_total) / s.frames;
+
+        printf("  draw %2u ms: flip frame %.2f ms (draw %.2f, wait %.2f, submit %.3f, transfer %.2f, blocked %u/%u), "
+               "single buffer frame %.2f ms\r\n",
+               busy_us[k] / 1000U, flip_ms, draw, wait, Cycles_Ms(s.submit_cycles), xfer, s.blocked, s.frames, single_ms);
+
+        if (s.frames != TEST_FRAMES || s.errors != 0 || xfer < 14.0 || xfer > 18.0) {
+            errors++;
+        }
+        if (k == 0) {
+            // 发送是瓶颈：除第一帧外每次都等待，帧时间约等于发送时间
+            if (s.blocked < TEST_FRAMES - 1U || flip_ms > xfer * 1.15 || flip_ms > single_ms * 0.9) errors++;
+        } else {
+            // 绘制是瓶颈：不等待，发送完全隐藏在绘制之后
+            if (s.blocked != 0 || wait > 0.5 || flip_ms > draw * 1.1 || flip_ms > single_ms * 0.7) errors++;
+        }
+    }
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors = 0;
+
+    printf("=== Page Flip (host, SPI %u MHz) ===\r\n", TEST_SPI_CLOCK / 1000000U);
+
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+    LCD_Blit_Init();
+
+    errors += Test_Correctness();
+    errors += Test_Timing();
+
+    LCD_SPI_DMA_DeInit(&hlcd_dma);
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,202 @@
+/**
+ ******************************************************************************
+ * @file    host_font_blob.c
+ * @brief   主机端压缩字库测试 - 压缩率、逐行解码正确性、整行文字显示
+ ******************************************************************************
+ * @note
+ *   - 把 lcd_fonts.c 中各尺寸的ASCII+中文字模编码为字库文件，统计大小
+ *   - 每个字符逐行解码后与 LCD_GlyphCache_Expand 展开原点阵的结果比较
+ *   - 用 LCD_FontBlob_DrawText 经模拟SPI/DMA显示一行中英文混排文字，逐像素校验屏幕模型
+ ******************************************************************************
+ */
+
+#include "lcd_font_blob.h"
+#include "lcd_font_index.h"
+#include "lcd_glyph_cache.h"
+#include "host_font_encode.h"
+#include "host_panel.h"
+#include "spi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define DECODE_LOOPS     2000
+
+static LCD_SPI_DMA_V2_Handle_t hlcd_v2;
+static uint16_t pixels[LCD_GLYPH_CACHE_MAX_PIXELS];
+static uint16_t reference[LCD_GLYPH_CACHE_MAX_PIXELS];
+static const uint16_t white_on_black[2] = { 0x0000, 0xFFFF };
+
+/* 与目标板 lcd_spi_dma.c 中的分发一致 */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    LCD_V2_HandleTxCplt(hspi);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    LCD_V2_HandleError(hspi);
+}
+
+/* 用内置的一对ASCII/中文字体生成字库 */
+static uint8_t *Build_Builtin(const pFONT *ascii, const pFONT *ch, uint32_t *size, HostFont_Stats_t *stats)
+{
+    HostFont_t font;
+    uint16_t code;
+
+    HostFont_Init(&font, ch->Height);
+    for (uint16_t c = 0x20; c < 0x7F; c++) {
+        HostFont_Add(&font, c, ascii->Width, &ascii->pTable[(c - 32) * ascii->Sizes]);
+    }
+    for (uint32_t row = 0; row + 1 < ch->Table_Rows; row += 2) {
+        const char *name = (const char *)(ch->pTable + (row + 1) * ch->Sizes);
+        if (name[0] == 0) continue;
+        LCD_FontIndex_Decode(name, &code);
+        HostFont_Add(&font, code, ch->Width, ch->pTable + row * ch->Sizes);
+    }
+    HostFont_AddBox(&font, 0xFFFD, ch->Width);
+
+    uint8_t *blob = HostFont_Build(&font, size, stats);
+    HostFont_Free(&font);
+    return blob;
+}
+
+/* 从内置字体取字符的原始点阵 */
+static const uint8_t *Builtin_Bits(const pFONT *ascii, const pFONT *ch, uint16_t code)
+{
+    if (code < 0x80) {
+        return &ascii->pTable[(code - 32) * ascii->Sizes];
+    }
+    return LCD_FontIndex_Find(ch, code);
+}
+
+/* 每个字符逐行解码，与原点阵展开结果比较 */
+static uint32_t Check_Glyphs(const LCD_FontBlob_t *font, const pFONT *ascii, const pFONT *ch)
+{
+    uint32_t errors = 0;
+
+    for (uint32_t i = 0; i < font->header->count; i++) {
+        const LCD_FontBlob_Entry_t *e = &font->index[i];
+        const uint8_t *bits = Builtin_Bits(ascii, ch, e->code);
+        LCD_FontBlob_Decoder_t dec;
+
+        if (bits == NULL) continue;             // 方框字符
+        LCD_FontBlob_Begin(&dec, font, e);
+        for (uint16_t y = 0; y < font->header->height; y++) {
+            LCD_FontBlob_DecodeRow(&dec, pixels + y * e->width, white_on_black);
+        }
+        LCD_GlyphCache_Expand(reference, bits, e->width, font->header->height, 0xFFFF, 0x0000);
+        if (memcmp(pixels, reference, e->width * font->header->height * sizeof(uint16_t)) != 0) {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+/* 显示一行文字，与逐字展开的参考图比较 */
+static uint32_t Check_DrawText(const LCD_FontBlob_t *font, const pFONT *ascii, const pFONT *ch,
+                               const char *text, uint16_t x0, uint16_t y0)
+{
+    const uint16_t fg = 0xF800, bg = 0x001F;
+    uint32_t errors = 0;
+    uint16_t x = x0, code;
+
+    HostPanel_Reset();
+    if (LCD_FontBlob_DrawText(&hlcd_v2, font, x0, y0, text, fg, bg) != HAL_OK) {
+        return 1;
+    }
+
+    for (const char *p = text; *p; ) {
+        p += LCD_FontIndex_Decode(p, &code);
+        const LCD_FontBlob_Entry_t *e = LCD_FontBlob_Find(font, code);
+        const uint8_t *bits = Builtin_Bits(ascii, ch, e->code);
+
+        if (x + e->width > LCD_WIDTH_V2) break;
+        if (bits == NULL) {                     // 缺字：与方框字符自身的解码结果比较
+            const uint16_t palette[2] = { bg, fg };
+            LCD_FontBlob_Decoder_t dec;
+            LCD_FontBlob_Begin(&dec, font, e);
+            for (uint16_t y = 0; y < font->header->height; y++) {
+                LCD_FontBlob_DecodeRow(&dec, reference + y * e->width, palette);
+            }
+        } else {
+            LCD_GlyphCache_Expand(reference, bits, e->width, font->header->height, fg, bg);
+        }
+        for (uint16_t y = 0; y < font->header->height; y++) {
+            for (uint16_t i = 0; i < e->width; i++) {
+                if (HostPanel_GetPixel(x + i, y0 + y) != reference[y * e->width + i]) errors++;
+            }
+        }
+        x += e->width;
+    }
+    return errors;
+}
+
+int main(void)
+{
+    const pFONT *ascii[] = { &ASCII_Font12, &ASCII_Font16, &ASCII_Font20, &ASCII_Font24, &ASCII_Font32 };
+    const pFONT *ch[]    = { &CH_Font12, &CH_Font16, &CH_Font20, &CH_Font24, &CH_Font32 };
+    const char *text = "反客科技 STM32 刷屏测试";
+    uint32_t errors = 0;
+
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_V2_Init(&hlcd_v2, &hspi4, LCD_TRANSFER_DMA_ASYNC);
+
+    printf("=== LCD Compressed Font Blob (host) ===\r\n");
+
+    for (int s = 0; s < 5; s++) {
+        HostFont_Stats_t stats;
+        LCD_FontBlob_t font;
+        uint32_t size;
+        uint8_t *blob = Build_Builtin(ascii[s], ch[s], &size, &stats);
+
+        if (LCD_FontBlob_Open(&font, blob) != HAL_OK) {
+            printf("  open failed\r\n");
+            return 1;
+        }
+        uint32_t glyph_err = Check_Glyphs(&font, ascii[s], ch[s]);
+        uint32_t draw_err = Check_DrawText(&font, ascii[s], ch[s], text, 3, 100);
+
+        /* 解码速度：整个字库逐行解码 */
+        uint64_t t0 = HostSPI_NowNs();
+        for (int loop = 0; loop < DECODE_LOOPS; loop++) {
+            for (uint32_t i = 0; i < font.header->count; i++) {
+                LCD_FontBlob_Decoder_t dec;
+                LCD_FontBlob_Begin(&dec, &font, &font.index[i]);
+                for (uint16_t y = 0; y < font.header->height; y++) {
+                    LCD_FontBlob_DecodeRow(&dec, pixels, white_on_black);
+                }
+            }
+        }
+        double ns = (double)(HostSPI_NowNs() - t0) / ((double)DECODE_LOOPS * font.header->count);
+
+        printf("  %2ux%-2u %3u glyphs  bitmap %5u B -> data %5u B (%5.1f%%, %3u RLE)  blob %5u B  "
+               "decode %5.0f ns/glyph  mismatch %u/%u\r\n",
+               ch[s]->Width, ch[s]->Height, font.header->count, stats.raw_bytes, stats.data_bytes,
+               100.0 * stats.data_bytes / stats.raw_bytes, stats.rle_glyphs, size, ns, glyph_err, draw_err);
+        errors += glyph_err + draw_err;
+        free(blob);
+    }
+
+    /* 缺字显示方框，而不是跳过或读错地址 */
+    {
+        HostFont_Stats_t stats;
+        LCD_FontBlob_t font;
+        uint32_t size;
+        uint8_t *blob = Build_Builtin(&ASCII_Font24, &CH_Font24, &size, &stats);
+
+        LCD_FontBlob_Open(&font, blob);
+        uint32_t err = Check_DrawText(&font, &ASCII_Font24, &CH_Font24, "A缺B", 0, 0);
+        if (LCD_FontBlob_Find(&font, 0x7F3A)->code != 0xFFFD) err++;
+        printf("  missing glyph -> U+FFFD box, mismatch %u\r\n", err);
+        errors += err;
+        free(blob);
+    }
+
+    LCD_V2_DeInit(&hlcd_v2);
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,201 @@
+/**
+ ******************************************************************************
+ * @file    host_font_index.c
+ * @brief   主机端中文字模索引测试 - 3500字字库的查找速度与正确性
+ ******************************************************************************
+ * @note
+ *   - 按 lcd_fonts.c 的格式（字模行 + 汉字索引行）生成3500个汉字的2424字库
+ *   - 对比原 LCD_DisplayChinese 的逐行比较与排序索引的每秒查找次数
+ *   - 原实现只比较UTF-8编码的前两个字节，同一区段的汉字会被认错，这里一并统计
+ ******************************************************************************
+ */
+
+#include "lcd_font_index.h"
+#include "host_spi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHAR_COUNT      3500
+#define GLYPH_SIZES     72              // 2424字体
+#define SCAN_QUERIES    20000
+#define INDEX_QUERIES   2000000
+#define MISS_PERCENT    5               // 查询中字库没有的汉字所占比例
+
+static uint8_t *table;
+static pFONT font3500;
+static uint16_t codes[CHAR_COUNT];
+static LCD_FontIndex_Entry_t entries[CHAR_COUNT];
+
+typedef struct {
+    char text[4];
+    uint16_t code;
+    int32_t row;                        // 期望的行号，-1表示字库中没有
+} Query_t;
+
+static Query_t *queries;
+static volatile uintptr_t sink;
+
+static void Encode_Utf8(uint16_t cp, char *out)
+{
+    out[0] = 0xE0 | (cp >> 12);
+    out[1] = 0x80 | ((cp >> 6) & 0x3F);
+    out[2] = 0x80 | (cp & 0x3F);
+    out[3] = 0;
+}
+
+/* 原 LCD_DisplayChinese 中的查找循环（补上了找不到时的返回值） */
+static int32_t Legacy_Scan(const pFONT *font, const char *pText)
+{
+    uint16_t i = 0;
+
+    while (1) {
+        if (*(font->pTable + (i + 1) * font->Sizes + 0) == (uint8_t)*pText &&
+            *(font->pTable + (i + 1) * font->Sizes + 1) == (uint8_t)*(pText + 1)) {
+            return i;
+        }
+        i += 2;
+        if (i >= font->Table_Rows) return -1;
+    }
+}
+
+static void Build_Font(void)
+{
+    table = calloc((size_t)CHAR_COUNT * 2, GLYPH_SIZES);
+
+    /* U+4E00..U+9FA5 中间隔取3500个汉字，步长与区间长度互质，保证不重复且分散 */
+    for (uint32_t i = 0; i < CHAR_COUNT; i++) {
+        uint8_t *glyph = table + (i * 2) * GLYPH_SIZES;
+        char *name = (char *)(table + (i * 2 + 1) * GLYPH_SIZES);
+
+        codes[i] = 0x4E00 + (i * 5) % (0x9FA5 - 0x4E00 + 1);
+        glyph[0] = i & 0xFF;            // 字模内容记录序号，用于校验找到的字模
+        glyph[1] = i >> 8;
+        Encode_Utf8(codes[i], name);
+    }
+    font3500 = (pFONT){ table, 24, 24, GLYPH_SIZES, CHAR_COUNT * 2 };
+}
+
+static void Build_Queries(uint32_t count)
+{
+    uint32_t seed = 12345;
+
+    queries = malloc(sizeof(Query_t) * count);
+    for (uint32_t q = 0; q < count; q++) {
+        seed = seed * 1103515245U + 12345U;
+        if ((seed >> 16) % 100 < MISS_PERCENT) {
+            queries[q].code = 0x3400 + (seed >> 8) % 0x100;     // 扩展A区，不在字库中
+            queries[q].row = -1;
+        } else {
+            uint32_t i = (seed >> 8) % CHAR_COUNT;
+            queries[q].code = codes[i];
+            queries[q].row = i * 2;
+        }
+        Encode_Utf8(queries[q].code, queries[q].text);
+    }
+}
+
+/* 内置字体：每个汉字都能通过索引找到，且与逐行比较的结果一致 */
+static uint32_t Check_Builtin(void)
+{
+    const pFONT *fonts[] = { &CH_Font12, &CH_Font16, &CH_Font20, &CH_Font24, &CH_Font32 };
+    uint32_t errors = 0, chars = 0;
+    uint16_t code;
+
+    for (int f = 0; f < 5; f++) {
+        const pFONT *font = fonts[f];
+
+        for (uint32_t row = 0; row + 1 < font->Table_Rows; row += 2) {
+            const char *name = (const char *)(font->pTable + (row + 1) * font->Sizes);
+            if (name[0] == 0) continue;
+
+            LCD_FontIndex_Decode(name, &code);
+            int32_t expect = LCD_FontIndex_Scan(font, code);
+            if (LCD_FontIndex_Find(font, code) != font->pTable + expect * font->Sizes) {
+                errors++;
+            }
+            chars++;
+        }
+        if (LCD_FontIndex_Find(font, 0x3400) != NULL || LCD_FontIndex_Fallback(font) == NULL) {
+            errors++;
+        }
+    }
+    printf("  builtin fonts: %u chars checked, %u errors\r\n", chars, errors);
+    return errors;
+}
+
+static uint32_t Check_Decode(void)
+{
+    const char *text = "反客A科技";
+    const uint8_t expect_len[] = { 3, 3, 1, 3, 3 };
+    const uint16_t expect_code[] = { 0x53CD, 0x5BA2, 'A', 0x79D1, 0x6280 };
+    uint32_t errors = 0;
+    uint16_t code;
+
+    for (int i = 0; *text; i++) {
+        uint8_t len = LCD_FontIndex_Decode(text, &code);
+        if (len != expect_len[i] || code != expect_code[i]) errors++;
+        text += len;
+    }
+    /* 被截断的编码只跳过一个字节，不越过字符串结尾 */
+    if (LCD_FontIndex_Decode("\xE5\x8F", &code) != 1 || code != 0) errors++;
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors = 0, legacy_wrong = 0;
+    uint64_t t0;
+
+    printf("=== LCD Chinese Font Index (host, %d chars, 2424) ===\r\n", CHAR_COUNT);
+
+    errors += Check_Decode();
+    errors += Check_Builtin();
+
+    Build_Font();
+    Build_Queries(INDEX_QUERIES);
+
+    t0 = HostSPI_NowNs();
+    if (LCD_FontIndex_Register(&font3500, entries, CHAR_COUNT) != HAL_OK) {
+        printf("register failed\r\n");
+        return 1;
+    }
+    printf("  index build      %8.2f ms (%u bytes)\r\n",
+           (HostSPI_NowNs() - t0) / 1e6, (unsigned)sizeof(entries));
+
+    /* 原逐行比较 */
+    t0 = HostSPI_NowNs();
+    for (uint32_t q = 0; q < SCAN_QUERIES; q++) {
+        int32_t row = Legacy_Scan(&font3500, queries[q].text);
+        if (row != queries[q].row) legacy_wrong++;
+        sink += row;
+    }
+    double scan_ns = (double)(HostSPI_NowNs() - t0) / SCAN_QUERIES;
+
+    /* 排序索引 */
+    t0 = HostSPI_NowNs();
+    for (uint32_t q = 0; q < INDEX_QUERIES; q++) {
+        sink += (uintptr_t)LCD_FontIndex_Find(&font3500, queries[q].code);
+    }
+    double index_ns = (double)(HostSPI_NowNs() - t0) / INDEX_QUERIES;
+
+    for (uint32_t q = 0; q < INDEX_QUERIES; q++) {
+        const uint8_t *glyph = LCD_FontIndex_Find(&font3500, queries[q].code);
+        if (queries[q].row < 0) {
+            if (glyph != NULL) errors++;
+        } else if (glyph != table + queries[q].row * GLYPH_SIZES ||
+                   (glyph[0] | glyph[1] << 8) != queries[q].row / 2) {
+            errors++;
+        }
+    }
+
+    printf("  linear scan      %8.1f ns/lookup  %10.0f lookups/s  (%u/%u wrong: 2-byte UTF-8 prefix match)\r\n",
+           scan_ns, 1e9 / scan_ns, legacy_wrong, SCAN_QUERIES);
+    printf("  sorted index     %8.1f ns/lookup  %10.0f lookups/s\r\n", index_ns, 1e9 / index_ns);
+    printf("  speedup %.0fx, index errors %u\r\n", scan_ns / index_ns, errors);
+
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    free(queries);
+    free(table);
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,279 @@
+/**
+ ******************************************************************************
+ * @file    host_isr_event.c
+ * @brief   主机端中断事件环测试 - 无锁队列并发正确性、事件任务汇总与中断处理时间
+ ******************************************************************************
+ * @note
+ *   - 并发：生产者线程（代替中断）与消费者线程（代替事件任务）同时读写同一环形队列，
+ *     校验序号连续、记录完整、取出数 + 丢弃数 = 写入数
+ *   - 事件任务：LCD_DMA_Clear 每块一个 SPI4 完成事件，注入DMA错误后带回 ErrorCode
+ *   - 中断处理时间：模拟器的"SPI4_IRQHandler"按 ISR_MEASURE 计时；
+ *     对比原完成回调中 HAL_UART_Transmit(".") 与只写事件环的新回调
+ *     （主机的 HAL_UART_Transmit 按 115200 波特率忙等）
+ ******************************************************************************
+ */
+
+#include "isr_event.h"
+#include "lcd_spi_dma.h"
+#include "host_panel.h"
+#include "spi.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define STRESS_EVENTS    500000U
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+/* ==================== 并发测试 ==================== */
+
+static ISR_EventRing_t stress_ring;
+static volatile bool producer_done;
+static bool retry_when_full;
+
+typedef struct {
+    uint32_t popped;
+    uint32_t out_of_order;
+    uint32_t corrupt;
+    uint32_t gaps;
+} Consumer_Result_t;
+
+/* 记录内容由序号推出，消费者据此检查记录是否被撕裂 */
+static uint32_t Stress_Check(uint32_t seq)
+{
+    return seq * 2654435761U;
+}
+
+static void *Producer_Thread(void *arg)
+{
+    uint32_t *produced = arg;
+    ISR_Event_t evt;
+
+    for (uint32_t seq = 0; seq < STRESS_EVENTS; seq++) {
+        evt.type = (uint8_t)(ISR_EVT_DMA_DONE + seq % 3U);
+        evt.source = (uint8_t)(seq % ISR_SRC_COUNT);
+        evt.reserved = (uint16_t)seq;
+        evt.arg = seq;
+        evt.cycles = Stress_Check(seq);
+        while (!ISR_EventRing_Push(&stress_ring, &evt) && retry_when_full) {
+            stress_ring.dropped--;      // 重试模式：不计丢弃
+            sched_yield();
+        }
+    }
+    *produced = STRESS_EVENTS;
+    producer_done = true;
+    return NULL;
+}
+
+static void *Consumer_Thread(void *arg)
+{
+    Consumer_Result_t *r = arg;
+    ISR_Event_t evt;
+    uint32_t expect = 0;
+
+    for (;;) {
+        if (!ISR_EventRing_Pop(&stress_ring, &evt)) {
+            if (producer_done && ISR_EventRing_Count(&stress_ring) == 0U) {
+                break;
+            }
+            sched_yield();
+            continue;
+        }
+        r->popped++;
+        if (evt.arg < expect) {
+            r->out_of_order++;
+        } else if (evt.arg > expect) {
+            r->gaps++;                  // 队列满时丢弃的事件
+        }
+        expect = evt.arg + 1U;
+        if (evt.cycles != Stress_Check(evt.arg) || evt.reserved != (uint16_t)evt.arg ||
+            evt.type != ISR_EVT_DMA_DONE + evt.arg % 3U || evt.source != evt.arg % ISR_SRC_COUNT) {
+            r->corrupt++;
+        }
+    }
+    return NULL;
+}
+
+static uint32_t Run_Stress(bool retry)
+{
+    pthread_t prod, cons;
+    uint32_t produced = 0;
+    Consumer_Result_t r;
+
+    memset(&r, 0, sizeof(r));
+    ISR_EventRing_Init(&stress_ring);
+    producer_done = false;
+    retry_when_full = retry;
+
+    pthread_create(&cons, NULL, Consumer_Thread, &r);
+    pthread_create(&prod, NULL, Producer_Thread, &produced);
+    pthread_join(prod, NULL);
+    pthread_join(cons, NULL);
+
+    printf("  %-13s : produced %u, popped %u, dropped %u, gaps %u, out of order %u, corrupt %u\r\n",
+           retry ? "stress retry" : "stress drop", produced, r.popped, stress_ring.dropped,
+           r.gaps, r.out_of_order, r.corrupt);
+
+    uint32_t errors = 0;
+    if (r.popped + stress_ring.dropped != produced || r.out_of_order != 0 || r.corrupt != 0) {
+        errors++;
+    }
+    if (retry && (r.popped != produced || r.gaps != 0)) {
+        errors++;
+    }
+    return errors;
+}
+
+static uint32_t Test_Ring(void)
+{
+    uint32_t errors = 0;
+    ISR_Event_t evt = { ISR_EVT_DMA_DONE, ISR_SRC_SPI4_TX, 0, 0, 0 };
+
+    /* 满/空边界 */
+    ISR_EventRing_Init(&stress_ring);
+    for (uint32_t i = 0; i < ISR_EVENT_RING_SIZE; i++) {
+        evt.arg = i;
+        if (!ISR_EventRing_Push(&stress_ring, &evt)) errors++;
+    }
+    evt.arg = 0xFFFF;
+    if (ISR_EventRing_Push(&stress_ring, &evt) || stress_ring.dropped != 1 ||
+        ISR_EventRing_Count(&stress_ring) != ISR_EVENT_RING_SIZE) {
+        errors++;
+    }
+    for (uint32_t i = 0; i < ISR_EVENT_RING_SIZE; i++) {
+        if (!ISR_EventRing_Pop(&stress_ring, &evt) || evt.arg != i) errors++;
+    }
+    if (ISR_EventRing_Pop(&stress_ring, &evt)) {
+        errors++;
+    }
+    printf("  ring bounds   : %s\r\n", errors == 0 ? "ok" : "FAILED");
+
+    errors += Run_Stress(false);
+    errors += Run_Stress(true);
+    return errors;
+}
+
+/* ==================== 事件任务与中断处理时间 ==================== */
+
+static volatile uint32_t hook_calls;
+
+static void Count_Hook(const ISR_Event_t *evt)
+{
+    (void)evt;
+    hook_calls++;
+}
+
+/* 原 LCD_SPI_DMA_TxCpltCallback 中的完成标记 */
+static void Legacy_Dot(void)
+{
+    extern UART_HandleTypeDef huart1;
+    HAL_UART_Transmit(&huart1, (uint8_t*)".", 1, 10);
+}
+
+/* 等事件任务取空队列 */
+static void Drain(void)
+{
+    ISR_Event_Stats_t s;
+    uint32_t last = 0xFFFFFFFFU;
+
+    for (;;) {
+        osDelay(5);
+        ISR_Event_GetStats(&s);
+        if (s.drained == last) {
+            break;
+        }
+        last = s.drained;
+    }
+}
+
+static void Isr_Time(const ISR_Event_Stats_t *s, double *avg_us, double *max_us)
+{
+    const ISR_Event_SourceStats_t *src = &s->source[ISR_SRC_SPI4_IRQ];
+    double cycles_per_us = SystemCoreClock / 1e6;
+
+    *avg_us = src->isr_count ? (double)src->isr_cycles_total / src->isr_count / cycles_per_us : 0.0;
+    *max_us = src->isr_cycles_max / cycles_per_us;
+}
+
+static uint32_t Test_Worker(void)
+{
+    uint32_t errors = 0;
+    uint32_t chunks = (LCD_WIDTH * LCD_HEIGHT + LCD_DMA_BUFFER_SIZE - 1) / LCD_DMA_BUFFER_SIZE;
+    ISR_Event_Stats_t s;
+    double new_avg, new_max, old_avg, old_max;
+
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+    LCD_DMA_Clear(&hlcd_dma, 0x0000);       // 预热：事件任务启动前的事件只进队列
+
+    if (ISR_Event_Start() != HAL_OK) {
+        return 1;
+    }
+    ISR_Event_SetHook(Count_Hook);
+    Drain();
+    ISR_Event_ResetStats();
+    hook_calls = 0;
+
+    /* 新回调：只写事件环 */
+    LCD_DMA_Clear(&hlcd_dma, 0x07E0);
+    Drain();
+    ISR_Event_GetStats(&s);
+    Isr_Time(&s, &new_avg, &new_max);
+    printf("  worker        : SPI4 done %u (chunks %u), isr samples %u, drained %u, hook %u, dropped %u\r\n",
+           s.source[ISR_SRC_SPI4_TX].done, chunks, s.source[ISR_SRC_SPI4_IRQ].isr_count,
+           s.drained, hook_calls, s.dropped);
+    if (s.source[ISR_SRC_SPI4_TX].done != chunks || s.source[ISR_SRC_SPI4_IRQ].isr_count != chunks ||
+        s.drained != 2U * chunks || hook_calls != s.drained || s.dropped != 0 ||
+        HostPanel_GetPixel(LCD_WIDTH - 1, LCD_HEIGHT - 1) != 0x07E0) {
+        errors++;
+    }
+
+    /* 错误事件 */
+    static uint16_t line[LCD_WIDTH];
+    LCD_SPI_DMA_SetWindow(&hlcd_dma, 0, 0, LCD_WIDTH, 1);
+    HostSPI_FailNextDMA(HAL_SPI_ERROR_DMA);
+    LCD_SPI_DMA_WriteBuffer(&hlcd_dma, line, LCD_WIDTH);
+    Drain();
+    ISR_Event_GetStats(&s);
+    printf("  error event   : errors %u, last 0x%08X\r\n",
+           s.source[ISR_SRC_SPI4_TX].errors, s.source[ISR_SRC_SPI4_TX].last_error);
+    if (s.source[ISR_SRC_SPI4_TX].errors != 1 || s.source[ISR_SRC_SPI4_TX].last_error != HAL_SPI_ERROR_DMA) {
+        errors++;
+    }
+
+    /* 原回调：中断里阻塞打印一个字符 */
+    ISR_Event_ResetStats();
+    hlcd_dma.tc_callback = Legacy_Dot;
+    LCD_DMA_Clear(&hlcd_dma, 0x001F);
+    hlcd_dma.tc_callback = NULL;
+    printf("\r\n");
+    Drain();
+    ISR_Event_GetStats(&s);
+    Isr_Time(&s, &old_avg, &old_max);
+
+    printf("  SPI4 IRQ time : UART \".\" in callback avg %6.1f us max %6.1f us\r\n", old_avg, old_max);
+    printf("                  event ring only     avg %6.1f us max %6.1f us\r\n", new_avg, new_max);
+    if (s.source[ISR_SRC_SPI4_IRQ].isr_count != chunks || new_avg * 4.0 > old_avg) {
+        errors++;
+    }
+
+    LCD_SPI_DMA_DeInit(&hlcd_dma);
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors = 0;
+
+    printf("=== ISR Event Ring (host) ===\r\n");
+
+    errors += Test_Ring();
+    errors += Test_Worker();
+
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
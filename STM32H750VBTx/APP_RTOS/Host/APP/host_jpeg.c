@@ -0,0 +1,329 @@
+/**
+ ******************************************************************************
+ * @file    host_jpeg.c
+ * @brief   主机端JPEG图片测试 - 压缩率、软件解码正确性、逐行带经DMA双缓冲显示
+ ******************************************************************************
+ * @note
+ *   - 用 host_jpeg_encode.c 把测试图按各种采样方式、质量、复位间隔和非MCU整数倍的尺寸编码，
+ *     统计文件大小，解码后与原图比较PSNR，并检查目标缓冲区中图片之外的像素不被改写
+ *   - CMake 找到 libjpeg 时，用 libjpeg（islow反DCT、不做平滑上采样）解码同一文件，
+ *     截取为RGB565后要求逐像素一致
+ *   - LCD_JPEG_Draw 直接模式与帧缓冲模式显示到模拟屏幕，与 LCD_JPEG_Decode 的结果比较；
+ *     对比整屏原始RGB565图片经 LCD_DMA_DrawImage 发送与JPEG逐行带解码发送的耗时
+ *   - 主机上只有软件解码器，硬件JPEG后端在开发板上用 LCD_V2_JPEG_Test() 比较
+ ******************************************************************************
+ */
+
+#include "lcd_jpeg.h"
+#include "lcd_spi_dma.h"
+#include "host_jpeg_encode.h"
+#include "host_panel.h"
+#include "host_spi.h"
+#include "spi.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HOST_JPEG_LIBJPEG
+#include <jpeglib.h>
+#endif
+
+#define TEST_SPI_CLOCK   60000000U
+#define TIMING_ROUNDS    20
+#define SENTINEL         0xA5A5U
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+static uint8_t src_rgb[LCD_WIDTH * LCD_HEIGHT * 3];
+static uint16_t out_buf[LCD_WIDTH * (LCD_HEIGHT + 1)];
+static uint16_t ref_buf[LCD_WIDTH * LCD_HEIGHT];
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    int quality;
+    LCD_JPEG_Subsampling_t sub;
+    uint16_t restart;
+} Case_t;
+
+static const Case_t cases[] = {
+    { 240, 240, 75, LCD_JPEG_420,  0 },
+    { 240, 240, 75, LCD_JPEG_422,  0 },
+    { 240, 240, 90, LCD_JPEG_444,  0 },
+    { 240, 240, 75, LCD_JPEG_GRAY, 0 },
+    { 240, 240, 50, LCD_JPEG_420,  0 },
+    {  83,  61, 60, LCD_JPEG_420,  5 },
+    { 101,  37, 85, LCD_JPEG_422,  3 },
+    {  17,  29, 95, LCD_JPEG_444,  1 },
+};
+
+static const char *sub_names[] = { "gray", "4:4:4", "4:2:2", "4:2:0" };
+
+/* 测试图左上角 w x h 区域 */
+static void Crop(uint8_t *dst, uint16_t w, uint16_t h)
+{
+    for (uint16_t y = 0; y < h; y++) {
+        memcpy(&dst[y * w * 3], &src_rgb[y * LCD_WIDTH * 3], w * 3U);
+    }
+}
+
+static double PSNR(const uint8_t *rgb, const uint16_t *img, uint16_t stride, uint16_t w, uint16_t h, bool gray)
+{
+    double se = 0;
+
+    for (uint16_t y = 0; y < h; y++) {
+        for (uint16_t x = 0; x < w; x++) {
+            const uint8_t *p = &rgb[(y * w + x) * 3];
+            uint16_t c = img[y * stride + x];
+            double r = (c >> 11) << 3, g = ((c >> 5) & 0x3F) << 2, b = (c & 0x1F) << 3;
+            double sr = p[0], sg = p[1], sb = p[2];
+            if (gray) {
+                sr = sg = sb = 0.299 * p[0] + 0.587 * p[1] + 0.114 * p[2];
+            }
+            se += (r - sr) * (r - sr) + (g - sg) * (g - sg) + (b - sb) * (b - sb);
+        }
+    }
+    se /= 3.0 * w * h;
+    return se > 0 ? 10.0 * log10(255.0 * 255.0 / se) : 99.0;
+}
+
+#ifdef HOST_JPEG_LIBJPEG
+/* libjpeg 解码为RGB888后截取为RGB565，返回与 img 不同的像素数 */
+static uint32_t Compare_Libjpeg(const uint8_t *jpeg, uint32_t size, const uint16_t *img, uint16_t stride)
+{
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    uint32_t mismatch = 0;
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, jpeg, size);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.dct_method = JDCT_ISLOW;
+    cinfo.do_fancy_upsampling = FALSE;
+    jpeg_start_decompress(&cinfo);
+
+    uint8_t *row = malloc(cinfo.output_width * 3U);
+    while (cinfo.output_scanline < cinfo.output_height) {
+        uint32_t y = cinfo.output_scanline;
+        jpeg_read_scanlines(&cinfo, &row, 1);
+        for (uint32_t x = 0; x < cinfo.output_width; x++) {
+            uint16_t c = (uint16_t)(((row[x * 3] & 0xF8) << 8) | ((row[x * 3 + 1] & 0xFC) << 3) | (row[x * 3 + 2] >> 3));
+            if (c != img[y * stride + x]) mismatch++;
+        }
+    }
+    free(row);
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    return mismatch;
+}
+#endif
+
+/* ==================== 编解码 ==================== */
+
+static uint32_t Test_Codec(void)
+{
+    uint32_t errors = 0;
+    static uint8_t crop[LCD_WIDTH * LCD_HEIGHT * 3];
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const Case_t *tc = &cases[i];
+        LCD_JPEG_Info_t info;
+        uint32_t size, outside = 0, lib = 0;
+        bool gray = (tc->sub == LCD_JPEG_GRAY);
+
+        Crop(crop, tc->width, tc->height);
+        uint8_t *jpeg = HostJPEG_Encode(crop, tc->width, tc->height, tc->quality, tc->sub, tc->restart, &size);
+
+        if (LCD_JPEG_GetInfo(jpeg, size, &info) != HAL_OK || info.width != tc->width ||
+            info.height != tc->height || info.subsampling != tc->sub || info.restart_interval != tc->restart) {
+            printf("  %3ux%-3u %s: GetInfo FAILED\r\n", tc->width, tc->height, sub_names[tc->sub]);
+            errors++;
+            free(jpeg);
+            continue;
+        }
+
+        /* 目标 stride 比图片宽，检查图片之外不被改写 */
+        for (uint32_t p = 0; p < sizeof(out_buf) / sizeof(out_buf[0]); p++) out_buf[p] = SENTINEL;
+        HAL_StatusTypeDef st = LCD_JPEG_Decode(jpeg, size, out_buf, LCD_WIDTH);
+        for (uint32_t y = 0; y < LCD_HEIGHT + 1U; y++) {
+            for (uint32_t x = 0; x < LCD_WIDTH; x++) {
+                if ((x >= tc->width || y >= tc->height) && out_buf[y * LCD_WIDTH + x] != SENTINEL) outside++;
+            }
+        }
+        double psnr = PSNR(crop, out_buf, LCD_WIDTH, tc->width, tc->height, gray);
+#ifdef HOST_JPEG_LIBJPEG
+        lib = Compare_Libjpeg(jpeg, size, out_buf, LCD_WIDTH);
+#endif
+
+        printf("  %3ux%-3u %-5s q%-3d ri %u: %6u bytes (%5.1f%% of RGB565), PSNR %.1f dB, outside %u",
+               tc->width, tc->height, sub_names[tc->sub], tc->quality, tc->restart, size,
+               100.0 * size / (tc->width * tc->height * 2.0), psnr, outside);
+#ifdef HOST_JPEG_LIBJPEG
+        printf(", libjpeg mismatch %u", lib);
+#endif
+        printf("\r\n");
+
+        if (st != HAL_OK || outside != 0 || lib != 0 || psnr < 28.0) {
+            errors++;
+        }
+        /* 整屏照片 4:2:0 质量75 不超过20KB */
+        if (i == 0 && size > 20480U) {
+            errors++;
+        }
+        free(jpeg);
+    }
+    return errors;
+}
+
+/* 不支持或损坏的文件返回错误，不越界 */
+static uint32_t Test_Errors(void)
+{
+    uint32_t errors = 0, size;
+    LCD_JPEG_Info_t info;
+    uint8_t *jpeg = HostJPEG_Encode(src_rgb, LCD_WIDTH, LCD_HEIGHT, 75, LCD_JPEG_420, 0, &size);
+    uint8_t *copy = malloc(size);
+
+    /* 改为渐进式 */
+    memcpy(copy, jpeg, size);
+    for (uint32_t i = 2; i + 1 < size; i++) {
+        if (copy[i] == 0xFF && copy[i + 1] == 0xC0) {
+            copy[i + 1] = 0xC2;
+            break;
+        }
+    }
+    if (LCD_JPEG_GetInfo(copy, size, &info) != HAL_ERROR) errors++;
+
+    /* 截断文件头、截断数据、数据被改写：只要求不崩溃、不越界 */
+    if (LCD_JPEG_GetInfo(jpeg, 100, &info) != HAL_ERROR) errors++;
+    LCD_JPEG_Decode(jpeg, size / 2, out_buf, LCD_WIDTH);
+    memcpy(copy, jpeg, size);
+    for (uint32_t i = size / 3; i < size / 3 + 64; i++) copy[i] ^= 0x5A;
+    LCD_JPEG_Decode(copy, size, out_buf, LCD_WIDTH);
+
+    /* 超出屏幕 */
+    if (LCD_JPEG_Draw(&hlcd_dma, 1, 0, jpeg, size) != HAL_ERROR) errors++;
+
+    printf("  bad input     : %s\r\n", errors == 0 ? "ok" : "FAILED");
+    free(copy);
+    free(jpeg);
+    return errors;
+}
+
+/* ==================== 显示 ==================== */
+
+static uint32_t Compare_Panel(const uint16_t *img, uint16_t stride, uint16_t x0, uint16_t y0, uint16_t w, uint16_t h)
+{
+    uint32_t mismatch = 0;
+    for (uint16_t y = 0; y < h; y++) {
+        for (uint16_t x = 0; x < w; x++) {
+            if (HostPanel_GetPixel(x0 + x, y0 + y) != img[y * stride + x]) mismatch++;
+        }
+    }
+    return mismatch;
+}
+
+static double Elapsed_Ms(uint64_t t0, uint32_t rounds)
+{
+    return (HostSPI_NowNs() - t0) / 1e6 / rounds;
+}
+
+static uint32_t Test_Draw(void)
+{
+    uint32_t errors = 0, size, small_size, m_direct, m_small, m_fb;
+    uint8_t *jpeg = HostJPEG_Encode(src_rgb, LCD_WIDTH, LCD_HEIGHT, 75, LCD_JPEG_420, 0, &size);
+    static uint8_t crop[83 * 61 * 3];
+    static uint16_t small_ref[83 * 61];
+    LCD_JPEG_Stats_t stats;
+
+    Crop(crop, 83, 61);
+    uint8_t *small = HostJPEG_Encode(crop, 83, 61, 80, LCD_JPEG_422, 4, &small_size);
+    LCD_JPEG_Decode(jpeg, size, ref_buf, LCD_WIDTH);
+    LCD_JPEG_Decode(small, small_size, small_ref, 83);
+
+    /* 直接模式：整屏与屏幕中间的小图 */
+    LCD_DMA_Clear(&hlcd_dma, 0x0000);
+    HostSPI_ResetStats();
+    LCD_JPEG_ResetStats();
+    if (LCD_JPEG_Draw(&hlcd_dma, 0, 0, jpeg, size) != HAL_OK) errors++;
+    m_direct = Compare_Panel(ref_buf, LCD_WIDTH, 0, 0, LCD_WIDTH, LCD_HEIGHT);
+    HostSPI_Stats_t spi;
+    HostSPI_GetStats(&spi);
+    if (LCD_JPEG_Draw(&hlcd_dma, 150, 170, small, small_size) != HAL_OK) errors++;
+    m_small = Compare_Panel(small_ref, 83, 150, 170, 83, 61);
+    LCD_JPEG_GetStats(&stats);
+
+    /* 帧缓冲模式 */
+    LCD_SPI_DMA_EnableFrameBuffer(&hlcd_dma);
+    LCD_FB_Clear(&hlcd_dma, 0x0000);
+    LCD_JPEG_Draw(&hlcd_dma, 0, 0, jpeg, size);
+    LCD_JPEG_Draw(&hlcd_dma, 150, 170, small, small_size);
+    LCD_SPI_DMA_FlushFrameBuffer(&hlcd_dma);
+    for (uint16_t y = 0; y < 61; y++) {
+        memcpy(&ref_buf[(170 + y) * LCD_WIDTH + 150], &small_ref[y * 83], 83 * sizeof(uint16_t));
+    }
+    m_fb = Compare_Panel(ref_buf, LCD_WIDTH, 0, 0, LCD_WIDTH, LCD_HEIGHT);
+    LCD_SPI_DMA_DisableFrameBuffer(&hlcd_dma);
+
+    printf("  draw direct   : 240x240 mismatch %u (%u bytes on SPI, %u DMA), 83x61 at (150,170) mismatch %u, images %u mcus %u\r\n",
+           m_direct, (unsigned)spi.data_bytes, (unsigned)spi.dma_transfers, m_small, stats.images, stats.mcus);
+    printf("  draw FB       : mismatch %u\r\n", m_fb);
+    if (m_direct != 0 || m_small != 0 || m_fb != 0 || stats.images != 2 || stats.errors != 0 ||
+        spi.data_bytes < LCD_WIDTH * LCD_HEIGHT * 2U) {
+        errors++;
+    }
+
+    /* 耗时：只解码、原始RGB565经DMA双缓冲发送、JPEG逐行带解码发送 */
+    uint64_t t0 = HostSPI_NowNs();
+    for (int i = 0; i < TIMING_ROUNDS; i++) LCD_JPEG_Decode(jpeg, size, out_buf, LCD_WIDTH);
+    double t_decode = Elapsed_Ms(t0, TIMING_ROUNDS);
+
+    t0 = HostSPI_NowNs();
+    for (int i = 0; i < TIMING_ROUNDS; i++) LCD_DMA_DrawImage(&hlcd_dma, 0, 0, LCD_WIDTH, LCD_HEIGHT, ref_buf);
+    double t_raw = Elapsed_Ms(t0, TIMING_ROUNDS);
+
+    t0 = HostSPI_NowNs();
+    for (int i = 0; i < TIMING_ROUNDS; i++) LCD_JPEG_Draw(&hlcd_dma, 0, 0, jpeg, size);
+    double t_jpeg = Elapsed_Ms(t0, TIMING_ROUNDS);
+
+    printf("  full screen   : raw %u bytes, JPEG %u bytes (%.1fx smaller)\r\n",
+           LCD_WIDTH * LCD_HEIGHT * 2U, size, LCD_WIDTH * LCD_HEIGHT * 2.0 / size);
+    printf("  time per frame: decode only %.2f ms, raw DrawImage %.2f ms, JPEG Draw %.2f ms (SPI %u Hz)\r\n",
+           t_decode, t_raw, t_jpeg, TEST_SPI_CLOCK);
+    /* 解码与SPI发送重叠：总时间小于两者相加 */
+    if (t_jpeg > (t_raw + t_decode) * 1.1 + 1.0) {
+        errors++;
+    }
+
+    free(small);
+    free(jpeg);
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors = 0;
+
+    printf("=== JPEG Image (host) ===\r\n");
+#ifndef HOST_JPEG_LIBJPEG
+    printf("  (built without libjpeg, cross-check skipped)\r\n");
+#endif
+
+    HostJPEG_TestImage(src_rgb, LCD_WIDTH, LCD_HEIGHT);
+    LCD_JPEG_Init();
+
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+
+    errors += Test_Codec();
+    errors += Test_Errors();
+    errors += Test_Draw();
+
+    LCD_SPI_DMA_DeInit(&hlcd_dma);
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @file    host_lcd_bench.c
+ * @brief   主机端LCD基准测试 - 与开发板相同的场景代码，检查总线字节数回归
+ ******************************************************************************
+ * @note
+ *   - 先用 LCD_Benchmark_RunFixed 运行全部场景，解析输出的 "BENCH " 行；
+ *     再逐个场景用 LCD_Benchmark_RunScene 重跑，两次的总线字节数和最后一帧画面必须相同（结果可复现）
+ *   - 传输层统计的命令/总字节数与SPI模拟器实际收到的字节数一致
+ *   - 每帧总线字节数超过基线时失败（绘制路径变差）；低于基线时提示更新基线
+ *   - 帧率和周期数取决于主机速度，只打印不检查
+ ******************************************************************************
+ */
+
+#include "app_lcd_benchmark.h"
+#include "lcd_spi_154.h"
+#include "host_panel.h"
+#include "host_spi.h"
+#include "spi.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define TEST_FRAMES      20U
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+/* 每帧总线字节数基线（TEST_FRAMES 帧的平均值），顺序同 LCD_Bench_Scenes */
+static const uint32_t bus_baseline[LCD_BENCH_SCENE_COUNT] = {
+    197957,     // dashboard：逐行渐变、带边框卡片、轮询文字
+    155011,     // graphics
+    141540,     // dataviz：240个窄条波形
+    116063,     // fullscreen：整屏 + 一行文字
+    115211,     // dashboard_dl：显示列表，每个像素只发送一次
+};
+
+static struct {
+    uint32_t count;
+    uint32_t begin, end;
+    char scene[LCD_BENCH_SCENE_COUNT][24];
+    uint32_t frames[LCD_BENCH_SCENE_COUNT];
+    uint32_t bus[LCD_BENCH_SCENE_COUNT];
+    uint32_t cmd[LCD_BENCH_SCENE_COUNT];
+} parsed;
+
+static void Parse_Print(const char *line)
+{
+    unsigned long frames, fps_i, fps_f, cycles, bus, cmd;
+    char name[24];
+
+    fputs(line, stdout);
+    if (strncmp(line, "BENCH begin", 11) == 0) {
+        parsed.begin++;
+    } else if (strncmp(line, "BENCH end", 9) == 0) {
+        parsed.end++;
+    } else if (sscanf(line, "BENCH scene=%23s frames=%lu fps=%lu.%lu cycles_per_frame=%lu bus_bytes_per_frame=%lu cmd_bytes_per_frame=%lu",
+                      name, &frames, &fps_i, &fps_f, &cycles, &bus, &cmd) == 7 &&
+               parsed.count < LCD_BENCH_SCENE_COUNT) {
+        strcpy(parsed.scene[parsed.count], name);
+        parsed.frames[parsed.count] = (uint32_t)frames;
+        parsed.bus[parsed.count] = (uint32_t)bus;
+        parsed.cmd[parsed.count] = (uint32_t)cmd;
+        parsed.count++;
+    }
+}
+
+static uint32_t Panel_Hash(void)
+{
+    uint32_t h = 2166136261U;
+
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            h = (h ^ HostPanel_GetPixel(x, y)) * 16777619U;
+        }
+    }
+    return h;
+}
+
+int main(void)
+{
+    uint32_t errors = 0;
+    uint32_t hash[LCD_BENCH_SCENE_COUNT];
+
+    printf("=== LCD Benchmark (host, SPI %u MHz, %u frames/scene) ===\r\n",
+           TEST_SPI_CLOCK / 1000000U, TEST_FRAMES);
+
+    SPI_LCD_Init();
+    LCD_SetDirection(Direction_H);
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+
+    /* 1. 开发板上的输出格式 */
+    LCD_Benchmark_RunFixed(&hlcd_dma, TEST_FRAMES, Parse_Print);
+    if (parsed.begin != 1U || parsed.end != 1U || parsed.count != LCD_BENCH_SCENE_COUNT) {
+        printf("  parse: begin %u end %u scenes %u\r\n", parsed.begin, parsed.end, parsed.count);
+        errors++;
+    }
+
+    /* 2. 逐个场景重跑：可复现、统计与模拟器一致、不超过基线 */
+    for (uint32_t i = 0; i < LCD_BENCH_SCENE_COUNT && i < parsed.count; i++) {
+        LCD_Bench_Result_t r;
+        HostSPI_Stats_t spi;
+
+        // 先画一次，记录最后一帧画面
+        LCD_Benchmark_RunScene(&hlcd_dma, &LCD_Bench_Scenes[i], TEST_FRAMES, &r);
+        hash[i] = Panel_Hash();
+
+        HostPanel_Reset();
+        HostSPI_ResetStats();
+        LCD_Benchmark_RunScene(&hlcd_dma, &LCD_Bench_Scenes[i], TEST_FRAMES, &r);
+        HostSPI_GetStats(&spi);
+
+        uint32_t bus = (uint32_t)(r.bus_bytes / r.frames);
+        uint32_t h = Panel_Hash();
+        bool same = (strcmp(parsed.scene[i], LCD_Bench_Scenes[i].name) == 0 && parsed.frames[i] == r.frames &&
+                     parsed.bus[i] == bus && parsed.cmd[i] == (uint32_t)(r.cmd_bytes / r.frames) && h == hash[i]);
+        bool counted = (spi.cmd_bytes == r.cmd_bytes && spi.cmd_bytes + spi.data_bytes == r.bus_bytes);
+
+        printf("  %-12s bus %7u B/frame (baseline %7u), cmd %5u B/frame, repeat %s, spi counts %s, hash 0x%08X\r\n",
+               LCD_Bench_Scenes[i].name, bus, bus_baseline[i], (uint32_t)(r.cmd_bytes / r.frames),
+               same ? "same" : "DIFFERENT", counted ? "match" : "MISMATCH", h);
+        if (!same || !counted || r.frames != TEST_FRAMES) {
+            errors++;
+        }
+        if (bus > bus_baseline[i]) {
+            printf("  %-12s regression: %u bytes/frame over baseline\r\n", LCD_Bench_Scenes[i].name, bus - bus_baseline[i]);
+            errors++;
+        } else if (bus < bus_baseline[i]) {
+            printf("  %-12s improved by %u bytes/frame, update bus_baseline\r\n",
+                   LCD_Bench_Scenes[i].name, bus_baseline[i] - bus);
+        }
+    }
+
+    LCD_SPI_DMA_DeInit(&hlcd_dma);
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
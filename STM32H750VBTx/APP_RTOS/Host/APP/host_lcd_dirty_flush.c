@@ -0,0 +1,161 @@
+/**
+ ******************************************************************************
+ * @file    host_lcd_dirty_flush.c
+ * @brief   主机端脏块刷新测试 - 对比整屏刷新与脏块刷新的SPI总线开销
+ ******************************************************************************
+ * @note
+ *   - 模拟仪表盘：静态背景 + 每帧变化的FPS数字区、柱状条和移动光点
+ *   - 每种模式运行相同的帧序列，统计每帧SPI字节数、窗口数和耗时
+ *   - 每种模式结束后逐像素比较屏幕模型的显存与帧缓冲
+ *   - 刷新失败（注入DMA错误）后脏块保留，下一次刷新把屏幕补齐
+ ******************************************************************************
+ */
+
+#include "lcd_spi_dma.h"
+#include "host_panel.h"
+#include "spi.h"
+#include <stdio.h>
+
+#define TEST_FRAMES      60
+#define TEST_SPI_CLOCK   60000000U
+
+#define COLOR_BG         0x0841
+#define COLOR_PANEL      0x2124
+#define COLOR_TEXT       0xFFE0
+#define COLOR_BAR        0x07E0
+#define COLOR_DOT        0xF800
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+/* 静态背景：几块面板 */
+static void Draw_Background(void)
+{
+    LCD_FB_Clear(&hlcd_dma, COLOR_BG);
+    LCD_FB_FillRect(&hlcd_dma, 4, 4, 232, 24, COLOR_PANEL);
+    LCD_FB_FillRect(&hlcd_dma, 4, 36, 160, 200, COLOR_PANEL);
+    LCD_FB_FillRect(&hlcd_dma, 172, 36, 64, 200, COLOR_PANEL);
+}
+
+/* 一帧的局部更新：FPS数字、柱状条、移动光点 */
+static void Draw_Frame(uint32_t frame)
+{
+    uint32_t fps = 30 + (frame * 7) % 70;
+
+    // FPS数字区：每个"数字"用7段中的若干段表示
+    LCD_FB_FillRect(&hlcd_dma, 8, 8, 48, 16, COLOR_PANEL);
+    for (uint32_t d = 0, v = fps; d < 3; d++, v /= 10) {
+        uint16_t x = 8 + (2 - d) * 16;
+        uint32_t digit = v % 10;
+        if (digit != 1) LCD_FB_FillRect(&hlcd_dma, x, 8, 10, 2, COLOR_TEXT);
+        if (digit % 2)  LCD_FB_FillRect(&hlcd_dma, x, 15, 10, 2, COLOR_TEXT);
+        if (digit > 4)  LCD_FB_FillRect(&hlcd_dma, x, 22, 10, 2, COLOR_TEXT);
+        LCD_FB_FillRect(&hlcd_dma, x + 9, 8, 2, 16, COLOR_TEXT);
+    }
+
+    // 柱状条
+    uint16_t h = 20 + (frame * 13) % 170;
+    LCD_FB_FillRect(&hlcd_dma, 190, 40, 28, 190, COLOR_PANEL);
+    LCD_FB_FillRect(&hlcd_dma, 190, 230 - h, 28, h, COLOR_BAR);
+
+    // 移动光点
+    uint16_t px = 10 + (frame * 5) % 150;
+    uint16_t py = 60 + (frame * 3) % 160;
+    for (uint16_t i = 0; i < 4; i++) {
+        LCD_FB_SetPixel(&hlcd_dma, px + i, py, COLOR_DOT);
+        LCD_FB_SetPixel(&hlcd_dma, px, py + i, COLOR_DOT);
+    }
+}
+
+static uint32_t Compare_Panel(void)
+{
+    uint32_t mismatch = 0;
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            if (HostPanel_GetPixel(x, y) != hlcd_dma.frame_buffer[y * LCD_WIDTH + x]) {
+                mismatch++;
+            }
+        }
+    }
+    return mismatch;
+}
+
+static uint32_t Run_Mode(const char *name, bool full)
+{
+    HostSPI_Stats_t spi;
+    uint32_t windows = 0, pixels = 0;
+
+    HostPanel_Reset();
+    Draw_Background();
+    LCD_SPI_DMA_FlushFrameBuffer(&hlcd_dma);
+
+    HostSPI_ResetStats();
+    uint64_t t0 = HostSPI_NowNs();
+    for (uint32_t frame = 0; frame < TEST_FRAMES; frame++) {
+        Draw_Frame(frame);
+        if (full) {
+            LCD_FB_MarkAllDirty(&hlcd_dma);
+        }
+        LCD_SPI_DMA_FlushFrameBuffer(&hlcd_dma);
+        windows += hlcd_dma.flush_windows;
+        pixels += hlcd_dma.flush_pixels;
+    }
+    uint64_t total_ns = HostSPI_NowNs() - t0;
+    HostSPI_GetStats(&spi);
+
+    uint64_t bytes = (spi.cmd_bytes + spi.data_bytes) / TEST_FRAMES;
+    double bus_ms = bytes * 8.0 * 1000.0 / TEST_SPI_CLOCK;
+    uint32_t mismatch = Compare_Panel();
+
+    printf("  %-6s bytes/frame %7llu  pixels/frame %6u  windows/frame %5.1f  "
+           "bus %6.3f ms (max %6.1f fps)  wall %6.2f ms  mismatch %u\r\n",
+           name, (unsigned long long)bytes, pixels / TEST_FRAMES,
+           (double)windows / TEST_FRAMES, bus_ms, 1000.0 / bus_ms,
+           total_ns / 1e6 / TEST_FRAMES, mismatch);
+    return mismatch;
+}
+
+/* 第一个窗口的DMA出错：失败的窗口和之后未发送的窗口都要在下一次刷新中补发 */
+static uint32_t Run_Failure(bool full)
+{
+    uint32_t errors = 0;
+
+    LCD_SPI_DMA_FlushFrameBuffer(&hlcd_dma);
+    LCD_FB_FillRect(&hlcd_dma, 0, 0, 40, 20, full ? 0x07FF : 0x001F);
+    LCD_FB_FillRect(&hlcd_dma, 160, 200, 64, 32, full ? 0xFFE0 : 0xF81F);
+    if (full) {
+        LCD_FB_MarkAllDirty(&hlcd_dma);
+    }
+    HostSPI_FailNextDMA(HAL_SPI_ERROR_DMA);
+    HAL_StatusTypeDef failed = LCD_SPI_DMA_FlushFrameBuffer(&hlcd_dma);
+    uint32_t stale = Compare_Panel();
+    HAL_StatusTypeDef retry = LCD_SPI_DMA_FlushFrameBuffer(&hlcd_dma);
+    uint32_t mismatch = Compare_Panel();
+
+    printf("  %-6s DMA error: flush %d (stale %u px), retry %d, mismatch %u\r\n",
+           full ? "full" : "dirty", failed, stale, retry, mismatch);
+    if (failed == HAL_OK || stale == 0 || retry != HAL_OK || mismatch != 0) {
+        errors++;
+    }
+    return errors;
+}
+
+int main(void)
+{
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+    LCD_SPI_DMA_EnableFrameBuffer(&hlcd_dma);
+
+    printf("=== LCD Frame Buffer Dirty-Tile Flush (host, SPI %u MHz, %d frames, %dx%d tiles) ===\r\n",
+           TEST_SPI_CLOCK / 1000000U, TEST_FRAMES, LCD_TILE_SIZE, LCD_TILE_SIZE);
+
+    uint32_t errors = Run_Mode("full", true);
+    errors += Run_Mode("dirty", false);
+    errors += Run_Failure(false);
+    errors += Run_Failure(true);
+
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,304 @@
+/**
+ ******************************************************************************
+ * @file    host_lcd_job.c
+ * @brief   主机端异步窗口写入测试 - 提交开销与窗口大小无关
+ ******************************************************************************
+ * @note
+ *   - 三种窗口：8x16字符、32x32图标、240x40整行，各自铺满一屏
+ *   - polled：LCD_CopyBuffer，调用方等到像素发送完毕
+ *   - job：LCD_Job_WriteWindow，每批最多 LCD_JOB_QUEUE_SIZE 个作业，
+ *     只统计提交调用本身的耗时，批与批之间等待队列排空
+ *   - 校验屏幕内容、完成回调次数，并打印提交到完成的延迟直方图
+ *   - 超时：SPI时钟降到100kHz，LCD_Job_WaitIdle 超时后每个被丢弃的作业都以 HAL_TIMEOUT 回调
+ *   - 并发：四个线程同时提交，SPI降到200kHz使队列一直处于满/差一个空位的状态，每个作业恰好回调一次，
+ *     屏幕内容正确（空位检查与占用不在同一临界区时会覆盖正在发送的作业）
+ ******************************************************************************
+ */
+
+#include "lcd_spi_154.h"
+#include "lcd_spi_job.h"
+#include "host_panel.h"
+#include "spi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#define TEST_SPI_CLOCK   60000000U
+
+typedef struct {
+    const char *name;
+    uint16_t w, h;
+} Window_Class_t;
+
+static const Window_Class_t classes[] = {
+    { "glyph", 8, 16 },
+    { "icon", 32, 32 },
+    { "band", 240, 40 },
+};
+
+static volatile uint32_t done_count;
+static volatile uint32_t done_errors;
+static volatile uint32_t done_timeouts;
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    LCD_Job_HandleTxCplt(hspi);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    LCD_Job_HandleError(hspi);
+}
+
+static void Job_Done(void *ctx, HAL_StatusTypeDef status)
+{
+    (void)ctx;
+    done_count++;
+    if (status == HAL_TIMEOUT) {
+        done_timeouts++;
+    } else if (status != HAL_OK) {
+        done_errors++;
+    }
+}
+
+static uint16_t Pixel(uint32_t index, uint32_t i, uint32_t salt)
+{
+    return (uint16_t)((index * 2654435761U + i * 40503U + salt * 977U) >> 8);
+}
+
+/* 每个窗口一块独立的像素缓冲区，作业完成前不会被改写 */
+static uint16_t *Make_Pixels(const Window_Class_t *c, uint32_t count, uint32_t salt)
+{
+    uint32_t n = (uint32_t)c->w * c->h;
+    uint16_t *buf = malloc((size_t)count * n * sizeof(uint16_t));
+    for (uint32_t k = 0; k < count; k++) {
+        for (uint32_t i = 0; i < n; i++) {
+            buf[k * n + i] = Pixel(k, i, salt);
+        }
+    }
+    return buf;
+}
+
+static uint32_t Check_Panel(const Window_Class_t *c, uint32_t salt)
+{
+    uint32_t cols = LCD_Width / c->w, rows = LCD_Height / c->h;
+    uint32_t mismatch = 0;
+
+    for (uint16_t y = 0; y < rows * c->h; y++) {
+        for (uint16_t x = 0; x < cols * c->w; x++) {
+            uint32_t index = (y / c->h) * cols + x / c->w;
+            uint32_t i = (y % c->h) * c->w + x % c->w;
+            if (HostPanel_GetPixel(x, y) != Pixel(index, i, salt)) {
+                mismatch++;
+            }
+        }
+    }
+    return mismatch;
+}
+
+static uint32_t Run_Class(const Window_Class_t *c)
+{
+    uint32_t cols = LCD_Width / c->w, rows = LCD_Height / c->h;
+    uint32_t count = cols * rows, n = (uint32_t)c->w * c->h;
+    uint32_t errors = 0;
+    LCD_Job_Stats_t stats;
+
+    /* 轮询写入 */
+    uint16_t *pixels = Make_Pixels(c, count, 1);
+    HostPanel_Reset();
+    uint64_t t0 = HostSPI_NowNs();
+    for (uint32_t k = 0; k < count; k++) {
+        LCD_CopyBuffer((k % cols) * c->w, (k / cols) * c->h, c->w, c->h, &pixels[k * n]);
+    }
+    double polled_ns = (double)(HostSPI_NowNs() - t0) / count;
+    uint32_t polled_mismatch = Check_Panel(c, 1);
+    free(pixels);
+
+    /* 异步作业 */
+    pixels = Make_Pixels(c, count, 2);
+    HostPanel_Reset();
+    LCD_Job_ResetStats();
+    done_count = 0;
+    done_errors = 0;
+    for (uint32_t k = 0; k < count; k++) {
+        if (k % LCD_JOB_QUEUE_SIZE == 0) {
+            LCD_Job_WaitIdle(LCD_JOB_WAIT_TIMEOUT_MS);
+        }
+        if (LCD_Job_WriteWindow((k % cols) * c->w, (k / cols) * c->h, c->w, c->h,
+                                &pixels[k * n], Job_Done, NULL) != HAL_OK) {
+            errors++;
+        }
+    }
+    LCD_Job_WaitIdle(LCD_JOB_WAIT_TIMEOUT_MS);
+    LCD_Job_GetStats(&stats);
+    uint32_t job_mismatch = Check_Panel(c, 2);
+    free(pixels);
+
+    double cycles_per_ns = SystemCoreClock / 1e9;
+    double submit_ns = stats.submit_cycles_total / cycles_per_ns / stats.submits;
+    printf("  %-5s %3ux%-3u x%-4u  polled %9.1f us/window  job submit %6.2f us (max %6.2f)  "
+           "x%6.1f less CPU  mismatch %u/%u\r\n",
+           c->name, c->w, c->h, count, polled_ns / 1000.0, submit_ns / 1000.0,
+           stats.submit_cycles_max / cycles_per_ns / 1000.0, polled_ns / submit_ns,
+           polled_mismatch, job_mismatch);
+
+    printf("        latency:");
+    for (uint32_t b = 0; b < LCD_JOB_HIST_BINS; b++) {
+        if (stats.latency_hist[b] != 0) {
+            printf(" <%uus:%u", 1U << b, stats.latency_hist[b]);
+        }
+    }
+    printf("  max %u us\r\n", stats.latency_max_us);
+
+    if (stats.jobs != count || done_count != count || stats.errors != 0 || done_errors != 0) {
+        printf("  %s: jobs %u callbacks %u errors %u/%u\r\n",
+               c->name, stats.jobs, done_count, stats.errors, done_errors);
+        errors++;
+    }
+    return errors + polled_mismatch + job_mismatch;
+}
+
+/* 排空超时：丢弃的作业不能让提交者一直等回调 */
+static uint32_t Test_Timeout(void)
+{
+    static uint16_t band[240 * 40];
+    LCD_Job_Stats_t stats;
+    uint32_t errors = 0;
+
+    HostSPI_SetClock(100000U);      // 一个240x40窗口约1.5s
+    LCD_Job_ResetStats();
+    done_count = done_errors = done_timeouts = 0;
+    for (uint32_t k = 0; k < 3; k++) {
+        if (LCD_Job_WriteWindow(0, (uint16_t)(k * 40U), 240, 40, band, Job_Done, NULL) != HAL_OK) {
+            errors++;
+        }
+    }
+    HAL_StatusTypeDef status = LCD_Job_WaitIdle(10);
+    LCD_Job_GetStats(&stats);
+    printf("  timeout: WaitIdle %d, callbacks %u (timeout %u), busy %d, stats jobs %u errors %u\r\n",
+           status, done_count, done_timeouts, LCD_Job_IsBusy(), stats.jobs, stats.errors);
+    if (status != HAL_TIMEOUT || done_count != 3U || done_timeouts != 3U || LCD_Job_IsBusy() ||
+        stats.jobs != 3U || stats.errors != 3U) {
+        errors++;
+    }
+
+    HostSPI_WaitIdle();             // 被停止的模拟DMA到期后不再回调
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    if (done_count != 3U) {
+        printf("  timeout: late callback after DMA stop\r\n");
+        errors++;
+    }
+    return errors;
+}
+
+/* ==================== 并发提交 ==================== */
+
+#define CONCURRENT_THREADS 4
+#define CONCURRENT_JOBS    30        // 每个线程提交的作业数
+#define CONCURRENT_CLOCK   200000U   // 窗口命令约0.4ms、字符像素约10ms，提交线程大部分时间在等空位
+
+typedef struct {
+    uint32_t id;                // 线程号，决定写入的字符行
+    uint16_t pixels[8 * 16];
+    volatile uint32_t done;     // 本线程作业的完成回调次数
+    uint32_t submit_errors;
+} Submitter_t;
+
+static void Submitter_Done(void *ctx, HAL_StatusTypeDef status)
+{
+    Submitter_t *s = (Submitter_t *)ctx;
+
+    s->done++;
+    if (status != HAL_OK) {
+        done_errors++;
+    }
+}
+
+static void *Submitter_Thread(void *arg)
+{
+    Submitter_t *s = (Submitter_t *)arg;
+
+    for (uint32_t n = 0; n < CONCURRENT_JOBS; n++) {
+        // 每个线程写自己的一行字符窗口，像素内容不变，最终屏幕内容与提交顺序无关
+        if (LCD_Job_WriteWindow((uint16_t)(n % 30U * 8U), (uint16_t)(s->id * 16U), 8, 16,
+                                s->pixels, Submitter_Done, s) != HAL_OK) {
+            s->submit_errors++;
+        }
+    }
+    return NULL;
+}
+
+static uint32_t Test_Concurrent(void)
+{
+    static Submitter_t sub[CONCURRENT_THREADS];
+    pthread_t threads[CONCURRENT_THREADS];
+    uint32_t errors = 0, mismatch = 0, callbacks = 0, submit_errors = 0;
+
+    HostSPI_SetClock(CONCURRENT_CLOCK);
+    HostPanel_Reset();
+    done_errors = 0;
+    for (uint32_t t = 0; t < CONCURRENT_THREADS; t++) {
+        sub[t].id = t;
+        sub[t].done = 0;
+        sub[t].submit_errors = 0;
+        for (uint32_t i = 0; i < 8 * 16; i++) {
+            sub[t].pixels[i] = Pixel(t, i, 7);
+        }
+    }
+    for (uint32_t t = 0; t < CONCURRENT_THREADS; t++) {
+        pthread_create(&threads[t], NULL, Submitter_Thread, &sub[t]);
+    }
+    for (uint32_t t = 0; t < CONCURRENT_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    if (LCD_Job_WaitIdle(LCD_JOB_WAIT_TIMEOUT_MS) != HAL_OK) {
+        errors++;
+    }
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    for (uint32_t t = 0; t < CONCURRENT_THREADS; t++) {
+        for (uint16_t y = 0; y < 16; y++) {
+            for (uint16_t x = 0; x < 240; x++) {
+                if (HostPanel_GetPixel(x, (uint16_t)(t * 16U + y)) != sub[t].pixels[y * 8 + x % 8]) {
+                    mismatch++;
+                }
+            }
+        }
+        if (sub[t].done != CONCURRENT_JOBS) {
+            errors++;
+        }
+        callbacks += sub[t].done;
+        submit_errors += sub[t].submit_errors;
+    }
+    printf("  concurrent: %d threads x %u jobs, callbacks %u, submit errors %u, callback errors %u, mismatch %u\r\n",
+           CONCURRENT_THREADS, CONCURRENT_JOBS, callbacks, submit_errors, done_errors, mismatch);
+    if (submit_errors != 0 || done_errors != 0 || mismatch != 0) {
+        errors++;
+    }
+    return errors;
+}
+
+int main(void)
+{
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_Job_Init(&hspi4);
+
+    printf("=== LCD Async Window Jobs (host, SPI %u MHz, queue %d) ===\r\n",
+           TEST_SPI_CLOCK / 1000000U, LCD_JOB_QUEUE_SIZE);
+
+    uint32_t errors = 0;
+    double submit_us[3];
+    for (uint32_t i = 0; i < sizeof(classes) / sizeof(classes[0]); i++) {
+        LCD_Job_Stats_t stats;
+        errors += Run_Class(&classes[i]);
+        LCD_Job_GetStats(&stats);
+        submit_us[i] = stats.submit_cycles_total / (SystemCoreClock / 1e6) / stats.submits;
+    }
+    printf("  submit cost band/glyph: x%.2f\r\n", submit_us[2] / submit_us[0]);
+    errors += Test_Concurrent();
+    errors += Test_Timeout();
+
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,199 @@
+/**
+ ******************************************************************************
+ * @file    host_lcd_prof.c
+ * @brief   主机端LCD流水线剖析测试 - 各阶段计数、DMA时间、直方图与瓶颈判断
+ ******************************************************************************
+ * @note
+ *   - 整屏 LCD_DMA_Clear：每帧一次窗口命令，DMA时间约等于 57600*16/SPI时钟，判断为 SPI-bound
+ *   - 小矩形加忙等（模拟应用逻辑）：等待很少，判断为 CPU-bound
+ *   - 每个阶段和整帧的直方图合计等于帧数；CPU阶段之和不超过帧时间
+ *   - 帧外的绘制不计入统计
+ ******************************************************************************
+ */
+
+#include "lcd_prof.h"
+#include "lcd_spi_dma.h"
+#include "host_panel.h"
+#include "host_spi.h"
+#include "spi.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define TEST_FRAMES      10
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+static char report[2048];
+
+static void Capture_Print(const char *line)
+{
+    size_t len = strlen(report);
+
+    snprintf(report + len, sizeof(report) - len, "%s", line);
+    fputs(line, stdout);
+}
+
+static double Cycles_Ms(uint64_t cycles)
+{
+    return cycles / (SystemCoreClock / 1e3);
+}
+
+static void Busy_Us(uint32_t us)
+{
+    uint64_t until = HostSPI_NowNs() + (uint64_t)us * 1000U;
+
+    while (HostSPI_NowNs() < until) {
+    }
+}
+
+/* 每个阶段的直方图合计等于帧数，CPU阶段之和不超过帧时间 */
+static uint32_t Check_Consistency(const LCD_Prof_Stats_t *s)
+{
+    uint32_t errors = 0, sum;
+    uint64_t cpu = 0;
+
+    for (int i = -1; i < LCD_PROF_STAGE_COUNT; i++) {
+        const LCD_Prof_StageStats_t *st = (i < 0) ? &s->frame : &s->stage[i];
+
+        sum = 0;
+        for (uint32_t k = 0; k < LCD_PROF_HIST_BINS; k++) {
+            sum += st->hist[k];
+        }
+        if (sum != s->frames || st->cycles_min > st->cycles_max ||
+            (uint64_t)st->cycles_max * s->frames < st->cycles_total) {
+            printf("  stage %d: hist sum %u, min %u max %u\r\n", i, sum, st->cycles_min, st->cycles_max);
+            errors++;
+        }
+        if (i >= 0 && i != LCD_PROF_DMA) {
+            cpu += st->cycles_total;
+        }
+    }
+    if (cpu > s->frame.cycles_total) {
+        printf("  cpu stages %.2f ms > frame %.2f ms\r\n", Cycles_Ms(cpu), Cycles_Ms(s->frame.cycles_total));
+        errors++;
+    }
+    return errors;
+}
+
+/* ==================== 整屏清屏：SPI是瓶颈 ==================== */
+
+static uint32_t Test_SpiBound(void)
+{
+    uint32_t errors = 0;
+    LCD_Prof_Stats_t s;
+    HostSPI_Stats_t spi;
+    uint32_t chunks = (LCD_WIDTH * LCD_HEIGHT + hlcd_dma.dma_buffer_size - 1U) / hlcd_dma.dma_buffer_size;
+
+    LCD_Prof_Reset();
+    HostSPI_ResetStats();
+    for (uint32_t n = 0; n < TEST_FRAMES; n++) {
+        LCD_Prof_FrameBegin();
+        LCD_DMA_Clear(&hlcd_dma, (n & 1U) ? 0xF800 : 0x07E0);
+        LCD_Prof_FrameEnd();
+    }
+    HostSPI_GetStats(&spi);
+    LCD_Prof_GetStats(&s);
+    report[0] = '\0';
+    LCD_Prof_Report("Full clear", Capture_Print);
+
+    double dma_ms = Cycles_Ms(s.stage[LCD_PROF_DMA].cycles_total) / s.frames;
+    double expect_ms = LCD_WIDTH * LCD_HEIGHT * 16.0 / TEST_SPI_CLOCK * 1e3;
+    printf("  dma %.2f ms/frame (bus %.2f ms), setaddr %u/frame, dma %u/frame (chunks %u), spi dma %u\r\n",
+           dma_ms, expect_ms, s.stage[LCD_PROF_SETADDR].events / s.frames,
+           s.stage[LCD_PROF_DMA].events / s.frames, chunks, spi.dma_transfers);
+
+    if (s.frames != TEST_FRAMES || s.stage[LCD_PROF_SETADDR].events != TEST_FRAMES ||
+        s.stage[LCD_PROF_DMA].events != TEST_FRAMES * chunks || spi.dma_transfers != TEST_FRAMES * chunks ||
+        s.stage[LCD_PROF_PIXEL].events != TEST_FRAMES || s.stage[LCD_PROF_WAIT].events == 0U) {
+        errors++;
+    }
+    if (dma_ms < expect_ms * 0.95 || dma_ms > expect_ms * 1.2) {
+        errors++;
+    }
+    if (strstr(report, "SPI-bound") == NULL) {
+        errors++;
+    }
+    errors += Check_Consistency(&s);
+    return errors;
+}
+
+/* ==================== 小矩形加应用逻辑：CPU是瓶颈 ==================== */
+
+static uint32_t Test_CpuBound(void)
+{
+    uint32_t errors = 0;
+    LCD_Prof_Stats_t s;
+
+    LCD_Prof_Reset();
+    for (uint32_t n = 0; n < TEST_FRAMES; n++) {
+        LCD_Prof_FrameBegin();
+        for (uint32_t k = 0; k < 8U; k++) {
+            LCD_DMA_FillRect(&hlcd_dma, (uint16_t)(k * 28U), 100, 20, 20, (uint16_t)(n * 8U + k));
+            Busy_Us(2000);
+        }
+        LCD_Prof_FrameEnd();
+    }
+    LCD_Prof_GetStats(&s);
+    report[0] = '\0';
+    LCD_Prof_Report("Rects + logic", Capture_Print);
+
+    if (s.frames != TEST_FRAMES || s.stage[LCD_PROF_SETADDR].events != TEST_FRAMES * 8U ||
+        s.stage[LCD_PROF_DMA].events != TEST_FRAMES * 8U) {
+        errors++;
+    }
+    if (strstr(report, "CPU-bound") == NULL) {
+        errors++;
+    }
+    errors += Check_Consistency(&s);
+    return errors;
+}
+
+/* ==================== 帧外绘制、空报告 ==================== */
+
+static uint32_t Test_OutsideFrame(void)
+{
+    uint32_t errors = 0;
+    LCD_Prof_Stats_t s;
+
+    LCD_Prof_Reset();
+    report[0] = '\0';
+    LCD_Prof_Report("Empty", Capture_Print);
+    if (strstr(report, "no frames") == NULL) {
+        errors++;
+    }
+
+    LCD_DMA_FillRect(&hlcd_dma, 0, 0, 40, 40, 0xFFFF);
+    LCD_Prof_FrameEnd();            // 没有 FrameBegin：忽略
+    LCD_Prof_GetStats(&s);
+    for (uint32_t i = 0; i < LCD_PROF_STAGE_COUNT; i++) {
+        if (s.stage[i].events != 0U || s.stage[i].cycles_total != 0U) {
+            errors++;
+        }
+    }
+    printf("  outside frame: frames %u, errors %u\r\n", s.frames, errors);
+    if (s.frames != 0U) {
+        errors++;
+    }
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors = 0;
+
+    printf("=== LCD Pipeline Profiler (host, SPI %u MHz) ===\r\n", TEST_SPI_CLOCK / 1000000U);
+
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+
+    errors += Test_SpiBound();
+    errors += Test_CpuBound();
+    errors += Test_OutsideFrame();
+
+    LCD_SPI_DMA_DeInit(&hlcd_dma);
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
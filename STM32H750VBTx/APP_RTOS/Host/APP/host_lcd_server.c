@@ -0,0 +1,274 @@
+/**
+ ******************************************************************************
+ * @file    host_lcd_server.c
+ * @brief   主机端显示服务测试 - 多任务/中断并发提交、逐帧合并与屏幕一致性
+ ******************************************************************************
+ * @note
+ *   - 4个"任务"线程各自刷新一行计数文字（不同字体、颜色），1个线程刷新进度条，
+ *     1个"中断"线程用 LCD_Server_PostFromISR 改变指示灯颜色，区域互不重叠；
+ *     该线程和模拟DMA中断一样在关中断状态下提交（嵌套的临界区）
+ *   - 结束后比较：屏幕模型 == 帧缓冲 == 各slot最后一条被接受的命令单独合成的参考图
+ *   - 统计：posted == rendered + coalesced，帧数远少于命令数
+ *   - 空闲时单条命令从提交到显示完成的延迟
+ *   - 出错：刷新时DMA出错，Sync 返回 HAL_ERROR 并计入 errors，下一帧重发后屏幕正确；
+ *     文字命令的 text/style/ascii 为NULL时拒绝提交
+ ******************************************************************************
+ */
+
+#include "lcd_display_server.h"
+#include "host_panel.h"
+#include "spi.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define TEXT_UPDATES     300
+#define BAR_UPDATES      220
+#define ISR_UPDATES      500
+#define SLOT_COUNT       7
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+static LCD_Srv_Cmd_t last_cmd[SLOT_COUNT];      // 每个slot最后一条被接受的命令，slot由唯一线程写
+static uint32_t post_ns[SLOT_COUNT];           // 每个slot单次提交的平均耗时
+static LCD_DisplayList_t ref_dl;
+static uint16_t reference[LCD_WIDTH * LCD_HEIGHT];
+
+typedef struct {
+    uint8_t slot;
+    uint16_t y;
+    const pFONT *font;
+    uint16_t fg, bg;
+} Text_Producer_t;
+
+static const Text_Producer_t text_producers[] = {
+    { 1, 0,   &ASCII_Font16, 0xFFFF, 0x0010 },
+    { 2, 24,  &ASCII_Font20, 0xFFE0, 0x8200 },
+    { 3, 52,  &ASCII_Font24, 0x07FF, 0x0000 },
+    { 4, 84,  &ASCII_Font32, 0xF81F, 0x0660 },
+};
+
+static void Sleep_Us(uint32_t us)
+{
+    struct timespec ts = { 0, (long)us * 1000L };
+    nanosleep(&ts, NULL);
+}
+
+static void *Text_Thread(void *arg)
+{
+    const Text_Producer_t *p = arg;
+    LCD_Style_t style = { p->fg, p->bg, p->font, NULL };
+    uint64_t total = 0;
+    char text[LCD_SRV_TEXT_MAX];
+
+    for (uint32_t i = 1; i <= TEXT_UPDATES; i++) {
+        snprintf(text, sizeof(text), "T%u:%06u", p->slot, i * p->slot);
+        uint64_t t0 = HostSPI_NowNs();
+        HAL_StatusTypeDef status = LCD_Server_Text(p->slot, 8, p->y, text, &style);
+        total += HostSPI_NowNs() - t0;
+        if (status == HAL_OK) {
+            memset(&last_cmd[p->slot], 0, sizeof(LCD_Srv_Cmd_t));
+            last_cmd[p->slot].type = LCD_DL_TEXT;
+            last_cmd[p->slot].x = 8;
+            last_cmd[p->slot].y = p->y;
+            last_cmd[p->slot].style = style;
+            strcpy(last_cmd[p->slot].text, text);
+        }
+        Sleep_Us(200 + p->slot * 150);
+    }
+    post_ns[p->slot] = (uint32_t)(total / TEXT_UPDATES);
+    return NULL;
+}
+
+/* 进度条：宽度单调增加，最后一条覆盖之前所有的 */
+static void *Bar_Thread(void *arg)
+{
+    (void)arg;
+    for (uint16_t w = 1; w <= BAR_UPDATES; w++) {
+        if (LCD_Server_FillRect(5, 10, 140, w, 20, 0x07E0) == HAL_OK) {
+            memset(&last_cmd[5], 0, sizeof(LCD_Srv_Cmd_t));
+            last_cmd[5].type = LCD_DL_FILL_RECT;
+            last_cmd[5].x = 10;  last_cmd[5].y = 140;
+            last_cmd[5].w = w;   last_cmd[5].h = 20;
+            last_cmd[5].style.fg = 0x07E0;
+        }
+        Sleep_Us(300);
+    }
+    return NULL;
+}
+
+/* 模拟中断：不等待，队列满时命令被拒绝 */
+static void *Isr_Thread(void *arg)
+{
+    LCD_Srv_Cmd_t cmd;
+    uint32_t *rejected = arg;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type = LCD_DL_FILL_CIRCLE;
+    cmd.slot = 6;
+    cmd.x = 200;  cmd.y = 200;  cmd.w = 15;
+    for (uint32_t i = 0; i < ISR_UPDATES; i++) {
+        cmd.style.fg = (uint16_t)(i * 2654435761U >> 16);
+        __disable_irq();                        // 进入"中断上下文"
+        if (LCD_Server_PostFromISR(&cmd) == HAL_OK) {
+            last_cmd[6] = cmd;
+        } else {
+            (*rejected)++;
+        }
+        __enable_irq();
+        Sleep_Us(100);
+    }
+    return NULL;
+}
+
+/* 参考图：黑底上合成各slot最后一条命令 */
+static void Build_Reference(void)
+{
+    LCD_DL_Begin(&ref_dl, true, 0);
+    for (uint32_t s = 1; s < SLOT_COUNT; s++) {
+        const LCD_Srv_Cmd_t *c = &last_cmd[s];
+        switch (c->type) {
+        case LCD_DL_FILL_RECT:
+            LCD_DL_FillRect(&ref_dl, c->x, c->y, c->w, c->h, c->style.fg);
+            break;
+        case LCD_DL_FILL_CIRCLE:
+            LCD_DL_FillCircle(&ref_dl, c->x, c->y, c->w, c->style.fg);
+            break;
+        case LCD_DL_TEXT:
+            LCD_DL_Text(&ref_dl, c->x, c->y, c->text, c->style.ascii, c->style.ch, c->style.fg, c->style.bg);
+            break;
+        default:
+            break;
+        }
+    }
+    LCD_DL_RasterBand(&ref_dl, reference, 0, 0, LCD_WIDTH, LCD_HEIGHT);
+}
+
+static uint32_t Compare(void)
+{
+    uint32_t panel_err = 0, ref_err = 0;
+
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            uint16_t fb = hlcd_dma.frame_buffer[y * LCD_WIDTH + x];
+            if (HostPanel_GetPixel(x, y) != fb) panel_err++;
+            if (reference[y * LCD_WIDTH + x] != fb) ref_err++;
+        }
+    }
+    printf("  panel vs frame buffer mismatch %u, frame buffer vs reference mismatch %u\r\n", panel_err, ref_err);
+    return panel_err + ref_err;
+}
+
+/* 刷新失败与无效的文字命令 */
+static uint32_t Test_Errors(void)
+{
+    LCD_Style_t style = { 0xFFFF, 0x0000, &ASCII_Font16, NULL };
+    LCD_Style_t no_font = style;
+    LCD_Srv_Stats_t before, after;
+    uint32_t errors = 0;
+
+    no_font.ascii = NULL;
+    LCD_Server_GetStats(&before);
+    HAL_StatusTypeDef bad_text = LCD_Server_Text(0, 0, 0, NULL, &style);
+    HAL_StatusTypeDef bad_style = LCD_Server_Text(0, 0, 0, "x", NULL);
+    HAL_StatusTypeDef bad_font = LCD_Server_Text(0, 0, 0, "x", &no_font);
+
+    HostSPI_FailNextDMA(HAL_SPI_ERROR_DMA);
+    LCD_Server_FillRect(0, 0, 200, LCD_WIDTH, 20, 0x07E0);
+    HAL_StatusTypeDef failed = LCD_Server_Sync(1000);
+    LCD_Server_FillRect(0, 0, 220, LCD_WIDTH, 10, 0x001F);
+    HAL_StatusTypeDef retry = LCD_Server_Sync(1000);
+    HostSPI_WaitIdle();
+    LCD_Server_GetStats(&after);
+
+    printf("  errors: NULL text %d, NULL style %d, NULL font %d (rejected +%u), "
+           "DMA error sync %d (errors +%u), next sync %d\r\n",
+           bad_text, bad_style, bad_font, after.rejected - before.rejected,
+           failed, after.errors - before.errors, retry);
+    if (bad_text != HAL_ERROR || bad_style != HAL_ERROR || bad_font != HAL_ERROR ||
+        after.rejected - before.rejected != 1U || failed != HAL_ERROR || after.errors - before.errors != 1U ||
+        retry != HAL_OK) {
+        errors++;
+    }
+    // 失败帧的脏块在下一帧重发
+    if (HostPanel_GetPixel(5, 205) != 0x07E0 || HostPanel_GetPixel(5, 225) != 0x001F) {
+        printf("  errors: failed frame not resent\r\n");
+        errors++;
+    }
+    return errors;
+}
+
+int main(void)
+{
+    pthread_t threads[6];
+    uint32_t isr_rejected = 0, errors = 0;
+    uint32_t n = 0;
+    LCD_Srv_Stats_t stats;
+
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+
+    printf("=== LCD Display Server (host, SPI %u MHz, queue %d, frame %d ms) ===\r\n",
+           TEST_SPI_CLOCK / 1000000U, LCD_SRV_QUEUE_LEN, LCD_SRV_FRAME_MS);
+
+    if (LCD_Server_Start(&hlcd_dma) != HAL_OK) {
+        printf("FAIL\r\n");
+        return 1;
+    }
+
+    uint64_t t0 = HostSPI_NowNs();
+    for (uint32_t i = 0; i < sizeof(text_producers) / sizeof(text_producers[0]); i++) {
+        pthread_create(&threads[n++], NULL, Text_Thread, (void *)&text_producers[i]);
+    }
+    pthread_create(&threads[n++], NULL, Bar_Thread, NULL);
+    pthread_create(&threads[n++], NULL, Isr_Thread, &isr_rejected);
+    for (uint32_t i = 0; i < n; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    if (LCD_Server_Sync(1000) != HAL_OK) {
+        printf("  sync timeout\r\n");
+        errors++;
+    }
+    HostSPI_WaitIdle();
+    double run_ms = (HostSPI_NowNs() - t0) / 1e6;
+
+    LCD_Server_GetStats(&stats);
+    printf("  %.1f ms: posted %u rejected %u (isr %u), rendered %u, coalesced %u, frames %u, errors %u\r\n",
+           run_ms, stats.posted, stats.rejected, isr_rejected, stats.rendered, stats.coalesced, stats.frames,
+           stats.errors);
+    printf("  post cost per call:");
+    for (uint32_t s = 1; s <= 4; s++) {
+        printf(" slot%u %.2f us", s, post_ns[s] / 1000.0);
+    }
+    printf("\r\n");
+    if (stats.rendered + stats.coalesced != stats.posted || stats.frames == 0 || stats.frames >= stats.posted ||
+        stats.errors != 0) {
+        errors++;
+    }
+
+    Build_Reference();
+    errors += Compare();
+
+    /* 空闲时单条命令的延迟（Sync 以1ms轮询，结果向上取整到毫秒） */
+    HAL_Delay(LCD_SRV_FRAME_MS);
+    t0 = HostSPI_NowNs();
+    LCD_Server_FillRect(0, 0, 230, LCD_WIDTH, 10, 0xF800);
+    LCD_Server_Sync(1000);
+    double idle_ms = (HostSPI_NowNs() - t0) / 1e6;
+    printf("  idle single command latency %.2f ms\r\n", idle_ms);
+    if (idle_ms > 3 * LCD_SRV_FRAME_MS) {
+        errors++;
+    }
+    HostSPI_WaitIdle();
+    if (HostPanel_GetPixel(5, 235) != 0xF800) {
+        errors++;
+    }
+    errors += Test_Errors();
+
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
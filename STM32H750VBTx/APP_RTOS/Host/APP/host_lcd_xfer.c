@@ -0,0 +1,199 @@
+/**
+ ******************************************************************************
+ * @file    host_lcd_xfer.c
+ * @brief   主机端传输层测试 - 8x16字符窗口写入的事务速率
+ ******************************************************************************
+ * @note
+ *   - legacy：按改动前的方式逐阶段发送，每次写命令/参数单独片选，
+ *     8位/16位切换经 HAL_SPI_Init，作为对比基准
+ *   - xfer：LCD_CopyBuffer（lcd_spi_154.c → lcd_spi_xfer.c），一次片选内完成窗口和像素
+ *   - v2dma：LCD_V2_SetWindow + LCD_V2_WriteBuffer，像素经模拟DMA发送；
+ *     V2在窗口之间不释放CS，片选次数少于字符数；每个字符都要等一次DMA完成，
+ *     主机上的速率主要受模拟DMA线程的唤醒延迟限制
+ *   - 每种方式写满一屏 30x15 个字符窗口，逐像素校验屏幕模型，
+ *     并检查传输层路径上 HAL_SPI_Init 调用次数为0、每个字符最多片选一次
+ ******************************************************************************
+ */
+
+#include "lcd_spi_154.h"
+#include "lcd_spi_dma_v2.h"
+#include "lcd_spi_xfer.h"
+#include "host_panel.h"
+#include "spi.h"
+#include <stdio.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define TEST_ROUNDS      8
+#define GLYPH_W          8
+#define GLYPH_H          16
+#define GLYPH_COLS       (LCD_Width / GLYPH_W)
+#define GLYPH_ROWS       (LCD_Height / GLYPH_H)
+#define GLYPH_COUNT      (GLYPH_COLS * GLYPH_ROWS)
+
+static LCD_SPI_DMA_V2_Handle_t hlcd_v2;
+
+static uint16_t glyph[GLYPH_W * GLYPH_H];
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    LCD_V2_HandleTxCplt(hspi);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    LCD_V2_HandleError(hspi);
+}
+
+/* 第 index 个字符窗口的内容：与位置和轮次相关，保证每轮写入的像素都不同 */
+static void Glyph_Fill(uint32_t index, uint32_t round)
+{
+    for (uint32_t i = 0; i < GLYPH_W * GLYPH_H; i++) {
+        glyph[i] = (uint16_t)((index * 2654435761U + i * 40503U + round * 977U) >> 8);
+    }
+}
+
+static uint16_t Glyph_Expected(uint16_t x, uint16_t y, uint32_t round)
+{
+    uint32_t index = (y / GLYPH_H) * GLYPH_COLS + x / GLYPH_W;
+    uint32_t i = (y % GLYPH_H) * GLYPH_W + x % GLYPH_W;
+    return (uint16_t)((index * 2654435761U + i * 40503U + round * 977U) >> 8);
+}
+
+/* ==================== 改动前的发送方式 ==================== */
+
+static void Legacy_SetDataSize(uint32_t data_size)
+{
+    if (hspi4.Init.DataSize != data_size) {
+        hspi4.Init.DataSize = data_size;
+        HAL_SPI_Init(&hspi4);
+    }
+}
+
+static void Legacy_WriteCommand(uint8_t cmd)
+{
+    Legacy_SetDataSize(SPI_DATASIZE_8BIT);
+    LCD_CS_Select;
+    LCD_DC_Command;
+    HAL_SPI_Transmit(&hspi4, &cmd, 1, 1000);
+    LCD_CS_Deselect;
+}
+
+static void Legacy_WriteData16(uint16_t data)
+{
+    uint8_t buff[2] = { (uint8_t)(data >> 8), (uint8_t)data };
+    Legacy_SetDataSize(SPI_DATASIZE_8BIT);
+    LCD_CS_Select;
+    LCD_DC_Data;
+    HAL_SPI_Transmit(&hspi4, buff, 2, 1000);
+    LCD_CS_Deselect;
+}
+
+static void Legacy_WriteGlyph(uint16_t x, uint16_t y)
+{
+    Legacy_WriteCommand(0x2A);
+    Legacy_WriteData16(x);
+    Legacy_WriteData16(x + GLYPH_W - 1);
+    Legacy_WriteCommand(0x2B);
+    Legacy_WriteData16(y);
+    Legacy_WriteData16(y + GLYPH_H - 1);
+    Legacy_WriteCommand(0x2C);
+
+    Legacy_SetDataSize(SPI_DATASIZE_16BIT);
+    LCD_CS_Select;
+    LCD_DC_Data;
+    HAL_SPI_Transmit(&hspi4, (uint8_t *)glyph, GLYPH_W * GLYPH_H, 1000);
+    LCD_CS_Deselect;
+    Legacy_SetDataSize(SPI_DATASIZE_8BIT);
+}
+
+/* ==================== 传输层 ==================== */
+
+static void Xfer_WriteGlyph(uint16_t x, uint16_t y)
+{
+    LCD_CopyBuffer(x, y, GLYPH_W, GLYPH_H, glyph);
+}
+
+static void V2_WriteGlyph(uint16_t x, uint16_t y)
+{
+    LCD_V2_SetWindow(&hlcd_v2, x, y, x + GLYPH_W - 1, y + GLYPH_H - 1);
+    LCD_V2_WriteBuffer(&hlcd_v2, glyph, GLYPH_W * GLYPH_H, false);
+}
+
+/* ==================== 测试 ==================== */
+
+static uint32_t Run_Mode(const char *name, void (*write)(uint16_t, uint16_t), bool transport)
+{
+    HostSPI_Stats_t spi;
+    LCD_Xfer_Stats_t xfer;
+    uint32_t mismatch = 0;
+    uint32_t errors = 0;
+
+    HostPanel_Reset();
+    HostSPI_ResetStats();
+    LCD_Xfer_ResetStats();
+
+    uint64_t t0 = HostSPI_NowNs();
+    for (uint32_t round = 0; round < TEST_ROUNDS; round++) {
+        for (uint32_t i = 0; i < GLYPH_COUNT; i++) {
+            Glyph_Fill(i, round);
+            write((i % GLYPH_COLS) * GLYPH_W, (i / GLYPH_COLS) * GLYPH_H);
+        }
+    }
+    HostSPI_WaitIdle();
+    uint64_t total_ns = HostSPI_NowNs() - t0;
+    HostSPI_GetStats(&spi);
+    LCD_Xfer_GetStats(&xfer);
+
+    for (uint16_t y = 0; y < GLYPH_ROWS * GLYPH_H; y++) {
+        for (uint16_t x = 0; x < GLYPH_COLS * GLYPH_W; x++) {
+            if (HostPanel_GetPixel(x, y) != Glyph_Expected(x, y, TEST_ROUNDS - 1)) {
+                mismatch++;
+            }
+        }
+    }
+
+    uint32_t glyphs = TEST_ROUNDS * GLYPH_COUNT;
+    uint64_t bytes = spi.cmd_bytes + spi.data_bytes;
+    double bus_us = bytes * 8.0 * 1e6 / TEST_SPI_CLOCK / glyphs;
+    uint32_t transfers = spi.blocking_transfers + spi.ll_transfers + spi.dma_transfers;
+
+    printf("  %-6s %8.0f glyph/s (bus limit %8.0f)  bytes/glyph %5.1f  transfers/glyph %5.2f  "
+           "CS/glyph %5.2f  HAL_SPI_Init %5u  DSIZE writes %5u  mismatch %u\r\n",
+           name, glyphs / (total_ns / 1e9), 1e6 / bus_us, (double)bytes / glyphs,
+           (double)transfers / glyphs, (double)spi.cs_selects / glyphs,
+           spi.reinit_count, xfer.frame_switches, mismatch);
+
+    if (transport) {
+        if (spi.reinit_count != 0) {
+            printf("  %s: HAL_SPI_Init called %u times on the hot path\r\n", name, spi.reinit_count);
+            errors++;
+        }
+        if (spi.cs_selects > glyphs) {
+            printf("  %s: %u chip selects for %u glyphs\r\n", name, spi.cs_selects, glyphs);
+            errors++;
+        }
+        if (xfer.transactions != glyphs || xfer.frame_switches > 2U * glyphs) {
+            printf("  %s: %u transactions, %u DSIZE writes\r\n", name, xfer.transactions, xfer.frame_switches);
+            errors++;
+        }
+    }
+    return errors + mismatch;
+}
+
+int main(void)
+{
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_V2_Init(&hlcd_v2, &hspi4, LCD_TRANSFER_DMA_BLOCK);
+
+    printf("=== LCD SPI Transport, 8x16 glyph windows (host, SPI %u MHz, %d x %d glyphs) ===\r\n",
+           TEST_SPI_CLOCK / 1000000U, TEST_ROUNDS, GLYPH_COUNT);
+
+    uint32_t errors = Run_Mode("legacy", Legacy_WriteGlyph, false);
+    errors += Run_Mode("xfer", Xfer_WriteGlyph, true);
+    errors += Run_Mode("v2dma", V2_WriteGlyph, true);
+
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
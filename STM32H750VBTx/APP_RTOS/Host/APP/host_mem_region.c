@@ -0,0 +1,329 @@
+/**
+ ******************************************************************************
+ * @file    host_mem_region.c
+ * @brief   主机端分区内存分配测试 - 类别到池的选择、对齐、合并、错误释放与并发
+ ******************************************************************************
+ * @note
+ *   - 默认池（Mem_Init）：FAST 从DTCM分配，满后落到AXI；DMA 从AXI分配且独占缓存行；
+ *     NOCACHE 依次用D2、D3，都满后返回NULL，只在最后一个池计失败
+ *   - 随机分配/释放：不同大小和对齐，每块写满自己的标记，释放前检查未被其它块改写；
+ *     全部释放后池合并回一个空闲块
+ *   - 释放NULL、池外指针、块中间的指针、重复释放
+ *   - 多个线程（__disable_irq 在主机上是一把递归锁）同时分配/释放同一个池
+ *   - 只按地址判断可缓存性：只有AXI SRAM经过D-Cache
+ ******************************************************************************
+ */
+
+#include "mem_region.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define STRESS_OPS        200000U
+#define STRESS_SLOTS      64U
+#define THREAD_COUNT      4U
+#define THREAD_OPS        100000U
+
+static uint64_t Now_Ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t Rand(uint32_t *seed)
+{
+    *seed = *seed * 1103515245U + 12345U;
+    return *seed >> 8;
+}
+
+/* 池是否回到初始状态：无分配，只有一个空闲块 */
+static bool Pool_Empty(Mem_Pool_t pool)
+{
+    Mem_PoolStats_t s;
+
+    Mem_GetStats(pool, &s);
+    return s.used == 0 && s.free_blocks == 1 && s.largest_free + 16U >= s.size;
+}
+
+/* ==================== 类别与池 ==================== */
+
+static uint32_t Test_Classes(void)
+{
+    static void *ptrs[512];
+    uint32_t errors = 0, n = 0, in_dtcm = 0, in_axi = 0, in_d2 = 0, in_d3 = 0;
+    Mem_PoolStats_t s[MEM_POOL_COUNT];
+
+    Mem_Init();
+
+    /* 对齐与缓存行独占 */
+    uint8_t *fast = Mem_Alloc(MEM_CLASS_FAST, 10);
+    uint8_t *dma1 = Mem_Alloc(MEM_CLASS_DMA, 100);
+    uint8_t *dma2 = Mem_Alloc(MEM_CLASS_DMA, 1);
+    uint8_t *nc = Mem_Alloc(MEM_CLASS_NOCACHE, 40);
+    bool lines_ok = dma2 >= dma1 + 128 && ((uintptr_t)dma1 & 31U) == 0 && ((uintptr_t)dma2 & 31U) == 0 &&
+                    ((uintptr_t)nc & 31U) == 0 && ((uintptr_t)fast & 7U) == 0;
+    printf("  pools: fast %d, dma %d/%d, nocache %d, alignment and cache lines %s\r\n",
+           Mem_PoolOf(fast), Mem_PoolOf(dma1), Mem_PoolOf(dma2), Mem_PoolOf(nc), lines_ok ? "ok" : "BAD");
+    if (Mem_PoolOf(fast) != MEM_POOL_DTCM || Mem_PoolOf(dma1) != MEM_POOL_AXI || Mem_PoolOf(dma2) != MEM_POOL_AXI ||
+        Mem_PoolOf(nc) != MEM_POOL_D2 || !lines_ok) {
+        errors++;
+    }
+    Mem_Free(fast);
+    Mem_Free(dma1);
+    Mem_Free(dma2);
+    Mem_Free(nc);
+
+    /* FAST：DTCM满后落到AXI */
+    while (n < 24) {
+        ptrs[n] = Mem_Alloc(MEM_CLASS_FAST, 1000);
+        if (ptrs[n] == NULL) break;
+        Mem_Pool_t pool = Mem_PoolOf(ptrs[n++]);
+        in_dtcm += (pool == MEM_POOL_DTCM);
+        in_axi += (pool == MEM_POOL_AXI);
+    }
+    Mem_GetStats(MEM_POOL_DTCM, &s[MEM_POOL_DTCM]);
+    printf("  fast x1000: %u in DTCM (%u/%u bytes), %u in AXI, DTCM failures %u\r\n",
+           in_dtcm, s[MEM_POOL_DTCM].used, s[MEM_POOL_DTCM].size, in_axi, s[MEM_POOL_DTCM].failures);
+    if (in_dtcm != MEM_POOL_DTCM_SIZE / 1008U || in_axi != 24U - in_dtcm || s[MEM_POOL_DTCM].failures != 0) {
+        errors++;
+    }
+    while (n > 0) {
+        Mem_Free(ptrs[--n]);
+    }
+
+    /* NOCACHE：D2、D3都满后返回NULL */
+    while (n < 512) {
+        ptrs[n] = Mem_Alloc(MEM_CLASS_NOCACHE, 500);
+        if (ptrs[n] == NULL) break;
+        Mem_Pool_t pool = Mem_PoolOf(ptrs[n++]);
+        in_d2 += (pool == MEM_POOL_D2);
+        in_d3 += (pool == MEM_POOL_D3);
+    }
+    for (int i = 0; i < MEM_POOL_COUNT; i++) {
+        Mem_GetStats((Mem_Pool_t)i, &s[i]);
+    }
+    printf("  nocache x500: %u in D2, %u in D3, then NULL; failures D2 %u D3 %u, peak D2 %u\r\n",
+           in_d2, in_d3, s[MEM_POOL_D2].failures, s[MEM_POOL_D3].failures, s[MEM_POOL_D2].peak);
+    // 每块512字节数据 + 块头，块头放在上一个缓存行，连同对齐空隙每块最多占544字节
+    if (n == 512 || in_d2 < MEM_POOL_D2_SIZE / 544U || in_d3 < MEM_POOL_D3_SIZE / 544U ||
+        s[MEM_POOL_D2].failures != 0 || s[MEM_POOL_D3].failures != 1 || s[MEM_POOL_D2].peak < s[MEM_POOL_D2].used) {
+        errors++;
+    }
+    while (n > 0) {
+        Mem_Free(ptrs[--n]);
+    }
+
+    for (int i = 0; i < MEM_POOL_COUNT; i++) {
+        if (!Pool_Empty((Mem_Pool_t)i)) errors++;
+    }
+    Mem_ResetStats();
+    Mem_GetStats(MEM_POOL_D3, &s[MEM_POOL_D3]);
+    if (s[MEM_POOL_D3].failures != 0 || s[MEM_POOL_D3].peak != 0) errors++;
+
+    /* 非法参数 */
+    if (Mem_Alloc(MEM_CLASS_DMA, 0) != NULL || Mem_AllocFrom(MEM_POOL_AXI, 64, 24) != NULL ||
+        Mem_AllocFrom(MEM_POOL_COUNT, 64, 8) != NULL || Mem_Alloc(MEM_CLASS_COUNT, 64) != NULL) {
+        errors++;
+    }
+    return errors;
+}
+
+/* ==================== 随机分配/释放 ==================== */
+
+typedef struct {
+    uint8_t *p;
+    uint32_t size;
+    uint8_t tag;
+} Slot_t;
+
+static uint32_t Test_Stress(void)
+{
+    static const uint32_t aligns[] = { 8, 16, 32, 64, 256 };
+    static uint8_t arena[64 * 1024] __attribute__((aligned(32)));
+    Slot_t slots[STRESS_SLOTS] = { 0 };
+    uint32_t errors = 0, seed = 7, corrupt = 0, misaligned = 0, outside = 0, full = 0;
+    uint32_t max_free_blocks = 0;
+    Mem_PoolStats_t s;
+
+    Mem_InitPool(MEM_POOL_AXI, arena, sizeof(arena));
+    uint64_t t0 = Now_Ns();
+    for (uint32_t op = 0; op < STRESS_OPS; op++) {
+        Slot_t *slot = &slots[Rand(&seed) % STRESS_SLOTS];
+
+        if (slot->p != NULL) {
+            for (uint32_t i = 0; i < slot->size; i++) {
+                if (slot->p[i] != slot->tag) {
+                    corrupt++;
+                    break;
+                }
+            }
+            if (Mem_Free(slot->p) != HAL_OK) errors++;
+            slot->p = NULL;
+        } else {
+            uint32_t align = aligns[Rand(&seed) % 5U];
+            slot->size = 1U + Rand(&seed) % ((Rand(&seed) % 8U == 0) ? 8000U : 300U);
+            slot->p = Mem_AllocFrom(MEM_POOL_AXI, slot->size, align);
+            if (slot->p == NULL) {
+                full++;
+                continue;
+            }
+            if (((uintptr_t)slot->p & (align - 1U)) != 0) misaligned++;
+            if (slot->p < arena || slot->p + slot->size > arena + sizeof(arena)) outside++;
+            slot->tag = (uint8_t)(op * 131U + 1U);
+            memset(slot->p, slot->tag, slot->size);
+        }
+        if ((op & 1023U) == 0) {
+            Mem_GetStats(MEM_POOL_AXI, &s);
+            if (s.free_blocks > max_free_blocks) max_free_blocks = s.free_blocks;
+        }
+    }
+    double ns = (double)(Now_Ns() - t0) / STRESS_OPS;
+
+    Mem_GetStats(MEM_POOL_AXI, &s);
+    for (uint32_t i = 0; i < STRESS_SLOTS; i++) {
+        Mem_Free(slots[i].p);
+    }
+    bool empty = Pool_Empty(MEM_POOL_AXI);
+    printf("  %u random ops: corrupt %u, misaligned %u, outside %u, full %u, peak %u/%u bytes, "
+           "max free blocks %u, %.0f ns/op, coalesced %s\r\n",
+           STRESS_OPS, corrupt, misaligned, outside, full, s.peak, s.size, max_free_blocks, ns,
+           empty ? "yes" : "NO");
+    if (corrupt != 0 || misaligned != 0 || outside != 0 || !empty) {
+        errors++;
+    }
+    return errors;
+}
+
+/* ==================== 错误释放 ==================== */
+
+static uint32_t Test_BadFree(void)
+{
+    uint32_t errors = 0, local;
+    Mem_PoolStats_t s;
+
+    Mem_Init();
+    uint8_t *p = Mem_Alloc(MEM_CLASS_FAST, 64);
+    HAL_StatusTypeDef st_null = Mem_Free(NULL);
+    HAL_StatusTypeDef st_foreign = Mem_Free(&local);
+    HAL_StatusTypeDef st_inner = Mem_Free(p + 16);
+    HAL_StatusTypeDef st_ok = Mem_Free(p);
+    HAL_StatusTypeDef st_double = Mem_Free(p);
+    Mem_GetStats(MEM_POOL_DTCM, &s);
+
+    printf("  free: NULL %d, foreign %d, inner %d, valid %d, double %d, bad_frees %u\r\n",
+           st_null, st_foreign, st_inner, st_ok, st_double, s.bad_frees);
+    if (st_null != HAL_OK || st_foreign != HAL_ERROR || st_inner != HAL_ERROR || st_ok != HAL_OK ||
+        st_double != HAL_ERROR || s.bad_frees != 2 || !Pool_Empty(MEM_POOL_DTCM)) {
+        errors++;
+    }
+    return errors;
+}
+
+/* ==================== 并发 ==================== */
+
+static volatile uint32_t thread_corrupt, thread_failed;
+
+static void *Alloc_Thread(void *arg)
+{
+    uint32_t seed = (uint32_t)(uintptr_t)arg * 977U + 1U;
+    uint8_t *held[8] = { 0 };
+    uint32_t sizes[8] = { 0 };
+    uint8_t tag = (uint8_t)(uintptr_t)arg;
+
+    for (uint32_t op = 0; op < THREAD_OPS; op++) {
+        uint32_t k = Rand(&seed) % 8U;
+        if (held[k] != NULL) {
+            for (uint32_t i = 0; i < sizes[k]; i++) {
+                if (held[k][i] != tag) {
+                    __sync_fetch_and_add(&thread_corrupt, 1U);
+                    break;
+                }
+            }
+            Mem_Free(held[k]);
+            held[k] = NULL;
+        } else {
+            sizes[k] = 1U + Rand(&seed) % 200U;
+            held[k] = Mem_Alloc((k & 1U) ? MEM_CLASS_DMA : MEM_CLASS_FAST, sizes[k]);
+            if (held[k] == NULL) {
+                __sync_fetch_and_add(&thread_failed, 1U);
+                continue;
+            }
+            memset(held[k], tag, sizes[k]);
+        }
+    }
+    for (uint32_t k = 0; k < 8U; k++) {
+        Mem_Free(held[k]);
+    }
+    return NULL;
+}
+
+static uint32_t Test_Threads(void)
+{
+    pthread_t t[THREAD_COUNT];
+    uint32_t errors = 0;
+
+    Mem_Init();
+    uint64_t t0 = Now_Ns();
+    for (uintptr_t i = 0; i < THREAD_COUNT; i++) {
+        pthread_create(&t[i], NULL, Alloc_Thread, (void *)(i + 1U));
+    }
+    for (uint32_t i = 0; i < THREAD_COUNT; i++) {
+        pthread_join(t[i], NULL);
+    }
+    double ms = (Now_Ns() - t0) / 1e6;
+    bool empty = Pool_Empty(MEM_POOL_DTCM) && Pool_Empty(MEM_POOL_AXI);
+
+    printf("  %u threads x %u ops: corrupt %u, failed %u, pools empty %s, %.1f ms\r\n",
+           THREAD_COUNT, THREAD_OPS, thread_corrupt, thread_failed, empty ? "yes" : "NO", ms);
+    if (thread_corrupt != 0 || thread_failed != 0 || !empty) {
+        errors++;
+    }
+    return errors;
+}
+
+/* ==================== 可缓存性 ==================== */
+
+static uint32_t Test_Cacheable(void)
+{
+    static const struct { uint32_t addr; bool cacheable; } cases[] = {
+        { 0x20000000U, false },     // DTCM
+        { 0x24000000U, true },      // AXI SRAM
+        { 0x2407FFFFU, true },
+        { 0x24080000U, false },
+        { 0x30000000U, false },     // D2，MPU配置为不可缓存
+        { 0x30047FFFU, false },
+        { 0x38000000U, false },     // D3
+        { 0x90000000U, false },     // QSPI（只读，不需要写回）
+    };
+    uint32_t errors = 0;
+
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        if (Mem_IsCacheable((const void *)(uintptr_t)cases[i].addr) != cases[i].cacheable) errors++;
+    }
+    // 主机上没有D-Cache，维护函数直接返回
+    uint8_t buf[64];
+    Mem_Cache_Clean(buf, sizeof(buf));
+    Mem_Cache_Invalidate(buf, sizeof(buf));
+    Mem_Cache_CleanInvalidate(buf, sizeof(buf));
+    printf("  cacheable address map: %s\r\n", errors == 0 ? "ok" : "BAD");
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors = 0;
+
+    printf("=== Region Allocator (host) ===\r\n");
+
+    errors += Test_Classes();
+    errors += Test_Stress();
+    errors += Test_BadFree();
+    errors += Test_Threads();
+    errors += Test_Cacheable();
+
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
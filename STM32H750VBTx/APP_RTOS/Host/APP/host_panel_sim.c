@@ -0,0 +1,292 @@
+/**
+ ******************************************************************************
+ * @file    host_panel_sim.c
+ * @brief   主机端ST7789模型测试 - MADCTL方向、视图与黄金图像、命令/参数/像素字节统计、快照
+ ******************************************************************************
+ * @note
+ *   - lcd_spi_154.c 和 lcd_spi_dma.c 经 host_hal/host_spi 把字节流交给屏幕模型，不做任何修改
+ *   - 同一画面在四个显示方向（MADCTL 0x70/0xA0/0x00/0xC0）下视图相同，显存中的物理布局各不相同；
+ *     视图哈希与黄金值比较，绘制代码或屏幕模型的改动都会体现出来
+ *   - 单个矩形的命令/参数/像素字节数与理论值一致，且与SPI模拟器的 DC=0/DC=1 字节数吻合
+ *   - 超出显存的窗口只写入范围内的像素，其余计为丢弃
+ *   - PPM/PNG 快照读回后与视图逐像素一致
+ ******************************************************************************
+ */
+
+#include "lcd_spi_154.h"
+#include "lcd_spi_dma.h"
+#include "lcd_spi_xfer.h"
+#include "host_panel.h"
+#include "host_spi.h"
+#include "spi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SPI_CLOCK   0U             // 瞬间完成：只关心字节流
+#define GOLDEN_HASH      0xB50EC127U    // Draw_Scene 的视图哈希
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+static uint16_t view[4][HOST_PANEL_VIEW_HEIGHT][HOST_PANEL_VIEW_WIDTH];
+
+/* 不对称的画面：左上角标记、文字、线段/圆（lcd_spi_154.c），矩形（lcd_spi_dma.c） */
+static void Draw_Scene(void)
+{
+    LCD_SetBackColor(0x000020);
+    LCD_Clear();
+
+    LCD_SetColor(0xFF0000);
+    LCD_FillRect(0, 0, 30, 20);
+    LCD_SetColor(0xFFFFFF);
+    LCD_SetAsciiFont(&ASCII_Font24);
+    LCD_DisplayString(40, 4, "ST7789 sim");
+    LCD_SetColor(0x00FF00);
+    LCD_DrawLine(0, 239, 239, 40);
+    LCD_DrawCircle(120, 140, 50);
+
+    LCD_DMA_FillRect(&hlcd_dma, 150, 180, 80, 50, 0x001F);
+    LCD_DMA_FillRect(&hlcd_dma, 10, 200, 20, 30, 0xFFE0);
+}
+
+static uint32_t Hash_View(const uint16_t (*v)[HOST_PANEL_VIEW_WIDTH])
+{
+    uint32_t h = 2166136261U;
+
+    for (uint32_t y = 0; y < HOST_PANEL_VIEW_HEIGHT; y++) {
+        for (uint32_t x = 0; x < HOST_PANEL_VIEW_WIDTH; x++) {
+            h = (h ^ v[y][x]) * 16777619U;
+        }
+    }
+    return h;
+}
+
+static void Capture_View(uint16_t (*v)[HOST_PANEL_VIEW_WIDTH])
+{
+    for (uint16_t y = 0; y < HOST_PANEL_VIEW_HEIGHT; y++) {
+        for (uint16_t x = 0; x < HOST_PANEL_VIEW_WIDTH; x++) {
+            v[y][x] = HostPanel_GetViewPixel(x, y);
+        }
+    }
+}
+
+static uint8_t Expand(uint16_t c, int ch)
+{
+    uint8_t r = (uint8_t)(c >> 11), g = (uint8_t)((c >> 5) & 0x3F), b = (uint8_t)(c & 0x1F);
+
+    return (ch == 0) ? (uint8_t)((r << 3) | (r >> 2)) : (ch == 1) ? (uint8_t)((g << 2) | (g >> 4))
+                                                                   : (uint8_t)((b << 3) | (b >> 2));
+}
+
+/* ==================== 显示方向 ==================== */
+
+static uint32_t Test_Directions(void)
+{
+    static const uint8_t dirs[4] = { Direction_V, Direction_H, Direction_H_Flip, Direction_V_Flip };
+    static const char *const names[4] = { "V", "H", "H_Flip", "V_Flip" };
+    uint32_t errors = 0;
+
+    for (int d = 0; d < 4; d++) {
+        uint32_t diff = 0, phys = 0;
+
+        HostPanel_Reset();
+        LCD_SetDirection(dirs[d]);
+        Draw_Scene();
+        Capture_View(view[d]);
+
+        for (uint16_t y = 0; y < HOST_PANEL_VIEW_HEIGHT; y++) {
+            for (uint16_t x = 0; x < HOST_PANEL_VIEW_WIDTH; x++) {
+                diff += (view[d][y][x] != view[0][y][x]);
+                // 物理布局：V 与视图相同；H（MX|MV）为转置后左右镜像
+                if (dirs[d] == Direction_V) {
+                    phys += (HostPanel_GetGramPixel(x, y) != view[d][y][x]);
+                } else if (dirs[d] == Direction_H) {
+                    phys += (HostPanel_GetGramPixel((uint16_t)(HOST_PANEL_GRAM_WIDTH - 1U - y), x) != view[d][y][x]);
+                }
+            }
+        }
+        printf("  %-6s MADCTL 0x%02X: view hash 0x%08X, differs from V %u px, layout mismatch %u, marker 0x%04X\r\n",
+               names[d], HostPanel_GetMADCTL(), Hash_View(view[d]), diff, phys, view[d][5][5]);
+        if (diff != 0 || phys != 0 || view[d][5][5] != 0xF800) {
+            errors++;
+        }
+    }
+
+    uint32_t hash = Hash_View(view[0]);
+    printf("  view hash 0x%08X (golden 0x%08X)\r\n", hash, GOLDEN_HASH);
+    if (hash != GOLDEN_HASH) {
+        errors++;
+    }
+    return errors;
+}
+
+/* ==================== 字节统计 ==================== */
+
+static uint32_t Test_ByteCounts(void)
+{
+    uint32_t errors = 0;
+    HostPanel_Stats_t ps;
+    HostSPI_Stats_t ss;
+
+    LCD_SetDirection(Direction_H);
+    HostPanel_Reset();
+    HostSPI_ResetStats();
+    LCD_DMA_FillRect(&hlcd_dma, 10, 10, 50, 40, 0x07E0);
+    HostPanel_GetStats(&ps);
+    HostSPI_GetStats(&ss);
+    printf("  50x40 rect: cmd %llu param %llu pixel %llu bytes, %u windows, %llu px (spi cmd %llu data %llu)\r\n",
+           (unsigned long long)ps.cmd_bytes, (unsigned long long)ps.param_bytes, (unsigned long long)ps.pixel_bytes,
+           ps.windows, (unsigned long long)ps.pixels,
+           (unsigned long long)ss.cmd_bytes, (unsigned long long)ss.data_bytes);
+    if (ps.cmd_bytes != 3 || ps.param_bytes != 8 || ps.pixel_bytes != 50 * 40 * 2 || ps.pixels != 50 * 40 ||
+        ps.windows != 1 || ps.addr_cmds != 2 || ss.cmd_bytes != ps.cmd_bytes ||
+        ss.data_bytes != ps.param_bytes + ps.pixel_bytes) {
+        errors++;
+    }
+
+    /* 逐点绘制：每个像素都要一个窗口 */
+    HostPanel_ResetStats();
+    for (uint16_t i = 0; i < 100; i++) {
+        LCD_DrawPoint(i, 120, 0xF800);
+    }
+    HostPanel_GetStats(&ps);
+    printf("  100 points: cmd %llu param %llu pixel %llu bytes (%.1f bus bytes per pixel)\r\n",
+           (unsigned long long)ps.cmd_bytes, (unsigned long long)ps.param_bytes, (unsigned long long)ps.pixel_bytes,
+           (double)(ps.cmd_bytes + ps.param_bytes + ps.pixel_bytes) / 100.0);
+    if (ps.cmd_bytes != 300 || ps.param_bytes != 800 || ps.pixel_bytes != 200 || HostPanel_GetPixel(50, 120) != 0xF800) {
+        errors++;
+    }
+
+    /* MADCTL=0 时列地址超出240：范围内的像素写入，其余丢弃 */
+    HostPanel_ResetStats();
+    LCD_SetDirection(Direction_V);
+    LCD_Xfer_Begin(&hspi4);
+    LCD_Xfer_Window(&hspi4, 230, 0, 249, 0);
+    LCD_Xfer_Fill16(&hspi4, 0xABCD, 20);
+    LCD_Xfer_End(&hspi4);
+    HostPanel_GetStats(&ps);
+    printf("  window past GRAM: %llu written, %llu clipped, madctl writes %u\r\n",
+           (unsigned long long)ps.pixels, (unsigned long long)ps.pixels_clipped, ps.madctl_writes);
+    if (ps.pixels != 10 || ps.pixels_clipped != 10 || ps.madctl_writes != 1 ||
+        HostPanel_GetGramPixel(239, 0) != 0xABCD) {
+        errors++;
+    }
+    return errors;
+}
+
+/* ==================== 快照 ==================== */
+
+static uint8_t *Read_File(const char *path, long *size)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *data;
+
+    if (f == NULL) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc((size_t)*size);
+    if (data != NULL && fread(data, 1, (size_t)*size, f) != (size_t)*size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+static uint32_t Compare_RGB(const uint8_t *rgb, uint32_t stride, uint32_t skip)
+{
+    uint32_t mismatch = 0;
+
+    for (uint32_t y = 0; y < HOST_PANEL_VIEW_HEIGHT; y++) {
+        const uint8_t *p = rgb + y * stride + skip;
+        for (uint32_t x = 0; x < HOST_PANEL_VIEW_WIDTH; x++) {
+            uint16_t c = view[0][y][x];
+            mismatch += (p[x * 3] != Expand(c, 0) || p[x * 3 + 1] != Expand(c, 1) || p[x * 3 + 2] != Expand(c, 2));
+        }
+    }
+    return mismatch;
+}
+
+/* 只解析 HostPanel_SavePNG 写出的格式：一个IDAT，zlib中全部是不压缩块 */
+static uint32_t Check_PNG(const uint8_t *png, long size)
+{
+    static uint8_t raw[HOST_PANEL_VIEW_HEIGHT * (1 + HOST_PANEL_VIEW_WIDTH * 3)];
+    const uint8_t *idat;
+    uint32_t len, n = 0, pos = 2;
+
+    if (size < 57 || memcmp(png, "\x89PNG\r\n\x1a\n", 8) != 0 || memcmp(png + 12, "IHDR", 4) != 0 ||
+        png[19] != HOST_PANEL_VIEW_WIDTH || png[23] != HOST_PANEL_VIEW_HEIGHT || memcmp(png + 37, "IDAT", 4) != 0) {
+        return 1;
+    }
+    len = ((uint32_t)png[33] << 24) | ((uint32_t)png[34] << 16) | ((uint32_t)png[35] << 8) | png[36];
+    idat = png + 41;
+    for (;;) {
+        uint32_t blen = idat[pos + 1] | ((uint32_t)idat[pos + 2] << 8);
+        bool final = idat[pos] & 1U;
+
+        if (n + blen > sizeof(raw) || pos + 5 + blen > len) {
+            return 1;
+        }
+        memcpy(raw + n, idat + pos + 5, blen);
+        n += blen;
+        pos += 5 + blen;
+        if (final) {
+            break;
+        }
+    }
+    if (n != sizeof(raw) || memcmp(png + size - 8, "IEND", 4) != 0) {
+        return 1;
+    }
+    return Compare_RGB(raw, 1 + HOST_PANEL_VIEW_WIDTH * 3, 1);
+}
+
+static uint32_t Test_Snapshots(void)
+{
+    uint32_t errors = 0, ppm_err = 1, png_err = 1;
+    uint8_t *data;
+    long size = 0;
+
+    HostPanel_Reset();
+    LCD_SetDirection(Direction_H_Flip);
+    Draw_Scene();
+
+    if (HostPanel_SavePPM("host_panel_sim.ppm") && (data = Read_File("host_panel_sim.ppm", &size)) != NULL) {
+        const char *header = "P6\n240 240\n255\n";
+        size_t hl = strlen(header);
+        ppm_err = (size == (long)(hl + HOST_PANEL_VIEW_WIDTH * HOST_PANEL_VIEW_HEIGHT * 3) &&
+                   memcmp(data, header, hl) == 0) ? Compare_RGB(data + hl, HOST_PANEL_VIEW_WIDTH * 3, 0) : 1;
+        free(data);
+    }
+    if (HostPanel_SavePNG("host_panel_sim.png") && (data = Read_File("host_panel_sim.png", &size)) != NULL) {
+        png_err = Check_PNG(data, size);
+        free(data);
+    }
+    printf("  snapshots host_panel_sim.ppm / .png (%ld bytes): mismatch %u / %u\r\n", size, ppm_err, png_err);
+    if (ppm_err != 0 || png_err != 0) {
+        errors++;
+    }
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors = 0;
+
+    printf("=== ST7789 Panel Model (host) ===\r\n");
+
+    SPI_LCD_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+
+    errors += Test_Directions();
+    errors += Test_ByteCounts();
+    errors += Test_Snapshots();
+
+    LCD_SPI_DMA_DeInit(&hlcd_dma);
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,298 @@
+/**
+ ******************************************************************************
+ * @file    host_player.c
+ * @brief   主机端动画播放测试 - 片段解码正确性、三缓冲流水线与帧率控制
+ ******************************************************************************
+ * @note
+ *   - 用 host_clip_encode.c 生成测试动画（MJPEG、游程/差分）和开机动画，
+ *     逐帧解码：游程编码与原图的RGB565逐像素一致，MJPEG与 LCD_JPEG_Decode 单张解码一致且PSNR足够；
+ *     解码时参考帧与目标帧相同/不同两种情况都覆盖；损坏的片段返回错误
+ *   - 按30fps播放到模拟屏幕：帧数、提交间隔、迟到帧、最后一帧与屏幕一致
+ *   - 不限帧率播放：每帧时间接近SPI发送时间，即解码被DMA发送完全掩盖
+ *   - 循环播放时从另一个线程调用 LCD_Player_Stop
+ *   - 片段逐帧转PPM用 host_clipc -d
+ ******************************************************************************
+ */
+
+#include "lcd_player.h"
+#include "lcd_jpeg.h"
+#include "lcd_spi_dma.h"
+#include "host_clip_encode.h"
+#include "host_panel.h"
+#include "host_spi.h"
+#include "spi.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define TEST_FRAMES      60
+#define TEST_FPS         30
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+typedef struct {
+    const char *name;
+    LCD_Clip_Codec_t codec;
+    bool boot;
+    uint32_t key_interval;
+    uint8_t *data;
+    uint32_t size;
+    uint16_t *last;                 // 最后一帧的解码结果
+} Clip_Case_t;
+
+static Clip_Case_t cases[] = {
+    { "test RLE",  LCD_CLIP_RLE,  false, 20 },
+    { "test MJPEG", LCD_CLIP_JPEG, false, 0 },
+    { "boot RLE",  LCD_CLIP_RLE,  true,  0 },
+};
+
+static uint8_t rgb[LCD_WIDTH * LCD_HEIGHT * 3];
+static uint16_t src565[LCD_WIDTH * LCD_HEIGHT];
+static uint16_t single[LCD_WIDTH * LCD_HEIGHT];
+static uint16_t frames[3][LCD_WIDTH * LCD_HEIGHT];
+
+static void Make_Frame(const Clip_Case_t *c, uint32_t i)
+{
+    if (c->boot) {
+        HostClip_BootFrame(rgb, LCD_WIDTH, LCD_HEIGHT, i, TEST_FRAMES);
+    } else {
+        HostClip_TestFrame(rgb, LCD_WIDTH, LCD_HEIGHT, i);
+    }
+}
+
+static double PSNR_565(const uint16_t *a, const uint16_t *b, uint32_t n)
+{
+    double se = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        int dr = ((a[i] >> 11) & 0x1F) - ((b[i] >> 11) & 0x1F);
+        int dg = ((a[i] >> 5) & 0x3F) - ((b[i] >> 5) & 0x3F);
+        int db = (a[i] & 0x1F) - (b[i] & 0x1F);
+        se += (dr * 8.0) * (dr * 8.0) + (dg * 4.0) * (dg * 4.0) + (db * 8.0) * (db * 8.0);
+    }
+    return se == 0 ? 99.0 : 10.0 * log10(255.0 * 255.0 * 3.0 * n / se);
+}
+
+/* ==================== 编码与解码 ==================== */
+
+static uint32_t Test_Codec(Clip_Case_t *c)
+{
+    const uint32_t pixels = LCD_WIDTH * LCD_HEIGHT;
+    HostClip_t *enc = HostClip_New(c->codec, LCD_WIDTH, LCD_HEIGHT, 1000000U / TEST_FPS, 75, c->key_interval);
+    LCD_Clip_t clip;
+    uint32_t errors = 0, mismatch = 0, jpeg_diff = 0;
+    double psnr_min = 99.0;
+
+    for (uint32_t i = 0; i < TEST_FRAMES; i++) {
+        Make_Frame(c, i);
+        HostClip_AddFrame(enc, rgb);
+    }
+    c->data = HostClip_Finish(enc, &c->size);
+
+    if (LCD_Clip_Open(&clip, c->data, c->size) != HAL_OK || clip.header.frames != TEST_FRAMES) {
+        printf("  %-10s: open FAILED\r\n", c->name);
+        return 1;
+    }
+    /* 奇数帧解码到上一帧所在的缓冲区（跳过无需拷贝），偶数帧解码到另一个缓冲区 */
+    uint32_t prev = 0, cur = 0;
+    for (uint32_t i = 0; i < TEST_FRAMES; i++) {
+        uint32_t rec = clip.pos;
+        cur = (i & 1U) ? prev : (prev + 1U) % 3U;
+        if (LCD_Clip_DecodeNext(&clip, i ? frames[prev] : NULL, frames[cur]) != HAL_OK) {
+            printf("  %-10s: frame %u decode FAILED\r\n", c->name, i);
+            return 1;
+        }
+        Make_Frame(c, i);
+        HostClip_ToRGB565(rgb, src565, pixels);
+        if (c->codec == LCD_CLIP_RLE) {
+            mismatch += memcmp(frames[cur], src565, sizeof(src565)) != 0;
+        } else {
+            uint32_t len;
+            memcpy(&len, c->data + rec, 4);
+            LCD_JPEG_Decode(c->data + rec + 4, len & 0xFFFFFFU, single, LCD_WIDTH);
+            jpeg_diff += memcmp(frames[cur], single, sizeof(single)) != 0;
+            double p = PSNR_565(frames[cur], src565, pixels);
+            if (p < psnr_min) psnr_min = p;
+        }
+        prev = cur;
+    }
+    if (LCD_Clip_DecodeNext(&clip, frames[prev], frames[cur]) == HAL_OK) {
+        errors++;                                               // 没有更多帧
+    }
+    c->last = malloc(sizeof(single));
+    memcpy(c->last, frames[prev], sizeof(single));
+
+    printf("  %-10s: %u frames, %u bytes (%.0f bytes/frame, %.1fx smaller than RGB565)",
+           c->name, TEST_FRAMES, c->size, (double)c->size / TEST_FRAMES,
+           (double)TEST_FRAMES * pixels * 2 / c->size);
+    if (c->codec == LCD_CLIP_RLE) {
+        printf(", frames differing from source %u\r\n", mismatch);
+        if (mismatch != 0) errors++;
+    } else {
+        printf(", min PSNR %.1f dB, differing from single-image decode %u\r\n", psnr_min, jpeg_diff);
+        if (psnr_min < 28.0 || jpeg_diff != 0) errors++;
+    }
+    return errors;
+}
+
+static uint32_t Test_Corrupt(const Clip_Case_t *c)
+{
+    uint8_t *copy = aligned_alloc(4, (c->size + 3U) & ~3U);
+    LCD_Clip_t clip;
+    uint32_t errors = 0;
+
+    /* 文件头损坏 */
+    memcpy(copy, c->data, c->size);
+    copy[0] ^= 0xFF;
+    if (LCD_Clip_Open(&clip, copy, c->size) == HAL_OK) errors++;
+
+    /* 截断：最后一帧记录不完整 */
+    memcpy(copy, c->data, c->size);
+    if (LCD_Clip_Open(&clip, copy, c->size - 8U) != HAL_OK) errors++;
+    HAL_StatusTypeDef st = HAL_OK;
+    for (uint32_t i = 0; i < TEST_FRAMES && st == HAL_OK; i++) {
+        st = LCD_Clip_DecodeNext(&clip, frames[0], frames[0]);
+    }
+    if (st == HAL_OK) errors++;
+
+    /* 指令损坏：第一帧（关键帧）的第一个游程改为跳过 */
+    LCD_Clip_Open(&clip, copy, c->size);
+    copy[sizeof(LCD_Clip_Header_t) + 5] &= 0x3F;
+    if (LCD_Clip_DecodeNext(&clip, NULL, frames[0]) == HAL_OK) errors++;
+
+    /* 播放损坏的片段 */
+    if (LCD_Player_Play(&hlcd_dma, 0, 0, copy, 4, 0, 1) == HAL_OK) errors++;
+
+    printf("  bad input     : %s\r\n", errors == 0 ? "ok" : "FAILED");
+    free(copy);
+    return errors;
+}
+
+/* ==================== 播放 ==================== */
+
+static uint32_t Compare_Panel(const uint16_t *img)
+{
+    uint32_t mismatch = 0;
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            if (HostPanel_GetPixel(x, y) != img[y * LCD_WIDTH + x]) mismatch++;
+        }
+    }
+    return mismatch;
+}
+
+static double Avg_Ms(uint64_t cycles, uint32_t n)
+{
+    return n ? cycles / (SystemCoreClock / 1000.0) / n : 0.0;
+}
+
+static void Print_Stats(const char *name, const LCD_Player_Stats_t *s)
+{
+    printf("  %-10s: %u frames in %u ms (%.1f fps), late %u, err %u, %u buffers\r\n"
+           "               decode %.2f ms (max %.2f), transfer %.2f ms (max %.2f), "
+           "wait buffer %.2f ms, wait pace %.2f ms, interval %u..%u us\r\n",
+           name, s->frames, s->elapsed_ms, s->elapsed_ms ? s->frames * 1000.0 / s->elapsed_ms : 0.0,
+           s->late, s->errors, s->buffers,
+           Avg_Ms(s->decode_cycles, s->frames), Avg_Ms(s->decode_cycles_max, 1),
+           Avg_Ms(s->transfer_cycles, s->frames), Avg_Ms(s->transfer_cycles_max, 1),
+           Avg_Ms(s->buffer_wait_cycles, s->frames), Avg_Ms(s->pace_wait_cycles, s->frames),
+           s->interval_us_min, s->interval_us_max);
+}
+
+static uint32_t Test_Play(const Clip_Case_t *c)
+{
+    const uint32_t frame_us = 1000000U / TEST_FPS;
+    LCD_Player_Stats_t s;
+    uint32_t errors = 0, mismatch;
+
+    /* 按片段帧率播放 */
+    LCD_DMA_Clear(&hlcd_dma, 0x0000);
+    LCD_Player_ResetStats();
+    if (LCD_Player_Play(&hlcd_dma, 0, 0, c->data, c->size, 0, 1) != HAL_OK) errors++;
+    LCD_Player_GetStats(&s);
+    mismatch = Compare_Panel(c->last);
+    Print_Stats(c->name, &s);
+
+    // 第一帧提交到最后一帧发送完成 = (帧数-1)个帧间隔 + 一帧发送时间
+    double fps = (s.frames - 1) * 1000.0 / (s.elapsed_ms - Avg_Ms(s.transfer_cycles, s.frames));
+    printf("               paced %.1f fps, last frame mismatch %u\r\n", fps, mismatch);
+    if (s.frames != TEST_FRAMES || s.errors != 0 || s.buffers != 3 || mismatch != 0 ||
+        fps < TEST_FPS - 1.5 || fps > TEST_FPS + 1.5 || s.late > TEST_FRAMES / 10 ||
+        s.interval_us_min < frame_us / 2 || s.interval_us_max > frame_us * 2) {
+        errors++;
+    }
+
+    /* 不限帧率：帧间隔取1us，流水线下每帧时间由SPI发送决定 */
+    LCD_Player_ResetStats();
+    if (LCD_Player_Play(&hlcd_dma, 0, 0, c->data, c->size, 1, 1) != HAL_OK) errors++;
+    LCD_Player_GetStats(&s);
+    double transfer = Avg_Ms(s.transfer_cycles, s.frames), decode = Avg_Ms(s.decode_cycles, s.frames);
+    double per_frame = (double)s.elapsed_ms / s.frames;
+    printf("               uncapped %.2f ms/frame (transfer %.2f + decode %.2f serial = %.2f)\r\n",
+           per_frame, transfer, decode, transfer + decode);
+    if (s.frames != TEST_FRAMES || s.errors != 0 || per_frame > transfer * 1.08 + 0.3) {
+        errors++;
+    }
+    return errors;
+}
+
+static const Clip_Case_t *stop_case;
+
+static void Stopper_Task(void *argument)
+{
+    (void)argument;
+    osDelay(300);
+    LCD_Player_Stop();
+}
+
+static uint32_t Test_Stop(void)
+{
+    LCD_Player_Stats_t s;
+    uint32_t errors = 0;
+
+    LCD_Player_ResetStats();
+    osThreadNew(Stopper_Task, NULL, NULL);
+    if (LCD_Player_Play(&hlcd_dma, 0, 0, stop_case->data, stop_case->size, 0, 0) != HAL_OK) errors++;
+    LCD_Player_GetStats(&s);
+    printf("  stop          : loop stopped after %u frames, %u ms\r\n", s.frames, s.elapsed_ms);
+    if (s.frames < 6 || s.frames > 14 || s.errors != 0) errors++;
+
+    /* 帧缓冲模式下只有两个帧缓冲 */
+    LCD_SPI_DMA_EnableFrameBuffer(&hlcd_dma);
+    LCD_Player_ResetStats();
+    if (LCD_Player_Play(&hlcd_dma, 0, 0, stop_case->data, stop_case->size, 0, 1) != HAL_OK) errors++;
+    LCD_Player_GetStats(&s);
+    LCD_SPI_DMA_DisableFrameBuffer(&hlcd_dma);
+    printf("  frame buffer  : %u frames with %u buffers, late %u, mismatch %u\r\n",
+           s.frames, s.buffers, s.late, Compare_Panel(stop_case->last));
+    if (s.frames != TEST_FRAMES || s.buffers != 2 || s.errors != 0 || Compare_Panel(stop_case->last) != 0) errors++;
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors = 0;
+
+    printf("=== Clip Player (host) ===\r\n");
+
+    LCD_JPEG_Init();
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        errors += Test_Codec(&cases[i]);
+    }
+    errors += Test_Corrupt(&cases[0]);
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        errors += Test_Play(&cases[i]);
+    }
+    stop_case = &cases[1];
+    errors += Test_Stop();
+
+    LCD_SPI_DMA_DeInit(&hlcd_dma);
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
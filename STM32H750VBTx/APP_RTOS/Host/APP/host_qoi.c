@@ -0,0 +1,347 @@
+/**
+ ******************************************************************************
+ * @file    host_qoi.c
+ * @brief   主机端无损图片测试 - 编解码逐像素一致、压缩率、解码速度、逐行带经DMA双缓冲显示
+ ******************************************************************************
+ * @note
+ *   - 界面图、照片、噪声、纯色、图标和非整行带尺寸的图片编码后解码，要求与RGB565原图逐像素相同，
+ *     并检查目标缓冲区中图片之外的像素不被改写
+ *   - 截断、改写、多余或缺少数据时返回错误，不越界
+ *   - LCD_QOI_Draw 直接模式与帧缓冲模式显示到模拟屏幕与原图比较；
+ *     对比原始RGB565经 LCD_DMA_DrawImage 发送与逐行带解码发送的耗时，以及83x83图标网格
+ ******************************************************************************
+ */
+
+#include "lcd_qoi.h"
+#include "lcd_spi_dma.h"
+#include "host_qoi_encode.h"
+#include "host_clip_encode.h"
+#include "host_jpeg_encode.h"
+#include "host_panel.h"
+#include "host_spi.h"
+#include "spi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define TIMING_ROUNDS    20
+#define SENTINEL         0xA5A5U
+#define ICON_SIZE        83U
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+static uint8_t src_rgb[LCD_WIDTH * LCD_HEIGHT * 3];
+static uint16_t src_565[LCD_WIDTH * LCD_HEIGHT];
+static uint16_t out_buf[LCD_WIDTH * (LCD_HEIGHT + 1)];
+
+typedef enum { ART_UI, ART_PHOTO, ART_NOISE, ART_SOLID, ART_ICON } Art_t;
+
+typedef struct {
+    const char *name;
+    Art_t art;
+    uint16_t width;
+    uint16_t height;
+    double min_ratio;                       // 相对RGB565的最低压缩率
+} Case_t;
+
+static const Case_t cases[] = {
+    { "ui",    ART_UI,    240, 240, 8.0 },
+    { "photo", ART_PHOTO, 240, 240, 1.2 },
+    { "noise", ART_NOISE, 240, 240, 0.6 },
+    { "solid", ART_SOLID, 240, 240, 500.0 },
+    { "icon",  ART_ICON,   83,  83, 4.0 },
+    { "ui",    ART_UI,    131,  97, 4.0 },
+    { "photo", ART_PHOTO,   1, 240, 1.0 },
+    { "photo", ART_PHOTO, 240,   1, 1.0 },
+    { "solid", ART_SOLID,   1,   1, 0.0 },
+};
+
+static void Make_Art(Art_t art, uint16_t w, uint16_t h, uint16_t *img)
+{
+    static uint8_t rgb[LCD_WIDTH * LCD_HEIGHT * 3];
+
+    switch (art) {
+    case ART_UI:
+        HostQOI_TestArt(rgb, w, h);
+        break;
+    case ART_PHOTO:
+        for (uint16_t y = 0; y < h; y++) {
+            memcpy(&rgb[y * w * 3], &src_rgb[y * LCD_WIDTH * 3], w * 3U);
+        }
+        break;
+    case ART_NOISE: {
+        uint32_t seed = 12345;
+        for (uint32_t i = 0; i < (uint32_t)w * h * 3; i++) {
+            seed = seed * 1103515245U + 12345U;
+            rgb[i] = (uint8_t)(seed >> 16);
+        }
+        break;
+    }
+    case ART_SOLID:
+        for (uint32_t i = 0; i < (uint32_t)w * h; i++) {
+            rgb[i * 3] = 0x3C; rgb[i * 3 + 1] = 0x8D; rgb[i * 3 + 2] = 0xE8;
+        }
+        break;
+    case ART_ICON:
+        HostQOI_TestIcon(rgb, w, h, 1);
+        break;
+    }
+    HostClip_ToRGB565(rgb, img, (uint32_t)w * h);
+}
+
+/* ==================== 编解码 ==================== */
+
+static uint32_t Test_Codec(void)
+{
+    uint32_t errors = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const Case_t *tc = &cases[i];
+        uint32_t size, mismatch = 0, outside = 0;
+        uint16_t w, h;
+
+        Make_Art(tc->art, tc->width, tc->height, src_565);
+        uint8_t *qoi = HostQOI_Encode(src_565, tc->width, tc->height, &size);
+
+        if (LCD_QOI_GetInfo(qoi, size, &w, &h) != HAL_OK || w != tc->width || h != tc->height) {
+            printf("  %-5s %3ux%-3u: GetInfo FAILED\r\n", tc->name, tc->width, tc->height);
+            errors++;
+            free(qoi);
+            continue;
+        }
+
+        /* 目标 stride 比图片宽，检查图片之外不被改写 */
+        for (uint32_t p = 0; p < sizeof(out_buf) / sizeof(out_buf[0]); p++) out_buf[p] = SENTINEL;
+        HAL_StatusTypeDef st = LCD_QOI_Decode(qoi, size, out_buf, LCD_WIDTH);
+        for (uint32_t y = 0; y < LCD_HEIGHT + 1U; y++) {
+            for (uint32_t x = 0; x < LCD_WIDTH; x++) {
+                if (x < tc->width && y < tc->height) {
+                    if (out_buf[y * LCD_WIDTH + x] != src_565[y * tc->width + x]) mismatch++;
+                } else if (out_buf[y * LCD_WIDTH + x] != SENTINEL) {
+                    outside++;
+                }
+            }
+        }
+        double ratio = tc->width * tc->height * 2.0 / size;
+
+        printf("  %-5s %3ux%-3u: %6u bytes (%6.2f:1 vs RGB565), mismatch %u, outside %u\r\n",
+               tc->name, tc->width, tc->height, size, ratio, mismatch, outside);
+        if (st != HAL_OK || mismatch != 0 || outside != 0 || ratio < tc->min_ratio) {
+            errors++;
+        }
+        free(qoi);
+    }
+    return errors;
+}
+
+/* 损坏的数据返回错误，不越界 */
+static uint32_t Test_Errors(void)
+{
+    uint32_t errors = 0, size, outside = 0;
+    uint16_t w, h;
+
+    Make_Art(ART_UI, LCD_WIDTH, LCD_HEIGHT, src_565);
+    uint8_t *qoi = HostQOI_Encode(src_565, LCD_WIDTH, LCD_HEIGHT, &size);
+    uint8_t *copy = malloc(size + 16);
+    LCD_QOI_Header_t *hdr = (LCD_QOI_Header_t *)copy;
+
+    /* 文件头：魔数、尺寸为0、数据长度超出 */
+    memcpy(copy, qoi, size);
+    hdr->magic ^= 1U;
+    if (LCD_QOI_GetInfo(copy, size, &w, &h) != HAL_ERROR) errors++;
+    memcpy(copy, qoi, size);
+    hdr->width = 0;
+    if (LCD_QOI_GetInfo(copy, size, &w, &h) != HAL_ERROR) errors++;
+    if (LCD_QOI_GetInfo(qoi, size - 1, &w, &h) != HAL_ERROR) errors++;
+    if (LCD_QOI_GetInfo(qoi, 8, &w, &h) != HAL_ERROR) errors++;
+
+    /* 数据不足：截断在各个位置 */
+    for (uint32_t cut = 1; cut < size - sizeof(LCD_QOI_Header_t); cut += 97) {
+        memcpy(copy, qoi, size);
+        hdr->data_size -= cut;
+        if (LCD_QOI_Decode(copy, size - cut, out_buf, LCD_WIDTH) != HAL_ERROR) errors++;
+    }
+
+    /* 多余数据：尾部追加一个 RUN */
+    memcpy(copy, qoi, size);
+    copy[size] = LCD_QOI_OP_RUN;
+    hdr->data_size += 1;
+    if (LCD_QOI_Decode(copy, size + 1, out_buf, LCD_WIDTH) != HAL_ERROR) errors++;
+
+    /* 随机改写：只要求不越界（解码结果可能恰好合法） */
+    uint32_t seed = 1;
+    for (int round = 0; round < 200; round++) {
+        memcpy(copy, qoi, size);
+        for (int k = 0; k < 4; k++) {
+            seed = seed * 1103515245U + 12345U;
+            copy[sizeof(LCD_QOI_Header_t) + (seed >> 8) % (size - sizeof(LCD_QOI_Header_t))] ^= (uint8_t)(seed >> 24) | 1U;
+        }
+        for (uint32_t p = LCD_WIDTH * LCD_HEIGHT; p < LCD_WIDTH * (LCD_HEIGHT + 1U); p++) out_buf[p] = SENTINEL;
+        LCD_QOI_Decode(copy, size, out_buf, LCD_WIDTH);
+        for (uint32_t p = LCD_WIDTH * LCD_HEIGHT; p < LCD_WIDTH * (LCD_HEIGHT + 1U); p++) {
+            if (out_buf[p] != SENTINEL) outside++;
+        }
+    }
+    if (outside != 0) errors++;
+
+    /* 超出屏幕 */
+    if (LCD_QOI_Draw(&hlcd_dma, 1, 0, qoi, size) != HAL_ERROR) errors++;
+
+    printf("  bad input     : %s\r\n", errors == 0 ? "ok" : "FAILED");
+    free(copy);
+    free(qoi);
+    return errors;
+}
+
+/* ==================== 显示 ==================== */
+
+static uint32_t Compare_Panel(const uint16_t *img, uint16_t stride, uint16_t x0, uint16_t y0, uint16_t w, uint16_t h)
+{
+    uint32_t mismatch = 0;
+    for (uint16_t y = 0; y < h; y++) {
+        for (uint16_t x = 0; x < w; x++) {
+            if (HostPanel_GetPixel(x0 + x, y0 + y) != img[y * stride + x]) mismatch++;
+        }
+    }
+    return mismatch;
+}
+
+static double Elapsed_Ms(uint64_t t0, uint32_t rounds)
+{
+    return (HostSPI_NowNs() - t0) / 1e6 / rounds;
+}
+
+static uint32_t Test_Draw(void)
+{
+    uint32_t errors = 0, size, m_direct, m_icons = 0, m_fb;
+    static uint16_t icons_565[6][ICON_SIZE * ICON_SIZE];
+    static uint8_t icon_rgb[ICON_SIZE * ICON_SIZE * 3];
+    uint8_t *icons[6];
+    uint32_t icon_size[6], icons_total = 0;
+    LCD_QOI_Stats_t stats;
+    HostSPI_Stats_t spi;
+
+    Make_Art(ART_UI, LCD_WIDTH, LCD_HEIGHT, src_565);
+    uint8_t *qoi = HostQOI_Encode(src_565, LCD_WIDTH, LCD_HEIGHT, &size);
+    for (uint32_t i = 0; i < 6; i++) {
+        HostQOI_TestIcon(icon_rgb, ICON_SIZE, ICON_SIZE, i);
+        HostClip_ToRGB565(icon_rgb, icons_565[i], ICON_SIZE * ICON_SIZE);
+        icons[i] = HostQOI_Encode(icons_565[i], ICON_SIZE, ICON_SIZE, &icon_size[i]);
+        icons_total += icon_size[i];
+    }
+
+    /* 直接模式：整屏背景，之后 3x2 图标网格（三个83像素宽的图标放不下，相邻图标重叠5列） */
+    LCD_DMA_Clear(&hlcd_dma, 0x0000);
+    HostSPI_ResetStats();
+    LCD_QOI_ResetStats();
+    if (LCD_QOI_Draw(&hlcd_dma, 0, 0, qoi, size) != HAL_OK) errors++;
+    m_direct = Compare_Panel(src_565, LCD_WIDTH, 0, 0, LCD_WIDTH, LCD_HEIGHT);
+    HostSPI_GetStats(&spi);
+    for (uint32_t i = 0; i < 6; i++) {
+        uint16_t x = (uint16_t)((i % 3) * 78U), y = (uint16_t)((i / 3) * 120U + 20U);
+        if (LCD_QOI_Draw(&hlcd_dma, x, y, icons[i], icon_size[i]) != HAL_OK) errors++;
+        m_icons += Compare_Panel(icons_565[i], ICON_SIZE, x, y, ICON_SIZE, ICON_SIZE);
+    }
+    LCD_QOI_GetStats(&stats);
+
+    /* 帧缓冲模式：背景加中间一个图标 */
+    LCD_SPI_DMA_EnableFrameBuffer(&hlcd_dma);
+    LCD_FB_Clear(&hlcd_dma, 0x0000);
+    LCD_QOI_Draw(&hlcd_dma, 0, 0, qoi, size);
+    LCD_QOI_Draw(&hlcd_dma, 78, 78, icons[4], icon_size[4]);
+    LCD_SPI_DMA_FlushFrameBuffer(&hlcd_dma);
+    memcpy(out_buf, src_565, sizeof(src_565));
+    for (uint16_t y = 0; y < ICON_SIZE; y++) {
+        memcpy(&out_buf[(78 + y) * LCD_WIDTH + 78], &icons_565[4][y * ICON_SIZE], ICON_SIZE * sizeof(uint16_t));
+    }
+    m_fb = Compare_Panel(out_buf, LCD_WIDTH, 0, 0, LCD_WIDTH, LCD_HEIGHT);
+    LCD_SPI_DMA_DisableFrameBuffer(&hlcd_dma);
+
+    printf("  draw direct   : 240x240 mismatch %u (%u bytes on SPI, %u DMA), 6 icons 83x83 mismatch %u, images %u errors %u\r\n",
+           m_direct, (unsigned)spi.data_bytes, (unsigned)spi.dma_transfers, m_icons, stats.images, stats.errors);
+    printf("  draw FB       : mismatch %u\r\n", m_fb);
+    if (m_direct != 0 || m_icons != 0 || m_fb != 0 || stats.images != 7 || stats.errors != 0 ||
+        spi.data_bytes < LCD_WIDTH * LCD_HEIGHT * 2U) {
+        errors++;
+    }
+
+    /* 解码速度：只解码（不发送），按输出RGB565字节计；界面图以游程为主，照片以差分为主 */
+    uint64_t t0 = HostSPI_NowNs();
+    for (int i = 0; i < TIMING_ROUNDS; i++) LCD_QOI_Decode(qoi, size, out_buf, LCD_WIDTH);
+    double t_decode = Elapsed_Ms(t0, TIMING_ROUNDS);
+
+    uint32_t photo_size;
+    Make_Art(ART_PHOTO, LCD_WIDTH, LCD_HEIGHT, out_buf);
+    uint8_t *photo = HostQOI_Encode(out_buf, LCD_WIDTH, LCD_HEIGHT, &photo_size);
+    t0 = HostSPI_NowNs();
+    for (int i = 0; i < TIMING_ROUNDS; i++) LCD_QOI_Decode(photo, photo_size, out_buf, LCD_WIDTH);
+    double t_photo = Elapsed_Ms(t0, TIMING_ROUNDS);
+    free(photo);
+
+    /* 整屏：原始RGB565经DMA双缓冲发送、逐行带解码发送 */
+    t0 = HostSPI_NowNs();
+    for (int i = 0; i < TIMING_ROUNDS; i++) LCD_DMA_DrawImage(&hlcd_dma, 0, 0, LCD_WIDTH, LCD_HEIGHT, src_565);
+    double t_raw = Elapsed_Ms(t0, TIMING_ROUNDS);
+
+    t0 = HostSPI_NowNs();
+    for (int i = 0; i < TIMING_ROUNDS; i++) LCD_QOI_Draw(&hlcd_dma, 0, 0, qoi, size);
+    double t_qoi = Elapsed_Ms(t0, TIMING_ROUNDS);
+
+    /* 图标网格 */
+    t0 = HostSPI_NowNs();
+    for (int i = 0; i < TIMING_ROUNDS; i++) {
+        for (uint32_t k = 0; k < 6; k++) {
+            LCD_DMA_DrawImage(&hlcd_dma, (uint16_t)((k % 3) * 78U), (uint16_t)((k / 3) * 120U + 20U),
+                              ICON_SIZE, ICON_SIZE, icons_565[k]);
+        }
+    }
+    double t_icons_raw = Elapsed_Ms(t0, TIMING_ROUNDS);
+
+    t0 = HostSPI_NowNs();
+    for (int i = 0; i < TIMING_ROUNDS; i++) {
+        for (uint32_t k = 0; k < 6; k++) {
+            LCD_QOI_Draw(&hlcd_dma, (uint16_t)((k % 3) * 78U), (uint16_t)((k / 3) * 120U + 20U), icons[k], icon_size[k]);
+        }
+    }
+    double t_icons = Elapsed_Ms(t0, TIMING_ROUNDS);
+
+    printf("  full screen   : raw %u bytes, QOI565 %u bytes (%.1fx smaller)\r\n",
+           LCD_WIDTH * LCD_HEIGHT * 2U, size, LCD_WIDTH * LCD_HEIGHT * 2.0 / size);
+    printf("  6 icons       : raw %u bytes, QOI565 %u bytes (%.1fx smaller)\r\n",
+           6U * ICON_SIZE * ICON_SIZE * 2U, icons_total, 6.0 * ICON_SIZE * ICON_SIZE * 2 / icons_total);
+    printf("  decode only   : ui %.3f ms/frame (%.0f MB/s), photo %.3f ms/frame (%.0f MB/s)\r\n",
+           t_decode, LCD_WIDTH * LCD_HEIGHT * 2.0 / (t_decode * 1e3), t_photo, LCD_WIDTH * LCD_HEIGHT * 2.0 / (t_photo * 1e3));
+    printf("  time per frame: raw DrawImage %.2f ms, QOI Draw %.2f ms; icons raw %.2f ms, QOI %.2f ms (SPI %u Hz)\r\n",
+           t_raw, t_qoi, t_icons_raw, t_icons, TEST_SPI_CLOCK);
+    /* 解码与SPI发送重叠：总时间接近原始图片发送 */
+    if (t_qoi > (t_raw + t_decode) * 1.1 + 1.0 || t_icons > (t_icons_raw + 6 * t_decode) * 1.1 + 1.0) {
+        errors++;
+    }
+
+    for (uint32_t i = 0; i < 6; i++) free(icons[i]);
+    free(qoi);
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors = 0;
+
+    printf("=== QOI565 Lossless Image (host) ===\r\n");
+
+    HostJPEG_TestImage(src_rgb, LCD_WIDTH, LCD_HEIGHT);
+
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    LCD_SPI_DMA_Init(&hlcd_dma, &hspi4);
+
+    errors += Test_Codec();
+    errors += Test_Errors();
+    errors += Test_Draw();
+
+    LCD_SPI_DMA_DeInit(&hlcd_dma);
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
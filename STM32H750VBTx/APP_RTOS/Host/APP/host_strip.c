@@ -0,0 +1,260 @@
+/**
+ ******************************************************************************
+ * @file    host_strip.c
+ * @brief   主机端行带渲染测试 - 按行带重复调用绘制回调与整帧绘制逐像素一致，内存与耗时统计
+ ******************************************************************************
+ * @note
+ *   - 场景：渐变背景、跨行带边界的卡片和图标、部分超出屏幕的图标、覆盖多个行带的半透明层、
+ *     线段/圆（游程光栅化）、显示列表中的文字，后画的覆盖先画的
+ *   - 参考图：同一个回调以整屏为画布调用一次；行带渲染经模拟SPI/DMA显示到屏幕模型后逐像素比较，
+ *     整屏和局部区域（行带高度不整除区域高度）各一次
+ *   - 统计：行带数、回调次数、峰值缓冲区字节数（与115KB帧缓冲比较）、
+ *     DMA_BLOCK 与 DMA_ASYNC 下每个行带的绘制/等待时间和帧时间
+ ******************************************************************************
+ */
+
+#include "lcd_strip.h"
+#include "lcd_display_list.h"
+#include "lcd_fonts.h"
+#include "host_qoi_encode.h"
+#include "host_clip_encode.h"
+#include "host_panel.h"
+#include "host_spi.h"
+#include "spi.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_SPI_CLOCK   60000000U
+#define TIMING_FRAMES    10
+#define ICON_SIZE        83U
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+static LCD_SPI_DMA_V2_Handle_t hlcd_v2;
+static LCD_DisplayList_t dl;
+static uint16_t icon[2][ICON_SIZE * ICON_SIZE];
+static uint16_t reference[LCD_FULL_FRAME_SIZE];
+
+typedef struct {
+    uint32_t calls;             // 回调次数
+    uint32_t work;              // 重负载场景每像素的运算量
+} Scene_t;
+
+/* ==================== 场景 ==================== */
+
+static void Draw_Scene(LCD_Strip_Canvas_t *c, void *ctx)
+{
+    Scene_t *s = (Scene_t *)ctx;
+    LCD_Raster_t r;
+
+    s->calls++;
+    LCD_Strip_GradientRect(c, 0, 0, LCD_WIDTH_V2, LCD_HEIGHT_V2, 0x18C9, 0x4A9F);
+    LCD_Strip_FillRect(c, 0, 0, LCD_WIDTH_V2, 28, 0x2B7B);
+
+    // 2x2 卡片，上下两排分别跨过第80、160行
+    for (int i = 0; i < 4; i++) {
+        int16_t x = (int16_t)(10 + (i & 1) * 115), y = (int16_t)(40 + (i >> 1) * 100);
+        LCD_Strip_FillRect(c, x, y, 105, 90, 0xC69A);
+        LCD_Strip_FillRect(c, x + 1, y + 1, 103, 88, 0xF7BE);
+    }
+    LCD_Strip_DrawImage(c, 21, 44, ICON_SIZE, ICON_SIZE, icon[0]);
+    LCD_Strip_DrawImage(c, 190, 120, ICON_SIZE, ICON_SIZE, icon[1]);    // 右侧超出屏幕
+    LCD_Strip_DrawImage(c, -30, 200, ICON_SIZE, ICON_SIZE, icon[1]);    // 左下角超出屏幕
+
+    // 半透明层覆盖三个行带
+    LCD_Strip_BlendRect(c, 30, 60, 180, 150, 0x001F, 10);
+
+    LCD_Strip_Raster(c, &r);
+    LCD_Raster_Line(&r, 0, 239, 239, 30, 0xF800);
+    LCD_Raster_Circle(&r, 120, 130, 95, 0xFFE0);
+    LCD_Raster_LineAA(&r, 5, 35, 235, 225, 0x07E0, 0x39E7);
+
+    // 文字等由显示列表合成
+    LCD_DL_RasterBand(&dl, c->buf, c->x0, c->y0, c->width, c->rows);
+}
+
+/* 重负载：每个像素 work 次整数运算，用于观察合成与发送的重叠 */
+static void Draw_Heavy(LCD_Strip_Canvas_t *c, void *ctx)
+{
+    Scene_t *s = (Scene_t *)ctx;
+
+    s->calls++;
+    for (uint16_t y = 0; y < c->rows; y++) {
+        for (uint16_t x = 0; x < c->width; x++) {
+            uint32_t v = ((c->x0 + x) * 7U) ^ ((c->y0 + y) * 13U);
+            for (uint32_t k = 0; k < s->work; k++) {
+                v = v * 1103515245U + 12345U;
+            }
+            c->buf[y * c->width + x] = (uint16_t)(v >> 16);
+        }
+    }
+}
+
+static void Build_Scene(void)
+{
+    static uint8_t rgb[ICON_SIZE * ICON_SIZE * 3];
+
+    for (uint32_t i = 0; i < 2; i++) {
+        HostQOI_TestIcon(rgb, ICON_SIZE, ICON_SIZE, i + 1U);
+        HostClip_ToRGB565(rgb, icon[i], ICON_SIZE * ICON_SIZE);
+    }
+    LCD_DL_Begin(&dl, false, 0);
+    LCD_DL_Text(&dl, 8, 2, "Strip render", &ASCII_Font24, NULL, 0xFFFF, 0x2B7B);
+    LCD_DL_Text(&dl, 40, 72, "80 lines", &ASCII_Font24, NULL, 0x0000, 0xF7BE);     // 跨第80行
+    LCD_DL_FillCircle(&dl, 180, 160, 20, 0xFD20);                                  // 跨第160行
+}
+
+/* 整屏为画布调用一次回调，作为参考图 */
+static void Draw_Reference(LCD_Strip_Draw_t draw, void *ctx)
+{
+    LCD_Strip_Canvas_t c = { reference, 0, 0, LCD_WIDTH_V2, LCD_HEIGHT_V2, 0 };
+    draw(&c, ctx);
+}
+
+static uint32_t Compare_Panel(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, uint16_t outside)
+{
+    uint32_t mismatch = 0;
+
+    for (uint16_t y = 0; y < LCD_HEIGHT_V2; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH_V2; x++) {
+            bool inside = x >= x0 && x < x0 + w && y >= y0 && y < y0 + h;
+            if (HostPanel_GetPixel(x, y) != (inside ? reference[y * LCD_WIDTH_V2 + x] : outside)) {
+                mismatch++;
+            }
+        }
+    }
+    return mismatch;
+}
+
+/* ==================== 正确性 ==================== */
+
+static uint32_t Test_Correctness(void)
+{
+    static const struct { uint16_t x, y, w, h; uint32_t bands; } regions[3] = {
+        { 0, 0, LCD_WIDTH_V2, LCD_HEIGHT_V2, 3 },   // 整屏：3个80行的行带
+        { 20, 15, 200, 210, 3 },                    // 96 + 96 + 18 行
+        { 50, 70, 130, 100, 1 },                    // 一个行带即可容纳，只用一块缓冲区
+    };
+    uint32_t errors = 0;
+    Scene_t scene = { 0 };
+    LCD_Strip_Stats_t stats;
+
+    Draw_Reference(Draw_Scene, &scene);
+    LCD_V2_Init(&hlcd_v2, &hspi4, LCD_TRANSFER_DMA_ASYNC);
+
+    for (int i = 0; i < 3; i++) {
+        LCD_V2_Clear(&hlcd_v2, 0x0000);
+        // 清屏用满了两块缓冲区，重新初始化以重新填充水位标记
+        LCD_V2_DeInit(&hlcd_v2);
+        LCD_V2_Init(&hlcd_v2, &hspi4, LCD_TRANSFER_DMA_ASYNC);
+        if (LCD_V2_GetBufferHighWater(0) + LCD_V2_GetBufferHighWater(1) != 0) {
+            errors++;   // 刚填充的标记未被改写
+        }
+        LCD_Strip_ResetStats();
+        scene.calls = 0;
+        HAL_StatusTypeDef st = LCD_Strip_Render(&hlcd_v2, regions[i].x, regions[i].y, regions[i].w, regions[i].h,
+                                                Draw_Scene, &scene);
+        LCD_Strip_GetStats(&stats);
+        uint32_t mismatch = Compare_Panel(regions[i].x, regions[i].y, regions[i].w, regions[i].h, 0x0000);
+        uint32_t expect_ram = (regions[i].bands > 1 ? 2U : 1U) * (LCD_SINGLE_BUFFER_SIZE / regions[i].w) * regions[i].w * 2U;
+        if (regions[i].h < LCD_SINGLE_BUFFER_SIZE / regions[i].w) {
+            expect_ram = (uint32_t)regions[i].w * regions[i].h * 2U;
+        }
+
+        printf("  %3ux%-3u at (%3u,%3u): st %d, mismatch %u, bands %u, calls %u, buffer high-water %u of %u linked bytes\r\n",
+               regions[i].w, regions[i].h, regions[i].x, regions[i].y, st, mismatch,
+               stats.bands, scene.calls, stats.peak_ram, stats.linked_ram);
+        if (st != HAL_OK || mismatch != 0 || stats.bands != regions[i].bands || scene.calls != regions[i].bands ||
+            stats.frames != 1 || stats.errors != 0 || stats.peak_ram != expect_ram ||
+            stats.linked_ram != LCD_SINGLE_BUFFER_SIZE * 2U * 2U) {
+            errors++;
+        }
+    }
+
+    /* 参数错误 */
+    LCD_Strip_ResetStats();
+    if (LCD_Strip_Render(&hlcd_v2, 100, 0, 200, 10, Draw_Scene, &scene) != HAL_ERROR ||
+        LCD_Strip_Render(&hlcd_v2, 0, 0, 10, 10, NULL, NULL) != HAL_ERROR) {
+        errors++;
+    }
+    LCD_Strip_GetStats(&stats);
+    if (stats.errors != 2) {
+        errors++;
+    }
+
+    LCD_V2_DeInit(&hlcd_v2);
+    return errors;
+}
+
+/* ==================== 内存与耗时 ==================== */
+
+static double Cycles_Us(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1e6);
+}
+
+static double Measure(LCD_TransferMode_t mode, uint32_t work, LCD_Strip_Stats_t *stats)
+{
+    Scene_t scene = { 0, work };
+
+    LCD_V2_Init(&hlcd_v2, &hspi4, mode);
+    LCD_Strip_ResetStats();
+    uint64_t t0 = HostSPI_NowNs();
+    for (int i = 0; i < TIMING_FRAMES; i++) {
+        LCD_Strip_Render(&hlcd_v2, 0, 0, LCD_WIDTH_V2, LCD_HEIGHT_V2, Draw_Heavy, &scene);
+    }
+    double frame_ms = (HostSPI_NowNs() - t0) / 1e6 / TIMING_FRAMES;
+    LCD_Strip_GetStats(stats);
+    LCD_V2_DeInit(&hlcd_v2);
+    return frame_ms;
+}
+
+static uint32_t Test_Timing(void)
+{
+    static const char *const names[2] = { "DMA_BLOCK", "DMA_ASYNC" };
+    LCD_Strip_Stats_t stats[2];
+    double frame_ms[2];
+    uint32_t errors = 0, work = 300;     // 每个行带的合成时间与发送时间（约5ms）相当
+
+    frame_ms[0] = Measure(LCD_TRANSFER_DMA_BLOCK, work, &stats[0]);
+    frame_ms[1] = Measure(LCD_TRANSFER_DMA_ASYNC, work, &stats[1]);
+
+    for (int m = 0; m < 2; m++) {
+        printf("  %-9s: frame %.2f ms, buffer high-water %u of %u linked bytes (frame buffer %u), errors %u\r\n",
+               names[m], frame_ms[m], stats[m].peak_ram, stats[m].linked_ram,
+               (unsigned)(LCD_FULL_FRAME_SIZE * 2U), stats[m].errors);
+        for (uint32_t b = 0; b < stats[m].bands; b++) {
+            printf("             band %u y %3u rows %2u: draw %7.1f us, wait %7.1f us\r\n", b,
+                   stats[m].band[b].y, stats[m].band[b].rows,
+                   Cycles_Us(stats[m].band[b].draw_cycles), Cycles_Us(stats[m].band[b].wait_cycles));
+        }
+        if (stats[m].frames != TIMING_FRAMES || stats[m].errors != 0 || stats[m].bands != LCD_STRIP_MAX_BANDS ||
+            stats[m].peak_ram != LCD_SINGLE_BUFFER_SIZE * 2U * 2U) {
+            errors++;
+        }
+    }
+    // 异步模式下合成下一个行带与发送上一个重叠
+    printf("  async/block frame time %.2f\r\n", frame_ms[1] / frame_ms[0]);
+    if (frame_ms[1] > frame_ms[0] * 0.85) {
+        errors++;
+    }
+    return errors;
+}
+
+int main(void)
+{
+    uint32_t errors = 0;
+
+    printf("=== Strip Rendering (host, SPI %u MHz) ===\r\n", TEST_SPI_CLOCK / 1000000U);
+
+    MX_SPI4_Init();
+    HostSPI_SetClock(TEST_SPI_CLOCK);
+    HostPanel_Attach();
+    Build_Scene();
+
+    errors += Test_Correctness();
+    errors += Test_Timing();
+
+    printf("%s\r\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+/**
+ ******************************************************************************
+ * @file    cmsis_os2.h (Host)
+ * @brief   主机端CMSIS-RTOS2替身 - 基于pthread实现LCD驱动用到的子集
+ ******************************************************************************
+ */
+
+#ifndef __HOST_CMSIS_OS2_H
+#define __HOST_CMSIS_OS2_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void *osThreadId_t;
+
+typedef enum {
+    osOK                    =  0,
+    osError                 = -1,
+    osErrorTimeout          = -2,
+    osErrorResource         = -3,
+    osErrorParameter        = -4
+} osStatus_t;
+
+typedef enum {
+    osKernelInactive        =  0,
+    osKernelReady           =  1,
+    osKernelRunning         =  2
+} osKernelState_t;
+
+#define osWaitForever         0xFFFFFFFFU
+
+/* 线程标志 */
+#define osFlagsWaitAny        0x00000000U
+#define osFlagsWaitAll        0x00000001U
+#define osFlagsNoClear        0x00000002U
+#define osFlagsError          0x80000000U
+#define osFlagsErrorUnknown   0xFFFFFFFFU
+#define osFlagsErrorTimeout   0xFFFFFFFEU
+#define osFlagsErrorResource  0xFFFFFFFDU
+#define osFlagsErrorParameter 0xFFFFFFFCU
+
+typedef void (*osThreadFunc_t)(void *argument);
+typedef void *osMessageQueueId_t;
+
+typedef enum {
+    osPriorityLow           =  8,
+    osPriorityBelowNormal   = 16,
+    osPriorityNormal        = 24,
+    osPriorityAboveNormal   = 32,
+    osPriorityHigh          = 40,
+    osPriorityRealtime      = 48
+} osPriority_t;
+
+/* 只用到 name/stack_size/priority，主机上忽略栈大小和优先级 */
+typedef struct {
+    const char   *name;
+    uint32_t      attr_bits;
+    void         *cb_mem;
+    uint32_t      cb_size;
+    void         *stack_mem;
+    uint32_t      stack_size;
+    osPriority_t  priority;
+} osThreadAttr_t;
+
+typedef struct {
+    const char   *name;
+    uint32_t      attr_bits;
+    void         *cb_mem;
+    uint32_t      cb_size;
+    void         *mq_mem;
+    uint32_t      mq_size;
+} osMessageQueueAttr_t;
+
+osStatus_t      osDelay(uint32_t ticks);
+osStatus_t      osThreadYield(void);
+osThreadId_t    osThreadGetId(void);
+osKernelState_t osKernelGetState(void);
+uint32_t        osKernelGetTickCount(void);
+osThreadId_t    osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+
+/* 线程标志：osThreadFlagsSet 可在模拟的中断上下文中调用 */
+uint32_t        osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags);
+uint32_t        osThreadFlagsClear(uint32_t flags);
+uint32_t        osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout);
+
+/* 消息队列：timeout 为0时不阻塞，可在模拟的中断上下文中调用 */
+osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr);
+osStatus_t         osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout);
+osStatus_t         osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout);
+uint32_t           osMessageQueueGetCount(osMessageQueueId_t mq_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HOST_CMSIS_OS2_H */
@@ -0,0 +1,50 @@
+/**
+ ******************************************************************************
+ * @file    host_clip_encode.h
+ * @brief   主机端动画片段编码器 - 生成 lcd_player.h 的片段（MJPEG 或 RGB565游程/差分）
+ ******************************************************************************
+ * @note
+ *   - 逐帧加入 RGB888 图像，结束时得到完整片段
+ *   - 游程编码：关键帧间隔内的其它帧只记录与上一帧不同的像素
+ *   - host_clipc（片段转换/解码为PPM）和主机端测试程序共用
+ ******************************************************************************
+ */
+
+#ifndef __HOST_CLIP_ENCODE_H
+#define __HOST_CLIP_ENCODE_H
+
+#include <stdint.h>
+#include "lcd_player.h"
+
+typedef struct HostClip HostClip_t;
+
+/**
+ * @param quality      JPEG质量（1~100），游程编码忽略
+ * @param key_interval 游程编码的关键帧间隔，0 为只有第一帧是关键帧
+ */
+HostClip_t *HostClip_New(LCD_Clip_Codec_t codec, uint16_t width, uint16_t height,
+                         uint32_t frame_us, int quality, uint32_t key_interval);
+
+/* 加入一帧 RGB888 图像（每像素 R,G,B 三字节，按行排列） */
+int HostClip_AddFrame(HostClip_t *clip, const uint8_t *rgb);
+
+/**
+ * @brief 结束编码并释放编码器
+ * @retval malloc 得到的片段
+ */
+uint8_t *HostClip_Finish(HostClip_t *clip, uint32_t *size);
+
+/* RGB888 -> RGB565（截断，与 lcd_jpeg 的输出一致） */
+void HostClip_ToRGB565(const uint8_t *rgb, uint16_t *out, uint32_t pixels);
+
+/* 测试动画：JPEG测试图上弹跳的球和转动的指针 */
+void HostClip_TestFrame(uint8_t *rgb, uint16_t width, uint16_t height, uint32_t index);
+
+/* 开机动画：深色背景上转动的12点加载圈和进度条，共 frames 帧 */
+void HostClip_BootFrame(uint8_t *rgb, uint16_t width, uint16_t height, uint32_t index, uint32_t frames);
+
+/* PPM（P6，maxval 255）读写 */
+uint8_t *HostClip_LoadPPM(const char *path, uint16_t *width, uint16_t *height);
+int      HostClip_SavePPM(const char *path, const uint16_t *rgb565, uint16_t width, uint16_t height);
+
+#endif /* __HOST_CLIP_ENCODE_H */
@@ -0,0 +1,61 @@
+/**
+ ******************************************************************************
+ * @file    host_font_encode.h
+ * @brief   主机端压缩字库编码器 - 生成 lcd_font_blob.h 描述的字库文件
+ ******************************************************************************
+ * @note
+ *   - 字模按 bpp 输入：每行 (width*bpp+7)/8 字节，字节内低位在前（1bpp时与 lcd_fonts.c 相同）
+ *   - 2/4bpp为抗锯齿字库，像素值0为背景、最大值为前景
+ *   - host_fontc（BDF/TTF转换工具）和主机端测试程序共用
+ ******************************************************************************
+ */
+
+#ifndef __HOST_FONT_ENCODE_H
+#define __HOST_FONT_ENCODE_H
+
+#include <stdint.h>
+#include "lcd_font_blob.h"
+
+/* 待编码的字符 */
+typedef struct {
+    uint16_t code;
+    uint8_t  width;
+    uint8_t *bits;              // height 行点阵
+} HostFont_Glyph_t;
+
+/* 待编码的字库 */
+typedef struct {
+    uint16_t height;
+    uint8_t  bpp;               // 1、2或4，HostFont_Init 默认为1
+    uint16_t default_code;
+    uint32_t count;
+    uint32_t capacity;
+    HostFont_Glyph_t *glyphs;
+} HostFont_t;
+
+/* 编码统计 */
+typedef struct {
+    uint32_t raw_bytes;         // 全部按原始点阵存放时的字模字节数
+    uint32_t data_bytes;        // 实际字模区字节数
+    uint32_t rle_glyphs;        // 采用RLE编码的字符数
+    uint32_t blob_bytes;        // 整个字库文件字节数
+} HostFont_Stats_t;
+
+void HostFont_Init(HostFont_t *font, uint16_t height);
+void HostFont_Free(HostFont_t *font);
+
+/* 添加字符（复制点阵），同一编码重复添加时保留第一次的 */
+int  HostFont_Add(HostFont_t *font, uint16_t code, uint8_t width, const uint8_t *bits);
+
+/* 添加方框字符并设为默认字符 */
+void HostFont_AddBox(HostFont_t *font, uint16_t code, uint8_t width);
+
+/* 编码一个字符，返回字节数；encoding 输出采用的编码方式。out 至少 (width*bpp+7)/8*height 字节
+ * 只有1bpp会采用RLE */
+uint32_t HostFont_EncodeGlyph(const uint8_t *bits, uint8_t width, uint16_t height, uint8_t bpp,
+                              uint8_t *out, uint8_t *encoding);
+
+/* 生成字库文件，返回 malloc 得到的缓冲区 */
+uint8_t *HostFont_Build(HostFont_t *font, uint32_t *size, HostFont_Stats_t *stats);
+
+#endif /* __HOST_FONT_ENCODE_H */
@@ -0,0 +1,31 @@
+/**
+ ******************************************************************************
+ * @file    host_jpeg_encode.h
+ * @brief   主机端基线JPEG编码器 - 生成 lcd_jpeg.h 支持的图片
+ ******************************************************************************
+ * @note
+ *   - 标准（Annex K）量化表按质量缩放，标准哈夫曼表
+ *   - 采样方式与 LCD_JPEG_Subsampling_t 相同，可选复位间隔
+ *   - host_jpegc（PPM转换工具）和主机端测试程序共用
+ ******************************************************************************
+ */
+
+#ifndef __HOST_JPEG_ENCODE_H
+#define __HOST_JPEG_ENCODE_H
+
+#include <stdint.h>
+#include "lcd_jpeg.h"
+
+/**
+ * @brief 编码 RGB888 图像（每像素 R,G,B 三字节，按行排列）
+ * @param quality 1~100
+ * @param restart_interval 每多少个MCU插入一个RSTn，0为不插入
+ * @retval malloc 得到的JPEG文件，失败返回NULL
+ */
+uint8_t *HostJPEG_Encode(const uint8_t *rgb, uint16_t width, uint16_t height, int quality,
+                         LCD_JPEG_Subsampling_t subsampling, uint16_t restart_interval, uint32_t *size);
+
+/* 测试图：天空渐变、云、太阳、草地纹理和房子组成的"照片"风格图像，缓冲区 width*height*3 字节 */
+void HostJPEG_TestImage(uint8_t *rgb, uint16_t width, uint16_t height);
+
+#endif /* __HOST_JPEG_ENCODE_H */
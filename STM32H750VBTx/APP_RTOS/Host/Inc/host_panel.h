@@ -0,0 +1,55 @@
+/**
+ ******************************************************************************
+ * @file    host_panel.h
+ * @brief   主机端ST7789屏幕模型 - 解析SPI字节流并维护显存
+ ******************************************************************************
+ * @note
+ *   - 支持 CASET(0x2A) / RASET(0x2B) / RAMWR(0x2C) / MADCTL(0x36)，其余命令忽略其参数
+ *   - 显存按ST7789实际大小 240x320 保存，RGB565；屏幕可见部分为显存的前240行
+ *   - MADCTL 的 MV/MX/MY 决定列/页地址到显存的映射（与芯片相同：先交换，再镜像）；
+ *     HostPanel_GetPixel 按地址坐标读取（与驱动写入时的坐标一致，含驱动的偏移），
+ *     HostPanel_GetGramPixel 按显存物理坐标读取
+ *   - 视图：按当前 MADCTL 方向看到的240x240可见区域，左上角为(0,0)；MY镜像的方向上地址偏移80
+ *     （与 lcd_spi_154.c 中翻转方向的 X_Offset/Y_Offset 相同），四个显示方向下同一画面的视图相同
+ *   - 快照把视图写成 PPM(P6) 或 PNG（不压缩）
+ ******************************************************************************
+ */
+
+#ifndef __HOST_PANEL_H
+#define __HOST_PANEL_H
+
+#include "host_spi.h"
+
+#define HOST_PANEL_GRAM_WIDTH    240
+#define HOST_PANEL_GRAM_HEIGHT   320
+#define HOST_PANEL_VIEW_WIDTH    240
+#define HOST_PANEL_VIEW_HEIGHT   240
+
+/* 片选有效期间收到的字节，按命令阶段/参数/像素分开统计 */
+typedef struct {
+    uint64_t cmd_bytes;          // 命令字节（DC=0）
+    uint64_t param_bytes;        // 命令参数字节（CASET/RASET/MADCTL及初始化命令的参数）
+    uint64_t pixel_bytes;        // RAMWR之后的像素字节
+    uint64_t pixels;             // 写入显存的像素数
+    uint64_t pixels_clipped;     // 地址超出显存而丢弃的像素数
+    uint32_t windows;            // RAMWR次数
+    uint32_t addr_cmds;          // CASET/RASET次数
+    uint32_t madctl_writes;      // MADCTL次数
+} HostPanel_Stats_t;
+
+void     HostPanel_Attach(void);          // 注册为SPI模拟器的sink，显存和MADCTL回到上电状态
+void     HostPanel_Reset(void);           // 清空显存、窗口和统计，MADCTL保持不变
+uint16_t HostPanel_GetPixel(uint16_t x, uint16_t y);
+uint16_t HostPanel_GetGramPixel(uint16_t col, uint16_t row);
+uint16_t HostPanel_GetViewPixel(uint16_t x, uint16_t y);
+uint8_t  HostPanel_GetMADCTL(void);
+uint32_t HostPanel_GetWindowCount(void);  // 收到的RAMWR次数
+
+void     HostPanel_GetStats(HostPanel_Stats_t *stats);
+void     HostPanel_ResetStats(void);
+
+/* 视图快照，成功返回 true */
+bool     HostPanel_SavePPM(const char *path);
+bool     HostPanel_SavePNG(const char *path);
+
+#endif /* __HOST_PANEL_H */
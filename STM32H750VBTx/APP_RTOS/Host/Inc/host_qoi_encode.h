@@ -0,0 +1,30 @@
+/**
+ ******************************************************************************
+ * @file    host_qoi_encode.h
+ * @brief   主机端无损图片编码器 - 生成 lcd_qoi.h 的QOI565数据
+ ******************************************************************************
+ * @note
+ *   - 输入为RGB565，解码结果与输入逐像素相同
+ *   - host_qoic（图片转换）和主机端测试程序共用
+ ******************************************************************************
+ */
+
+#ifndef __HOST_QOI_ENCODE_H
+#define __HOST_QOI_ENCODE_H
+
+#include <stdint.h>
+#include "lcd_qoi.h"
+
+/**
+ * @brief 编码 width x height 的RGB565图像
+ * @retval malloc 得到的数据（含文件头），尺寸为0时返回NULL
+ */
+uint8_t *HostQOI_Encode(const uint16_t *rgb565, uint16_t width, uint16_t height, uint32_t *size);
+
+/* 界面测试图（RGB888）：渐变背景、纯色卡片、抗锯齿圆形图标和细边框 */
+void HostQOI_TestArt(uint8_t *rgb, uint16_t width, uint16_t height);
+
+/* 图标测试图（RGB888）：透明区域为纯色的圆角图标，index 选择配色和图形 */
+void HostQOI_TestIcon(uint8_t *rgb, uint16_t width, uint16_t height, uint32_t index);
+
+#endif /* __HOST_QOI_ENCODE_H */
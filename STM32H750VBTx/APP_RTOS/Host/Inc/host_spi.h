@@ -0,0 +1,44 @@
+/**
+ ******************************************************************************
+ * @file    host_spi.h
+ * @brief   主机端SPI4/DMA1_Stream1模拟器控制接口
+ ******************************************************************************
+ * @note
+ *   - 每个SPI帧按MSB在前展开为字节流，连同DC/CS引脚状态交给sink回调
+ *   - DMA传输的数据在传输"结束"时才读取，若CPU在传输期间改写了缓冲区，
+ *     sink看到的就是被改写后的内容，便于发现流水线中的缓冲区竞争
+ ******************************************************************************
+ */
+
+#ifndef __HOST_SPI_H
+#define __HOST_SPI_H
+
+#include "stm32h7xx_hal.h"
+
+/* 字节流接收回调：dc_data=true 表示数据阶段，false 表示命令阶段 */
+typedef void (*HostSPI_Sink_t)(void *ctx, bool dc_data, bool cs_active,
+                               const uint8_t *bytes, uint32_t len);
+
+/* 统计信息 */
+typedef struct {
+    uint64_t cmd_bytes;          // 命令阶段字节数（DC=0）
+    uint64_t data_bytes;         // 数据阶段字节数（DC=1）
+    uint32_t blocking_transfers; // HAL_SPI_Transmit 调用次数
+    uint32_t ll_transfers;       // LCD_SPI_LL_Transmit/Fill 调用次数（寄存器级轮询）
+    uint32_t cs_selects;         // CS 由高变低的次数
+    uint32_t dma_transfers;      // HAL_SPI_Transmit_DMA 调用次数
+    uint32_t reinit_count;       // HAL_SPI_Init 调用次数
+    uint64_t dma_busy_ns;        // DMA处于传输状态的累计时间
+    uint64_t blocking_ns;        // CPU阻塞在轮询传输上的累计时间
+} HostSPI_Stats_t;
+
+void     HostSPI_SetClock(uint32_t hz);     // 模拟SPI时钟，0表示瞬间完成
+void     HostSPI_SetSink(HostSPI_Sink_t sink, void *ctx);
+void     HostSPI_GetStats(HostSPI_Stats_t *stats);
+void     HostSPI_ResetStats(void);
+void     HostSPI_WaitIdle(void);            // 等待模拟DMA队列清空
+uint64_t HostSPI_NowNs(void);               // 单调时钟（纳秒）
+void     HostSPI_CountSelect(void);         // 由 host_hal.c 在CS下降沿调用
+void     HostSPI_FailNextDMA(uint32_t error_code);  // 下一次DMA不发送数据，以该 ErrorCode 进入错误回调
+
+#endif /* __HOST_SPI_H */
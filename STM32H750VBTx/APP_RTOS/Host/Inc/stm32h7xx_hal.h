@@ -0,0 +1,187 @@
+/**
+ ******************************************************************************
+ * @file    stm32h7xx_hal.h (Host)
+ * @brief   主机端HAL替身 - 只提供LCD驱动用到的类型和函数
+ ******************************************************************************
+ * @note
+ *   - 该头文件仅在Host构建中使用，优先级高于 Drivers/ 下的真实HAL
+ *   - SPI传输由 host_spi.c 模拟：阻塞传输按设定的SPI时钟耗时，
+ *     DMA传输在独立线程中完成，并在"中断上下文"里调用 HAL_SPI_TxCpltCallback
+ *   - __disable_irq/__enable_irq 映射为一把递归锁，模拟ISR与任务间的互斥
+ ******************************************************************************
+ */
+
+#ifndef __HOST_STM32H7XX_HAL_H
+#define __HOST_STM32H7XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== 通用定义 ==================== */
+
+typedef enum {
+    HAL_OK       = 0x00U,
+    HAL_ERROR    = 0x01U,
+    HAL_BUSY     = 0x02U,
+    HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum {
+    HAL_UNLOCKED = 0x00U,
+    HAL_LOCKED   = 0x01U
+} HAL_LockTypeDef;
+
+typedef enum { RESET = 0U, SET = !RESET } FlagStatus, ITStatus;
+
+#define HAL_MAX_DELAY      0xFFFFFFFFU
+#define __IO               volatile
+#define UNUSED(X)          (void)(X)
+#define assert_param(expr) ((void)0U)
+
+#define SET_BIT(REG, BIT)     ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)   ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)    ((REG) & (BIT))
+#define MODIFY_REG(REG, CLEARMASK, SETMASK)  ((REG) = (((REG) & (~(CLEARMASK))) | (SETMASK)))
+
+/* ==================== Cortex-M 内核函数替身 ==================== */
+
+void     __disable_irq(void);
+void     __enable_irq(void);
+uint32_t __get_PRIMASK(void);
+void     __set_PRIMASK(uint32_t primask);
+#define  __DSB()   __sync_synchronize()
+#define  __DMB()   __sync_synchronize()
+#define  __ISB()   __sync_synchronize()
+#define  __NOP()   ((void)0)
+
+/* DWT周期计数器：每次经 DWT 访问时按 SystemCoreClock 由单调时钟换算 CYCCNT，
+ * 程序对 CYCCNT 的写入（如清零）作为新的计数起点 */
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk         (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk     (1UL << 24)
+
+extern uint32_t       SystemCoreClock;
+extern CoreDebug_Type host_coredebug;
+DWT_Type *HostDWT(void);
+#define DWT         (HostDWT())
+#define CoreDebug   (&host_coredebug)
+
+/* ==================== GPIO ==================== */
+
+typedef struct {
+    volatile uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef enum {
+    GPIO_PIN_RESET = 0U,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+#define GPIO_PIN_11    ((uint16_t)0x0800)
+#define GPIO_PIN_12    ((uint16_t)0x1000)
+#define GPIO_PIN_13    ((uint16_t)0x2000)
+#define GPIO_PIN_14    ((uint16_t)0x4000)
+#define GPIO_PIN_15    ((uint16_t)0x8000)
+
+extern GPIO_TypeDef host_gpioc, host_gpiod, host_gpioe;
+#define GPIOC   (&host_gpioc)
+#define GPIOD   (&host_gpiod)
+#define GPIOE   (&host_gpioe)
+
+void          HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+/* ==================== DMA ==================== */
+
+typedef struct __DMA_HandleTypeDef {
+    void *Instance;
+    volatile uint32_t State;
+    volatile uint32_t ErrorCode;
+} DMA_HandleTypeDef;
+
+/* ==================== SPI ==================== */
+
+typedef struct {
+    volatile uint32_t CR1;
+    volatile uint32_t CR2;
+    volatile uint32_t CFG1;
+    volatile uint32_t CFG2;
+    volatile uint32_t SR;
+    volatile uint32_t IFCR;
+    volatile uint32_t TXDR;
+} SPI_TypeDef;
+
+extern SPI_TypeDef host_spi4;
+#define SPI4    (&host_spi4)
+
+#define SPI_DATASIZE_8BIT       (0x00000007UL)
+#define SPI_DATASIZE_16BIT      (0x0000000FUL)
+
+typedef struct {
+    uint32_t Mode;
+    uint32_t Direction;
+    uint32_t DataSize;
+    uint32_t BaudRatePrescaler;
+    uint32_t FifoThreshold;
+} SPI_InitTypeDef;
+
+typedef enum {
+    HAL_SPI_STATE_RESET      = 0x00UL,
+    HAL_SPI_STATE_READY      = 0x01UL,
+    HAL_SPI_STATE_BUSY       = 0x02UL,
+    HAL_SPI_STATE_BUSY_TX    = 0x03UL,
+    HAL_SPI_STATE_ERROR      = 0x06UL,
+    HAL_SPI_STATE_ABORT      = 0x07UL
+} HAL_SPI_StateTypeDef;
+
+#define HAL_SPI_ERROR_NONE      (0x00000000UL)
+#define HAL_SPI_ERROR_DMA       (0x00000010UL)
+#define HAL_SPI_ERROR_TIMEOUT   (0x00000100UL)
+
+typedef struct __SPI_HandleTypeDef {
+    SPI_TypeDef                      *Instance;
+    SPI_InitTypeDef                  Init;
+    DMA_HandleTypeDef                *hdmatx;
+    HAL_LockTypeDef                  Lock;
+    volatile HAL_SPI_StateTypeDef    State;
+    volatile uint32_t                ErrorCode;
+} SPI_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi);
+void              HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+void              HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+
+/* ==================== UART（输出到stdout）==================== */
+
+typedef struct {
+    void *Instance;
+} UART_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout);
+
+/* ==================== 时基 ==================== */
+
+uint32_t HAL_GetTick(void);
+void     HAL_Delay(uint32_t Delay);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HOST_STM32H7XX_HAL_H */
@@ -0,0 +1,344 @@
+/**
+ ******************************************************************************
+ * @file    host_clip_encode.c
+ * @brief   主机端动画片段编码器、测试动画与PPM读写
+ ******************************************************************************
+ */
+
+#include "host_clip_encode.h"
+#include "host_jpeg_encode.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define OP_SKIP      0U
+#define OP_LITERAL   1U
+#define OP_FILL      2U
+
+struct HostClip {
+    LCD_Clip_Header_t header;
+    int quality;
+    uint32_t key_interval;
+    uint8_t *data;
+    uint32_t size;
+    uint32_t capacity;
+    uint16_t *prev;                         // 上一帧（RGB565），差分编码的参考
+    uint16_t *cur;
+    uint16_t *ops;                          // 一帧的游程指令，最坏情况每像素两个字
+};
+
+static void Clip_Append(HostClip_t *c, const void *p, uint32_t n)
+{
+    if (c->size + n > c->capacity) {
+        while (c->size + n > c->capacity) {
+            c->capacity = c->capacity ? c->capacity * 2U : 65536U;
+        }
+        c->data = realloc(c->data, c->capacity);
+    }
+    memcpy(c->data + c->size, p, n);
+    c->size += n;
+}
+
+static void Clip_AppendFrame(HostClip_t *c, const void *payload, uint32_t len, uint8_t flags)
+{
+    static const uint8_t pad[3] = { 0 };
+    uint32_t record = len | ((uint32_t)flags << 24);
+
+    Clip_Append(c, &record, sizeof(record));
+    Clip_Append(c, payload, len);
+    Clip_Append(c, pad, ((len + 3U) & ~3U) - len);
+}
+
+HostClip_t *HostClip_New(LCD_Clip_Codec_t codec, uint16_t width, uint16_t height,
+                         uint32_t frame_us, int quality, uint32_t key_interval)
+{
+    HostClip_t *c;
+    uint32_t pixels = (uint32_t)width * height;
+
+    if (width == 0U || height == 0U || pixels > LCD_PLAYER_FRAME_PIXELS || frame_us == 0U) {
+        return NULL;
+    }
+    c = calloc(1, sizeof(*c));
+    c->header.magic = LCD_CLIP_MAGIC;
+    c->header.version = LCD_CLIP_VERSION;
+    c->header.codec = (uint16_t)codec;
+    c->header.width = width;
+    c->header.height = height;
+    c->header.frame_us = frame_us;
+    c->quality = quality;
+    c->key_interval = key_interval;
+    c->prev = malloc(pixels * sizeof(uint16_t));
+    c->cur = malloc(pixels * sizeof(uint16_t));
+    c->ops = malloc(pixels * 2U * sizeof(uint16_t));
+    Clip_Append(c, &c->header, sizeof(c->header));     // 帧数在 Finish 时回填
+    return c;
+}
+
+/**
+ * @brief 游程/差分编码一帧，返回指令字数
+ */
+static uint32_t Clip_EncodeRLE(const uint16_t *cur, const uint16_t *prev, uint32_t n, uint16_t *ops)
+{
+    uint32_t i = 0, w = 0;
+
+#define SAME(k)  (prev != NULL && cur[k] == prev[k])
+#define FILL_RUN(k) ((k) + 2U < n && cur[(k) + 1U] == cur[k] && cur[(k) + 2U] == cur[k])
+
+    while (i < n) {
+        uint32_t j = i;
+
+        if (SAME(i)) {
+            while (j < n && j - i < LCD_CLIP_RLE_MAX_RUN && SAME(j)) j++;
+            ops[w++] = (uint16_t)((OP_SKIP << 14) | (j - i));
+        } else if (FILL_RUN(i)) {
+            while (j < n && j - i < LCD_CLIP_RLE_MAX_RUN && cur[j] == cur[i]) j++;
+            ops[w++] = (uint16_t)((OP_FILL << 14) | (j - i));
+            ops[w++] = cur[i];
+        } else {
+            // 原样像素一直延伸到出现连续两个不变像素或三个相同像素为止
+            j++;
+            while (j < n && j - i < LCD_CLIP_RLE_MAX_RUN &&
+                   !(SAME(j) && j + 1U < n && SAME(j + 1U)) && !FILL_RUN(j)) {
+                j++;
+            }
+            ops[w++] = (uint16_t)((OP_LITERAL << 14) | (j - i));
+            memcpy(&ops[w], &cur[i], (j - i) * sizeof(uint16_t));
+            w += j - i;
+        }
+        i = j;
+    }
+#undef SAME
+#undef FILL_RUN
+    return w;
+}
+
+int HostClip_AddFrame(HostClip_t *c, const uint8_t *rgb)
+{
+    const LCD_Clip_Header_t *h = &c->header;
+    uint32_t pixels = (uint32_t)h->width * h->height;
+
+    if (h->codec == LCD_CLIP_JPEG) {
+        uint32_t size;
+        uint8_t *jpeg = HostJPEG_Encode(rgb, h->width, h->height, c->quality, LCD_JPEG_420, 0, &size);
+        if (jpeg == NULL || size > 0x00FFFFFFU) {
+            free(jpeg);
+            return -1;
+        }
+        Clip_AppendFrame(c, jpeg, size, LCD_CLIP_FRAME_KEY);
+        free(jpeg);
+    } else {
+        bool key = (h->frames == 0U) || (c->key_interval != 0U && h->frames % c->key_interval == 0U);
+        HostClip_ToRGB565(rgb, c->cur, pixels);
+        uint32_t words = Clip_EncodeRLE(c->cur, key ? NULL : c->prev, pixels, c->ops);
+        Clip_AppendFrame(c, c->ops, words * sizeof(uint16_t), key ? LCD_CLIP_FRAME_KEY : 0U);
+        uint16_t *t = c->prev;
+        c->prev = c->cur;
+        c->cur = t;
+    }
+    c->header.frames++;
+    return 0;
+}
+
+uint8_t *HostClip_Finish(HostClip_t *c, uint32_t *size)
+{
+    uint8_t *data = c->data;
+
+    memcpy(data, &c->header, sizeof(c->header));
+    *size = c->size;
+    free(c->prev);
+    free(c->cur);
+    free(c->ops);
+    free(c);
+    return data;
+}
+
+void HostClip_ToRGB565(const uint8_t *rgb, uint16_t *out, uint32_t pixels)
+{
+    for (uint32_t i = 0; i < pixels; i++) {
+        const uint8_t *p = &rgb[i * 3U];
+        out[i] = (uint16_t)(((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3));
+    }
+}
+
+/* ==================== 测试动画 ==================== */
+
+static void Put_RGB(uint8_t *p, float r, float g, float b)
+{
+    p[0] = (uint8_t)(r < 0 ? 0 : r > 255 ? 255 : r);
+    p[1] = (uint8_t)(g < 0 ? 0 : g > 255 ? 255 : g);
+    p[2] = (uint8_t)(b < 0 ? 0 : b > 255 ? 255 : b);
+}
+
+void HostClip_TestFrame(uint8_t *rgb, uint16_t width, uint16_t height, uint32_t index)
+{
+    static uint8_t *background;
+    static uint16_t bg_w, bg_h;
+    const float pi = 3.14159265f;
+
+    if (background == NULL || bg_w != width || bg_h != height) {
+        free(background);
+        background = malloc((size_t)width * height * 3);
+        HostJPEG_TestImage(background, width, height);
+        bg_w = width;
+        bg_h = height;
+    }
+    memcpy(rgb, background, (size_t)width * height * 3);
+
+    /* 弹跳的球：水平往返，垂直按抛物线落地反弹 */
+    float radius = width * 0.07f;
+    float span = width - 2.0f * radius;
+    float t = fmodf(index * 5.0f, 2.0f * span);
+    float bx = radius + (t < span ? t : 2.0f * span - t);
+    float phase = fmodf(index / 24.0f, 1.0f);
+    float by = height * 0.85f - radius - 4.0f * phase * (1.0f - phase) * height * 0.5f;
+
+    /* 转动的指针：左上角，每帧转12度 */
+    float cx = width * 0.2f, cy = height * 0.2f, len = width * 0.13f;
+    float ang = index * 12.0f * pi / 180.0f;
+    float ex = cx + len * cosf(ang), ey = cy + len * sinf(ang);
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint8_t *p = &rgb[(y * width + x) * 3];
+            float dx = x - bx, dy = y - by, d = sqrtf(dx * dx + dy * dy);
+
+            if (d < radius) {
+                float shade = 1.0f - 0.6f * sqrtf((dx + radius * 0.4f) * (dx + radius * 0.4f) +
+                                                  (dy + radius * 0.4f) * (dy + radius * 0.4f)) / (radius * 1.6f);
+                Put_RGB(p, 240.0f * shade + 15.0f, 50.0f * shade, 40.0f * shade);
+            }
+
+            /* 点到线段的距离 */
+            float vx = ex - cx, vy = ey - cy;
+            float u = ((x - cx) * vx + (y - cy) * vy) / (vx * vx + vy * vy);
+            u = u < 0 ? 0 : u > 1 ? 1 : u;
+            float qx = cx + u * vx - x, qy = cy + u * vy - y;
+            if (qx * qx + qy * qy < 2.5f * 2.5f) {
+                Put_RGB(p, 255.0f, 255.0f, 255.0f);
+            }
+        }
+    }
+}
+
+void HostClip_BootFrame(uint8_t *rgb, uint16_t width, uint16_t height, uint32_t index, uint32_t frames)
+{
+    const float pi = 3.14159265f;
+    float cx = width * 0.5f, cy = height * 0.42f;
+    float ring = (width < height ? width : height) * 0.2f;
+    float dot = ring * 0.16f;
+    int bar_x0 = width * 15 / 100, bar_x1 = width * 85 / 100;
+    int bar_y0 = height * 80 / 100, bar_y1 = bar_y0 + 6;
+    int bar_fill = bar_x0 + (int)((bar_x1 - bar_x0) * (index + 1U) / (frames ? frames : 1U));
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            Put_RGB(&rgb[(y * width + x) * 3], 12.0f, 16.0f, 32.0f);
+        }
+    }
+
+    /* 加载圈：当前点最亮，之后的点逐渐变暗形成拖尾 */
+    for (int k = 0; k < 12; k++) {
+        float a = k * pi / 6.0f;
+        float px = cx + ring * cosf(a), py = cy + ring * sinf(a);
+        int age = (int)((index + 12U - (uint32_t)k % 12U) % 12U);
+        float level = 255.0f - age * 18.0f;
+
+        for (int y = (int)(py - dot - 1); y <= (int)(py + dot + 1); y++) {
+            for (int x = (int)(px - dot - 1); x <= (int)(px + dot + 1); x++) {
+                if (x < 0 || y < 0 || x >= width || y >= height) continue;
+                if ((x - px) * (x - px) + (y - py) * (y - py) <= dot * dot) {
+                    Put_RGB(&rgb[(y * width + x) * 3], level * 0.3f, level * 0.7f, level);
+                }
+            }
+        }
+    }
+
+    /* 进度条 */
+    for (int y = bar_y0; y < bar_y1 && y < height; y++) {
+        for (int x = bar_x0; x < bar_x1; x++) {
+            if (x < bar_fill) {
+                Put_RGB(&rgb[(y * width + x) * 3], 80.0f, 170.0f, 255.0f);
+            } else {
+                Put_RGB(&rgb[(y * width + x) * 3], 40.0f, 48.0f, 64.0f);
+            }
+        }
+    }
+}
+
+/* ==================== PPM ==================== */
+
+static int PPM_Token(FILE *f)
+{
+    int c, v = 0;
+
+    do {
+        c = fgetc(f);
+        if (c == '#') {
+            while (c != '\n' && c != EOF) c = fgetc(f);
+        }
+    } while (isspace(c));
+    if (!isdigit(c)) {
+        return -1;
+    }
+    while (isdigit(c)) {
+        v = v * 10 + (c - '0');
+        c = fgetc(f);
+    }
+    return v;
+}
+
+uint8_t *HostClip_LoadPPM(const char *path, uint16_t *width, uint16_t *height)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *rgb = NULL;
+    int w, h, maxval;
+
+    if (f == NULL) {
+        return NULL;
+    }
+    if (fgetc(f) != 'P' || fgetc(f) != '6') {
+        fprintf(stderr, "%s: not a binary PPM (P6)\n", path);
+        fclose(f);
+        return NULL;
+    }
+    w = PPM_Token(f);
+    h = PPM_Token(f);
+    maxval = PPM_Token(f);
+    if (w <= 0 || h <= 0 || w > 0xFFFF || h > 0xFFFF || maxval != 255) {
+        fprintf(stderr, "%s: unsupported size or maxval\n", path);
+        fclose(f);
+        return NULL;
+    }
+    rgb = malloc((size_t)w * h * 3);
+    if (fread(rgb, 3, (size_t)w * h, f) != (size_t)w * h) {
+        fprintf(stderr, "%s: truncated\n", path);
+        free(rgb);
+        rgb = NULL;
+    }
+    fclose(f);
+    *width = (uint16_t)w;
+    *height = (uint16_t)h;
+    return rgb;
+}
+
+int HostClip_SavePPM(const char *path, const uint16_t *rgb565, uint16_t width, uint16_t height)
+{
+    FILE *f = fopen(path, "wb");
+
+    if (f == NULL) {
+        return -1;
+    }
+    fprintf(f, "P6\n%u %u\n255\n", width, height);
+    for (uint32_t i = 0; i < (uint32_t)width * height; i++) {
+        uint16_t c = rgb565[i];
+        uint8_t p[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31),
+        };
+        fwrite(p, 1, 3, f);
+    }
+    return fclose(f);
+}
@@ -0,0 +1,182 @@
+/**
+ ******************************************************************************
+ * @file    host_font_encode.c
+ * @brief   主机端压缩字库编码器
+ ******************************************************************************
+ */
+
+#include "host_font_encode.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ROW_BYTES(w)        (((w) + 7) / 8)
+#define ROW_BYTES_BPP(w, b) (((w) * (b) + 7) / 8)
+
+static int Glyph_Compare(const void *a, const void *b)
+{
+    const HostFont_Glyph_t *ga = a, *gb = b;
+    return (int)ga->code - (int)gb->code;
+}
+
+static int Get_Bit(const uint8_t *bits, uint8_t width, uint32_t index)
+{
+    uint32_t y = index / width, x = index % width;
+    return (bits[y * ROW_BYTES(width) + x / 8] >> (x % 8)) & 1;
+}
+
+void HostFont_Init(HostFont_t *font, uint16_t height)
+{
+    memset(font, 0, sizeof(*font));
+    font->height = height;
+    font->bpp = 1;
+}
+
+void HostFont_Free(HostFont_t *font)
+{
+    for (uint32_t i = 0; i < font->count; i++) {
+        free(font->glyphs[i].bits);
+    }
+    free(font->glyphs);
+    memset(font, 0, sizeof(*font));
+}
+
+int HostFont_Add(HostFont_t *font, uint16_t code, uint8_t width, const uint8_t *bits)
+{
+    uint32_t size = ROW_BYTES_BPP(width, font->bpp) * font->height;
+
+    for (uint32_t i = 0; i < font->count; i++) {
+        if (font->glyphs[i].code == code) return 0;
+    }
+    if (font->count == font->capacity) {
+        font->capacity = font->capacity ? font->capacity * 2 : 256;
+        font->glyphs = realloc(font->glyphs, font->capacity * sizeof(HostFont_Glyph_t));
+    }
+
+    HostFont_Glyph_t *g = &font->glyphs[font->count++];
+    g->code = code;
+    g->width = width;
+    g->bits = malloc(size ? size : 1);
+    memcpy(g->bits, bits, size);
+    return 1;
+}
+
+void HostFont_AddBox(HostFont_t *font, uint16_t code, uint8_t width)
+{
+    uint16_t h = font->height;
+    uint8_t bpp = font->bpp;
+    uint8_t *bits = calloc(ROW_BYTES_BPP(width, bpp) * h, 1);
+    uint16_t x0 = width / 8, x1 = width - 1 - width / 8;
+    uint16_t y0 = h / 8, y1 = h - 1 - h / 8;
+
+    for (uint16_t y = y0; y <= y1; y++) {
+        for (uint16_t x = x0; x <= x1; x++) {
+            if (y == y0 || y == y1 || x == x0 || x == x1) {
+                uint32_t bit = x * bpp;
+                bits[y * ROW_BYTES_BPP(width, bpp) + bit / 8] |= ((1U << bpp) - 1U) << (bit % 8);
+            }
+        }
+    }
+    HostFont_Add(font, code, width, bits);
+    font->default_code = code;
+    free(bits);
+}
+
+uint32_t HostFont_EncodeGlyph(const uint8_t *bits, uint8_t width, uint16_t height, uint8_t bpp,
+                              uint8_t *out, uint8_t *encoding)
+{
+    uint32_t raw = ROW_BYTES_BPP(width, bpp) * height;
+    uint32_t total = (uint32_t)width * height;
+    uint8_t *rle;
+    uint32_t n = 0, i = 0;
+
+    if (bpp != 1) {                         // 抗锯齿字模只按原样存放
+        memcpy(out, bits, raw);
+        *encoding = LCD_GLYPH_RAW;
+        return raw;
+    }
+    rle = malloc(total + 1);                // 每个像素最多对应一个字节
+
+    /* RLE：交替统计背景/前景游程，超出15的部分拆成多个字节 */
+    while (i < total) {
+        uint32_t bg = 0, fg = 0;
+
+        while (i < total && !Get_Bit(bits, width, i)) { bg++; i++; }
+        while (i < total && Get_Bit(bits, width, i))  { fg++; i++; }
+
+        if (fg == 0) {                      // 剩余全是背景色
+            rle[n++] = 0x00;
+            break;
+        }
+        for (; bg > 15; bg -= 15) {
+            rle[n++] = 0xF0;
+        }
+        while (fg > 0) {
+            uint32_t f = (fg > 15) ? 15 : fg;
+            rle[n++] = (uint8_t)(bg << 4 | f);
+            bg = 0;
+            fg -= f;
+        }
+    }
+
+    if (n < raw) {
+        memcpy(out, rle, n);
+        *encoding = LCD_GLYPH_RLE;
+    } else {
+        memcpy(out, bits, raw);             // RLE不比原始点阵短，按原样存放
+        *encoding = LCD_GLYPH_RAW;
+        n = raw;
+    }
+    free(rle);
+    return n;
+}
+
+uint8_t *HostFont_Build(HostFont_t *font, uint32_t *size, HostFont_Stats_t *stats)
+{
+    uint16_t max_width = 0;
+    uint32_t raw_total = 0;
+
+    qsort(font->glyphs, font->count, sizeof(HostFont_Glyph_t), Glyph_Compare);
+    for (uint32_t i = 0; i < font->count; i++) {
+        if (font->glyphs[i].width > max_width) max_width = font->glyphs[i].width;
+        raw_total += ROW_BYTES_BPP(font->glyphs[i].width, font->bpp) * font->height;
+    }
+
+    uint32_t index_offset = sizeof(LCD_FontBlob_Header_t);
+    uint32_t data_offset = index_offset + font->count * sizeof(LCD_FontBlob_Entry_t);
+    uint8_t *blob = calloc(data_offset + raw_total + 4, 1);
+    LCD_FontBlob_Header_t *header = (LCD_FontBlob_Header_t *)blob;
+    LCD_FontBlob_Entry_t *index = (LCD_FontBlob_Entry_t *)(blob + index_offset);
+    uint8_t *data = blob + data_offset;
+    uint32_t data_size = 0, rle = 0;
+
+    for (uint32_t i = 0; i < font->count; i++) {
+        const HostFont_Glyph_t *g = &font->glyphs[i];
+
+        index[i].code = g->code;
+        index[i].width = g->width;
+        index[i].offset = data_size;
+        data_size += HostFont_EncodeGlyph(g->bits, g->width, font->height, font->bpp,
+                                          data + data_size, &index[i].encoding);
+        if (index[i].encoding == LCD_GLYPH_RLE) rle++;
+    }
+
+    header->magic = LCD_FONT_BLOB_MAGIC;
+    header->version = LCD_FONT_BLOB_VERSION;
+    header->bpp = font->bpp;
+    header->height = font->height;
+    header->max_width = max_width;
+    header->count = font->count;
+    header->index_offset = index_offset;
+    header->data_offset = data_offset;
+    header->data_size = data_size;
+    header->default_code = font->default_code;
+
+    *size = (data_offset + data_size + 3) & ~3U;
+    if (stats != NULL) {
+        stats->raw_bytes = raw_total;
+        stats->data_bytes = data_size;
+        stats->rle_glyphs = rle;
+        stats->blob_bytes = *size;
+    }
+    return blob;
+}
@@ -0,0 +1,396 @@
+/**
+ ******************************************************************************
+ * @file    host_hal.c
+ * @brief   主机端HAL替身 - 时基、GPIO、UART、中断屏蔽与CMSIS-RTOS2子集
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+#include "stm32h7xx_hal.h"
+#include "cmsis_os2.h"
+#include "host_spi.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+GPIO_TypeDef host_gpioc, host_gpiod, host_gpioe;
+UART_HandleTypeDef huart1;
+uint32_t SystemCoreClock = 480000000U;    // 与目标板 SYSCLK 一致
+CoreDebug_Type host_coredebug;
+
+/* ==================== 中断屏蔽 ==================== */
+
+/* 全局"中断锁"：任务调用 __disable_irq 时持有，模拟ISR执行时也持有 */
+static pthread_mutex_t irq_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static __thread uint32_t irq_depth;
+
+void __disable_irq(void)
+{
+    if (irq_depth++ == 0U) {
+        pthread_mutex_lock(&irq_lock);
+    }
+}
+
+void __enable_irq(void)
+{
+    if (irq_depth > 0U && --irq_depth == 0U) {
+        pthread_mutex_unlock(&irq_lock);
+    }
+}
+
+uint32_t __get_PRIMASK(void)
+{
+    return (irq_depth > 0U) ? 1U : 0U;
+}
+
+void __set_PRIMASK(uint32_t primask)
+{
+    if (primask == 0U) {
+        if (irq_depth > 0U) {
+            irq_depth = 0U;
+            pthread_mutex_unlock(&irq_lock);
+        }
+    } else {
+        // PRIMASK只是一位：恢复为1时嵌套深度也归为1，调用者随后的 __enable_irq 才能真正开中断
+        if (irq_depth == 0U) {
+            pthread_mutex_lock(&irq_lock);
+        }
+        irq_depth = 1U;
+    }
+}
+
+/* ==================== 时基 ==================== */
+
+uint64_t HostSPI_NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+uint32_t HAL_GetTick(void)
+{
+    static uint64_t t0;
+    if (t0 == 0U) {
+        t0 = HostSPI_NowNs();
+    }
+    return (uint32_t)((HostSPI_NowNs() - t0) / 1000000ULL);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    struct timespec ts = { (time_t)(Delay / 1000U), (long)(Delay % 1000U) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+/* ==================== DWT ==================== */
+
+DWT_Type *HostDWT(void)
+{
+    static DWT_Type dwt;
+    static uint32_t published;
+    static uint64_t origin;
+    uint64_t cycles = HostSPI_NowNs() * (SystemCoreClock / 1000000U) / 1000U;
+
+    __disable_irq();
+    if (dwt.CYCCNT != published) {
+        origin = cycles - dwt.CYCCNT;   // 程序改写了 CYCCNT
+    }
+    published = (uint32_t)(cycles - origin);
+    dwt.CYCCNT = published;
+    __enable_irq();
+    return &dwt;
+}
+
+/* ==================== GPIO ==================== */
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    if (GPIOx == GPIOE && (GPIO_Pin & GPIO_PIN_11) && PinState == GPIO_PIN_RESET && (GPIOx->ODR & GPIO_PIN_11)) {
+        HostSPI_CountSelect();      // LCD片选（PE11）
+    }
+    if (PinState == GPIO_PIN_SET) {
+        GPIOx->ODR |= GPIO_Pin;
+    } else {
+        GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+    }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    return (GPIOx->ODR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+/* ==================== UART ==================== */
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void)huart;
+    (void)Timeout;
+    fwrite(pData, 1, Size, stdout);
+    fflush(stdout);
+
+    /* 按 115200 8N1 忙等到最后一个字节移出，与开发板上的阻塞发送耗时一致 */
+    uint64_t end = HostSPI_NowNs() + (uint64_t)Size * 10U * 1000000000ULL / 115200U;
+    while (HostSPI_NowNs() < end) {
+    }
+    return HAL_OK;
+}
+
+/* ==================== CMSIS-RTOS2 子集 ==================== */
+
+osStatus_t osDelay(uint32_t ticks)
+{
+    HAL_Delay(ticks);
+    return osOK;
+}
+
+osStatus_t osThreadYield(void)
+{
+    sched_yield();
+    return osOK;
+}
+
+osKernelState_t osKernelGetState(void)
+{
+    return osKernelRunning;
+}
+
+uint32_t osKernelGetTickCount(void)
+{
+    return HAL_GetTick();
+}
+
+/* 线程控制块：线程标志用互斥锁/条件变量实现，主线程等非 osThreadNew 创建的线程首次使用时分配 */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    uint32_t flags;
+    osThreadFunc_t func;
+    void *argument;
+} HostThread_t;
+
+static __thread HostThread_t *host_self;
+
+static void HostDeadline(struct timespec *ts, uint32_t timeout_ms)
+{
+    clock_gettime(CLOCK_MONOTONIC, ts);
+    ts->tv_sec += timeout_ms / 1000U;
+    ts->tv_nsec += (long)(timeout_ms % 1000U) * 1000000L;
+    if (ts->tv_nsec >= 1000000000L) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000L;
+    }
+}
+
+static void HostCond_Init(pthread_cond_t *cond)
+{
+    pthread_condattr_t ca;
+
+    pthread_condattr_init(&ca);
+    pthread_condattr_setclock(&ca, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &ca);
+    pthread_condattr_destroy(&ca);
+}
+
+static HostThread_t *HostThread_Alloc(osThreadFunc_t func, void *argument)
+{
+    HostThread_t *t = calloc(1, sizeof(*t));
+
+    pthread_mutex_init(&t->lock, NULL);
+    HostCond_Init(&t->cond);
+    t->func = func;
+    t->argument = argument;
+    return t;
+}
+
+static HostThread_t *HostThread_Self(void)
+{
+    if (host_self == NULL) {
+        host_self = HostThread_Alloc(NULL, NULL);
+    }
+    return host_self;
+}
+
+static void *HostThread_Entry(void *arg)
+{
+    host_self = arg;
+    host_self->func(host_self->argument);
+    return NULL;
+}
+
+osThreadId_t osThreadGetId(void)
+{
+    return HostThread_Self();
+}
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+    (void)attr;
+    pthread_t thread;
+    HostThread_t *t = HostThread_Alloc(func, argument);
+
+    if (pthread_create(&thread, NULL, HostThread_Entry, t) != 0) {
+        free(t);
+        return NULL;
+    }
+    pthread_detach(thread);
+    return t;
+}
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags)
+{
+    HostThread_t *t = thread_id;
+    uint32_t result;
+
+    if (t == NULL || (flags & osFlagsError) != 0U) {
+        return osFlagsErrorParameter;
+    }
+    pthread_mutex_lock(&t->lock);
+    t->flags |= flags;
+    result = t->flags;
+    pthread_cond_broadcast(&t->cond);
+    pthread_mutex_unlock(&t->lock);
+    return result;
+}
+
+uint32_t osThreadFlagsClear(uint32_t flags)
+{
+    HostThread_t *t = HostThread_Self();
+    uint32_t result;
+
+    pthread_mutex_lock(&t->lock);
+    result = t->flags;
+    t->flags &= ~flags;
+    pthread_mutex_unlock(&t->lock);
+    return result;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout)
+{
+    HostThread_t *t = HostThread_Self();
+    struct timespec ts;
+    uint32_t result;
+
+    if (timeout != osWaitForever) {
+        HostDeadline(&ts, timeout);
+    }
+    pthread_mutex_lock(&t->lock);
+    for (;;) {
+        uint32_t match = t->flags & flags;
+        if ((options & osFlagsWaitAll) ? (match == flags) : (match != 0U)) {
+            break;
+        }
+        if (timeout == 0U) {
+            pthread_mutex_unlock(&t->lock);
+            return osFlagsErrorResource;
+        }
+        if (timeout == osWaitForever) {
+            pthread_cond_wait(&t->cond, &t->lock);
+        } else if (pthread_cond_timedwait(&t->cond, &t->lock, &ts) != 0) {
+            pthread_mutex_unlock(&t->lock);
+            return osFlagsErrorTimeout;
+        }
+    }
+    result = t->flags;
+    if ((options & osFlagsNoClear) == 0U) {
+        t->flags &= ~flags;
+    }
+    pthread_mutex_unlock(&t->lock);
+    return result;
+}
+
+/* 消息队列：定长环形缓冲 + 互斥锁/条件变量 */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    uint8_t *buf;
+    uint32_t msg_size;
+    uint32_t msg_count;
+    uint32_t head;
+    uint32_t count;
+} HostQueue_t;
+
+/* 持锁等待队列非满（full=true）或非空；返回 false 表示超时 */
+static bool HostQueue_Wait(HostQueue_t *q, bool full, uint32_t timeout)
+{
+    struct timespec ts;
+    if (timeout != osWaitForever) {
+        HostDeadline(&ts, timeout);
+    }
+    while (full ? (q->count == q->msg_count) : (q->count == 0)) {
+        if (timeout == 0) {
+            return false;
+        }
+        if (timeout == osWaitForever) {
+            pthread_cond_wait(&q->cond, &q->lock);
+        } else if (pthread_cond_timedwait(&q->cond, &q->lock, &ts) != 0) {
+            return !(full ? (q->count == q->msg_count) : (q->count == 0));
+        }
+    }
+    return true;
+}
+
+osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr)
+{
+    (void)attr;
+    HostQueue_t *q = calloc(1, sizeof(*q));
+
+    pthread_mutex_init(&q->lock, NULL);
+    HostCond_Init(&q->cond);
+    q->buf = malloc((size_t)msg_count * msg_size);
+    q->msg_size = msg_size;
+    q->msg_count = msg_count;
+    return q;
+}
+
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
+{
+    (void)msg_prio;
+    HostQueue_t *q = mq_id;
+
+    pthread_mutex_lock(&q->lock);
+    if (!HostQueue_Wait(q, true, timeout)) {
+        pthread_mutex_unlock(&q->lock);
+        return (timeout == 0) ? osErrorResource : osErrorTimeout;
+    }
+    memcpy(&q->buf[((q->head + q->count) % q->msg_count) * q->msg_size], msg_ptr, q->msg_size);
+    q->count++;
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->lock);
+    return osOK;
+}
+
+osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+{
+    HostQueue_t *q = mq_id;
+
+    pthread_mutex_lock(&q->lock);
+    if (!HostQueue_Wait(q, false, timeout)) {
+        pthread_mutex_unlock(&q->lock);
+        return (timeout == 0) ? osErrorResource : osErrorTimeout;
+    }
+    memcpy(msg_ptr, &q->buf[q->head * q->msg_size], q->msg_size);
+    q->head = (q->head + 1) % q->msg_count;
+    q->count--;
+    if (msg_prio != NULL) {
+        *msg_prio = 0;
+    }
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->lock);
+    return osOK;
+}
+
+uint32_t osMessageQueueGetCount(osMessageQueueId_t mq_id)
+{
+    HostQueue_t *q = mq_id;
+    uint32_t count;
+
+    pthread_mutex_lock(&q->lock);
+    count = q->count;
+    pthread_mutex_unlock(&q->lock);
+    return count;
+}
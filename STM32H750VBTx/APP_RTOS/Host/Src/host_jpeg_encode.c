@@ -0,0 +1,442 @@
+/**
+ ******************************************************************************
+ * @file    host_jpeg_encode.c
+ * @brief   主机端基线JPEG编码器
+ ******************************************************************************
+ */
+
+#include "host_jpeg_encode.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const uint8_t zigzag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10,
+    17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+/* Annex K 量化表（自然顺序） */
+static const uint8_t std_luma_q[64] = {
+    16,  11,  10,  16,  24,  40,  51,  61,
+    12,  12,  14,  19,  26,  58,  60,  55,
+    14,  13,  16,  24,  40,  57,  69,  56,
+    14,  17,  22,  29,  51,  87,  80,  62,
+    18,  22,  37,  56,  68, 109, 103,  77,
+    24,  35,  55,  64,  81, 104, 113,  92,
+    49,  64,  78,  87, 103, 121, 120, 101,
+    72,  92,  95,  98, 112, 100, 103,  99,
+};
+
+static const uint8_t std_chroma_q[64] = {
+    17, 18, 24, 47, 99, 99, 99, 99,
+    18, 21, 26, 66, 99, 99, 99, 99,
+    24, 26, 56, 99, 99, 99, 99, 99,
+    47, 66, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+};
+
+/* Annex K 哈夫曼表 */
+static const uint8_t dc_luma_bits[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+static const uint8_t dc_chroma_bits[16] = { 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+static const uint8_t dc_vals[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+static const uint8_t ac_luma_bits[16] = { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7D };
+static const uint8_t ac_luma_vals[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+    0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0,
+    0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7,
+    0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5,
+    0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2,
+    0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+    0xF9, 0xFA,
+};
+
+static const uint8_t ac_chroma_bits[16] = { 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+static const uint8_t ac_chroma_vals[162] = {
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+    0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0,
+    0x15, 0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26,
+    0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3,
+    0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA,
+    0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+    0xF9, 0xFA,
+};
+
+typedef struct {
+    uint16_t code[256];
+    uint8_t  size[256];
+} Huff_Code_t;
+
+typedef struct {
+    uint8_t *buf;
+    uint32_t len;
+    uint32_t cap;
+    uint32_t acc;
+    int      nbits;
+} Writer_t;
+
+/* ==================== 输出 ==================== */
+
+static void Put_Byte(Writer_t *w, uint8_t b)
+{
+    if (w->len == w->cap) {
+        w->cap = w->cap ? w->cap * 2U : 4096U;
+        w->buf = realloc(w->buf, w->cap);
+    }
+    w->buf[w->len++] = b;
+}
+
+static void Put_Word(Writer_t *w, uint16_t v)
+{
+    Put_Byte(w, (uint8_t)(v >> 8));
+    Put_Byte(w, (uint8_t)v);
+}
+
+static void Put_Bits(Writer_t *w, uint32_t bits, int n)
+{
+    w->acc = (w->acc << n) | (bits & ((1U << n) - 1U));
+    w->nbits += n;
+    while (w->nbits >= 8) {
+        uint8_t b = (uint8_t)(w->acc >> (w->nbits - 8));
+        Put_Byte(w, b);
+        if (b == 0xFF) {
+            Put_Byte(w, 0x00);          // 字节填充
+        }
+        w->nbits -= 8;
+    }
+}
+
+/* 补1到字节边界 */
+static void Flush_Bits(Writer_t *w)
+{
+    if (w->nbits > 0) {
+        Put_Bits(w, 0x7F, 8 - w->nbits);
+    }
+    w->acc = 0;
+}
+
+static void Build_Codes(Huff_Code_t *h, const uint8_t *bits, const uint8_t *vals)
+{
+    uint32_t code = 0, k = 0;
+
+    memset(h, 0, sizeof(*h));
+    for (int l = 1; l <= 16; l++) {
+        for (int i = 0; i < bits[l - 1]; i++, k++, code++) {
+            h->code[vals[k]] = (uint16_t)code;
+            h->size[vals[k]] = (uint8_t)l;
+        }
+        code <<= 1;
+    }
+}
+
+static void Write_DHT(Writer_t *w, uint8_t cls_id, const uint8_t *bits, const uint8_t *vals)
+{
+    int n = 0;
+    for (int i = 0; i < 16; i++) n += bits[i];
+    Put_Word(w, 0xFFC4);
+    Put_Word(w, (uint16_t)(2 + 17 + n));
+    Put_Byte(w, cls_id);
+    for (int i = 0; i < 16; i++) Put_Byte(w, bits[i]);
+    for (int i = 0; i < n; i++) Put_Byte(w, vals[i]);
+}
+
+/* ==================== 变换与熵编码 ==================== */
+
+static void FDCT(const float *in, float *out)
+{
+    static float c[8][8];
+    static int ready;
+    float tmp[64];
+
+    if (!ready) {
+        for (int u = 0; u < 8; u++) {
+            for (int x = 0; x < 8; x++) {
+                c[u][x] = (u == 0 ? (float)M_SQRT1_2 : 1.0f) * 0.5f * cosf((2 * x + 1) * u * (float)M_PI / 16.0f);
+            }
+        }
+        ready = 1;
+    }
+    for (int y = 0; y < 8; y++) {
+        for (int u = 0; u < 8; u++) {
+            float s = 0;
+            for (int x = 0; x < 8; x++) s += c[u][x] * in[y * 8 + x];
+            tmp[y * 8 + u] = s;
+        }
+    }
+    for (int u = 0; u < 8; u++) {
+        for (int v = 0; v < 8; v++) {
+            float s = 0;
+            for (int y = 0; y < 8; y++) s += c[v][y] * tmp[y * 8 + u];
+            out[v * 8 + u] = s;
+        }
+    }
+}
+
+static int Bit_Count(int v)
+{
+    int n = 0;
+    if (v < 0) v = -v;
+    while (v) {
+        n++;
+        v >>= 1;
+    }
+    return n;
+}
+
+static void Encode_Block(Writer_t *w, const float *samples, const uint8_t *qt, int *pred,
+                         const Huff_Code_t *dc, const Huff_Code_t *ac)
+{
+    float level[64], coef[64];
+    int zz[64], run = 0, n;
+
+    for (int i = 0; i < 64; i++) level[i] = samples[i] - 128.0f;
+    FDCT(level, coef);
+    for (int k = 0; k < 64; k++) {
+        zz[k] = (int)lroundf(coef[zigzag[k]] / qt[zigzag[k]]);
+    }
+
+    int diff = zz[0] - *pred;
+    *pred = zz[0];
+    n = Bit_Count(diff);
+    Put_Bits(w, dc->code[n], dc->size[n]);
+    if (n) Put_Bits(w, (uint32_t)(diff < 0 ? diff - 1 : diff), n);
+
+    for (int k = 1; k < 64; k++) {
+        if (zz[k] == 0) {
+            run++;
+            continue;
+        }
+        while (run > 15) {
+            Put_Bits(w, ac->code[0xF0], ac->size[0xF0]);
+            run -= 16;
+        }
+        n = Bit_Count(zz[k]);
+        Put_Bits(w, ac->code[(run << 4) | n], ac->size[(run << 4) | n]);
+        Put_Bits(w, (uint32_t)(zz[k] < 0 ? zz[k] - 1 : zz[k]), n);
+        run = 0;
+    }
+    if (run > 0) {
+        Put_Bits(w, ac->code[0x00], ac->size[0x00]);
+    }
+}
+
+/* ==================== 接口函数 ==================== */
+
+uint8_t *HostJPEG_Encode(const uint8_t *rgb, uint16_t width, uint16_t height, int quality,
+                         LCD_JPEG_Subsampling_t subsampling, uint16_t restart_interval, uint32_t *size)
+{
+    Writer_t w = { 0 };
+    Huff_Code_t dc_l, ac_l, dc_c, ac_c;
+    uint8_t qt[2][64];
+    int ncomp = (subsampling == LCD_JPEG_GRAY) ? 1 : 3;
+    int hs = (subsampling == LCD_JPEG_422 || subsampling == LCD_JPEG_420) ? 2 : 1;
+    int vs = (subsampling == LCD_JPEG_420) ? 2 : 1;
+    int scale, mcus_x, mcus_y, pred[3] = { 0, 0, 0 };
+    uint32_t npix = (uint32_t)width * height, mcu = 0, rst = 0;
+    float *plane[3];
+
+    if (width == 0 || height == 0) {
+        return NULL;
+    }
+    if (quality < 1) quality = 1;
+    if (quality > 100) quality = 100;
+    scale = (quality < 50) ? 5000 / quality : 200 - quality * 2;
+    for (int i = 0; i < 64; i++) {
+        int l = (std_luma_q[i] * scale + 50) / 100, c = (std_chroma_q[i] * scale + 50) / 100;
+        qt[0][i] = (uint8_t)(l < 1 ? 1 : l > 255 ? 255 : l);
+        qt[1][i] = (uint8_t)(c < 1 ? 1 : c > 255 ? 255 : c);
+    }
+
+    /* 颜色空间转换（JFIF） */
+    for (int c = 0; c < 3; c++) plane[c] = malloc(npix * sizeof(float));
+    for (uint32_t i = 0; i < npix; i++) {
+        float r = rgb[i * 3], g = rgb[i * 3 + 1], b = rgb[i * 3 + 2];
+        plane[0][i] = 0.299f * r + 0.587f * g + 0.114f * b;
+        plane[1][i] = -0.168736f * r - 0.331264f * g + 0.5f * b + 128.0f;
+        plane[2][i] = 0.5f * r - 0.418688f * g - 0.081312f * b + 128.0f;
+    }
+
+    /* 文件头 */
+    Put_Word(&w, 0xFFD8);
+    static const uint8_t jfif[] = { 'J', 'F', 'I', 'F', 0, 1, 1, 0, 0, 1, 0, 1, 0, 0 };
+    Put_Word(&w, 0xFFE0);
+    Put_Word(&w, 2 + sizeof(jfif));
+    for (size_t i = 0; i < sizeof(jfif); i++) Put_Byte(&w, jfif[i]);
+
+    for (int t = 0; t < (ncomp == 1 ? 1 : 2); t++) {
+        Put_Word(&w, 0xFFDB);
+        Put_Word(&w, 2 + 65);
+        Put_Byte(&w, (uint8_t)t);
+        for (int k = 0; k < 64; k++) Put_Byte(&w, qt[t][zigzag[k]]);
+    }
+
+    Put_Word(&w, 0xFFC0);
+    Put_Word(&w, (uint16_t)(8 + 3 * ncomp));
+    Put_Byte(&w, 8);
+    Put_Word(&w, height);
+    Put_Word(&w, width);
+    Put_Byte(&w, (uint8_t)ncomp);
+    for (int c = 0; c < ncomp; c++) {
+        Put_Byte(&w, (uint8_t)(c + 1));
+        Put_Byte(&w, c == 0 ? (uint8_t)((hs << 4) | vs) : 0x11);
+        Put_Byte(&w, c == 0 ? 0 : 1);
+    }
+
+    Write_DHT(&w, 0x00, dc_luma_bits, dc_vals);
+    Write_DHT(&w, 0x10, ac_luma_bits, ac_luma_vals);
+    if (ncomp == 3) {
+        Write_DHT(&w, 0x01, dc_chroma_bits, dc_vals);
+        Write_DHT(&w, 0x11, ac_chroma_bits, ac_chroma_vals);
+    }
+    Build_Codes(&dc_l, dc_luma_bits, dc_vals);
+    Build_Codes(&ac_l, ac_luma_bits, ac_luma_vals);
+    Build_Codes(&dc_c, dc_chroma_bits, dc_vals);
+    Build_Codes(&ac_c, ac_chroma_bits, ac_chroma_vals);
+
+    if (restart_interval) {
+        Put_Word(&w, 0xFFDD);
+        Put_Word(&w, 4);
+        Put_Word(&w, restart_interval);
+    }
+
+    Put_Word(&w, 0xFFDA);
+    Put_Word(&w, (uint16_t)(6 + 2 * ncomp));
+    Put_Byte(&w, (uint8_t)ncomp);
+    for (int c = 0; c < ncomp; c++) {
+        Put_Byte(&w, (uint8_t)(c + 1));
+        Put_Byte(&w, c == 0 ? 0x00 : 0x11);
+    }
+    Put_Byte(&w, 0);
+    Put_Byte(&w, 63);
+    Put_Byte(&w, 0);
+
+    /* 熵编码数据：边缘之外复制最后一行/列 */
+    if (ncomp == 1) hs = vs = 1;
+    mcus_x = (width + 8 * hs - 1) / (8 * hs);
+    mcus_y = (height + 8 * vs - 1) / (8 * vs);
+    for (int my = 0; my < mcus_y; my++) {
+        for (int mx = 0; mx < mcus_x; mx++, mcu++) {
+            float blk[64];
+
+            if (restart_interval && mcu && mcu % restart_interval == 0) {
+                Flush_Bits(&w);
+                Put_Word(&w, (uint16_t)(0xFFD0 + (rst++ & 7)));
+                pred[0] = pred[1] = pred[2] = 0;
+            }
+            for (int by = 0; by < vs; by++) {
+                for (int bx = 0; bx < hs; bx++) {
+                    for (int i = 0; i < 64; i++) {
+                        int x = mx * 8 * hs + bx * 8 + (i & 7), y = my * 8 * vs + by * 8 + (i >> 3);
+                        if (x >= width) x = width - 1;
+                        if (y >= height) y = height - 1;
+                        blk[i] = plane[0][y * width + x];
+                    }
+                    Encode_Block(&w, blk, qt[0], &pred[0], &dc_l, &ac_l);
+                }
+            }
+            for (int c = 1; c < ncomp; c++) {
+                for (int i = 0; i < 64; i++) {
+                    float s = 0;
+                    for (int dy = 0; dy < vs; dy++) {
+                        for (int dx = 0; dx < hs; dx++) {
+                            int x = (mx * 8 + (i & 7)) * hs + dx, y = (my * 8 + (i >> 3)) * vs + dy;
+                            if (x >= width) x = width - 1;
+                            if (y >= height) y = height - 1;
+                            s += plane[c][y * width + x];
+                        }
+                    }
+                    blk[i] = s / (hs * vs);
+                }
+                Encode_Block(&w, blk, qt[1], &pred[c], &dc_c, &ac_c);
+            }
+        }
+    }
+    Flush_Bits(&w);
+    Put_Word(&w, 0xFFD9);
+
+    for (int c = 0; c < 3; c++) free(plane[c]);
+    *size = w.len;
+    return w.buf;
+}
+
+void HostJPEG_TestImage(uint8_t *rgb, uint16_t width, uint16_t height)
+{
+    uint32_t seed = 20240601U;
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            float fx = (float)x / width, fy = (float)y / height;
+            float r, g, b;
+            float horizon = 0.62f + 0.07f * sinf(fx * 9.4f) + 0.03f * sinf(fx * 23.0f + 1.0f);
+
+            seed = seed * 1103515245U + 12345U;
+            float noise = (float)((seed >> 16) & 0xFF) / 255.0f - 0.5f;
+
+            /* 天空渐变 */
+            r = 80.0f + 120.0f * fy;
+            g = 140.0f + 70.0f * fy;
+            b = 235.0f - 50.0f * fy;
+
+            /* 云 */
+            float cloud = sinf(fx * 13.0f + 2.0f * sinf(fy * 7.0f)) * sinf(fy * 17.0f + fx * 3.0f) +
+                          0.5f * sinf(fx * 31.0f - fy * 23.0f);
+            if (cloud > 0.55f) {
+                float t = (cloud - 0.55f) * 1.5f + 0.08f * noise;
+                t = t > 1.0f ? 1.0f : t;
+                r += (245.0f - r) * t;
+                g += (245.0f - g) * t;
+                b += (250.0f - b) * t;
+            }
+
+            /* 太阳，边缘柔和 */
+            float dx = fx - 0.72f, dy = fy - 0.24f, d = sqrtf(dx * dx + dy * dy);
+            if (d < 0.13f) {
+                float t = d < 0.10f ? 1.0f : (0.13f - d) / 0.03f;
+                r = r + (255.0f - r) * t;
+                g = g + (225.0f - g) * t;
+                b = b + (120.0f - b) * t;
+            }
+
+            /* 山坡草地，带细小纹理 */
+            if (fy > horizon) {
+                float depth = (fy - horizon) / (1.0f - horizon + 1e-3f);
+                r = 70.0f + 40.0f * depth + 40.0f * noise;
+                g = 150.0f - 60.0f * depth + 40.0f * noise + 18.0f * sinf(fx * 90.0f + fy * 35.0f);
+                b = 50.0f + 10.0f * depth;
+            }
+
+            /* 房子：锐利边缘 */
+            if (fx > 0.18f && fx < 0.42f && fy > 0.52f && fy < 0.78f) {
+                r = 230.0f; g = 225.0f; b = 210.0f;
+                if (fx > 0.26f && fx < 0.32f && fy > 0.64f) {
+                    r = 110.0f; g = 60.0f; b = 30.0f;
+                }
+            }
+            if (fy > 0.40f && fy <= 0.52f && fabsf(fx - 0.30f) < (fy - 0.40f) * 1.3f) {
+                r = 190.0f; g = 40.0f; b = 35.0f;
+            }
+
+            uint8_t *p = &rgb[(y * width + x) * 3];
+            p[0] = (uint8_t)(r < 0 ? 0 : r > 255 ? 255 : r);
+            p[1] = (uint8_t)(g < 0 ? 0 : g > 255 ? 255 : g);
+            p[2] = (uint8_t)(b < 0 ? 0 : b > 255 ? 255 : b);
+        }
+    }
+}
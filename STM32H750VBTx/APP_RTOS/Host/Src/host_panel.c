@@ -0,0 +1,316 @@
+/**
+ ******************************************************************************
+ * @file    host_panel.c
+ * @brief   主机端ST7789屏幕模型
+ ******************************************************************************
+ */
+
+#include "host_panel.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MADCTL_MY   0x80U       // 行地址镜像
+#define MADCTL_MX   0x40U       // 列地址镜像
+#define MADCTL_MV   0x20U       // 行/列交换
+
+static uint16_t gram[HOST_PANEL_GRAM_HEIGHT][HOST_PANEL_GRAM_WIDTH];
+
+static struct {
+    uint8_t  cmd;                // 当前命令
+    uint8_t  param[4];           // CASET/RASET参数
+    uint8_t  param_count;
+    uint8_t  madctl;
+    uint16_t xs, xe, ys, ye;     // 当前窗口（地址坐标）
+    uint16_t x, y;               // 写指针
+    bool     writing;            // 处于RAMWR数据阶段
+    bool     half;               // 已收到像素高字节
+    uint8_t  high;
+} panel;
+
+static HostPanel_Stats_t panel_stats;
+
+/* 地址坐标（列x、页y）→ 显存物理坐标：MV先交换，MX/MY再按显存的列/行镜像 */
+static bool HostPanel_Map(uint16_t x, uint16_t y, uint16_t *col, uint16_t *row)
+{
+    uint32_t c = (panel.madctl & MADCTL_MV) ? y : x;
+    uint32_t r = (panel.madctl & MADCTL_MV) ? x : y;
+
+    if (c >= HOST_PANEL_GRAM_WIDTH || r >= HOST_PANEL_GRAM_HEIGHT) {
+        return false;
+    }
+    *col = (uint16_t)((panel.madctl & MADCTL_MX) ? HOST_PANEL_GRAM_WIDTH - 1U - c : c);
+    *row = (uint16_t)((panel.madctl & MADCTL_MY) ? HOST_PANEL_GRAM_HEIGHT - 1U - r : r);
+    return true;
+}
+
+static void HostPanel_Command(uint8_t cmd)
+{
+    panel.cmd = cmd;
+    panel.param_count = 0;
+    panel.writing = (cmd == 0x2C);
+    panel.half = false;
+    if (panel.writing) {
+        panel.x = panel.xs;
+        panel.y = panel.ys;
+        panel_stats.windows++;
+    } else if (cmd == 0x2A || cmd == 0x2B) {
+        panel_stats.addr_cmds++;
+    }
+}
+
+static void HostPanel_Pixel(uint16_t color)
+{
+    uint16_t col, row;
+
+    if (HostPanel_Map(panel.x, panel.y, &col, &row)) {
+        gram[row][col] = color;
+        panel_stats.pixels++;
+    } else {
+        panel_stats.pixels_clipped++;
+    }
+    if (panel.x >= panel.xe) {
+        panel.x = panel.xs;
+        panel.y = (panel.y >= panel.ye) ? panel.ys : (uint16_t)(panel.y + 1);
+    } else {
+        panel.x++;
+    }
+}
+
+static void HostPanel_Data(uint8_t byte)
+{
+    if (panel.writing) {
+        panel_stats.pixel_bytes++;
+        if (panel.half) {
+            HostPanel_Pixel((uint16_t)((panel.high << 8) | byte));
+        } else {
+            panel.high = byte;
+        }
+        panel.half = !panel.half;
+        return;
+    }
+
+    panel_stats.param_bytes++;
+    if (panel.cmd == 0x36) {
+        if (panel.param_count++ == 0) {
+            panel.madctl = byte;
+            panel_stats.madctl_writes++;
+        }
+        return;
+    }
+    if (panel.param_count < sizeof(panel.param)) {
+        panel.param[panel.param_count++] = byte;
+    }
+    if (panel.param_count == 4) {
+        uint16_t start = (uint16_t)((panel.param[0] << 8) | panel.param[1]);
+        uint16_t end   = (uint16_t)((panel.param[2] << 8) | panel.param[3]);
+        if (panel.cmd == 0x2A) {
+            panel.xs = start;  panel.xe = end;
+        } else if (panel.cmd == 0x2B) {
+            panel.ys = start;  panel.ye = end;
+        }
+    }
+}
+
+static void HostPanel_Sink(void *ctx, bool dc_data, bool cs_active, const uint8_t *bytes, uint32_t len)
+{
+    (void)ctx;
+    if (!cs_active) {
+        return;     // 片选无效，屏幕不接收
+    }
+    for (uint32_t i = 0; i < len; i++) {
+        if (dc_data) {
+            HostPanel_Data(bytes[i]);
+        } else {
+            panel_stats.cmd_bytes++;
+            HostPanel_Command(bytes[i]);
+        }
+    }
+}
+
+void HostPanel_Reset(void)
+{
+    uint8_t madctl = panel.madctl;
+
+    memset(gram, 0, sizeof(gram));
+    memset(&panel, 0, sizeof(panel));
+    memset(&panel_stats, 0, sizeof(panel_stats));
+    panel.madctl = madctl;
+    panel.xe = HOST_PANEL_GRAM_WIDTH - 1;
+    panel.ye = HOST_PANEL_GRAM_HEIGHT - 1;
+}
+
+void HostPanel_Attach(void)
+{
+    panel.madctl = 0;
+    HostPanel_Reset();
+    HostSPI_SetSink(HostPanel_Sink, NULL);
+}
+
+uint16_t HostPanel_GetPixel(uint16_t x, uint16_t y)
+{
+    uint16_t col, row;
+
+    if (!HostPanel_Map(x, y, &col, &row)) {
+        return 0;
+    }
+    return gram[row][col];
+}
+
+uint16_t HostPanel_GetGramPixel(uint16_t col, uint16_t row)
+{
+    if (col >= HOST_PANEL_GRAM_WIDTH || row >= HOST_PANEL_GRAM_HEIGHT) {
+        return 0;
+    }
+    return gram[row][col];
+}
+
+/* MY镜像时行方向从地址 320-240 开始才落在可见的前240行 */
+uint16_t HostPanel_GetViewPixel(uint16_t x, uint16_t y)
+{
+    uint16_t off = (panel.madctl & MADCTL_MY) ? HOST_PANEL_GRAM_HEIGHT - HOST_PANEL_VIEW_HEIGHT : 0;
+
+    if (x >= HOST_PANEL_VIEW_WIDTH || y >= HOST_PANEL_VIEW_HEIGHT) {
+        return 0;
+    }
+    if (panel.madctl & MADCTL_MV) {
+        return HostPanel_GetPixel((uint16_t)(x + off), y);
+    }
+    return HostPanel_GetPixel(x, (uint16_t)(y + off));
+}
+
+uint8_t HostPanel_GetMADCTL(void)
+{
+    return panel.madctl;
+}
+
+uint32_t HostPanel_GetWindowCount(void)
+{
+    return panel_stats.windows;
+}
+
+void HostPanel_GetStats(HostPanel_Stats_t *stats)
+{
+    *stats = panel_stats;
+}
+
+void HostPanel_ResetStats(void)
+{
+    memset(&panel_stats, 0, sizeof(panel_stats));
+}
+
+/* ==================== 快照 ==================== */
+
+static void HostPanel_ToRGB888(uint16_t c, uint8_t *rgb)
+{
+    uint8_t r = (uint8_t)(c >> 11), g = (uint8_t)((c >> 5) & 0x3F), b = (uint8_t)(c & 0x1F);
+
+    rgb[0] = (uint8_t)((r << 3) | (r >> 2));
+    rgb[1] = (uint8_t)((g << 2) | (g >> 4));
+    rgb[2] = (uint8_t)((b << 3) | (b >> 2));
+}
+
+bool HostPanel_SavePPM(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    uint8_t rgb[3];
+    bool ok;
+
+    if (f == NULL) {
+        return false;
+    }
+    fprintf(f, "P6\n%u %u\n255\n", HOST_PANEL_VIEW_WIDTH, HOST_PANEL_VIEW_HEIGHT);
+    for (uint16_t y = 0; y < HOST_PANEL_VIEW_HEIGHT; y++) {
+        for (uint16_t x = 0; x < HOST_PANEL_VIEW_WIDTH; x++) {
+            HostPanel_ToRGB888(HostPanel_GetViewPixel(x, y), rgb);
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    ok = (ferror(f) == 0);
+    return (fclose(f) == 0) && ok;
+}
+
+static uint32_t HostPanel_Crc32(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+        }
+    }
+    return ~crc;
+}
+
+static void HostPanel_Put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);  p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);   p[3] = (uint8_t)v;
+}
+
+/* 长度、类型、数据、CRC（覆盖类型和数据） */
+static void HostPanel_PngChunk(FILE *f, const char *type, const uint8_t *data, uint32_t len)
+{
+    uint8_t head[8], tail[4];
+
+    HostPanel_Put32(head, len);
+    memcpy(head + 4, type, 4);
+    HostPanel_Put32(tail, HostPanel_Crc32(HostPanel_Crc32(0, head + 4, 4), data, len));
+    fwrite(head, 1, 8, f);
+    if (len != 0U) {
+        fwrite(data, 1, len, f);
+    }
+    fwrite(tail, 1, 4, f);
+}
+
+/* 每行一个不压缩的deflate块（过滤类型0 + RGB888），zlib流以Adler-32结尾 */
+bool HostPanel_SavePNG(const char *path)
+{
+    enum { ROW = 1 + HOST_PANEL_VIEW_WIDTH * 3, BLOCK = 5 + ROW };
+    static uint8_t idat[2 + HOST_PANEL_VIEW_HEIGHT * BLOCK + 4];
+    static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    uint8_t ihdr[13];
+    uint32_t a = 1, b = 0, n = 0;
+    FILE *f;
+    bool ok;
+
+    HostPanel_Put32(ihdr, HOST_PANEL_VIEW_WIDTH);
+    HostPanel_Put32(ihdr + 4, HOST_PANEL_VIEW_HEIGHT);
+    ihdr[8] = 8;                            // 位深
+    ihdr[9] = 2;                            // RGB
+    ihdr[10] = ihdr[11] = ihdr[12] = 0;     // 压缩/过滤/隔行
+
+    idat[n++] = 0x78;                       // zlib头：deflate，32KB窗口
+    idat[n++] = 0x01;
+    for (uint16_t y = 0; y < HOST_PANEL_VIEW_HEIGHT; y++) {
+        uint8_t *row;
+
+        idat[n++] = (y == HOST_PANEL_VIEW_HEIGHT - 1) ? 1 : 0;     // BFINAL，BTYPE=00
+        idat[n++] = (uint8_t)(ROW & 0xFF);
+        idat[n++] = (uint8_t)(ROW >> 8);
+        idat[n++] = (uint8_t)(~ROW & 0xFF);
+        idat[n++] = (uint8_t)((~ROW >> 8) & 0xFF);
+        row = &idat[n];
+        row[0] = 0;
+        for (uint16_t x = 0; x < HOST_PANEL_VIEW_WIDTH; x++) {
+            HostPanel_ToRGB888(HostPanel_GetViewPixel(x, y), &row[1 + x * 3]);
+        }
+        for (uint32_t i = 0; i < ROW; i++) {
+            a = (a + row[i]) % 65521U;
+            b = (b + a) % 65521U;
+        }
+        n += ROW;
+    }
+    HostPanel_Put32(&idat[n], (b << 16) | a);
+    n += 4;
+
+    f = fopen(path, "wb");
+    if (f == NULL) {
+        return false;
+    }
+    fwrite(sig, 1, sizeof(sig), f);
+    HostPanel_PngChunk(f, "IHDR", ihdr, sizeof(ihdr));
+    HostPanel_PngChunk(f, "IDAT", idat, n);
+    HostPanel_PngChunk(f, "IEND", NULL, 0);
+    ok = (ferror(f) == 0);
+    return (fclose(f) == 0) && ok;
+}
@@ -0,0 +1,225 @@
+/**
+ ******************************************************************************
+ * @file    host_qoi_encode.c
+ * @brief   主机端无损图片编码器与界面测试图
+ ******************************************************************************
+ */
+
+#include "host_qoi_encode.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    uint8_t *data;
+    uint32_t size;
+} Out_t;
+
+static void Put(Out_t *o, uint8_t b)
+{
+    o->data[o->size++] = b;
+}
+
+/* 结束一段重复：先用 LONGRUN，余下不足63个用 RUN */
+static void Flush_Run(Out_t *o, uint32_t run)
+{
+    while (run >= 63U) {
+        uint32_t n = (run > LCD_QOI_LONGRUN_MAX) ? LCD_QOI_LONGRUN_MAX : run;
+        Put(o, LCD_QOI_OP_LONGRUN);
+        Put(o, (uint8_t)(n - 63U));
+        Put(o, (uint8_t)((n - 63U) >> 8));
+        run -= n;
+    }
+    if (run != 0U) {
+        Put(o, (uint8_t)(LCD_QOI_OP_RUN | (run - 1U)));
+    }
+}
+
+/* 分量差按位宽回绕到有符号范围 */
+static int Wrap(int d, int bits)
+{
+    int half = 1 << (bits - 1);
+    return ((d + half) & ((1 << bits) - 1)) - half;
+}
+
+uint8_t *HostQOI_Encode(const uint16_t *rgb565, uint16_t width, uint16_t height, uint32_t *size)
+{
+    uint32_t pixels = (uint32_t)width * height;
+    uint16_t index[64] = { 0 };
+    uint16_t prev = 0;
+    uint32_t run = 0;
+    LCD_QOI_Header_t h;
+    Out_t o;
+
+    if (pixels == 0U) {
+        return NULL;
+    }
+    // 最坏情况每像素3字节
+    o.data = malloc(sizeof(h) + pixels * 3U);
+    o.size = sizeof(h);
+
+    for (uint32_t i = 0; i < pixels; i++) {
+        uint16_t px = rgb565[i];
+
+        if (px == prev) {
+            run++;
+            continue;
+        }
+        Flush_Run(&o, run);
+        run = 0;
+
+        uint32_t hash = LCD_QOI_HASH(px);
+        if (index[hash] == px) {
+            Put(&o, (uint8_t)(LCD_QOI_OP_INDEX | hash));
+            prev = px;
+            continue;
+        }
+        index[hash] = px;
+
+        int dr = Wrap((px >> 11) - (prev >> 11), 5);
+        int dg = Wrap(((px >> 5) & 0x3F) - ((prev >> 5) & 0x3F), 6);
+        int db = Wrap((px & 0x1F) - (prev & 0x1F), 5);
+        int half = dg >> 1;                                 // 向下取整
+        int dr_dg = Wrap(dr - half, 5), db_dg = Wrap(db - half, 5);
+
+        if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+            Put(&o, (uint8_t)(LCD_QOI_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2)));
+        } else if (dr_dg >= -8 && dr_dg <= 7 && db_dg >= -8 && db_dg <= 7) {
+            Put(&o, (uint8_t)(LCD_QOI_OP_LUMA | (dg + 32)));
+            Put(&o, (uint8_t)(((dr_dg + 8) << 4) | (db_dg + 8)));
+        } else {
+            Put(&o, LCD_QOI_OP_PIXEL);
+            Put(&o, (uint8_t)px);
+            Put(&o, (uint8_t)(px >> 8));
+        }
+        prev = px;
+    }
+    Flush_Run(&o, run);
+
+    h.magic = LCD_QOI_MAGIC;
+    h.width = width;
+    h.height = height;
+    h.data_size = o.size - sizeof(h);
+    memcpy(o.data, &h, sizeof(h));
+    *size = o.size;
+    return realloc(o.data, o.size);
+}
+
+static void Put_RGB(uint8_t *p, double r, double g, double b)
+{
+    p[0] = (uint8_t)(r < 0 ? 0 : r > 255 ? 255 : r + 0.5);
+    p[1] = (uint8_t)(g < 0 ? 0 : g > 255 ? 255 : g + 0.5);
+    p[2] = (uint8_t)(b < 0 ? 0 : b > 255 ? 255 : b + 0.5);
+}
+
+/* 在 (cx, cy) 画半径 r 的抗锯齿圆，覆盖率按到圆周的距离计算 */
+static void Blend_Circle(uint8_t *rgb, uint16_t width, uint16_t height, double cx, double cy, double r,
+                         const uint8_t color[3])
+{
+    for (int y = (int)(cy - r - 1); y <= (int)(cy + r + 1); y++) {
+        for (int x = (int)(cx - r - 1); x <= (int)(cx + r + 1); x++) {
+            if (x < 0 || y < 0 || x >= width || y >= height) {
+                continue;
+            }
+            double d = hypot(x + 0.5 - cx, y + 0.5 - cy);
+            double a = r + 0.5 - d;
+            if (a <= 0) {
+                continue;
+            }
+            a = (a > 1) ? 1 : a;
+            uint8_t *p = &rgb[(y * width + x) * 3];
+            Put_RGB(p, p[0] + (color[0] - p[0]) * a, p[1] + (color[1] - p[1]) * a, p[2] + (color[2] - p[2]) * a);
+        }
+    }
+}
+
+static void Fill_Rect(uint8_t *rgb, uint16_t width, int x0, int y0, int w, int h, const uint8_t color[3])
+{
+    for (int y = y0; y < y0 + h; y++) {
+        for (int x = x0; x < x0 + w; x++) {
+            memcpy(&rgb[(y * width + x) * 3], color, 3);
+        }
+    }
+}
+
+void HostQOI_TestArt(uint8_t *rgb, uint16_t width, uint16_t height)
+{
+    static const uint8_t card[3] = { 0xF4, 0xF6, 0xFA };
+    static const uint8_t border[3] = { 0xC8, 0xD0, 0xDC };
+    static const uint8_t bar[3] = { 0x2A, 0x6F, 0xDB };
+    static const uint8_t icon[4][3] = {
+        { 0xE8, 0x4A, 0x3C }, { 0x2E, 0xB8, 0x6B }, { 0xF2, 0xA9, 0x1C }, { 0x8E, 0x4E, 0xD8 },
+    };
+
+    // 竖直渐变背景
+    for (uint16_t y = 0; y < height; y++) {
+        double t = (double)y / height;
+        for (uint16_t x = 0; x < width; x++) {
+            Put_RGB(&rgb[(y * width + x) * 3], 0x1C + 0x30 * t, 0x2A + 0x40 * t, 0x48 + 0x60 * t);
+        }
+    }
+    // 标题栏
+    Fill_Rect(rgb, width, 0, 0, width, height / 8, bar);
+
+    // 2x2 卡片，每张卡片一个圆形图标和两条文字占位条
+    int margin = width / 24, cw = (width - 3 * margin) / 2, ch = (height - height / 8 - 3 * margin) / 2;
+    for (int i = 0; i < 4; i++) {
+        int x0 = margin + (i & 1) * (cw + margin);
+        int y0 = height / 8 + margin + (i >> 1) * (ch + margin);
+        if (cw < 4 || ch < 4) {
+            break;
+        }
+        Fill_Rect(rgb, width, x0, y0, cw, ch, border);
+        Fill_Rect(rgb, width, x0 + 1, y0 + 1, cw - 2, ch - 2, card);
+        Blend_Circle(rgb, width, height, x0 + cw / 2.0, y0 + ch * 0.4, ch * 0.22, icon[i]);
+        Fill_Rect(rgb, width, x0 + cw / 5, y0 + ch * 3 / 4, cw * 3 / 5, ch / 16 + 1, border);
+        Fill_Rect(rgb, width, x0 + cw / 4, y0 + ch * 3 / 4 + ch / 8, cw / 2, ch / 16 + 1, border);
+    }
+}
+
+void HostQOI_TestIcon(uint8_t *rgb, uint16_t width, uint16_t height, uint32_t index)
+{
+    static const uint8_t bg[3] = { 0x20, 0x24, 0x30 };
+    static const uint8_t palette[6][3] = {
+        { 0x3C, 0x8D, 0xE8 }, { 0xE8, 0x4A, 0x3C }, { 0x2E, 0xB8, 0x6B },
+        { 0xF2, 0xA9, 0x1C }, { 0x8E, 0x4E, 0xD8 }, { 0x1C, 0xB5, 0xC2 },
+    };
+    static const uint8_t white[3] = { 0xFF, 0xFF, 0xFF };
+    const uint8_t *c = palette[index % 6U];
+    double rr = width / 5.0;                                // 圆角半径
+
+    Fill_Rect(rgb, width, 0, 0, width, height, bg);
+    // 圆角底板：上下两块矩形加四角圆
+    for (uint16_t y = 0; y < height; y++) {
+        for (uint16_t x = 0; x < width; x++) {
+            double px = x + 0.5, py = y + 0.5;
+            double qx = fabs(px - width / 2.0) - (width / 2.0 - 2 - rr);
+            double qy = fabs(py - height / 2.0) - (height / 2.0 - 2 - rr);
+            double d = hypot(qx > 0 ? qx : 0, qy > 0 ? qy : 0) - rr;
+            double a = 0.5 - d;
+            if (a <= 0) {
+                continue;
+            }
+            a = (a > 1) ? 1 : a;
+            uint8_t *p = &rgb[(y * width + x) * 3];
+            // 底板自上而下轻微变暗
+            double k = 1.0 - 0.25 * py / height;
+            Put_RGB(p, p[0] + (c[0] * k - p[0]) * a, p[1] + (c[1] * k - p[1]) * a, p[2] + (c[2] * k - p[2]) * a);
+        }
+    }
+    // 白色图形：圆、圆环或三点
+    switch (index % 3U) {
+    case 0:
+        Blend_Circle(rgb, width, height, width / 2.0, height / 2.0, width / 5.0, white);
+        break;
+    case 1:
+        Blend_Circle(rgb, width, height, width / 2.0, height / 2.0, width / 4.0, white);
+        Blend_Circle(rgb, width, height, width / 2.0, height / 2.0, width / 6.0, c);
+        break;
+    default:
+        for (int i = -1; i <= 1; i++) {
+            Blend_Circle(rgb, width, height, width / 2.0 + i * width / 5.0, height / 2.0, width / 14.0, white);
+        }
+        break;
+    }
+}
@@ -0,0 +1,373 @@
+/**
+ ******************************************************************************
+ * @file    host_spi.c
+ * @brief   主机端SPI4 + DMA1_Stream1 模拟器
+ ******************************************************************************
+ * @note
+ *   - 阻塞传输（HAL_SPI_Transmit）在调用线程中忙等，模拟CPU轮询发送
+ *   - DMA传输（HAL_SPI_Transmit_DMA）交给后台线程，按SPI时钟计算耗时，
+ *     到期后持有"中断锁"调用 HAL_SPI_TxCpltCallback，行为与真实ISR一致
+ *   - 回调按 stm32h7xx_it.c 的 SPI4_IRQHandler 同样用 ISR_MEASURE 计时，上报 ISR_SRC_SPI4_IRQ
+ *   - lcd_spi_ll.c 的寄存器级发送在这里按同样的忙等方式模拟，帧宽取自 CFG1.DSIZE
+ ******************************************************************************
+ */
+
+#define _GNU_SOURCE
+#include "host_spi.h"
+#include "lcd_spi_xfer.h"
+#include "isr_event.h"
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+SPI_TypeDef host_spi4;
+SPI_HandleTypeDef hspi4;              // 与 Core/Src/spi.c 同名，供 lcd_spi_154.c 等直接引用
+DMA_HandleTypeDef hdma_spi4_tx;
+
+#define HOST_LCD_DC_PIN   GPIO_PIN_15     // 与 lcd_spi_154.h 保持一致：PE15
+#define HOST_LCD_CS_PIN   GPIO_PIN_11     // PE11
+#define HOST_SPI_DSIZE    0x1FUL          // CFG1.DSIZE
+
+/* DMA作业（硬件同一时刻只有一个流在传输） */
+typedef struct {
+    SPI_HandleTypeDef *hspi;
+    const uint8_t *data;
+    uint32_t frames;
+    bool frame16;
+    bool dc_data;
+    bool cs_active;
+    uint64_t deadline_ns;
+} HostDMA_Job_t;
+
+static pthread_mutex_t job_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  job_cond = PTHREAD_COND_INITIALIZER;
+static HostDMA_Job_t   job;
+static bool            job_pending;
+static bool            job_cancel;
+static uint32_t        fail_next;          // 非0：下一次DMA以该错误码结束
+static bool            worker_started;
+static pthread_t       worker;
+
+static uint32_t        spi_clock_hz = 60000000U;   // 默认60MHz，与SPI4实际配置一致
+static HostSPI_Sink_t  sink_fn;
+static void           *sink_ctx;
+static HostSPI_Stats_t stats;
+
+/* ==================== 内部函数 ==================== */
+
+static uint64_t HostSPI_DurationNs(uint32_t bytes)
+{
+    if (spi_clock_hz == 0U) {
+        return 0U;
+    }
+    return (uint64_t)bytes * 8ULL * 1000000000ULL / spi_clock_hz;
+}
+
+static void HostSPI_SleepUntil(uint64_t deadline_ns)
+{
+    struct timespec ts = { (time_t)(deadline_ns / 1000000000ULL), (long)(deadline_ns % 1000000000ULL) };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0) {
+    }
+}
+
+/* 将SPI帧按MSB在前展开为字节流后交给sink */
+static void HostSPI_Emit(const uint8_t *data, uint32_t frames, bool frame16, bool dc_data, bool cs_active)
+{
+    uint8_t chunk[512];
+    uint32_t n = 0;
+
+    if (frame16) {
+        const uint16_t *p = (const uint16_t *)data;
+        stats.data_bytes += dc_data ? frames * 2U : 0U;
+        stats.cmd_bytes  += dc_data ? 0U : frames * 2U;
+        if (sink_fn == NULL) {
+            return;
+        }
+        for (uint32_t i = 0; i < frames; i++) {
+            chunk[n++] = (uint8_t)(p[i] >> 8);
+            chunk[n++] = (uint8_t)(p[i] & 0xFF);
+            if (n == sizeof(chunk)) {
+                sink_fn(sink_ctx, dc_data, cs_active, chunk, n);
+                n = 0;
+            }
+        }
+        if (n > 0) {
+            sink_fn(sink_ctx, dc_data, cs_active, chunk, n);
+        }
+    } else {
+        stats.data_bytes += dc_data ? frames : 0U;
+        stats.cmd_bytes  += dc_data ? 0U : frames;
+        if (sink_fn != NULL) {
+            sink_fn(sink_ctx, dc_data, cs_active, data, frames);
+        }
+    }
+}
+
+static void *HostDMA_Worker(void *arg)
+{
+    (void)arg;
+    for (;;) {
+        pthread_mutex_lock(&job_lock);
+        while (!job_pending) {
+            pthread_cond_wait(&job_cond, &job_lock);
+        }
+        HostDMA_Job_t cur = job;
+        pthread_mutex_unlock(&job_lock);
+
+        uint64_t start = HostSPI_NowNs();
+        HostSPI_SleepUntil(cur.deadline_ns);
+
+        /* 进入"中断上下文" */
+        __disable_irq();
+        pthread_mutex_lock(&job_lock);
+        bool cancelled = job_cancel;
+        uint32_t error = fail_next;
+        fail_next = 0;
+        job_pending = false;
+        job_cancel = false;
+        pthread_cond_broadcast(&job_cond);
+        pthread_mutex_unlock(&job_lock);
+
+        if (!cancelled) {
+            if (error == 0U) {
+                HostSPI_Emit(cur.data, cur.frames, cur.frame16, cur.dc_data, cur.cs_active);
+                stats.dma_busy_ns += HostSPI_NowNs() - start;
+            }
+            cur.hspi->State = HAL_SPI_STATE_READY;
+            cur.hspi->ErrorCode = error;
+
+            /* 只对回调计时，数据搬运对应的是DMA硬件 */
+            ISR_MEASURE_BEGIN();
+            if (error != 0U) {
+                HAL_SPI_ErrorCallback(cur.hspi);
+            } else {
+                HAL_SPI_TxCpltCallback(cur.hspi);
+            }
+            ISR_MEASURE_END(ISR_SRC_SPI4_IRQ);
+        }
+        __enable_irq();
+    }
+    return NULL;
+}
+
+/* 轮询发送：调用线程忙等到最后一帧移出，再把数据交给sink */
+static void HostSPI_Poll(const uint8_t *data, uint32_t frames, bool frame16)
+{
+    uint64_t start = HostSPI_NowNs();
+    uint64_t deadline = start + HostSPI_DurationNs(frame16 ? frames * 2U : frames);
+
+    while (HostSPI_NowNs() < deadline) {
+        // 忙等，模拟CPU轮询TXP/EOT
+    }
+
+    __disable_irq();
+    HostSPI_Emit(data, frames, frame16,
+                 HAL_GPIO_ReadPin(GPIOE, HOST_LCD_DC_PIN) == GPIO_PIN_SET,
+                 HAL_GPIO_ReadPin(GPIOE, HOST_LCD_CS_PIN) == GPIO_PIN_RESET);
+    stats.blocking_ns += HostSPI_NowNs() - start;
+    __enable_irq();
+}
+
+/* ==================== HAL SPI 替身 ==================== */
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
+{
+    if (hspi->Instance == NULL) {
+        hspi->Instance = SPI4;
+    }
+    hspi->Instance->CFG1 = (hspi->Instance->CFG1 & ~0x1FUL) | hspi->Init.DataSize;
+    hspi->State = HAL_SPI_STATE_READY;
+    hspi->ErrorCode = HAL_SPI_ERROR_NONE;
+    stats.reinit_count++;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void)Timeout;
+    if (hspi->State != HAL_SPI_STATE_READY) {
+        return HAL_BUSY;
+    }
+    if (Size == 0U) {
+        return HAL_ERROR;
+    }
+
+    HostSPI_Poll(pData, Size, hspi->Init.DataSize == SPI_DATASIZE_16BIT);
+    __disable_irq();
+    stats.blocking_transfers++;
+    __enable_irq();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size)
+{
+    if (hspi->State != HAL_SPI_STATE_READY) {
+        return HAL_BUSY;
+    }
+    if (pData == NULL || Size == 0U) {
+        return HAL_ERROR;
+    }
+
+    pthread_mutex_lock(&job_lock);
+    if (!worker_started) {
+        pthread_create(&worker, NULL, HostDMA_Worker, NULL);
+        pthread_detach(worker);
+        worker_started = true;
+    }
+    while (job_pending) {
+        // 上一个作业的完成回调尚未退出（回调内再次启动DMA时不会走到这里）
+        pthread_cond_wait(&job_cond, &job_lock);
+    }
+
+    bool frame16 = (hspi->Init.DataSize == SPI_DATASIZE_16BIT);
+    hspi->State = HAL_SPI_STATE_BUSY_TX;
+    hspi->ErrorCode = HAL_SPI_ERROR_NONE;
+    job.hspi = hspi;
+    job.data = pData;
+    job.frames = Size;
+    job.frame16 = frame16;
+    job.dc_data = HAL_GPIO_ReadPin(GPIOE, HOST_LCD_DC_PIN) == GPIO_PIN_SET;
+    job.cs_active = HAL_GPIO_ReadPin(GPIOE, HOST_LCD_CS_PIN) == GPIO_PIN_RESET;
+    job.deadline_ns = HostSPI_NowNs() + HostSPI_DurationNs(frame16 ? Size * 2U : Size);
+    job_pending = true;
+    stats.dma_transfers++;
+    pthread_cond_broadcast(&job_cond);
+    pthread_mutex_unlock(&job_lock);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
+{
+    pthread_mutex_lock(&job_lock);
+    if (job_pending) {
+        job_cancel = true;
+    }
+    pthread_mutex_unlock(&job_lock);
+    hspi->State = HAL_SPI_STATE_READY;
+    return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    (void)hspi;
+}
+
+__attribute__((weak)) void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    (void)hspi;
+}
+
+/* ==================== lcd_spi_ll.c 替身 ==================== */
+
+uint32_t LCD_SPI_LL_GetDataSize(SPI_HandleTypeDef *hspi)
+{
+    return hspi->Instance->CFG1 & HOST_SPI_DSIZE;
+}
+
+void LCD_SPI_LL_SetDataSize(SPI_HandleTypeDef *hspi, uint32_t data_size)
+{
+    hspi->Instance->CFG1 = (hspi->Instance->CFG1 & ~HOST_SPI_DSIZE) | data_size;
+}
+
+HAL_StatusTypeDef LCD_SPI_LL_Transmit(SPI_HandleTypeDef *hspi, const void *data, uint32_t frames)
+{
+    if (hspi->State != HAL_SPI_STATE_READY) {
+        return HAL_BUSY;
+    }
+    if (frames == 0U) {
+        return HAL_OK;
+    }
+
+    HostSPI_Poll((const uint8_t *)data, frames, LCD_SPI_LL_GetDataSize(hspi) > SPI_DATASIZE_8BIT);
+    __disable_irq();
+    stats.ll_transfers++;
+    __enable_irq();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef LCD_SPI_LL_Fill(SPI_HandleTypeDef *hspi, uint16_t value, uint32_t frames)
+{
+    uint16_t chunk[256];
+
+    if (hspi->State != HAL_SPI_STATE_READY) {
+        return HAL_BUSY;
+    }
+    if (frames == 0U) {
+        return HAL_OK;
+    }
+
+    for (uint32_t i = 0; i < 256U; i++) {
+        chunk[i] = value;
+    }
+    while (frames > 0U) {
+        uint32_t n = (frames > 256U) ? 256U : frames;
+        HostSPI_Poll((const uint8_t *)chunk, n, true);
+        frames -= n;
+    }
+    __disable_irq();
+    stats.ll_transfers++;
+    __enable_irq();
+    return HAL_OK;
+}
+
+/**
+ * @brief 与 Core/Src/spi.c 中的 MX_SPI4_Init 对应：8位数据，DMA1_Stream1 发送
+ */
+void MX_SPI4_Init(void)
+{
+    hspi4.Instance = SPI4;
+    hspi4.Init.DataSize = SPI_DATASIZE_8BIT;
+    hspi4.hdmatx = &hdma_spi4_tx;
+    HAL_SPI_Init(&hspi4);
+    HAL_GPIO_WritePin(GPIOE, HOST_LCD_CS_PIN, GPIO_PIN_SET);    // CS空闲为高，与 MX_GPIO_Init 一致
+}
+
+/* ==================== 模拟器控制接口 ==================== */
+
+void HostSPI_SetClock(uint32_t hz)
+{
+    spi_clock_hz = hz;
+}
+
+void HostSPI_FailNextDMA(uint32_t error_code)
+{
+    pthread_mutex_lock(&job_lock);
+    fail_next = error_code;
+    pthread_mutex_unlock(&job_lock);
+}
+
+void HostSPI_SetSink(HostSPI_Sink_t sink, void *ctx)
+{
+    sink_fn = sink;
+    sink_ctx = ctx;
+}
+
+void HostSPI_GetStats(HostSPI_Stats_t *out)
+{
+    __disable_irq();
+    *out = stats;
+    __enable_irq();
+}
+
+void HostSPI_ResetStats(void)
+{
+    __disable_irq();
+    memset(&stats, 0, sizeof(stats));
+    __enable_irq();
+}
+
+void HostSPI_CountSelect(void)
+{
+    __disable_irq();
+    stats.cs_selects++;
+    __enable_irq();
+}
+
+void HostSPI_WaitIdle(void)
+{
+    pthread_mutex_lock(&job_lock);
+    while (job_pending) {
+        pthread_cond_wait(&job_cond, &job_lock);
+    }
+    pthread_mutex_unlock(&job_lock);
+}
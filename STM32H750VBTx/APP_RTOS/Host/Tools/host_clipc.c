@@ -0,0 +1,221 @@
+/**
+ ******************************************************************************
+ * @file    host_clipc.c
+ * @brief   动画片段工具 - PPM序列编码为 lcd_player.h 的片段，或把片段逐帧解码为PPM
+ ******************************************************************************
+ * @note
+ *   用法：
+ *     编码：host_clipc -i <frame%03d.ppm | test | boot> [-c jpeg|rle] [-f 帧率] [-N 帧数]
+ *                      [-q 质量] [-k 关键帧间隔] [-o 输出.clip] [-C 输出.c] [-n 数组名]
+ *       -i  printf格式的PPM文件名，从0号帧读到文件不存在或 -N 帧；
+ *           "test" / "boot" 使用内置测试动画 / 开机动画（240x240）
+ *       -c  编码方式，默认 rle
+ *       -f  帧率，默认30
+ *       -N  帧数，内置动画默认30
+ *       -q  JPEG质量，默认75
+ *       -k  游程编码的关键帧间隔，默认0（只有第一帧）
+ *     解码：host_clipc -d 输入.clip -p 输出前缀
+ *       用固件的解码器（lcd_player.c、lcd_jpeg.c）逐帧解码，写出 <前缀>000.ppm ...
+ *   其它格式的视频先转换为PPM序列，例如 ffmpeg -i a.mp4 -vf scale=240:240 -r 30 frame%03d.ppm
+ ******************************************************************************
+ */
+
+#include "host_clip_encode.h"
+#include "lcd_player.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+static int Write_C(const char *path, const char *name, const char *input,
+                   const uint8_t *clip, uint32_t size)
+{
+    const LCD_Clip_Header_t *h = (const LCD_Clip_Header_t *)clip;
+    FILE *f = fopen(path, "w");
+
+    if (f == NULL) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return -1;
+    }
+    fprintf(f, "/* 由 host_clipc 生成，请勿手动修改\n");
+    fprintf(f, " * 片段: %s，%ux%u，%u 帧，每帧 %u us，%s，%u 字节 */\n\n", input, h->width, h->height,
+            h->frames, h->frame_us, h->codec == LCD_CLIP_JPEG ? "MJPEG" : "RLE", size);
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "const uint32_t %s_size = %u;\n\n", name, size);
+    fprintf(f, "__attribute__((aligned(4))) const uint8_t %s[%u] = {", name, size);
+    for (uint32_t i = 0; i < size; i++) {
+        fprintf(f, "%s0x%02X,", (i % 16) ? "" : "\n    ", clip[i]);
+    }
+    fprintf(f, "\n};\n");
+    fclose(f);
+    return 0;
+}
+
+static int Decode_Clip(const char *path, const char *prefix)
+{
+    FILE *f = fopen(path, "rb");
+    LCD_Clip_t clip;
+    uint8_t *data;
+    uint16_t *frame[2];
+    long size;
+    char name[512];
+
+    if (f == NULL) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = aligned_alloc(4, ((size_t)size + 3U) & ~3U);
+    if (fread(data, 1, (size_t)size, f) != (size_t)size) {
+        fprintf(stderr, "%s: read error\n", path);
+        return 1;
+    }
+    fclose(f);
+
+    if (LCD_Clip_Open(&clip, data, (uint32_t)size) != HAL_OK) {
+        fprintf(stderr, "%s: not a clip\n", path);
+        return 1;
+    }
+    frame[0] = malloc(LCD_PLAYER_FRAME_PIXELS * sizeof(uint16_t));
+    frame[1] = malloc(LCD_PLAYER_FRAME_PIXELS * sizeof(uint16_t));
+    for (uint32_t i = 0; i < clip.header.frames; i++) {
+        // 与播放器一样交替使用两个缓冲区，差分帧参考上一帧
+        if (LCD_Clip_DecodeNext(&clip, i ? frame[(i - 1) & 1] : NULL, frame[i & 1]) != HAL_OK) {
+            fprintf(stderr, "%s: frame %u corrupt\n", path, i);
+            return 1;
+        }
+        snprintf(name, sizeof(name), "%s%03u.ppm", prefix, i);
+        if (HostClip_SavePPM(name, frame[i & 1], clip.header.width, clip.header.height) != 0) {
+            fprintf(stderr, "cannot write %s\n", name);
+            return 1;
+        }
+    }
+    printf("%s: %ux%u, %u frames -> %s000.ppm..%s%03u.ppm\n", path, clip.header.width, clip.header.height,
+           clip.header.frames, prefix, prefix, clip.header.frames - 1U);
+    free(frame[0]);
+    free(frame[1]);
+    free(data);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *input = NULL, *out_clip = NULL, *out_c = NULL, *name = "clip", *codec_name = "rle";
+    const char *decode = NULL, *prefix = "frame";
+    int quality = 75, fps = 30, frames = 0, key = 0;
+    LCD_Clip_Codec_t codec;
+    HostClip_t *enc = NULL;
+    uint16_t width = LCD_WIDTH, height = LCD_HEIGHT;
+    uint8_t *rgb = NULL;
+    uint32_t size, count = 0;
+    bool builtin;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-i") && i + 1 < argc)      input = argv[++i];
+        else if (!strcmp(argv[i], "-c") && i + 1 < argc) codec_name = argv[++i];
+        else if (!strcmp(argv[i], "-f") && i + 1 < argc) fps = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-N") && i + 1 < argc) frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-q") && i + 1 < argc) quality = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-k") && i + 1 < argc) key = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) out_clip = argv[++i];
+        else if (!strcmp(argv[i], "-C") && i + 1 < argc) out_c = argv[++i];
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc) name = argv[++i];
+        else if (!strcmp(argv[i], "-d") && i + 1 < argc) decode = argv[++i];
+        else if (!strcmp(argv[i], "-p") && i + 1 < argc) prefix = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s -i frame%%03d.ppm|test|boot [-c jpeg|rle] [-f fps] [-N frames] [-q quality] [-k keyint] [-o out.clip] [-C out.c] [-n name]\n"
+                            "       %s -d in.clip [-p prefix]\n", argv[0], argv[0]);
+            return 1;
+        }
+    }
+    if (decode != NULL) {
+        return Decode_Clip(decode, prefix);
+    }
+    if (input == NULL || (out_clip == NULL && out_c == NULL)) {
+        fprintf(stderr, "need -i and -o/-C (or -d)\n");
+        return 1;
+    }
+    if (!strcmp(codec_name, "jpeg")) {
+        codec = LCD_CLIP_JPEG;
+    } else if (!strcmp(codec_name, "rle")) {
+        codec = LCD_CLIP_RLE;
+    } else {
+        fprintf(stderr, "bad -c value\n");
+        return 1;
+    }
+    if (fps < 1 || fps > 1000 || quality < 1 || quality > 100 || frames < 0 || key < 0) {
+        fprintf(stderr, "bad -f/-q/-N/-k value\n");
+        return 1;
+    }
+
+    builtin = !strcmp(input, "test") || !strcmp(input, "boot");
+    if (builtin && frames == 0) {
+        frames = 30;
+    }
+    for (uint32_t i = 0; frames == 0 || i < (uint32_t)frames; i++) {
+        if (builtin) {
+            if (rgb == NULL) rgb = malloc((size_t)width * height * 3);
+            if (input[0] == 't') {
+                HostClip_TestFrame(rgb, width, height, i);
+            } else {
+                HostClip_BootFrame(rgb, width, height, i, (uint32_t)frames);
+            }
+        } else {
+            char path[512];
+            uint16_t w, h;
+            snprintf(path, sizeof(path), input, i);
+            free(rgb);
+            rgb = HostClip_LoadPPM(path, &w, &h);
+            if (rgb == NULL) {
+                if (i == 0) {
+                    fprintf(stderr, "cannot open %s\n", path);
+                    return 1;
+                }
+                break;
+            }
+            if (i == 0) {
+                width = w;
+                height = h;
+            } else if (w != width || h != height) {
+                fprintf(stderr, "%s: size differs from first frame\n", path);
+                return 1;
+            }
+        }
+        if (enc == NULL) {
+            enc = HostClip_New(codec, width, height, 1000000U / (uint32_t)fps, quality, (uint32_t)key);
+            if (enc == NULL) {
+                fprintf(stderr, "frame size %ux%u not supported\n", width, height);
+                return 1;
+            }
+        }
+        if (HostClip_AddFrame(enc, rgb) != 0) {
+            fprintf(stderr, "frame %u: encode failed\n", i);
+            return 1;
+        }
+        count++;
+    }
+
+    uint8_t *clip = HostClip_Finish(enc, &size);
+    printf("%s: %ux%u, %u frames @ %d fps, %s -> %u bytes (%.0f bytes/frame, RGB565 %u bytes/frame)\n",
+           input, width, height, count, fps, codec_name, size, (double)size / count, width * height * 2U);
+
+    if (out_clip != NULL) {
+        FILE *f = fopen(out_clip, "wb");
+        if (f == NULL || fwrite(clip, 1, size, f) != size) {
+            fprintf(stderr, "cannot write %s\n", out_clip);
+            return 1;
+        }
+        fclose(f);
+    }
+    if (out_c != NULL && Write_C(out_c, name, builtin ? (input[0] == 't' ? "内置测试动画" : "内置开机动画") : input,
+                                 clip, size) != 0) {
+        return 1;
+    }
+
+    free(clip);
+    free(rgb);
+    return 0;
+}
@@ -0,0 +1,297 @@
+/**
+ ******************************************************************************
+ * @file    host_fontc.c
+ * @brief   字库转换工具 - 把BDF/TTF字体按字符表转换为压缩字库（lcd_font_blob.h）
+ ******************************************************************************
+ * @note
+ *   用法：
+ *     host_fontc -i <字体.bdf|字体.ttf> [-p 像素高度] [-b 1|2|4] [-c 字符表.txt] [-a]
+ *                [-o 输出.bin] [-C 输出.c] [-n 数组名]
+ *       -p  TTF的字号（像素，默认16；字符高度为上升+下降，会略大于字号），BDF使用字体自身的尺寸
+ *       -b  每像素位数，默认1；2/4为抗锯齿字库，只支持TTF（灰度渲染后量化）
+ *       -c  UTF-8文本文件，文件中出现的字符都会收入字库（换行等控制字符忽略）
+ *       -a  收入全部可显示ASCII字符（0x20~0x7E）
+ *       -C  输出C源文件，数组可直接链接进固件（位于 .rodata，即QSPI）
+ *   未指定 -c/-a 时收入字体中编码不超过0xFFFF的全部字符。
+ *   字库中总会加入一个方框字符（U+FFFD）作为缺字时的默认字符。
+ *   TTF需要FreeType，编译时未找到FreeType则只支持BDF。
+ ******************************************************************************
+ */
+
+#include "host_font_encode.h"
+#include "lcd_font_index.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#ifdef HOST_FONTC_FREETYPE
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#endif
+
+#define ROW_BYTES(w)    (((w) + 7) / 8)
+#define BOX_CODE        0xFFFD
+
+static uint8_t wanted[0x10000];         // 需要收入字库的字符
+static int wanted_all = 1;
+
+/* ==================== 字符表 ==================== */
+
+static int Load_Charset(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    char *text;
+    long len;
+    uint16_t code;
+
+    if (f == NULL) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return -1;
+    }
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    text = calloc(len + 4, 1);          // 末尾补0，解码时不会越界
+    if (fread(text, 1, len, f) != (size_t)len) {
+        len = 0;
+    }
+    fclose(f);
+
+    for (const char *p = text; *p; ) {
+        p += LCD_FontIndex_Decode(p, &code);
+        if (code >= 0x20) wanted[code] = 1;
+    }
+    free(text);
+    wanted_all = 0;
+    return 0;
+}
+
+/* ==================== BDF ==================== */
+
+static int Load_BDF(HostFont_t *font, const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[512];
+    int ascent = -1, descent = -1, fbh = 0, fby = 0, fbw = 0, fbx = 0;
+    int code = -1, dwidth = 0, bw = 0, bh = 0, bx = 0, by = 0;
+    uint8_t *cell = NULL;
+
+    if (f == NULL) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "FONTBOUNDINGBOX %d %d %d %d", &fbw, &fbh, &fbx, &fby) == 4) continue;
+        if (sscanf(line, "FONT_ASCENT %d", &ascent) == 1) continue;
+        if (sscanf(line, "FONT_DESCENT %d", &descent) == 1) continue;
+        if (sscanf(line, "ENCODING %d", &code) == 1) continue;
+        if (sscanf(line, "DWIDTH %d", &dwidth) == 1) continue;
+        if (sscanf(line, "BBX %d %d %d %d", &bw, &bh, &bx, &by) == 4) continue;
+
+        if (strncmp(line, "BITMAP", 6) == 0) {
+            if (font->height == 0) {
+                if (ascent < 0) ascent = fbh + fby;
+                if (descent < 0) descent = -fby;
+                font->height = ascent + descent;
+            }
+
+            int width = (dwidth > 0) ? dwidth : bw;
+            if (width > 255) width = 255;
+            cell = calloc(ROW_BYTES(width) * font->height + 1, 1);
+
+            /* BDF每行按高位在前的十六进制给出，放入字符格时转换为低位在前 */
+            for (int r = 0; r < bh && fgets(line, sizeof(line), f); r++) {
+                int y = ascent - (by + bh) + r;
+                for (int c = 0; c < bw; c++) {
+                    int digit = c / 4, x = bx + c;
+                    char ch = line[digit];
+                    int v = isdigit((unsigned char)ch) ? ch - '0' : (toupper((unsigned char)ch) - 'A' + 10);
+
+                    if (!isxdigit((unsigned char)ch)) break;
+                    if ((v >> (3 - c % 4)) & 1) {
+                        if (x >= 0 && x < width && y >= 0 && y < font->height) {
+                            cell[y * ROW_BYTES(width) + x / 8] |= 1 << (x % 8);
+                        }
+                    }
+                }
+            }
+
+            if (code >= 0x20 && code <= 0xFFFF && (wanted_all || wanted[code])) {
+                HostFont_Add(font, code, width, cell);
+            }
+            free(cell);
+            code = -1;
+            dwidth = bw = bh = bx = by = 0;
+        }
+    }
+    fclose(f);
+    return (font->height > 0) ? 0 : -1;
+}
+
+/* ==================== TTF ==================== */
+
+#ifdef HOST_FONTC_FREETYPE
+static int Load_TTF(HostFont_t *font, const char *path, int pixels)
+{
+    FT_Library lib;
+    FT_Face face;
+
+    if (FT_Init_FreeType(&lib) || FT_New_Face(lib, path, 0, &face)) {
+        fprintf(stderr, "cannot load %s\n", path);
+        return -1;
+    }
+    FT_Set_Pixel_Sizes(face, 0, pixels);
+
+    int ascent = (face->size->metrics.ascender + 63) >> 6;
+    int descent = (-face->size->metrics.descender + 63) >> 6;
+    font->height = ascent + descent;
+
+    for (uint32_t code = 0x20; code <= 0xFFFF; code++) {
+        if (!(wanted_all || wanted[code])) continue;
+        if (FT_Get_Char_Index(face, code) == 0) continue;
+        if (font->bpp == 1) {
+            if (FT_Load_Char(face, code, FT_LOAD_RENDER | FT_LOAD_TARGET_MONO | FT_LOAD_MONOCHROME)) continue;
+        } else {
+            if (FT_Load_Char(face, code, FT_LOAD_RENDER | FT_LOAD_TARGET_NORMAL)) continue;
+        }
+
+        FT_GlyphSlot slot = face->glyph;
+        int width = (slot->advance.x + 32) >> 6;
+        if (width <= 0) continue;
+        if (width > 255) width = 255;
+
+        uint8_t bpp = font->bpp, levels = (1U << bpp) - 1U;
+        uint32_t row_bytes = (width * bpp + 7) / 8;
+        uint8_t *cell = calloc(row_bytes * font->height, 1);
+        for (int r = 0; r < (int)slot->bitmap.rows; r++) {
+            int y = ascent - slot->bitmap_top + r;
+            const uint8_t *src = slot->bitmap.buffer + r * slot->bitmap.pitch;
+            for (int c = 0; c < (int)slot->bitmap.width; c++) {
+                int x = slot->bitmap_left + c;
+                /* 单色位图高位在前；灰度位图每像素一个字节（0~255），量化到 bpp 位 */
+                uint32_t v = (bpp == 1) ? (src[c / 8] >> (7 - c % 8)) & 1 : (src[c] * levels + 127) / 255;
+                if (v && x >= 0 && x < width && y >= 0 && y < font->height) {
+                    uint32_t bit = x * bpp;
+                    cell[y * row_bytes + bit / 8] |= v << (bit % 8);
+                }
+            }
+        }
+        HostFont_Add(font, code, width, cell);
+        free(cell);
+    }
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(lib);
+    return 0;
+}
+#endif
+
+/* ==================== 输出 ==================== */
+
+static int Write_C(const char *path, const char *name, const char *input,
+                   const uint8_t *blob, uint32_t size, const HostFont_t *font)
+{
+    FILE *f = fopen(path, "w");
+
+    if (f == NULL) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return -1;
+    }
+    fprintf(f, "/* 由 host_fontc 生成，请勿手动修改\n");
+    fprintf(f, " * 字体: %s，高度 %u，%ubpp，%u 个字符，%u 字节 */\n\n", input, font->height, font->bpp, font->count, size);
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "__attribute__((aligned(4))) const uint8_t %s[%u] = {", name, size);
+    for (uint32_t i = 0; i < size; i++) {
+        fprintf(f, "%s0x%02X,", (i % 16) ? "" : "\n    ", blob[i]);
+    }
+    fprintf(f, "\n};\n");
+    fclose(f);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *input = NULL, *out_bin = NULL, *out_c = NULL, *name = "font_blob";
+    int pixels = 16, ascii = 0, bpp = 1;
+    HostFont_t font;
+    HostFont_Stats_t stats;
+    uint32_t size;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-i") && i + 1 < argc)      input = argv[++i];
+        else if (!strcmp(argv[i], "-p") && i + 1 < argc) pixels = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-b") && i + 1 < argc) bpp = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-c") && i + 1 < argc) { if (Load_Charset(argv[++i])) return 1; }
+        else if (!strcmp(argv[i], "-a"))                 ascii = 1;
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) out_bin = argv[++i];
+        else if (!strcmp(argv[i], "-C") && i + 1 < argc) out_c = argv[++i];
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc) name = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s -i font.bdf|font.ttf [-p px] [-b 1|2|4] [-c chars.txt] [-a] [-o out.bin] [-C out.c] [-n name]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (input == NULL || (out_bin == NULL && out_c == NULL)) {
+        fprintf(stderr, "need -i and -o/-C\n");
+        return 1;
+    }
+    if (bpp != 1 && bpp != 2 && bpp != 4) {
+        fprintf(stderr, "-b must be 1, 2 or 4\n");
+        return 1;
+    }
+    if (ascii) {
+        for (int c = 0x20; c < 0x7F; c++) wanted[c] = 1;
+        wanted_all = 0;
+    }
+
+    HostFont_Init(&font, 0);
+    font.bpp = bpp;
+    const char *ext = strrchr(input, '.');
+    int ret;
+    if (ext != NULL && (!strcmp(ext, ".ttf") || !strcmp(ext, ".otf") || !strcmp(ext, ".ttc"))) {
+#ifdef HOST_FONTC_FREETYPE
+        ret = Load_TTF(&font, input, pixels);
+#else
+        fprintf(stderr, "built without FreeType, convert %s to BDF first (e.g. otf2bdf)\n", input);
+        ret = -1;
+#endif
+    } else if (bpp != 1) {
+        fprintf(stderr, "anti-aliased output (-b %d) needs a TTF input\n", bpp);
+        ret = -1;
+    } else {
+        ret = Load_BDF(&font, input);
+    }
+    if (ret != 0 || font.count == 0) {
+        fprintf(stderr, "no glyphs loaded from %s\n", input);
+        return 1;
+    }
+
+    uint8_t box_width = 0;                  // 方框与字库中最宽的字符同宽
+    for (uint32_t i = 0; i < font.count; i++) {
+        if (font.glyphs[i].width > box_width) box_width = font.glyphs[i].width;
+    }
+    HostFont_AddBox(&font, BOX_CODE, box_width);
+    uint8_t *blob = HostFont_Build(&font, &size, &stats);
+
+    printf("%s: height %u, %ubpp, %u glyphs (%u RLE)\n", input, font.height, font.bpp, font.count, stats.rle_glyphs);
+    printf("  bitmap %u bytes -> glyph data %u bytes (%.1f%%), blob %u bytes\n",
+           stats.raw_bytes, stats.data_bytes, 100.0 * stats.data_bytes / stats.raw_bytes, size);
+
+    if (out_bin != NULL) {
+        FILE *f = fopen(out_bin, "wb");
+        if (f == NULL || fwrite(blob, 1, size, f) != size) {
+            fprintf(stderr, "cannot write %s\n", out_bin);
+            return 1;
+        }
+        fclose(f);
+    }
+    if (out_c != NULL && Write_C(out_c, name, input, blob, size, &font) != 0) {
+        return 1;
+    }
+
+    free(blob);
+    HostFont_Free(&font);
+    return 0;
+}
@@ -0,0 +1,170 @@
+/**
+ ******************************************************************************
+ * @file    host_jpegc.c
+ * @brief   图片转换工具 - 把PPM图像编码为 lcd_jpeg.h 支持的基线JPEG
+ ******************************************************************************
+ * @note
+ *   用法：
+ *     host_jpegc -i <图像.ppm | test> [-q 质量] [-s gray|444|422|420] [-r 复位间隔]
+ *                [-o 输出.jpg] [-C 输出.c] [-n 数组名]
+ *       -i  二进制PPM（P6，maxval 255）；"test" 使用内置测试图（240x240）
+ *       -q  1~100，默认75
+ *       -s  采样方式，默认420
+ *       -C  输出C源文件，数组可直接链接进固件（位于 .rodata，即QSPI）
+ *   其它格式的图片先转换为PPM，例如 convert photo.png -resize 240x240 photo.ppm
+ ******************************************************************************
+ */
+
+#include "host_jpeg_encode.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/* ==================== 输入 ==================== */
+
+static int PPM_Token(FILE *f)
+{
+    int c, v = 0;
+
+    do {
+        c = fgetc(f);
+        if (c == '#') {
+            while (c != '\n' && c != EOF) c = fgetc(f);
+        }
+    } while (isspace(c));
+    if (!isdigit(c)) {
+        return -1;
+    }
+    while (isdigit(c)) {
+        v = v * 10 + (c - '0');
+        c = fgetc(f);
+    }
+    return v;                               // 数值后的一个空白字符已读掉
+}
+
+static uint8_t *Load_PPM(const char *path, uint16_t *width, uint16_t *height)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *rgb = NULL;
+    int w, h, maxval;
+
+    if (f == NULL) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return NULL;
+    }
+    if (fgetc(f) != 'P' || fgetc(f) != '6') {
+        fprintf(stderr, "%s: not a binary PPM (P6)\n", path);
+        fclose(f);
+        return NULL;
+    }
+    w = PPM_Token(f);
+    h = PPM_Token(f);
+    maxval = PPM_Token(f);
+    if (w <= 0 || h <= 0 || w > 0xFFFF || h > 0xFFFF || maxval != 255) {
+        fprintf(stderr, "%s: unsupported size or maxval\n", path);
+        fclose(f);
+        return NULL;
+    }
+    rgb = malloc((size_t)w * h * 3);
+    if (fread(rgb, 3, (size_t)w * h, f) != (size_t)w * h) {
+        fprintf(stderr, "%s: truncated\n", path);
+        free(rgb);
+        rgb = NULL;
+    }
+    fclose(f);
+    *width = (uint16_t)w;
+    *height = (uint16_t)h;
+    return rgb;
+}
+
+/* ==================== 输出 ==================== */
+
+static int Write_C(const char *path, const char *name, const char *input,
+                   const uint8_t *jpeg, uint32_t size, uint16_t width, uint16_t height,
+                   int quality, const char *sampling)
+{
+    FILE *f = fopen(path, "w");
+
+    if (f == NULL) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return -1;
+    }
+    fprintf(f, "/* 由 host_jpegc 生成，请勿手动修改\n");
+    fprintf(f, " * 图片: %s，%ux%u，质量 %d，%s，%u 字节 */\n\n", input, width, height, quality, sampling, size);
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "const uint32_t %s_size = %u;\n\n", name, size);
+    fprintf(f, "__attribute__((aligned(4))) const uint8_t %s[%u] = {", name, size);
+    for (uint32_t i = 0; i < size; i++) {
+        fprintf(f, "%s0x%02X,", (i % 16) ? "" : "\n    ", jpeg[i]);
+    }
+    fprintf(f, "\n};\n");
+    fclose(f);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    static const char *sampling_names[] = { "gray", "444", "422", "420" };
+    const char *input = NULL, *out_jpg = NULL, *out_c = NULL, *name = "image_jpeg", *sampling = "420";
+    int quality = 75, restart = 0, sub = -1;
+    uint16_t width, height;
+    uint8_t *rgb;
+    uint32_t size;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-i") && i + 1 < argc)      input = argv[++i];
+        else if (!strcmp(argv[i], "-q") && i + 1 < argc) quality = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc) sampling = argv[++i];
+        else if (!strcmp(argv[i], "-r") && i + 1 < argc) restart = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) out_jpg = argv[++i];
+        else if (!strcmp(argv[i], "-C") && i + 1 < argc) out_c = argv[++i];
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc) name = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s -i image.ppm|test [-q quality] [-s gray|444|422|420] [-r restart] [-o out.jpg] [-C out.c] [-n name]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (input == NULL || (out_jpg == NULL && out_c == NULL)) {
+        fprintf(stderr, "need -i and -o/-C\n");
+        return 1;
+    }
+    for (int s = 0; s < 4; s++) {
+        if (!strcmp(sampling, sampling_names[s])) sub = s;
+    }
+    if (sub < 0 || quality < 1 || quality > 100 || restart < 0 || restart > 0xFFFF) {
+        fprintf(stderr, "bad -s/-q/-r value\n");
+        return 1;
+    }
+
+    if (!strcmp(input, "test")) {
+        width = height = LCD_WIDTH;
+        rgb = malloc((size_t)width * height * 3);
+        HostJPEG_TestImage(rgb, width, height);
+    } else {
+        rgb = Load_PPM(input, &width, &height);
+    }
+    if (rgb == NULL) {
+        return 1;
+    }
+
+    uint8_t *jpeg = HostJPEG_Encode(rgb, width, height, quality, (LCD_JPEG_Subsampling_t)sub, (uint16_t)restart, &size);
+    printf("%s: %ux%u, quality %d, %s -> %u bytes (RGB565 %u bytes, %.1f%%)\n", input, width, height,
+           quality, sampling, size, width * height * 2U, 100.0 * size / (width * height * 2.0));
+
+    if (out_jpg != NULL) {
+        FILE *f = fopen(out_jpg, "wb");
+        if (f == NULL || fwrite(jpeg, 1, size, f) != size) {
+            fprintf(stderr, "cannot write %s\n", out_jpg);
+            return 1;
+        }
+        fclose(f);
+    }
+    if (out_c != NULL && Write_C(out_c, name, strcmp(input, "test") ? input : "内置测试图", jpeg, size, width, height, quality, sampling) != 0) {
+        return 1;
+    }
+
+    free(jpeg);
+    free(rgb);
+    return 0;
+}
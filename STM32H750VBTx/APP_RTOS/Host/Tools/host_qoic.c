@@ -0,0 +1,218 @@
+/**
+ ******************************************************************************
+ * @file    host_qoic.c
+ * @brief   无损图片工具 - PNG/PPM 编码为 lcd_qoi.h 的QOI565数据，或解码为PPM
+ ******************************************************************************
+ * @note
+ *   用法：
+ *     编码：host_qoic -i <输入.png | 输入.ppm | ui | icon> [-W 宽] [-H 高] [-k 图标序号]
+ *                     [-o 输出.q565] [-C 输出.c] [-n 数组名]
+ *       -i  PNG（CMake 找到 libpng 时支持，透明像素与黑色背景混合）或 P6 PPM；
+ *           "ui" / "icon" 使用内置界面测试图 / 图标测试图
+ *       -W/-H  内置图的尺寸，默认 240x240（图标 83x83）
+ *     解码：host_qoic -d 输入.q565 -p 输出.ppm
+ *       用固件的解码器（lcd_qoi.c）解码
+ *   RGB888 截断为RGB565后编码，之后无损；输出压缩率（相对RGB565原始数据）
+ ******************************************************************************
+ */
+
+#include "host_qoi_encode.h"
+#include "host_clip_encode.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HOST_QOIC_PNG
+#include <png.h>
+#endif
+
+LCD_SPI_DMA_Handle_t hlcd_dma;      // lcd_spi_dma.c 的中断回调通过 extern 引用
+
+#ifdef HOST_QOIC_PNG
+static uint8_t *Load_PNG(const char *path, uint16_t *width, uint16_t *height)
+{
+    png_image image;
+    uint8_t *rgb;
+
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path)) {
+        fprintf(stderr, "%s: %s\n", path, image.message);
+        return NULL;
+    }
+    if (image.width > 0xFFFF || image.height > 0xFFFF) {
+        fprintf(stderr, "%s: image too large\n", path);
+        png_image_free(&image);
+        return NULL;
+    }
+    // 透明通道与黑色背景混合，得到RGB888
+    image.format = PNG_FORMAT_RGB;
+    rgb = malloc(PNG_IMAGE_SIZE(image));
+    if (!png_image_finish_read(&image, NULL, rgb, 0, NULL)) {
+        fprintf(stderr, "%s: %s\n", path, image.message);
+        free(rgb);
+        return NULL;
+    }
+    *width = (uint16_t)image.width;
+    *height = (uint16_t)image.height;
+    return rgb;
+}
+#endif
+
+static uint8_t *Load_Image(const char *path, uint16_t *width, uint16_t *height)
+{
+    size_t n = strlen(path);
+
+    if (n > 4 && !strcmp(path + n - 4, ".png")) {
+#ifdef HOST_QOIC_PNG
+        return Load_PNG(path, width, height);
+#else
+        fprintf(stderr, "%s: built without libpng, convert to PPM first\n", path);
+        return NULL;
+#endif
+    }
+    return HostClip_LoadPPM(path, width, height);
+}
+
+static int Write_C(const char *path, const char *name, const char *input, const uint8_t *data, uint32_t size)
+{
+    const LCD_QOI_Header_t *h = (const LCD_QOI_Header_t *)data;
+    FILE *f = fopen(path, "w");
+
+    if (f == NULL) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return -1;
+    }
+    fprintf(f, "/* 由 host_qoic 生成，请勿手动修改\n");
+    fprintf(f, " * 图片: %s，%ux%u，QOI565 %u 字节（RGB565 %u 字节） */\n\n", input, h->width, h->height,
+            size, h->width * h->height * 2U);
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "const uint32_t %s_size = %u;\n\n", name, size);
+    fprintf(f, "__attribute__((aligned(4))) const uint8_t %s[%u] = {", name, size);
+    for (uint32_t i = 0; i < size; i++) {
+        fprintf(f, "%s0x%02X,", (i % 16) ? "" : "\n    ", data[i]);
+    }
+    fprintf(f, "\n};\n");
+    fclose(f);
+    return 0;
+}
+
+static int Decode_File(const char *path, const char *out)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *data;
+    uint16_t *img, w, h;
+    long size;
+
+    if (f == NULL) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc((size_t)size);
+    if (fread(data, 1, (size_t)size, f) != (size_t)size) {
+        fprintf(stderr, "%s: read error\n", path);
+        return 1;
+    }
+    fclose(f);
+
+    if (LCD_QOI_GetInfo(data, (uint32_t)size, &w, &h) != HAL_OK) {
+        fprintf(stderr, "%s: not a QOI565 image\n", path);
+        return 1;
+    }
+    img = malloc((size_t)w * h * sizeof(uint16_t));
+    if (LCD_QOI_Decode(data, (uint32_t)size, img, w) != HAL_OK) {
+        fprintf(stderr, "%s: corrupt data\n", path);
+        return 1;
+    }
+    if (HostClip_SavePPM(out, img, w, h) != 0) {
+        fprintf(stderr, "cannot write %s\n", out);
+        return 1;
+    }
+    printf("%s: %ux%u -> %s\n", path, w, h, out);
+    free(img);
+    free(data);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *input = NULL, *out_file = NULL, *out_c = NULL, *name = "image";
+    const char *decode = NULL, *out_ppm = "image.ppm";
+    int width = 0, height = 0, icon = 0;
+    uint16_t w, h;
+    uint8_t *rgb;
+    uint16_t *img;
+    uint32_t size;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-i") && i + 1 < argc)      input = argv[++i];
+        else if (!strcmp(argv[i], "-W") && i + 1 < argc) width = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-H") && i + 1 < argc) height = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-k") && i + 1 < argc) icon = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) out_file = argv[++i];
+        else if (!strcmp(argv[i], "-C") && i + 1 < argc) out_c = argv[++i];
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc) name = argv[++i];
+        else if (!strcmp(argv[i], "-d") && i + 1 < argc) decode = argv[++i];
+        else if (!strcmp(argv[i], "-p") && i + 1 < argc) out_ppm = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s -i in.png|in.ppm|ui|icon [-W w] [-H h] [-k icon] [-o out.q565] [-C out.c] [-n name]\n"
+                            "       %s -d in.q565 [-p out.ppm]\n", argv[0], argv[0]);
+            return 1;
+        }
+    }
+    if (decode != NULL) {
+        return Decode_File(decode, out_ppm);
+    }
+    if (input == NULL || (out_file == NULL && out_c == NULL)) {
+        fprintf(stderr, "need -i and -o/-C (or -d)\n");
+        return 1;
+    }
+    if (width < 0 || width > 0xFFFF || height < 0 || height > 0xFFFF || icon < 0) {
+        fprintf(stderr, "bad -W/-H/-k value\n");
+        return 1;
+    }
+
+    if (!strcmp(input, "ui") || !strcmp(input, "icon")) {
+        bool is_icon = input[0] == 'i';
+        w = (uint16_t)(width ? width : is_icon ? 83 : LCD_WIDTH);
+        h = (uint16_t)(height ? height : is_icon ? 83 : LCD_HEIGHT);
+        rgb = malloc((size_t)w * h * 3);
+        if (is_icon) {
+            HostQOI_TestIcon(rgb, w, h, (uint32_t)icon);
+        } else {
+            HostQOI_TestArt(rgb, w, h);
+        }
+    } else {
+        rgb = Load_Image(input, &w, &h);
+        if (rgb == NULL) {
+            return 1;
+        }
+    }
+
+    img = malloc((size_t)w * h * sizeof(uint16_t));
+    HostClip_ToRGB565(rgb, img, (uint32_t)w * h);
+    uint8_t *data = HostQOI_Encode(img, w, h, &size);
+    printf("%s: %ux%u -> %u bytes (RGB565 %u bytes, ratio %.2f:1)\n",
+           input, w, h, size, w * h * 2U, (double)w * h * 2 / size);
+
+    if (out_file != NULL) {
+        FILE *f = fopen(out_file, "wb");
+        if (f == NULL || fwrite(data, 1, size, f) != size) {
+            fprintf(stderr, "cannot write %s\n", out_file);
+            return 1;
+        }
+        fclose(f);
+    }
+    if (out_c != NULL && Write_C(out_c, name, !strcmp(input, "ui") ? "内置界面测试图" :
+                                 !strcmp(input, "icon") ? "内置图标测试图" : input, data, size) != 0) {
+        return 1;
+    }
+
+    free(data);
+    free(img);
+    free(rgb);
+    return 0;
+}